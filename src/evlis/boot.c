@@ -9,6 +9,7 @@
  */
 
 #include <stdlib.h>
+#include <limits.h>
 #include <string.h>
 #include <ctype.h>
 #include <unistd.h>
@@ -19,14 +20,21 @@ char	inbuf[256];
 int	inptr = 0,
 	inlim = 0;
 
-int rreadc(void) {
+int rpeekc(void) {
 	if (inptr >= inlim) {
 		inlim = read(infd, inbuf, 256);
-		if (inlim < 1) return 0;
 		inptr = 0;
+		if (inlim < 1) return 0;
 	}
-	inptr++;
-	return toupper(inbuf[inptr-1]);
+	return toupper(inbuf[inptr]);
+}
+
+int rreadc(void) {
+	int	c;
+
+	c = rpeekc();
+	if (inptr < inlim) inptr++;
+	return c;
 }
 
 int	outfd = 1;
@@ -62,9 +70,23 @@ void prnum(int n) {
 		prnum2(n);
 }
 
-#define limit	65535
+/*
+ * Cells are 16 bits wide by default, which limits programs
+ * to 64K cells. Compile with -DCELL32 for 32-bit cells; the
+ * number of cells is then taken from the LISCELLS environment
+ * variable at startup (default 1M). Cell indexes are counted
+ * in ints, so there may be at most INT_MAX cells.
+ */
 
-#define cell	unsigned short
+#ifdef CELL32
+ #define cell	unsigned int
+ #define maxnum	2147483647L
+cell	limit = 1048576;
+#else
+ #define cell	unsigned short
+ #define maxnum	65535L
+ #define limit	65535
+#endif
 
 void print2(cell n);
 
@@ -97,12 +119,19 @@ void halt(char *s, cell n) {
 #define atomtag	1
 #define marktag	2
 #define travtag	4
+#define numtag	8
 
+#ifdef CELL32
+cell	*car,
+	*cdr;
+char	*tag;
+#else
 cell	car[limit],
 	cdr[limit];
 char	tag[limit];
+#endif
 
-cell	low = limit;
+cell	low;
 
 void mark(cell n) {
 	cell	p, x;
@@ -125,7 +154,7 @@ void mark(cell n) {
 				n = x;
 			}
 		}
-		else if (tag[n] & atomtag) {
+		else if (tag[n] & (atomtag|numtag)) {
 			x = cdr[n];
 			cdr[n] = p;
 			p = n;
@@ -148,12 +177,36 @@ int	verbose = 0;
 #define ref(x) car[x]
 #define val(x) cdr[x]
 
+/*
+ * Values saved by BIND and LABEL are kept on ARGSTK, where
+ * the collector can find them, and return labels are kept on
+ * RETSTK. In function mode each lambda is compiled to a C
+ * function that finds its arguments on ARGSTK. It swaps them
+ * with the values of its variables on entry and swaps them
+ * back on exit. DEPTH counts the C calls in progress, so
+ * they are limited like return labels in RETSTK.
+ */
+
+#define nargs	32768
+
+cell	argstk[nargs],
+	*asp = argstk;
+
+cell	retstk[nargs],
+	*rsp = retstk;
+
+int	depth = 0;
+
+void	(**funtab)(cell *, int);
+
 int gc(void) {
 	int	i, k;
+	cell	*p;
 
 	k = 0;
 	ref(frelis) = nil;
 	for (i=0; i<=frelis; i++) mark(i);
+	for (p = argstk; p < asp; p++) mark(*p);
 	for (i=0; i<limit; i++) {
 		if (0 == (tag[i] & marktag)) {
 			cdr[i] = ref(frelis);
@@ -190,6 +243,17 @@ cell cons3(cell a, cell d, cell t) {
 	return n;
 }
 
+/*
+ * A number is a single cell tagged NUMTAG that holds
+ * its value in the car field, so numbers range from
+ * 0 to MAXNUM.
+ */
+
+cell mknum(long n) {
+	if (n < 0 || n > maxnum) halt("NUMBER OUT OF RANGE", limit);
+	return cons3(n, nil, numtag);
+}
+
 cell mkfun(int k) {
 	return cons3(cons3(funtag, cons3(k, nil, atomtag),
 				atomtag),
@@ -236,7 +300,7 @@ void load(cell n) {
 
 	m = "IMAGE LOAD FAILED, ABORTING";
 	s = atomname(n);
-	fd = open(s, O_RDONLY, 0777);
+	fd = open(s, O_RDONLY);
 	if (fd < 0) {
 		pr("IMAGE NOT LOADED\n");
 		return;
@@ -266,6 +330,14 @@ cell readc(void) {
 	return cons3(c, nil, atomtag);
 }
 
+cell peekc(void) {
+	int	c;
+
+	c = rpeekc();
+	if (0 == c) return nil;
+	return cons3(c, nil, atomtag);
+}
+
 void writec(cell x) {
 	if (tag[x] & atomtag)
 		rwritec(car[x]);
@@ -280,6 +352,9 @@ void print2(cell n) {
 	else if (n == true) {
 		pr("T");
 	}
+	else if (tag[n] & numtag) {
+		prnum(car[n]);
+	}
 	else if (tag[n] & atomtag) {
 		pr("<");
 		rwritec(car[n]);
@@ -299,7 +374,7 @@ void print2(cell n) {
 	else {
 		rwritec('(');
 		while (n != nil) {
-			if (n <= 1 || tag[n] & atomtag ||
+			if (n <= 1 || tag[n] & (atomtag|numtag) ||
 			    tag[car[n]] & atomtag)
 			{
 				pr(". ");
@@ -320,6 +395,29 @@ void print(cell n) {
 }
 
 void init(void) {
+#ifdef CELL32
+	char		*s, *e;
+	unsigned long	n;
+
+	if ((s = getenv("LISCELLS")) != NULL) {
+		n = strtoul(s, &e, 10);
+		if (e == s || *e || n < 1024 || n > INT_MAX) {
+			pr("BAD LISCELLS VALUE\n");
+			flush();
+			exit(1);
+		}
+		limit = n;
+	}
+	car = malloc(limit*sizeof(cell));
+	cdr = malloc(limit*sizeof(cell));
+	tag = malloc(limit);
+	if (NULL == car || NULL == cdr || NULL == tag) {
+		pr("NOT ENOUGH MEMORY\n");
+		flush();
+		exit(1);
+	}
+#endif
+	low = limit;
 	memset(car, 0, limit*sizeof(cell));
 	memset(cdr, 0, limit*sizeof(cell));
 	memset(tag, 0, limit);
@@ -337,69 +435,266 @@ void init(void) {
 #define label(x) case x:
 #define goto(x) k = x; break
 #define symbolic() (tag[car[ref(expr)]] & atomtag)
-#define atomic() (ref(expr) <= 1 || symbolic())
-#define unbind() restore(car[ref(stack)])
+#define numeric() (tag[ref(expr)] & numtag)
+#define atomic() (ref(expr) <= 1 || numeric() || symbolic())
+#define unbind() restore()
 #define u(c) toupper(c)
 #define car_err() halt("CAR: EXPECTED LIST", ref(expr));
 #define cdr_err() halt("CDR: EXPECTED LIST", ref(expr));
 
+void args(int m) {
+	if (asp + m > argstk + nargs)
+		halt("ARGUMENT STACK OVERFLOW", limit);
+	while (m--) *asp++ = nil;
+}
+
+/*
+ * BIND pops the argument list off the stack and pushes the
+ * old values of the variables in V, followed by V itself.
+ */
+
 void bind(cell v) {
-	cell	a, p, n;
+	cell	a, p;
 
-	a = cdr[car[ref(stack)]];
+	a = car[ref(stack)];
+	ref(stack) = cdr[ref(stack)];
 	if (tag[car[v]] & atomtag) {
-		cdr[car[ref(stack)]] =
-			cons3(nil, cons3(v, cons3(val(v), a, 0), 0), 0);
+		args(1);
+		asp[-1] = val(v);
 		val(v) = a;
 	}
 	else {
-		for (p = a; p != nil; p = cdr[p]) {
-			if (nil == v) break;
-			n = car[p];
-			car[p] = cons3(car[v], val(car[v]), 0);
-			val(car[v]) = n;
-			v = cdr[v];
+		for (p = v; p != nil; p = cdr[p]) {
+			if (nil == a) break;
+			args(1);
+			asp[-1] = val(car[p]);
+			val(car[p]) = car[a];
+			a = cdr[a];
 		}
-		if (p != nil || v != nil)
+		if (p != nil || a != nil)
 			halt("WRONG NUMBER OF ARGUMENTS", limit);
 	}
+	args(1);
+	asp[-1] = v;
 }
 
-int restore(cell p) {
-	int	k;
+void restore(void) {
+	cell	v, p;
+	int	n;
 
-	k = car[p];
-	if (nil == car[cdr[p]]) {
-		p = cdr[cdr[p]];
-		val(car[p]) = car[cdr[p]];
+	v = *--asp;
+	if (tag[car[v]] & atomtag) {
+		val(v) = *--asp;
+		return;
 	}
-	else {
-		for (p = cdr[p]; p != nil; p = cdr[p])
-			val(car[car[p]]) = cdr[car[p]];
+	for (n = 0, p = v; p != nil; p = cdr[p]) n++;
+	asp -= n;
+	for (p = v; p != nil; p = cdr[p])
+		val(car[p]) = *asp++;
+	asp -= n;
+}
+
+cell arith(int op) {
+	long	a, b;
+
+	if (!numeric())
+		halt("EXPECTED NUMBER", ref(expr));
+	if (!(tag[ref(expr2)] & numtag))
+		halt("EXPECTED NUMBER", ref(expr2));
+	a = car[ref(expr)];
+	b = car[ref(expr2)];
+	if (0 == b && ('/' == op || '%' == op))
+		halt("DIVISION BY ZERO", limit);
+	switch (op) {
+	case '+':	if (b > maxnum - a)
+				halt("NUMBER OUT OF RANGE", limit);
+			return mknum(a + b);
+	case '-':	return mknum(a - b);
+	case '*':	if (a != 0 && b > maxnum / a)
+				halt("NUMBER OUT OF RANGE", limit);
+			return mknum(a * b);
+	case '/':	return mknum(a / b);
+	case '%':	return mknum(a % b);
+	default:	return a < b? true: nil;
 	}
-	return k;
 }
 
-int apply(int n) {
-	if (!symbolic() || car[car[ref(expr)]] != funtag)
+int fnlabel(void) {
+	if (numeric() || !symbolic() || car[car[ref(expr)]] != funtag)
 		halt("APPLICATION OF NON-FUNCTION", ref(expr));
+	return car[cdr[car[ref(expr)]]];
+}
+
+int apply(int n) {
+	int	k;
+
+	k = fnlabel();
 	if (n < 0) {
-		car[ref(stack)] = cons3(restore(car[cdr[ref(stack)]]),
-					car[ref(stack)], 0);
-		cdr[ref(stack)] = cdr[cdr[ref(stack)]];
+		restore();
 	}
 	else {
-		car[ref(stack)] = cons3(n, car[ref(stack)], atomtag);
+		if (rsp >= retstk + nargs)
+			halt("RETURN STACK OVERFLOW", limit);
+		*rsp++ = n;
 	}
-	return car[cdr[car[ref(expr)]]];
+	return k;
 }
 
 int retn(void) {
-	int	k;
+	return *--rsp;
+}
 
-	k = car[car[ref(stack)]];
-	ref(stack) = cdr[ref(stack)];
-	return k;
+#define pusharg() (args(1), asp[-1] = ref(expr))
+#define poparg() (*--asp)
+#define pushval(v) (args(1), asp[-1] = val(v))
+#define popval(v) val(v) = *--asp
+#define argn(n, m) \
+	if ((n) != (m)) halt("WRONG NUMBER OF ARGUMENTS", limit)
+#define bindarg(i, v) { cell t = val(v); val(v) = a[i]; a[i] = t; }
+#define unbindarg(i, v) val(v) = a[i]
+#define tailargs(m) \
+	(memmove(a, asp - (m), (m) * sizeof(cell)), asp = a + (m))
+#define fcall(p, m) funtab[fnlabel()](p, m)
+#define enter() \
+	if (++depth >= nargs) halt("RETURN STACK OVERFLOW", limit)
+#define leave() depth--
+
+void restargs(cell *a, int n) {
+	ref(expr) = nil;
+	while (n--)
+		ref(expr) = cons3(a[n], ref(expr), 0);
+	asp = a;
+	args(1);
+	a[0] = ref(expr);
+}
+
+void pool(cell n) {
+	if (n >= limit) halt("POOL DOES NOT FIT INTO MEMORY", limit);
+}
+
+/*
+ * The reader works on characters in INBUF and interns
+ * symbols directly, so reading a known symbol allocates
+ * nothing. The list being read is kept on ARGSTK.
+ */
+
+#define maxtok	1024
+
+cell	token[maxtok];
+cell	qname[] = { 'Q', 'U', 'O', 'T', 'E' };
+
+cell intern(cell *s, int k) {
+	cell	b, p, n, c;
+	int	i;
+
+	c = k? s[0]: 0;
+	for (b = ref(symlis); b != nil; b = cdr[b]) {
+		n = car[car[car[b]]];
+		if (car[n] == c && nil == cdr[n]) break;
+	}
+	if (nil == b) {
+		n = cons3(c, nil, atomtag);
+		n = cons3(n, nil, 0);
+		n = cons3(n, nil, 0);
+		b = ref(symlis) = cons3(n, ref(symlis), 0);
+	}
+	b = car[b];
+	for (p = cdr[b]; p != nil; p = cdr[p]) {
+		n = car[car[p]];
+		for (i = 0; i < k && n != nil && car[n] == s[i]; i++)
+			n = cdr[n];
+		if (i == k && nil == n) return car[p];
+	}
+	n = nil;
+	while (k--) n = cons3(s[k], n, atomtag);
+	n = cons3(n, nil, 0);
+	cdr[b] = cons3(n, cdr[b], 0);
+	return n;
+}
+
+#define issym(c) (isupper(c) || isdigit(c) || '*' == (c) || '-' == (c))
+
+int skipc(void) {
+	int	c;
+
+	for (;;) {
+		c = rpeekc();
+		if (' ' == c || '\n' == c) {
+			rreadc();
+		}
+		else if (';' == c) {
+			while ((c = rreadc()) != 0 && c != '\n')
+				;
+		}
+		else {
+			return c;
+		}
+	}
+}
+
+cell rdobj(void);
+
+cell rdlist(void) {
+	cell	a, n, p;
+	int	c;
+
+	args(1);
+	for (;;) {
+		c = skipc();
+		if (0 == c) halt("UNTERMINATED LIST", limit);
+		if (')' == c) break;
+		n = rdobj();
+		asp[-1] = cons3(n, asp[-1], 0);
+	}
+	rreadc();
+	a = nil;
+	for (n = *--asp; n != nil; n = p) {
+		p = cdr[n];
+		cdr[n] = a;
+		a = n;
+	}
+	return a;
+}
+
+cell rdobj(void) {
+	cell	n, q;
+	int	c, k;
+
+	while (')' == (c = skipc()))
+		rreadc();
+	if (0 == c)
+		return nil;
+	if (issym(c)) {
+		for (k = 0; issym(rpeekc()); k++) {
+			if (k >= maxtok) halt("SYMBOL TOO LONG", limit);
+			token[k] = rreadc();
+		}
+		if (3 == k && 'N' == token[0] && 'I' == token[1] &&
+		    'L' == token[2])
+			return nil;
+		return intern(token, k);
+	}
+	rreadc();
+	if ('(' == c)
+		return rdlist();
+	if ('\'' == c) {
+		q = intern(qname, 5);
+		n = rdobj();
+		return cons3(q, cons3(n, nil, 0), 0);
+	}
+	if ('"' == c) {
+		for (k = 0; (c = rreadc()) != '"'; k++) {
+			if ('\\' == c) c = rreadc();
+			if (0 == c) halt("UNTERMINATED STRING", limit);
+			if (k >= maxtok) halt("STRING TOO LONG", limit);
+			token[k] = c;
+		}
+		n = intern(token, k);
+		q = intern(qname, 5);
+		return cons3(q, cons3(n, nil, 0), 0);
+	}
+	halt("FUNNY CHARACTER", limit);
+	return nil;
 }
 
 void run(void);
@@ -448,6 +743,7 @@ val(133) = ref(expr);
 goto(1);
 label(2);
 bind(136);
+label(3);
 ref(expr) = val(135);
 ref(expr) = atomic()? true: nil;
 unbind();
@@ -455,31 +751,34 @@ k = retn(); break;
 label(1);
 ref(expr) = mkfun(2);
 val(141) = ref(expr);
-goto(3);
-label(4);
+goto(4);
+label(5);
 bind(142);
+label(6);
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 unbind();
 k = retn(); break;
-label(3);
-ref(expr) = mkfun(4);
+label(4);
+ref(expr) = mkfun(5);
 val(146) = ref(expr);
-goto(5);
-label(6);
+goto(7);
+label(8);
 bind(147);
+label(9);
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
 unbind();
 k = retn(); break;
-label(5);
-ref(expr) = mkfun(6);
+label(7);
+ref(expr) = mkfun(8);
 val(151) = ref(expr);
-goto(7);
-label(8);
+goto(10);
+label(11);
 bind(155);
+label(12);
 ref(expr) = val(153);
 push();
 ref(expr) = val(135);
@@ -487,12 +786,13 @@ ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 unbind();
 k = retn(); break;
-label(7);
-ref(expr) = mkfun(8);
-val(160) = ref(expr);
-goto(9);
 label(10);
+ref(expr) = mkfun(11);
+val(160) = ref(expr);
+goto(13);
+label(14);
 bind(162);
+label(15);
 ref(expr) = val(153);
 push();
 ref(expr) = val(135);
@@ -500,226 +800,351 @@ ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 unbind();
 k = retn(); break;
-label(9);
-ref(expr) = mkfun(10);
-val(165) = ref(expr);
-goto(11);
-label(12);
-bind(166);
-ref(expr) = val(135);
-halt(atomname(ref(expr)), 65535);
-unbind();
-k = retn(); break;
-label(11);
-ref(expr) = mkfun(12);
-val(171) = ref(expr);
-goto(13);
-label(14);
-bind(172);
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-unbind();
-k = retn(); break;
 label(13);
 ref(expr) = mkfun(14);
-val(177) = ref(expr);
-goto(15);
-label(16);
-bind(178);
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-unbind();
-k = retn(); break;
-label(15);
-ref(expr) = mkfun(16);
-val(183) = ref(expr);
-goto(17);
+val(165) = ref(expr);
+goto(16);
+label(17);
+bind(166);
 label(18);
-bind(184);
 ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+halt(atomname(ref(expr)), limit);
 unbind();
 k = retn(); break;
-label(17);
-ref(expr) = mkfun(18);
-val(189) = ref(expr);
+label(16);
+ref(expr) = mkfun(17);
+val(171) = ref(expr);
 goto(19);
 label(20);
-bind(190);
+bind(172);
+label(21);
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = numeric()? true: nil;
 unbind();
 k = retn(); break;
 label(19);
 ref(expr) = mkfun(20);
-val(195) = ref(expr);
-goto(21);
-label(22);
-bind(196);
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-unbind();
-k = retn(); break;
-label(21);
-ref(expr) = mkfun(22);
-val(202) = ref(expr);
-goto(23);
+val(180) = ref(expr);
+goto(22);
+label(23);
+bind(182);
 label(24);
-bind(203);
+ref(expr) = val(153);
+push();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = arith('+');
 unbind();
 k = retn(); break;
-label(23);
-ref(expr) = mkfun(24);
-val(209) = ref(expr);
+label(22);
+ref(expr) = mkfun(23);
+val(187) = ref(expr);
 goto(25);
 label(26);
-bind(210);
+bind(189);
+label(27);
+ref(expr) = val(153);
+push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = arith('-');
 unbind();
 k = retn(); break;
 label(25);
 ref(expr) = mkfun(26);
-val(216) = ref(expr);
-goto(27);
-label(28);
-bind(217);
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-unbind();
-k = retn(); break;
-label(27);
-ref(expr) = mkfun(28);
-val(223) = ref(expr);
-goto(29);
+val(200) = ref(expr);
+goto(28);
+label(29);
+bind(202);
 label(30);
-bind(224);
+ref(expr) = val(153);
+push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = arith('*');
 unbind();
 k = retn(); break;
-label(29);
-ref(expr) = mkfun(30);
-val(230) = ref(expr);
+label(28);
+ref(expr) = mkfun(29);
+val(208) = ref(expr);
 goto(31);
 label(32);
-bind(231);
+bind(210);
+label(33);
+ref(expr) = val(153);
+push();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = arith('/');
 unbind();
 k = retn(); break;
 label(31);
 ref(expr) = mkfun(32);
-val(237) = ref(expr);
-goto(33);
-label(34);
-bind(238);
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-unbind();
-k = retn(); break;
-label(33);
-ref(expr) = mkfun(34);
-val(244) = ref(expr);
-goto(35);
+val(219) = ref(expr);
+goto(34);
+label(35);
+bind(221);
 label(36);
-bind(245);
+ref(expr) = val(153);
+push();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = arith('%');
 unbind();
 k = retn(); break;
-label(35);
-ref(expr) = mkfun(36);
-val(251) = ref(expr);
+label(34);
+ref(expr) = mkfun(35);
+val(231) = ref(expr);
 goto(37);
 label(38);
-bind(135);
+bind(233);
+label(39);
+ref(expr) = val(153);
+push();
 ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = arith('<');
 unbind();
 k = retn(); break;
 label(37);
 ref(expr) = mkfun(38);
-val(256) = ref(expr);
-goto(39);
-label(40);
-bind(257);
-ref(expr) = nil;
-push();
+val(239) = ref(expr);
+goto(40);
+label(41);
+bind(241);
+label(42);
 ref(expr) = val(135);
+push();
+ref(expr) = val(153);
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = arith('<');
 unbind();
 k = retn(); break;
-label(39);
-ref(expr) = mkfun(40);
-val(262) = ref(expr);
-ref(expr) = val(262);
-val(266) = ref(expr);
-goto(41);
-label(42);
-bind(268);
+label(40);
+ref(expr) = mkfun(41);
+val(250) = ref(expr);
+goto(43);
+label(44);
+bind(251);
+label(45);
 ref(expr) = val(135);
-ref(expr) = atomic()? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = 290;
-toframe();
-ref(expr) = val(171);
-k = apply(-1); break;
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+unbind();
+k = retn(); break;
+label(43);
+ref(expr) = mkfun(44);
+val(256) = ref(expr);
+goto(46);
+label(47);
+bind(257);
+label(48);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+unbind();
+k = retn(); break;
+label(46);
+ref(expr) = mkfun(47);
+val(262) = ref(expr);
+goto(49);
+label(50);
+bind(263);
+label(51);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+unbind();
+k = retn(); break;
+label(49);
+ref(expr) = mkfun(50);
+val(268) = ref(expr);
+goto(52);
+label(53);
+bind(269);
+label(54);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+unbind();
+k = retn(); break;
+label(52);
+ref(expr) = mkfun(53);
+val(274) = ref(expr);
+goto(55);
+label(56);
+bind(275);
+label(57);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+unbind();
+k = retn(); break;
+label(55);
+ref(expr) = mkfun(56);
+val(281) = ref(expr);
+goto(58);
+label(59);
+bind(282);
+label(60);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+unbind();
+k = retn(); break;
+label(58);
+ref(expr) = mkfun(59);
+val(288) = ref(expr);
+goto(61);
+label(62);
+bind(289);
+label(63);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+unbind();
+k = retn(); break;
+label(61);
+ref(expr) = mkfun(62);
+val(295) = ref(expr);
+goto(64);
+label(65);
+bind(296);
+label(66);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+unbind();
+k = retn(); break;
+label(64);
+ref(expr) = mkfun(65);
+val(302) = ref(expr);
+goto(67);
+label(68);
+bind(303);
+label(69);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+unbind();
+k = retn(); break;
+label(67);
+ref(expr) = mkfun(68);
+val(309) = ref(expr);
+goto(70);
+label(71);
+bind(310);
+label(72);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+unbind();
+k = retn(); break;
+label(70);
+ref(expr) = mkfun(71);
+val(316) = ref(expr);
+goto(73);
+label(74);
+bind(317);
+label(75);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+unbind();
+k = retn(); break;
+label(73);
+ref(expr) = mkfun(74);
+val(323) = ref(expr);
+goto(76);
+label(77);
+bind(324);
+label(78);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+unbind();
+k = retn(); break;
+label(76);
+ref(expr) = mkfun(77);
+val(330) = ref(expr);
+goto(79);
+label(80);
+bind(135);
+label(81);
+ref(expr) = val(135);
+unbind();
+k = retn(); break;
+label(79);
+ref(expr) = mkfun(80);
+val(335) = ref(expr);
+goto(82);
+label(83);
+bind(336);
+label(84);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+unbind();
+k = retn(); break;
+label(82);
+ref(expr) = mkfun(83);
+val(341) = ref(expr);
+ref(expr) = val(341);
+val(345) = ref(expr);
+goto(85);
+label(86);
+bind(347);
+label(87);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 369;
+toframe();
+ref(expr) = val(171);
+k = apply(-1); break;
 } else {
 ref(expr) = val(153);
 push();
@@ -729,17 +1154,18 @@ car[ref(expr)] = ref(expr2);
 }
 unbind();
 k = retn(); break;
-label(41);
-ref(expr) = mkfun(42);
-val(297) = ref(expr);
-goto(43);
-label(44);
-bind(299);
+label(85);
+ref(expr) = mkfun(86);
+val(376) = ref(expr);
+goto(88);
+label(89);
+bind(378);
+label(90);
 ref(expr) = val(135);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = 321;
+ref(expr) = 400;
 toframe();
 ref(expr) = val(171);
 k = apply(-1); break;
@@ -752,654 +1178,674 @@ cdr[ref(expr)] = ref(expr2);
 }
 unbind();
 k = retn(); break;
-label(43);
-ref(expr) = mkfun(44);
-val(328) = ref(expr);
-goto(45);
-label(46);
-bind(334);
+label(88);
+ref(expr) = mkfun(89);
+val(407) = ref(expr);
+goto(91);
+label(92);
+bind(413);
+label(93);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(330);
+ref(expr) = val(409);
 } else {
-newframe();
-ref(expr) = val(330);
+ref(expr) = val(409);
 push();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
-toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(341);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+val(409) = poparg();
+goto(93);
 }
 unbind();
 k = retn(); break;
-label(45);
-ref(expr) = mkfun(46);
-val(341) = ref(expr);
-goto(47);
-label(48);
-bind(342);
+label(91);
+ref(expr) = mkfun(92);
+val(420) = ref(expr);
+goto(94);
+label(95);
+bind(421);
+label(96);
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(341);
+ref(expr) = val(420);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(47);
-ref(expr) = mkfun(48);
-val(350) = ref(expr);
-goto(49);
-label(50);
-bind(351);
-newframe();
-ref(expr) = cons3(359, val(359), 0);
-toframe();
-goto(51);
-label(52);
-bind(361);
+label(94);
+ref(expr) = mkfun(95);
+val(429) = ref(expr);
+goto(97);
+label(98);
+bind(430);
+label(99);
+pushval(438);
+goto(100);
+label(101);
+bind(440);
+label(102);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(330);
+ref(expr) = val(409);
 } else {
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-val(368) = ref(expr);
-ref(expr) = val(330);
+val(447) = ref(expr);
+ref(expr) = val(409);
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 cdr[ref(expr)] = ref(expr2);
-newframe();
-ref(expr) = val(333);
-toframe();
-ref(expr) = val(368);
-toframe();
-ref(expr) = val(359);
-k = apply(-1); break;
+ref(expr) = val(412);
+pusharg();
+ref(expr) = val(447);
+pusharg();
+val(412) = poparg();
+val(409) = poparg();
+goto(102);
 }
 unbind();
 k = retn(); break;
-label(51);
-ref(expr) = mkfun(52);
-val(359) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(100);
+ref(expr) = mkfun(101);
+val(438) = ref(expr);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 ref(expr) = nil;
 } else {
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = 392;
+ref(expr) = 471;
 toframe();
 ref(expr) = val(171);
-k = apply(53); break;
-label(53);
+k = apply(103); break;
+label(103);
 } else {
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(359);
-k = apply(54); break;
-label(54);
+ref(expr) = val(438);
+k = apply(104); break;
+label(104);
 }
 }
-unbind();
-pop();
+popval(438);
 unbind();
 k = retn(); break;
-label(49);
-ref(expr) = mkfun(50);
-val(401) = ref(expr);
-goto(55);
-label(56);
-bind(403);
+label(97);
+ref(expr) = mkfun(98);
+val(480) = ref(expr);
+goto(105);
+label(106);
+bind(482);
+label(107);
 newframe();
-ref(expr) = val(330);
+ref(expr) = val(409);
 toframe();
 newframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(350);
-k = apply(57); break;
-label(57);
+ref(expr) = val(429);
+k = apply(108); break;
+label(108);
 toframe();
-ref(expr) = val(341);
+ref(expr) = val(420);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(55);
-ref(expr) = mkfun(56);
-val(410) = ref(expr);
-goto(58);
-label(59);
-bind(412);
-newframe();
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(60);
-label(61);
-bind(419);
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+label(105);
+ref(expr) = mkfun(106);
+val(489) = ref(expr);
+goto(109);
+label(110);
+bind(491);
+label(111);
+pushval(496);
+goto(112);
+label(113);
+bind(498);
+label(114);
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(330);
+ref(expr) = val(409);
 toframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(328);
+ref(expr) = val(407);
 k = apply(-1); break;
 } else {
 newframe();
-ref(expr) = val(330);
+ref(expr) = val(409);
 toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(425);
+ref(expr) = val(504);
 k = apply(-1); break;
 }
 unbind();
 k = retn(); break;
-label(60);
-ref(expr) = mkfun(61);
-val(417) = ref(expr);
-ref(expr) = nil;
-toframe();
-ref(expr) = val(333);
+label(112);
+ref(expr) = mkfun(113);
+val(496) = ref(expr);
+ref(expr) = val(412);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(330);
+ref(expr) = val(409);
 } else {
 newframe();
-ref(expr) = val(330);
+ref(expr) = val(409);
 toframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(417);
-k = apply(62); break;
-label(62);
-ref(expr) = val(333);
+ref(expr) = val(496);
+k = apply(115); break;
+label(115);
+ref(expr) = val(412);
 }
-unbind();
-pop();
+popval(496);
 unbind();
 k = retn(); break;
-label(58);
-ref(expr) = mkfun(59);
-val(425) = ref(expr);
-goto(63);
-label(64);
-bind(427);
-ref(expr) = val(330);
+label(109);
+ref(expr) = mkfun(110);
+val(504) = ref(expr);
+goto(116);
+label(117);
+bind(506);
+label(118);
+ref(expr) = val(409);
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 } else {
-ref(expr) = val(333);
+ref(expr) = val(412);
+ref(expr) = numeric()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(409);
+ref(expr) = numeric()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(409);
+push();
+ref(expr) = val(412);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = val(412);
+push();
+ref(expr) = val(409);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = true;
+}
+}
+} else {
+ref(expr) = nil;
+}
+} else {
+ref(expr) = val(412);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 ref(expr) = nil;
 } else {
-ref(expr) = val(330);
+ref(expr) = val(409);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 ref(expr) = nil;
 } else {
 newframe();
-ref(expr) = val(330);
-if (symbolic()) car_err();
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(433);
-k = apply(65); break;
-label(65);
+ref(expr) = val(512);
+k = apply(119); break;
+label(119);
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(330);
-if (symbolic()) cdr_err();
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(433);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+val(409) = poparg();
+goto(118);
 } else {
 ref(expr) = nil;
 }
 }
 }
 }
+}
 unbind();
 k = retn(); break;
-label(63);
-ref(expr) = mkfun(64);
-val(433) = ref(expr);
-goto(66);
-label(67);
-bind(435);
+label(116);
+ref(expr) = mkfun(117);
+val(512) = ref(expr);
+goto(120);
+label(121);
+bind(514);
+label(122);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 ref(expr) = nil;
 } else {
 newframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(433);
-k = apply(68); break;
-label(68);
+ref(expr) = val(512);
+k = apply(123); break;
+label(123);
 if (ref(expr) != nil) {
-ref(expr) = val(333);
+ref(expr) = val(412);
 } else {
-newframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
+pusharg();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(442);
-k = apply(-1); break;
+pusharg();
+val(135) = poparg();
+val(412) = poparg();
+goto(122);
 }
 }
 unbind();
 k = retn(); break;
-label(66);
-ref(expr) = mkfun(67);
-val(442) = ref(expr);
-goto(69);
-label(70);
-bind(444);
+label(120);
+ref(expr) = mkfun(121);
+val(521) = ref(expr);
+goto(124);
+label(125);
+bind(523);
+label(126);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 ref(expr) = nil;
 } else {
 newframe();
-newframe();
-ref(expr) = val(333);
-toframe();
-ref(expr) = val(177);
-k = apply(71); break;
-label(71);
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(433);
-k = apply(72); break;
-label(72);
+ref(expr) = val(512);
+k = apply(127); break;
+label(127);
 if (ref(expr) != nil) {
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 } else {
-newframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
+pusharg();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(450);
-k = apply(-1); break;
+pusharg();
+val(135) = poparg();
+val(412) = poparg();
+goto(126);
 }
 }
 unbind();
 k = retn(); break;
-label(69);
-ref(expr) = mkfun(70);
-val(450) = ref(expr);
-goto(73);
-label(74);
-bind(458);
-newframe();
-ref(expr) = cons3(462, val(462), 0);
-toframe();
-goto(75);
-label(76);
-bind(466);
+label(124);
+ref(expr) = mkfun(125);
+val(529) = ref(expr);
+goto(128);
+label(129);
+bind(537);
+label(130);
+pushval(541);
+goto(131);
+label(132);
+bind(545);
+label(133);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(464);
+ref(expr) = val(543);
 toframe();
-ref(expr) = val(401);
+ref(expr) = val(480);
 k = apply(-1); break;
 } else {
-newframe();
-ref(expr) = val(464);
+ref(expr) = val(543);
 push();
 newframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(457);
-k = apply(77); break;
-label(77);
+ref(expr) = val(536);
+k = apply(134); break;
+label(134);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
-toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(462);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+val(543) = poparg();
+goto(133);
 }
 unbind();
 k = retn(); break;
-label(75);
-ref(expr) = mkfun(76);
-val(462) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(131);
+ref(expr) = mkfun(132);
+val(541) = ref(expr);
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(453);
+ref(expr) = val(532);
 toframe();
-ref(expr) = val(462);
-k = apply(78); break;
-label(78);
-unbind();
-pop();
+ref(expr) = val(541);
+k = apply(135); break;
+label(135);
+popval(541);
 unbind();
 k = retn(); break;
-label(73);
-ref(expr) = mkfun(74);
-val(473) = ref(expr);
-goto(79);
-label(80);
-bind(479);
-newframe();
-ref(expr) = cons3(462, val(462), 0);
-toframe();
-goto(81);
-label(82);
-bind(482);
+label(128);
+ref(expr) = mkfun(129);
+val(552) = ref(expr);
+goto(136);
+label(137);
+bind(558);
+label(138);
+pushval(541);
+goto(139);
+label(140);
+bind(561);
+label(141);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(464);
+ref(expr) = val(543);
 toframe();
-ref(expr) = val(401);
+ref(expr) = val(480);
 k = apply(-1); break;
 } else {
 ref(expr) = nil;
 push();
-ref(expr) = val(330);
+ref(expr) = val(409);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(464);
+ref(expr) = val(543);
 toframe();
-ref(expr) = val(401);
+ref(expr) = val(480);
 k = apply(-1); break;
 } else {
-newframe();
-ref(expr) = val(464);
+ref(expr) = val(543);
 push();
 newframe();
-ref(expr) = val(330);
-if (symbolic()) car_err();
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(457);
-k = apply(83); break;
-label(83);
+ref(expr) = val(536);
+k = apply(142); break;
+label(142);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
-toframe();
-ref(expr) = val(330);
-if (symbolic()) cdr_err();
+pusharg();
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(462);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+val(409) = poparg();
+val(543) = poparg();
+goto(141);
 }
 }
 unbind();
 k = retn(); break;
-label(81);
-ref(expr) = mkfun(82);
-val(462) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(139);
+ref(expr) = mkfun(140);
+val(541) = ref(expr);
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(476);
+ref(expr) = val(555);
 toframe();
-ref(expr) = val(453);
+ref(expr) = val(532);
 toframe();
-ref(expr) = val(462);
-k = apply(84); break;
-label(84);
-unbind();
-pop();
+ref(expr) = val(541);
+k = apply(143); break;
+label(143);
+popval(541);
 unbind();
 k = retn(); break;
-label(79);
-ref(expr) = mkfun(80);
-val(490) = ref(expr);
-goto(85);
-label(86);
-bind(493);
-newframe();
-ref(expr) = cons3(497, val(497), 0);
-toframe();
-goto(87);
-label(88);
-bind(499);
+label(136);
+ref(expr) = mkfun(137);
+val(569) = ref(expr);
+goto(144);
+label(145);
+bind(572);
+label(146);
+pushval(576);
+goto(147);
+label(148);
+bind(578);
+label(149);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(464);
+ref(expr) = val(543);
 } else {
 newframe();
-newframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(464);
-toframe();
-ref(expr) = val(457);
-k = apply(89); break;
-label(89);
+ref(expr) = val(543);
 toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(536);
+k = apply(150); break;
+label(150);
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(497);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+val(543) = poparg();
+goto(149);
 }
 unbind();
 k = retn(); break;
-label(87);
-ref(expr) = mkfun(88);
-val(497) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(147);
+ref(expr) = mkfun(148);
+val(576) = ref(expr);
 newframe();
-ref(expr) = val(476);
+ref(expr) = val(555);
 toframe();
-ref(expr) = val(453);
+ref(expr) = val(532);
 toframe();
-ref(expr) = val(497);
-k = apply(90); break;
-label(90);
-unbind();
-pop();
+ref(expr) = val(576);
+k = apply(151); break;
+label(151);
+popval(576);
 unbind();
 k = retn(); break;
-label(85);
-ref(expr) = mkfun(86);
-val(506) = ref(expr);
-goto(91);
-label(92);
-bind(509);
-newframe();
-ref(expr) = cons3(497, val(497), 0);
-toframe();
-goto(93);
-label(94);
-bind(511);
+label(144);
+ref(expr) = mkfun(145);
+val(585) = ref(expr);
+goto(152);
+label(153);
+bind(588);
+label(154);
+pushval(576);
+goto(155);
+label(156);
+bind(590);
+label(157);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(464);
+ref(expr) = val(543);
 } else {
 newframe();
-newframe();
-ref(expr) = val(464);
+ref(expr) = val(543);
 toframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(457);
-k = apply(95); break;
-label(95);
-toframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(536);
+k = apply(158); break;
+label(158);
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(497);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+val(543) = poparg();
+goto(157);
 }
 unbind();
 k = retn(); break;
-label(93);
-ref(expr) = mkfun(94);
-val(497) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(155);
+ref(expr) = mkfun(156);
+val(576) = ref(expr);
 newframe();
-ref(expr) = val(476);
+ref(expr) = val(555);
 toframe();
 newframe();
-ref(expr) = val(453);
+ref(expr) = val(532);
 toframe();
-ref(expr) = val(350);
-k = apply(96); break;
-label(96);
+ref(expr) = val(429);
+k = apply(159); break;
+label(159);
 toframe();
-ref(expr) = val(497);
-k = apply(97); break;
-label(97);
-unbind();
-pop();
+ref(expr) = val(576);
+k = apply(160); break;
+label(160);
+popval(576);
 unbind();
 k = retn(); break;
-label(91);
-ref(expr) = mkfun(92);
-val(519) = ref(expr);
-goto(98);
-label(99);
-bind(522);
-ref(expr) = val(521);
+label(152);
+ref(expr) = mkfun(153);
+val(598) = ref(expr);
+goto(161);
+label(162);
+bind(601);
+label(163);
+ref(expr) = val(600);
 writec(ref(expr));
 unbind();
 k = retn(); break;
-label(98);
-ref(expr) = mkfun(99);
-val(529) = ref(expr);
-goto(100);
-label(101);
+label(161);
+ref(expr) = mkfun(162);
+val(608) = ref(expr);
+goto(164);
+label(165);
 bind(0);
+label(166);
 ref(expr) = val(133);
 writec(ref(expr));
 unbind();
 k = retn(); break;
-label(100);
-ref(expr) = mkfun(101);
-val(536) = ref(expr);
-goto(102);
-label(103);
-bind(537);
-newframe();
-ref(expr) = cons3(541, val(541), 0);
-toframe();
-goto(104);
-label(105);
-bind(542);
+label(164);
+ref(expr) = mkfun(165);
+val(615) = ref(expr);
+goto(167);
+label(168);
+bind(616);
+label(169);
+pushval(620);
+goto(170);
+label(171);
+bind(621);
+label(172);
 ref(expr) = nil;
 push();
 ref(expr) = val(135);
@@ -1409,124 +1855,248 @@ if (ref(expr) != nil) {
 } else {
 ref(expr) = val(135);
 writec(ref(expr));
-newframe();
 ref(expr) = val(135);
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(541);
-k = apply(-1); break;
+pusharg();
+val(135) = poparg();
+goto(172);
 }
 unbind();
 k = retn(); break;
-label(104);
-ref(expr) = mkfun(105);
-val(541) = ref(expr);
-ref(expr) = cons3(550, val(550), 0);
-toframe();
-goto(106);
-label(107);
-bind(551);
+label(170);
+ref(expr) = mkfun(171);
+val(620) = ref(expr);
+pushval(629);
+goto(173);
+label(174);
+bind(630);
+label(175);
 newframe();
 ref(expr) = val(135);
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(541);
+ref(expr) = val(620);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(106);
-ref(expr) = mkfun(107);
-val(550) = ref(expr);
-ref(expr) = cons3(558, val(558), 0);
-toframe();
-goto(108);
-label(109);
-bind(559);
-ref(expr) = nil;
+label(173);
+ref(expr) = mkfun(174);
+val(629) = ref(expr);
+pushval(637);
+goto(176);
+label(177);
+bind(640);
+label(178);
+ref(expr) = 641;
 push();
-ref(expr) = val(135);
+ref(expr) = val(639);
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = arith('<');
 if (ref(expr) != nil) {
 } else {
-ref(expr) = val(135);
-ref(expr) = atomic()? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = 562;
-toframe();
-ref(expr) = val(565);
-k = apply(110); break;
-label(110);
 newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(565);
-k = apply(-1); break;
-} else {
-ref(expr) = nil;
+ref(expr) = 641;
 push();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = val(639);
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-toframe();
-ref(expr) = val(565);
-k = apply(-1); break;
-} else {
-newframe();
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-toframe();
-ref(expr) = val(565);
-k = apply(111); break;
-label(111);
-newframe();
-ref(expr) = 567;
-toframe();
-ref(expr) = val(565);
-k = apply(112); break;
-label(112);
-newframe();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = arith('/');
 toframe();
-ref(expr) = val(558);
-k = apply(-1); break;
-}
-}
+ref(expr) = val(637);
+k = apply(179); break;
+label(179);
 }
-unbind();
-k = retn(); break;
-label(108);
-ref(expr) = mkfun(109);
-val(558) = ref(expr);
-ref(expr) = cons3(565, val(565), 0);
-toframe();
-goto(113);
-label(114);
-bind(568);
-ref(expr) = nil;
+ref(expr) = 641;
 push();
-ref(expr) = val(135);
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('%');
+val(639) = ref(expr);
+ref(expr) = 642;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 644;
+} else {
+ref(expr) = 645;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 647;
+} else {
+ref(expr) = 648;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 650;
+} else {
+ref(expr) = 651;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 653;
+} else {
+ref(expr) = 654;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 656;
+} else {
+ref(expr) = 657;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 659;
+} else {
+ref(expr) = 660;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 662;
+} else {
+ref(expr) = 663;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 665;
+} else {
+ref(expr) = 666;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+ref(expr) = 668;
+} else {
+ref(expr) = 670;
+}
+}
+}
+}
+}
+}
+}
+}
+}
+writec(ref(expr));
+unbind();
+k = retn(); break;
+label(176);
+ref(expr) = mkfun(177);
+val(637) = ref(expr);
+pushval(677);
+goto(180);
+label(181);
+bind(678);
+label(182);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = 570;
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 681;
+toframe();
+ref(expr) = val(684);
+k = apply(183); break;
+label(183);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(684);
+k = apply(-1); break;
+} else {
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(684);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(684);
+k = apply(184); break;
+label(184);
+newframe();
+ref(expr) = 686;
+toframe();
+ref(expr) = val(684);
+k = apply(185); break;
+label(185);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(182);
+}
+}
+}
+unbind();
+k = retn(); break;
+label(180);
+ref(expr) = mkfun(181);
+val(677) = ref(expr);
+pushval(684);
+goto(186);
+label(187);
+bind(687);
+label(188);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 639;
 writec(ref(expr));
-ref(expr) = 572;
+ref(expr) = 689;
 writec(ref(expr));
-ref(expr) = 574;
+ref(expr) = 691;
 writec(ref(expr));
 } else {
+ref(expr) = val(135);
+ref(expr) = numeric()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(637);
+k = apply(-1); break;
+} else {
 ref(expr) = val(115);
 push();
 ref(expr) = val(135);
@@ -1536,19 +2106,19 @@ ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = 585;
+ref(expr) = 702;
 toframe();
-ref(expr) = val(550);
+ref(expr) = val(629);
 k = apply(-1); break;
 } else {
 ref(expr) = val(135);
 ref(expr) = (tag[ref(expr)] & atomtag)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = 587;
+ref(expr) = 704;
 writec(ref(expr));
 ref(expr) = val(135);
 writec(ref(expr));
-ref(expr) = 589;
+ref(expr) = 706;
 writec(ref(expr));
 } else {
 ref(expr) = val(135);
@@ -1557,7 +2127,7 @@ if (ref(expr) != nil) {
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(550);
+ref(expr) = val(629);
 k = apply(-1); break;
 } else {
 ref(expr) = val(121);
@@ -1565,58 +2135,62 @@ writec(ref(expr));
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(558);
-k = apply(115); break;
-label(115);
+ref(expr) = val(677);
+k = apply(189); break;
+label(189);
 ref(expr) = val(127);
 writec(ref(expr));
 }
 }
 }
 }
+}
 unbind();
 k = retn(); break;
-label(113);
-ref(expr) = mkfun(114);
-val(565) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(186);
+ref(expr) = mkfun(187);
+val(684) = ref(expr);
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(565);
-k = apply(116); break;
-label(116);
+ref(expr) = val(684);
+k = apply(190); break;
+label(190);
 ref(expr) = val(135);
-unbind();
-pop();
+popval(684);
+popval(677);
+popval(637);
+popval(629);
+popval(620);
 unbind();
 k = retn(); break;
-label(102);
-ref(expr) = mkfun(103);
-val(595) = ref(expr);
-goto(117);
-label(118);
-bind(596);
+label(167);
+ref(expr) = mkfun(168);
+val(712) = ref(expr);
+goto(191);
+label(192);
+bind(713);
+label(193);
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(595);
-k = apply(119); break;
-label(119);
+ref(expr) = val(712);
+k = apply(194); break;
+label(194);
 newframe();
-ref(expr) = val(536);
-k = apply(120); break;
-label(120);
+ref(expr) = val(615);
+k = apply(195); break;
+label(195);
 ref(expr) = val(135);
 unbind();
 k = retn(); break;
-label(117);
-ref(expr) = mkfun(118);
-val(602) = ref(expr);
-goto(121);
-label(122);
-bind(604);
+label(191);
+ref(expr) = mkfun(192);
+val(719) = ref(expr);
+goto(196);
+label(197);
+bind(721);
+label(198);
 ref(expr) = nil;
 push();
 ref(expr) = val(135);
@@ -1645,15 +2219,15 @@ ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
 ref(expr) = val(153);
 ref(expr) = cdr[ref(expr)];
-toframe();
+pusharg();
 ref(expr) = val(135);
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(614);
-k = apply(-1); break;
+pusharg();
+val(135) = poparg();
+val(153) = poparg();
+goto(198);
 } else {
 ref(expr) = nil;
 }
@@ -1661,47 +2235,42 @@ ref(expr) = nil;
 }
 unbind();
 k = retn(); break;
-label(121);
-ref(expr) = mkfun(122);
-val(614) = ref(expr);
-goto(123);
-label(124);
-bind(616);
-newframe();
-ref(expr) = cons3(570, val(570), 0);
-toframe();
-ref(expr) = val(333);
+label(196);
+ref(expr) = mkfun(197);
+val(731) = ref(expr);
+goto(199);
+label(200);
+bind(733);
+label(201);
+pushval(639);
+ref(expr) = val(412);
 push();
 ref(expr) = nil;
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
-val(570) = ref(expr);
-ref(expr) = nil;
-toframe();
-ref(expr) = val(570);
+val(639) = ref(expr);
+ref(expr) = val(639);
 tag[ref(expr)] |= atomtag;
-ref(expr) = val(521);
+ref(expr) = val(600);
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = val(570);
+ref(expr) = val(639);
 ref(expr2) = pop();
 car[ref(expr)] = ref(expr2);
-unbind();
-pop();
+popval(639);
 unbind();
 k = retn(); break;
-label(123);
-ref(expr) = mkfun(124);
-val(623) = ref(expr);
-goto(125);
-label(126);
-bind(624);
-newframe();
-ref(expr) = cons3(630, val(630), 0);
-toframe();
-goto(127);
-label(128);
-bind(631);
+label(199);
+ref(expr) = mkfun(200);
+val(740) = ref(expr);
+goto(202);
+label(203);
+bind(741);
+label(204);
+pushval(747);
+goto(205);
+label(206);
+bind(748);
 ref(expr) = nil;
 push();
 newframe();
@@ -1710,24 +2279,24 @@ toframe();
 ref(expr) = val(135);
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(623);
-k = apply(129); break;
-label(129);
+ref(expr) = val(740);
+k = apply(207); break;
+label(207);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 unbind();
 k = retn(); break;
-label(127);
-ref(expr) = mkfun(128);
-val(630) = ref(expr);
-ref(expr) = cons3(636, val(636), 0);
-toframe();
-goto(130);
-label(131);
-bind(641);
+label(205);
+ref(expr) = mkfun(206);
+val(747) = ref(expr);
+pushval(753);
+goto(208);
+label(209);
+bind(758);
+label(210);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
@@ -1735,119 +2304,111 @@ ref(expr) = nil;
 } else {
 newframe();
 newframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(639);
-k = apply(132); break;
-label(132);
+ref(expr) = val(756);
+k = apply(211); break;
+label(211);
 ref(expr) = car[ref(expr)];
 toframe();
 ref(expr) = val(135);
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(614);
-k = apply(133); break;
-label(133);
+ref(expr) = val(731);
+k = apply(212); break;
+label(212);
 if (ref(expr) != nil) {
-ref(expr) = val(333);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 } else {
-newframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(639);
-toframe();
+pusharg();
+ref(expr) = val(756);
+pusharg();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(636);
-k = apply(-1); break;
+pusharg();
+val(135) = poparg();
+val(756) = poparg();
+val(412) = poparg();
+goto(210);
 }
 }
 unbind();
 k = retn(); break;
-label(130);
-ref(expr) = mkfun(131);
-val(636) = ref(expr);
-ref(expr) = cons3(643, val(643), 0);
-toframe();
+label(208);
+ref(expr) = mkfun(209);
+val(753) = ref(expr);
+pushval(760);
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(630);
-k = apply(134); break;
-label(134);
-val(643) = ref(expr);
-ref(expr) = cons3(330, val(330), 0);
-toframe();
+ref(expr) = val(747);
+k = apply(213); break;
+label(213);
+val(760) = ref(expr);
+pushval(409);
 newframe();
 ref(expr) = val(107);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(177);
-toframe();
-ref(expr) = val(643);
+ref(expr) = val(256);
 toframe();
-ref(expr) = val(636);
-k = apply(135); break;
-label(135);
-val(330) = ref(expr);
-ref(expr) = nil;
+ref(expr) = val(760);
 toframe();
-ref(expr) = val(330);
+ref(expr) = val(753);
+k = apply(214); break;
+label(214);
+val(409) = ref(expr);
+ref(expr) = val(409);
 if (ref(expr) != nil) {
+pushval(762);
 newframe();
-ref(expr) = cons3(645, val(645), 0);
-toframe();
-newframe();
-ref(expr) = val(330);
-if (symbolic()) cdr_err();
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
 toframe();
 ref(expr) = val(146);
 toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(636);
-k = apply(136); break;
-label(136);
-val(645) = ref(expr);
-ref(expr) = nil;
-toframe();
-ref(expr) = val(645);
+ref(expr) = val(753);
+k = apply(215); break;
+label(215);
+val(762) = ref(expr);
+ref(expr) = val(762);
 if (ref(expr) != nil) {
 } else {
-ref(expr) = val(330);
-if (symbolic()) cdr_err();
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
 push();
 ref(expr) = val(135);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 push();
-ref(expr) = val(330);
+ref(expr) = val(409);
 ref(expr2) = pop();
 cdr[ref(expr)] = ref(expr2);
 ref(expr) = val(135);
 }
-unbind();
-pop();
+popval(762);
 } else {
 ref(expr) = val(107);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(256);
-k = apply(137); break;
-label(137);
+ref(expr) = val(335);
+k = apply(216); break;
+label(216);
 push();
-ref(expr) = val(643);
+ref(expr) = val(760);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 ref(expr2) = pop();
@@ -1858,26 +2419,25 @@ ref(expr2) = pop();
 car[ref(expr)] = ref(expr2);
 ref(expr) = val(135);
 }
-unbind();
-pop();
+popval(409);
+popval(760);
+popval(753);
+popval(747);
 unbind();
 k = retn(); break;
-label(125);
-ref(expr) = mkfun(126);
-val(652) = ref(expr);
-ref(expr) = nil;
-val(660) = ref(expr);
-goto(138);
-label(139);
+label(202);
+ref(expr) = mkfun(203);
+val(769) = ref(expr);
+goto(217);
+label(218);
 bind(0);
-ref(expr) = val(660);
-if (ref(expr) != nil) {
-} else {
-ref(expr) = readc();
-val(660) = ref(expr);
+label(219);
+pushval(600);
+ref(expr) = peekc();
+val(600) = ref(expr);
 ref(expr) = nil;
 push();
-ref(expr) = val(660);
+ref(expr) = val(600);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
@@ -1886,50 +2446,30 @@ ref(expr) = nil;
 newframe();
 ref(expr) = nil;
 push();
-ref(expr) = val(660);
+ref(expr) = val(600);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 toframe();
-ref(expr) = val(652);
-k = apply(140); break;
-label(140);
-val(660) = ref(expr);
-ref(expr) = val(660);
-}
+ref(expr) = val(769);
+k = apply(220); break;
+label(220);
 }
+popval(600);
 unbind();
 k = retn(); break;
-label(138);
-ref(expr) = mkfun(139);
-val(666) = ref(expr);
-goto(141);
-label(142);
+label(217);
+ref(expr) = mkfun(218);
+val(775) = ref(expr);
+goto(221);
+label(222);
 bind(0);
-ref(expr) = val(660);
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = cons3(521, val(521), 0);
-toframe();
-ref(expr) = val(660);
-val(521) = ref(expr);
-ref(expr) = nil;
-toframe();
-ref(expr) = nil;
-val(660) = ref(expr);
-ref(expr) = val(521);
-unbind();
-pop();
-} else {
-newframe();
-ref(expr) = cons3(521, val(521), 0);
-toframe();
-ref(expr) = readc();
-val(521) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(223);
+pushval(600);
+ref(expr) = readc();
+val(600) = ref(expr);
 ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(600);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
@@ -1938,117 +2478,113 @@ ref(expr) = nil;
 newframe();
 ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(600);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 toframe();
-ref(expr) = val(652);
-k = apply(143); break;
-label(143);
-}
-unbind();
-pop();
+ref(expr) = val(769);
+k = apply(224); break;
+label(224);
 }
+popval(600);
 unbind();
 k = retn(); break;
-label(141);
-ref(expr) = mkfun(142);
-val(672) = ref(expr);
-goto(144);
-label(145);
-bind(673);
-newframe();
-ref(expr) = cons3(678, val(678), 0);
-toframe();
-goto(146);
-label(147);
-bind(680);
+label(221);
+ref(expr) = mkfun(222);
+val(781) = ref(expr);
+goto(225);
+label(226);
+bind(782);
+label(227);
+pushval(787);
+goto(228);
+label(229);
+bind(789);
+label(230);
 ref(expr) = nil;
 push();
-ref(expr) = val(570);
+ref(expr) = val(639);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 } else {
 newframe();
-newframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(570);
-if (symbolic()) car_err();
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(623);
-k = apply(148); break;
-label(148);
-toframe();
-ref(expr) = val(570);
-if (symbolic()) cdr_err();
+ref(expr) = val(740);
+k = apply(231); break;
+label(231);
+pusharg();
+ref(expr) = val(639);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(678);
-k = apply(-1); break;
+pusharg();
+val(639) = poparg();
+val(412) = poparg();
+goto(230);
 }
 unbind();
 k = retn(); break;
-label(146);
-ref(expr) = mkfun(147);
-val(678) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(228);
+ref(expr) = mkfun(229);
+val(787) = ref(expr);
 newframe();
 ref(expr) = nil;
 toframe();
 newframe();
-ref(expr) = val(570);
+ref(expr) = val(639);
 toframe();
-ref(expr) = val(350);
-k = apply(149); break;
-label(149);
+ref(expr) = val(429);
+k = apply(232); break;
+label(232);
 toframe();
-ref(expr) = val(678);
-k = apply(150); break;
-label(150);
-unbind();
-pop();
+ref(expr) = val(787);
+k = apply(233); break;
+label(233);
+popval(787);
 unbind();
 k = retn(); break;
-label(144);
-ref(expr) = mkfun(145);
-val(688) = ref(expr);
-goto(151);
-label(152);
-bind(689);
+label(225);
+ref(expr) = mkfun(226);
+val(797) = ref(expr);
+goto(234);
+label(235);
+bind(798);
+label(236);
 newframe();
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(688);
-k = apply(153); break;
-label(153);
+ref(expr) = val(797);
+k = apply(237); break;
+label(237);
 toframe();
-ref(expr) = val(652);
+ref(expr) = val(769);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(151);
-ref(expr) = mkfun(152);
-val(697) = ref(expr);
-goto(154);
-label(155);
-bind(698);
-newframe();
-ref(expr) = cons3(705, val(705), 0);
-toframe();
-goto(156);
-label(157);
-bind(706);
+label(234);
+ref(expr) = mkfun(235);
+val(806) = ref(expr);
+goto(238);
+label(239);
+bind(807);
+label(240);
+pushval(814);
+goto(241);
+label(242);
+bind(815);
+label(243);
 newframe();
 ref(expr) = nil;
 push();
@@ -2057,2791 +2593,5572 @@ ref(expr) = nil;
 toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(623);
-k = apply(158); break;
-label(158);
+ref(expr) = val(740);
+k = apply(244); break;
+label(244);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
 toframe();
-ref(expr) = val(652);
+ref(expr) = val(769);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(156);
-ref(expr) = mkfun(157);
-val(705) = ref(expr);
-ref(expr) = cons3(711, val(711), 0);
-toframe();
-goto(159);
-label(160);
-bind(713);
+label(241);
+ref(expr) = mkfun(242);
+val(814) = ref(expr);
+pushval(820);
+goto(245);
+label(246);
+bind(822);
+label(247);
 ref(expr) = nil;
 push();
-ref(expr) = val(570);
+ref(expr) = val(639);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(401);
+ref(expr) = val(480);
 k = apply(-1); break;
 } else {
-newframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 push();
 newframe();
-ref(expr) = val(570);
+ref(expr) = val(639);
 toframe();
-ref(expr) = val(705);
-k = apply(161); break;
-label(161);
+ref(expr) = val(814);
+k = apply(248); break;
+label(248);
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
-toframe();
-ref(expr) = val(570);
+pusharg();
+ref(expr) = val(639);
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(711);
-k = apply(-1); break;
+pusharg();
+val(639) = poparg();
+val(412) = poparg();
+goto(247);
 }
 unbind();
 k = retn(); break;
-label(159);
-ref(expr) = mkfun(160);
-val(711) = ref(expr);
-ref(expr) = nil;
-toframe();
-ref(expr) = val(570);
+label(245);
+ref(expr) = mkfun(246);
+val(820) = ref(expr);
+ref(expr) = val(639);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(570);
+ref(expr) = val(639);
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(711);
-k = apply(162); break;
-label(162);
+ref(expr) = val(820);
+k = apply(249); break;
+label(249);
 } else {
 newframe();
-ref(expr) = 736;
+ref(expr) = 845;
 toframe();
 ref(expr) = val(171);
-k = apply(163); break;
-label(163);
+k = apply(250); break;
+label(250);
 }
-unbind();
-pop();
+popval(820);
+popval(814);
 unbind();
 k = retn(); break;
-label(154);
-ref(expr) = mkfun(155);
-val(744) = ref(expr);
-ref(expr) = 832;
-val(841) = ref(expr);
-goto(164);
-label(165);
-bind(842);
+label(238);
+ref(expr) = mkfun(239);
+val(853) = ref(expr);
+ref(expr) = 863;
+val(871) = ref(expr);
+ref(expr) = 939;
+val(948) = ref(expr);
+goto(251);
+label(252);
+bind(949);
+label(253);
 newframe();
-ref(expr) = val(841);
+ref(expr) = val(948);
 toframe();
-ref(expr) = val(521);
+ref(expr) = val(600);
 toframe();
-ref(expr) = val(442);
+ref(expr) = val(521);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(164);
-ref(expr) = mkfun(165);
-val(851) = ref(expr);
-goto(166);
-label(167);
+label(251);
+ref(expr) = mkfun(252);
+val(958) = ref(expr);
+goto(254);
+label(255);
 bind(0);
-newframe();
-ref(expr) = cons3(857, val(857), 0);
-toframe();
-goto(168);
-label(169);
-bind(858);
-ref(expr) = val(521);
-push();
-ref(expr) = 567;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(672);
-k = apply(170); break;
-label(170);
+label(256);
+ref(expr) = rdobj();
+unbind();
+k = retn(); break;
+label(254);
+ref(expr) = mkfun(255);
+val(963) = ref(expr);
+ref(expr) = 964;
+val(973) = ref(expr);
+ref(expr) = 642;
+val(980) = ref(expr);
+ref(expr) = 981;
+val(986) = ref(expr);
+ref(expr) = nil;
+val(992) = ref(expr);
 newframe();
 newframe();
-ref(expr) = val(666);
-k = apply(171); break;
-label(171);
-toframe();
-ref(expr) = val(857);
-k = apply(-1); break;
-} else {
-ref(expr) = val(133);
+ref(expr) = val(980);
 push();
-ref(expr) = val(521);
+ref(expr) = true;
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(672);
-k = apply(172); break;
-label(172);
-newframe();
-newframe();
-ref(expr) = val(666);
-k = apply(173); break;
-label(173);
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
 toframe();
-ref(expr) = val(857);
-k = apply(-1); break;
-} else {
-ref(expr) = val(521);
-}
-}
-unbind();
-k = retn(); break;
-label(168);
-ref(expr) = mkfun(169);
-val(857) = ref(expr);
-ref(expr) = cons3(866, val(866), 0);
+ref(expr) = true;
 toframe();
-goto(174);
-label(175);
-bind(867);
-ref(expr) = val(133);
+ref(expr) = val(335);
+k = apply(257); break;
+label(257);
+toframe();
+ref(expr) = val(335);
+k = apply(258); break;
+label(258);
+val(999) = ref(expr);
+ref(expr) = nil;
+val(1006) = ref(expr);
+ref(expr) = nil;
+val(1013) = ref(expr);
+ref(expr) = 964;
+val(1017) = ref(expr);
+ref(expr) = nil;
+val(1025) = ref(expr);
+ref(expr) = nil;
+val(1029) = ref(expr);
+ref(expr) = nil;
+val(1035) = ref(expr);
+ref(expr) = nil;
+val(1042) = ref(expr);
+goto(259);
+label(260);
+bind(0);
+label(261);
+ref(expr) = 642;
 push();
-ref(expr) = val(521);
+ref(expr) = val(1017);
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-} else {
-newframe();
-newframe();
-ref(expr) = val(672);
-k = apply(176); break;
-label(176);
-toframe();
-ref(expr) = val(866);
-k = apply(-1); break;
-}
+ref(expr) = arith('+');
+val(1017) = ref(expr);
+ref(expr) = val(1017);
 unbind();
 k = retn(); break;
-label(174);
-ref(expr) = mkfun(175);
-val(866) = ref(expr);
-ref(expr) = cons3(875, val(875), 0);
-toframe();
-goto(177);
-label(178);
-bind(877);
-newframe();
-ref(expr) = val(521);
-toframe();
-ref(expr) = val(851);
-k = apply(179); break;
-label(179);
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(672);
-k = apply(180); break;
-label(180);
-newframe();
-ref(expr) = val(333);
+label(259);
+ref(expr) = mkfun(260);
+val(1053) = ref(expr);
+goto(262);
+label(263);
+bind(1059);
+label(264);
+ref(expr) = 642;
 push();
-ref(expr) = val(521);
+ref(expr) = val(986);
 ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
-toframe();
-newframe();
-ref(expr) = val(666);
-k = apply(181); break;
-label(181);
-toframe();
-ref(expr) = val(875);
-k = apply(-1); break;
-} else {
+ref(expr) = arith('+');
+val(986) = ref(expr);
+ref(expr) = val(992);
+push();
 newframe();
-ref(expr) = 880;
+ref(expr) = val(935);
 toframe();
-ref(expr) = val(333);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(433);
-k = apply(182); break;
-label(182);
-if (ref(expr) != nil) {
-ref(expr) = nil;
-} else {
-newframe();
-newframe();
-ref(expr) = val(333);
+ref(expr) = val(1056);
 toframe();
-ref(expr) = val(401);
-k = apply(183); break;
-label(183);
+ref(expr) = val(986);
 toframe();
-ref(expr) = val(697);
-k = apply(-1); break;
-}
-}
+ref(expr) = val(335);
+k = apply(265); break;
+label(265);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(992) = ref(expr);
+ref(expr) = val(986);
 unbind();
 k = retn(); break;
-label(177);
-ref(expr) = mkfun(178);
-val(875) = ref(expr);
-ref(expr) = cons3(888, val(888), 0);
-toframe();
-goto(184);
-label(185);
-bind(890);
+label(262);
+ref(expr) = mkfun(263);
+val(1069) = ref(expr);
+goto(266);
+label(267);
+bind(1070);
+label(268);
+pushval(496);
+goto(269);
+label(270);
+bind(1072);
+label(271);
 ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(135);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = 910;
+ref(expr) = nil;
 toframe();
-ref(expr) = val(171);
+ref(expr) = val(973);
+toframe();
+ref(expr) = val(909);
+toframe();
+ref(expr) = val(1069);
 k = apply(-1); break;
 } else {
-ref(expr) = 912;
-push();
-ref(expr) = val(521);
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(672);
-k = apply(186); break;
-label(186);
-newframe();
 newframe();
-newframe();
-ref(expr) = val(333);
-toframe();
-ref(expr) = val(401);
-k = apply(187); break;
-label(187);
+ref(expr) = true;
 toframe();
-ref(expr) = val(697);
-k = apply(188); break;
-label(188);
+ref(expr) = val(909);
 toframe();
-ref(expr) = 918;
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(256);
+ref(expr) = val(1069);
+k = apply(272); break;
+label(272);
+pusharg();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+val(909) = poparg();
+goto(271);
+}
+unbind();
+k = retn(); break;
+label(269);
+ref(expr) = mkfun(270);
+val(496) = ref(expr);
+newframe();
+ref(expr) = val(973);
+toframe();
+newframe();
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(853);
+k = apply(273); break;
+label(273);
+toframe();
+ref(expr) = val(480);
+k = apply(274); break;
+label(274);
+toframe();
+ref(expr) = val(496);
+k = apply(275); break;
+label(275);
+popval(496);
+unbind();
+k = retn(); break;
+label(266);
+ref(expr) = mkfun(267);
+val(1082) = ref(expr);
+goto(276);
+label(277);
+bind(1083);
+newframe();
+ref(expr) = nil;
+push();
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(740);
+k = apply(278); break;
+label(278);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+toframe();
+ref(expr) = val(769);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(276);
+ref(expr) = mkfun(277);
+val(747) = ref(expr);
+goto(279);
+label(280);
+bind(1084);
+label(281);
+pushval(760);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(747);
+k = apply(282); break;
+label(282);
+val(760) = ref(expr);
+pushval(409);
+newframe();
+ref(expr) = val(999);
+toframe();
+ref(expr) = val(760);
+toframe();
+ref(expr) = val(529);
+k = apply(283); break;
+label(283);
+val(409) = ref(expr);
+ref(expr) = val(409);
+if (ref(expr) != nil) {
+pushval(762);
+newframe();
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(529);
+k = apply(284); break;
+label(284);
+val(762) = ref(expr);
+ref(expr) = val(762);
+if (ref(expr) != nil) {
+ref(expr) = val(762);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+} else {
+pushval(412);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1082);
+k = apply(285); break;
+label(285);
+val(412) = ref(expr);
+newframe();
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+push();
+ref(expr) = val(412);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+toframe();
+ref(expr) = val(409);
+toframe();
+ref(expr) = val(407);
+k = apply(286); break;
+label(286);
+ref(expr) = val(412);
+popval(412);
+}
+popval(762);
+} else {
+pushval(412);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1082);
+k = apply(287); break;
+label(287);
+val(412) = ref(expr);
+ref(expr) = val(999);
+push();
+newframe();
+ref(expr) = val(412);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+toframe();
+ref(expr) = val(335);
+k = apply(288); break;
+label(288);
+push();
+ref(expr) = val(760);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(999) = ref(expr);
+ref(expr) = val(412);
+popval(412);
+}
+popval(409);
+popval(760);
+unbind();
+k = retn(); break;
+label(279);
+ref(expr) = mkfun(280);
+val(1093) = ref(expr);
+goto(289);
+label(290);
+bind(1094);
+label(291);
+pushval(600);
+ref(expr) = val(135);
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+val(600) = ref(expr);
+ref(expr) = 644;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 647;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 650;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 653;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 656;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 659;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 662;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 665;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 668;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = 670;
+ref(expr) = car[ref(expr)];
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+popval(600);
+unbind();
+k = retn(); break;
+label(289);
+ref(expr) = mkfun(290);
+val(1101) = ref(expr);
+goto(292);
+label(293);
+bind(1102);
+label(294);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1101);
+k = apply(295); break;
+label(295);
+if (ref(expr) != nil) {
+pushval(496);
+goto(296);
+label(297);
+bind(1103);
+label(298);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = val(871);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(521);
+k = apply(299); break;
+label(299);
+if (ref(expr) != nil) {
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(298);
+} else {
+ref(expr) = nil;
+}
+}
+unbind();
+k = retn(); break;
+label(296);
+ref(expr) = mkfun(297);
+val(496) = ref(expr);
+newframe();
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(853);
+k = apply(300); break;
+label(300);
+toframe();
+ref(expr) = val(496);
+k = apply(301); break;
+label(301);
+popval(496);
+} else {
+ref(expr) = nil;
+}
+unbind();
+k = retn(); break;
+label(292);
+ref(expr) = mkfun(293);
+val(1112) = ref(expr);
+goto(302);
+label(303);
+bind(1113);
+label(304);
+pushval(762);
+newframe();
+ref(expr) = val(1006);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(529);
+k = apply(305); break;
+label(305);
+val(762) = ref(expr);
+ref(expr) = val(762);
+if (ref(expr) != nil) {
+ref(expr) = val(762);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+} else {
+ref(expr) = val(1013);
+push();
+newframe();
+ref(expr) = 1117;
+toframe();
+ref(expr) = val(973);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1069);
+k = apply(306); break;
+label(306);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1013) = ref(expr);
+ref(expr) = val(1006);
+push();
+ref(expr) = val(1013);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1006) = ref(expr);
+ref(expr) = val(1013);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+}
+popval(762);
+unbind();
+k = retn(); break;
+label(302);
+ref(expr) = mkfun(303);
+val(1128) = ref(expr);
+goto(307);
+label(308);
+bind(1129);
+label(309);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(973);
+} else {
+ref(expr) = true;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(980);
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1093);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = nil;
+toframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1141);
+k = apply(310); break;
+label(310);
+toframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1141);
+k = apply(311); break;
+label(311);
+toframe();
+ref(expr) = val(1069);
+k = apply(-1); break;
+}
+}
+}
+unbind();
+k = retn(); break;
+label(307);
+ref(expr) = mkfun(308);
+val(1141) = ref(expr);
+goto(312);
+label(313);
+bind(1142);
+label(314);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(973);
+} else {
+ref(expr) = true;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(980);
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1093);
+k = apply(-1); break;
+} else {
+ref(expr) = val(1013);
+push();
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1141);
+k = apply(315); break;
+label(315);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1013) = ref(expr);
+ref(expr) = val(1013);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+}
+}
+}
+unbind();
+k = retn(); break;
+label(312);
+ref(expr) = mkfun(313);
+val(1153) = ref(expr);
+goto(316);
+label(317);
+bind(1154);
+label(318);
+pushval(496);
+goto(319);
+label(320);
+bind(1155);
+label(321);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(615);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(712);
+k = apply(322); break;
+label(322);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(321);
+}
+unbind();
+k = retn(); break;
+label(319);
+ref(expr) = mkfun(320);
+val(496) = ref(expr);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(496);
+k = apply(323); break;
+label(323);
+popval(496);
+unbind();
+k = retn(); break;
+label(316);
+ref(expr) = mkfun(317);
+val(1165) = ref(expr);
+goto(324);
+label(325);
+bind(135);
+label(326);
+ref(expr) = val(1025);
+if (ref(expr) != nil) {
+ref(expr) = val(1029);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1029) = ref(expr);
+} else {
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1165);
+k = apply(-1); break;
+}
+unbind();
+k = retn(); break;
+label(324);
+ref(expr) = mkfun(325);
+val(1170) = ref(expr);
+goto(327);
+label(328);
+bind(0);
+label(329);
+pushval(496);
+goto(330);
+label(331);
+bind(1171);
+label(332);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1165);
+k = apply(333); break;
+label(333);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(332);
+}
+unbind();
+k = retn(); break;
+label(330);
+ref(expr) = mkfun(331);
+val(496) = ref(expr);
+newframe();
+newframe();
+ref(expr) = val(1029);
+toframe();
+ref(expr) = val(480);
+k = apply(334); break;
+label(334);
+toframe();
+ref(expr) = val(496);
+k = apply(335); break;
+label(335);
+popval(496);
+ref(expr) = nil;
+val(1029) = ref(expr);
+unbind();
+k = retn(); break;
+label(327);
+ref(expr) = mkfun(328);
+val(1177) = ref(expr);
+goto(336);
+label(337);
+bind(1178);
+label(338);
+pushval(496);
+goto(339);
+label(340);
+bind(1180);
+label(341);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(639);
+} else {
+ref(expr) = 642;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('+');
+pusharg();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+val(639) = poparg();
+goto(341);
+}
+unbind();
+k = retn(); break;
+label(339);
+ref(expr) = mkfun(340);
+val(496) = ref(expr);
+newframe();
+ref(expr) = 964;
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(496);
+k = apply(342); break;
+label(342);
+popval(496);
+unbind();
+k = retn(); break;
+label(336);
+ref(expr) = mkfun(337);
+val(1187) = ref(expr);
+goto(343);
+label(344);
+bind(1188);
+label(345);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 1194;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 1201;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+unbind();
+k = retn(); break;
+label(343);
+ref(expr) = mkfun(344);
+val(1207) = ref(expr);
+goto(346);
+label(347);
+bind(1208);
+label(348);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 1211;
+} else {
+ref(expr) = true;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1112);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 1194;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 1211;
+} else {
+ref(expr) = true;
+}
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 1201;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(346);
+ref(expr) = mkfun(347);
+val(1220) = ref(expr);
+goto(349);
+label(350);
+bind(1225);
+label(351);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1207);
+k = apply(352); break;
+label(352);
+if (ref(expr) != nil) {
+ref(expr) = val(1223);
+pusharg();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+val(1223) = poparg();
+goto(351);
+} else {
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(353); break;
+label(353);
+ref(expr) = val(1223);
+pusharg();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+val(1223) = poparg();
+goto(351);
+}
+}
+}
+unbind();
+k = retn(); break;
+label(349);
+ref(expr) = mkfun(350);
+val(1242) = ref(expr);
+goto(354);
+label(355);
+bind(1244);
+label(356);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1261;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1220);
+k = apply(357); break;
+label(357);
+push();
+ref(expr) = 1211;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(1223);
+pusharg();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+val(1223) = poparg();
+goto(356);
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1220);
+k = apply(358); break;
+label(358);
+if (ref(expr) != nil) {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+push();
+ref(expr) = nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1242);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1242);
+k = apply(-1); break;
+}
+} else {
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(359); break;
+label(359);
+newframe();
+ref(expr) = 1285;
+toframe();
+ref(expr) = val(1170);
+k = apply(360); break;
+label(360);
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1242);
+k = apply(361); break;
+label(361);
+newframe();
+ref(expr) = 1294;
+toframe();
+ref(expr) = val(1170);
+k = apply(362); break;
+label(362);
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1302);
+k = apply(363); break;
+label(363);
+newframe();
+ref(expr) = 1304;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+}
+}
+}
+unbind();
+k = retn(); break;
+label(354);
+ref(expr) = mkfun(355);
+val(1302) = ref(expr);
+goto(364);
+label(365);
+bind(1305);
+label(366);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = true;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+unbind();
+k = retn(); break;
+label(364);
+ref(expr) = mkfun(365);
+val(1313) = ref(expr);
+goto(367);
+label(368);
+bind(1314);
+label(369);
+ref(expr) = nil;
+push();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1313);
+k = apply(370); break;
+label(370);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1338;
+toframe();
+ref(expr) = val(171);
+k = apply(371); break;
+label(371);
+} else {
+ref(expr) = nil;
+}
+pushval(918);
+newframe();
+ref(expr) = val(1035);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(529);
+k = apply(372); break;
+label(372);
+val(918) = ref(expr);
+ref(expr) = val(918);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(918);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1348);
+k = apply(373); break;
+label(373);
+toframe();
+ref(expr) = 1367;
+toframe();
+ref(expr) = val(1170);
+k = apply(374); break;
+label(374);
+} else {
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1375);
+k = apply(375); break;
+label(375);
+if (ref(expr) != nil) {
+newframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1384);
+k = apply(376); break;
+label(376);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1391);
+k = apply(377); break;
+label(377);
+} else {
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(378); break;
+label(378);
+}
+}
+popval(918);
+newframe();
+ref(expr) = 1406;
+toframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1093);
+k = apply(379); break;
+label(379);
+toframe();
+ref(expr) = 1411;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(367);
+ref(expr) = mkfun(368);
+val(1419) = ref(expr);
+goto(380);
+label(381);
+bind(0);
+label(382);
+ref(expr) = nil;
+push();
+ref(expr) = val(1042);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1431;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(1042);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1447;
+toframe();
+ref(expr) = val(1170);
+k = apply(383); break;
+label(383);
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(1042);
+toframe();
+ref(expr) = val(1093);
+k = apply(384); break;
+label(384);
+toframe();
+ref(expr) = 1459;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(1042);
+toframe();
+ref(expr) = val(1187);
+k = apply(385); break;
+label(385);
+toframe();
+ref(expr) = 1468;
+toframe();
+ref(expr) = val(1170);
+k = apply(386); break;
+label(386);
+pushval(496);
+goto(387);
+label(388);
+bind(1470);
+label(389);
+ref(expr) = nil;
+push();
+ref(expr) = val(909);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1093);
+k = apply(390); break;
+label(390);
+toframe();
+ref(expr) = 1473;
+toframe();
+ref(expr) = val(689);
+toframe();
+ref(expr) = 1482;
+toframe();
+ref(expr) = val(1170);
+k = apply(391); break;
+label(391);
+ref(expr) = 642;
+push();
+ref(expr) = val(689);
+ref(expr2) = pop();
+ref(expr) = arith('+');
+pusharg();
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+val(689) = poparg();
+goto(389);
+}
+unbind();
+k = retn(); break;
+label(387);
+ref(expr) = mkfun(388);
+val(496) = ref(expr);
+newframe();
+ref(expr) = 964;
+toframe();
+ref(expr) = val(1042);
+toframe();
+ref(expr) = val(496);
+k = apply(392); break;
+label(392);
+popval(496);
+}
+}
+unbind();
+k = retn(); break;
+label(380);
+ref(expr) = mkfun(381);
+val(1490) = ref(expr);
+goto(393);
+label(394);
+bind(0);
+label(395);
+ref(expr) = nil;
+push();
+ref(expr) = val(1042);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(1042);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(1042);
+toframe();
+ref(expr) = val(1093);
+k = apply(396); break;
+label(396);
+toframe();
+ref(expr) = 1504;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+pushval(496);
+goto(397);
+label(398);
+bind(1506);
+label(399);
+ref(expr) = nil;
+push();
+ref(expr) = val(909);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = 642;
+push();
+ref(expr) = val(689);
+ref(expr2) = pop();
+ref(expr) = arith('+');
+toframe();
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(496);
+k = apply(400); break;
+label(400);
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1093);
+k = apply(401); break;
+label(401);
+toframe();
+ref(expr) = 1473;
+toframe();
+ref(expr) = val(689);
+toframe();
+ref(expr) = 1517;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+}
+unbind();
+k = retn(); break;
+label(397);
+ref(expr) = mkfun(398);
+val(496) = ref(expr);
+newframe();
+ref(expr) = 964;
+toframe();
+ref(expr) = val(1042);
+toframe();
+ref(expr) = val(496);
+k = apply(402); break;
+label(402);
+popval(496);
+}
+}
+unbind();
+k = retn(); break;
+label(393);
+ref(expr) = mkfun(394);
+val(1527) = ref(expr);
+goto(403);
+label(404);
+bind(1539);
+label(405);
+pushval(1029);
+ref(expr) = nil;
+val(1029) = ref(expr);
+pushval(1042);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(1042) = ref(expr);
+pushval(1544);
+ref(expr) = val(1532);
+val(1544) = ref(expr);
+pushval(1552);
+ref(expr) = nil;
+val(1552) = ref(expr);
+newframe();
+ref(expr) = 1571;
+toframe();
+ref(expr) = val(1537);
+toframe();
+ref(expr) = 1578;
+toframe();
+ref(expr) = val(1170);
+k = apply(406); break;
+label(406);
+newframe();
+ref(expr) = val(1490);
+k = apply(407); break;
+label(407);
+pushval(1583);
+ref(expr) = val(1029);
+val(1583) = ref(expr);
+ref(expr) = nil;
+val(1029) = ref(expr);
+newframe();
+ref(expr) = true;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1242);
+k = apply(408); break;
+label(408);
+newframe();
+ref(expr) = val(1552);
+if (ref(expr) != nil) {
+ref(expr) = val(1583);
+push();
+newframe();
+ref(expr) = 1589;
+toframe();
+ref(expr) = val(335);
+k = apply(409); break;
+label(409);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+} else {
+ref(expr) = val(1583);
+}
+toframe();
+ref(expr) = val(1029);
+toframe();
+ref(expr) = val(504);
+k = apply(410); break;
+label(410);
+val(1029) = ref(expr);
+popval(1583);
+newframe();
+ref(expr) = val(1527);
+k = apply(411); break;
+label(411);
+newframe();
+ref(expr) = 1598;
+toframe();
+ref(expr) = val(1170);
+k = apply(412); break;
+label(412);
+newframe();
+ref(expr) = 1304;
+toframe();
+ref(expr) = val(1170);
+k = apply(413); break;
+label(413);
+newframe();
+ref(expr) = val(1177);
+k = apply(414); break;
+label(414);
+popval(1552);
+popval(1544);
+popval(1042);
+popval(1029);
+ref(expr) = val(1537);
+unbind();
+k = retn(); break;
+label(403);
+ref(expr) = mkfun(404);
+val(1348) = ref(expr);
+goto(415);
+label(416);
+bind(1600);
+label(417);
+ref(expr) = val(1025);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(1532);
+toframe();
+newframe();
+ref(expr) = val(1053);
+k = apply(418); break;
+label(418);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1348);
+k = apply(419); break;
+label(419);
+toframe();
+ref(expr) = 1367;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(1532);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1610);
+k = apply(-1); break;
+}
+unbind();
+k = retn(); break;
+label(415);
+ref(expr) = mkfun(416);
+val(1391) = ref(expr);
+goto(420);
+label(421);
+bind(1612);
+label(422);
+pushval(1617);
+newframe();
+ref(expr) = val(1053);
+k = apply(423); break;
+label(423);
+val(1617) = ref(expr);
+pushval(1537);
+newframe();
+ref(expr) = val(1053);
+k = apply(424); break;
+label(424);
+val(1537) = ref(expr);
+pushval(1042);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(1042) = ref(expr);
+pushval(1544);
+ref(expr) = val(1532);
+val(1544) = ref(expr);
+pushval(1625);
+ref(expr) = val(1532);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(1053);
+k = apply(425); break;
+label(425);
+} else {
+ref(expr) = nil;
+}
+val(1625) = ref(expr);
+newframe();
+ref(expr) = 1341;
+toframe();
+ref(expr) = val(1617);
+toframe();
+ref(expr) = 1631;
+toframe();
+ref(expr) = val(1170);
+k = apply(426); break;
+label(426);
+newframe();
+ref(expr) = 1341;
+toframe();
+ref(expr) = val(1537);
+toframe();
+ref(expr) = 1638;
+toframe();
+ref(expr) = val(1170);
+k = apply(427); break;
+label(427);
+newframe();
+ref(expr) = 1341;
+toframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1153);
+k = apply(428); break;
+label(428);
+toframe();
+ref(expr) = 1644;
+toframe();
+ref(expr) = val(1170);
+k = apply(429); break;
+label(429);
+ref(expr) = val(1544);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1341;
+toframe();
+ref(expr) = val(1625);
+toframe();
+ref(expr) = 1638;
+toframe();
+ref(expr) = val(1170);
+k = apply(430); break;
+label(430);
+} else {
+ref(expr) = nil;
+}
+newframe();
+ref(expr) = true;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1242);
+k = apply(431); break;
+label(431);
+newframe();
+ref(expr) = 1654;
+toframe();
+ref(expr) = val(1170);
+k = apply(432); break;
+label(432);
+newframe();
+ref(expr) = 1673;
+toframe();
+ref(expr) = val(1170);
+k = apply(433); break;
+label(433);
+newframe();
+ref(expr) = 1341;
+toframe();
+ref(expr) = val(1617);
+toframe();
+ref(expr) = 1638;
+toframe();
+ref(expr) = val(1170);
+k = apply(434); break;
+label(434);
+newframe();
+ref(expr) = 1341;
+toframe();
+ref(expr) = val(1537);
+toframe();
+ref(expr) = 1367;
+toframe();
+ref(expr) = val(1170);
+k = apply(435); break;
+label(435);
+popval(1625);
+popval(1544);
+popval(1042);
+popval(1537);
+popval(1617);
+unbind();
+k = retn(); break;
+label(420);
+ref(expr) = mkfun(421);
+val(1610) = ref(expr);
+goto(436);
+label(437);
+bind(1675);
+label(438);
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1685);
+k = apply(439); break;
+label(439);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1693);
+k = apply(-1); break;
+} else {
+ref(expr) = val(1025);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1702);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = val(1223);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1712);
 k = apply(-1); break;
+}
+}
+unbind();
+k = retn(); break;
+label(436);
+ref(expr) = mkfun(437);
+val(1719) = ref(expr);
+ref(expr) = nil;
+val(1544) = ref(expr);
+ref(expr) = nil;
+val(1625) = ref(expr);
+ref(expr) = nil;
+val(1552) = ref(expr);
+goto(440);
+label(441);
+bind(1720);
+label(442);
+newframe();
+ref(expr) = val(1727);
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(521);
+k = apply(443); break;
+label(443);
+if (ref(expr) != nil) {
+ref(expr) = val(135);
 } else {
-ref(expr) = 920;
+ref(expr) = nil;
+}
+unbind();
+k = retn(); break;
+label(440);
+ref(expr) = mkfun(441);
+val(1384) = ref(expr);
+goto(444);
+label(445);
+bind(1729);
+label(446);
+ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(1223);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(672);
-k = apply(189); break;
-label(189);
-newframe();
-ref(expr) = val(672);
-k = apply(190); break;
-label(190);
-val(521) = ref(expr);
-newframe();
-ref(expr) = val(333);
+ref(expr) = nil;
+} else {
+ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(1544);
 ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(1544);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = nil;
+push();
+ref(expr) = val(1042);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+push();
+ref(expr) = nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+} else {
+ref(expr) = val(1042);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+newframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1187);
+k = apply(447); break;
+label(447);
 toframe();
 newframe();
-ref(expr) = val(666);
-k = apply(191); break;
-label(191);
+ref(expr) = val(1042);
 toframe();
-ref(expr) = val(888);
-k = apply(-1); break;
+ref(expr) = val(1187);
+k = apply(448); break;
+label(448);
+toframe();
+ref(expr) = val(512);
+k = apply(449); break;
+label(449);
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(444);
+ref(expr) = mkfun(445);
+val(1685) = ref(expr);
+goto(450);
+label(451);
+bind(1730);
+label(452);
+pushval(496);
+goto(453);
+label(454);
+bind(1731);
+label(455);
+ref(expr) = nil;
+push();
+ref(expr) = val(412);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 } else {
 newframe();
-ref(expr) = val(672);
-k = apply(192); break;
-label(192);
+ref(expr) = nil;
+toframe();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(456); break;
+label(456);
 newframe();
-ref(expr) = val(333);
+ref(expr) = 1742;
+toframe();
+ref(expr) = val(1170);
+k = apply(457); break;
+label(457);
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(412) = poparg();
+goto(455);
+}
+unbind();
+k = retn(); break;
+label(453);
+ref(expr) = mkfun(454);
+val(496) = ref(expr);
+pushval(1749);
+goto(458);
+label(459);
+bind(1750);
+label(460);
+ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(909);
 ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = 1764;
 toframe();
 newframe();
-ref(expr) = val(666);
-k = apply(193); break;
-label(193);
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(888);
-k = apply(-1); break;
-}
+ref(expr) = val(1093);
+k = apply(461); break;
+label(461);
+toframe();
+ref(expr) = 1411;
+toframe();
+ref(expr) = val(1170);
+k = apply(462); break;
+label(462);
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(460);
 }
+unbind();
+k = retn(); break;
+label(458);
+ref(expr) = mkfun(459);
+val(1749) = ref(expr);
+newframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(429);
+k = apply(463); break;
+label(463);
+toframe();
+ref(expr) = val(496);
+k = apply(464); break;
+label(464);
+newframe();
+ref(expr) = val(1042);
+toframe();
+ref(expr) = val(1749);
+k = apply(465); break;
+label(465);
+ref(expr) = true;
+val(1552) = ref(expr);
+ref(expr) = val(1025);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1775;
+toframe();
+ref(expr) = val(1170);
+k = apply(466); break;
+label(466);
+} else {
+newframe();
+ref(expr) = 1341;
+toframe();
+ref(expr) = val(1625);
+toframe();
+ref(expr) = 1631;
+toframe();
+ref(expr) = val(1170);
+k = apply(467); break;
+label(467);
 }
+popval(1749);
+popval(496);
 unbind();
 k = retn(); break;
-label(184);
-ref(expr) = mkfun(185);
-val(888) = ref(expr);
-ref(expr) = cons3(928, val(928), 0);
+label(450);
+ref(expr) = mkfun(451);
+val(1693) = ref(expr);
+goto(468);
+label(469);
+bind(1776);
+label(470);
+pushval(760);
+newframe();
+ref(expr) = val(1784);
 toframe();
-goto(194);
-label(195);
-bind(930);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(529);
+k = apply(471); break;
+label(471);
+val(760) = ref(expr);
 ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(760);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = nil;
+push();
+newframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(1187);
+k = apply(472); break;
+label(472);
+toframe();
+newframe();
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1187);
+k = apply(473); break;
+label(473);
+toframe();
+ref(expr) = val(512);
+k = apply(474); break;
+label(474);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+} else {
+pushval(496);
+goto(475);
+label(476);
+bind(1785);
+label(477);
+ref(expr) = nil;
+push();
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1207);
+k = apply(478); break;
+label(478);
+if (ref(expr) != nil) {
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(412) = poparg();
+goto(477);
+} else {
+ref(expr) = nil;
+}
+}
+unbind();
+k = retn(); break;
+label(475);
+ref(expr) = mkfun(476);
+val(496) = ref(expr);
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(496);
+k = apply(479); break;
+label(479);
+popval(496);
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+popval(760);
+unbind();
+k = retn(); break;
+label(468);
+ref(expr) = mkfun(469);
+val(1793) = ref(expr);
+goto(480);
+label(481);
+bind(1795);
+label(482);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+pushval(762);
 newframe();
-ref(expr) = 948;
+ref(expr) = val(409);
+toframe();
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(171);
-k = apply(-1); break;
+ref(expr) = val(529);
+k = apply(483); break;
+label(483);
+val(762) = ref(expr);
+ref(expr) = val(762);
+if (ref(expr) != nil) {
+ref(expr) = val(762);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 } else {
-ref(expr) = val(521);
+ref(expr) = val(135);
+}
+popval(762);
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
-ref(expr) = val(127);
+ref(expr) = 1194;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(672);
-k = apply(196); break;
-label(196);
-newframe();
-ref(expr) = val(333);
-toframe();
-ref(expr) = val(401);
-k = apply(-1); break;
+ref(expr) = val(135);
 } else {
 newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+goto(484);
+label(485);
+bind(1796);
 newframe();
-newframe();
-ref(expr) = val(666);
-k = apply(197); break;
-label(197);
+ref(expr) = val(409);
 toframe();
-ref(expr) = val(857);
-k = apply(198); break;
-label(198);
+ref(expr) = val(153);
 toframe();
-ref(expr) = val(955);
-k = apply(199); break;
-label(199);
-val(965) = ref(expr);
-newframe();
-ref(expr) = val(333);
+ref(expr) = val(1802);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(484);
+ref(expr) = mkfun(485);
+toframe();
+ref(expr) = val(552);
+k = apply(486); break;
+label(486);
 push();
-ref(expr) = val(965);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
 ref(expr) = cons3(ref(expr), ref(expr2), 0);
+}
+}
+unbind();
+k = retn(); break;
+label(480);
+ref(expr) = mkfun(481);
+val(1802) = ref(expr);
+goto(487);
+label(488);
+bind(1803);
+label(489);
+pushval(760);
+newframe();
+ref(expr) = val(1784);
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(529);
+k = apply(490); break;
+label(490);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+val(760) = ref(expr);
 newframe();
 newframe();
-ref(expr) = val(666);
-k = apply(200); break;
-label(200);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(857);
-k = apply(201); break;
-label(201);
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(928);
-k = apply(-1); break;
-}
-}
+ref(expr) = val(160);
+toframe();
+ref(expr) = val(569);
+k = apply(491); break;
+label(491);
+toframe();
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1802);
+k = apply(492); break;
+label(492);
+popval(760);
 unbind();
 k = retn(); break;
-label(194);
-ref(expr) = mkfun(195);
-val(928) = ref(expr);
-ref(expr) = cons3(955, val(955), 0);
+label(487);
+ref(expr) = mkfun(488);
+val(1810) = ref(expr);
+goto(493);
+label(494);
+bind(1811);
+label(495);
+pushval(409);
+newframe();
+ref(expr) = val(1035);
 toframe();
-goto(202);
-label(203);
-bind(966);
-ref(expr) = nil;
-push();
-ref(expr) = val(521);
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(529);
+k = apply(496); break;
+label(496);
+val(409) = ref(expr);
+ref(expr) = val(409);
 if (ref(expr) != nil) {
-ref(expr) = nil;
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 } else {
+ref(expr) = nil;
+}
+popval(409);
+unbind();
+k = retn(); break;
+label(493);
+ref(expr) = mkfun(494);
+val(1818) = ref(expr);
+goto(497);
+label(498);
+bind(1820);
+label(499);
+pushval(756);
 newframe();
-ref(expr) = val(521);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(851);
-k = apply(204); break;
-label(204);
+ref(expr) = val(1187);
+k = apply(500); break;
+label(500);
+val(756) = ref(expr);
+pushval(918);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = nil;
-toframe();
-ref(expr) = val(521);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(875);
-k = apply(-1); break;
+ref(expr) = val(1818);
+k = apply(501); break;
+label(501);
 } else {
-ref(expr) = val(121);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
-ref(expr) = val(521);
+ref(expr) = 1201;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(672);
-k = apply(205); break;
-label(205);
-newframe();
 ref(expr) = nil;
 toframe();
 newframe();
-newframe();
-ref(expr) = val(666);
-k = apply(206); break;
-label(206);
+ref(expr) = val(1053);
+k = apply(502); break;
+label(502);
 toframe();
-ref(expr) = val(857);
-k = apply(207); break;
-label(207);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(928);
-k = apply(-1); break;
+ref(expr) = val(1348);
+k = apply(503); break;
+label(503);
 } else {
-ref(expr) = 968;
+ref(expr) = nil;
+}
+}
+val(918) = ref(expr);
+pushval(496);
+goto(504);
+label(505);
+bind(1822);
+label(506);
+ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = val(672);
-k = apply(208); break;
-label(208);
-newframe();
-newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(507); break;
+label(507);
 newframe();
+ref(expr) = 1837;
+toframe();
+ref(expr) = val(689);
+toframe();
+ref(expr) = 1843;
+toframe();
+ref(expr) = val(1170);
+k = apply(508); break;
+label(508);
+ref(expr) = 642;
+push();
+ref(expr) = val(689);
+ref(expr2) = pop();
+ref(expr) = arith('+');
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(412) = poparg();
+val(689) = poparg();
+goto(506);
+}
+unbind();
+k = retn(); break;
+label(504);
+ref(expr) = mkfun(505);
+val(496) = ref(expr);
 newframe();
-ref(expr) = val(666);
-k = apply(209); break;
-label(209);
+ref(expr) = 1341;
 toframe();
-ref(expr) = val(857);
-k = apply(210); break;
-label(210);
+ref(expr) = val(756);
 toframe();
-ref(expr) = val(955);
-k = apply(211); break;
-label(211);
+ref(expr) = 1849;
+toframe();
+ref(expr) = val(1170);
+k = apply(509); break;
+label(509);
+newframe();
+ref(expr) = 642;
 toframe();
-ref(expr) = 918;
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(256);
-k = apply(-1); break;
-} else {
-ref(expr) = 912;
+ref(expr) = val(429);
+k = apply(510); break;
+label(510);
+toframe();
+ref(expr) = val(496);
+k = apply(511); break;
+label(511);
+ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(918);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(672);
-k = apply(212); break;
-label(212);
-newframe();
 ref(expr) = nil;
 toframe();
-newframe();
-ref(expr) = val(666);
-k = apply(213); break;
-label(213);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(888);
-k = apply(-1); break;
+ref(expr) = val(1233);
+k = apply(512); break;
+label(512);
 } else {
-ref(expr) = 970;
-push();
-ref(expr) = val(521);
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = nil;
+}
+ref(expr) = val(1223);
 if (ref(expr) != nil) {
 newframe();
+ref(expr) = val(1527);
+k = apply(513); break;
+label(513);
 newframe();
-ref(expr) = val(672);
-k = apply(214); break;
-label(214);
+ref(expr) = 1341;
 toframe();
-ref(expr) = val(866);
-k = apply(215); break;
-label(215);
-newframe();
+ref(expr) = val(756);
+toframe();
+ref(expr) = 1859;
+toframe();
+ref(expr) = val(1170);
+k = apply(514); break;
+label(514);
+ref(expr) = val(918);
+if (ref(expr) != nil) {
 newframe();
+ref(expr) = 1870;
+toframe();
+ref(expr) = val(756);
+toframe();
+ref(expr) = 1875;
+toframe();
+ref(expr) = val(918);
+toframe();
+ref(expr) = 760;
+toframe();
+ref(expr) = val(1170);
+k = apply(515); break;
+label(515);
+} else {
 newframe();
-ref(expr) = val(666);
-k = apply(216); break;
-label(216);
+ref(expr) = 1870;
 toframe();
-ref(expr) = val(857);
-k = apply(217); break;
-label(217);
+ref(expr) = val(756);
 toframe();
-ref(expr) = val(955);
-k = apply(-1); break;
+ref(expr) = 1885;
+toframe();
+ref(expr) = val(1170);
+k = apply(516); break;
+label(516);
+}
 } else {
-ref(expr) = val(127);
-push();
-ref(expr) = val(521);
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = val(918);
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(672);
-k = apply(218); break;
-label(218);
-newframe();
-newframe();
-newframe();
-ref(expr) = val(666);
-k = apply(219); break;
-label(219);
+ref(expr) = 1897;
 toframe();
-ref(expr) = val(857);
-k = apply(220); break;
-label(220);
+ref(expr) = val(756);
 toframe();
-ref(expr) = val(955);
-k = apply(-1); break;
+ref(expr) = 1473;
+toframe();
+ref(expr) = val(756);
+toframe();
+ref(expr) = 1905;
+toframe();
+ref(expr) = val(918);
+toframe();
+ref(expr) = 1916;
+toframe();
+ref(expr) = val(1170);
+k = apply(517); break;
+label(517);
 } else {
 newframe();
-ref(expr) = 986;
+ref(expr) = 1897;
 toframe();
-ref(expr) = val(171);
-k = apply(-1); break;
-}
-}
-}
-}
+ref(expr) = val(756);
+toframe();
+ref(expr) = 1473;
+toframe();
+ref(expr) = val(756);
+toframe();
+ref(expr) = 1938;
+toframe();
+ref(expr) = val(1170);
+k = apply(518); break;
+label(518);
 }
 }
+popval(496);
+popval(918);
+popval(756);
+unbind();
+k = retn(); break;
+label(497);
+ref(expr) = mkfun(498);
+val(1702) = ref(expr);
+goto(519);
+label(520);
+bind(1940);
+label(521);
+newframe();
+ref(expr) = 1952;
+toframe();
+ref(expr) = val(1170);
+k = apply(522); break;
+label(522);
+pushval(496);
+goto(523);
+label(524);
+bind(1953);
+label(525);
+ref(expr) = nil;
+push();
+ref(expr) = val(412);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(526); break;
+label(526);
+newframe();
+ref(expr) = 1964;
+toframe();
+ref(expr) = val(1170);
+k = apply(527); break;
+label(527);
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(412) = poparg();
+goto(525);
 }
 unbind();
 k = retn(); break;
-label(202);
-ref(expr) = mkfun(203);
-val(955) = ref(expr);
+label(523);
+ref(expr) = mkfun(524);
+val(496) = ref(expr);
+newframe();
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(429);
+k = apply(528); break;
+label(528);
+toframe();
+ref(expr) = val(496);
+k = apply(529); break;
+label(529);
+popval(496);
+newframe();
 ref(expr) = nil;
 toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(530); break;
+label(530);
+ref(expr) = val(1223);
+if (ref(expr) != nil) {
 newframe();
+ref(expr) = 1986;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+pushval(1990);
 newframe();
+ref(expr) = val(1053);
+k = apply(531); break;
+label(531);
+val(1990) = ref(expr);
 newframe();
-ref(expr) = val(666);
-k = apply(221); break;
-label(221);
+ref(expr) = 2000;
 toframe();
-ref(expr) = val(857);
-k = apply(222); break;
-label(222);
+ref(expr) = val(1990);
 toframe();
-ref(expr) = val(955);
-k = apply(223); break;
-label(223);
-unbind();
-pop();
-unbind();
-k = retn(); break;
-label(166);
-ref(expr) = mkfun(167);
-val(991) = ref(expr);
-ref(expr) = 996;
-val(1002) = ref(expr);
-ref(expr) = 1003;
-val(1012) = ref(expr);
-ref(expr) = 1013;
-val(1020) = ref(expr);
-ref(expr) = 1022;
-val(1027) = ref(expr);
-goto(224);
-label(225);
-bind(1028);
-newframe();
+ref(expr) = 2011;
+toframe();
+ref(expr) = val(1170);
+k = apply(532); break;
+label(532);
 newframe();
-ref(expr) = 1058;
+ref(expr) = 1341;
 toframe();
-ref(expr) = val(135);
+ref(expr) = val(1990);
 toframe();
-ref(expr) = val(450);
-k = apply(226); break;
-label(226);
+ref(expr) = 1638;
 toframe();
-ref(expr) = val(183);
-k = apply(-1); break;
+ref(expr) = val(1170);
+k = apply(533); break;
+label(533);
+popval(1990);
+}
 unbind();
 k = retn(); break;
-label(224);
-ref(expr) = mkfun(225);
-val(1063) = ref(expr);
-goto(227);
-label(228);
-bind(1064);
-newframe();
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(229);
-label(230);
-bind(1067);
+label(519);
+ref(expr) = mkfun(520);
+val(1712) = ref(expr);
+goto(534);
+label(535);
+bind(2012);
+label(536);
+pushval(496);
+goto(537);
+label(538);
+bind(2013);
+label(539);
 ref(expr) = nil;
 push();
 ref(expr) = val(135);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(521);
-if (ref(expr) != nil) {
-ref(expr) = val(153);
+} else {
+ref(expr) = nil;
 push();
-ref(expr) = 770;
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1313);
+k = apply(540); break;
+label(540);
 ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 2038;
+toframe();
+ref(expr) = val(171);
+k = apply(541); break;
+label(541);
 } else {
-ref(expr) = val(153);
+ref(expr) = nil;
 }
-} else {
-ref(expr) = val(521);
-if (ref(expr) != nil) {
+newframe();
+ref(expr) = 1341;
+toframe();
 newframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1063);
-k = apply(231); break;
-label(231);
-val(1076) = ref(expr);
-newframe();
-ref(expr) = val(153);
-push();
-ref(expr) = val(1076);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr) = val(1093);
+k = apply(542); break;
+label(542);
 toframe();
-ref(expr) = 773;
-push();
-ref(expr) = val(1076);
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = 2047;
 toframe();
+ref(expr) = val(1170);
+k = apply(543); break;
+label(543);
+newframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
-} else {
+ref(expr) = val(1375);
+k = apply(544); break;
+label(544);
+if (ref(expr) != nil) {
+newframe();
 newframe();
-ref(expr) = val(153);
-push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
 toframe();
-ref(expr) = nil;
+ref(expr) = val(1384);
+k = apply(545); break;
+label(545);
 toframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
-}
-}
-unbind();
-k = retn(); break;
-label(229);
-ref(expr) = mkfun(230);
-val(417) = ref(expr);
-ref(expr) = nil;
-toframe();
+ref(expr) = val(1391);
+k = apply(546); break;
+label(546);
+} else {
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = true;
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(547); break;
+label(547);
+}
+newframe();
+ref(expr) = 1406;
 toframe();
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(350);
-k = apply(232); break;
-label(232);
+ref(expr) = val(1093);
+k = apply(548); break;
+label(548);
 toframe();
-ref(expr) = val(417);
-k = apply(233); break;
-label(233);
-unbind();
-pop();
+ref(expr) = 1411;
+toframe();
+ref(expr) = val(1170);
+k = apply(549); break;
+label(549);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(539);
+}
 unbind();
 k = retn(); break;
-label(227);
-ref(expr) = mkfun(228);
-val(1081) = ref(expr);
-ref(expr) = val(688);
-val(1088) = ref(expr);
+label(537);
+ref(expr) = mkfun(538);
+val(496) = ref(expr);
+pushval(2052);
+goto(550);
+label(551);
+bind(2053);
+label(552);
 ref(expr) = nil;
-val(1094) = ref(expr);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
 newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+toframe();
+ref(expr) = val(2052);
+k = apply(553); break;
+label(553);
 newframe();
-ref(expr) = 1096;
+ref(expr) = 1341;
 toframe();
-ref(expr) = true;
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(256);
-k = apply(234); break;
-label(234);
+ref(expr) = val(1093);
+k = apply(554); break;
+label(554);
 toframe();
-ref(expr) = val(256);
-k = apply(235); break;
-label(235);
-val(1103) = ref(expr);
-ref(expr) = nil;
-val(1110) = ref(expr);
-ref(expr) = 1111;
-val(1115) = ref(expr);
-goto(236);
-label(237);
-bind(0);
-newframe();
-ref(expr) = val(1115);
+ref(expr) = 2061;
 toframe();
-ref(expr) = val(1081);
-k = apply(238); break;
-label(238);
-val(1115) = ref(expr);
-ref(expr) = val(1115);
+ref(expr) = val(1170);
+k = apply(-1); break;
+}
 unbind();
 k = retn(); break;
-label(236);
-ref(expr) = mkfun(237);
-val(1126) = ref(expr);
-goto(239);
-label(240);
-bind(1132);
+label(550);
+ref(expr) = mkfun(551);
+val(2052) = ref(expr);
 newframe();
-ref(expr) = val(1027);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1081);
-k = apply(241); break;
-label(241);
-val(1027) = ref(expr);
-ref(expr) = val(1094);
-push();
+ref(expr) = val(496);
+k = apply(555); break;
+label(555);
 newframe();
-ref(expr) = val(828);
-toframe();
-ref(expr) = val(333);
+ref(expr) = nil;
 toframe();
-ref(expr) = val(1129);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(1027);
+ref(expr) = val(1242);
+k = apply(556); break;
+label(556);
+newframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(256);
-k = apply(242); break;
-label(242);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
-val(1094) = ref(expr);
-ref(expr) = val(1027);
+ref(expr) = val(2052);
+k = apply(557); break;
+label(557);
+popval(2052);
+popval(496);
 unbind();
 k = retn(); break;
-label(239);
-ref(expr) = mkfun(240);
-val(1142) = ref(expr);
-goto(243);
-label(244);
-bind(1143);
-newframe();
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(245);
-label(246);
-bind(1145);
-ref(expr) = nil;
-push();
-ref(expr) = val(135);
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
+label(534);
+ref(expr) = mkfun(535);
+val(2068) = ref(expr);
+goto(558);
+label(559);
+bind(2069);
+label(560);
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(1012);
-toframe();
-ref(expr) = val(802);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1142);
-k = apply(-1); break;
-} else {
+ref(expr) = val(1233);
+k = apply(561); break;
+label(561);
+pushval(760);
 newframe();
-newframe();
-ref(expr) = true;
-toframe();
-ref(expr) = val(802);
+ref(expr) = 2123;
 toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1142);
-k = apply(247); break;
-label(247);
-toframe();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
+ref(expr) = val(529);
+k = apply(562); break;
+label(562);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(760) = ref(expr);
+newframe();
+ref(expr) = 2137;
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
-}
+ref(expr) = val(760);
+toframe();
+ref(expr) = 2168;
+toframe();
+ref(expr) = val(1170);
+k = apply(563); break;
+label(563);
+popval(760);
 unbind();
 k = retn(); break;
-label(245);
-ref(expr) = mkfun(246);
-val(417) = ref(expr);
+label(558);
+ref(expr) = mkfun(559);
+val(2177) = ref(expr);
+goto(564);
+label(565);
+bind(2178);
+label(566);
+newframe();
 ref(expr) = nil;
 toframe();
-newframe();
-ref(expr) = val(1012);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(1233);
+k = apply(567); break;
+label(567);
+pushval(760);
 newframe();
-newframe();
+ref(expr) = 2214;
+toframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(744);
-k = apply(248); break;
-label(248);
+ref(expr) = val(529);
+k = apply(568); break;
+label(568);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(760) = ref(expr);
+newframe();
+ref(expr) = 2216;
 toframe();
-ref(expr) = val(401);
-k = apply(249); break;
-label(249);
+ref(expr) = val(760);
 toframe();
-ref(expr) = val(417);
-k = apply(250); break;
-label(250);
-unbind();
-pop();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (ref(expr) != nil) {
+ref(expr) = 2221;
+} else {
+ref(expr) = 2227;
+}
+toframe();
+ref(expr) = 2242;
+toframe();
+ref(expr) = val(1170);
+k = apply(569); break;
+label(569);
+popval(760);
 unbind();
 k = retn(); break;
-label(243);
-ref(expr) = mkfun(244);
-val(1155) = ref(expr);
-goto(251);
-label(252);
-bind(1156);
+label(564);
+ref(expr) = mkfun(565);
+val(2249) = ref(expr);
+goto(570);
+label(571);
+bind(2250);
+label(572);
 newframe();
 ref(expr) = nil;
-push();
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(573); break;
+label(573);
+newframe();
+ref(expr) = val(1025);
+if (ref(expr) != nil) {
+ref(expr) = 1742;
+} else {
+ref(expr) = 2258;
+}
+toframe();
+ref(expr) = val(1170);
+k = apply(574); break;
+label(574);
 newframe();
 ref(expr) = nil;
 toframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(623);
-k = apply(253); break;
-label(253);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr) = val(1233);
+k = apply(575); break;
+label(575);
+newframe();
+ref(expr) = val(1025);
+if (ref(expr) != nil) {
+ref(expr) = 2281;
+} else {
+ref(expr) = 2301;
+}
 toframe();
-ref(expr) = val(652);
+ref(expr) = val(1170);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(251);
-ref(expr) = mkfun(252);
-val(630) = ref(expr);
-goto(254);
-label(255);
-bind(1157);
-newframe();
-ref(expr) = cons3(643, val(643), 0);
-toframe();
+label(570);
+ref(expr) = mkfun(571);
+val(2309) = ref(expr);
+goto(576);
+label(577);
+bind(2314);
+label(578);
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(630);
-k = apply(256); break;
-label(256);
-val(643) = ref(expr);
-ref(expr) = cons3(330, val(330), 0);
-toframe();
+ref(expr) = val(2309);
+k = apply(579); break;
+label(579);
 newframe();
-ref(expr) = val(1103);
+ref(expr) = 2318;
 toframe();
-ref(expr) = val(643);
+ref(expr) = val(2312);
 toframe();
-ref(expr) = val(450);
-k = apply(257); break;
-label(257);
-val(330) = ref(expr);
-ref(expr) = nil;
+ref(expr) = 2338;
 toframe();
-ref(expr) = val(330);
+ref(expr) = val(1170);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(576);
+ref(expr) = mkfun(577);
+val(2347) = ref(expr);
+goto(580);
+label(581);
+bind(2349);
+label(582);
+ref(expr) = val(135);
+push();
+ref(expr) = nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = cons3(645, val(645), 0);
+ref(expr) = 1261;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+push();
+ref(expr) = true;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(330);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = 2367;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(450);
-k = apply(258); break;
-label(258);
-val(645) = ref(expr);
-ref(expr) = nil;
-toframe();
-ref(expr) = val(645);
+push();
+ref(expr) = 2373;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(645);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+newframe();
+ref(expr) = 2388;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
 } else {
+ref(expr) = val(135);
+push();
+ref(expr) = 2395;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = cons3(333, val(333), 0);
+ref(expr) = 2414;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(1155);
-k = apply(259); break;
-label(259);
-val(333) = ref(expr);
-ref(expr) = nil;
+ref(expr) = val(1112);
+k = apply(583); break;
+label(583);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 2216;
 toframe();
 newframe();
-ref(expr) = val(330);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-push();
-ref(expr) = val(333);
-push();
 ref(expr) = val(135);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
 toframe();
-ref(expr) = val(330);
+ref(expr) = val(1128);
+k = apply(584); break;
+label(584);
 toframe();
-ref(expr) = val(328);
-k = apply(260); break;
-label(260);
-ref(expr) = val(333);
-unbind();
-pop();
-}
-unbind();
-pop();
+ref(expr) = 2427;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
 } else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = cons3(333, val(333), 0);
+ref(expr) = 1341;
 toframe();
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(1155);
-k = apply(261); break;
-label(261);
-val(333) = ref(expr);
-ref(expr) = nil;
+ref(expr) = val(1093);
+k = apply(585); break;
+label(585);
 toframe();
-ref(expr) = val(1103);
+ref(expr) = 2444;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
+ref(expr) = 2449;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(333);
-push();
+ref(expr) = val(1223);
+toframe();
 ref(expr) = val(135);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(256);
-k = apply(262); break;
-label(262);
-push();
-ref(expr) = val(643);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
-val(1103) = ref(expr);
-ref(expr) = val(333);
-unbind();
-pop();
-}
-unbind();
-pop();
-unbind();
-k = retn(); break;
-label(254);
-ref(expr) = mkfun(255);
-val(1166) = ref(expr);
-goto(263);
-label(264);
-bind(1167);
-ref(expr) = nil;
-push();
+ref(expr) = val(1302);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2455;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(1012);
+newframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(2068);
+k = apply(-1); break;
 } else {
-ref(expr) = true;
-push();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 1201;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(1020);
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(1391);
+k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-ref(expr) = atomic()? true: nil;
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2461;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
+ref(expr) = val(1223);
+toframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(1166);
+ref(expr) = val(1242);
 k = apply(-1); break;
 } else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 1194;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = nil;
+ref(expr) = 2216;
 toframe();
 newframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1179);
-k = apply(265); break;
-label(265);
+ref(expr) = val(1153);
+k = apply(586); break;
+label(586);
 toframe();
-newframe();
+ref(expr) = 2427;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2466;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1179);
-k = apply(266); break;
-label(266);
-toframe();
-ref(expr) = val(1142);
+ref(expr) = val(1419);
 k = apply(-1); break;
-}
-}
-}
-unbind();
-k = retn(); break;
-label(263);
-ref(expr) = mkfun(264);
-val(1179) = ref(expr);
-goto(267);
-label(268);
-bind(1180);
-ref(expr) = nil;
-push();
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 141;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(1012);
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(587); break;
+label(587);
+newframe();
+ref(expr) = 2499;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
 } else {
-ref(expr) = true;
-push();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 146;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = val(1020);
+newframe();
+ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(588); break;
+label(588);
+newframe();
+ref(expr) = 2539;
+toframe();
+ref(expr) = val(1170);
+k = apply(589); break;
+label(589);
+newframe();
+ref(expr) = 2567;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-ref(expr) = atomic()? true: nil;
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 151;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
+ref(expr) = nil;
+toframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(590); break;
+label(590);
+newframe();
+ref(expr) = 2607;
+toframe();
+ref(expr) = val(1170);
+k = apply(591); break;
+label(591);
+newframe();
+ref(expr) = 2635;
 toframe();
-ref(expr) = val(1166);
+ref(expr) = val(1170);
 k = apply(-1); break;
 } else {
-ref(expr) = val(1110);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
+ref(expr) = 160;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(1179);
-k = apply(269); break;
-label(269);
-ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
-val(1110) = ref(expr);
-ref(expr) = val(1110);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-}
-}
-}
-unbind();
-k = retn(); break;
-label(267);
-ref(expr) = mkfun(268);
-val(1191) = ref(expr);
-goto(270);
-label(271);
-bind(135);
+ref(expr) = val(2309);
+k = apply(592); break;
+label(592);
 newframe();
-ref(expr) = cons3(417, val(417), 0);
+ref(expr) = 2651;
 toframe();
-goto(272);
-label(273);
-bind(1192);
-ref(expr) = nil;
-push();
+ref(expr) = 2681;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 165;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(536);
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(2309);
+k = apply(593); break;
+label(593);
+newframe();
+ref(expr) = 2692;
+toframe();
+ref(expr) = 2730;
+toframe();
+ref(expr) = val(1170);
 k = apply(-1); break;
 } else {
-newframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-toframe();
-ref(expr) = val(595);
-k = apply(274); break;
-label(274);
+push();
+ref(expr) = 180;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
+ref(expr) = nil;
+toframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
-}
-unbind();
-k = retn(); break;
-label(272);
-ref(expr) = mkfun(273);
-val(417) = ref(expr);
-ref(expr) = nil;
+ref(expr) = val(1233);
+k = apply(594); break;
+label(594);
+newframe();
+ref(expr) = 2764;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 187;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
+ref(expr) = 2766;
+toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(417);
-k = apply(275); break;
-label(275);
-unbind();
-pop();
-unbind();
-k = retn(); break;
-label(270);
-ref(expr) = mkfun(271);
-val(1197) = ref(expr);
-goto(276);
-label(277);
-bind(1202);
-ref(expr) = nil;
-push();
+ref(expr) = val(2347);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 200;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+newframe();
+ref(expr) = 883;
+toframe();
+ref(expr) = val(135);
+toframe();
+ref(expr) = val(2347);
+k = apply(-1); break;
 } else {
-ref(expr) = nil;
-push();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 208;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = 886;
 toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1210);
+ref(expr) = val(2347);
 k = apply(-1); break;
 } else {
-newframe();
-ref(expr) = nil;
-toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-toframe();
-ref(expr) = val(1210);
-k = apply(278); break;
-label(278);
+push();
+ref(expr) = 219;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = 2768;
 toframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(1219);
+ref(expr) = val(2347);
 k = apply(-1); break;
-}
-}
-unbind();
-k = retn(); break;
-label(276);
-ref(expr) = mkfun(277);
-val(1219) = ref(expr);
-goto(279);
-label(280);
-bind(1221);
-ref(expr) = nil;
-push();
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 231;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = 1238;
+ref(expr) = 2770;
+toframe();
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(2347);
 k = apply(-1); break;
 } else {
-newframe();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(177);
-k = apply(281); break;
-label(281);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
-ref(expr) = true;
+ref(expr) = 239;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
+ref(expr) = 704;
+toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(189);
-k = apply(282); break;
-label(282);
+ref(expr) = val(2347);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
-ref(expr) = nil;
+ref(expr) = 2776;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = nil;
 toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1219);
+ref(expr) = val(1233);
+k = apply(595); break;
+label(595);
+newframe();
+ref(expr) = 2810;
+toframe();
+ref(expr) = val(1170);
 k = apply(-1); break;
 } else {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = 2813;
 toframe();
-newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(189);
-k = apply(283); break;
-label(283);
+ref(expr) = val(521);
+k = apply(596); break;
+label(596);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1219);
+ref(expr) = val(2177);
 k = apply(-1); break;
-}
 } else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2818;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
 ref(expr) = nil;
 toframe();
-newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(177);
-k = apply(284); break;
-label(284);
-toframe();
-ref(expr) = val(1210);
-k = apply(285); break;
-label(285);
+ref(expr) = val(1233);
+k = apply(597); break;
+label(597);
 newframe();
-ref(expr) = 1262;
+ref(expr) = 2567;
 toframe();
-ref(expr) = val(1197);
-k = apply(286); break;
-label(286);
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2823;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = nil;
 toframe();
-newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(189);
-k = apply(287); break;
-label(287);
-toframe();
-ref(expr) = val(1219);
-k = apply(288); break;
-label(288);
+ref(expr) = val(1233);
+k = apply(598); break;
+label(598);
 newframe();
-ref(expr) = 1271;
+ref(expr) = 2635;
 toframe();
-ref(expr) = val(1197);
-k = apply(289); break;
-label(289);
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2829;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = nil;
 toframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1279);
-k = apply(290); break;
-label(290);
+ref(expr) = val(1233);
+k = apply(599); break;
+label(599);
 newframe();
-ref(expr) = 1281;
+ref(expr) = 2846;
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(1170);
 k = apply(-1); break;
-}
-}
-unbind();
-k = retn(); break;
-label(279);
-ref(expr) = mkfun(280);
-val(1279) = ref(expr);
-goto(291);
-label(292);
-bind(1282);
-ref(expr) = nil;
-push();
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2852;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+newframe();
 ref(expr) = nil;
+toframe();
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(600); break;
+label(600);
+newframe();
+ref(expr) = 2869;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
 } else {
-ref(expr) = true;
-push();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2875;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+newframe();
 ref(expr) = nil;
-} else {
+toframe();
 ref(expr) = val(135);
-ref(expr) = atomic()? true: nil;
-if (ref(expr) != nil) {
-} else {
-ref(expr) = nil;
-}
-}
-}
-unbind();
-k = retn(); break;
-label(291);
-ref(expr) = mkfun(292);
-val(1290) = ref(expr);
-goto(293);
-label(294);
-bind(1291);
-newframe();
-newframe();
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1233);
+k = apply(601); break;
+label(601);
 newframe();
-ref(expr) = val(135);
+ref(expr) = 2888;
 toframe();
-ref(expr) = val(183);
-k = apply(295); break;
-label(295);
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+newframe();
+ref(expr) = 2891;
 toframe();
-ref(expr) = val(1290);
-k = apply(296); break;
-label(296);
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(266);
-k = apply(297); break;
-label(297);
+ref(expr) = val(521);
+k = apply(602); break;
+label(602);
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = 1315;
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(171);
-k = apply(298); break;
-label(298);
+ref(expr) = val(2249);
+k = apply(-1); break;
 } else {
-ref(expr) = nil;
-}
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2898;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = nil;
+ref(expr) = 2919;
 toframe();
-newframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(223);
-k = apply(299); break;
-label(299);
-toframe();
-ref(expr) = val(1210);
-k = apply(300); break;
-label(300);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2926;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = 1330;
+ref(expr) = 2947;
 toframe();
-newframe();
-newframe();
-newframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2953;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = 2974;
 toframe();
-ref(expr) = val(183);
-k = apply(301); break;
-label(301);
-toframe();
-ref(expr) = val(1166);
-k = apply(302); break;
-label(302);
-toframe();
-ref(expr) = val(1088);
-k = apply(303); break;
-label(303);
-toframe();
-ref(expr) = 1335;
-toframe();
-ref(expr) = val(1197);
+ref(expr) = val(1170);
 k = apply(-1); break;
-unbind();
-k = retn(); break;
-label(293);
-ref(expr) = mkfun(294);
-val(1343) = ref(expr);
-goto(304);
-label(305);
-bind(1344);
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2982;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = cons3(1349, val(1349), 0);
+ref(expr) = val(135);
 toframe();
+ref(expr) = val(2309);
+k = apply(603); break;
+label(603);
 newframe();
-ref(expr) = val(1126);
-k = apply(306); break;
-label(306);
-val(1349) = ref(expr);
-ref(expr) = cons3(1353, val(1353), 0);
+ref(expr) = 3011;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 3019;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1126);
-k = apply(307); break;
-label(307);
-val(1353) = ref(expr);
-ref(expr) = nil;
+ref(expr) = val(135);
 toframe();
+ref(expr) = val(2309);
+k = apply(604); break;
+label(604);
 newframe();
-ref(expr) = 1356;
+ref(expr) = 3048;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 3056;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1349);
-toframe();
-ref(expr) = val(1088);
-k = apply(308); break;
-label(308);
+ref(expr) = nil;
 toframe();
-ref(expr) = 1362;
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1197);
-k = apply(309); break;
-label(309);
+ref(expr) = val(1233);
+k = apply(605); break;
+label(605);
 newframe();
-ref(expr) = 1356;
+ref(expr) = 3075;
 toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
+} else {
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr) = atomic()? true: nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1353);
-toframe();
-ref(expr) = val(1088);
-k = apply(310); break;
-label(310);
+ref(expr) = nil;
 toframe();
-ref(expr) = 1369;
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1197);
-k = apply(311); break;
-label(311);
+ref(expr) = val(1719);
+k = apply(-1); break;
+} else {
 newframe();
-ref(expr) = 1356;
+ref(expr) = val(135);
 toframe();
-newframe();
-newframe();
+ref(expr) = val(1793);
+k = apply(606); break;
+label(606);
+if (ref(expr) != nil) {
+ref(expr) = val(1223);
+pusharg();
 newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(183);
-k = apply(312); break;
-label(312);
-toframe();
-ref(expr) = val(1191);
-k = apply(313); break;
-label(313);
-toframe();
-ref(expr) = val(1088);
-k = apply(314); break;
-label(314);
-toframe();
-ref(expr) = 1375;
-toframe();
-ref(expr) = val(1197);
-k = apply(315); break;
-label(315);
+ref(expr) = val(1810);
+k = apply(607); break;
+label(607);
+pusharg();
+val(135) = poparg();
+val(1223) = poparg();
+goto(582);
+} else {
 newframe();
-ref(expr) = true;
+ref(expr) = val(1223);
 toframe();
-newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(195);
-k = apply(316); break;
-label(316);
-toframe();
-ref(expr) = val(1219);
-k = apply(317); break;
-label(317);
+ref(expr) = val(1719);
+k = apply(-1); break;
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(580);
+ref(expr) = mkfun(581);
+val(1233) = ref(expr);
+goto(608);
+label(609);
+bind(0);
+label(610);
 newframe();
-ref(expr) = 1385;
-toframe();
-ref(expr) = val(1197);
-k = apply(318); break;
-label(318);
+ref(expr) = val(1170);
+k = apply(611); break;
+label(611);
 newframe();
-ref(expr) = 1404;
+ref(expr) = 3117;
 toframe();
-ref(expr) = val(1197);
-k = apply(319); break;
-label(319);
+ref(expr) = val(1170);
+k = apply(612); break;
+label(612);
 newframe();
-ref(expr) = 1356;
-toframe();
+ref(expr) = val(1170);
+k = apply(613); break;
+label(613);
 newframe();
-ref(expr) = val(1349);
-toframe();
-ref(expr) = val(1088);
-k = apply(320); break;
-label(320);
+ref(expr) = 3134;
 toframe();
-ref(expr) = 1369;
-toframe();
-ref(expr) = val(1197);
-k = apply(321); break;
-label(321);
+ref(expr) = val(1170);
+k = apply(614); break;
+label(614);
 newframe();
-ref(expr) = 1356;
+ref(expr) = 3141;
 toframe();
+ref(expr) = val(1170);
+k = apply(615); break;
+label(615);
 newframe();
-ref(expr) = val(1353);
-toframe();
-ref(expr) = val(1088);
-k = apply(322); break;
-label(322);
-toframe();
-ref(expr) = 1423;
+ref(expr) = 3150;
 toframe();
-ref(expr) = val(1197);
-k = apply(323); break;
-label(323);
-unbind();
-pop();
-unbind();
-k = retn(); break;
-label(304);
-ref(expr) = mkfun(305);
-val(1430) = ref(expr);
-goto(324);
-label(325);
-bind(1432);
+ref(expr) = val(1170);
+k = apply(616); break;
+label(616);
 newframe();
-ref(expr) = 1444;
+ref(expr) = 3175;
 toframe();
-ref(expr) = val(1197);
-k = apply(326); break;
-label(326);
+ref(expr) = val(1170);
+k = apply(617); break;
+label(617);
 newframe();
-ref(expr) = cons3(417, val(417), 0);
+ref(expr) = 3183;
 toframe();
-goto(327);
-label(328);
-bind(1445);
+ref(expr) = val(1170);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(608);
+ref(expr) = mkfun(609);
+val(3190) = ref(expr);
+goto(618);
+label(619);
+bind(0);
+label(620);
+pushval(496);
+goto(621);
+label(622);
+bind(3195);
+label(623);
 ref(expr) = nil;
 push();
-ref(expr) = val(333);
+ref(expr) = val(3194);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+newframe();
+ref(expr) = 2216;
+toframe();
+ref(expr) = val(412);
+toframe();
+ref(expr) = 3210;
+toframe();
+ref(expr) = val(1170);
+k = apply(-1); break;
 } else {
 newframe();
 ref(expr) = nil;
 toframe();
-ref(expr) = val(333);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(1210);
-k = apply(329); break;
-label(329);
-newframe();
-ref(expr) = 1456;
+ref(expr) = val(3194);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1197);
-k = apply(330); break;
-label(330);
-newframe();
-ref(expr) = val(333);
-if (symbolic()) cdr_err();
+ref(expr) = val(1069);
+k = apply(624); break;
+label(624);
+pusharg();
+ref(expr) = val(3194);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
+pusharg();
+val(3194) = poparg();
+val(412) = poparg();
+goto(623);
 }
 unbind();
 k = retn(); break;
-label(327);
-ref(expr) = mkfun(328);
-val(417) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(621);
+ref(expr) = mkfun(622);
+val(496) = ref(expr);
 newframe();
-newframe();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = val(973);
 toframe();
-ref(expr) = val(350);
-k = apply(331); break;
-label(331);
+ref(expr) = val(1013);
 toframe();
-ref(expr) = val(417);
-k = apply(332); break;
-label(332);
+ref(expr) = val(496);
+k = apply(625); break;
+label(625);
+popval(496);
 unbind();
-pop();
-newframe();
-ref(expr) = nil;
-toframe();
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-toframe();
-ref(expr) = val(1210);
-k = apply(333); break;
-label(333);
-ref(expr) = val(1200);
+k = retn(); break;
+label(618);
+ref(expr) = mkfun(619);
+val(3222) = ref(expr);
+goto(626);
+label(627);
+bind(3223);
+label(628);
+ref(expr) = val(133);
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = 1478;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = 3228;
+} else {
+ref(expr) = 3230;
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 3235;
+} else {
+ref(expr) = 3237;
+push();
+ref(expr) = val(600);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 3242;
 } else {
 newframe();
-ref(expr) = cons3(1482, val(1482), 0);
-toframe();
-newframe();
-ref(expr) = val(1126);
-k = apply(334); break;
-label(334);
-val(1482) = ref(expr);
-ref(expr) = nil;
-toframe();
-newframe();
-ref(expr) = 1492;
-toframe();
 newframe();
-ref(expr) = val(1482);
+ref(expr) = 123;
 toframe();
-ref(expr) = val(1088);
-k = apply(335); break;
-label(335);
+ref(expr) = 3230;
 toframe();
-ref(expr) = 1503;
+ref(expr) = val(600);
 toframe();
-ref(expr) = val(1197);
-k = apply(336); break;
-label(336);
-newframe();
-ref(expr) = 1356;
+ref(expr) = 3230;
 toframe();
-newframe();
-ref(expr) = val(1482);
+ref(expr) = 117;
 toframe();
-ref(expr) = val(1088);
-k = apply(337); break;
-label(337);
+ref(expr) = 898;
 toframe();
-ref(expr) = 1369;
+ref(expr) = val(335);
+k = apply(629); break;
+label(629);
 toframe();
-ref(expr) = val(1197);
-k = apply(338); break;
-label(338);
-unbind();
-pop();
+ref(expr) = val(797);
+k = apply(-1); break;
+}
+}
 }
 unbind();
 k = retn(); break;
-label(324);
-ref(expr) = mkfun(325);
-val(1510) = ref(expr);
-goto(339);
-label(340);
-bind(1511);
-newframe();
-ref(expr) = 1444;
-toframe();
-ref(expr) = val(1197);
-k = apply(341); break;
-label(341);
-newframe();
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(342);
-label(343);
-bind(1512);
-ref(expr) = nil;
+label(626);
+ref(expr) = mkfun(627);
+val(3247) = ref(expr);
+goto(630);
+label(631);
+bind(0);
+label(632);
+pushval(3252);
+goto(633);
+label(634);
+bind(3253);
+label(635);
+pushval(135);
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(135) = ref(expr);
+pushval(412);
+ref(expr) = 1117;
 push();
-ref(expr) = val(135);
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+} else {
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr) = numeric()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 } else {
 newframe();
-newframe();
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(177);
-k = apply(344); break;
-label(344);
-toframe();
-ref(expr) = val(1290);
-k = apply(345); break;
-label(345);
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(266);
-k = apply(346); break;
-label(346);
+ref(expr) = val(3247);
+k = apply(636); break;
+label(636);
+}
+}
+val(412) = ref(expr);
+pushval(935);
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(935) = ref(expr);
+pushval(760);
+ref(expr) = 1117;
+push();
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 3260;
+} else {
+ref(expr) = val(639);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = 1537;
-toframe();
-ref(expr) = val(171);
-k = apply(347); break;
-label(347);
+ref(expr) = 2113;
 } else {
-ref(expr) = nil;
+ref(expr) = 644;
 }
+}
+val(760) = ref(expr);
 newframe();
-newframe();
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(177);
-k = apply(348); break;
-label(348);
-toframe();
-ref(expr) = val(1166);
-k = apply(349); break;
-label(349);
+ref(expr) = 2216;
 toframe();
-ref(expr) = val(1088);
-k = apply(350); break;
-label(350);
-val(1548) = ref(expr);
-newframe();
-ref(expr) = 1555;
+ref(expr) = val(760);
 toframe();
-ref(expr) = val(1548);
+ref(expr) = 3265;
 toframe();
-ref(expr) = 1562;
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1548);
+ref(expr) = 3270;
 toframe();
-ref(expr) = 1581;
+ref(expr) = 3273;
 toframe();
-ref(expr) = val(1197);
-k = apply(351); break;
-label(351);
-newframe();
-ref(expr) = 1456;
+ref(expr) = val(935);
 toframe();
-ref(expr) = val(1197);
-k = apply(352); break;
-label(352);
-newframe();
-ref(expr) = nil;
+ref(expr) = 3265;
 toframe();
-newframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(216);
-k = apply(353); break;
-label(353);
-toframe();
-ref(expr) = val(1210);
-k = apply(354); break;
-label(354);
-newframe();
-ref(expr) = 1330;
+ref(expr) = 3278;
 toframe();
-newframe();
-newframe();
-newframe();
-ref(expr) = val(135);
+ref(expr) = 3273;
 toframe();
-ref(expr) = val(177);
-k = apply(355); break;
-label(355);
+ref(expr) = val(412);
 toframe();
-ref(expr) = val(1166);
-k = apply(356); break;
-label(356);
+ref(expr) = 3265;
 toframe();
-ref(expr) = val(1088);
-k = apply(357); break;
-label(357);
+ref(expr) = val(135);
 toframe();
-ref(expr) = 1335;
+ref(expr) = 3283;
 toframe();
-ref(expr) = val(1197);
-k = apply(358); break;
-label(358);
+ref(expr) = val(1170);
+k = apply(637); break;
+label(637);
+popval(760);
+popval(935);
+popval(412);
+popval(135);
+unbind();
+k = retn(); break;
+label(633);
+ref(expr) = mkfun(634);
+val(3252) = ref(expr);
+pushval(496);
+goto(638);
+label(639);
+bind(3284);
+label(640);
+ref(expr) = nil;
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = val(639);
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
+ref(expr) = val(3252);
+k = apply(641); break;
+label(641);
+ref(expr) = val(639);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(639) = poparg();
+goto(640);
 }
 unbind();
 k = retn(); break;
-label(342);
-ref(expr) = mkfun(343);
-val(417) = ref(expr);
-ref(expr) = nil;
-toframe();
-newframe();
+label(638);
+ref(expr) = mkfun(639);
+val(496) = ref(expr);
 newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(359); break;
-label(359);
+ref(expr) = val(992);
 toframe();
-ref(expr) = val(417);
-k = apply(360); break;
-label(360);
+ref(expr) = val(496);
+k = apply(642); break;
+label(642);
+popval(496);
+popval(3252);
 unbind();
-pop();
+k = retn(); break;
+label(630);
+ref(expr) = mkfun(631);
+val(3295) = ref(expr);
+goto(643);
+label(644);
+bind(0);
+label(645);
 newframe();
-ref(expr) = 1238;
+ref(expr) = 3303;
 toframe();
-ref(expr) = val(1197);
-k = apply(361); break;
-label(361);
+ref(expr) = val(1170);
+k = apply(646); break;
+label(646);
 newframe();
-ref(expr) = 1456;
+ref(expr) = 3306;
 toframe();
-ref(expr) = val(1197);
-k = apply(362); break;
-label(362);
+ref(expr) = val(1170);
+k = apply(647); break;
+label(647);
 newframe();
-ref(expr) = nil;
-toframe();
+ref(expr) = val(3315);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(643);
+ref(expr) = mkfun(644);
+val(3322) = ref(expr);
+goto(648);
+label(649);
+bind(0);
+label(650);
 newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(195);
-k = apply(363); break;
-label(363);
+ref(expr) = val(1170);
+k = apply(651); break;
+label(651);
+newframe();
+ref(expr) = 3341;
 toframe();
-ref(expr) = val(1219);
-k = apply(364); break;
-label(364);
+ref(expr) = val(1170);
+k = apply(652); break;
+label(652);
+pushval(153);
 newframe();
-ref(expr) = 1385;
+ref(expr) = val(999);
 toframe();
-ref(expr) = val(1197);
-k = apply(365); break;
-label(365);
+goto(653);
+label(654);
+bind(3342);
 newframe();
-ref(expr) = 1588;
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = val(146);
+toframe();
+ref(expr) = val(552);
+k = apply(655); break;
+label(655);
+push();
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
 unbind();
 k = retn(); break;
-label(339);
-ref(expr) = mkfun(340);
-val(1595) = ref(expr);
-goto(366);
-label(367);
-bind(1596);
+label(653);
+ref(expr) = mkfun(654);
+toframe();
+ref(expr) = val(552);
+k = apply(656); break;
+label(656);
+val(153) = ref(expr);
 newframe();
-ref(expr) = nil;
+ref(expr) = 2216;
 toframe();
 newframe();
-ref(expr) = val(135);
+ref(expr) = val(153);
 toframe();
-ref(expr) = val(183);
-k = apply(368); break;
-label(368);
+ref(expr) = val(1141);
+k = apply(657); break;
+label(657);
 toframe();
-ref(expr) = val(1210);
-k = apply(369); break;
-label(369);
-newframe();
-ref(expr) = cons3(643, val(643), 0);
+ref(expr) = 3357;
 toframe();
+ref(expr) = val(1170);
+k = apply(658); break;
+label(658);
+popval(153);
 newframe();
+ref(expr) = val(3222);
+k = apply(659); break;
+label(659);
 newframe();
-ref(expr) = 1650;
-toframe();
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr) = 1341;
 toframe();
-ref(expr) = val(450);
-k = apply(370); break;
-label(370);
+ref(expr) = val(986);
 toframe();
-ref(expr) = val(183);
-k = apply(371); break;
-label(371);
-val(643) = ref(expr);
-ref(expr) = nil;
+ref(expr) = 3363;
 toframe();
+ref(expr) = val(1170);
+k = apply(660); break;
+label(660);
 newframe();
-ref(expr) = 1664;
-toframe();
-ref(expr) = val(643);
-toframe();
-ref(expr) = 1695;
+ref(expr) = val(3295);
+k = apply(661); break;
+label(661);
+newframe();
+ref(expr) = 1304;
 toframe();
-ref(expr) = val(1197);
-k = apply(372); break;
-label(372);
-unbind();
-pop();
+ref(expr) = val(1170);
+k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(366);
-ref(expr) = mkfun(367);
-val(1704) = ref(expr);
-goto(373);
-label(374);
-bind(1705);
-newframe();
-ref(expr) = nil;
-toframe();
+label(648);
+ref(expr) = mkfun(649);
+val(3315) = ref(expr);
+goto(662);
+label(663);
+bind(0);
+label(664);
 newframe();
-ref(expr) = val(135);
+ref(expr) = 3400;
 toframe();
-ref(expr) = val(183);
-k = apply(375); break;
-label(375);
-toframe();
-ref(expr) = val(1210);
-k = apply(376); break;
-label(376);
+ref(expr) = val(1170);
+k = apply(665); break;
+label(665);
 newframe();
-ref(expr) = cons3(643, val(643), 0);
+ref(expr) = val(992);
 toframe();
+goto(666);
+label(667);
+bind(3401);
 newframe();
-newframe();
-ref(expr) = 1741;
-toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(450);
-k = apply(377); break;
-label(377);
-toframe();
-ref(expr) = val(183);
-k = apply(378); break;
-label(378);
-val(643) = ref(expr);
-ref(expr) = nil;
-toframe();
+ref(expr) = val(712);
+k = apply(668); break;
+label(668);
 newframe();
-ref(expr) = 970;
-toframe();
-ref(expr) = val(643);
+ref(expr) = 686;
 toframe();
+ref(expr) = val(712);
+k = apply(669); break;
+label(669);
 newframe();
+ref(expr) = 1117;
+push();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(223);
-k = apply(379); break;
-label(379);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 639;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 if (ref(expr) != nil) {
-ref(expr) = 1746;
+ref(expr) = 412;
 } else {
-ref(expr) = 1752;
+ref(expr) = 883;
+}
 }
 toframe();
-ref(expr) = 1767;
-toframe();
-ref(expr) = val(1197);
-k = apply(380); break;
-label(380);
-unbind();
-pop();
-unbind();
-k = retn(); break;
-label(373);
-ref(expr) = mkfun(374);
-val(1774) = ref(expr);
-goto(381);
-label(382);
-bind(1775);
+ref(expr) = val(712);
+k = apply(670); break;
+label(670);
 newframe();
-ref(expr) = nil;
+ref(expr) = 686;
 toframe();
+ref(expr) = val(712);
+k = apply(671); break;
+label(671);
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(223);
-k = apply(383); break;
-label(383);
-toframe();
-ref(expr) = val(1210);
-k = apply(384); break;
-label(384);
-newframe();
-ref(expr) = 1783;
-toframe();
-ref(expr) = val(1197);
-k = apply(385); break;
-label(385);
+ref(expr) = val(712);
+k = apply(672); break;
+label(672);
 newframe();
-ref(expr) = nil;
+ref(expr) = 686;
 toframe();
+ref(expr) = val(712);
+k = apply(673); break;
+label(673);
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(183);
-k = apply(386); break;
-label(386);
-toframe();
-ref(expr) = val(1210);
-k = apply(387); break;
-label(387);
+ref(expr) = val(712);
+k = apply(674); break;
+label(674);
 newframe();
-ref(expr) = 1803;
-toframe();
-ref(expr) = val(1197);
+ref(expr) = val(615);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(381);
-ref(expr) = mkfun(382);
-val(1811) = ref(expr);
-goto(388);
-label(389);
-bind(1813);
-ref(expr) = val(135);
-push();
-ref(expr) = nil;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = 1238;
+label(666);
+ref(expr) = mkfun(667);
 toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-} else {
-ref(expr) = val(135);
-push();
-ref(expr) = true;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
+ref(expr) = val(552);
+k = apply(675); break;
+label(675);
 newframe();
-ref(expr) = 1831;
+ref(expr) = 3438;
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(1170);
 k = apply(-1); break;
-} else {
-ref(expr) = val(135);
+unbind();
+k = retn(); break;
+label(662);
+ref(expr) = mkfun(663);
+val(3448) = ref(expr);
+ref(expr) = nil;
+val(3453) = ref(expr);
+ref(expr) = nil;
+val(3457) = ref(expr);
+ref(expr) = nil;
+val(3462) = ref(expr);
+ref(expr) = nil;
+val(3470) = ref(expr);
+ref(expr) = nil;
+val(3475) = ref(expr);
+ref(expr) = nil;
+val(3480) = ref(expr);
+ref(expr) = nil;
+val(1784) = ref(expr);
+ref(expr) = nil;
+val(1727) = ref(expr);
+ref(expr) = 3485;
+val(3491) = ref(expr);
+goto(676);
+label(677);
+bind(3492);
+label(678);
+ref(expr) = nil;
 push();
-ref(expr) = 1837;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = 1852;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-} else {
 ref(expr) = val(135);
-push();
-ref(expr) = 1859;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = 970;
-toframe();
-newframe();
-ref(expr) = val(1002);
-toframe();
-ref(expr) = val(1088);
-k = apply(390); break;
-label(390);
-toframe();
-ref(expr) = 1872;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
 } else {
 ref(expr) = val(135);
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = 1356;
-toframe();
-newframe();
-newframe();
+ref(expr) = val(3457);
+push();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(1166);
-k = apply(391); break;
-label(391);
-toframe();
-ref(expr) = val(1088);
-k = apply(392); break;
-label(392);
-toframe();
-ref(expr) = 1889;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3457) = ref(expr);
+ref(expr) = val(3462);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3462) = ref(expr);
 } else {
+ref(expr) = val(3457);
+push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3457) = ref(expr);
+ref(expr) = val(3462);
 push();
-ref(expr) = 1894;
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(1200);
-toframe();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3462) = ref(expr);
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(1279);
-k = apply(-1); break;
-} else {
+pusharg();
+val(135) = poparg();
+goto(678);
+}
+}
+unbind();
+k = retn(); break;
+label(676);
+ref(expr) = mkfun(677);
+val(3502) = ref(expr);
+goto(679);
+label(680);
+bind(3503);
+label(681);
 ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-push();
-ref(expr) = 1900;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
+} else {
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1595);
-k = apply(-1); break;
+ref(expr) = val(3508);
+k = apply(682); break;
+label(682);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(681);
+}
+unbind();
+k = retn(); break;
+label(679);
+ref(expr) = mkfun(680);
+val(3518) = ref(expr);
+goto(683);
+label(684);
+bind(3519);
+label(685);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 1907;
+ref(expr) = 1194;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(1430);
-k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 1913;
+ref(expr) = 2466;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = val(3453);
 toframe();
 ref(expr) = val(135);
-if (symbolic()) cdr_err();
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1219);
-k = apply(-1); break;
-} else {
+ref(expr) = val(521);
+k = apply(686); break;
+label(686);
+if (ref(expr) != nil) {
+ref(expr) = val(3457);
+push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-push();
-ref(expr) = 918;
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = 970;
-toframe();
-newframe();
-newframe();
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(393); break;
-label(393);
-toframe();
-ref(expr) = val(1191);
-k = apply(394); break;
-label(394);
-toframe();
-ref(expr) = val(1088);
-k = apply(395); break;
-label(395);
-toframe();
-ref(expr) = 1872;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3457) = ref(expr);
 } else {
+ref(expr) = val(3453);
+push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-push();
-ref(expr) = 1918;
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3453) = ref(expr);
+}
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(1343);
-k = apply(-1); break;
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(685);
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 141;
+ref(expr) = 1201;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = nil;
-toframe();
-newframe();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(396); break;
-label(396);
-toframe();
-ref(expr) = val(1210);
-k = apply(397); break;
-label(397);
-newframe();
-ref(expr) = 1951;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-} else {
-ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-push();
-ref(expr) = 146;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = nil;
 toframe();
+ref(expr) = val(3502);
+k = apply(687); break;
+label(687);
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(183);
-k = apply(398); break;
-label(398);
-toframe();
-ref(expr) = val(1210);
-k = apply(399); break;
-label(399);
-newframe();
-ref(expr) = 1978;
-toframe();
-ref(expr) = val(1197);
-k = apply(400); break;
-label(400);
-newframe();
-ref(expr) = 2006;
-toframe();
-ref(expr) = val(1197);
+ref(expr) = val(3518);
 k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 151;
+ref(expr) = 2455;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
+pushval(496);
+goto(688);
+label(689);
+bind(3520);
+label(690);
 ref(expr) = nil;
-toframe();
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(401); break;
-label(401);
-toframe();
-ref(expr) = val(1210);
-k = apply(402); break;
-label(402);
-newframe();
-ref(expr) = 2033;
-toframe();
-ref(expr) = val(1197);
-k = apply(403); break;
-label(403);
-newframe();
-ref(expr) = 2061;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-} else {
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 160;
+ref(expr) = val(409);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(1811);
-k = apply(404); break;
-label(404);
-newframe();
-ref(expr) = 2077;
-toframe();
-ref(expr) = 2107;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
 } else {
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr) = val(3457);
 push();
-ref(expr) = 165;
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(1811);
-k = apply(405); break;
-label(405);
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3457) = ref(expr);
 newframe();
-ref(expr) = 2118;
-toframe();
-ref(expr) = 2156;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-} else {
-ref(expr) = val(135);
-if (symbolic()) car_err();
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(1375);
+k = apply(691); break;
+label(691);
+if (ref(expr) != nil) {
+ref(expr) = val(3470);
 push();
-ref(expr) = 2162;
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-newframe();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3470) = ref(expr);
+} else {
 ref(expr) = nil;
+}
+newframe();
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3508);
+k = apply(692); break;
+label(692);
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(409) = poparg();
+goto(690);
+}
+unbind();
+k = retn(); break;
+label(688);
+ref(expr) = mkfun(689);
+val(496) = ref(expr);
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(183);
-k = apply(406); break;
-label(406);
-toframe();
-ref(expr) = val(1210);
-k = apply(407); break;
-label(407);
+ref(expr) = val(496);
+k = apply(693); break;
+label(693);
+popval(496);
 newframe();
-ref(expr) = 1356;
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
+ref(expr) = val(3518);
+k = apply(-1); break;
+} else {
 newframe();
-ref(expr) = val(1002);
-toframe();
-ref(expr) = val(1088);
-k = apply(408); break;
-label(408);
-toframe();
-ref(expr) = 2189;
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(3518);
 k = apply(-1); break;
+}
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(683);
+ref(expr) = mkfun(684);
+val(3508) = ref(expr);
+goto(694);
+label(695);
+bind(3521);
+label(696);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
 } else {
 newframe();
-ref(expr) = 2192;
-toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(442);
-k = apply(409); break;
-label(409);
+ref(expr) = val(3531);
+k = apply(697); break;
+label(697);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(696);
+}
+unbind();
+k = retn(); break;
+label(694);
+ref(expr) = mkfun(695);
+val(3546) = ref(expr);
+goto(698);
+label(699);
+bind(3547);
+label(700);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
+ref(expr) = val(3470);
+toframe();
 ref(expr) = val(135);
 toframe();
-ref(expr) = val(1704);
-k = apply(-1); break;
+ref(expr) = val(521);
+k = apply(701); break;
+label(701);
+if (ref(expr) != nil) {
+ref(expr) = val(3475);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3475) = ref(expr);
+} else {
+ref(expr) = nil;
+}
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2197;
+ref(expr) = 1194;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = nil;
-toframe();
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(410); break;
-label(410);
-toframe();
-ref(expr) = val(1210);
-k = apply(411); break;
-label(411);
-newframe();
-ref(expr) = 2006;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2202;
+ref(expr) = 2449;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+pushval(496);
+goto(702);
+label(703);
+bind(3548);
+label(704);
+ref(expr) = val(600);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = nil;
+ref(expr) = val(600);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3546);
+k = apply(705); break;
+label(705);
+ref(expr) = val(600);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(600) = poparg();
+goto(704);
+}
+unbind();
+k = retn(); break;
+label(702);
+ref(expr) = mkfun(703);
+val(496) = ref(expr);
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(183);
-k = apply(412); break;
-label(412);
-toframe();
-ref(expr) = val(1210);
-k = apply(413); break;
-label(413);
-newframe();
-ref(expr) = 2061;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = val(496);
+k = apply(706); break;
+label(706);
+popval(496);
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2208;
+ref(expr) = 1201;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 newframe();
-ref(expr) = nil;
-toframe();
-newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(183);
-k = apply(414); break;
-label(414);
-toframe();
-ref(expr) = val(1210);
-k = apply(415); break;
-label(415);
-newframe();
-ref(expr) = 2225;
-toframe();
-ref(expr) = val(1197);
+ref(expr) = val(3546);
 k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2231;
+ref(expr) = 2455;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+pushval(496);
+goto(707);
+label(708);
+bind(3549);
+label(709);
+ref(expr) = val(409);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = nil;
+ref(expr) = val(409);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3531);
+k = apply(710); break;
+label(710);
+ref(expr) = val(409);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(409) = poparg();
+goto(709);
+}
+unbind();
+k = retn(); break;
+label(707);
+ref(expr) = mkfun(708);
+val(496) = ref(expr);
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(183);
-k = apply(416); break;
-label(416);
-toframe();
-ref(expr) = val(1210);
-k = apply(417); break;
-label(417);
+ref(expr) = val(496);
+k = apply(711); break;
+label(711);
+popval(496);
 newframe();
-ref(expr) = 2248;
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(3546);
 k = apply(-1); break;
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2254;
+ref(expr) = 2466;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = nil;
-toframe();
-newframe();
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(418); break;
-label(418);
-toframe();
-ref(expr) = val(1210);
-k = apply(419); break;
-label(419);
-newframe();
-ref(expr) = 2267;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+pusharg();
+val(135) = poparg();
+goto(700);
 } else {
-newframe();
-ref(expr) = 2270;
-toframe();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-toframe();
-ref(expr) = val(442);
-k = apply(420); break;
-label(420);
+ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(1774);
+ref(expr) = val(3546);
 k = apply(-1); break;
 } else {
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
-push();
-ref(expr) = 2277;
-ref(expr2) = pop();
-ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
 newframe();
-ref(expr) = 2298;
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(3546);
 k = apply(-1); break;
+}
+}
+}
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(698);
+ref(expr) = mkfun(699);
+val(3531) = ref(expr);
+goto(712);
+label(713);
+bind(3550);
+label(714);
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
 } else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2306;
+ref(expr) = 1201;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
+} else {
+ref(expr) = nil;
+}
+}
+unbind();
+k = retn(); break;
+label(712);
+ref(expr) = mkfun(713);
+val(1375) = ref(expr);
+goto(715);
+label(716);
+bind(3551);
+label(717);
 ref(expr) = val(135);
-toframe();
-ref(expr) = val(1811);
-k = apply(421); break;
-label(421);
-newframe();
-ref(expr) = 2335;
-toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
 } else {
+ref(expr) = nil;
+push();
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 push();
-ref(expr) = 2343;
+ref(expr) = 2466;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = nil;
+push();
 newframe();
 ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1811);
-k = apply(422); break;
-label(422);
+ref(expr) = val(1375);
+k = apply(718); break;
+label(718);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = nil;
+push();
 newframe();
-ref(expr) = 2372;
+ref(expr) = val(3457);
 toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-} else {
 ref(expr) = val(135);
-if (symbolic()) car_err();
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(521);
+k = apply(719); break;
+label(719);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(715);
+ref(expr) = mkfun(716);
+val(3556) = ref(expr);
+goto(720);
+label(721);
+bind(3557);
+label(722);
+ref(expr) = nil;
 push();
-ref(expr) = 2380;
+ref(expr) = val(909);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = nil;
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3556);
+k = apply(723); break;
+label(723);
+if (ref(expr) != nil) {
+ref(expr) = val(3480);
+push();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(3480) = ref(expr);
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(722);
+} else {
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(722);
+}
+}
+unbind();
+k = retn(); break;
+label(720);
+ref(expr) = mkfun(721);
+val(3567) = ref(expr);
+goto(724);
+label(725);
+bind(3568);
+label(726);
+ref(expr) = nil;
+push();
+ref(expr) = val(691);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(423); break;
-label(423);
+ref(expr) = val(1727);
 toframe();
-ref(expr) = val(1210);
-k = apply(424); break;
-label(424);
-newframe();
-ref(expr) = 2399;
+ref(expr) = val(691);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = val(521);
+k = apply(727); break;
+label(727);
+if (ref(expr) != nil) {
+ref(expr) = val(691);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(691) = poparg();
+goto(726);
 } else {
 newframe();
-ref(expr) = val(135);
-if (symbolic()) car_err();
+ref(expr) = val(3453);
+toframe();
+ref(expr) = val(691);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
-ref(expr) = atomic()? true: nil;
 toframe();
-ref(expr) = val(266);
-k = apply(425); break;
-label(425);
+ref(expr) = val(521);
+k = apply(728); break;
+label(728);
 if (ref(expr) != nil) {
+ref(expr) = val(691);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(691) = poparg();
+goto(726);
+} else {
 newframe();
-ref(expr) = nil;
+ref(expr) = val(3462);
 toframe();
-ref(expr) = val(135);
+ref(expr) = val(691);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1510);
-k = apply(-1); break;
+ref(expr) = val(521);
+k = apply(729); break;
+label(729);
+if (ref(expr) != nil) {
+ref(expr) = val(691);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(691) = poparg();
+goto(726);
 } else {
 newframe();
-ref(expr) = val(1200);
+ref(expr) = val(3475);
 toframe();
-ref(expr) = val(135);
+ref(expr) = val(691);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1510);
-k = apply(-1); break;
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
-}
+ref(expr) = val(521);
+k = apply(730); break;
+label(730);
+if (ref(expr) != nil) {
+ref(expr) = val(691);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(691) = poparg();
+goto(726);
+} else {
+ref(expr) = val(1727);
+push();
+ref(expr) = val(691);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1727) = ref(expr);
+ref(expr) = val(691);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(691) = poparg();
+goto(726);
 }
 }
 }
@@ -4849,3779 +8166,5277 @@ k = apply(-1); break;
 }
 unbind();
 k = retn(); break;
-label(388);
-ref(expr) = mkfun(389);
-val(1210) = ref(expr);
-goto(426);
-label(427);
-bind(0);
-newframe();
-ref(expr) = val(1197);
-k = apply(428); break;
-label(428);
-newframe();
-ref(expr) = 2441;
-toframe();
-ref(expr) = val(1197);
-k = apply(429); break;
-label(429);
-newframe();
-ref(expr) = val(1197);
-k = apply(430); break;
-label(430);
-newframe();
-ref(expr) = 2458;
-toframe();
-ref(expr) = val(1197);
-k = apply(431); break;
-label(431);
-newframe();
-ref(expr) = 2465;
-toframe();
-ref(expr) = val(1197);
-k = apply(432); break;
-label(432);
-newframe();
-ref(expr) = 2474;
-toframe();
-ref(expr) = val(1197);
-k = apply(433); break;
-label(433);
+label(724);
+ref(expr) = mkfun(725);
+val(3580) = ref(expr);
+goto(731);
+label(732);
+bind(3582);
+label(733);
+ref(expr) = nil;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = true;
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = 2499;
+ref(expr) = val(762);
 toframe();
-ref(expr) = val(1197);
-k = apply(434); break;
-label(434);
-newframe();
-ref(expr) = 2507;
+ref(expr) = val(135);
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(521);
 k = apply(-1); break;
-unbind();
-k = retn(); break;
-label(426);
-ref(expr) = mkfun(427);
-val(2514) = ref(expr);
-goto(435);
-label(436);
-bind(0);
-newframe();
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(437);
-label(438);
-bind(2519);
-ref(expr) = nil;
+} else {
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
-ref(expr) = val(2518);
+ref(expr) = 1194;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = 970;
-toframe();
-newframe();
-ref(expr) = val(333);
+ref(expr) = val(3491);
 toframe();
-ref(expr) = val(1088);
-k = apply(439); break;
-label(439);
-toframe();
-ref(expr) = 2534;
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
+ref(expr) = val(521);
+k = apply(734); break;
+label(734);
+if (ref(expr) != nil) {
+pushval(496);
+goto(735);
+label(736);
+bind(3583);
+label(737);
+ref(expr) = nil;
+push();
+ref(expr) = val(412);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 } else {
 newframe();
-newframe();
-ref(expr) = nil;
-toframe();
-ref(expr) = val(333);
+ref(expr) = val(762);
 toframe();
-ref(expr) = val(2518);
-if (symbolic()) car_err();
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1142);
-k = apply(440); break;
-label(440);
-toframe();
-ref(expr) = val(2518);
-if (symbolic()) cdr_err();
+ref(expr) = val(3591);
+k = apply(738); break;
+label(738);
+if (ref(expr) != nil) {
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
+pusharg();
+val(412) = poparg();
+goto(737);
+} else {
+ref(expr) = nil;
+}
 }
 unbind();
 k = retn(); break;
-label(437);
-ref(expr) = mkfun(438);
-val(417) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(735);
+ref(expr) = mkfun(736);
+val(496) = ref(expr);
 newframe();
-ref(expr) = val(1012);
-toframe();
-ref(expr) = val(1110);
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(417);
-k = apply(441); break;
-label(441);
-unbind();
-pop();
+ref(expr) = val(496);
+k = apply(739); break;
+label(739);
+popval(496);
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+}
 unbind();
 k = retn(); break;
-label(435);
-ref(expr) = mkfun(436);
-val(2546) = ref(expr);
-goto(442);
-label(443);
-bind(2547);
-ref(expr) = val(133);
+label(731);
+ref(expr) = mkfun(732);
+val(3591) = ref(expr);
+goto(740);
+label(741);
+bind(3593);
+label(742);
+ref(expr) = val(135);
 push();
-ref(expr) = val(521);
+ref(expr) = val(762);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = 2552;
+ref(expr) = 642;
+} else {
+ref(expr) = val(135);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = 964;
 } else {
-ref(expr) = 968;
+ref(expr) = val(135);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 push();
-ref(expr) = val(521);
+ref(expr) = 1194;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = 2557;
+ref(expr) = 964;
 } else {
-ref(expr) = 920;
+pushval(496);
+goto(743);
+label(744);
+bind(3595);
+label(745);
+ref(expr) = nil;
 push();
-ref(expr) = val(521);
+ref(expr) = val(412);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-ref(expr) = 2562;
+ref(expr) = val(639);
 } else {
 newframe();
-newframe();
-ref(expr) = 123;
+ref(expr) = val(412);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = 968;
+ref(expr) = val(762);
 toframe();
-ref(expr) = val(521);
+ref(expr) = val(3600);
+k = apply(746); break;
+label(746);
+push();
+ref(expr) = val(639);
+ref(expr2) = pop();
+ref(expr) = arith('+');
+pusharg();
+ref(expr) = val(412);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(412) = poparg();
+val(639) = poparg();
+goto(745);
+}
+unbind();
+k = retn(); break;
+label(743);
+ref(expr) = mkfun(744);
+val(496) = ref(expr);
+newframe();
+ref(expr) = 964;
 toframe();
-ref(expr) = 968;
+ref(expr) = val(135);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = 117;
+ref(expr) = val(496);
+k = apply(747); break;
+label(747);
+popval(496);
+}
+}
+}
+unbind();
+k = retn(); break;
+label(740);
+ref(expr) = mkfun(741);
+val(3600) = ref(expr);
+goto(748);
+label(749);
+bind(3601);
+label(750);
+pushval(762);
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+val(762) = ref(expr);
+pushval(496);
+goto(751);
+label(752);
+bind(3602);
+label(753);
+ref(expr) = nil;
+push();
+ref(expr) = val(909);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(909);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+newframe();
+newframe();
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = 791;
+ref(expr) = val(3600);
+k = apply(754); break;
+label(754);
 toframe();
-ref(expr) = val(256);
-k = apply(444); break;
-label(444);
+ref(expr) = 642;
 toframe();
-ref(expr) = val(688);
-k = apply(-1); break;
+ref(expr) = val(512);
+k = apply(755); break;
+label(755);
+if (ref(expr) != nil) {
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(753);
+} else {
+ref(expr) = nil;
 }
 }
 }
 unbind();
 k = retn(); break;
-label(442);
-ref(expr) = mkfun(443);
-val(2567) = ref(expr);
-goto(445);
-label(446);
-bind(0);
+label(751);
+ref(expr) = mkfun(752);
+val(496) = ref(expr);
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
+ref(expr) = val(762);
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+push();
+ref(expr) = val(762);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = cons3(2572, val(2572), 0);
+ref(expr) = val(762);
 toframe();
-goto(447);
-label(448);
-bind(2573);
-newframe();
-ref(expr) = cons3(135, val(135), 0);
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3591);
+k = apply(756); break;
+label(756);
+} else {
+ref(expr) = nil;
+}
+} else {
+ref(expr) = nil;
+push();
 newframe();
-newframe();
-ref(expr) = val(570);
-toframe();
-ref(expr) = val(177);
-k = apply(449); break;
-label(449);
+ref(expr) = val(762);
 toframe();
-ref(expr) = val(1088);
-k = apply(450); break;
-label(450);
-val(135) = ref(expr);
-ref(expr) = cons3(333, val(333), 0);
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3591);
+k = apply(757); break;
+label(757);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = nil;
+} else {
 newframe();
-ref(expr) = val(570);
+ref(expr) = val(762);
 toframe();
-ref(expr) = val(244);
-k = apply(451); break;
-label(451);
-if (symbolic()) car_err();
+ref(expr) = val(496);
+k = apply(758); break;
+label(758);
+if (ref(expr) != nil) {
+} else {
+ref(expr) = nil;
+}
+}
+}
+}
+}
+popval(496);
+popval(762);
+unbind();
+k = retn(); break;
+label(748);
+ref(expr) = mkfun(749);
+val(3613) = ref(expr);
+goto(759);
+label(760);
+bind(3614);
+label(761);
+ref(expr) = nil;
+push();
+ref(expr) = val(909);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+} else {
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 ref(expr) = atomic()? true: nil;
 if (ref(expr) != nil) {
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(761);
+} else {
+ref(expr) = nil;
+push();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = 2466;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(761);
+} else {
 newframe();
-newframe();
-ref(expr) = val(570);
+ref(expr) = val(3457);
 toframe();
-ref(expr) = val(244);
-k = apply(452); break;
-label(452);
-if (symbolic()) car_err();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(2567);
-k = apply(453); break;
-label(453);
+ref(expr) = val(521);
+k = apply(762); break;
+label(762);
+if (ref(expr) != nil) {
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(761);
 } else {
 newframe();
-newframe();
-ref(expr) = val(570);
-toframe();
-ref(expr) = val(244);
-k = apply(454); break;
-label(454);
-if (symbolic()) car_err();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
 ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1088);
-k = apply(455); break;
-label(455);
-}
-val(333) = ref(expr);
-ref(expr) = cons3(828, val(828), 0);
-toframe();
-newframe();
-newframe();
+ref(expr) = val(1375);
+k = apply(763); break;
+label(763);
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = val(570);
-toframe();
-ref(expr) = val(244);
-k = apply(456); break;
-label(456);
-toframe();
-ref(expr) = val(183);
-k = apply(457); break;
-label(457);
-toframe();
-ref(expr) = val(1088);
-k = apply(458); break;
-label(458);
-val(828) = ref(expr);
-ref(expr) = cons3(643, val(643), 0);
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
+ref(expr) = val(3613);
+k = apply(764); break;
+label(764);
+if (ref(expr) != nil) {
+ref(expr) = val(1784);
+push();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+push();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1784) = ref(expr);
+} else {
+ref(expr) = nil;
+}
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(761);
+} else {
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr) = atomic()? true: nil;
+if (ref(expr) != nil) {
+pushval(760);
 newframe();
-ref(expr) = val(570);
+ref(expr) = val(1784);
 toframe();
-ref(expr) = val(216);
-k = apply(459); break;
-label(459);
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+toframe();
+ref(expr) = val(529);
+k = apply(765); break;
+label(765);
+val(760) = ref(expr);
+ref(expr) = val(760);
 if (ref(expr) != nil) {
-ref(expr) = 1640;
+ref(expr) = val(1784);
+push();
+ref(expr) = val(760);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+push();
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+val(1784) = ref(expr);
 } else {
-ref(expr) = 773;
-}
-val(643) = ref(expr);
 ref(expr) = nil;
-toframe();
+}
+popval(760);
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(761);
+} else {
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(761);
+}
+}
+}
+}
+}
+}
+unbind();
+k = retn(); break;
+label(759);
+ref(expr) = mkfun(760);
+val(3627) = ref(expr);
+goto(766);
+label(767);
+bind(3628);
+label(768);
 newframe();
-ref(expr) = 970;
-toframe();
-ref(expr) = val(643);
-toframe();
-ref(expr) = 2578;
-toframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = 2583;
-toframe();
-ref(expr) = 2586;
-toframe();
-ref(expr) = val(828);
+ref(expr) = val(909);
 toframe();
-ref(expr) = 2578;
+ref(expr) = val(3518);
+k = apply(769); break;
+label(769);
+newframe();
+ref(expr) = val(909);
 toframe();
-ref(expr) = val(135);
+ref(expr) = val(3546);
+k = apply(770); break;
+label(770);
+newframe();
+ref(expr) = val(909);
 toframe();
-ref(expr) = 2591;
+ref(expr) = val(3567);
+k = apply(771); break;
+label(771);
+newframe();
+ref(expr) = val(3470);
 toframe();
-ref(expr) = 2586;
+ref(expr) = val(3580);
+k = apply(772); break;
+label(772);
+newframe();
+ref(expr) = val(1727);
 toframe();
-ref(expr) = val(333);
+newframe();
+ref(expr) = val(3480);
 toframe();
-ref(expr) = 2578;
+ref(expr) = val(146);
 toframe();
-ref(expr) = val(135);
+ref(expr) = val(552);
+k = apply(773); break;
+label(773);
 toframe();
-ref(expr) = 2596;
+ref(expr) = val(489);
+k = apply(774); break;
+label(774);
+val(1727) = ref(expr);
+newframe();
+ref(expr) = val(909);
 toframe();
-ref(expr) = val(1197);
-k = apply(460); break;
-label(460);
-unbind();
-pop();
+ref(expr) = val(3627);
+k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(447);
-ref(expr) = mkfun(448);
-val(2572) = ref(expr);
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(461);
-label(462);
-bind(2597);
+label(766);
+ref(expr) = mkfun(767);
+val(3636) = ref(expr);
+goto(775);
+label(776);
+bind(0);
+label(777);
+newframe();
+ref(expr) = val(1170);
+k = apply(778); break;
+label(778);
+newframe();
+ref(expr) = 3117;
+toframe();
+ref(expr) = val(1170);
+k = apply(779); break;
+label(779);
+newframe();
+ref(expr) = val(1170);
+k = apply(780); break;
+label(780);
+pushval(496);
+goto(781);
+label(782);
+bind(3637);
+label(783);
 ref(expr) = nil;
 push();
-ref(expr) = val(570);
+ref(expr) = val(918);
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
 } else {
 newframe();
-ref(expr) = val(570);
+ref(expr) = 3652;
 toframe();
-ref(expr) = val(2572);
-k = apply(463); break;
-label(463);
-newframe();
-ref(expr) = val(570);
-if (symbolic()) cdr_err();
+ref(expr) = val(918);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+if (numeric() || symbolic()) cdr_err();
 ref(expr) = cdr[ref(expr)];
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
+ref(expr) = 1578;
+toframe();
+ref(expr) = val(1170);
+k = apply(784); break;
+label(784);
+ref(expr) = val(918);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(918) = poparg();
+goto(783);
 }
 unbind();
 k = retn(); break;
-label(461);
-ref(expr) = mkfun(462);
-val(417) = ref(expr);
-ref(expr) = nil;
-toframe();
+label(781);
+ref(expr) = mkfun(782);
+val(496) = ref(expr);
 newframe();
-ref(expr) = val(1094);
+ref(expr) = val(1035);
 toframe();
-ref(expr) = val(417);
-k = apply(464); break;
-label(464);
-unbind();
-pop();
+ref(expr) = val(496);
+k = apply(785); break;
+label(785);
+popval(496);
 unbind();
 k = retn(); break;
-label(445);
-ref(expr) = mkfun(446);
-val(2608) = ref(expr);
-goto(465);
-label(466);
+label(775);
+ref(expr) = mkfun(776);
+val(3661) = ref(expr);
+goto(786);
+label(787);
 bind(0);
+label(788);
 newframe();
-ref(expr) = 2616;
-toframe();
-ref(expr) = val(1197);
-k = apply(467); break;
-label(467);
-newframe();
-ref(expr) = 2619;
-toframe();
-ref(expr) = val(1197);
-k = apply(468); break;
-label(468);
-newframe();
-ref(expr) = val(1197);
-k = apply(469); break;
-label(469);
+ref(expr) = val(1170);
+k = apply(789); break;
+label(789);
 newframe();
-ref(expr) = 2638;
+ref(expr) = 3693;
 toframe();
-ref(expr) = val(1197);
-k = apply(470); break;
-label(470);
+ref(expr) = val(1170);
+k = apply(790); break;
+label(790);
 newframe();
-ref(expr) = cons3(153, val(153), 0);
+ref(expr) = 3696;
 toframe();
+ref(expr) = val(1170);
+k = apply(791); break;
+label(791);
+pushval(496);
+goto(792);
+label(793);
+bind(3697);
+label(794);
+ref(expr) = val(918);
+push();
+ref(expr) = val(1017);
+ref(expr2) = pop();
+ref(expr) = arith('<');
+if (ref(expr) != nil) {
+} else {
 newframe();
-ref(expr) = val(1103);
+ref(expr) = 3699;
 toframe();
-goto(471);
-label(472);
-bind(2639);
-newframe();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
+ref(expr) = val(918);
 toframe();
-ref(expr) = val(146);
+ref(expr) = 760;
 toframe();
-ref(expr) = val(473);
-k = apply(473); break;
-label(473);
+ref(expr) = val(1170);
+k = apply(795); break;
+label(795);
+ref(expr) = 642;
 push();
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr) = val(918);
 ref(expr2) = pop();
-ref(expr) = cons3(ref(expr), ref(expr2), 0);
+ref(expr) = arith('+');
+pusharg();
+val(918) = poparg();
+goto(794);
+}
 unbind();
 k = retn(); break;
-label(471);
-ref(expr) = mkfun(472);
-toframe();
-ref(expr) = val(473);
-k = apply(474); break;
-label(474);
-val(153) = ref(expr);
-ref(expr) = nil;
-toframe();
-newframe();
-ref(expr) = 970;
-toframe();
+label(792);
+ref(expr) = mkfun(793);
+val(496) = ref(expr);
 newframe();
-newframe();
-ref(expr) = val(153);
-toframe();
-ref(expr) = val(1179);
-k = apply(475); break;
-label(475);
+ref(expr) = 642;
 toframe();
-ref(expr) = val(1088);
-k = apply(476); break;
-label(476);
-toframe();
-ref(expr) = 2654;
-toframe();
-ref(expr) = val(1197);
-k = apply(477); break;
-label(477);
-unbind();
-pop();
-newframe();
-ref(expr) = val(2546);
-k = apply(478); break;
-label(478);
+ref(expr) = val(496);
+k = apply(796); break;
+label(796);
+popval(496);
 newframe();
-ref(expr) = val(2608);
-k = apply(479); break;
-label(479);
-newframe();
-ref(expr) = 1281;
+ref(expr) = 3702;
 toframe();
-ref(expr) = val(1197);
-k = apply(-1); break;
-unbind();
-k = retn(); break;
-label(465);
-ref(expr) = mkfun(466);
-val(2661) = ref(expr);
-goto(480);
-label(481);
-bind(0);
+ref(expr) = val(1170);
+k = apply(797); break;
+label(797);
 newframe();
-ref(expr) = 2698;
-toframe();
-ref(expr) = val(1197);
-k = apply(482); break;
-label(482);
+ref(expr) = val(1170);
+k = apply(798); break;
+label(798);
 newframe();
-ref(expr) = val(1094);
+ref(expr) = 3134;
 toframe();
-goto(483);
-label(484);
-bind(2699);
-newframe();
+ref(expr) = val(1170);
+k = apply(799); break;
+label(799);
 newframe();
-ref(expr) = val(135);
-if (symbolic()) car_err();
-ref(expr) = car[ref(expr)];
+ref(expr) = 3717;
 toframe();
-ref(expr) = val(1088);
-k = apply(485); break;
-label(485);
-toframe();
-ref(expr) = val(595);
-k = apply(486); break;
-label(486);
+ref(expr) = val(1170);
+k = apply(800); break;
+label(800);
 newframe();
-ref(expr) = 567;
+ref(expr) = 3150;
 toframe();
-ref(expr) = val(595);
-k = apply(487); break;
-label(487);
-newframe();
+ref(expr) = val(1170);
+k = apply(801); break;
+label(801);
 newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(183);
-k = apply(488); break;
-label(488);
-if (ref(expr) != nil) {
-ref(expr) = 333;
-} else {
-ref(expr) = 776;
-}
-toframe();
-ref(expr) = val(595);
-k = apply(489); break;
-label(489);
+ref(expr) = val(1177);
+k = apply(802); break;
+label(802);
 newframe();
-ref(expr) = 567;
+ref(expr) = 1304;
 toframe();
-ref(expr) = val(595);
-k = apply(490); break;
-label(490);
+ref(expr) = val(1170);
+k = apply(803); break;
+label(803);
 newframe();
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(223);
-k = apply(491); break;
-label(491);
-ref(expr) = atomic()? true: nil;
+ref(expr) = val(3315);
+k = apply(-1); break;
+unbind();
+k = retn(); break;
+label(786);
+ref(expr) = mkfun(787);
+val(3726) = ref(expr);
+goto(804);
+label(805);
+bind(3727);
+label(806);
+ref(expr) = nil;
+push();
+ref(expr) = val(909);
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
 if (ref(expr) != nil) {
-newframe();
-ref(expr) = val(135);
-toframe();
-ref(expr) = val(223);
-k = apply(492); break;
-label(492);
 } else {
 newframe();
-newframe();
-ref(expr) = val(135);
+ref(expr) = nil;
 toframe();
-ref(expr) = val(223);
-k = apply(493); break;
-label(493);
+ref(expr) = val(909);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
 toframe();
-ref(expr) = val(1088);
-k = apply(494); break;
-label(494);
+ref(expr) = val(1233);
+k = apply(807); break;
+label(807);
+ref(expr) = val(909);
+if (numeric() || symbolic()) cdr_err();
+ref(expr) = cdr[ref(expr)];
+pusharg();
+val(909) = poparg();
+goto(806);
 }
+unbind();
+k = retn(); break;
+label(804);
+ref(expr) = mkfun(805);
+val(3739) = ref(expr);
+goto(808);
+label(809);
+bind(3740);
+label(810);
+newframe();
+ref(expr) = val(3480);
+toframe();
+goto(811);
+label(812);
+bind(3741);
+newframe();
+ref(expr) = val(1053);
+k = apply(813); break;
+label(813);
+push();
+ref(expr) = val(935);
+if (numeric() || symbolic()) car_err();
+ref(expr) = car[ref(expr)];
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+unbind();
+k = retn(); break;
+label(811);
+ref(expr) = mkfun(812);
 toframe();
-ref(expr) = val(595);
-k = apply(495); break;
-label(495);
-newframe();
-ref(expr) = 567;
-toframe();
-ref(expr) = val(595);
-k = apply(496); break;
-label(496);
-newframe();
+ref(expr) = val(552);
+k = apply(814); break;
+label(814);
+val(1035) = ref(expr);
 newframe();
+ref(expr) = val(3661);
+k = apply(815); break;
+label(815);
+ref(expr) = true;
+val(1025) = ref(expr);
 newframe();
-ref(expr) = val(135);
-if (symbolic()) cdr_err();
-ref(expr) = cdr[ref(expr)];
-toframe();
-ref(expr) = val(223);
-k = apply(497); break;
-label(497);
+ref(expr) = val(909);
 toframe();
-ref(expr) = val(1088);
-k = apply(498); break;
-label(498);
-toframe();
-ref(expr) = val(595);
-k = apply(499); break;
-label(499);
+ref(expr) = val(3739);
+k = apply(816); break;
+label(816);
+ref(expr) = nil;
+val(1025) = ref(expr);
 newframe();
-ref(expr) = val(536);
+ref(expr) = val(3726);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(483);
-ref(expr) = mkfun(484);
-toframe();
-ref(expr) = val(473);
-k = apply(500); break;
-label(500);
+label(808);
+ref(expr) = mkfun(809);
+val(3750) = ref(expr);
+goto(817);
+label(818);
+bind(0);
+label(819);
+pushval(496);
+goto(820);
+label(821);
+bind(3752);
+label(822);
+ref(expr) = val(135);
+push();
+ref(expr) = 3758;
+ref(expr2) = pop();
+ref(expr) = ref(expr) == ref(expr2)? true: nil;
+if (ref(expr) != nil) {
 newframe();
-ref(expr) = 2736;
+ref(expr) = val(909);
 toframe();
-ref(expr) = val(1197);
+ref(expr) = val(480);
 k = apply(-1); break;
+} else {
+ref(expr) = val(909);
+push();
+ref(expr) = val(135);
+ref(expr2) = pop();
+ref(expr) = cons3(ref(expr), ref(expr2), 0);
+pusharg();
+newframe();
+ref(expr) = val(963);
+k = apply(823); break;
+label(823);
+pusharg();
+val(135) = poparg();
+val(909) = poparg();
+goto(822);
+}
 unbind();
 k = retn(); break;
-label(480);
-ref(expr) = mkfun(481);
-val(2746) = ref(expr);
-goto(501);
-label(502);
-bind(0);
-newframe();
-ref(expr) = val(2514);
-k = apply(503); break;
-label(503);
-newframe();
-ref(expr) = cons3(417, val(417), 0);
-toframe();
-goto(504);
-label(505);
-bind(2747);
+label(820);
+ref(expr) = mkfun(821);
+val(496) = ref(expr);
+pushval(135);
+newframe();
+ref(expr) = val(963);
+k = apply(824); break;
+label(824);
+val(135) = ref(expr);
+pushval(760);
 ref(expr) = val(135);
 push();
-ref(expr) = 2753;
+ref(expr) = 3769;
 ref(expr2) = pop();
 ref(expr) = ref(expr) == ref(expr2)? true: nil;
-if (ref(expr) != nil) {
-} else {
+val(760) = ref(expr);
+pushval(909);
 newframe();
 ref(expr) = nil;
 toframe();
+ref(expr) = val(760);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(963);
+k = apply(825); break;
+label(825);
+} else {
 ref(expr) = val(135);
+}
 toframe();
-ref(expr) = val(1210);
-k = apply(506); break;
-label(506);
+ref(expr) = val(496);
+k = apply(826); break;
+label(826);
+val(909) = ref(expr);
 newframe();
-newframe();
-ref(expr) = val(991);
-k = apply(507); break;
-label(507);
+ref(expr) = val(909);
 toframe();
-ref(expr) = val(417);
-k = apply(-1); break;
-}
-unbind();
-k = retn(); break;
-label(504);
-ref(expr) = mkfun(505);
-val(417) = ref(expr);
-ref(expr) = nil;
+ref(expr) = val(3636);
+k = apply(827); break;
+label(827);
+ref(expr) = val(760);
+if (ref(expr) != nil) {
+newframe();
+ref(expr) = val(909);
 toframe();
+ref(expr) = val(3750);
+k = apply(828); break;
+label(828);
+} else {
 newframe();
+ref(expr) = val(3190);
+k = apply(829); break;
+label(829);
 newframe();
-ref(expr) = val(991);
-k = apply(508); break;
-label(508);
+ref(expr) = val(909);
 toframe();
-ref(expr) = val(417);
-k = apply(509); break;
-label(509);
-unbind();
-pop();
+ref(expr) = val(3739);
+k = apply(830); break;
+label(830);
 newframe();
-ref(expr) = val(2661);
-k = apply(510); break;
-label(510);
+ref(expr) = val(3322);
+k = apply(831); break;
+label(831);
+}
+popval(909);
+popval(760);
+popval(135);
+popval(496);
 newframe();
-ref(expr) = val(2746);
+ref(expr) = val(3448);
 k = apply(-1); break;
 unbind();
 k = retn(); break;
-label(501);
-ref(expr) = mkfun(502);
-val(2760) = ref(expr);
+label(817);
+ref(expr) = mkfun(818);
+val(3776) = ref(expr);
 newframe();
-ref(expr) = val(2760);
-k = apply(511); break;
-label(511);
+ref(expr) = val(3776);
+k = apply(832); break;
+label(832);
 return;
 }}
 
 void setup(void) {
-ref(symlis) = 3157;
-ref(oblist) = 3265;
-car[3265] = 136; cdr[3265] = 3264; tag[3265] = 0;
-car[3264] = 142; cdr[3264] = 3263; tag[3264] = 0;
-car[3263] = 147; cdr[3263] = 3262; tag[3263] = 0;
-car[3262] = 155; cdr[3262] = 3261; tag[3262] = 0;
-car[3261] = 162; cdr[3261] = 3260; tag[3261] = 0;
-car[3260] = 166; cdr[3260] = 3259; tag[3260] = 0;
-car[3259] = 172; cdr[3259] = 3258; tag[3259] = 0;
-car[3258] = 178; cdr[3258] = 3257; tag[3258] = 0;
-car[3257] = 184; cdr[3257] = 3256; tag[3257] = 0;
-car[3256] = 190; cdr[3256] = 3255; tag[3256] = 0;
-car[3255] = 196; cdr[3255] = 3254; tag[3255] = 0;
-car[3254] = 203; cdr[3254] = 3253; tag[3254] = 0;
-car[3253] = 210; cdr[3253] = 3252; tag[3253] = 0;
-car[3252] = 217; cdr[3252] = 3251; tag[3252] = 0;
-car[3251] = 224; cdr[3251] = 3250; tag[3251] = 0;
-car[3250] = 231; cdr[3250] = 3249; tag[3250] = 0;
-car[3249] = 238; cdr[3249] = 3248; tag[3249] = 0;
-car[3248] = 245; cdr[3248] = 3247; tag[3248] = 0;
-car[3247] = 257; cdr[3247] = 3246; tag[3247] = 0;
-car[3246] = 268; cdr[3246] = 3245; tag[3246] = 0;
-car[3245] = 299; cdr[3245] = 3244; tag[3245] = 0;
-car[3244] = 334; cdr[3244] = 3243; tag[3244] = 0;
-car[3243] = 342; cdr[3243] = 3242; tag[3243] = 0;
-car[3242] = 351; cdr[3242] = 3241; tag[3242] = 0;
-car[3241] = 361; cdr[3241] = 3240; tag[3241] = 0;
-car[3240] = 403; cdr[3240] = 3239; tag[3240] = 0;
-car[3239] = 412; cdr[3239] = 3238; tag[3239] = 0;
-car[3238] = 419; cdr[3238] = 3237; tag[3238] = 0;
-car[3237] = 427; cdr[3237] = 3236; tag[3237] = 0;
-car[3236] = 435; cdr[3236] = 3235; tag[3236] = 0;
-car[3235] = 444; cdr[3235] = 3234; tag[3235] = 0;
-car[3234] = 458; cdr[3234] = 3233; tag[3234] = 0;
-car[3233] = 466; cdr[3233] = 3232; tag[3233] = 0;
-car[3232] = 479; cdr[3232] = 3231; tag[3232] = 0;
-car[3231] = 482; cdr[3231] = 3230; tag[3231] = 0;
-car[3230] = 493; cdr[3230] = 3229; tag[3230] = 0;
-car[3229] = 499; cdr[3229] = 3228; tag[3229] = 0;
-car[3228] = 509; cdr[3228] = 3227; tag[3228] = 0;
-car[3227] = 511; cdr[3227] = 3226; tag[3227] = 0;
-car[3226] = 522; cdr[3226] = 3225; tag[3226] = 0;
-car[3225] = 537; cdr[3225] = 3224; tag[3225] = 0;
-car[3224] = 542; cdr[3224] = 3223; tag[3224] = 0;
-car[3223] = 551; cdr[3223] = 3222; tag[3223] = 0;
-car[3222] = 559; cdr[3222] = 3221; tag[3222] = 0;
-car[3221] = 568; cdr[3221] = 3220; tag[3221] = 0;
-car[3220] = 596; cdr[3220] = 3219; tag[3220] = 0;
-car[3219] = 604; cdr[3219] = 3218; tag[3219] = 0;
-car[3218] = 616; cdr[3218] = 3217; tag[3218] = 0;
-car[3217] = 624; cdr[3217] = 3216; tag[3217] = 0;
-car[3216] = 631; cdr[3216] = 3215; tag[3216] = 0;
-car[3215] = 641; cdr[3215] = 3214; tag[3215] = 0;
-car[3214] = 673; cdr[3214] = 3213; tag[3214] = 0;
-car[3213] = 680; cdr[3213] = 3212; tag[3213] = 0;
-car[3212] = 689; cdr[3212] = 3211; tag[3212] = 0;
-car[3211] = 698; cdr[3211] = 3210; tag[3211] = 0;
-car[3210] = 706; cdr[3210] = 3209; tag[3210] = 0;
-car[3209] = 713; cdr[3209] = 3208; tag[3209] = 0;
-car[3208] = 832; cdr[3208] = 3207; tag[3208] = 0;
-car[3207] = 842; cdr[3207] = 3206; tag[3207] = 0;
-car[3206] = 858; cdr[3206] = 3205; tag[3206] = 0;
-car[3205] = 867; cdr[3205] = 3204; tag[3205] = 0;
-car[3204] = 877; cdr[3204] = 3203; tag[3204] = 0;
-car[3203] = 880; cdr[3203] = 3202; tag[3203] = 0;
-car[3202] = 890; cdr[3202] = 3201; tag[3202] = 0;
-car[3201] = 930; cdr[3201] = 3200; tag[3201] = 0;
-car[3200] = 966; cdr[3200] = 3199; tag[3200] = 0;
-car[3199] = 996; cdr[3199] = 3198; tag[3199] = 0;
-car[3198] = 1003; cdr[3198] = 3197; tag[3198] = 0;
-car[3197] = 1013; cdr[3197] = 3196; tag[3197] = 0;
-car[3196] = 1022; cdr[3196] = 3195; tag[3196] = 0;
-car[3195] = 1028; cdr[3195] = 3194; tag[3195] = 0;
-car[3194] = 1058; cdr[3194] = 3193; tag[3194] = 0;
-car[3193] = 1064; cdr[3193] = 3192; tag[3193] = 0;
-car[3192] = 1067; cdr[3192] = 3191; tag[3192] = 0;
-car[3191] = 1096; cdr[3191] = 3190; tag[3191] = 0;
-car[3190] = 1111; cdr[3190] = 3189; tag[3190] = 0;
-car[3189] = 1132; cdr[3189] = 3188; tag[3189] = 0;
-car[3188] = 1143; cdr[3188] = 3187; tag[3188] = 0;
-car[3187] = 1145; cdr[3187] = 3186; tag[3187] = 0;
-car[3186] = 1156; cdr[3186] = 3185; tag[3186] = 0;
-car[3185] = 1157; cdr[3185] = 3184; tag[3185] = 0;
-car[3184] = 1167; cdr[3184] = 3183; tag[3184] = 0;
-car[3183] = 1180; cdr[3183] = 3182; tag[3183] = 0;
-car[3182] = 1192; cdr[3182] = 3181; tag[3182] = 0;
-car[3181] = 1202; cdr[3181] = 3180; tag[3181] = 0;
-car[3180] = 1221; cdr[3180] = 3179; tag[3180] = 0;
-car[3179] = 1282; cdr[3179] = 3178; tag[3179] = 0;
-car[3178] = 1291; cdr[3178] = 3177; tag[3178] = 0;
-car[3177] = 1344; cdr[3177] = 3176; tag[3177] = 0;
-car[3176] = 1432; cdr[3176] = 3175; tag[3176] = 0;
-car[3175] = 1445; cdr[3175] = 3174; tag[3175] = 0;
-car[3174] = 1511; cdr[3174] = 3173; tag[3174] = 0;
-car[3173] = 1512; cdr[3173] = 3172; tag[3173] = 0;
-car[3172] = 1596; cdr[3172] = 3171; tag[3172] = 0;
-car[3171] = 1650; cdr[3171] = 3170; tag[3171] = 0;
-car[3170] = 1705; cdr[3170] = 3169; tag[3170] = 0;
-car[3169] = 1741; cdr[3169] = 3168; tag[3169] = 0;
-car[3168] = 1775; cdr[3168] = 3167; tag[3168] = 0;
-car[3167] = 1813; cdr[3167] = 3166; tag[3167] = 0;
-car[3166] = 2192; cdr[3166] = 3165; tag[3166] = 0;
-car[3165] = 2270; cdr[3165] = 3164; tag[3165] = 0;
-car[3164] = 2519; cdr[3164] = 3163; tag[3164] = 0;
-car[3163] = 2547; cdr[3163] = 3162; tag[3163] = 0;
-car[3162] = 2573; cdr[3162] = 3161; tag[3162] = 0;
-car[3161] = 2597; cdr[3161] = 3160; tag[3161] = 0;
-car[3160] = 2639; cdr[3160] = 3159; tag[3160] = 0;
-car[3159] = 2699; cdr[3159] = 3158; tag[3159] = 0;
-car[3158] = 2747; cdr[3158] = 0; tag[3158] = 0;
-car[3157] = 3156; cdr[3157] = 3152; tag[3157] = 0;
-car[3156] = 3155; cdr[3156] = 3153; tag[3156] = 0;
-car[3155] = 3154; cdr[3155] = 0; tag[3155] = 0;
-car[3154] = u(']'); cdr[3154] = 0; tag[3154] = atomtag;
-car[3153] = 2578; cdr[3153] = 0; tag[3153] = 0;
-car[3152] = 3151; cdr[3152] = 3146; tag[3152] = 0;
-car[3151] = 3150; cdr[3151] = 3148; tag[3151] = 0;
+ref(symlis) = 4273;
+ref(oblist) = 4442;
+pool(4442);
+car[4442] = 136; cdr[4442] = 4441; tag[4442] = 0;
+car[4441] = 142; cdr[4441] = 4440; tag[4441] = 0;
+car[4440] = 147; cdr[4440] = 4439; tag[4440] = 0;
+car[4439] = 155; cdr[4439] = 4438; tag[4439] = 0;
+car[4438] = 162; cdr[4438] = 4437; tag[4438] = 0;
+car[4437] = 166; cdr[4437] = 4436; tag[4437] = 0;
+car[4436] = 172; cdr[4436] = 4435; tag[4436] = 0;
+car[4435] = 182; cdr[4435] = 4434; tag[4435] = 0;
+car[4434] = 189; cdr[4434] = 4433; tag[4434] = 0;
+car[4433] = 202; cdr[4433] = 4432; tag[4433] = 0;
+car[4432] = 210; cdr[4432] = 4431; tag[4432] = 0;
+car[4431] = 221; cdr[4431] = 4430; tag[4431] = 0;
+car[4430] = 233; cdr[4430] = 4429; tag[4430] = 0;
+car[4429] = 241; cdr[4429] = 4428; tag[4429] = 0;
+car[4428] = 251; cdr[4428] = 4427; tag[4428] = 0;
+car[4427] = 257; cdr[4427] = 4426; tag[4427] = 0;
+car[4426] = 263; cdr[4426] = 4425; tag[4426] = 0;
+car[4425] = 269; cdr[4425] = 4424; tag[4425] = 0;
+car[4424] = 275; cdr[4424] = 4423; tag[4424] = 0;
+car[4423] = 282; cdr[4423] = 4422; tag[4423] = 0;
+car[4422] = 289; cdr[4422] = 4421; tag[4422] = 0;
+car[4421] = 296; cdr[4421] = 4420; tag[4421] = 0;
+car[4420] = 303; cdr[4420] = 4419; tag[4420] = 0;
+car[4419] = 310; cdr[4419] = 4418; tag[4419] = 0;
+car[4418] = 317; cdr[4418] = 4417; tag[4418] = 0;
+car[4417] = 324; cdr[4417] = 4416; tag[4417] = 0;
+car[4416] = 336; cdr[4416] = 4415; tag[4416] = 0;
+car[4415] = 347; cdr[4415] = 4414; tag[4415] = 0;
+car[4414] = 378; cdr[4414] = 4413; tag[4414] = 0;
+car[4413] = 413; cdr[4413] = 4412; tag[4413] = 0;
+car[4412] = 421; cdr[4412] = 4411; tag[4412] = 0;
+car[4411] = 430; cdr[4411] = 4410; tag[4411] = 0;
+car[4410] = 440; cdr[4410] = 4409; tag[4410] = 0;
+car[4409] = 482; cdr[4409] = 4408; tag[4409] = 0;
+car[4408] = 491; cdr[4408] = 4407; tag[4408] = 0;
+car[4407] = 498; cdr[4407] = 4406; tag[4407] = 0;
+car[4406] = 506; cdr[4406] = 4405; tag[4406] = 0;
+car[4405] = 514; cdr[4405] = 4404; tag[4405] = 0;
+car[4404] = 523; cdr[4404] = 4403; tag[4404] = 0;
+car[4403] = 537; cdr[4403] = 4402; tag[4403] = 0;
+car[4402] = 545; cdr[4402] = 4401; tag[4402] = 0;
+car[4401] = 558; cdr[4401] = 4400; tag[4401] = 0;
+car[4400] = 561; cdr[4400] = 4399; tag[4400] = 0;
+car[4399] = 572; cdr[4399] = 4398; tag[4399] = 0;
+car[4398] = 578; cdr[4398] = 4397; tag[4398] = 0;
+car[4397] = 588; cdr[4397] = 4396; tag[4397] = 0;
+car[4396] = 590; cdr[4396] = 4395; tag[4396] = 0;
+car[4395] = 601; cdr[4395] = 4394; tag[4395] = 0;
+car[4394] = 616; cdr[4394] = 4393; tag[4394] = 0;
+car[4393] = 621; cdr[4393] = 4392; tag[4393] = 0;
+car[4392] = 630; cdr[4392] = 4391; tag[4392] = 0;
+car[4391] = 640; cdr[4391] = 4390; tag[4391] = 0;
+car[4390] = 641; cdr[4390] = 4389; tag[4390] = 0;
+car[4389] = 642; cdr[4389] = 4388; tag[4389] = 0;
+car[4388] = 645; cdr[4388] = 4387; tag[4388] = 0;
+car[4387] = 648; cdr[4387] = 4386; tag[4387] = 0;
+car[4386] = 651; cdr[4386] = 4385; tag[4386] = 0;
+car[4385] = 654; cdr[4385] = 4384; tag[4385] = 0;
+car[4384] = 657; cdr[4384] = 4383; tag[4384] = 0;
+car[4383] = 660; cdr[4383] = 4382; tag[4383] = 0;
+car[4382] = 663; cdr[4382] = 4381; tag[4382] = 0;
+car[4381] = 666; cdr[4381] = 4380; tag[4381] = 0;
+car[4380] = 678; cdr[4380] = 4379; tag[4380] = 0;
+car[4379] = 687; cdr[4379] = 4378; tag[4379] = 0;
+car[4378] = 713; cdr[4378] = 4377; tag[4378] = 0;
+car[4377] = 721; cdr[4377] = 4376; tag[4377] = 0;
+car[4376] = 733; cdr[4376] = 4375; tag[4376] = 0;
+car[4375] = 741; cdr[4375] = 4374; tag[4375] = 0;
+car[4374] = 748; cdr[4374] = 4373; tag[4374] = 0;
+car[4373] = 758; cdr[4373] = 4372; tag[4373] = 0;
+car[4372] = 782; cdr[4372] = 4371; tag[4372] = 0;
+car[4371] = 789; cdr[4371] = 4370; tag[4371] = 0;
+car[4370] = 798; cdr[4370] = 4369; tag[4370] = 0;
+car[4369] = 807; cdr[4369] = 4368; tag[4369] = 0;
+car[4368] = 815; cdr[4368] = 4367; tag[4368] = 0;
+car[4367] = 822; cdr[4367] = 4366; tag[4367] = 0;
+car[4366] = 863; cdr[4366] = 4365; tag[4366] = 0;
+car[4365] = 939; cdr[4365] = 4364; tag[4365] = 0;
+car[4364] = 949; cdr[4364] = 4363; tag[4364] = 0;
+car[4363] = 964; cdr[4363] = 4362; tag[4363] = 0;
+car[4362] = 981; cdr[4362] = 4361; tag[4362] = 0;
+car[4361] = 1059; cdr[4361] = 4360; tag[4361] = 0;
+car[4360] = 1070; cdr[4360] = 4359; tag[4360] = 0;
+car[4359] = 1072; cdr[4359] = 4358; tag[4359] = 0;
+car[4358] = 1083; cdr[4358] = 4357; tag[4358] = 0;
+car[4357] = 1084; cdr[4357] = 4356; tag[4357] = 0;
+car[4356] = 1094; cdr[4356] = 4355; tag[4356] = 0;
+car[4355] = 1102; cdr[4355] = 4354; tag[4355] = 0;
+car[4354] = 1103; cdr[4354] = 4353; tag[4354] = 0;
+car[4353] = 1113; cdr[4353] = 4352; tag[4353] = 0;
+car[4352] = 1129; cdr[4352] = 4351; tag[4352] = 0;
+car[4351] = 1142; cdr[4351] = 4350; tag[4351] = 0;
+car[4350] = 1154; cdr[4350] = 4349; tag[4350] = 0;
+car[4349] = 1155; cdr[4349] = 4348; tag[4349] = 0;
+car[4348] = 1171; cdr[4348] = 4347; tag[4348] = 0;
+car[4347] = 1178; cdr[4347] = 4346; tag[4347] = 0;
+car[4346] = 1180; cdr[4346] = 4345; tag[4346] = 0;
+car[4345] = 1188; cdr[4345] = 4344; tag[4345] = 0;
+car[4344] = 1208; cdr[4344] = 4343; tag[4344] = 0;
+car[4343] = 1225; cdr[4343] = 4342; tag[4343] = 0;
+car[4342] = 1244; cdr[4342] = 4341; tag[4342] = 0;
+car[4341] = 1305; cdr[4341] = 4340; tag[4341] = 0;
+car[4340] = 1314; cdr[4340] = 4339; tag[4340] = 0;
+car[4339] = 1470; cdr[4339] = 4338; tag[4339] = 0;
+car[4338] = 1506; cdr[4338] = 4337; tag[4338] = 0;
+car[4337] = 1539; cdr[4337] = 4336; tag[4337] = 0;
+car[4336] = 1600; cdr[4336] = 4335; tag[4336] = 0;
+car[4335] = 1612; cdr[4335] = 4334; tag[4335] = 0;
+car[4334] = 1675; cdr[4334] = 4333; tag[4334] = 0;
+car[4333] = 1720; cdr[4333] = 4332; tag[4333] = 0;
+car[4332] = 1729; cdr[4332] = 4331; tag[4332] = 0;
+car[4331] = 1730; cdr[4331] = 4330; tag[4331] = 0;
+car[4330] = 1731; cdr[4330] = 4329; tag[4330] = 0;
+car[4329] = 1750; cdr[4329] = 4328; tag[4329] = 0;
+car[4328] = 1776; cdr[4328] = 4327; tag[4328] = 0;
+car[4327] = 1785; cdr[4327] = 4326; tag[4327] = 0;
+car[4326] = 1795; cdr[4326] = 4325; tag[4326] = 0;
+car[4325] = 1796; cdr[4325] = 4324; tag[4325] = 0;
+car[4324] = 1803; cdr[4324] = 4323; tag[4324] = 0;
+car[4323] = 1811; cdr[4323] = 4322; tag[4323] = 0;
+car[4322] = 1820; cdr[4322] = 4321; tag[4322] = 0;
+car[4321] = 1822; cdr[4321] = 4320; tag[4321] = 0;
+car[4320] = 1940; cdr[4320] = 4319; tag[4320] = 0;
+car[4319] = 1953; cdr[4319] = 4318; tag[4319] = 0;
+car[4318] = 2012; cdr[4318] = 4317; tag[4318] = 0;
+car[4317] = 2013; cdr[4317] = 4316; tag[4317] = 0;
+car[4316] = 2053; cdr[4316] = 4315; tag[4316] = 0;
+car[4315] = 2069; cdr[4315] = 4314; tag[4315] = 0;
+car[4314] = 2123; cdr[4314] = 4313; tag[4314] = 0;
+car[4313] = 2178; cdr[4313] = 4312; tag[4313] = 0;
+car[4312] = 2214; cdr[4312] = 4311; tag[4312] = 0;
+car[4311] = 2250; cdr[4311] = 4310; tag[4311] = 0;
+car[4310] = 2314; cdr[4310] = 4309; tag[4310] = 0;
+car[4309] = 2349; cdr[4309] = 4308; tag[4309] = 0;
+car[4308] = 2813; cdr[4308] = 4307; tag[4308] = 0;
+car[4307] = 2891; cdr[4307] = 4306; tag[4307] = 0;
+car[4306] = 3195; cdr[4306] = 4305; tag[4306] = 0;
+car[4305] = 3223; cdr[4305] = 4304; tag[4305] = 0;
+car[4304] = 3253; cdr[4304] = 4303; tag[4304] = 0;
+car[4303] = 3284; cdr[4303] = 4302; tag[4303] = 0;
+car[4302] = 3342; cdr[4302] = 4301; tag[4302] = 0;
+car[4301] = 3401; cdr[4301] = 4300; tag[4301] = 0;
+car[4300] = 3485; cdr[4300] = 4299; tag[4300] = 0;
+car[4299] = 3492; cdr[4299] = 4298; tag[4299] = 0;
+car[4298] = 3503; cdr[4298] = 4297; tag[4298] = 0;
+car[4297] = 3519; cdr[4297] = 4296; tag[4297] = 0;
+car[4296] = 3520; cdr[4296] = 4295; tag[4296] = 0;
+car[4295] = 3521; cdr[4295] = 4294; tag[4295] = 0;
+car[4294] = 3547; cdr[4294] = 4293; tag[4294] = 0;
+car[4293] = 3548; cdr[4293] = 4292; tag[4293] = 0;
+car[4292] = 3549; cdr[4292] = 4291; tag[4292] = 0;
+car[4291] = 3550; cdr[4291] = 4290; tag[4291] = 0;
+car[4290] = 3551; cdr[4290] = 4289; tag[4290] = 0;
+car[4289] = 3557; cdr[4289] = 4288; tag[4289] = 0;
+car[4288] = 3568; cdr[4288] = 4287; tag[4288] = 0;
+car[4287] = 3582; cdr[4287] = 4286; tag[4287] = 0;
+car[4286] = 3583; cdr[4286] = 4285; tag[4286] = 0;
+car[4285] = 3593; cdr[4285] = 4284; tag[4285] = 0;
+car[4284] = 3595; cdr[4284] = 4283; tag[4284] = 0;
+car[4283] = 3601; cdr[4283] = 4282; tag[4283] = 0;
+car[4282] = 3602; cdr[4282] = 4281; tag[4282] = 0;
+car[4281] = 3614; cdr[4281] = 4280; tag[4281] = 0;
+car[4280] = 3628; cdr[4280] = 4279; tag[4280] = 0;
+car[4279] = 3637; cdr[4279] = 4278; tag[4279] = 0;
+car[4278] = 3697; cdr[4278] = 4277; tag[4278] = 0;
+car[4277] = 3727; cdr[4277] = 4276; tag[4277] = 0;
+car[4276] = 3740; cdr[4276] = 4275; tag[4276] = 0;
+car[4275] = 3741; cdr[4275] = 4274; tag[4275] = 0;
+car[4274] = 3752; cdr[4274] = 0; tag[4274] = 0;
+car[4273] = 4272; cdr[4273] = 4270; tag[4273] = 0;
+car[4272] = 3237; cdr[4272] = 4271; tag[4272] = 0;
+car[4271] = 3237; cdr[4271] = 0; tag[4271] = 0;
+car[4270] = 4269; cdr[4270] = 4267; tag[4270] = 0;
+car[4269] = 2770; cdr[4269] = 4268; tag[4269] = 0;
+car[4268] = 2770; cdr[4268] = 0; tag[4268] = 0;
+car[4267] = 4266; cdr[4267] = 4262; tag[4267] = 0;
+car[4266] = 2768; cdr[4266] = 4265; tag[4266] = 0;
+car[4265] = 3400; cdr[4265] = 4264; tag[4265] = 0;
+car[4264] = 3117; cdr[4264] = 4263; tag[4264] = 0;
+car[4263] = 2768; cdr[4263] = 0; tag[4263] = 0;
+car[4262] = 4261; cdr[4262] = 4259; tag[4262] = 0;
+car[4261] = 2766; cdr[4261] = 4260; tag[4261] = 0;
+car[4260] = 2766; cdr[4260] = 0; tag[4260] = 0;
+car[4259] = 4258; cdr[4259] = 4252; tag[4259] = 0;
+car[4258] = 3230; cdr[4258] = 4257; tag[4258] = 0;
+car[4257] = 3242; cdr[4257] = 4256; tag[4257] = 0;
+car[4256] = 3235; cdr[4256] = 4255; tag[4256] = 0;
+car[4255] = 3230; cdr[4255] = 4254; tag[4255] = 0;
+car[4254] = 3228; cdr[4254] = 4253; tag[4254] = 0;
+car[4253] = 2318; cdr[4253] = 0; tag[4253] = 0;
+car[4252] = 4251; cdr[4252] = 4248; tag[4252] = 0;
+car[4251] = 2216; cdr[4251] = 4250; tag[4251] = 0;
+car[4250] = 3273; cdr[4250] = 4249; tag[4250] = 0;
+car[4249] = 2216; cdr[4249] = 0; tag[4249] = 0;
+car[4248] = 4247; cdr[4248] = 4242; tag[4248] = 0;
+car[4247] = 4246; cdr[4247] = 4244; tag[4247] = 0;
+car[4246] = 4245; cdr[4246] = 0; tag[4246] = 0;
+car[4245] = u(']'); cdr[4245] = 0; tag[4245] = atomtag;
+car[4244] = 3265; cdr[4244] = 4243; tag[4244] = 0;
+car[4243] = 1837; cdr[4243] = 0; tag[4243] = 0;
+car[4242] = 4241; cdr[4242] = 4238; tag[4242] = 0;
+car[4241] = 3699; cdr[4241] = 4240; tag[4241] = 0;
+car[4240] = 3699; cdr[4240] = 4239; tag[4240] = 0;
+car[4239] = 1473; cdr[4239] = 0; tag[4239] = 0;
+car[4238] = 4237; cdr[4238] = 4232; tag[4238] = 0;
+car[4237] = 1304; cdr[4237] = 4236; tag[4237] = 0;
+car[4236] = 3702; cdr[4236] = 4235; tag[4236] = 0;
+car[4235] = 3306; cdr[4235] = 4234; tag[4235] = 0;
+car[4234] = 1304; cdr[4234] = 4233; tag[4234] = 0;
+car[4233] = 1294; cdr[4233] = 0; tag[4233] = 0;
+car[4232] = 4231; cdr[4232] = 4229; tag[4232] = 0;
+car[4231] = 921; cdr[4231] = 4230; tag[4231] = 0;
+car[4230] = 921; cdr[4230] = 0; tag[4230] = 0;
+car[4229] = 4228; cdr[4229] = 4221; tag[4229] = 0;
+car[4228] = 918; cdr[4228] = 4227; tag[4228] = 0;
+car[4227] = 2011; cdr[4227] = 4226; tag[4227] = 0;
+car[4226] = 1986; cdr[4226] = 4225; tag[4226] = 0;
+car[4225] = 1818; cdr[4225] = 4224; tag[4225] = 0;
+car[4224] = 1673; cdr[4224] = 4223; tag[4224] = 0;
+car[4223] = 1035; cdr[4223] = 4222; tag[4223] = 0;
+car[4222] = 918; cdr[4222] = 0; tag[4222] = 0;
+car[4221] = 4220; cdr[4221] = 4214; tag[4221] = 0;
+car[4220] = 912; cdr[4220] = 4219; tag[4220] = 0;
+car[4219] = 3194; cdr[4219] = 4218; tag[4219] = 0;
+car[4218] = 2312; cdr[4218] = 4217; tag[4218] = 0;
+car[4217] = 1029; cdr[4217] = 4216; tag[4217] = 0;
+car[4216] = 1013; cdr[4216] = 4215; tag[4216] = 0;
+car[4215] = 912; cdr[4215] = 0; tag[4215] = 0;
+car[4214] = 4213; cdr[4214] = 4205; tag[4214] = 0;
+car[4213] = 898; cdr[4213] = 4212; tag[4213] = 0;
+car[4212] = 3600; cdr[4212] = 4211; tag[4212] = 0;
+car[4211] = 2052; cdr[4211] = 4210; tag[4211] = 0;
+car[4210] = 1654; cdr[4210] = 4209; tag[4210] = 0;
+car[4209] = 1527; cdr[4209] = 4208; tag[4209] = 0;
+car[4208] = 1517; cdr[4208] = 4207; tag[4208] = 0;
+car[4207] = 1504; cdr[4207] = 4206; tag[4207] = 0;
+car[4206] = 898; cdr[4206] = 0; tag[4206] = 0;
+car[4205] = 4204; cdr[4205] = 4202; tag[4205] = 0;
+car[4204] = 889; cdr[4204] = 4203; tag[4204] = 0;
+car[4203] = 889; cdr[4203] = 0; tag[4203] = 0;
+car[4202] = 4201; cdr[4202] = 4199; tag[4202] = 0;
+car[4201] = 883; cdr[4201] = 4200; tag[4201] = 0;
+car[4200] = 883; cdr[4200] = 0; tag[4200] = 0;
+car[4199] = 4198; cdr[4199] = 4189; tag[4199] = 0;
+car[4198] = 762; cdr[4198] = 4197; tag[4198] = 0;
+car[4197] = 3693; cdr[4197] = 4196; tag[4197] = 0;
+car[4196] = 3462; cdr[4196] = 4195; tag[4196] = 0;
+car[4195] = 3341; cdr[4195] = 4194; tag[4195] = 0;
+car[4194] = 3134; cdr[4194] = 4193; tag[4194] = 0;
+car[4193] = 1578; cdr[4193] = 4192; tag[4193] = 0;
+car[4192] = 1411; cdr[4192] = 4191; tag[4192] = 0;
+car[4191] = 1313; cdr[4191] = 4190; tag[4191] = 0;
+car[4190] = 762; cdr[4190] = 0; tag[4190] = 0;
+car[4189] = 4188; cdr[4189] = 4169; tag[4189] = 0;
+car[4188] = 760; cdr[4188] = 4187; tag[4188] = 0;
+car[4187] = 3717; cdr[4187] = 4186; tag[4187] = 0;
+car[4186] = 3627; cdr[4186] = 4185; tag[4186] = 0;
+car[4185] = 3580; cdr[4185] = 4184; tag[4185] = 0;
+car[4184] = 3567; cdr[4184] = 4183; tag[4184] = 0;
+car[4183] = 3175; cdr[4183] = 4182; tag[4183] = 0;
+car[4182] = 1885; cdr[4182] = 4181; tag[4182] = 0;
+car[4181] = 1719; cdr[4181] = 4180; tag[4181] = 0;
+car[4180] = 1712; cdr[4180] = 4179; tag[4180] = 0;
+car[4179] = 1702; cdr[4179] = 4178; tag[4179] = 0;
+car[4178] = 1610; cdr[4178] = 4177; tag[4178] = 0;
+car[4177] = 1537; cdr[4177] = 4176; tag[4177] = 0;
+car[4176] = 1391; cdr[4176] = 4175; tag[4176] = 0;
+car[4175] = 1348; cdr[4175] = 4174; tag[4175] = 0;
+car[4174] = 1177; cdr[4174] = 4173; tag[4174] = 0;
+car[4173] = 1025; cdr[4173] = 4172; tag[4173] = 0;
+car[4172] = 760; cdr[4172] = 4171; tag[4172] = 0;
+car[4171] = 753; cdr[4171] = 4170; tag[4171] = 0;
+car[4170] = 747; cdr[4170] = 0; tag[4170] = 0;
+car[4169] = 4168; cdr[4169] = 4140; tag[4169] = 0;
+car[4168] = 902; cdr[4168] = 4167; tag[4168] = 0;
+car[4167] = 3591; cdr[4167] = 4166; tag[4167] = 0;
+car[4166] = 3546; cdr[4166] = 4165; tag[4166] = 0;
+car[4165] = 3531; cdr[4165] = 4164; tag[4165] = 0;
+car[4164] = 3518; cdr[4164] = 4163; tag[4164] = 0;
+car[4163] = 3508; cdr[4163] = 4162; tag[4163] = 0;
+car[4162] = 3502; cdr[4162] = 4161; tag[4162] = 0;
+car[4161] = 3453; cdr[4161] = 4160; tag[4161] = 0;
+car[4160] = 3315; cdr[4160] = 4159; tag[4160] = 0;
+car[4159] = 3150; cdr[4159] = 4158; tag[4159] = 0;
+car[4158] = 2466; cdr[4158] = 4157; tag[4158] = 0;
+car[4157] = 2249; cdr[4157] = 4156; tag[4157] = 0;
+car[4156] = 1802; cdr[4156] = 4155; tag[4156] = 0;
+car[4155] = 1727; cdr[4155] = 4154; tag[4155] = 0;
+car[4154] = 1693; cdr[4154] = 4153; tag[4154] = 0;
+car[4153] = 1685; cdr[4153] = 4152; tag[4153] = 0;
+car[4152] = 1625; cdr[4152] = 4151; tag[4152] = 0;
+car[4151] = 1617; cdr[4151] = 4150; tag[4151] = 0;
+car[4150] = 1589; cdr[4150] = 4149; tag[4150] = 0;
+car[4149] = 1552; cdr[4149] = 4148; tag[4149] = 0;
+car[4148] = 1544; cdr[4148] = 4147; tag[4148] = 0;
+car[4147] = 1419; cdr[4147] = 4146; tag[4147] = 0;
+car[4146] = 1384; cdr[4146] = 4145; tag[4146] = 0;
+car[4145] = 1338; cdr[4145] = 4144; tag[4145] = 0;
+car[4144] = 999; cdr[4144] = 4143; tag[4144] = 0;
+car[4143] = 958; cdr[4143] = 4142; tag[4143] = 0;
+car[4142] = 902; cdr[4142] = 4141; tag[4142] = 0;
+car[4141] = 731; cdr[4141] = 0; tag[4141] = 0;
+car[4140] = 4139; cdr[4140] = 4137; tag[4140] = 0;
+car[4139] = 706; cdr[4139] = 4138; tag[4139] = 0;
+car[4138] = 706; cdr[4138] = 0; tag[4138] = 0;
+car[4137] = 4136; cdr[4137] = 4133; tag[4137] = 0;
+car[4136] = 704; cdr[4136] = 4135; tag[4136] = 0;
+car[4135] = 704; cdr[4135] = 4134; tag[4135] = 0;
+car[4134] = 702; cdr[4134] = 0; tag[4134] = 0;
+car[4133] = 4132; cdr[4133] = 4117; tag[4133] = 0;
+car[4132] = 689; cdr[4132] = 4131; tag[4132] = 0;
+car[4131] = 3613; cdr[4131] = 4130; tag[4131] = 0;
+car[4130] = 3295; cdr[4130] = 4129; tag[4130] = 0;
+car[4129] = 3252; cdr[4129] = 4128; tag[4129] = 0;
+car[4128] = 3141; cdr[4128] = 4127; tag[4128] = 0;
+car[4127] = 2607; cdr[4127] = 4126; tag[4127] = 0;
+car[4126] = 2539; cdr[4126] = 4125; tag[4126] = 0;
+car[4125] = 1810; cdr[4125] = 4124; tag[4125] = 0;
+car[4124] = 1793; cdr[4124] = 4123; tag[4124] = 0;
+car[4123] = 1784; cdr[4123] = 4122; tag[4123] = 0;
+car[4122] = 1285; cdr[4122] = 4121; tag[4122] = 0;
+car[4121] = 806; cdr[4121] = 4120; tag[4121] = 0;
+car[4120] = 787; cdr[4120] = 4119; tag[4120] = 0;
+car[4119] = 769; cdr[4119] = 4118; tag[4119] = 0;
+car[4118] = 689; cdr[4118] = 0; tag[4118] = 0;
+car[4117] = 4116; cdr[4117] = 4112; tag[4117] = 0;
+car[4116] = 686; cdr[4116] = 4115; tag[4116] = 0;
+car[4115] = 2227; cdr[4115] = 4114; tag[4115] = 0;
+car[4114] = 2221; cdr[4114] = 4113; tag[4114] = 0;
+car[4113] = 686; cdr[4113] = 0; tag[4113] = 0;
+car[4112] = 4111; cdr[4112] = 4107; tag[4112] = 0;
+car[4111] = 4110; cdr[4111] = 4108; tag[4111] = 0;
+car[4110] = 4109; cdr[4110] = 0; tag[4110] = 0;
+car[4109] = u('.'); cdr[4109] = 0; tag[4109] = atomtag;
+car[4108] = 681; cdr[4108] = 0; tag[4108] = 0;
+car[4107] = 4106; cdr[4107] = 4104; tag[4107] = 0;
+car[4106] = 670; cdr[4106] = 4105; tag[4106] = 0;
+car[4105] = 670; cdr[4105] = 0; tag[4105] = 0;
+car[4104] = 4103; cdr[4104] = 4101; tag[4104] = 0;
+car[4103] = 668; cdr[4103] = 4102; tag[4103] = 0;
+car[4102] = 668; cdr[4102] = 0; tag[4102] = 0;
+car[4101] = 4100; cdr[4101] = 4098; tag[4101] = 0;
+car[4100] = 665; cdr[4100] = 4099; tag[4100] = 0;
+car[4099] = 665; cdr[4099] = 0; tag[4099] = 0;
+car[4098] = 4097; cdr[4098] = 4095; tag[4098] = 0;
+car[4097] = 662; cdr[4097] = 4096; tag[4097] = 0;
+car[4096] = 662; cdr[4096] = 0; tag[4096] = 0;
+car[4095] = 4094; cdr[4095] = 4092; tag[4095] = 0;
+car[4094] = 659; cdr[4094] = 4093; tag[4094] = 0;
+car[4093] = 659; cdr[4093] = 0; tag[4093] = 0;
+car[4092] = 4091; cdr[4092] = 4089; tag[4092] = 0;
+car[4091] = 656; cdr[4091] = 4090; tag[4091] = 0;
+car[4090] = 656; cdr[4090] = 0; tag[4090] = 0;
+car[4089] = 4088; cdr[4089] = 4086; tag[4089] = 0;
+car[4088] = 653; cdr[4088] = 4087; tag[4088] = 0;
+car[4087] = 653; cdr[4087] = 0; tag[4087] = 0;
+car[4086] = 4085; cdr[4086] = 4083; tag[4086] = 0;
+car[4085] = 650; cdr[4085] = 4084; tag[4085] = 0;
+car[4084] = 650; cdr[4084] = 0; tag[4084] = 0;
+car[4083] = 4082; cdr[4083] = 4080; tag[4083] = 0;
+car[4082] = 647; cdr[4082] = 4081; tag[4082] = 0;
+car[4081] = 647; cdr[4081] = 0; tag[4081] = 0;
+car[4080] = 4079; cdr[4080] = 4076; tag[4080] = 0;
+car[4079] = 644; cdr[4079] = 4078; tag[4079] = 0;
+car[4078] = 3696; cdr[4078] = 4077; tag[4078] = 0;
+car[4077] = 644; cdr[4077] = 0; tag[4077] = 0;
+car[4076] = 4075; cdr[4076] = 4071; tag[4076] = 0;
+car[4075] = 894; cdr[4075] = 4074; tag[4075] = 0;
+car[4074] = 3075; cdr[4074] = 4073; tag[4074] = 0;
+car[4073] = 894; cdr[4073] = 4072; tag[4073] = 0;
+car[4072] = 608; cdr[4072] = 0; tag[4072] = 0;
+car[4071] = 4070; cdr[4071] = 4056; tag[4071] = 0;
+car[4070] = 756; cdr[4070] = 4069; tag[4070] = 0;
+car[4069] = 2095; cdr[4069] = 4068; tag[4069] = 0;
+car[4068] = 1141; cdr[4068] = 4067; tag[4068] = 0;
+car[4067] = 1082; cdr[4067] = 4066; tag[4067] = 0;
+car[4066] = 1069; cdr[4066] = 4065; tag[4066] = 0;
+car[4065] = 1053; cdr[4065] = 4064; tag[4065] = 0;
+car[4064] = 814; cdr[4064] = 4063; tag[4064] = 0;
+car[4063] = 797; cdr[4063] = 4062; tag[4063] = 0;
+car[4062] = 756; cdr[4062] = 4061; tag[4062] = 0;
+car[4061] = 740; cdr[4061] = 4060; tag[4061] = 0;
+car[4060] = 569; cdr[4060] = 4059; tag[4060] = 0;
+car[4059] = 552; cdr[4059] = 4058; tag[4059] = 0;
+car[4058] = 541; cdr[4058] = 4057; tag[4058] = 0;
+car[4057] = 521; cdr[4057] = 0; tag[4057] = 0;
+car[4056] = 4055; cdr[4056] = 4047; tag[4056] = 0;
+car[4055] = 409; cdr[4055] = 4054; tag[4055] = 0;
+car[4054] = 3457; cdr[4054] = 4053; tag[4054] = 0;
+car[4053] = 1644; cdr[4053] = 4052; tag[4053] = 0;
+car[4052] = 1490; cdr[4052] = 4051; tag[4052] = 0;
+car[4051] = 1482; cdr[4051] = 4050; tag[4051] = 0;
+car[4050] = 1459; cdr[4050] = 4049; tag[4050] = 0;
+car[4049] = 1242; cdr[4049] = 4048; tag[4049] = 0;
+car[4048] = 409; cdr[4048] = 0; tag[4048] = 0;
+car[4047] = 4046; cdr[4047] = 4041; tag[4047] = 0;
+car[4046] = 928; cdr[4046] = 4045; tag[4046] = 0;
+car[4045] = 1775; cdr[4045] = 4044; tag[4045] = 0;
+car[4044] = 1631; cdr[4044] = 4043; tag[4044] = 0;
+car[4043] = 928; cdr[4043] = 4042; tag[4043] = 0;
+car[4042] = 250; cdr[4042] = 0; tag[4042] = 0;
+car[4041] = 4040; cdr[4041] = 4023; tag[4041] = 0;
+car[4040] = 691; cdr[4040] = 4039; tag[4040] = 0;
+car[4039] = 3776; cdr[4039] = 4038; tag[4039] = 0;
+car[4038] = 3750; cdr[4038] = 4037; tag[4038] = 0;
+car[4037] = 3470; cdr[4037] = 4036; tag[4037] = 0;
+car[4036] = 2869; cdr[4036] = 4035; tag[4036] = 0;
+car[4035] = 2455; cdr[4035] = 4034; tag[4035] = 0;
+car[4034] = 2068; cdr[4034] = 4033; tag[4034] = 0;
+car[4033] = 2038; cdr[4033] = 4032; tag[4033] = 0;
+car[4032] = 1638; cdr[4032] = 4031; tag[4032] = 0;
+car[4031] = 1375; cdr[4031] = 4030; tag[4031] = 0;
+car[4030] = 1201; cdr[4030] = 4029; tag[4030] = 0;
+car[4029] = 1187; cdr[4029] = 4028; tag[4029] = 0;
+car[4028] = 1017; cdr[4028] = 4027; tag[4028] = 0;
+car[4027] = 691; cdr[4027] = 4026; tag[4027] = 0;
+car[4026] = 496; cdr[4026] = 4025; tag[4026] = 0;
+car[4025] = 335; cdr[4025] = 4024; tag[4025] = 0;
+car[4024] = 239; cdr[4024] = 0; tag[4024] = 0;
+car[4023] = 4022; cdr[4023] = 3980; tag[4023] = 0;
+car[4022] = 543; cdr[4022] = 4021; tag[4022] = 0;
+car[4021] = 3475; cdr[4021] = 4020; tag[4021] = 0;
+car[4020] = 3357; cdr[4020] = 4019; tag[4020] = 0;
+car[4019] = 3303; cdr[4019] = 4018; tag[4019] = 0;
+car[4018] = 3210; cdr[4018] = 4017; tag[4018] = 0;
+car[4017] = 2974; cdr[4017] = 4016; tag[4017] = 0;
+car[4016] = 2947; cdr[4016] = 4015; tag[4016] = 0;
+car[4015] = 2919; cdr[4015] = 4014; tag[4015] = 0;
+car[4014] = 2888; cdr[4014] = 4013; tag[4014] = 0;
+car[4013] = 2764; cdr[4013] = 4012; tag[4013] = 0;
+car[4012] = 2730; cdr[4012] = 4011; tag[4012] = 0;
+car[4011] = 2681; cdr[4011] = 4010; tag[4011] = 0;
+car[4010] = 2651; cdr[4010] = 4009; tag[4010] = 0;
+car[4009] = 2635; cdr[4009] = 4008; tag[4009] = 0;
+car[4008] = 2567; cdr[4008] = 4007; tag[4008] = 0;
+car[4007] = 2499; cdr[4007] = 4006; tag[4007] = 0;
+car[4006] = 2444; cdr[4006] = 4005; tag[4006] = 0;
+car[4005] = 2427; cdr[4005] = 4004; tag[4005] = 0;
+car[4004] = 2414; cdr[4004] = 4003; tag[4004] = 0;
+car[4003] = 2388; cdr[4003] = 4002; tag[4003] = 0;
+car[4002] = 2367; cdr[4002] = 4001; tag[4002] = 0;
+car[4001] = 2338; cdr[4001] = 4000; tag[4001] = 0;
+car[4000] = 2301; cdr[4000] = 3999; tag[4000] = 0;
+car[3999] = 2281; cdr[3999] = 3998; tag[3999] = 0;
+car[3998] = 2168; cdr[3998] = 3997; tag[3998] = 0;
+car[3997] = 1990; cdr[3997] = 3996; tag[3997] = 0;
+car[3996] = 1447; cdr[3996] = 3995; tag[3996] = 0;
+car[3995] = 1367; cdr[3995] = 3994; tag[3995] = 0;
+car[3994] = 1261; cdr[3994] = 3993; tag[3994] = 0;
+car[3993] = 963; cdr[3993] = 3992; tag[3993] = 0;
+car[3992] = 781; cdr[3992] = 3991; tag[3992] = 0;
+car[3991] = 598; cdr[3991] = 3990; tag[3991] = 0;
+car[3990] = 585; cdr[3990] = 3989; tag[3990] = 0;
+car[3989] = 576; cdr[3989] = 3988; tag[3989] = 0;
+car[3988] = 543; cdr[3988] = 3987; tag[3988] = 0;
+car[3987] = 429; cdr[3987] = 3986; tag[3987] = 0;
+car[3986] = 420; cdr[3986] = 3985; tag[3986] = 0;
+car[3985] = 407; cdr[3985] = 3984; tag[3985] = 0;
+car[3984] = 400; cdr[3984] = 3983; tag[3984] = 0;
+car[3983] = 376; cdr[3983] = 3982; tag[3983] = 0;
+car[3982] = 369; cdr[3982] = 3981; tag[3982] = 0;
+car[3981] = 231; cdr[3981] = 0; tag[3981] = 0;
+car[3980] = 3979; cdr[3980] = 3975; tag[3980] = 0;
+car[3979] = 906; cdr[3979] = 3978; tag[3979] = 0;
+car[3978] = 1194; cdr[3978] = 3977; tag[3978] = 0;
+car[3977] = 906; cdr[3977] = 3976; tag[3977] = 0;
+car[3976] = 219; cdr[3976] = 0; tag[3976] = 0;
+car[3975] = 3974; cdr[3975] = 3966; tag[3975] = 0;
+car[3974] = 935; cdr[3974] = 3973; tag[3974] = 0;
+car[3973] = 3556; cdr[3973] = 3972; tag[3973] = 0;
+car[3972] = 3480; cdr[3972] = 3971; tag[3972] = 0;
+car[3971] = 3448; cdr[3971] = 3970; tag[3971] = 0;
+car[3970] = 2846; cdr[3970] = 3969; tag[3970] = 0;
+car[3969] = 1101; cdr[3969] = 3968; tag[3969] = 0;
+car[3968] = 935; cdr[3968] = 3967; tag[3968] = 0;
+car[3967] = 200; cdr[3967] = 0; tag[3967] = 0;
+car[3966] = 3965; cdr[3966] = 3943; tag[3966] = 0;
+car[3965] = 909; cdr[3965] = 3964; tag[3965] = 0;
+car[3964] = 3661; cdr[3964] = 3963; tag[3964] = 0;
+car[3963] = 3491; cdr[3963] = 3962; tag[3963] = 0;
+car[3962] = 3363; cdr[3962] = 3961; tag[3962] = 0;
+car[3961] = 3190; cdr[3961] = 3960; tag[3961] = 0;
+car[3960] = 2461; cdr[3960] = 3959; tag[3960] = 0;
+car[3959] = 2258; cdr[3959] = 3958; tag[3959] = 0;
+car[3958] = 2061; cdr[3958] = 3957; tag[3958] = 0;
+car[3957] = 2047; cdr[3957] = 3956; tag[3957] = 0;
+car[3956] = 1742; cdr[3956] = 3955; tag[3956] = 0;
+car[3955] = 1207; cdr[3955] = 3954; tag[3955] = 0;
+car[3954] = 1042; cdr[3954] = 3953; tag[3954] = 0;
+car[3953] = 909; cdr[3953] = 3952; tag[3953] = 0;
+car[3952] = 775; cdr[3952] = 3951; tag[3952] = 0;
+car[3951] = 719; cdr[3951] = 3950; tag[3951] = 0;
+car[3950] = 712; cdr[3950] = 3949; tag[3950] = 0;
+car[3949] = 684; cdr[3949] = 3948; tag[3949] = 0;
+car[3948] = 677; cdr[3948] = 3947; tag[3948] = 0;
+car[3947] = 637; cdr[3947] = 3946; tag[3947] = 0;
+car[3946] = 629; cdr[3946] = 3945; tag[3946] = 0;
+car[3945] = 620; cdr[3945] = 3944; tag[3945] = 0;
+car[3944] = 187; cdr[3944] = 0; tag[3944] = 0;
+car[3943] = 3942; cdr[3943] = 3925; tag[3943] = 0;
+car[3942] = 639; cdr[3942] = 3941; tag[3942] = 0;
+car[3941] = 3260; cdr[3941] = 3940; tag[3941] = 0;
+car[3940] = 1952; cdr[3940] = 3939; tag[3940] = 0;
+car[3939] = 1532; cdr[3939] = 3938; tag[3939] = 0;
+car[3938] = 1211; cdr[3938] = 3937; tag[3938] = 0;
+car[3937] = 1117; cdr[3937] = 3936; tag[3937] = 0;
+car[3936] = 1112; cdr[3936] = 3935; tag[3936] = 0;
+car[3935] = 1006; cdr[3935] = 3934; tag[3935] = 0;
+car[3934] = 973; cdr[3934] = 3933; tag[3934] = 0;
+car[3933] = 639; cdr[3933] = 3932; tag[3933] = 0;
+car[3932] = 504; cdr[3932] = 3931; tag[3932] = 0;
+car[3931] = 480; cdr[3931] = 3930; tag[3931] = 0;
+car[3930] = 471; cdr[3930] = 3929; tag[3930] = 0;
+car[3929] = 438; cdr[3929] = 3928; tag[3929] = 0;
+car[3928] = 345; cdr[3928] = 3927; tag[3928] = 0;
+car[3927] = 341; cdr[3927] = 3926; tag[3927] = 0;
+car[3926] = 180; cdr[3926] = 0; tag[3926] = 0;
+car[3925] = 3924; cdr[3925] = 3919; tag[3925] = 0;
+car[3924] = 925; cdr[3924] = 3923; tag[3924] = 0;
+car[3923] = 2810; cdr[3923] = 3922; tag[3923] = 0;
+car[3922] = 1583; cdr[3922] = 3921; tag[3922] = 0;
+car[3921] = 925; cdr[3921] = 3920; tag[3921] = 0;
+car[3920] = 171; cdr[3920] = 0; tag[3920] = 0;
+car[3919] = 3918; cdr[3919] = 3903; tag[3919] = 0;
+car[3918] = 932; cdr[3918] = 3917; tag[3918] = 0;
+car[3917] = 3726; cdr[3917] = 3916; tag[3917] = 0;
+car[3916] = 3322; cdr[3916] = 3915; tag[3916] = 0;
+car[3915] = 3222; cdr[3915] = 3914; tag[3915] = 0;
+car[3914] = 1938; cdr[3914] = 3913; tag[3914] = 0;
+car[3913] = 1916; cdr[3913] = 3912; tag[3913] = 0;
+car[3912] = 1233; cdr[3912] = 3911; tag[3912] = 0;
+car[3911] = 1170; cdr[3911] = 3910; tag[3911] = 0;
+car[3910] = 1165; cdr[3910] = 3909; tag[3910] = 0;
+car[3909] = 932; cdr[3909] = 3908; tag[3909] = 0;
+car[3908] = 853; cdr[3908] = 3907; tag[3908] = 0;
+car[3907] = 845; cdr[3907] = 3906; tag[3907] = 0;
+car[3906] = 820; cdr[3906] = 3905; tag[3906] = 0;
+car[3905] = 512; cdr[3905] = 3904; tag[3905] = 0;
+car[3904] = 165; cdr[3904] = 0; tag[3904] = 0;
+car[3903] = 3902; cdr[3903] = 3900; tag[3903] = 0;
+car[3902] = 153; cdr[3902] = 3901; tag[3902] = 0;
+car[3901] = 153; cdr[3901] = 0; tag[3901] = 0;
+car[3900] = 3899; cdr[3900] = 3870; tag[3900] = 0;
+car[3899] = 600; cdr[3899] = 3898; tag[3899] = 0;
+car[3898] = 3739; cdr[3898] = 3897; tag[3898] = 0;
+car[3897] = 3283; cdr[3897] = 3896; tag[3897] = 0;
+car[3896] = 3278; cdr[3896] = 3895; tag[3896] = 0;
+car[3895] = 3247; cdr[3895] = 3894; tag[3895] = 0;
+car[3894] = 3183; cdr[3894] = 3893; tag[3894] = 0;
+car[3893] = 3048; cdr[3893] = 3892; tag[3893] = 0;
+car[3892] = 3011; cdr[3892] = 3891; tag[3892] = 0;
+car[3891] = 2449; cdr[3891] = 3890; tag[3891] = 0;
+car[3890] = 2177; cdr[3890] = 3889; tag[3890] = 0;
+car[3889] = 1302; cdr[3889] = 3888; tag[3889] = 0;
+car[3888] = 1220; cdr[3888] = 3887; tag[3888] = 0;
+car[3887] = 992; cdr[3887] = 3886; tag[3887] = 0;
+car[3886] = 600; cdr[3886] = 3885; tag[3886] = 0;
+car[3885] = 330; cdr[3885] = 3884; tag[3885] = 0;
+car[3884] = 323; cdr[3884] = 3883; tag[3884] = 0;
+car[3883] = 316; cdr[3883] = 3882; tag[3883] = 0;
+car[3882] = 309; cdr[3882] = 3881; tag[3882] = 0;
+car[3881] = 302; cdr[3881] = 3880; tag[3881] = 0;
+car[3880] = 295; cdr[3880] = 3879; tag[3880] = 0;
+car[3879] = 288; cdr[3879] = 3878; tag[3879] = 0;
+car[3878] = 281; cdr[3878] = 3877; tag[3878] = 0;
+car[3877] = 274; cdr[3877] = 3876; tag[3877] = 0;
+car[3876] = 268; cdr[3876] = 3875; tag[3876] = 0;
+car[3875] = 262; cdr[3875] = 3874; tag[3875] = 0;
+car[3874] = 256; cdr[3874] = 3873; tag[3874] = 0;
+car[3873] = 160; cdr[3873] = 3872; tag[3873] = 0;
+car[3872] = 151; cdr[3872] = 3871; tag[3872] = 0;
+car[3871] = 146; cdr[3871] = 0; tag[3871] = 0;
+car[3870] = 3869; cdr[3870] = 3851; tag[3870] = 0;
+car[3869] = 412; cdr[3869] = 3868; tag[3869] = 0;
+car[3868] = 3636; cdr[3868] = 3867; tag[3868] = 0;
+car[3867] = 2347; cdr[3867] = 3866; tag[3867] = 0;
+car[3866] = 2113; cdr[3866] = 3865; tag[3866] = 0;
+car[3865] = 1849; cdr[3865] = 3864; tag[3865] = 0;
+car[3864] = 1843; cdr[3864] = 3863; tag[3864] = 0;
+car[3863] = 1749; cdr[3863] = 3862; tag[3863] = 0;
+car[3862] = 1598; cdr[3862] = 3861; tag[3862] = 0;
+car[3861] = 1468; cdr[3861] = 3860; tag[3861] = 0;
+car[3860] = 1431; cdr[3860] = 3859; tag[3860] = 0;
+car[3859] = 1153; cdr[3859] = 3858; tag[3859] = 0;
+car[3858] = 1128; cdr[3858] = 3857; tag[3858] = 0;
+car[3857] = 1093; cdr[3857] = 3856; tag[3857] = 0;
+car[3856] = 986; cdr[3856] = 3855; tag[3856] = 0;
+car[3855] = 529; cdr[3855] = 3854; tag[3855] = 0;
+car[3854] = 489; cdr[3854] = 3853; tag[3854] = 0;
+car[3853] = 412; cdr[3853] = 3852; tag[3853] = 0;
+car[3852] = 141; cdr[3852] = 0; tag[3852] = 0;
+car[3851] = 3850; cdr[3851] = 3848; tag[3851] = 0;
+car[3850] = 135; cdr[3850] = 3849; tag[3850] = 0;
+car[3849] = 135; cdr[3849] = 0; tag[3849] = 0;
+car[3848] = 3847; cdr[3848] = 3845; tag[3848] = 0;
+car[3847] = 129; cdr[3847] = 3846; tag[3847] = 0;
+car[3846] = 129; cdr[3846] = 0; tag[3846] = 0;
+car[3845] = 3844; cdr[3845] = 3835; tag[3845] = 0;
+car[3844] = 123; cdr[3844] = 3843; tag[3844] = 0;
+car[3843] = 2137; cdr[3843] = 3842; tag[3843] = 0;
+car[3842] = 2000; cdr[3842] = 3841; tag[3842] = 0;
+car[3841] = 1897; cdr[3841] = 3840; tag[3841] = 0;
+car[3840] = 1870; cdr[3840] = 3839; tag[3840] = 0;
+car[3839] = 1764; cdr[3839] = 3838; tag[3839] = 0;
+car[3838] = 1406; cdr[3838] = 3837; tag[3838] = 0;
+car[3837] = 1341; cdr[3837] = 3836; tag[3837] = 0;
+car[3836] = 123; cdr[3836] = 0; tag[3836] = 0;
+car[3835] = 3834; cdr[3835] = 3828; tag[3835] = 0;
+car[3834] = 117; cdr[3834] = 3833; tag[3834] = 0;
+car[3833] = 3652; cdr[3833] = 3832; tag[3833] = 0;
+car[3832] = 1905; cdr[3832] = 3831; tag[3832] = 0;
+car[3831] = 1875; cdr[3831] = 3830; tag[3831] = 0;
+car[3830] = 1571; cdr[3830] = 3829; tag[3830] = 0;
+car[3829] = 117; cdr[3829] = 0; tag[3829] = 0;
+car[3828] = 3827; cdr[3828] = 3791; tag[3828] = 0;
+car[3827] = 886; cdr[3827] = 3826; tag[3827] = 0;
+car[3826] = 3769; cdr[3826] = 3825; tag[3826] = 0;
+car[3825] = 3758; cdr[3825] = 3824; tag[3825] = 0;
+car[3824] = 3438; cdr[3824] = 3823; tag[3824] = 0;
+car[3823] = 3056; cdr[3823] = 3822; tag[3823] = 0;
+car[3822] = 3019; cdr[3822] = 3821; tag[3822] = 0;
+car[3821] = 2982; cdr[3821] = 3820; tag[3821] = 0;
+car[3820] = 2953; cdr[3820] = 3819; tag[3820] = 0;
+car[3819] = 2926; cdr[3819] = 3818; tag[3819] = 0;
+car[3818] = 2898; cdr[3818] = 3817; tag[3818] = 0;
+car[3817] = 2875; cdr[3817] = 3816; tag[3817] = 0;
+car[3816] = 2852; cdr[3816] = 3815; tag[3816] = 0;
+car[3815] = 2829; cdr[3815] = 3814; tag[3815] = 0;
+car[3814] = 2823; cdr[3814] = 3813; tag[3814] = 0;
+car[3813] = 2818; cdr[3813] = 3812; tag[3813] = 0;
+car[3812] = 2776; cdr[3812] = 3811; tag[3812] = 0;
+car[3811] = 2395; cdr[3811] = 3810; tag[3811] = 0;
+car[3810] = 2373; cdr[3810] = 3809; tag[3810] = 0;
+car[3809] = 2212; cdr[3809] = 3808; tag[3809] = 0;
+car[3808] = 2200; cdr[3808] = 3807; tag[3808] = 0;
+car[3807] = 2188; cdr[3807] = 3806; tag[3807] = 0;
+car[3806] = 2121; cdr[3806] = 3805; tag[3806] = 0;
+car[3805] = 2103; cdr[3805] = 3804; tag[3805] = 0;
+car[3804] = 2085; cdr[3804] = 3803; tag[3804] = 0;
+car[3803] = 948; cdr[3803] = 3802; tag[3803] = 0;
+car[3802] = 886; cdr[3802] = 3801; tag[3802] = 0;
+car[3801] = 871; cdr[3801] = 3800; tag[3801] = 0;
+car[3800] = 555; cdr[3800] = 3799; tag[3800] = 0;
+car[3799] = 536; cdr[3799] = 3798; tag[3799] = 0;
+car[3798] = 532; cdr[3798] = 3797; tag[3798] = 0;
+car[3797] = 447; cdr[3797] = 3796; tag[3797] = 0;
+car[3796] = 133; cdr[3796] = 3795; tag[3796] = 0;
+car[3795] = 127; cdr[3795] = 3794; tag[3795] = 0;
+car[3794] = 121; cdr[3794] = 3793; tag[3794] = 0;
+car[3793] = 115; cdr[3793] = 3792; tag[3793] = 0;
+car[3792] = 107; cdr[3792] = 0; tag[3792] = 0;
+car[3791] = 3790; cdr[3791] = 0; tag[3791] = 0;
+car[3790] = 1; cdr[3790] = 3789; tag[3790] = 0;
+car[3789] = 3270; cdr[3789] = 3788; tag[3789] = 0;
+car[3788] = 2692; cdr[3788] = 3787; tag[3788] = 0;
+car[3787] = 2309; cdr[3787] = 3786; tag[3787] = 0;
+car[3786] = 2242; cdr[3786] = 3785; tag[3786] = 0;
+car[3785] = 2077; cdr[3785] = 3784; tag[3785] = 0;
+car[3784] = 1964; cdr[3784] = 3783; tag[3784] = 0;
+car[3783] = 1859; cdr[3783] = 3782; tag[3783] = 0;
+car[3782] = 1223; cdr[3782] = 3781; tag[3782] = 0;
+car[3781] = 1056; cdr[3781] = 3780; tag[3781] = 0;
+car[3780] = 980; cdr[3780] = 3779; tag[3780] = 0;
+car[3779] = 615; cdr[3779] = 3778; tag[3779] = 0;
+car[3778] = 208; cdr[3778] = 3777; tag[3778] = 0;
+car[3777] = 1; cdr[3777] = 0; tag[3777] = 0;
+car[3776] = 3775; cdr[3776] = 0; tag[3776] = 0;
+car[3775] = u('l'); cdr[3775] = 3774; tag[3775] = atomtag;
+car[3774] = u('i'); cdr[3774] = 3773; tag[3774] = atomtag;
+car[3773] = u('s'); cdr[3773] = 3772; tag[3773] = atomtag;
+car[3772] = u('c'); cdr[3772] = 3771; tag[3772] = atomtag;
+car[3771] = u('m'); cdr[3771] = 3770; tag[3771] = atomtag;
+car[3770] = u('p'); cdr[3770] = 0; tag[3770] = atomtag;
+car[3769] = 3768; cdr[3769] = 0; tag[3769] = 0;
+car[3768] = u('*'); cdr[3768] = 3767; tag[3768] = atomtag;
+car[3767] = u('f'); cdr[3767] = 3766; tag[3767] = atomtag;
+car[3766] = u('u'); cdr[3766] = 3765; tag[3766] = atomtag;
+car[3765] = u('n'); cdr[3765] = 3764; tag[3765] = atomtag;
+car[3764] = u('c'); cdr[3764] = 3763; tag[3764] = atomtag;
+car[3763] = u('t'); cdr[3763] = 3762; tag[3763] = atomtag;
+car[3762] = u('i'); cdr[3762] = 3761; tag[3762] = atomtag;
+car[3761] = u('o'); cdr[3761] = 3760; tag[3761] = atomtag;
+car[3760] = u('n'); cdr[3760] = 3759; tag[3760] = atomtag;
+car[3759] = u('s'); cdr[3759] = 0; tag[3759] = atomtag;
+car[3758] = 3757; cdr[3758] = 0; tag[3758] = 0;
+car[3757] = u('*'); cdr[3757] = 3756; tag[3757] = atomtag;
+car[3756] = u('s'); cdr[3756] = 3755; tag[3756] = atomtag;
+car[3755] = u('t'); cdr[3755] = 3754; tag[3755] = atomtag;
+car[3754] = u('o'); cdr[3754] = 3753; tag[3754] = atomtag;
+car[3753] = u('p'); cdr[3753] = 0; tag[3753] = atomtag;
+car[3752] = 135; cdr[3752] = 3751; tag[3752] = 0;
+car[3751] = 909; cdr[3751] = 0; tag[3751] = 0;
+car[3750] = 3749; cdr[3750] = 0; tag[3750] = 0;
+car[3749] = u('l'); cdr[3749] = 3748; tag[3749] = atomtag;
+car[3748] = u('i'); cdr[3748] = 3747; tag[3748] = atomtag;
+car[3747] = u('s'); cdr[3747] = 3746; tag[3747] = atomtag;
+car[3746] = u('c'); cdr[3746] = 3745; tag[3746] = atomtag;
+car[3745] = u('m'); cdr[3745] = 3744; tag[3745] = atomtag;
+car[3744] = u('p'); cdr[3744] = 3743; tag[3744] = atomtag;
+car[3743] = u('-'); cdr[3743] = 3742; tag[3743] = atomtag;
+car[3742] = u('f'); cdr[3742] = 0; tag[3742] = atomtag;
+car[3741] = 935; cdr[3741] = 0; tag[3741] = 0;
+car[3740] = 909; cdr[3740] = 0; tag[3740] = 0;
+car[3739] = 3738; cdr[3739] = 0; tag[3739] = 0;
+car[3738] = u('c'); cdr[3738] = 3737; tag[3738] = atomtag;
+car[3737] = u('o'); cdr[3737] = 3736; tag[3737] = atomtag;
+car[3736] = u('m'); cdr[3736] = 3735; tag[3736] = atomtag;
+car[3735] = u('p'); cdr[3735] = 3734; tag[3735] = atomtag;
+car[3734] = u('i'); cdr[3734] = 3733; tag[3734] = atomtag;
+car[3733] = u('l'); cdr[3733] = 3732; tag[3733] = atomtag;
+car[3732] = u('e'); cdr[3732] = 3731; tag[3732] = atomtag;
+car[3731] = u('-'); cdr[3731] = 3730; tag[3731] = atomtag;
+car[3730] = u('a'); cdr[3730] = 3729; tag[3730] = atomtag;
+car[3729] = u('l'); cdr[3729] = 3728; tag[3729] = atomtag;
+car[3728] = u('l'); cdr[3728] = 0; tag[3728] = atomtag;
+car[3727] = 909; cdr[3727] = 0; tag[3727] = 0;
+car[3726] = 3725; cdr[3726] = 0; tag[3726] = 0;
+car[3725] = u('e'); cdr[3725] = 3724; tag[3725] = atomtag;
+car[3724] = u('p'); cdr[3724] = 3723; tag[3724] = atomtag;
+car[3723] = u('i'); cdr[3723] = 3722; tag[3723] = atomtag;
+car[3722] = u('l'); cdr[3722] = 3721; tag[3722] = atomtag;
+car[3721] = u('o'); cdr[3721] = 3720; tag[3721] = atomtag;
+car[3720] = u('g'); cdr[3720] = 3719; tag[3720] = atomtag;
+car[3719] = u('-'); cdr[3719] = 3718; tag[3719] = atomtag;
+car[3718] = u('f'); cdr[3718] = 0; tag[3718] = atomtag;
+car[3717] = 3716; cdr[3717] = 0; tag[3717] = 0;
+car[3716] = u('f'); cdr[3716] = 3715; tag[3716] = atomtag;
+car[3715] = u('u'); cdr[3715] = 3714; tag[3715] = atomtag;
+car[3714] = u('n'); cdr[3714] = 3713; tag[3714] = atomtag;
+car[3713] = u('t'); cdr[3713] = 3712; tag[3713] = atomtag;
+car[3712] = u('a'); cdr[3712] = 3711; tag[3712] = atomtag;
+car[3711] = u('b'); cdr[3711] = 3710; tag[3711] = atomtag;
+car[3710] = u(' '); cdr[3710] = 3709; tag[3710] = atomtag;
+car[3709] = u('='); cdr[3709] = 3708; tag[3709] = atomtag;
+car[3708] = u(' '); cdr[3708] = 3707; tag[3708] = atomtag;
+car[3707] = u('f'); cdr[3707] = 3706; tag[3707] = atomtag;
+car[3706] = u('t'); cdr[3706] = 3705; tag[3706] = atomtag;
+car[3705] = u('a'); cdr[3705] = 3704; tag[3705] = atomtag;
+car[3704] = u('b'); cdr[3704] = 3703; tag[3704] = atomtag;
+car[3703] = u(';'); cdr[3703] = 0; tag[3703] = atomtag;
+car[3702] = 3701; cdr[3702] = 0; tag[3702] = 0;
+car[3701] = u('}'); cdr[3701] = 3700; tag[3701] = atomtag;
+car[3700] = u(';'); cdr[3700] = 0; tag[3700] = atomtag;
+car[3699] = 3698; cdr[3699] = 0; tag[3699] = 0;
+car[3698] = u(','); cdr[3698] = 0; tag[3698] = atomtag;
+car[3697] = 918; cdr[3697] = 0; tag[3697] = 0;
+car[3696] = 3695; cdr[3696] = 0; tag[3696] = 0;
+car[3695] = u('0'); cdr[3695] = 3694; tag[3695] = atomtag;
+car[3694] = u(','); cdr[3694] = 0; tag[3694] = atomtag;
+car[3693] = 3692; cdr[3693] = 0; tag[3693] = 0;
+car[3692] = u('v'); cdr[3692] = 3691; tag[3692] = atomtag;
+car[3691] = u('o'); cdr[3691] = 3690; tag[3691] = atomtag;
+car[3690] = u('i'); cdr[3690] = 3689; tag[3690] = atomtag;
+car[3689] = u('d'); cdr[3689] = 3688; tag[3689] = atomtag;
+car[3688] = u(' '); cdr[3688] = 3687; tag[3688] = atomtag;
+car[3687] = u('('); cdr[3687] = 3686; tag[3687] = atomtag;
+car[3686] = u('*'); cdr[3686] = 3685; tag[3686] = atomtag;
+car[3685] = u('f'); cdr[3685] = 3684; tag[3685] = atomtag;
+car[3684] = u('t'); cdr[3684] = 3683; tag[3684] = atomtag;
+car[3683] = u('a'); cdr[3683] = 3682; tag[3683] = atomtag;
+car[3682] = u('b'); cdr[3682] = 3681; tag[3682] = atomtag;
+car[3681] = u('['); cdr[3681] = 3680; tag[3681] = atomtag;
+car[3680] = u(']'); cdr[3680] = 3679; tag[3680] = atomtag;
+car[3679] = u(')'); cdr[3679] = 3678; tag[3679] = atomtag;
+car[3678] = u('('); cdr[3678] = 3677; tag[3678] = atomtag;
+car[3677] = u('c'); cdr[3677] = 3676; tag[3677] = atomtag;
+car[3676] = u('e'); cdr[3676] = 3675; tag[3676] = atomtag;
+car[3675] = u('l'); cdr[3675] = 3674; tag[3675] = atomtag;
+car[3674] = u('l'); cdr[3674] = 3673; tag[3674] = atomtag;
+car[3673] = u(' '); cdr[3673] = 3672; tag[3673] = atomtag;
+car[3672] = u('*'); cdr[3672] = 3671; tag[3672] = atomtag;
+car[3671] = u(','); cdr[3671] = 3670; tag[3671] = atomtag;
+car[3670] = u(' '); cdr[3670] = 3669; tag[3670] = atomtag;
+car[3669] = u('i'); cdr[3669] = 3668; tag[3669] = atomtag;
+car[3668] = u('n'); cdr[3668] = 3667; tag[3668] = atomtag;
+car[3667] = u('t'); cdr[3667] = 3666; tag[3667] = atomtag;
+car[3666] = u(')'); cdr[3666] = 3665; tag[3666] = atomtag;
+car[3665] = u(' '); cdr[3665] = 3664; tag[3665] = atomtag;
+car[3664] = u('='); cdr[3664] = 3663; tag[3664] = atomtag;
+car[3663] = u(' '); cdr[3663] = 3662; tag[3663] = atomtag;
+car[3662] = u('{'); cdr[3662] = 0; tag[3662] = atomtag;
+car[3661] = 3660; cdr[3661] = 0; tag[3661] = 0;
+car[3660] = u('p'); cdr[3660] = 3659; tag[3660] = atomtag;
+car[3659] = u('r'); cdr[3659] = 3658; tag[3659] = atomtag;
+car[3658] = u('o'); cdr[3658] = 3657; tag[3658] = atomtag;
+car[3657] = u('l'); cdr[3657] = 3656; tag[3657] = atomtag;
+car[3656] = u('o'); cdr[3656] = 3655; tag[3656] = atomtag;
+car[3655] = u('g'); cdr[3655] = 3654; tag[3655] = atomtag;
+car[3654] = u('-'); cdr[3654] = 3653; tag[3654] = atomtag;
+car[3653] = u('f'); cdr[3653] = 0; tag[3653] = atomtag;
+car[3652] = 3651; cdr[3652] = 0; tag[3652] = 0;
+car[3651] = u('('); cdr[3651] = 3650; tag[3651] = atomtag;
+car[3650] = u('c'); cdr[3650] = 3649; tag[3650] = atomtag;
+car[3649] = u('e'); cdr[3649] = 3648; tag[3649] = atomtag;
+car[3648] = u('l'); cdr[3648] = 3647; tag[3648] = atomtag;
+car[3647] = u('l'); cdr[3647] = 3646; tag[3647] = atomtag;
+car[3646] = u(' '); cdr[3646] = 3645; tag[3646] = atomtag;
+car[3645] = u('*'); cdr[3645] = 3644; tag[3645] = atomtag;
+car[3644] = u(','); cdr[3644] = 3643; tag[3644] = atomtag;
+car[3643] = u(' '); cdr[3643] = 3642; tag[3643] = atomtag;
+car[3642] = u('i'); cdr[3642] = 3641; tag[3642] = atomtag;
+car[3641] = u('n'); cdr[3641] = 3640; tag[3641] = atomtag;
+car[3640] = u('t'); cdr[3640] = 3639; tag[3640] = atomtag;
+car[3639] = u(')'); cdr[3639] = 3638; tag[3639] = atomtag;
+car[3638] = u(';'); cdr[3638] = 0; tag[3638] = atomtag;
+car[3637] = 918; cdr[3637] = 0; tag[3637] = 0;
+car[3636] = 3635; cdr[3636] = 0; tag[3636] = 0;
+car[3635] = u('a'); cdr[3635] = 3634; tag[3635] = atomtag;
+car[3634] = u('n'); cdr[3634] = 3633; tag[3634] = atomtag;
+car[3633] = u('a'); cdr[3633] = 3632; tag[3633] = atomtag;
+car[3632] = u('l'); cdr[3632] = 3631; tag[3632] = atomtag;
+car[3631] = u('y'); cdr[3631] = 3630; tag[3631] = atomtag;
+car[3630] = u('z'); cdr[3630] = 3629; tag[3630] = atomtag;
+car[3629] = u('e'); cdr[3629] = 0; tag[3629] = atomtag;
+car[3628] = 909; cdr[3628] = 0; tag[3628] = 0;
+car[3627] = 3626; cdr[3627] = 0; tag[3627] = 0;
+car[3626] = u('f'); cdr[3626] = 3625; tag[3626] = atomtag;
+car[3625] = u('i'); cdr[3625] = 3624; tag[3625] = atomtag;
+car[3624] = u('n'); cdr[3624] = 3623; tag[3624] = atomtag;
+car[3623] = u('d'); cdr[3623] = 3622; tag[3623] = atomtag;
+car[3622] = u('-'); cdr[3622] = 3621; tag[3622] = atomtag;
+car[3621] = u('i'); cdr[3621] = 3620; tag[3621] = atomtag;
+car[3620] = u('n'); cdr[3620] = 3619; tag[3620] = atomtag;
+car[3619] = u('l'); cdr[3619] = 3618; tag[3619] = atomtag;
+car[3618] = u('i'); cdr[3618] = 3617; tag[3618] = atomtag;
+car[3617] = u('n'); cdr[3617] = 3616; tag[3617] = atomtag;
+car[3616] = u('e'); cdr[3616] = 3615; tag[3616] = atomtag;
+car[3615] = u('s'); cdr[3615] = 0; tag[3615] = atomtag;
+car[3614] = 909; cdr[3614] = 0; tag[3614] = 0;
+car[3613] = 3612; cdr[3613] = 0; tag[3613] = 0;
+car[3612] = u('i'); cdr[3612] = 3611; tag[3612] = atomtag;
+car[3611] = u('n'); cdr[3611] = 3610; tag[3611] = atomtag;
+car[3610] = u('l'); cdr[3610] = 3609; tag[3610] = atomtag;
+car[3609] = u('i'); cdr[3609] = 3608; tag[3609] = atomtag;
+car[3608] = u('n'); cdr[3608] = 3607; tag[3608] = atomtag;
+car[3607] = u('a'); cdr[3607] = 3606; tag[3607] = atomtag;
+car[3606] = u('b'); cdr[3606] = 3605; tag[3606] = atomtag;
+car[3605] = u('l'); cdr[3605] = 3604; tag[3605] = atomtag;
+car[3604] = u('e'); cdr[3604] = 3603; tag[3604] = atomtag;
+car[3603] = u('p'); cdr[3603] = 0; tag[3603] = atomtag;
+car[3602] = 909; cdr[3602] = 0; tag[3602] = 0;
+car[3601] = 760; cdr[3601] = 0; tag[3601] = 0;
+car[3600] = 3599; cdr[3600] = 0; tag[3600] = 0;
+car[3599] = u('u'); cdr[3599] = 3598; tag[3599] = atomtag;
+car[3598] = u('s'); cdr[3598] = 3597; tag[3598] = atomtag;
+car[3597] = u('e'); cdr[3597] = 3596; tag[3597] = atomtag;
+car[3596] = u('s'); cdr[3596] = 0; tag[3596] = atomtag;
+car[3595] = 412; cdr[3595] = 3594; tag[3595] = 0;
+car[3594] = 639; cdr[3594] = 0; tag[3594] = 0;
+car[3593] = 762; cdr[3593] = 3592; tag[3593] = 0;
+car[3592] = 135; cdr[3592] = 0; tag[3592] = 0;
+car[3591] = 3590; cdr[3591] = 0; tag[3591] = 0;
+car[3590] = u('s'); cdr[3590] = 3589; tag[3590] = atomtag;
+car[3589] = u('i'); cdr[3589] = 3588; tag[3589] = atomtag;
+car[3588] = u('m'); cdr[3588] = 3587; tag[3588] = atomtag;
+car[3587] = u('p'); cdr[3587] = 3586; tag[3587] = atomtag;
+car[3586] = u('l'); cdr[3586] = 3585; tag[3586] = atomtag;
+car[3585] = u('e'); cdr[3585] = 3584; tag[3585] = atomtag;
+car[3584] = u('p'); cdr[3584] = 0; tag[3584] = atomtag;
+car[3583] = 412; cdr[3583] = 0; tag[3583] = 0;
+car[3582] = 135; cdr[3582] = 3581; tag[3582] = 0;
+car[3581] = 762; cdr[3581] = 0; tag[3581] = 0;
+car[3580] = 3579; cdr[3580] = 0; tag[3580] = 0;
+car[3579] = u('f'); cdr[3579] = 3578; tag[3579] = atomtag;
+car[3578] = u('i'); cdr[3578] = 3577; tag[3578] = atomtag;
+car[3577] = u('n'); cdr[3577] = 3576; tag[3577] = atomtag;
+car[3576] = u('d'); cdr[3576] = 3575; tag[3576] = atomtag;
+car[3575] = u('-'); cdr[3575] = 3574; tag[3575] = atomtag;
+car[3574] = u('s'); cdr[3574] = 3573; tag[3574] = atomtag;
+car[3573] = u('e'); cdr[3573] = 3572; tag[3573] = atomtag;
+car[3572] = u('l'); cdr[3572] = 3571; tag[3572] = atomtag;
+car[3571] = u('f'); cdr[3571] = 3570; tag[3571] = atomtag;
+car[3570] = u('o'); cdr[3570] = 3569; tag[3570] = atomtag;
+car[3569] = u('k'); cdr[3569] = 0; tag[3569] = atomtag;
+car[3568] = 691; cdr[3568] = 0; tag[3568] = 0;
+car[3567] = 3566; cdr[3567] = 0; tag[3567] = 0;
+car[3566] = u('f'); cdr[3566] = 3565; tag[3566] = atomtag;
+car[3565] = u('i'); cdr[3565] = 3564; tag[3565] = atomtag;
+car[3564] = u('n'); cdr[3564] = 3563; tag[3564] = atomtag;
+car[3563] = u('d'); cdr[3563] = 3562; tag[3563] = atomtag;
+car[3562] = u('-'); cdr[3562] = 3561; tag[3562] = atomtag;
+car[3561] = u('d'); cdr[3561] = 3560; tag[3561] = atomtag;
+car[3560] = u('e'); cdr[3560] = 3559; tag[3560] = atomtag;
+car[3559] = u('f'); cdr[3559] = 3558; tag[3559] = atomtag;
+car[3558] = u('s'); cdr[3558] = 0; tag[3558] = atomtag;
+car[3557] = 909; cdr[3557] = 0; tag[3557] = 0;
+car[3556] = 3555; cdr[3556] = 0; tag[3556] = 0;
+car[3555] = u('d'); cdr[3555] = 3554; tag[3555] = atomtag;
+car[3554] = u('e'); cdr[3554] = 3553; tag[3554] = atomtag;
+car[3553] = u('f'); cdr[3553] = 3552; tag[3553] = atomtag;
+car[3552] = u('p'); cdr[3552] = 0; tag[3552] = atomtag;
+car[3551] = 135; cdr[3551] = 0; tag[3551] = 0;
+car[3550] = 135; cdr[3550] = 0; tag[3550] = 0;
+car[3549] = 409; cdr[3549] = 0; tag[3549] = 0;
+car[3548] = 600; cdr[3548] = 0; tag[3548] = 0;
+car[3547] = 135; cdr[3547] = 0; tag[3547] = 0;
+car[3546] = 3545; cdr[3546] = 0; tag[3546] = 0;
+car[3545] = u('s'); cdr[3545] = 3544; tag[3545] = atomtag;
+car[3544] = u('c'); cdr[3544] = 3543; tag[3544] = atomtag;
+car[3543] = u('a'); cdr[3543] = 3542; tag[3543] = atomtag;
+car[3542] = u('n'); cdr[3542] = 3541; tag[3542] = atomtag;
+car[3541] = u('-'); cdr[3541] = 3540; tag[3541] = atomtag;
+car[3540] = u('r'); cdr[3540] = 3539; tag[3540] = atomtag;
+car[3539] = u('e'); cdr[3539] = 3538; tag[3539] = atomtag;
+car[3538] = u('f'); cdr[3538] = 3537; tag[3538] = atomtag;
+car[3537] = u('s'); cdr[3537] = 3536; tag[3537] = atomtag;
+car[3536] = u('-'); cdr[3536] = 3535; tag[3536] = atomtag;
+car[3535] = u('l'); cdr[3535] = 3534; tag[3535] = atomtag;
+car[3534] = u('i'); cdr[3534] = 3533; tag[3534] = atomtag;
+car[3533] = u('s'); cdr[3533] = 3532; tag[3533] = atomtag;
+car[3532] = u('t'); cdr[3532] = 0; tag[3532] = atomtag;
+car[3531] = 3530; cdr[3531] = 0; tag[3531] = 0;
+car[3530] = u('s'); cdr[3530] = 3529; tag[3530] = atomtag;
+car[3529] = u('c'); cdr[3529] = 3528; tag[3529] = atomtag;
+car[3528] = u('a'); cdr[3528] = 3527; tag[3528] = atomtag;
+car[3527] = u('n'); cdr[3527] = 3526; tag[3527] = atomtag;
+car[3526] = u('-'); cdr[3526] = 3525; tag[3526] = atomtag;
+car[3525] = u('r'); cdr[3525] = 3524; tag[3525] = atomtag;
+car[3524] = u('e'); cdr[3524] = 3523; tag[3524] = atomtag;
+car[3523] = u('f'); cdr[3523] = 3522; tag[3523] = atomtag;
+car[3522] = u('s'); cdr[3522] = 0; tag[3522] = atomtag;
+car[3521] = 135; cdr[3521] = 0; tag[3521] = 0;
+car[3520] = 409; cdr[3520] = 0; tag[3520] = 0;
+car[3519] = 135; cdr[3519] = 0; tag[3519] = 0;
+car[3518] = 3517; cdr[3518] = 0; tag[3518] = 0;
+car[3517] = u('s'); cdr[3517] = 3516; tag[3517] = atomtag;
+car[3516] = u('c'); cdr[3516] = 3515; tag[3516] = atomtag;
+car[3515] = u('a'); cdr[3515] = 3514; tag[3515] = atomtag;
+car[3514] = u('n'); cdr[3514] = 3513; tag[3514] = atomtag;
+car[3513] = u('-'); cdr[3513] = 3512; tag[3513] = atomtag;
+car[3512] = u('l'); cdr[3512] = 3511; tag[3512] = atomtag;
+car[3511] = u('i'); cdr[3511] = 3510; tag[3511] = atomtag;
+car[3510] = u('s'); cdr[3510] = 3509; tag[3510] = atomtag;
+car[3509] = u('t'); cdr[3509] = 0; tag[3509] = atomtag;
+car[3508] = 3507; cdr[3508] = 0; tag[3508] = 0;
+car[3507] = u('s'); cdr[3507] = 3506; tag[3507] = atomtag;
+car[3506] = u('c'); cdr[3506] = 3505; tag[3506] = atomtag;
+car[3505] = u('a'); cdr[3505] = 3504; tag[3505] = atomtag;
+car[3504] = u('n'); cdr[3504] = 0; tag[3504] = atomtag;
+car[3503] = 135; cdr[3503] = 0; tag[3503] = 0;
+car[3502] = 3501; cdr[3502] = 0; tag[3502] = 0;
+car[3501] = u('s'); cdr[3501] = 3500; tag[3501] = atomtag;
+car[3500] = u('c'); cdr[3500] = 3499; tag[3500] = atomtag;
+car[3499] = u('a'); cdr[3499] = 3498; tag[3499] = atomtag;
+car[3498] = u('n'); cdr[3498] = 3497; tag[3498] = atomtag;
+car[3497] = u('-'); cdr[3497] = 3496; tag[3497] = atomtag;
+car[3496] = u('v'); cdr[3496] = 3495; tag[3496] = atomtag;
+car[3495] = u('a'); cdr[3495] = 3494; tag[3495] = atomtag;
+car[3494] = u('r'); cdr[3494] = 3493; tag[3494] = atomtag;
+car[3493] = u('s'); cdr[3493] = 0; tag[3493] = atomtag;
+car[3492] = 135; cdr[3492] = 0; tag[3492] = 0;
+car[3491] = 3490; cdr[3491] = 0; tag[3491] = 0;
+car[3490] = u('p'); cdr[3490] = 3489; tag[3490] = atomtag;
+car[3489] = u('r'); cdr[3489] = 3488; tag[3489] = atomtag;
+car[3488] = u('i'); cdr[3488] = 3487; tag[3488] = atomtag;
+car[3487] = u('m'); cdr[3487] = 3486; tag[3487] = atomtag;
+car[3486] = u('s'); cdr[3486] = 0; tag[3486] = atomtag;
+car[3485] = 141; cdr[3485] = 3484; tag[3485] = 0;
+car[3484] = 146; cdr[3484] = 3483; tag[3484] = 0;
+car[3483] = 151; cdr[3483] = 3482; tag[3483] = 0;
+car[3482] = 160; cdr[3482] = 3481; tag[3482] = 0;
+car[3481] = 165; cdr[3481] = 0; tag[3481] = 0;
+car[3480] = 3479; cdr[3480] = 0; tag[3480] = 0;
+car[3479] = u('d'); cdr[3479] = 3478; tag[3479] = atomtag;
+car[3478] = u('e'); cdr[3478] = 3477; tag[3478] = atomtag;
+car[3477] = u('f'); cdr[3477] = 3476; tag[3477] = atomtag;
+car[3476] = u('s'); cdr[3476] = 0; tag[3476] = atomtag;
+car[3475] = 3474; cdr[3475] = 0; tag[3475] = 0;
+car[3474] = u('r'); cdr[3474] = 3473; tag[3474] = atomtag;
+car[3473] = u('e'); cdr[3473] = 3472; tag[3473] = atomtag;
+car[3472] = u('f'); cdr[3472] = 3471; tag[3472] = atomtag;
+car[3471] = u('s'); cdr[3471] = 0; tag[3471] = atomtag;
+car[3470] = 3469; cdr[3470] = 0; tag[3470] = 0;
+car[3469] = u('l'); cdr[3469] = 3468; tag[3469] = atomtag;
+car[3468] = u('a'); cdr[3468] = 3467; tag[3468] = atomtag;
+car[3467] = u('b'); cdr[3467] = 3466; tag[3467] = atomtag;
+car[3466] = u('f'); cdr[3466] = 3465; tag[3466] = atomtag;
+car[3465] = u('u'); cdr[3465] = 3464; tag[3465] = atomtag;
+car[3464] = u('n'); cdr[3464] = 3463; tag[3464] = atomtag;
+car[3463] = u('s'); cdr[3463] = 0; tag[3463] = atomtag;
+car[3462] = 3461; cdr[3462] = 0; tag[3462] = 0;
+car[3461] = u('v'); cdr[3461] = 3460; tag[3461] = atomtag;
+car[3460] = u('a'); cdr[3460] = 3459; tag[3460] = atomtag;
+car[3459] = u('r'); cdr[3459] = 3458; tag[3459] = atomtag;
+car[3458] = u('s'); cdr[3458] = 0; tag[3458] = atomtag;
+car[3457] = 3456; cdr[3457] = 0; tag[3457] = 0;
+car[3456] = u('b'); cdr[3456] = 3455; tag[3456] = atomtag;
+car[3455] = u('a'); cdr[3455] = 3454; tag[3455] = atomtag;
+car[3454] = u('d'); cdr[3454] = 0; tag[3454] = atomtag;
+car[3453] = 3452; cdr[3453] = 0; tag[3453] = 0;
+car[3452] = u('s'); cdr[3452] = 3451; tag[3452] = atomtag;
+car[3451] = u('e'); cdr[3451] = 3450; tag[3451] = atomtag;
+car[3450] = u('e'); cdr[3450] = 3449; tag[3450] = atomtag;
+car[3449] = u('n'); cdr[3449] = 0; tag[3449] = atomtag;
+car[3448] = 3447; cdr[3448] = 0; tag[3448] = 0;
+car[3447] = u('d'); cdr[3447] = 3446; tag[3447] = atomtag;
+car[3446] = u('u'); cdr[3446] = 3445; tag[3446] = atomtag;
+car[3445] = u('m'); cdr[3445] = 3444; tag[3445] = atomtag;
+car[3444] = u('p'); cdr[3444] = 3443; tag[3444] = atomtag;
+car[3443] = u('-'); cdr[3443] = 3442; tag[3443] = atomtag;
+car[3442] = u('p'); cdr[3442] = 3441; tag[3442] = atomtag;
+car[3441] = u('o'); cdr[3441] = 3440; tag[3441] = atomtag;
+car[3440] = u('o'); cdr[3440] = 3439; tag[3440] = atomtag;
+car[3439] = u('l'); cdr[3439] = 0; tag[3439] = atomtag;
+car[3438] = 3437; cdr[3438] = 0; tag[3438] = 0;
+car[3437] = u('*'); cdr[3437] = 3436; tag[3437] = atomtag;
+car[3436] = u('*'); cdr[3436] = 3435; tag[3436] = atomtag;
+car[3435] = u('*'); cdr[3435] = 3434; tag[3435] = atomtag;
+car[3434] = u('*'); cdr[3434] = 3433; tag[3434] = atomtag;
+car[3433] = u('*'); cdr[3433] = 3432; tag[3433] = atomtag;
+car[3432] = u('*'); cdr[3432] = 3431; tag[3432] = atomtag;
+car[3431] = u('*'); cdr[3431] = 3430; tag[3431] = atomtag;
+car[3430] = u('*'); cdr[3430] = 3429; tag[3430] = atomtag;
+car[3429] = u('*'); cdr[3429] = 3428; tag[3429] = atomtag;
+car[3428] = u('*'); cdr[3428] = 3427; tag[3428] = atomtag;
+car[3427] = u('*'); cdr[3427] = 3426; tag[3427] = atomtag;
+car[3426] = u('*'); cdr[3426] = 3425; tag[3426] = atomtag;
+car[3425] = u('*'); cdr[3425] = 3424; tag[3425] = atomtag;
+car[3424] = u('*'); cdr[3424] = 3423; tag[3424] = atomtag;
+car[3423] = u('*'); cdr[3423] = 3422; tag[3423] = atomtag;
+car[3422] = u('*'); cdr[3422] = 3421; tag[3422] = atomtag;
+car[3421] = u('*'); cdr[3421] = 3420; tag[3421] = atomtag;
+car[3420] = u('*'); cdr[3420] = 3419; tag[3420] = atomtag;
+car[3419] = u('*'); cdr[3419] = 3418; tag[3419] = atomtag;
+car[3418] = u('*'); cdr[3418] = 3417; tag[3418] = atomtag;
+car[3417] = u('*'); cdr[3417] = 3416; tag[3417] = atomtag;
+car[3416] = u('*'); cdr[3416] = 3415; tag[3416] = atomtag;
+car[3415] = u('*'); cdr[3415] = 3414; tag[3415] = atomtag;
+car[3414] = u('*'); cdr[3414] = 3413; tag[3414] = atomtag;
+car[3413] = u('*'); cdr[3413] = 3412; tag[3413] = atomtag;
+car[3412] = u('*'); cdr[3412] = 3411; tag[3412] = atomtag;
+car[3411] = u('*'); cdr[3411] = 3410; tag[3411] = atomtag;
+car[3410] = u('*'); cdr[3410] = 3409; tag[3410] = atomtag;
+car[3409] = u('*'); cdr[3409] = 3408; tag[3409] = atomtag;
+car[3408] = u('*'); cdr[3408] = 3407; tag[3408] = atomtag;
+car[3407] = u('*'); cdr[3407] = 3406; tag[3407] = atomtag;
+car[3406] = u('*'); cdr[3406] = 3405; tag[3406] = atomtag;
+car[3405] = u('*'); cdr[3405] = 3404; tag[3405] = atomtag;
+car[3404] = u('*'); cdr[3404] = 3403; tag[3404] = atomtag;
+car[3403] = u('*'); cdr[3403] = 3402; tag[3403] = atomtag;
+car[3402] = u('/'); cdr[3402] = 0; tag[3402] = atomtag;
+car[3401] = 135; cdr[3401] = 0; tag[3401] = 0;
+car[3400] = 3399; cdr[3400] = 0; tag[3400] = 0;
+car[3399] = u('/'); cdr[3399] = 3398; tag[3399] = atomtag;
+car[3398] = u('*'); cdr[3398] = 3397; tag[3398] = atomtag;
+car[3397] = u('*'); cdr[3397] = 3396; tag[3397] = atomtag;
+car[3396] = u('*'); cdr[3396] = 3395; tag[3396] = atomtag;
+car[3395] = u('*'); cdr[3395] = 3394; tag[3395] = atomtag;
+car[3394] = u('*'); cdr[3394] = 3393; tag[3394] = atomtag;
+car[3393] = u('*'); cdr[3393] = 3392; tag[3393] = atomtag;
+car[3392] = u('*'); cdr[3392] = 3391; tag[3392] = atomtag;
+car[3391] = u('*'); cdr[3391] = 3390; tag[3391] = atomtag;
+car[3390] = u(' '); cdr[3390] = 3389; tag[3390] = atomtag;
+car[3389] = u('p'); cdr[3389] = 3388; tag[3389] = atomtag;
+car[3388] = u('o'); cdr[3388] = 3387; tag[3388] = atomtag;
+car[3387] = u('o'); cdr[3387] = 3386; tag[3387] = atomtag;
+car[3386] = u('l'); cdr[3386] = 3385; tag[3386] = atomtag;
+car[3385] = u(' '); cdr[3385] = 3384; tag[3385] = atomtag;
+car[3384] = u('d'); cdr[3384] = 3383; tag[3384] = atomtag;
+car[3383] = u('u'); cdr[3383] = 3382; tag[3383] = atomtag;
+car[3382] = u('m'); cdr[3382] = 3381; tag[3382] = atomtag;
+car[3381] = u('p'); cdr[3381] = 3380; tag[3381] = atomtag;
+car[3380] = u(' '); cdr[3380] = 3379; tag[3380] = atomtag;
+car[3379] = u('f'); cdr[3379] = 3378; tag[3379] = atomtag;
+car[3378] = u('o'); cdr[3378] = 3377; tag[3378] = atomtag;
+car[3377] = u('l'); cdr[3377] = 3376; tag[3377] = atomtag;
+car[3376] = u('l'); cdr[3376] = 3375; tag[3376] = atomtag;
+car[3375] = u('o'); cdr[3375] = 3374; tag[3375] = atomtag;
+car[3374] = u('w'); cdr[3374] = 3373; tag[3374] = atomtag;
+car[3373] = u('s'); cdr[3373] = 3372; tag[3373] = atomtag;
+car[3372] = u(' '); cdr[3372] = 3371; tag[3372] = atomtag;
+car[3371] = u('*'); cdr[3371] = 3370; tag[3371] = atomtag;
+car[3370] = u('*'); cdr[3370] = 3369; tag[3370] = atomtag;
+car[3369] = u('*'); cdr[3369] = 3368; tag[3369] = atomtag;
+car[3368] = u('*'); cdr[3368] = 3367; tag[3368] = atomtag;
+car[3367] = u('*'); cdr[3367] = 3366; tag[3367] = atomtag;
+car[3366] = u('*'); cdr[3366] = 3365; tag[3366] = atomtag;
+car[3365] = u('*'); cdr[3365] = 3364; tag[3365] = atomtag;
+car[3364] = u('*'); cdr[3364] = 0; tag[3364] = atomtag;
+car[3363] = 3362; cdr[3363] = 0; tag[3363] = 0;
+car[3362] = u('p'); cdr[3362] = 3361; tag[3362] = atomtag;
+car[3361] = u('o'); cdr[3361] = 3360; tag[3361] = atomtag;
+car[3360] = u('o'); cdr[3360] = 3359; tag[3360] = atomtag;
+car[3359] = u('l'); cdr[3359] = 3358; tag[3359] = atomtag;
+car[3358] = u('('); cdr[3358] = 0; tag[3358] = atomtag;
+car[3357] = 3356; cdr[3357] = 0; tag[3357] = 0;
+car[3356] = u('r'); cdr[3356] = 3355; tag[3356] = atomtag;
+car[3355] = u('e'); cdr[3355] = 3354; tag[3355] = atomtag;
+car[3354] = u('f'); cdr[3354] = 3353; tag[3354] = atomtag;
+car[3353] = u('('); cdr[3353] = 3352; tag[3353] = atomtag;
+car[3352] = u('s'); cdr[3352] = 3351; tag[3352] = atomtag;
+car[3351] = u('y'); cdr[3351] = 3350; tag[3351] = atomtag;
+car[3350] = u('m'); cdr[3350] = 3349; tag[3350] = atomtag;
+car[3349] = u('l'); cdr[3349] = 3348; tag[3349] = atomtag;
+car[3348] = u('i'); cdr[3348] = 3347; tag[3348] = atomtag;
+car[3347] = u('s'); cdr[3347] = 3346; tag[3347] = atomtag;
+car[3346] = u(')'); cdr[3346] = 3345; tag[3346] = atomtag;
+car[3345] = u(' '); cdr[3345] = 3344; tag[3345] = atomtag;
+car[3344] = u('='); cdr[3344] = 3343; tag[3344] = atomtag;
+car[3343] = u(' '); cdr[3343] = 0; tag[3343] = atomtag;
+car[3342] = 135; cdr[3342] = 0; tag[3342] = 0;
+car[3341] = 3340; cdr[3341] = 0; tag[3341] = 0;
+car[3340] = u('v'); cdr[3340] = 3339; tag[3340] = atomtag;
+car[3339] = u('o'); cdr[3339] = 3338; tag[3339] = atomtag;
+car[3338] = u('i'); cdr[3338] = 3337; tag[3338] = atomtag;
+car[3337] = u('d'); cdr[3337] = 3336; tag[3337] = atomtag;
+car[3336] = u(' '); cdr[3336] = 3335; tag[3336] = atomtag;
+car[3335] = u('s'); cdr[3335] = 3334; tag[3335] = atomtag;
+car[3334] = u('e'); cdr[3334] = 3333; tag[3334] = atomtag;
+car[3333] = u('t'); cdr[3333] = 3332; tag[3333] = atomtag;
+car[3332] = u('u'); cdr[3332] = 3331; tag[3332] = atomtag;
+car[3331] = u('p'); cdr[3331] = 3330; tag[3331] = atomtag;
+car[3330] = u('('); cdr[3330] = 3329; tag[3330] = atomtag;
+car[3329] = u('v'); cdr[3329] = 3328; tag[3329] = atomtag;
+car[3328] = u('o'); cdr[3328] = 3327; tag[3328] = atomtag;
+car[3327] = u('i'); cdr[3327] = 3326; tag[3327] = atomtag;
+car[3326] = u('d'); cdr[3326] = 3325; tag[3326] = atomtag;
+car[3325] = u(')'); cdr[3325] = 3324; tag[3325] = atomtag;
+car[3324] = u(' '); cdr[3324] = 3323; tag[3324] = atomtag;
+car[3323] = u('{'); cdr[3323] = 0; tag[3323] = atomtag;
+car[3322] = 3321; cdr[3322] = 0; tag[3322] = 0;
+car[3321] = u('e'); cdr[3321] = 3320; tag[3321] = atomtag;
+car[3320] = u('p'); cdr[3320] = 3319; tag[3320] = atomtag;
+car[3319] = u('i'); cdr[3319] = 3318; tag[3319] = atomtag;
+car[3318] = u('l'); cdr[3318] = 3317; tag[3318] = atomtag;
+car[3317] = u('o'); cdr[3317] = 3316; tag[3317] = atomtag;
+car[3316] = u('g'); cdr[3316] = 0; tag[3316] = atomtag;
+car[3315] = 3314; cdr[3315] = 0; tag[3315] = 0;
+car[3314] = u('s'); cdr[3314] = 3313; tag[3314] = atomtag;
+car[3313] = u('e'); cdr[3313] = 3312; tag[3313] = atomtag;
+car[3312] = u('t'); cdr[3312] = 3311; tag[3312] = atomtag;
+car[3311] = u('u'); cdr[3311] = 3310; tag[3311] = atomtag;
+car[3310] = u('p'); cdr[3310] = 3309; tag[3310] = atomtag;
+car[3309] = u('c'); cdr[3309] = 3308; tag[3309] = atomtag;
+car[3308] = u('o'); cdr[3308] = 3307; tag[3308] = atomtag;
+car[3307] = u('m'); cdr[3307] = 0; tag[3307] = atomtag;
+car[3306] = 3305; cdr[3306] = 0; tag[3306] = 0;
+car[3305] = u('}'); cdr[3305] = 3304; tag[3305] = atomtag;
+car[3304] = u('}'); cdr[3304] = 0; tag[3304] = atomtag;
+car[3303] = 3302; cdr[3303] = 0; tag[3303] = 0;
+car[3302] = u('r'); cdr[3302] = 3301; tag[3302] = atomtag;
+car[3301] = u('e'); cdr[3301] = 3300; tag[3301] = atomtag;
+car[3300] = u('t'); cdr[3300] = 3299; tag[3300] = atomtag;
+car[3299] = u('u'); cdr[3299] = 3298; tag[3299] = atomtag;
+car[3298] = u('r'); cdr[3298] = 3297; tag[3298] = atomtag;
+car[3297] = u('n'); cdr[3297] = 3296; tag[3297] = atomtag;
+car[3296] = u(';'); cdr[3296] = 0; tag[3296] = atomtag;
+car[3295] = 3294; cdr[3295] = 0; tag[3295] = 0;
+car[3294] = u('i'); cdr[3294] = 3293; tag[3294] = atomtag;
+car[3293] = u('n'); cdr[3293] = 3292; tag[3293] = atomtag;
+car[3292] = u('i'); cdr[3292] = 3291; tag[3292] = atomtag;
+car[3291] = u('t'); cdr[3291] = 3290; tag[3291] = atomtag;
+car[3290] = u('-'); cdr[3290] = 3289; tag[3290] = atomtag;
+car[3289] = u('c'); cdr[3289] = 3288; tag[3289] = atomtag;
+car[3288] = u('e'); cdr[3288] = 3287; tag[3288] = atomtag;
+car[3287] = u('l'); cdr[3287] = 3286; tag[3287] = atomtag;
+car[3286] = u('l'); cdr[3286] = 3285; tag[3286] = atomtag;
+car[3285] = u('s'); cdr[3285] = 0; tag[3285] = atomtag;
+car[3284] = 639; cdr[3284] = 0; tag[3284] = 0;
+car[3283] = 3282; cdr[3283] = 0; tag[3283] = 0;
+car[3282] = u('c'); cdr[3282] = 3281; tag[3282] = atomtag;
+car[3281] = u('a'); cdr[3281] = 3280; tag[3281] = atomtag;
+car[3280] = u('r'); cdr[3280] = 3279; tag[3280] = atomtag;
+car[3279] = u('['); cdr[3279] = 0; tag[3279] = atomtag;
+car[3278] = 3277; cdr[3278] = 0; tag[3278] = 0;
+car[3277] = u('c'); cdr[3277] = 3276; tag[3277] = atomtag;
+car[3276] = u('d'); cdr[3276] = 3275; tag[3276] = atomtag;
+car[3275] = u('r'); cdr[3275] = 3274; tag[3275] = atomtag;
+car[3274] = u('['); cdr[3274] = 0; tag[3274] = atomtag;
+car[3273] = 3272; cdr[3273] = 0; tag[3273] = 0;
+car[3272] = u(';'); cdr[3272] = 3271; tag[3272] = atomtag;
+car[3271] = u(' '); cdr[3271] = 0; tag[3271] = atomtag;
+car[3270] = 3269; cdr[3270] = 0; tag[3270] = 0;
+car[3269] = u('t'); cdr[3269] = 3268; tag[3269] = atomtag;
+car[3268] = u('a'); cdr[3268] = 3267; tag[3268] = atomtag;
+car[3267] = u('g'); cdr[3267] = 3266; tag[3267] = atomtag;
+car[3266] = u('['); cdr[3266] = 0; tag[3266] = atomtag;
+car[3265] = 3264; cdr[3265] = 0; tag[3265] = 0;
+car[3264] = u(']'); cdr[3264] = 3263; tag[3264] = atomtag;
+car[3263] = u(' '); cdr[3263] = 3262; tag[3263] = atomtag;
+car[3262] = u('='); cdr[3262] = 3261; tag[3262] = atomtag;
+car[3261] = u(' '); cdr[3261] = 0; tag[3261] = atomtag;
+car[3260] = 3259; cdr[3260] = 0; tag[3260] = 0;
+car[3259] = u('n'); cdr[3259] = 3258; tag[3259] = atomtag;
+car[3258] = u('u'); cdr[3258] = 3257; tag[3258] = atomtag;
+car[3257] = u('m'); cdr[3257] = 3256; tag[3257] = atomtag;
+car[3256] = u('t'); cdr[3256] = 3255; tag[3256] = atomtag;
+car[3255] = u('a'); cdr[3255] = 3254; tag[3255] = atomtag;
+car[3254] = u('g'); cdr[3254] = 0; tag[3254] = atomtag;
+car[3253] = 639; cdr[3253] = 0; tag[3253] = 0;
+car[3252] = 3251; cdr[3252] = 0; tag[3252] = 0;
+car[3251] = u('i'); cdr[3251] = 3250; tag[3251] = atomtag;
+car[3250] = u('n'); cdr[3250] = 3249; tag[3250] = atomtag;
+car[3249] = u('i'); cdr[3249] = 3248; tag[3249] = atomtag;
+car[3248] = u('t'); cdr[3248] = 0; tag[3248] = atomtag;
+car[3247] = 3246; cdr[3247] = 0; tag[3247] = 0;
+car[3246] = u('c'); cdr[3246] = 3245; tag[3246] = atomtag;
+car[3245] = u('h'); cdr[3245] = 3244; tag[3245] = atomtag;
+car[3244] = u('a'); cdr[3244] = 3243; tag[3244] = atomtag;
+car[3243] = u('r'); cdr[3243] = 0; tag[3243] = atomtag;
+car[3242] = 3241; cdr[3242] = 0; tag[3242] = 0;
+car[3241] = '\''; cdr[3241] = 3240; tag[3241] = atomtag;
+car[3240] = '\\'; cdr[3240] = 3239; tag[3240] = atomtag;
+car[3239] = '\\'; cdr[3239] = 3238; tag[3239] = atomtag;
+car[3238] = '\''; cdr[3238] = 0; tag[3238] = atomtag;
+car[3237] = 3236; cdr[3237] = 0; tag[3237] = 0;
+car[3236] = '\\'; cdr[3236] = 0; tag[3236] = atomtag;
+car[3235] = 3234; cdr[3235] = 0; tag[3235] = 0;
+car[3234] = '\''; cdr[3234] = 3233; tag[3234] = atomtag;
+car[3233] = '\\'; cdr[3233] = 3232; tag[3233] = atomtag;
+car[3232] = '\''; cdr[3232] = 3231; tag[3232] = atomtag;
+car[3231] = '\''; cdr[3231] = 0; tag[3231] = atomtag;
+car[3230] = 3229; cdr[3230] = 0; tag[3230] = 0;
+car[3229] = '\''; cdr[3229] = 0; tag[3229] = atomtag;
+car[3228] = 3227; cdr[3228] = 0; tag[3228] = 0;
+car[3227] = '\''; cdr[3227] = 3226; tag[3227] = atomtag;
+car[3226] = '\\'; cdr[3226] = 3225; tag[3226] = atomtag;
+car[3225] = u('n'); cdr[3225] = 3224; tag[3225] = atomtag;
+car[3224] = '\''; cdr[3224] = 0; tag[3224] = atomtag;
+car[3223] = 600; cdr[3223] = 0; tag[3223] = 0;
+car[3222] = 3221; cdr[3222] = 0; tag[3222] = 0;
+car[3221] = u('e'); cdr[3221] = 3220; tag[3221] = atomtag;
+car[3220] = u('m'); cdr[3220] = 3219; tag[3220] = atomtag;
+car[3219] = u('i'); cdr[3219] = 3218; tag[3219] = atomtag;
+car[3218] = u('t'); cdr[3218] = 3217; tag[3218] = atomtag;
+car[3217] = u('-'); cdr[3217] = 3216; tag[3217] = atomtag;
+car[3216] = u('o'); cdr[3216] = 3215; tag[3216] = atomtag;
+car[3215] = u('b'); cdr[3215] = 3214; tag[3215] = atomtag;
+car[3214] = u('l'); cdr[3214] = 3213; tag[3214] = atomtag;
+car[3213] = u('i'); cdr[3213] = 3212; tag[3213] = atomtag;
+car[3212] = u('s'); cdr[3212] = 3211; tag[3212] = atomtag;
+car[3211] = u('t'); cdr[3211] = 0; tag[3211] = atomtag;
+car[3210] = 3209; cdr[3210] = 0; tag[3210] = 0;
+car[3209] = u('r'); cdr[3209] = 3208; tag[3209] = atomtag;
+car[3208] = u('e'); cdr[3208] = 3207; tag[3208] = atomtag;
+car[3207] = u('f'); cdr[3207] = 3206; tag[3207] = atomtag;
+car[3206] = u('('); cdr[3206] = 3205; tag[3206] = atomtag;
+car[3205] = u('o'); cdr[3205] = 3204; tag[3205] = atomtag;
+car[3204] = u('b'); cdr[3204] = 3203; tag[3204] = atomtag;
+car[3203] = u('l'); cdr[3203] = 3202; tag[3203] = atomtag;
+car[3202] = u('i'); cdr[3202] = 3201; tag[3202] = atomtag;
+car[3201] = u('s'); cdr[3201] = 3200; tag[3201] = atomtag;
+car[3200] = u('t'); cdr[3200] = 3199; tag[3200] = atomtag;
+car[3199] = u(')'); cdr[3199] = 3198; tag[3199] = atomtag;
+car[3198] = u(' '); cdr[3198] = 3197; tag[3198] = atomtag;
+car[3197] = u('='); cdr[3197] = 3196; tag[3197] = atomtag;
+car[3196] = u(' '); cdr[3196] = 0; tag[3196] = atomtag;
+car[3195] = 3194; cdr[3195] = 3191; tag[3195] = 0;
+car[3194] = 3193; cdr[3194] = 0; tag[3194] = 0;
+car[3193] = u('o'); cdr[3193] = 3192; tag[3193] = atomtag;
+car[3192] = u('l'); cdr[3192] = 0; tag[3192] = atomtag;
+car[3191] = 412; cdr[3191] = 0; tag[3191] = 0;
+car[3190] = 3189; cdr[3190] = 0; tag[3190] = 0;
+car[3189] = u('p'); cdr[3189] = 3188; tag[3189] = atomtag;
+car[3188] = u('r'); cdr[3188] = 3187; tag[3188] = atomtag;
+car[3187] = u('o'); cdr[3187] = 3186; tag[3187] = atomtag;
+car[3186] = u('l'); cdr[3186] = 3185; tag[3186] = atomtag;
+car[3185] = u('o'); cdr[3185] = 3184; tag[3185] = atomtag;
+car[3184] = u('g'); cdr[3184] = 0; tag[3184] = atomtag;
+car[3183] = 3182; cdr[3183] = 0; tag[3183] = 0;
+car[3182] = u('c'); cdr[3182] = 3181; tag[3182] = atomtag;
+car[3181] = u('a'); cdr[3181] = 3180; tag[3181] = atomtag;
+car[3180] = u('s'); cdr[3180] = 3179; tag[3180] = atomtag;
+car[3179] = u('e'); cdr[3179] = 3178; tag[3179] = atomtag;
+car[3178] = u(' '); cdr[3178] = 3177; tag[3178] = atomtag;
+car[3177] = u('0'); cdr[3177] = 3176; tag[3177] = atomtag;
+car[3176] = u(':'); cdr[3176] = 0; tag[3176] = atomtag;
+car[3175] = 3174; cdr[3175] = 0; tag[3175] = 0;
+car[3174] = u('f'); cdr[3174] = 3173; tag[3174] = atomtag;
+car[3173] = u('o'); cdr[3173] = 3172; tag[3173] = atomtag;
+car[3172] = u('r'); cdr[3172] = 3171; tag[3172] = atomtag;
+car[3171] = u(' '); cdr[3171] = 3170; tag[3171] = atomtag;
+car[3170] = u('('); cdr[3170] = 3169; tag[3170] = atomtag;
+car[3169] = u('k'); cdr[3169] = 3168; tag[3169] = atomtag;
+car[3168] = u('='); cdr[3168] = 3167; tag[3168] = atomtag;
+car[3167] = u('0'); cdr[3167] = 3166; tag[3167] = atomtag;
+car[3166] = u(';'); cdr[3166] = 3165; tag[3166] = atomtag;
+car[3165] = u(';'); cdr[3165] = 3164; tag[3165] = atomtag;
+car[3164] = u(')'); cdr[3164] = 3163; tag[3164] = atomtag;
+car[3163] = u(' '); cdr[3163] = 3162; tag[3163] = atomtag;
+car[3162] = u('s'); cdr[3162] = 3161; tag[3162] = atomtag;
+car[3161] = u('w'); cdr[3161] = 3160; tag[3161] = atomtag;
+car[3160] = u('i'); cdr[3160] = 3159; tag[3160] = atomtag;
+car[3159] = u('t'); cdr[3159] = 3158; tag[3159] = atomtag;
+car[3158] = u('c'); cdr[3158] = 3157; tag[3158] = atomtag;
+car[3157] = u('h'); cdr[3157] = 3156; tag[3157] = atomtag;
+car[3156] = u(' '); cdr[3156] = 3155; tag[3156] = atomtag;
+car[3155] = u('('); cdr[3155] = 3154; tag[3155] = atomtag;
+car[3154] = u('k'); cdr[3154] = 3153; tag[3154] = atomtag;
+car[3153] = u(')'); cdr[3153] = 3152; tag[3153] = atomtag;
+car[3152] = u(' '); cdr[3152] = 3151; tag[3152] = atomtag;
+car[3151] = u('{'); cdr[3151] = 0; tag[3151] = atomtag;
 car[3150] = 3149; cdr[3150] = 0; tag[3150] = 0;
-car[3149] = u('/'); cdr[3149] = 0; tag[3149] = atomtag;
-car[3148] = 2698; cdr[3148] = 3147; tag[3148] = 0;
-car[3147] = 2441; cdr[3147] = 0; tag[3147] = 0;
-car[3146] = 3145; cdr[3146] = 3141; tag[3146] = 0;
-car[3145] = 3144; cdr[3145] = 3142; tag[3145] = 0;
-car[3144] = 3143; cdr[3144] = 0; tag[3144] = 0;
-car[3143] = u(','); cdr[3143] = 0; tag[3143] = atomtag;
-car[3142] = 1562; cdr[3142] = 0; tag[3142] = 0;
-car[3141] = 3140; cdr[3141] = 3136; tag[3141] = 0;
-car[3140] = 1281; cdr[3140] = 3139; tag[3140] = 0;
-car[3139] = 2619; cdr[3139] = 3138; tag[3139] = 0;
-car[3138] = 1281; cdr[3138] = 3137; tag[3138] = 0;
-car[3137] = 1271; cdr[3137] = 0; tag[3137] = 0;
-car[3136] = 3135; cdr[3136] = 3132; tag[3136] = 0;
-car[3135] = 970; cdr[3135] = 3134; tag[3135] = 0;
-car[3134] = 2586; cdr[3134] = 3133; tag[3134] = 0;
-car[3133] = 970; cdr[3133] = 0; tag[3133] = 0;
-car[3132] = 3131; cdr[3132] = 3126; tag[3132] = 0;
-car[3131] = 968; cdr[3131] = 3130; tag[3131] = 0;
-car[3130] = 2562; cdr[3130] = 3129; tag[3130] = 0;
-car[3129] = 2557; cdr[3129] = 3128; tag[3129] = 0;
-car[3128] = 2552; cdr[3128] = 3127; tag[3128] = 0;
-car[3127] = 968; cdr[3127] = 0; tag[3127] = 0;
-car[3126] = 3125; cdr[3126] = 3123; tag[3126] = 0;
-car[3125] = 920; cdr[3125] = 3124; tag[3125] = 0;
-car[3124] = 920; cdr[3124] = 0; tag[3124] = 0;
-car[3123] = 3122; cdr[3123] = 3120; tag[3123] = 0;
-car[3122] = 912; cdr[3122] = 3121; tag[3122] = 0;
-car[3121] = 912; cdr[3121] = 0; tag[3121] = 0;
-car[3120] = 3119; cdr[3120] = 3115; tag[3120] = 0;
-car[3119] = 828; cdr[3119] = 3118; tag[3119] = 0;
-car[3118] = 2746; cdr[3118] = 3117; tag[3118] = 0;
-car[3117] = 2225; cdr[3117] = 3116; tag[3117] = 0;
-car[3116] = 828; cdr[3116] = 0; tag[3116] = 0;
-car[3115] = 3114; cdr[3115] = 3111; tag[3115] = 0;
-car[3114] = 821; cdr[3114] = 3113; tag[3114] = 0;
-car[3113] = 1362; cdr[3113] = 3112; tag[3113] = 0;
-car[3112] = 821; cdr[3112] = 0; tag[3112] = 0;
-car[3111] = 3110; cdr[3111] = 3108; tag[3111] = 0;
-car[3110] = 814; cdr[3110] = 3109; tag[3110] = 0;
-car[3109] = 814; cdr[3109] = 0; tag[3109] = 0;
-car[3108] = 3107; cdr[3108] = 3102; tag[3108] = 0;
-car[3107] = 811; cdr[3107] = 3106; tag[3107] = 0;
-car[3106] = 1503; cdr[3106] = 3105; tag[3106] = 0;
-car[3105] = 1478; cdr[3105] = 3104; tag[3105] = 0;
-car[3104] = 1404; cdr[3104] = 3103; tag[3104] = 0;
-car[3103] = 811; cdr[3103] = 0; tag[3103] = 0;
-car[3102] = 3101; cdr[3102] = 3097; tag[3102] = 0;
-car[3101] = 805; cdr[3101] = 3100; tag[3101] = 0;
-car[3100] = 2518; cdr[3100] = 3099; tag[3100] = 0;
-car[3099] = 1110; cdr[3099] = 3098; tag[3099] = 0;
-car[3098] = 805; cdr[3098] = 0; tag[3098] = 0;
-car[3097] = 3096; cdr[3097] = 3093; tag[3097] = 0;
-car[3096] = 799; cdr[3096] = 3095; tag[3096] = 0;
-car[3095] = 918; cdr[3095] = 3094; tag[3095] = 0;
-car[3094] = 799; cdr[3094] = 0; tag[3094] = 0;
-car[3093] = 3092; cdr[3093] = 3087; tag[3093] = 0;
-car[3092] = 791; cdr[3092] = 3091; tag[3092] = 0;
-car[3091] = 1385; cdr[3091] = 3090; tag[3091] = 0;
-car[3090] = 948; cdr[3090] = 3089; tag[3090] = 0;
-car[3089] = 910; cdr[3089] = 3088; tag[3089] = 0;
-car[3088] = 791; cdr[3088] = 0; tag[3088] = 0;
-car[3087] = 3086; cdr[3087] = 3084; tag[3087] = 0;
-car[3086] = 782; cdr[3086] = 3085; tag[3086] = 0;
-car[3085] = 782; cdr[3085] = 0; tag[3085] = 0;
-car[3084] = 3083; cdr[3084] = 3081; tag[3084] = 0;
-car[3083] = 776; cdr[3083] = 3082; tag[3083] = 0;
-car[3082] = 776; cdr[3082] = 0; tag[3082] = 0;
-car[3081] = 3080; cdr[3081] = 3078; tag[3081] = 0;
-car[3080] = 773; cdr[3080] = 3079; tag[3080] = 0;
-car[3079] = 773; cdr[3079] = 0; tag[3079] = 0;
-car[3078] = 3077; cdr[3078] = 3075; tag[3078] = 0;
-car[3077] = 770; cdr[3077] = 3076; tag[3077] = 0;
-car[3076] = 770; cdr[3076] = 0; tag[3076] = 0;
-car[3075] = 3074; cdr[3075] = 3072; tag[3075] = 0;
-car[3074] = 767; cdr[3074] = 3073; tag[3074] = 0;
-car[3073] = 767; cdr[3073] = 0; tag[3073] = 0;
-car[3072] = 3071; cdr[3072] = 3069; tag[3072] = 0;
-car[3071] = 764; cdr[3071] = 3070; tag[3071] = 0;
-car[3070] = 764; cdr[3070] = 0; tag[3070] = 0;
-car[3069] = 3068; cdr[3069] = 3066; tag[3069] = 0;
-car[3068] = 761; cdr[3068] = 3067; tag[3068] = 0;
-car[3067] = 761; cdr[3067] = 0; tag[3067] = 0;
-car[3066] = 3065; cdr[3066] = 3063; tag[3066] = 0;
-car[3065] = 758; cdr[3065] = 3064; tag[3065] = 0;
-car[3064] = 758; cdr[3064] = 0; tag[3064] = 0;
-car[3063] = 3062; cdr[3063] = 3060; tag[3063] = 0;
-car[3062] = 755; cdr[3062] = 3061; tag[3062] = 0;
-car[3061] = 755; cdr[3061] = 0; tag[3061] = 0;
-car[3060] = 3059; cdr[3060] = 3057; tag[3060] = 0;
-car[3059] = 752; cdr[3059] = 3058; tag[3059] = 0;
-car[3058] = 752; cdr[3058] = 0; tag[3058] = 0;
-car[3057] = 3056; cdr[3057] = 3054; tag[3057] = 0;
-car[3056] = 749; cdr[3056] = 3055; tag[3056] = 0;
-car[3055] = 749; cdr[3055] = 0; tag[3055] = 0;
-car[3054] = 3053; cdr[3054] = 3051; tag[3054] = 0;
-car[3053] = 746; cdr[3053] = 3052; tag[3053] = 0;
-car[3052] = 746; cdr[3052] = 0; tag[3052] = 0;
-car[3051] = 3050; cdr[3051] = 3044; tag[3051] = 0;
-car[3050] = 645; cdr[3050] = 3049; tag[3050] = 0;
-car[3049] = 2638; cdr[3049] = 3048; tag[3049] = 0;
-car[3048] = 2458; cdr[3048] = 3047; tag[3048] = 0;
-car[3047] = 1335; cdr[3047] = 3046; tag[3047] = 0;
-car[3046] = 1290; cdr[3046] = 3045; tag[3046] = 0;
-car[3045] = 645; cdr[3045] = 0; tag[3045] = 0;
-car[3044] = 3043; cdr[3044] = 3034; tag[3044] = 0;
-car[3043] = 643; cdr[3043] = 3042; tag[3043] = 0;
-car[3042] = 2499; cdr[3042] = 3041; tag[3042] = 0;
-car[3041] = 1510; cdr[3041] = 3040; tag[3041] = 0;
-car[3040] = 1430; cdr[3040] = 3039; tag[3040] = 0;
-car[3039] = 1353; cdr[3039] = 3038; tag[3039] = 0;
-car[3038] = 986; cdr[3038] = 3037; tag[3038] = 0;
-car[3037] = 643; cdr[3037] = 3036; tag[3037] = 0;
-car[3036] = 636; cdr[3036] = 3035; tag[3036] = 0;
-car[3035] = 630; cdr[3035] = 0; tag[3035] = 0;
-car[3034] = 3033; cdr[3034] = 3020; tag[3034] = 0;
-car[3033] = 795; cdr[3033] = 3032; tag[3033] = 0;
-car[3032] = 2474; cdr[3032] = 3031; tag[3032] = 0;
-car[3031] = 1918; cdr[3031] = 3030; tag[3031] = 0;
-car[3030] = 1774; cdr[3030] = 3029; tag[3030] = 0;
-car[3029] = 1349; cdr[3029] = 3028; tag[3029] = 0;
-car[3028] = 1343; cdr[3028] = 3027; tag[3028] = 0;
-car[3027] = 1315; cdr[3027] = 3026; tag[3027] = 0;
-car[3026] = 1103; cdr[3026] = 3025; tag[3026] = 0;
-car[3025] = 1063; cdr[3025] = 3024; tag[3025] = 0;
-car[3024] = 857; cdr[3024] = 3023; tag[3024] = 0;
-car[3023] = 851; cdr[3023] = 3022; tag[3023] = 0;
-car[3022] = 795; cdr[3022] = 3021; tag[3022] = 0;
-car[3021] = 614; cdr[3021] = 0; tag[3021] = 0;
-car[3020] = 3019; cdr[3020] = 3017; tag[3020] = 0;
-car[3019] = 589; cdr[3019] = 3018; tag[3019] = 0;
-car[3018] = 589; cdr[3018] = 0; tag[3018] = 0;
-car[3017] = 3016; cdr[3017] = 3013; tag[3017] = 0;
-car[3016] = 587; cdr[3016] = 3015; tag[3016] = 0;
-car[3015] = 587; cdr[3015] = 3014; tag[3015] = 0;
-car[3014] = 585; cdr[3014] = 0; tag[3014] = 0;
-car[3013] = 3012; cdr[3013] = 2999; tag[3013] = 0;
-car[3012] = 572; cdr[3012] = 3011; tag[3012] = 0;
-car[3011] = 2608; cdr[3011] = 3010; tag[3011] = 0;
-car[3010] = 2572; cdr[3010] = 3009; tag[3010] = 0;
-car[3009] = 2465; cdr[3009] = 3008; tag[3009] = 0;
-car[3008] = 2033; cdr[3008] = 3007; tag[3008] = 0;
-car[3007] = 1978; cdr[3007] = 3006; tag[3007] = 0;
-car[3006] = 1262; cdr[3006] = 3005; tag[3006] = 0;
-car[3005] = 1081; cdr[3005] = 3004; tag[3005] = 0;
-car[3004] = 1076; cdr[3004] = 3003; tag[3004] = 0;
-car[3003] = 697; cdr[3003] = 3002; tag[3003] = 0;
-car[3002] = 678; cdr[3002] = 3001; tag[3002] = 0;
-car[3001] = 652; cdr[3001] = 3000; tag[3001] = 0;
-car[3000] = 572; cdr[3000] = 0; tag[3000] = 0;
-car[2999] = 2998; cdr[2999] = 2994; tag[2999] = 0;
-car[2998] = 567; cdr[2998] = 2997; tag[2998] = 0;
-car[2997] = 1752; cdr[2997] = 2996; tag[2997] = 0;
-car[2996] = 1746; cdr[2996] = 2995; tag[2996] = 0;
-car[2995] = 567; cdr[2995] = 0; tag[2995] = 0;
-car[2994] = 2993; cdr[2994] = 2989; tag[2994] = 0;
-car[2993] = 2992; cdr[2993] = 2990; tag[2993] = 0;
-car[2992] = 2991; cdr[2992] = 0; tag[2992] = 0;
-car[2991] = u('.'); cdr[2991] = 0; tag[2991] = atomtag;
-car[2990] = 562; cdr[2990] = 0; tag[2990] = 0;
-car[2989] = 2988; cdr[2989] = 2975; tag[2989] = 0;
-car[2988] = 802; cdr[2988] = 2987; tag[2988] = 0;
-car[2987] = 2514; cdr[2987] = 2986; tag[2987] = 0;
-car[2986] = 1913; cdr[2986] = 2985; tag[2986] = 0;
-car[2985] = 1783; cdr[2985] = 2984; tag[2985] = 0;
-car[2984] = 1588; cdr[2984] = 2983; tag[2984] = 0;
-car[2983] = 802; cdr[2983] = 2982; tag[2983] = 0;
-car[2982] = 666; cdr[2982] = 2981; tag[2982] = 0;
-car[2981] = 602; cdr[2981] = 2980; tag[2981] = 0;
-car[2980] = 595; cdr[2980] = 2979; tag[2980] = 0;
-car[2979] = 565; cdr[2979] = 2978; tag[2979] = 0;
-car[2978] = 558; cdr[2978] = 2977; tag[2978] = 0;
-car[2977] = 550; cdr[2977] = 2976; tag[2977] = 0;
-car[2976] = 541; cdr[2976] = 0; tag[2976] = 0;
-car[2975] = 2974; cdr[2975] = 2970; tag[2975] = 0;
-car[2974] = 787; cdr[2974] = 2973; tag[2974] = 0;
-car[2973] = 2399; cdr[2973] = 2972; tag[2973] = 0;
-car[2972] = 787; cdr[2972] = 2971; tag[2972] = 0;
-car[2971] = 529; cdr[2971] = 0; tag[2971] = 0;
-car[2970] = 2969; cdr[2970] = 2955; tag[2970] = 0;
-car[2969] = 639; cdr[2969] = 2968; tag[2969] = 0;
-car[2968] = 1622; cdr[2968] = 2967; tag[2968] = 0;
-car[2967] = 1179; cdr[2967] = 2966; tag[2967] = 0;
-car[2966] = 1155; cdr[2966] = 2965; tag[2966] = 0;
-car[2965] = 1142; cdr[2965] = 2964; tag[2965] = 0;
-car[2964] = 1126; cdr[2964] = 2963; tag[2964] = 0;
-car[2963] = 705; cdr[2963] = 2962; tag[2963] = 0;
-car[2962] = 688; cdr[2962] = 2961; tag[2962] = 0;
-car[2961] = 639; cdr[2961] = 2960; tag[2961] = 0;
-car[2960] = 623; cdr[2960] = 2959; tag[2960] = 0;
-car[2959] = 490; cdr[2959] = 2958; tag[2959] = 0;
-car[2958] = 473; cdr[2958] = 2957; tag[2958] = 0;
-car[2957] = 462; cdr[2957] = 2956; tag[2957] = 0;
-car[2956] = 442; cdr[2956] = 0; tag[2956] = 0;
-car[2955] = 2954; cdr[2955] = 2950; tag[2955] = 0;
-car[2954] = 330; cdr[2954] = 2953; tag[2954] = 0;
-car[2953] = 1375; cdr[2953] = 2952; tag[2953] = 0;
-car[2952] = 1219; cdr[2952] = 2951; tag[2952] = 0;
-car[2951] = 330; cdr[2951] = 0; tag[2951] = 0;
-car[2950] = 2949; cdr[2950] = 2910; tag[2950] = 0;
-car[2949] = 464; cdr[2949] = 2948; tag[2949] = 0;
-car[2948] = 2654; cdr[2948] = 2947; tag[2948] = 0;
-car[2947] = 2616; cdr[2947] = 2946; tag[2947] = 0;
-car[2946] = 2534; cdr[2946] = 2945; tag[2946] = 0;
-car[2945] = 2298; cdr[2945] = 2944; tag[2945] = 0;
-car[2944] = 2267; cdr[2944] = 2943; tag[2944] = 0;
-car[2943] = 2156; cdr[2943] = 2942; tag[2943] = 0;
-car[2942] = 2107; cdr[2942] = 2941; tag[2942] = 0;
-car[2941] = 2077; cdr[2941] = 2940; tag[2941] = 0;
-car[2940] = 2061; cdr[2940] = 2939; tag[2940] = 0;
-car[2939] = 2006; cdr[2939] = 2938; tag[2939] = 0;
-car[2938] = 1951; cdr[2938] = 2937; tag[2938] = 0;
-car[2937] = 1889; cdr[2937] = 2936; tag[2937] = 0;
-car[2936] = 1872; cdr[2936] = 2935; tag[2936] = 0;
-car[2935] = 1852; cdr[2935] = 2934; tag[2935] = 0;
-car[2934] = 1831; cdr[2934] = 2933; tag[2934] = 0;
-car[2933] = 1803; cdr[2933] = 2932; tag[2933] = 0;
-car[2932] = 1695; cdr[2932] = 2931; tag[2932] = 0;
-car[2931] = 1581; cdr[2931] = 2930; tag[2931] = 0;
-car[2930] = 1482; cdr[2930] = 2929; tag[2930] = 0;
-car[2929] = 1423; cdr[2929] = 2928; tag[2929] = 0;
-car[2928] = 1238; cdr[2928] = 2927; tag[2928] = 0;
-car[2927] = 991; cdr[2927] = 2926; tag[2927] = 0;
-car[2926] = 955; cdr[2926] = 2925; tag[2926] = 0;
-car[2925] = 928; cdr[2925] = 2924; tag[2925] = 0;
-car[2924] = 888; cdr[2924] = 2923; tag[2924] = 0;
-car[2923] = 875; cdr[2923] = 2922; tag[2923] = 0;
-car[2922] = 866; cdr[2922] = 2921; tag[2922] = 0;
-car[2921] = 672; cdr[2921] = 2920; tag[2921] = 0;
-car[2920] = 519; cdr[2920] = 2919; tag[2920] = 0;
-car[2919] = 506; cdr[2919] = 2918; tag[2919] = 0;
-car[2918] = 497; cdr[2918] = 2917; tag[2918] = 0;
-car[2917] = 464; cdr[2917] = 2916; tag[2917] = 0;
-car[2916] = 350; cdr[2916] = 2915; tag[2916] = 0;
-car[2915] = 341; cdr[2915] = 2914; tag[2915] = 0;
-car[2914] = 328; cdr[2914] = 2913; tag[2914] = 0;
-car[2913] = 321; cdr[2913] = 2912; tag[2913] = 0;
-car[2912] = 297; cdr[2912] = 2911; tag[2912] = 0;
-car[2911] = 290; cdr[2911] = 0; tag[2911] = 0;
-car[2910] = 2909; cdr[2910] = 2898; tag[2910] = 0;
-car[2909] = 570; cdr[2909] = 2908; tag[2909] = 0;
-car[2908] = 1444; cdr[2908] = 2907; tag[2908] = 0;
-car[2907] = 1088; cdr[2907] = 2906; tag[2907] = 0;
-car[2906] = 1012; cdr[2906] = 2905; tag[2906] = 0;
-car[2905] = 570; cdr[2905] = 2904; tag[2905] = 0;
-car[2904] = 425; cdr[2904] = 2903; tag[2904] = 0;
-car[2903] = 401; cdr[2903] = 2902; tag[2903] = 0;
-car[2902] = 392; cdr[2902] = 2901; tag[2902] = 0;
-car[2901] = 359; cdr[2901] = 2900; tag[2901] = 0;
-car[2900] = 266; cdr[2900] = 2899; tag[2900] = 0;
-car[2899] = 262; cdr[2899] = 0; tag[2899] = 0;
-car[2898] = 2897; cdr[2898] = 2883; tag[2898] = 0;
-car[2897] = 574; cdr[2897] = 2896; tag[2897] = 0;
-car[2896] = 2760; cdr[2896] = 2895; tag[2896] = 0;
-car[2895] = 2248; cdr[2895] = 2894; tag[2895] = 0;
-car[2894] = 1907; cdr[2894] = 2893; tag[2894] = 0;
-car[2893] = 1900; cdr[2893] = 2892; tag[2893] = 0;
-car[2892] = 1595; cdr[2892] = 2891; tag[2892] = 0;
-car[2891] = 1548; cdr[2891] = 2890; tag[2891] = 0;
-car[2890] = 1537; cdr[2890] = 2889; tag[2890] = 0;
-car[2889] = 1369; cdr[2889] = 2888; tag[2889] = 0;
-car[2888] = 1115; cdr[2888] = 2887; tag[2888] = 0;
-car[2887] = 1002; cdr[2887] = 2886; tag[2887] = 0;
-car[2886] = 574; cdr[2886] = 2885; tag[2886] = 0;
-car[2885] = 417; cdr[2885] = 2884; tag[2885] = 0;
-car[2884] = 256; cdr[2884] = 0; tag[2884] = 0;
-car[2883] = 2882; cdr[2883] = 2878; tag[2883] = 0;
-car[2882] = 818; cdr[2882] = 2881; tag[2882] = 0;
-car[2881] = 2189; cdr[2881] = 2880; tag[2881] = 0;
-car[2880] = 818; cdr[2880] = 2879; tag[2880] = 0;
-car[2879] = 171; cdr[2879] = 0; tag[2879] = 0;
-car[2878] = 2877; cdr[2878] = 2866; tag[2878] = 0;
-car[2877] = 825; cdr[2877] = 2876; tag[2877] = 0;
-car[2876] = 2661; cdr[2876] = 2875; tag[2876] = 0;
-car[2875] = 2546; cdr[2875] = 2874; tag[2875] = 0;
-car[2874] = 1210; cdr[2874] = 2873; tag[2874] = 0;
-car[2873] = 1197; cdr[2873] = 2872; tag[2873] = 0;
-car[2872] = 825; cdr[2872] = 2871; tag[2872] = 0;
-car[2871] = 744; cdr[2871] = 2870; tag[2871] = 0;
-car[2870] = 736; cdr[2870] = 2869; tag[2870] = 0;
-car[2869] = 711; cdr[2869] = 2868; tag[2869] = 0;
-car[2868] = 433; cdr[2868] = 2867; tag[2868] = 0;
-car[2867] = 165; cdr[2867] = 0; tag[2867] = 0;
-car[2866] = 2865; cdr[2866] = 2863; tag[2866] = 0;
-car[2865] = 153; cdr[2865] = 2864; tag[2865] = 0;
-car[2864] = 153; cdr[2864] = 0; tag[2864] = 0;
-car[2863] = 2862; cdr[2863] = 2835; tag[2863] = 0;
-car[2862] = 521; cdr[2862] = 2861; tag[2862] = 0;
-car[2861] = 2596; cdr[2861] = 2860; tag[2861] = 0;
-car[2860] = 2591; cdr[2860] = 2859; tag[2860] = 0;
-car[2859] = 2567; cdr[2859] = 2858; tag[2859] = 0;
-car[2858] = 2507; cdr[2858] = 2857; tag[2858] = 0;
-car[2857] = 2372; cdr[2857] = 2856; tag[2857] = 0;
-car[2856] = 2335; cdr[2856] = 2855; tag[2856] = 0;
-car[2855] = 1894; cdr[2855] = 2854; tag[2855] = 0;
-car[2854] = 1704; cdr[2854] = 2853; tag[2854] = 0;
-car[2853] = 1279; cdr[2853] = 2852; tag[2853] = 0;
-car[2852] = 1094; cdr[2852] = 2851; tag[2852] = 0;
-car[2851] = 521; cdr[2851] = 2850; tag[2851] = 0;
-car[2850] = 251; cdr[2850] = 2849; tag[2850] = 0;
-car[2849] = 244; cdr[2849] = 2848; tag[2849] = 0;
-car[2848] = 237; cdr[2848] = 2847; tag[2848] = 0;
-car[2847] = 230; cdr[2847] = 2846; tag[2847] = 0;
-car[2846] = 223; cdr[2846] = 2845; tag[2846] = 0;
-car[2845] = 216; cdr[2845] = 2844; tag[2845] = 0;
-car[2844] = 209; cdr[2844] = 2843; tag[2844] = 0;
-car[2843] = 202; cdr[2843] = 2842; tag[2843] = 0;
-car[2842] = 195; cdr[2842] = 2841; tag[2842] = 0;
-car[2841] = 189; cdr[2841] = 2840; tag[2841] = 0;
-car[2840] = 183; cdr[2840] = 2839; tag[2840] = 0;
-car[2839] = 177; cdr[2839] = 2838; tag[2839] = 0;
-car[2838] = 160; cdr[2838] = 2837; tag[2838] = 0;
-car[2837] = 151; cdr[2837] = 2836; tag[2837] = 0;
-car[2836] = 146; cdr[2836] = 0; tag[2836] = 0;
-car[2835] = 2834; cdr[2835] = 2825; tag[2835] = 0;
-car[2834] = 333; cdr[2834] = 2833; tag[2834] = 0;
-car[2833] = 1640; cdr[2833] = 2832; tag[2833] = 0;
-car[2832] = 1191; cdr[2832] = 2831; tag[2832] = 0;
-car[2831] = 1166; cdr[2831] = 2830; tag[2831] = 0;
-car[2830] = 1027; cdr[2830] = 2829; tag[2830] = 0;
-car[2829] = 450; cdr[2829] = 2828; tag[2829] = 0;
-car[2828] = 410; cdr[2828] = 2827; tag[2828] = 0;
-car[2827] = 333; cdr[2827] = 2826; tag[2827] = 0;
-car[2826] = 141; cdr[2826] = 0; tag[2826] = 0;
-car[2825] = 2824; cdr[2825] = 2822; tag[2825] = 0;
-car[2824] = 135; cdr[2824] = 2823; tag[2824] = 0;
-car[2823] = 135; cdr[2823] = 0; tag[2823] = 0;
-car[2822] = 2821; cdr[2822] = 2819; tag[2822] = 0;
-car[2821] = 129; cdr[2821] = 2820; tag[2821] = 0;
-car[2820] = 129; cdr[2820] = 0; tag[2820] = 0;
-car[2819] = 2818; cdr[2819] = 2811; tag[2819] = 0;
-car[2818] = 123; cdr[2818] = 2817; tag[2818] = 0;
-car[2817] = 1664; cdr[2817] = 2816; tag[2817] = 0;
-car[2816] = 1555; cdr[2816] = 2815; tag[2816] = 0;
-car[2815] = 1492; cdr[2815] = 2814; tag[2815] = 0;
-car[2814] = 1356; cdr[2814] = 2813; tag[2814] = 0;
-car[2813] = 1330; cdr[2813] = 2812; tag[2813] = 0;
-car[2812] = 123; cdr[2812] = 0; tag[2812] = 0;
-car[2811] = 2810; cdr[2811] = 2808; tag[2811] = 0;
-car[2810] = 117; cdr[2810] = 2809; tag[2810] = 0;
-car[2809] = 117; cdr[2809] = 0; tag[2809] = 0;
-car[2808] = 2807; cdr[2808] = 2773; tag[2808] = 0;
-car[2807] = 779; cdr[2807] = 2806; tag[2807] = 0;
-car[2806] = 2753; cdr[2806] = 2805; tag[2806] = 0;
-car[2805] = 2736; cdr[2805] = 2804; tag[2805] = 0;
-car[2804] = 2380; cdr[2804] = 2803; tag[2804] = 0;
-car[2803] = 2343; cdr[2803] = 2802; tag[2803] = 0;
-car[2802] = 2306; cdr[2802] = 2801; tag[2802] = 0;
-car[2801] = 2277; cdr[2801] = 2800; tag[2801] = 0;
-car[2800] = 2254; cdr[2800] = 2799; tag[2800] = 0;
-car[2799] = 2231; cdr[2799] = 2798; tag[2799] = 0;
-car[2798] = 2208; cdr[2798] = 2797; tag[2798] = 0;
-car[2797] = 2202; cdr[2797] = 2796; tag[2797] = 0;
-car[2796] = 2197; cdr[2796] = 2795; tag[2796] = 0;
-car[2795] = 2162; cdr[2795] = 2794; tag[2795] = 0;
-car[2794] = 1859; cdr[2794] = 2793; tag[2794] = 0;
-car[2793] = 1837; cdr[2793] = 2792; tag[2793] = 0;
-car[2792] = 1739; cdr[2792] = 2791; tag[2792] = 0;
-car[2791] = 1727; cdr[2791] = 2790; tag[2791] = 0;
-car[2790] = 1715; cdr[2790] = 2789; tag[2790] = 0;
-car[2789] = 1648; cdr[2789] = 2788; tag[2789] = 0;
-car[2788] = 1630; cdr[2788] = 2787; tag[2788] = 0;
-car[2787] = 1612; cdr[2787] = 2786; tag[2787] = 0;
-car[2786] = 965; cdr[2786] = 2785; tag[2786] = 0;
-car[2785] = 841; cdr[2785] = 2784; tag[2785] = 0;
-car[2784] = 779; cdr[2784] = 2783; tag[2784] = 0;
-car[2783] = 660; cdr[2783] = 2782; tag[2783] = 0;
-car[2782] = 476; cdr[2782] = 2781; tag[2782] = 0;
-car[2781] = 457; cdr[2781] = 2780; tag[2781] = 0;
-car[2780] = 453; cdr[2780] = 2779; tag[2780] = 0;
-car[2779] = 368; cdr[2779] = 2778; tag[2779] = 0;
-car[2778] = 133; cdr[2778] = 2777; tag[2778] = 0;
-car[2777] = 127; cdr[2777] = 2776; tag[2777] = 0;
-car[2776] = 121; cdr[2776] = 2775; tag[2776] = 0;
-car[2775] = 115; cdr[2775] = 2774; tag[2775] = 0;
-car[2774] = 107; cdr[2774] = 0; tag[2774] = 0;
-car[2773] = 2772; cdr[2773] = 0; tag[2773] = 0;
-car[2772] = 1; cdr[2772] = 2771; tag[2772] = 0;
-car[2771] = 2583; cdr[2771] = 2770; tag[2771] = 0;
-car[2770] = 2118; cdr[2770] = 2769; tag[2770] = 0;
-car[2769] = 1811; cdr[2769] = 2768; tag[2769] = 0;
-car[2768] = 1767; cdr[2768] = 2767; tag[2768] = 0;
-car[2767] = 1604; cdr[2767] = 2766; tag[2767] = 0;
-car[2766] = 1456; cdr[2766] = 2765; tag[2766] = 0;
-car[2765] = 1200; cdr[2765] = 2764; tag[2765] = 0;
-car[2764] = 1129; cdr[2764] = 2763; tag[2764] = 0;
-car[2763] = 1020; cdr[2763] = 2762; tag[2763] = 0;
-car[2762] = 536; cdr[2762] = 2761; tag[2762] = 0;
-car[2761] = 1; cdr[2761] = 0; tag[2761] = 0;
-car[2760] = 2759; cdr[2760] = 0; tag[2760] = 0;
-car[2759] = u('l'); cdr[2759] = 2758; tag[2759] = atomtag;
-car[2758] = u('i'); cdr[2758] = 2757; tag[2758] = atomtag;
-car[2757] = u('s'); cdr[2757] = 2756; tag[2757] = atomtag;
-car[2756] = u('c'); cdr[2756] = 2755; tag[2756] = atomtag;
-car[2755] = u('m'); cdr[2755] = 2754; tag[2755] = atomtag;
-car[2754] = u('p'); cdr[2754] = 0; tag[2754] = atomtag;
-car[2753] = 2752; cdr[2753] = 0; tag[2753] = 0;
-car[2752] = u('*'); cdr[2752] = 2751; tag[2752] = atomtag;
-car[2751] = u('s'); cdr[2751] = 2750; tag[2751] = atomtag;
-car[2750] = u('t'); cdr[2750] = 2749; tag[2750] = atomtag;
-car[2749] = u('o'); cdr[2749] = 2748; tag[2749] = atomtag;
-car[2748] = u('p'); cdr[2748] = 0; tag[2748] = atomtag;
-car[2747] = 135; cdr[2747] = 0; tag[2747] = 0;
-car[2746] = 2745; cdr[2746] = 0; tag[2746] = 0;
-car[2745] = u('d'); cdr[2745] = 2744; tag[2745] = atomtag;
-car[2744] = u('u'); cdr[2744] = 2743; tag[2744] = atomtag;
-car[2743] = u('m'); cdr[2743] = 2742; tag[2743] = atomtag;
-car[2742] = u('p'); cdr[2742] = 2741; tag[2742] = atomtag;
-car[2741] = u('-'); cdr[2741] = 2740; tag[2741] = atomtag;
-car[2740] = u('p'); cdr[2740] = 2739; tag[2740] = atomtag;
-car[2739] = u('o'); cdr[2739] = 2738; tag[2739] = atomtag;
-car[2738] = u('o'); cdr[2738] = 2737; tag[2738] = atomtag;
-car[2737] = u('l'); cdr[2737] = 0; tag[2737] = atomtag;
-car[2736] = 2735; cdr[2736] = 0; tag[2736] = 0;
-car[2735] = u('*'); cdr[2735] = 2734; tag[2735] = atomtag;
-car[2734] = u('*'); cdr[2734] = 2733; tag[2734] = atomtag;
-car[2733] = u('*'); cdr[2733] = 2732; tag[2733] = atomtag;
-car[2732] = u('*'); cdr[2732] = 2731; tag[2732] = atomtag;
-car[2731] = u('*'); cdr[2731] = 2730; tag[2731] = atomtag;
-car[2730] = u('*'); cdr[2730] = 2729; tag[2730] = atomtag;
-car[2729] = u('*'); cdr[2729] = 2728; tag[2729] = atomtag;
-car[2728] = u('*'); cdr[2728] = 2727; tag[2728] = atomtag;
-car[2727] = u('*'); cdr[2727] = 2726; tag[2727] = atomtag;
-car[2726] = u('*'); cdr[2726] = 2725; tag[2726] = atomtag;
-car[2725] = u('*'); cdr[2725] = 2724; tag[2725] = atomtag;
-car[2724] = u('*'); cdr[2724] = 2723; tag[2724] = atomtag;
-car[2723] = u('*'); cdr[2723] = 2722; tag[2723] = atomtag;
-car[2722] = u('*'); cdr[2722] = 2721; tag[2722] = atomtag;
-car[2721] = u('*'); cdr[2721] = 2720; tag[2721] = atomtag;
-car[2720] = u('*'); cdr[2720] = 2719; tag[2720] = atomtag;
-car[2719] = u('*'); cdr[2719] = 2718; tag[2719] = atomtag;
-car[2718] = u('*'); cdr[2718] = 2717; tag[2718] = atomtag;
-car[2717] = u('*'); cdr[2717] = 2716; tag[2717] = atomtag;
-car[2716] = u('*'); cdr[2716] = 2715; tag[2716] = atomtag;
-car[2715] = u('*'); cdr[2715] = 2714; tag[2715] = atomtag;
-car[2714] = u('*'); cdr[2714] = 2713; tag[2714] = atomtag;
-car[2713] = u('*'); cdr[2713] = 2712; tag[2713] = atomtag;
-car[2712] = u('*'); cdr[2712] = 2711; tag[2712] = atomtag;
-car[2711] = u('*'); cdr[2711] = 2710; tag[2711] = atomtag;
-car[2710] = u('*'); cdr[2710] = 2709; tag[2710] = atomtag;
-car[2709] = u('*'); cdr[2709] = 2708; tag[2709] = atomtag;
-car[2708] = u('*'); cdr[2708] = 2707; tag[2708] = atomtag;
-car[2707] = u('*'); cdr[2707] = 2706; tag[2707] = atomtag;
-car[2706] = u('*'); cdr[2706] = 2705; tag[2706] = atomtag;
-car[2705] = u('*'); cdr[2705] = 2704; tag[2705] = atomtag;
-car[2704] = u('*'); cdr[2704] = 2703; tag[2704] = atomtag;
-car[2703] = u('*'); cdr[2703] = 2702; tag[2703] = atomtag;
-car[2702] = u('*'); cdr[2702] = 2701; tag[2702] = atomtag;
-car[2701] = u('*'); cdr[2701] = 2700; tag[2701] = atomtag;
-car[2700] = u('/'); cdr[2700] = 0; tag[2700] = atomtag;
-car[2699] = 135; cdr[2699] = 0; tag[2699] = 0;
-car[2698] = 2697; cdr[2698] = 0; tag[2698] = 0;
-car[2697] = u('/'); cdr[2697] = 2696; tag[2697] = atomtag;
-car[2696] = u('*'); cdr[2696] = 2695; tag[2696] = atomtag;
-car[2695] = u('*'); cdr[2695] = 2694; tag[2695] = atomtag;
-car[2694] = u('*'); cdr[2694] = 2693; tag[2694] = atomtag;
-car[2693] = u('*'); cdr[2693] = 2692; tag[2693] = atomtag;
-car[2692] = u('*'); cdr[2692] = 2691; tag[2692] = atomtag;
-car[2691] = u('*'); cdr[2691] = 2690; tag[2691] = atomtag;
-car[2690] = u('*'); cdr[2690] = 2689; tag[2690] = atomtag;
-car[2689] = u('*'); cdr[2689] = 2688; tag[2689] = atomtag;
-car[2688] = u(' '); cdr[2688] = 2687; tag[2688] = atomtag;
-car[2687] = u('p'); cdr[2687] = 2686; tag[2687] = atomtag;
-car[2686] = u('o'); cdr[2686] = 2685; tag[2686] = atomtag;
-car[2685] = u('o'); cdr[2685] = 2684; tag[2685] = atomtag;
-car[2684] = u('l'); cdr[2684] = 2683; tag[2684] = atomtag;
-car[2683] = u(' '); cdr[2683] = 2682; tag[2683] = atomtag;
-car[2682] = u('d'); cdr[2682] = 2681; tag[2682] = atomtag;
-car[2681] = u('u'); cdr[2681] = 2680; tag[2681] = atomtag;
-car[2680] = u('m'); cdr[2680] = 2679; tag[2680] = atomtag;
-car[2679] = u('p'); cdr[2679] = 2678; tag[2679] = atomtag;
-car[2678] = u(' '); cdr[2678] = 2677; tag[2678] = atomtag;
-car[2677] = u('f'); cdr[2677] = 2676; tag[2677] = atomtag;
-car[2676] = u('o'); cdr[2676] = 2675; tag[2676] = atomtag;
-car[2675] = u('l'); cdr[2675] = 2674; tag[2675] = atomtag;
-car[2674] = u('l'); cdr[2674] = 2673; tag[2674] = atomtag;
-car[2673] = u('o'); cdr[2673] = 2672; tag[2673] = atomtag;
-car[2672] = u('w'); cdr[2672] = 2671; tag[2672] = atomtag;
-car[2671] = u('s'); cdr[2671] = 2670; tag[2671] = atomtag;
-car[2670] = u(' '); cdr[2670] = 2669; tag[2670] = atomtag;
-car[2669] = u('*'); cdr[2669] = 2668; tag[2669] = atomtag;
-car[2668] = u('*'); cdr[2668] = 2667; tag[2668] = atomtag;
-car[2667] = u('*'); cdr[2667] = 2666; tag[2667] = atomtag;
-car[2666] = u('*'); cdr[2666] = 2665; tag[2666] = atomtag;
-car[2665] = u('*'); cdr[2665] = 2664; tag[2665] = atomtag;
-car[2664] = u('*'); cdr[2664] = 2663; tag[2664] = atomtag;
-car[2663] = u('*'); cdr[2663] = 2662; tag[2663] = atomtag;
-car[2662] = u('*'); cdr[2662] = 0; tag[2662] = atomtag;
-car[2661] = 2660; cdr[2661] = 0; tag[2661] = 0;
-car[2660] = u('e'); cdr[2660] = 2659; tag[2660] = atomtag;
-car[2659] = u('p'); cdr[2659] = 2658; tag[2659] = atomtag;
-car[2658] = u('i'); cdr[2658] = 2657; tag[2658] = atomtag;
-car[2657] = u('l'); cdr[2657] = 2656; tag[2657] = atomtag;
-car[2656] = u('o'); cdr[2656] = 2655; tag[2656] = atomtag;
-car[2655] = u('g'); cdr[2655] = 0; tag[2655] = atomtag;
-car[2654] = 2653; cdr[2654] = 0; tag[2654] = 0;
-car[2653] = u('r'); cdr[2653] = 2652; tag[2653] = atomtag;
-car[2652] = u('e'); cdr[2652] = 2651; tag[2652] = atomtag;
-car[2651] = u('f'); cdr[2651] = 2650; tag[2651] = atomtag;
-car[2650] = u('('); cdr[2650] = 2649; tag[2650] = atomtag;
-car[2649] = u('s'); cdr[2649] = 2648; tag[2649] = atomtag;
-car[2648] = u('y'); cdr[2648] = 2647; tag[2648] = atomtag;
-car[2647] = u('m'); cdr[2647] = 2646; tag[2647] = atomtag;
-car[2646] = u('l'); cdr[2646] = 2645; tag[2646] = atomtag;
-car[2645] = u('i'); cdr[2645] = 2644; tag[2645] = atomtag;
-car[2644] = u('s'); cdr[2644] = 2643; tag[2644] = atomtag;
-car[2643] = u(')'); cdr[2643] = 2642; tag[2643] = atomtag;
-car[2642] = u(' '); cdr[2642] = 2641; tag[2642] = atomtag;
-car[2641] = u('='); cdr[2641] = 2640; tag[2641] = atomtag;
-car[2640] = u(' '); cdr[2640] = 0; tag[2640] = atomtag;
-car[2639] = 135; cdr[2639] = 0; tag[2639] = 0;
-car[2638] = 2637; cdr[2638] = 0; tag[2638] = 0;
-car[2637] = u('v'); cdr[2637] = 2636; tag[2637] = atomtag;
-car[2636] = u('o'); cdr[2636] = 2635; tag[2636] = atomtag;
-car[2635] = u('i'); cdr[2635] = 2634; tag[2635] = atomtag;
-car[2634] = u('d'); cdr[2634] = 2633; tag[2634] = atomtag;
-car[2633] = u(' '); cdr[2633] = 2632; tag[2633] = atomtag;
-car[2632] = u('s'); cdr[2632] = 2631; tag[2632] = atomtag;
-car[2631] = u('e'); cdr[2631] = 2630; tag[2631] = atomtag;
-car[2630] = u('t'); cdr[2630] = 2629; tag[2630] = atomtag;
-car[2629] = u('u'); cdr[2629] = 2628; tag[2629] = atomtag;
+car[3149] = u('s'); cdr[3149] = 3148; tag[3149] = atomtag;
+car[3148] = u('e'); cdr[3148] = 3147; tag[3148] = atomtag;
+car[3147] = u('t'); cdr[3147] = 3146; tag[3147] = atomtag;
+car[3146] = u('u'); cdr[3146] = 3145; tag[3146] = atomtag;
+car[3145] = u('p'); cdr[3145] = 3144; tag[3145] = atomtag;
+car[3144] = u('('); cdr[3144] = 3143; tag[3144] = atomtag;
+car[3143] = u(')'); cdr[3143] = 3142; tag[3143] = atomtag;
+car[3142] = u(';'); cdr[3142] = 0; tag[3142] = atomtag;
+car[3141] = 3140; cdr[3141] = 0; tag[3141] = 0;
+car[3140] = u('i'); cdr[3140] = 3139; tag[3140] = atomtag;
+car[3139] = u('n'); cdr[3139] = 3138; tag[3139] = atomtag;
+car[3138] = u('t'); cdr[3138] = 3137; tag[3138] = atomtag;
+car[3137] = u(' '); cdr[3137] = 3136; tag[3137] = atomtag;
+car[3136] = u('k'); cdr[3136] = 3135; tag[3136] = atomtag;
+car[3135] = u(';'); cdr[3135] = 0; tag[3135] = atomtag;
+car[3134] = 3133; cdr[3134] = 0; tag[3134] = 0;
+car[3133] = u('v'); cdr[3133] = 3132; tag[3133] = atomtag;
+car[3132] = u('o'); cdr[3132] = 3131; tag[3132] = atomtag;
+car[3131] = u('i'); cdr[3131] = 3130; tag[3131] = atomtag;
+car[3130] = u('d'); cdr[3130] = 3129; tag[3130] = atomtag;
+car[3129] = u(' '); cdr[3129] = 3128; tag[3129] = atomtag;
+car[3128] = u('r'); cdr[3128] = 3127; tag[3128] = atomtag;
+car[3127] = u('u'); cdr[3127] = 3126; tag[3127] = atomtag;
+car[3126] = u('n'); cdr[3126] = 3125; tag[3126] = atomtag;
+car[3125] = u('('); cdr[3125] = 3124; tag[3125] = atomtag;
+car[3124] = u('v'); cdr[3124] = 3123; tag[3124] = atomtag;
+car[3123] = u('o'); cdr[3123] = 3122; tag[3123] = atomtag;
+car[3122] = u('i'); cdr[3122] = 3121; tag[3122] = atomtag;
+car[3121] = u('d'); cdr[3121] = 3120; tag[3121] = atomtag;
+car[3120] = u(')'); cdr[3120] = 3119; tag[3120] = atomtag;
+car[3119] = u(' '); cdr[3119] = 3118; tag[3119] = atomtag;
+car[3118] = u('{'); cdr[3118] = 0; tag[3118] = atomtag;
+car[3117] = 3116; cdr[3117] = 0; tag[3117] = 0;
+car[3116] = u('/'); cdr[3116] = 3115; tag[3116] = atomtag;
+car[3115] = u('*'); cdr[3115] = 3114; tag[3115] = atomtag;
+car[3114] = u('*'); cdr[3114] = 3113; tag[3114] = atomtag;
+car[3113] = u('*'); cdr[3113] = 3112; tag[3113] = atomtag;
+car[3112] = u('*'); cdr[3112] = 3111; tag[3112] = atomtag;
+car[3111] = u('*'); cdr[3111] = 3110; tag[3111] = atomtag;
+car[3110] = u('*'); cdr[3110] = 3109; tag[3110] = atomtag;
+car[3109] = u('*'); cdr[3109] = 3108; tag[3109] = atomtag;
+car[3108] = u('*'); cdr[3108] = 3107; tag[3108] = atomtag;
+car[3107] = u(' '); cdr[3107] = 3106; tag[3107] = atomtag;
+car[3106] = u('l'); cdr[3106] = 3105; tag[3106] = atomtag;
+car[3105] = u('i'); cdr[3105] = 3104; tag[3105] = atomtag;
+car[3104] = u('s'); cdr[3104] = 3103; tag[3104] = atomtag;
+car[3103] = u('c'); cdr[3103] = 3102; tag[3103] = atomtag;
+car[3102] = u('m'); cdr[3102] = 3101; tag[3102] = atomtag;
+car[3101] = u('p'); cdr[3101] = 3100; tag[3101] = atomtag;
+car[3100] = u(' '); cdr[3100] = 3099; tag[3100] = atomtag;
+car[3099] = u('o'); cdr[3099] = 3098; tag[3099] = atomtag;
+car[3098] = u('u'); cdr[3098] = 3097; tag[3098] = atomtag;
+car[3097] = u('t'); cdr[3097] = 3096; tag[3097] = atomtag;
+car[3096] = u('p'); cdr[3096] = 3095; tag[3096] = atomtag;
+car[3095] = u('u'); cdr[3095] = 3094; tag[3095] = atomtag;
+car[3094] = u('t'); cdr[3094] = 3093; tag[3094] = atomtag;
+car[3093] = u(' '); cdr[3093] = 3092; tag[3093] = atomtag;
+car[3092] = u('f'); cdr[3092] = 3091; tag[3092] = atomtag;
+car[3091] = u('o'); cdr[3091] = 3090; tag[3091] = atomtag;
+car[3090] = u('l'); cdr[3090] = 3089; tag[3090] = atomtag;
+car[3089] = u('l'); cdr[3089] = 3088; tag[3089] = atomtag;
+car[3088] = u('o'); cdr[3088] = 3087; tag[3088] = atomtag;
+car[3087] = u('w'); cdr[3087] = 3086; tag[3087] = atomtag;
+car[3086] = u('s'); cdr[3086] = 3085; tag[3086] = atomtag;
+car[3085] = u(' '); cdr[3085] = 3084; tag[3085] = atomtag;
+car[3084] = u('*'); cdr[3084] = 3083; tag[3084] = atomtag;
+car[3083] = u('*'); cdr[3083] = 3082; tag[3083] = atomtag;
+car[3082] = u('*'); cdr[3082] = 3081; tag[3082] = atomtag;
+car[3081] = u('*'); cdr[3081] = 3080; tag[3081] = atomtag;
+car[3080] = u('*'); cdr[3080] = 3079; tag[3080] = atomtag;
+car[3079] = u('*'); cdr[3079] = 3078; tag[3079] = atomtag;
+car[3078] = u('*'); cdr[3078] = 3077; tag[3078] = atomtag;
+car[3077] = u('*'); cdr[3077] = 3076; tag[3077] = atomtag;
+car[3076] = u('/'); cdr[3076] = 0; tag[3076] = atomtag;
+car[3075] = 3074; cdr[3075] = 0; tag[3075] = 0;
+car[3074] = u('w'); cdr[3074] = 3073; tag[3074] = atomtag;
+car[3073] = u('r'); cdr[3073] = 3072; tag[3073] = atomtag;
+car[3072] = u('i'); cdr[3072] = 3071; tag[3072] = atomtag;
+car[3071] = u('t'); cdr[3071] = 3070; tag[3071] = atomtag;
+car[3070] = u('e'); cdr[3070] = 3069; tag[3070] = atomtag;
+car[3069] = u('c'); cdr[3069] = 3068; tag[3069] = atomtag;
+car[3068] = u('('); cdr[3068] = 3067; tag[3068] = atomtag;
+car[3067] = u('r'); cdr[3067] = 3066; tag[3067] = atomtag;
+car[3066] = u('e'); cdr[3066] = 3065; tag[3066] = atomtag;
+car[3065] = u('f'); cdr[3065] = 3064; tag[3065] = atomtag;
+car[3064] = u('('); cdr[3064] = 3063; tag[3064] = atomtag;
+car[3063] = u('e'); cdr[3063] = 3062; tag[3063] = atomtag;
+car[3062] = u('x'); cdr[3062] = 3061; tag[3062] = atomtag;
+car[3061] = u('p'); cdr[3061] = 3060; tag[3061] = atomtag;
+car[3060] = u('r'); cdr[3060] = 3059; tag[3060] = atomtag;
+car[3059] = u(')'); cdr[3059] = 3058; tag[3059] = atomtag;
+car[3058] = u(')'); cdr[3058] = 3057; tag[3058] = atomtag;
+car[3057] = u(';'); cdr[3057] = 0; tag[3057] = atomtag;
+car[3056] = 3055; cdr[3056] = 0; tag[3056] = 0;
+car[3055] = u('*'); cdr[3055] = 3054; tag[3055] = atomtag;
+car[3054] = u('w'); cdr[3054] = 3053; tag[3054] = atomtag;
+car[3053] = u('r'); cdr[3053] = 3052; tag[3053] = atomtag;
+car[3052] = u('i'); cdr[3052] = 3051; tag[3052] = atomtag;
+car[3051] = u('t'); cdr[3051] = 3050; tag[3051] = atomtag;
+car[3050] = u('e'); cdr[3050] = 3049; tag[3050] = atomtag;
+car[3049] = u('c'); cdr[3049] = 0; tag[3049] = atomtag;
+car[3048] = 3047; cdr[3048] = 0; tag[3048] = 0;
+car[3047] = u('c'); cdr[3047] = 3046; tag[3047] = atomtag;
+car[3046] = u('d'); cdr[3046] = 3045; tag[3046] = atomtag;
+car[3045] = u('r'); cdr[3045] = 3044; tag[3045] = atomtag;
+car[3044] = u('['); cdr[3044] = 3043; tag[3044] = atomtag;
+car[3043] = u('r'); cdr[3043] = 3042; tag[3043] = atomtag;
+car[3042] = u('e'); cdr[3042] = 3041; tag[3042] = atomtag;
+car[3041] = u('f'); cdr[3041] = 3040; tag[3041] = atomtag;
+car[3040] = u('('); cdr[3040] = 3039; tag[3040] = atomtag;
+car[3039] = u('e'); cdr[3039] = 3038; tag[3039] = atomtag;
+car[3038] = u('x'); cdr[3038] = 3037; tag[3038] = atomtag;
+car[3037] = u('p'); cdr[3037] = 3036; tag[3037] = atomtag;
+car[3036] = u('r'); cdr[3036] = 3035; tag[3036] = atomtag;
+car[3035] = u(')'); cdr[3035] = 3034; tag[3035] = atomtag;
+car[3034] = u(']'); cdr[3034] = 3033; tag[3034] = atomtag;
+car[3033] = u(' '); cdr[3033] = 3032; tag[3033] = atomtag;
+car[3032] = u('='); cdr[3032] = 3031; tag[3032] = atomtag;
+car[3031] = u(' '); cdr[3031] = 3030; tag[3031] = atomtag;
+car[3030] = u('r'); cdr[3030] = 3029; tag[3030] = atomtag;
+car[3029] = u('e'); cdr[3029] = 3028; tag[3029] = atomtag;
+car[3028] = u('f'); cdr[3028] = 3027; tag[3028] = atomtag;
+car[3027] = u('('); cdr[3027] = 3026; tag[3027] = atomtag;
+car[3026] = u('e'); cdr[3026] = 3025; tag[3026] = atomtag;
+car[3025] = u('x'); cdr[3025] = 3024; tag[3025] = atomtag;
+car[3024] = u('p'); cdr[3024] = 3023; tag[3024] = atomtag;
+car[3023] = u('r'); cdr[3023] = 3022; tag[3023] = atomtag;
+car[3022] = u('2'); cdr[3022] = 3021; tag[3022] = atomtag;
+car[3021] = u(')'); cdr[3021] = 3020; tag[3021] = atomtag;
+car[3020] = u(';'); cdr[3020] = 0; tag[3020] = atomtag;
+car[3019] = 3018; cdr[3019] = 0; tag[3019] = 0;
+car[3018] = u('*'); cdr[3018] = 3017; tag[3018] = atomtag;
+car[3017] = u('r'); cdr[3017] = 3016; tag[3017] = atomtag;
+car[3016] = u('p'); cdr[3016] = 3015; tag[3016] = atomtag;
+car[3015] = u('l'); cdr[3015] = 3014; tag[3015] = atomtag;
+car[3014] = u('a'); cdr[3014] = 3013; tag[3014] = atomtag;
+car[3013] = u('c'); cdr[3013] = 3012; tag[3013] = atomtag;
+car[3012] = u('d'); cdr[3012] = 0; tag[3012] = atomtag;
+car[3011] = 3010; cdr[3011] = 0; tag[3011] = 0;
+car[3010] = u('c'); cdr[3010] = 3009; tag[3010] = atomtag;
+car[3009] = u('a'); cdr[3009] = 3008; tag[3009] = atomtag;
+car[3008] = u('r'); cdr[3008] = 3007; tag[3008] = atomtag;
+car[3007] = u('['); cdr[3007] = 3006; tag[3007] = atomtag;
+car[3006] = u('r'); cdr[3006] = 3005; tag[3006] = atomtag;
+car[3005] = u('e'); cdr[3005] = 3004; tag[3005] = atomtag;
+car[3004] = u('f'); cdr[3004] = 3003; tag[3004] = atomtag;
+car[3003] = u('('); cdr[3003] = 3002; tag[3003] = atomtag;
+car[3002] = u('e'); cdr[3002] = 3001; tag[3002] = atomtag;
+car[3001] = u('x'); cdr[3001] = 3000; tag[3001] = atomtag;
+car[3000] = u('p'); cdr[3000] = 2999; tag[3000] = atomtag;
+car[2999] = u('r'); cdr[2999] = 2998; tag[2999] = atomtag;
+car[2998] = u(')'); cdr[2998] = 2997; tag[2998] = atomtag;
+car[2997] = u(']'); cdr[2997] = 2996; tag[2997] = atomtag;
+car[2996] = u(' '); cdr[2996] = 2995; tag[2996] = atomtag;
+car[2995] = u('='); cdr[2995] = 2994; tag[2995] = atomtag;
+car[2994] = u(' '); cdr[2994] = 2993; tag[2994] = atomtag;
+car[2993] = u('r'); cdr[2993] = 2992; tag[2993] = atomtag;
+car[2992] = u('e'); cdr[2992] = 2991; tag[2992] = atomtag;
+car[2991] = u('f'); cdr[2991] = 2990; tag[2991] = atomtag;
+car[2990] = u('('); cdr[2990] = 2989; tag[2990] = atomtag;
+car[2989] = u('e'); cdr[2989] = 2988; tag[2989] = atomtag;
+car[2988] = u('x'); cdr[2988] = 2987; tag[2988] = atomtag;
+car[2987] = u('p'); cdr[2987] = 2986; tag[2987] = atomtag;
+car[2986] = u('r'); cdr[2986] = 2985; tag[2986] = atomtag;
+car[2985] = u('2'); cdr[2985] = 2984; tag[2985] = atomtag;
+car[2984] = u(')'); cdr[2984] = 2983; tag[2984] = atomtag;
+car[2983] = u(';'); cdr[2983] = 0; tag[2983] = atomtag;
+car[2982] = 2981; cdr[2982] = 0; tag[2982] = 0;
+car[2981] = u('*'); cdr[2981] = 2980; tag[2981] = atomtag;
+car[2980] = u('r'); cdr[2980] = 2979; tag[2980] = atomtag;
+car[2979] = u('p'); cdr[2979] = 2978; tag[2979] = atomtag;
+car[2978] = u('l'); cdr[2978] = 2977; tag[2978] = atomtag;
+car[2977] = u('a'); cdr[2977] = 2976; tag[2977] = atomtag;
+car[2976] = u('c'); cdr[2976] = 2975; tag[2976] = atomtag;
+car[2975] = u('a'); cdr[2975] = 0; tag[2975] = atomtag;
+car[2974] = 2973; cdr[2974] = 0; tag[2974] = 0;
+car[2973] = u('r'); cdr[2973] = 2972; tag[2973] = atomtag;
+car[2972] = u('e'); cdr[2972] = 2971; tag[2972] = atomtag;
+car[2971] = u('f'); cdr[2971] = 2970; tag[2971] = atomtag;
+car[2970] = u('('); cdr[2970] = 2969; tag[2970] = atomtag;
+car[2969] = u('e'); cdr[2969] = 2968; tag[2969] = atomtag;
+car[2968] = u('x'); cdr[2968] = 2967; tag[2968] = atomtag;
+car[2967] = u('p'); cdr[2967] = 2966; tag[2967] = atomtag;
+car[2966] = u('r'); cdr[2966] = 2965; tag[2966] = atomtag;
+car[2965] = u(')'); cdr[2965] = 2964; tag[2965] = atomtag;
+car[2964] = u(' '); cdr[2964] = 2963; tag[2964] = atomtag;
+car[2963] = u('='); cdr[2963] = 2962; tag[2963] = atomtag;
+car[2962] = u(' '); cdr[2962] = 2961; tag[2962] = atomtag;
+car[2961] = u('r'); cdr[2961] = 2960; tag[2961] = atomtag;
+car[2960] = u('d'); cdr[2960] = 2959; tag[2960] = atomtag;
+car[2959] = u('o'); cdr[2959] = 2958; tag[2959] = atomtag;
+car[2958] = u('b'); cdr[2958] = 2957; tag[2958] = atomtag;
+car[2957] = u('j'); cdr[2957] = 2956; tag[2957] = atomtag;
+car[2956] = u('('); cdr[2956] = 2955; tag[2956] = atomtag;
+car[2955] = u(')'); cdr[2955] = 2954; tag[2955] = atomtag;
+car[2954] = u(';'); cdr[2954] = 0; tag[2954] = atomtag;
+car[2953] = 2952; cdr[2953] = 0; tag[2953] = 0;
+car[2952] = u('*'); cdr[2952] = 2951; tag[2952] = atomtag;
+car[2951] = u('r'); cdr[2951] = 2950; tag[2951] = atomtag;
+car[2950] = u('e'); cdr[2950] = 2949; tag[2950] = atomtag;
+car[2949] = u('a'); cdr[2949] = 2948; tag[2949] = atomtag;
+car[2948] = u('d'); cdr[2948] = 0; tag[2948] = atomtag;
+car[2947] = 2946; cdr[2947] = 0; tag[2947] = 0;
+car[2946] = u('r'); cdr[2946] = 2945; tag[2946] = atomtag;
+car[2945] = u('e'); cdr[2945] = 2944; tag[2945] = atomtag;
+car[2944] = u('f'); cdr[2944] = 2943; tag[2944] = atomtag;
+car[2943] = u('('); cdr[2943] = 2942; tag[2943] = atomtag;
+car[2942] = u('e'); cdr[2942] = 2941; tag[2942] = atomtag;
+car[2941] = u('x'); cdr[2941] = 2940; tag[2941] = atomtag;
+car[2940] = u('p'); cdr[2940] = 2939; tag[2940] = atomtag;
+car[2939] = u('r'); cdr[2939] = 2938; tag[2939] = atomtag;
+car[2938] = u(')'); cdr[2938] = 2937; tag[2938] = atomtag;
+car[2937] = u(' '); cdr[2937] = 2936; tag[2937] = atomtag;
+car[2936] = u('='); cdr[2936] = 2935; tag[2936] = atomtag;
+car[2935] = u(' '); cdr[2935] = 2934; tag[2935] = atomtag;
+car[2934] = u('p'); cdr[2934] = 2933; tag[2934] = atomtag;
+car[2933] = u('e'); cdr[2933] = 2932; tag[2933] = atomtag;
+car[2932] = u('e'); cdr[2932] = 2931; tag[2932] = atomtag;
+car[2931] = u('k'); cdr[2931] = 2930; tag[2931] = atomtag;
+car[2930] = u('c'); cdr[2930] = 2929; tag[2930] = atomtag;
+car[2929] = u('('); cdr[2929] = 2928; tag[2929] = atomtag;
+car[2928] = u(')'); cdr[2928] = 2927; tag[2928] = atomtag;
+car[2927] = u(';'); cdr[2927] = 0; tag[2927] = atomtag;
+car[2926] = 2925; cdr[2926] = 0; tag[2926] = 0;
+car[2925] = u('*'); cdr[2925] = 2924; tag[2925] = atomtag;
+car[2924] = u('p'); cdr[2924] = 2923; tag[2924] = atomtag;
+car[2923] = u('e'); cdr[2923] = 2922; tag[2923] = atomtag;
+car[2922] = u('e'); cdr[2922] = 2921; tag[2922] = atomtag;
+car[2921] = u('k'); cdr[2921] = 2920; tag[2921] = atomtag;
+car[2920] = u('c'); cdr[2920] = 0; tag[2920] = atomtag;
+car[2919] = 2918; cdr[2919] = 0; tag[2919] = 0;
+car[2918] = u('r'); cdr[2918] = 2917; tag[2918] = atomtag;
+car[2917] = u('e'); cdr[2917] = 2916; tag[2917] = atomtag;
+car[2916] = u('f'); cdr[2916] = 2915; tag[2916] = atomtag;
+car[2915] = u('('); cdr[2915] = 2914; tag[2915] = atomtag;
+car[2914] = u('e'); cdr[2914] = 2913; tag[2914] = atomtag;
+car[2913] = u('x'); cdr[2913] = 2912; tag[2913] = atomtag;
+car[2912] = u('p'); cdr[2912] = 2911; tag[2912] = atomtag;
+car[2911] = u('r'); cdr[2911] = 2910; tag[2911] = atomtag;
+car[2910] = u(')'); cdr[2910] = 2909; tag[2910] = atomtag;
+car[2909] = u(' '); cdr[2909] = 2908; tag[2909] = atomtag;
+car[2908] = u('='); cdr[2908] = 2907; tag[2908] = atomtag;
+car[2907] = u(' '); cdr[2907] = 2906; tag[2907] = atomtag;
+car[2906] = u('r'); cdr[2906] = 2905; tag[2906] = atomtag;
+car[2905] = u('e'); cdr[2905] = 2904; tag[2905] = atomtag;
+car[2904] = u('a'); cdr[2904] = 2903; tag[2904] = atomtag;
+car[2903] = u('d'); cdr[2903] = 2902; tag[2903] = atomtag;
+car[2902] = u('c'); cdr[2902] = 2901; tag[2902] = atomtag;
+car[2901] = u('('); cdr[2901] = 2900; tag[2901] = atomtag;
+car[2900] = u(')'); cdr[2900] = 2899; tag[2900] = atomtag;
+car[2899] = u(';'); cdr[2899] = 0; tag[2899] = atomtag;
+car[2898] = 2897; cdr[2898] = 0; tag[2898] = 0;
+car[2897] = u('*'); cdr[2897] = 2896; tag[2897] = atomtag;
+car[2896] = u('r'); cdr[2896] = 2895; tag[2896] = atomtag;
+car[2895] = u('e'); cdr[2895] = 2894; tag[2895] = atomtag;
+car[2894] = u('a'); cdr[2894] = 2893; tag[2894] = atomtag;
+car[2893] = u('d'); cdr[2893] = 2892; tag[2893] = atomtag;
+car[2892] = u('c'); cdr[2892] = 0; tag[2892] = atomtag;
+car[2891] = 2212; cdr[2891] = 2890; tag[2891] = 0;
+car[2890] = 2200; cdr[2890] = 2889; tag[2890] = 0;
+car[2889] = 2188; cdr[2889] = 0; tag[2889] = 0;
+car[2888] = 2887; cdr[2888] = 0; tag[2888] = 0;
+car[2887] = u('r'); cdr[2887] = 2886; tag[2887] = atomtag;
+car[2886] = u('e'); cdr[2886] = 2885; tag[2886] = atomtag;
+car[2885] = u('f'); cdr[2885] = 2884; tag[2885] = atomtag;
+car[2884] = u('('); cdr[2884] = 2883; tag[2884] = atomtag;
+car[2883] = u('e'); cdr[2883] = 2882; tag[2883] = atomtag;
+car[2882] = u('x'); cdr[2882] = 2881; tag[2882] = atomtag;
+car[2881] = u('p'); cdr[2881] = 2880; tag[2881] = atomtag;
+car[2880] = u('r'); cdr[2880] = 2879; tag[2880] = atomtag;
+car[2879] = u(')'); cdr[2879] = 2878; tag[2879] = atomtag;
+car[2878] = u('+'); cdr[2878] = 2877; tag[2878] = atomtag;
+car[2877] = u('+'); cdr[2877] = 2876; tag[2877] = atomtag;
+car[2876] = u(';'); cdr[2876] = 0; tag[2876] = atomtag;
+car[2875] = 2874; cdr[2875] = 0; tag[2875] = 0;
+car[2874] = u('*'); cdr[2874] = 2873; tag[2874] = atomtag;
+car[2873] = u('n'); cdr[2873] = 2872; tag[2873] = atomtag;
+car[2872] = u('e'); cdr[2872] = 2871; tag[2872] = atomtag;
+car[2871] = u('x'); cdr[2871] = 2870; tag[2871] = atomtag;
+car[2870] = u('t'); cdr[2870] = 0; tag[2870] = atomtag;
+car[2869] = 2868; cdr[2869] = 0; tag[2869] = 0;
+car[2868] = u('l'); cdr[2868] = 2867; tag[2868] = atomtag;
+car[2867] = u('o'); cdr[2867] = 2866; tag[2867] = atomtag;
+car[2866] = u('a'); cdr[2866] = 2865; tag[2866] = atomtag;
+car[2865] = u('d'); cdr[2865] = 2864; tag[2865] = atomtag;
+car[2864] = u('('); cdr[2864] = 2863; tag[2864] = atomtag;
+car[2863] = u('r'); cdr[2863] = 2862; tag[2863] = atomtag;
+car[2862] = u('e'); cdr[2862] = 2861; tag[2862] = atomtag;
+car[2861] = u('f'); cdr[2861] = 2860; tag[2861] = atomtag;
+car[2860] = u('('); cdr[2860] = 2859; tag[2860] = atomtag;
+car[2859] = u('e'); cdr[2859] = 2858; tag[2859] = atomtag;
+car[2858] = u('x'); cdr[2858] = 2857; tag[2858] = atomtag;
+car[2857] = u('p'); cdr[2857] = 2856; tag[2857] = atomtag;
+car[2856] = u('r'); cdr[2856] = 2855; tag[2856] = atomtag;
+car[2855] = u(')'); cdr[2855] = 2854; tag[2855] = atomtag;
+car[2854] = u(')'); cdr[2854] = 2853; tag[2854] = atomtag;
+car[2853] = u(';'); cdr[2853] = 0; tag[2853] = atomtag;
+car[2852] = 2851; cdr[2852] = 0; tag[2852] = 0;
+car[2851] = u('*'); cdr[2851] = 2850; tag[2851] = atomtag;
+car[2850] = u('l'); cdr[2850] = 2849; tag[2850] = atomtag;
+car[2849] = u('o'); cdr[2849] = 2848; tag[2849] = atomtag;
+car[2848] = u('a'); cdr[2848] = 2847; tag[2848] = atomtag;
+car[2847] = u('d'); cdr[2847] = 0; tag[2847] = atomtag;
+car[2846] = 2845; cdr[2846] = 0; tag[2846] = 0;
+car[2845] = u('d'); cdr[2845] = 2844; tag[2845] = atomtag;
+car[2844] = u('u'); cdr[2844] = 2843; tag[2844] = atomtag;
+car[2843] = u('m'); cdr[2843] = 2842; tag[2843] = atomtag;
+car[2842] = u('p'); cdr[2842] = 2841; tag[2842] = atomtag;
+car[2841] = u('('); cdr[2841] = 2840; tag[2841] = atomtag;
+car[2840] = u('r'); cdr[2840] = 2839; tag[2840] = atomtag;
+car[2839] = u('e'); cdr[2839] = 2838; tag[2839] = atomtag;
+car[2838] = u('f'); cdr[2838] = 2837; tag[2838] = atomtag;
+car[2837] = u('('); cdr[2837] = 2836; tag[2837] = atomtag;
+car[2836] = u('e'); cdr[2836] = 2835; tag[2836] = atomtag;
+car[2835] = u('x'); cdr[2835] = 2834; tag[2835] = atomtag;
+car[2834] = u('p'); cdr[2834] = 2833; tag[2834] = atomtag;
+car[2833] = u('r'); cdr[2833] = 2832; tag[2833] = atomtag;
+car[2832] = u(')'); cdr[2832] = 2831; tag[2832] = atomtag;
+car[2831] = u(')'); cdr[2831] = 2830; tag[2831] = atomtag;
+car[2830] = u(';'); cdr[2830] = 0; tag[2830] = atomtag;
+car[2829] = 2828; cdr[2829] = 0; tag[2829] = 0;
+car[2828] = u('*'); cdr[2828] = 2827; tag[2828] = atomtag;
+car[2827] = u('d'); cdr[2827] = 2826; tag[2827] = atomtag;
+car[2826] = u('u'); cdr[2826] = 2825; tag[2826] = atomtag;
+car[2825] = u('m'); cdr[2825] = 2824; tag[2825] = atomtag;
+car[2824] = u('p'); cdr[2824] = 0; tag[2824] = atomtag;
+car[2823] = 2822; cdr[2823] = 0; tag[2823] = 0;
+car[2822] = u('*'); cdr[2822] = 2821; tag[2822] = atomtag;
+car[2821] = u('c'); cdr[2821] = 2820; tag[2821] = atomtag;
+car[2820] = u('d'); cdr[2820] = 2819; tag[2820] = atomtag;
+car[2819] = u('r'); cdr[2819] = 0; tag[2819] = atomtag;
+car[2818] = 2817; cdr[2818] = 0; tag[2818] = 0;
+car[2817] = u('*'); cdr[2817] = 2816; tag[2817] = atomtag;
+car[2816] = u('c'); cdr[2816] = 2815; tag[2816] = atomtag;
+car[2815] = u('a'); cdr[2815] = 2814; tag[2815] = atomtag;
+car[2814] = u('r'); cdr[2814] = 0; tag[2814] = atomtag;
+car[2813] = 2121; cdr[2813] = 2812; tag[2813] = 0;
+car[2812] = 2103; cdr[2812] = 2811; tag[2812] = 0;
+car[2811] = 2085; cdr[2811] = 0; tag[2811] = 0;
+car[2810] = 2809; cdr[2810] = 0; tag[2810] = 0;
+car[2809] = u('h'); cdr[2809] = 2808; tag[2809] = atomtag;
+car[2808] = u('a'); cdr[2808] = 2807; tag[2808] = atomtag;
+car[2807] = u('l'); cdr[2807] = 2806; tag[2807] = atomtag;
+car[2806] = u('t'); cdr[2806] = 2805; tag[2806] = atomtag;
+car[2805] = u('('); cdr[2805] = 2804; tag[2805] = atomtag;
+car[2804] = u('a'); cdr[2804] = 2803; tag[2804] = atomtag;
+car[2803] = u('t'); cdr[2803] = 2802; tag[2803] = atomtag;
+car[2802] = u('o'); cdr[2802] = 2801; tag[2802] = atomtag;
+car[2801] = u('m'); cdr[2801] = 2800; tag[2801] = atomtag;
+car[2800] = u('n'); cdr[2800] = 2799; tag[2800] = atomtag;
+car[2799] = u('a'); cdr[2799] = 2798; tag[2799] = atomtag;
+car[2798] = u('m'); cdr[2798] = 2797; tag[2798] = atomtag;
+car[2797] = u('e'); cdr[2797] = 2796; tag[2797] = atomtag;
+car[2796] = u('('); cdr[2796] = 2795; tag[2796] = atomtag;
+car[2795] = u('r'); cdr[2795] = 2794; tag[2795] = atomtag;
+car[2794] = u('e'); cdr[2794] = 2793; tag[2794] = atomtag;
+car[2793] = u('f'); cdr[2793] = 2792; tag[2793] = atomtag;
+car[2792] = u('('); cdr[2792] = 2791; tag[2792] = atomtag;
+car[2791] = u('e'); cdr[2791] = 2790; tag[2791] = atomtag;
+car[2790] = u('x'); cdr[2790] = 2789; tag[2790] = atomtag;
+car[2789] = u('p'); cdr[2789] = 2788; tag[2789] = atomtag;
+car[2788] = u('r'); cdr[2788] = 2787; tag[2788] = atomtag;
+car[2787] = u(')'); cdr[2787] = 2786; tag[2787] = atomtag;
+car[2786] = u(')'); cdr[2786] = 2785; tag[2786] = atomtag;
+car[2785] = u(','); cdr[2785] = 2784; tag[2785] = atomtag;
+car[2784] = u(' '); cdr[2784] = 2783; tag[2784] = atomtag;
+car[2783] = u('l'); cdr[2783] = 2782; tag[2783] = atomtag;
+car[2782] = u('i'); cdr[2782] = 2781; tag[2782] = atomtag;
+car[2781] = u('m'); cdr[2781] = 2780; tag[2781] = atomtag;
+car[2780] = u('i'); cdr[2780] = 2779; tag[2780] = atomtag;
+car[2779] = u('t'); cdr[2779] = 2778; tag[2779] = atomtag;
+car[2778] = u(')'); cdr[2778] = 2777; tag[2778] = atomtag;
+car[2777] = u(';'); cdr[2777] = 0; tag[2777] = atomtag;
+car[2776] = 2775; cdr[2776] = 0; tag[2776] = 0;
+car[2775] = u('*'); cdr[2775] = 2774; tag[2775] = atomtag;
+car[2774] = u('h'); cdr[2774] = 2773; tag[2774] = atomtag;
+car[2773] = u('a'); cdr[2773] = 2772; tag[2773] = atomtag;
+car[2772] = u('l'); cdr[2772] = 2771; tag[2772] = atomtag;
+car[2771] = u('t'); cdr[2771] = 0; tag[2771] = atomtag;
+car[2770] = 2769; cdr[2770] = 0; tag[2770] = 0;
+car[2769] = u('%'); cdr[2769] = 0; tag[2769] = atomtag;
+car[2768] = 2767; cdr[2768] = 0; tag[2768] = 0;
+car[2767] = u('/'); cdr[2767] = 0; tag[2767] = atomtag;
+car[2766] = 2765; cdr[2766] = 0; tag[2766] = 0;
+car[2765] = u('+'); cdr[2765] = 0; tag[2765] = atomtag;
+car[2764] = 2763; cdr[2764] = 0; tag[2764] = 0;
+car[2763] = u('r'); cdr[2763] = 2762; tag[2763] = atomtag;
+car[2762] = u('e'); cdr[2762] = 2761; tag[2762] = atomtag;
+car[2761] = u('f'); cdr[2761] = 2760; tag[2761] = atomtag;
+car[2760] = u('('); cdr[2760] = 2759; tag[2760] = atomtag;
+car[2759] = u('e'); cdr[2759] = 2758; tag[2759] = atomtag;
+car[2758] = u('x'); cdr[2758] = 2757; tag[2758] = atomtag;
+car[2757] = u('p'); cdr[2757] = 2756; tag[2757] = atomtag;
+car[2756] = u('r'); cdr[2756] = 2755; tag[2756] = atomtag;
+car[2755] = u(')'); cdr[2755] = 2754; tag[2755] = atomtag;
+car[2754] = u(' '); cdr[2754] = 2753; tag[2754] = atomtag;
+car[2753] = u('='); cdr[2753] = 2752; tag[2753] = atomtag;
+car[2752] = u(' '); cdr[2752] = 2751; tag[2752] = atomtag;
+car[2751] = u('n'); cdr[2751] = 2750; tag[2751] = atomtag;
+car[2750] = u('u'); cdr[2750] = 2749; tag[2750] = atomtag;
+car[2749] = u('m'); cdr[2749] = 2748; tag[2749] = atomtag;
+car[2748] = u('e'); cdr[2748] = 2747; tag[2748] = atomtag;
+car[2747] = u('r'); cdr[2747] = 2746; tag[2747] = atomtag;
+car[2746] = u('i'); cdr[2746] = 2745; tag[2746] = atomtag;
+car[2745] = u('c'); cdr[2745] = 2744; tag[2745] = atomtag;
+car[2744] = u('('); cdr[2744] = 2743; tag[2744] = atomtag;
+car[2743] = u(')'); cdr[2743] = 2742; tag[2743] = atomtag;
+car[2742] = u('?'); cdr[2742] = 2741; tag[2742] = atomtag;
+car[2741] = u(' '); cdr[2741] = 2740; tag[2741] = atomtag;
+car[2740] = u('t'); cdr[2740] = 2739; tag[2740] = atomtag;
+car[2739] = u('r'); cdr[2739] = 2738; tag[2739] = atomtag;
+car[2738] = u('u'); cdr[2738] = 2737; tag[2738] = atomtag;
+car[2737] = u('e'); cdr[2737] = 2736; tag[2737] = atomtag;
+car[2736] = u(':'); cdr[2736] = 2735; tag[2736] = atomtag;
+car[2735] = u(' '); cdr[2735] = 2734; tag[2735] = atomtag;
+car[2734] = u('n'); cdr[2734] = 2733; tag[2734] = atomtag;
+car[2733] = u('i'); cdr[2733] = 2732; tag[2733] = atomtag;
+car[2732] = u('l'); cdr[2732] = 2731; tag[2732] = atomtag;
+car[2731] = u(';'); cdr[2731] = 0; tag[2731] = atomtag;
+car[2730] = 2729; cdr[2730] = 0; tag[2730] = 0;
+car[2729] = u('r'); cdr[2729] = 2728; tag[2729] = atomtag;
+car[2728] = u('e'); cdr[2728] = 2727; tag[2728] = atomtag;
+car[2727] = u('f'); cdr[2727] = 2726; tag[2727] = atomtag;
+car[2726] = u('('); cdr[2726] = 2725; tag[2726] = atomtag;
+car[2725] = u('e'); cdr[2725] = 2724; tag[2725] = atomtag;
+car[2724] = u('x'); cdr[2724] = 2723; tag[2724] = atomtag;
+car[2723] = u('p'); cdr[2723] = 2722; tag[2723] = atomtag;
+car[2722] = u('r'); cdr[2722] = 2721; tag[2722] = atomtag;
+car[2721] = u(')'); cdr[2721] = 2720; tag[2721] = atomtag;
+car[2720] = u(' '); cdr[2720] = 2719; tag[2720] = atomtag;
+car[2719] = u('='); cdr[2719] = 2718; tag[2719] = atomtag;
+car[2718] = u(' '); cdr[2718] = 2717; tag[2718] = atomtag;
+car[2717] = u('r'); cdr[2717] = 2716; tag[2717] = atomtag;
+car[2716] = u('e'); cdr[2716] = 2715; tag[2716] = atomtag;
+car[2715] = u('f'); cdr[2715] = 2714; tag[2715] = atomtag;
+car[2714] = u('('); cdr[2714] = 2713; tag[2714] = atomtag;
+car[2713] = u('e'); cdr[2713] = 2712; tag[2713] = atomtag;
+car[2712] = u('x'); cdr[2712] = 2711; tag[2712] = atomtag;
+car[2711] = u('p'); cdr[2711] = 2710; tag[2711] = atomtag;
+car[2710] = u('r'); cdr[2710] = 2709; tag[2710] = atomtag;
+car[2709] = u(')'); cdr[2709] = 2708; tag[2709] = atomtag;
+car[2708] = u(' '); cdr[2708] = 2707; tag[2708] = atomtag;
+car[2707] = u('='); cdr[2707] = 2706; tag[2707] = atomtag;
+car[2706] = u('='); cdr[2706] = 2705; tag[2706] = atomtag;
+car[2705] = u(' '); cdr[2705] = 2704; tag[2705] = atomtag;
+car[2704] = u('r'); cdr[2704] = 2703; tag[2704] = atomtag;
+car[2703] = u('e'); cdr[2703] = 2702; tag[2703] = atomtag;
+car[2702] = u('f'); cdr[2702] = 2701; tag[2702] = atomtag;
+car[2701] = u('('); cdr[2701] = 2700; tag[2701] = atomtag;
+car[2700] = u('e'); cdr[2700] = 2699; tag[2700] = atomtag;
+car[2699] = u('x'); cdr[2699] = 2698; tag[2699] = atomtag;
+car[2698] = u('p'); cdr[2698] = 2697; tag[2698] = atomtag;
+car[2697] = u('r'); cdr[2697] = 2696; tag[2697] = atomtag;
+car[2696] = u('2'); cdr[2696] = 2695; tag[2696] = atomtag;
+car[2695] = u(')'); cdr[2695] = 2694; tag[2695] = atomtag;
+car[2694] = u('?'); cdr[2694] = 2693; tag[2694] = atomtag;
+car[2693] = u(' '); cdr[2693] = 0; tag[2693] = atomtag;
+car[2692] = 2691; cdr[2692] = 0; tag[2692] = 0;
+car[2691] = u('t'); cdr[2691] = 2690; tag[2691] = atomtag;
+car[2690] = u('r'); cdr[2690] = 2689; tag[2690] = atomtag;
+car[2689] = u('u'); cdr[2689] = 2688; tag[2689] = atomtag;
+car[2688] = u('e'); cdr[2688] = 2687; tag[2688] = atomtag;
+car[2687] = u(':'); cdr[2687] = 2686; tag[2687] = atomtag;
+car[2686] = u(' '); cdr[2686] = 2685; tag[2686] = atomtag;
+car[2685] = u('n'); cdr[2685] = 2684; tag[2685] = atomtag;
+car[2684] = u('i'); cdr[2684] = 2683; tag[2684] = atomtag;
+car[2683] = u('l'); cdr[2683] = 2682; tag[2683] = atomtag;
+car[2682] = u(';'); cdr[2682] = 0; tag[2682] = atomtag;
+car[2681] = 2680; cdr[2681] = 0; tag[2681] = 0;
+car[2680] = u('r'); cdr[2680] = 2679; tag[2680] = atomtag;
+car[2679] = u('e'); cdr[2679] = 2678; tag[2679] = atomtag;
+car[2678] = u('f'); cdr[2678] = 2677; tag[2678] = atomtag;
+car[2677] = u('('); cdr[2677] = 2676; tag[2677] = atomtag;
+car[2676] = u('e'); cdr[2676] = 2675; tag[2676] = atomtag;
+car[2675] = u('x'); cdr[2675] = 2674; tag[2675] = atomtag;
+car[2674] = u('p'); cdr[2674] = 2673; tag[2674] = atomtag;
+car[2673] = u('r'); cdr[2673] = 2672; tag[2673] = atomtag;
+car[2672] = u(')'); cdr[2672] = 2671; tag[2672] = atomtag;
+car[2671] = u(' '); cdr[2671] = 2670; tag[2671] = atomtag;
+car[2670] = u('='); cdr[2670] = 2669; tag[2670] = atomtag;
+car[2669] = u(' '); cdr[2669] = 2668; tag[2669] = atomtag;
+car[2668] = u('c'); cdr[2668] = 2667; tag[2668] = atomtag;
+car[2667] = u('o'); cdr[2667] = 2666; tag[2667] = atomtag;
+car[2666] = u('n'); cdr[2666] = 2665; tag[2666] = atomtag;
+car[2665] = u('s'); cdr[2665] = 2664; tag[2665] = atomtag;
+car[2664] = u('3'); cdr[2664] = 2663; tag[2664] = atomtag;
+car[2663] = u('('); cdr[2663] = 2662; tag[2663] = atomtag;
+car[2662] = u('r'); cdr[2662] = 2661; tag[2662] = atomtag;
+car[2661] = u('e'); cdr[2661] = 2660; tag[2661] = atomtag;
+car[2660] = u('f'); cdr[2660] = 2659; tag[2660] = atomtag;
+car[2659] = u('('); cdr[2659] = 2658; tag[2659] = atomtag;
+car[2658] = u('e'); cdr[2658] = 2657; tag[2658] = atomtag;
+car[2657] = u('x'); cdr[2657] = 2656; tag[2657] = atomtag;
+car[2656] = u('p'); cdr[2656] = 2655; tag[2656] = atomtag;
+car[2655] = u('r'); cdr[2655] = 2654; tag[2655] = atomtag;
+car[2654] = u(')'); cdr[2654] = 2653; tag[2654] = atomtag;
+car[2653] = u(','); cdr[2653] = 2652; tag[2653] = atomtag;
+car[2652] = u(' '); cdr[2652] = 0; tag[2652] = atomtag;
+car[2651] = 2650; cdr[2651] = 0; tag[2651] = 0;
+car[2650] = u('r'); cdr[2650] = 2649; tag[2650] = atomtag;
+car[2649] = u('e'); cdr[2649] = 2648; tag[2649] = atomtag;
+car[2648] = u('f'); cdr[2648] = 2647; tag[2648] = atomtag;
+car[2647] = u('('); cdr[2647] = 2646; tag[2647] = atomtag;
+car[2646] = u('e'); cdr[2646] = 2645; tag[2646] = atomtag;
+car[2645] = u('x'); cdr[2645] = 2644; tag[2645] = atomtag;
+car[2644] = u('p'); cdr[2644] = 2643; tag[2644] = atomtag;
+car[2643] = u('r'); cdr[2643] = 2642; tag[2643] = atomtag;
+car[2642] = u('2'); cdr[2642] = 2641; tag[2642] = atomtag;
+car[2641] = u(')'); cdr[2641] = 2640; tag[2641] = atomtag;
+car[2640] = u(','); cdr[2640] = 2639; tag[2640] = atomtag;
+car[2639] = u(' '); cdr[2639] = 2638; tag[2639] = atomtag;
+car[2638] = u('0'); cdr[2638] = 2637; tag[2638] = atomtag;
+car[2637] = u(')'); cdr[2637] = 2636; tag[2637] = atomtag;
+car[2636] = u(';'); cdr[2636] = 0; tag[2636] = atomtag;
+car[2635] = 2634; cdr[2635] = 0; tag[2635] = 0;
+car[2634] = u('r'); cdr[2634] = 2633; tag[2634] = atomtag;
+car[2633] = u('e'); cdr[2633] = 2632; tag[2633] = atomtag;
+car[2632] = u('f'); cdr[2632] = 2631; tag[2632] = atomtag;
+car[2631] = u('('); cdr[2631] = 2630; tag[2631] = atomtag;
+car[2630] = u('e'); cdr[2630] = 2629; tag[2630] = atomtag;
+car[2629] = u('x'); cdr[2629] = 2628; tag[2629] = atomtag;
 car[2628] = u('p'); cdr[2628] = 2627; tag[2628] = atomtag;
-car[2627] = u('('); cdr[2627] = 2626; tag[2627] = atomtag;
-car[2626] = u('v'); cdr[2626] = 2625; tag[2626] = atomtag;
-car[2625] = u('o'); cdr[2625] = 2624; tag[2625] = atomtag;
-car[2624] = u('i'); cdr[2624] = 2623; tag[2624] = atomtag;
-car[2623] = u('d'); cdr[2623] = 2622; tag[2623] = atomtag;
-car[2622] = u(')'); cdr[2622] = 2621; tag[2622] = atomtag;
-car[2621] = u(' '); cdr[2621] = 2620; tag[2621] = atomtag;
-car[2620] = u('{'); cdr[2620] = 0; tag[2620] = atomtag;
-car[2619] = 2618; cdr[2619] = 0; tag[2619] = 0;
-car[2618] = u('}'); cdr[2618] = 2617; tag[2618] = atomtag;
-car[2617] = u('}'); cdr[2617] = 0; tag[2617] = atomtag;
-car[2616] = 2615; cdr[2616] = 0; tag[2616] = 0;
-car[2615] = u('r'); cdr[2615] = 2614; tag[2615] = atomtag;
+car[2627] = u('r'); cdr[2627] = 2626; tag[2627] = atomtag;
+car[2626] = u(')'); cdr[2626] = 2625; tag[2626] = atomtag;
+car[2625] = u(' '); cdr[2625] = 2624; tag[2625] = atomtag;
+car[2624] = u('='); cdr[2624] = 2623; tag[2624] = atomtag;
+car[2623] = u(' '); cdr[2623] = 2622; tag[2623] = atomtag;
+car[2622] = u('c'); cdr[2622] = 2621; tag[2622] = atomtag;
+car[2621] = u('d'); cdr[2621] = 2620; tag[2621] = atomtag;
+car[2620] = u('r'); cdr[2620] = 2619; tag[2620] = atomtag;
+car[2619] = u('['); cdr[2619] = 2618; tag[2619] = atomtag;
+car[2618] = u('r'); cdr[2618] = 2617; tag[2618] = atomtag;
+car[2617] = u('e'); cdr[2617] = 2616; tag[2617] = atomtag;
+car[2616] = u('f'); cdr[2616] = 2615; tag[2616] = atomtag;
+car[2615] = u('('); cdr[2615] = 2614; tag[2615] = atomtag;
 car[2614] = u('e'); cdr[2614] = 2613; tag[2614] = atomtag;
-car[2613] = u('t'); cdr[2613] = 2612; tag[2613] = atomtag;
-car[2612] = u('u'); cdr[2612] = 2611; tag[2612] = atomtag;
+car[2613] = u('x'); cdr[2613] = 2612; tag[2613] = atomtag;
+car[2612] = u('p'); cdr[2612] = 2611; tag[2612] = atomtag;
 car[2611] = u('r'); cdr[2611] = 2610; tag[2611] = atomtag;
-car[2610] = u('n'); cdr[2610] = 2609; tag[2610] = atomtag;
-car[2609] = u(';'); cdr[2609] = 0; tag[2609] = atomtag;
-car[2608] = 2607; cdr[2608] = 0; tag[2608] = 0;
-car[2607] = u('i'); cdr[2607] = 2606; tag[2607] = atomtag;
-car[2606] = u('n'); cdr[2606] = 2605; tag[2606] = atomtag;
-car[2605] = u('i'); cdr[2605] = 2604; tag[2605] = atomtag;
-car[2604] = u('t'); cdr[2604] = 2603; tag[2604] = atomtag;
-car[2603] = u('-'); cdr[2603] = 2602; tag[2603] = atomtag;
-car[2602] = u('c'); cdr[2602] = 2601; tag[2602] = atomtag;
-car[2601] = u('e'); cdr[2601] = 2600; tag[2601] = atomtag;
-car[2600] = u('l'); cdr[2600] = 2599; tag[2600] = atomtag;
-car[2599] = u('l'); cdr[2599] = 2598; tag[2599] = atomtag;
-car[2598] = u('s'); cdr[2598] = 0; tag[2598] = atomtag;
-car[2597] = 570; cdr[2597] = 0; tag[2597] = 0;
-car[2596] = 2595; cdr[2596] = 0; tag[2596] = 0;
-car[2595] = u('c'); cdr[2595] = 2594; tag[2595] = atomtag;
-car[2594] = u('a'); cdr[2594] = 2593; tag[2594] = atomtag;
-car[2593] = u('r'); cdr[2593] = 2592; tag[2593] = atomtag;
-car[2592] = u('['); cdr[2592] = 0; tag[2592] = atomtag;
-car[2591] = 2590; cdr[2591] = 0; tag[2591] = 0;
-car[2590] = u('c'); cdr[2590] = 2589; tag[2590] = atomtag;
-car[2589] = u('d'); cdr[2589] = 2588; tag[2589] = atomtag;
-car[2588] = u('r'); cdr[2588] = 2587; tag[2588] = atomtag;
-car[2587] = u('['); cdr[2587] = 0; tag[2587] = atomtag;
-car[2586] = 2585; cdr[2586] = 0; tag[2586] = 0;
-car[2585] = u(';'); cdr[2585] = 2584; tag[2585] = atomtag;
-car[2584] = u(' '); cdr[2584] = 0; tag[2584] = atomtag;
-car[2583] = 2582; cdr[2583] = 0; tag[2583] = 0;
-car[2582] = u('t'); cdr[2582] = 2581; tag[2582] = atomtag;
-car[2581] = u('a'); cdr[2581] = 2580; tag[2581] = atomtag;
-car[2580] = u('g'); cdr[2580] = 2579; tag[2580] = atomtag;
-car[2579] = u('['); cdr[2579] = 0; tag[2579] = atomtag;
-car[2578] = 2577; cdr[2578] = 0; tag[2578] = 0;
-car[2577] = u(']'); cdr[2577] = 2576; tag[2577] = atomtag;
-car[2576] = u(' '); cdr[2576] = 2575; tag[2576] = atomtag;
-car[2575] = u('='); cdr[2575] = 2574; tag[2575] = atomtag;
-car[2574] = u(' '); cdr[2574] = 0; tag[2574] = atomtag;
-car[2573] = 570; cdr[2573] = 0; tag[2573] = 0;
-car[2572] = 2571; cdr[2572] = 0; tag[2572] = 0;
-car[2571] = u('i'); cdr[2571] = 2570; tag[2571] = atomtag;
-car[2570] = u('n'); cdr[2570] = 2569; tag[2570] = atomtag;
-car[2569] = u('i'); cdr[2569] = 2568; tag[2569] = atomtag;
-car[2568] = u('t'); cdr[2568] = 0; tag[2568] = atomtag;
+car[2610] = u(')'); cdr[2610] = 2609; tag[2610] = atomtag;
+car[2609] = u(']'); cdr[2609] = 2608; tag[2609] = atomtag;
+car[2608] = u(';'); cdr[2608] = 0; tag[2608] = atomtag;
+car[2607] = 2606; cdr[2607] = 0; tag[2607] = 0;
+car[2606] = u('i'); cdr[2606] = 2605; tag[2606] = atomtag;
+car[2605] = u('f'); cdr[2605] = 2604; tag[2605] = atomtag;
+car[2604] = u(' '); cdr[2604] = 2603; tag[2604] = atomtag;
+car[2603] = u('('); cdr[2603] = 2602; tag[2603] = atomtag;
+car[2602] = u('n'); cdr[2602] = 2601; tag[2602] = atomtag;
+car[2601] = u('u'); cdr[2601] = 2600; tag[2601] = atomtag;
+car[2600] = u('m'); cdr[2600] = 2599; tag[2600] = atomtag;
+car[2599] = u('e'); cdr[2599] = 2598; tag[2599] = atomtag;
+car[2598] = u('r'); cdr[2598] = 2597; tag[2598] = atomtag;
+car[2597] = u('i'); cdr[2597] = 2596; tag[2597] = atomtag;
+car[2596] = u('c'); cdr[2596] = 2595; tag[2596] = atomtag;
+car[2595] = u('('); cdr[2595] = 2594; tag[2595] = atomtag;
+car[2594] = u(')'); cdr[2594] = 2593; tag[2594] = atomtag;
+car[2593] = u(' '); cdr[2593] = 2592; tag[2593] = atomtag;
+car[2592] = u('|'); cdr[2592] = 2591; tag[2592] = atomtag;
+car[2591] = u('|'); cdr[2591] = 2590; tag[2591] = atomtag;
+car[2590] = u(' '); cdr[2590] = 2589; tag[2590] = atomtag;
+car[2589] = u('s'); cdr[2589] = 2588; tag[2589] = atomtag;
+car[2588] = u('y'); cdr[2588] = 2587; tag[2588] = atomtag;
+car[2587] = u('m'); cdr[2587] = 2586; tag[2587] = atomtag;
+car[2586] = u('b'); cdr[2586] = 2585; tag[2586] = atomtag;
+car[2585] = u('o'); cdr[2585] = 2584; tag[2585] = atomtag;
+car[2584] = u('l'); cdr[2584] = 2583; tag[2584] = atomtag;
+car[2583] = u('i'); cdr[2583] = 2582; tag[2583] = atomtag;
+car[2582] = u('c'); cdr[2582] = 2581; tag[2582] = atomtag;
+car[2581] = u('('); cdr[2581] = 2580; tag[2581] = atomtag;
+car[2580] = u(')'); cdr[2580] = 2579; tag[2580] = atomtag;
+car[2579] = u(')'); cdr[2579] = 2578; tag[2579] = atomtag;
+car[2578] = u(' '); cdr[2578] = 2577; tag[2578] = atomtag;
+car[2577] = u('c'); cdr[2577] = 2576; tag[2577] = atomtag;
+car[2576] = u('d'); cdr[2576] = 2575; tag[2576] = atomtag;
+car[2575] = u('r'); cdr[2575] = 2574; tag[2575] = atomtag;
+car[2574] = u('_'); cdr[2574] = 2573; tag[2574] = atomtag;
+car[2573] = u('e'); cdr[2573] = 2572; tag[2573] = atomtag;
+car[2572] = u('r'); cdr[2572] = 2571; tag[2572] = atomtag;
+car[2571] = u('r'); cdr[2571] = 2570; tag[2571] = atomtag;
+car[2570] = u('('); cdr[2570] = 2569; tag[2570] = atomtag;
+car[2569] = u(')'); cdr[2569] = 2568; tag[2569] = atomtag;
+car[2568] = u(';'); cdr[2568] = 0; tag[2568] = atomtag;
 car[2567] = 2566; cdr[2567] = 0; tag[2567] = 0;
-car[2566] = u('c'); cdr[2566] = 2565; tag[2566] = atomtag;
-car[2565] = u('h'); cdr[2565] = 2564; tag[2565] = atomtag;
-car[2564] = u('a'); cdr[2564] = 2563; tag[2564] = atomtag;
-car[2563] = u('r'); cdr[2563] = 0; tag[2563] = atomtag;
-car[2562] = 2561; cdr[2562] = 0; tag[2562] = 0;
-car[2561] = '\''; cdr[2561] = 2560; tag[2561] = atomtag;
-car[2560] = '\\'; cdr[2560] = 2559; tag[2560] = atomtag;
-car[2559] = '\\'; cdr[2559] = 2558; tag[2559] = atomtag;
-car[2558] = '\''; cdr[2558] = 0; tag[2558] = atomtag;
-car[2557] = 2556; cdr[2557] = 0; tag[2557] = 0;
-car[2556] = '\''; cdr[2556] = 2555; tag[2556] = atomtag;
-car[2555] = '\\'; cdr[2555] = 2554; tag[2555] = atomtag;
-car[2554] = '\''; cdr[2554] = 2553; tag[2554] = atomtag;
-car[2553] = '\''; cdr[2553] = 0; tag[2553] = atomtag;
-car[2552] = 2551; cdr[2552] = 0; tag[2552] = 0;
-car[2551] = '\''; cdr[2551] = 2550; tag[2551] = atomtag;
-car[2550] = '\\'; cdr[2550] = 2549; tag[2550] = atomtag;
-car[2549] = u('n'); cdr[2549] = 2548; tag[2549] = atomtag;
-car[2548] = '\''; cdr[2548] = 0; tag[2548] = atomtag;
-car[2547] = 521; cdr[2547] = 0; tag[2547] = 0;
-car[2546] = 2545; cdr[2546] = 0; tag[2546] = 0;
-car[2545] = u('e'); cdr[2545] = 2544; tag[2545] = atomtag;
-car[2544] = u('m'); cdr[2544] = 2543; tag[2544] = atomtag;
-car[2543] = u('i'); cdr[2543] = 2542; tag[2543] = atomtag;
-car[2542] = u('t'); cdr[2542] = 2541; tag[2542] = atomtag;
-car[2541] = u('-'); cdr[2541] = 2540; tag[2541] = atomtag;
-car[2540] = u('o'); cdr[2540] = 2539; tag[2540] = atomtag;
-car[2539] = u('b'); cdr[2539] = 2538; tag[2539] = atomtag;
-car[2538] = u('l'); cdr[2538] = 2537; tag[2538] = atomtag;
-car[2537] = u('i'); cdr[2537] = 2536; tag[2537] = atomtag;
-car[2536] = u('s'); cdr[2536] = 2535; tag[2536] = atomtag;
-car[2535] = u('t'); cdr[2535] = 0; tag[2535] = atomtag;
-car[2534] = 2533; cdr[2534] = 0; tag[2534] = 0;
-car[2533] = u('r'); cdr[2533] = 2532; tag[2533] = atomtag;
-car[2532] = u('e'); cdr[2532] = 2531; tag[2532] = atomtag;
-car[2531] = u('f'); cdr[2531] = 2530; tag[2531] = atomtag;
-car[2530] = u('('); cdr[2530] = 2529; tag[2530] = atomtag;
-car[2529] = u('o'); cdr[2529] = 2528; tag[2529] = atomtag;
-car[2528] = u('b'); cdr[2528] = 2527; tag[2528] = atomtag;
-car[2527] = u('l'); cdr[2527] = 2526; tag[2527] = atomtag;
-car[2526] = u('i'); cdr[2526] = 2525; tag[2526] = atomtag;
-car[2525] = u('s'); cdr[2525] = 2524; tag[2525] = atomtag;
-car[2524] = u('t'); cdr[2524] = 2523; tag[2524] = atomtag;
-car[2523] = u(')'); cdr[2523] = 2522; tag[2523] = atomtag;
+car[2566] = u('r'); cdr[2566] = 2565; tag[2566] = atomtag;
+car[2565] = u('e'); cdr[2565] = 2564; tag[2565] = atomtag;
+car[2564] = u('f'); cdr[2564] = 2563; tag[2564] = atomtag;
+car[2563] = u('('); cdr[2563] = 2562; tag[2563] = atomtag;
+car[2562] = u('e'); cdr[2562] = 2561; tag[2562] = atomtag;
+car[2561] = u('x'); cdr[2561] = 2560; tag[2561] = atomtag;
+car[2560] = u('p'); cdr[2560] = 2559; tag[2560] = atomtag;
+car[2559] = u('r'); cdr[2559] = 2558; tag[2559] = atomtag;
+car[2558] = u(')'); cdr[2558] = 2557; tag[2558] = atomtag;
+car[2557] = u(' '); cdr[2557] = 2556; tag[2557] = atomtag;
+car[2556] = u('='); cdr[2556] = 2555; tag[2556] = atomtag;
+car[2555] = u(' '); cdr[2555] = 2554; tag[2555] = atomtag;
+car[2554] = u('c'); cdr[2554] = 2553; tag[2554] = atomtag;
+car[2553] = u('a'); cdr[2553] = 2552; tag[2553] = atomtag;
+car[2552] = u('r'); cdr[2552] = 2551; tag[2552] = atomtag;
+car[2551] = u('['); cdr[2551] = 2550; tag[2551] = atomtag;
+car[2550] = u('r'); cdr[2550] = 2549; tag[2550] = atomtag;
+car[2549] = u('e'); cdr[2549] = 2548; tag[2549] = atomtag;
+car[2548] = u('f'); cdr[2548] = 2547; tag[2548] = atomtag;
+car[2547] = u('('); cdr[2547] = 2546; tag[2547] = atomtag;
+car[2546] = u('e'); cdr[2546] = 2545; tag[2546] = atomtag;
+car[2545] = u('x'); cdr[2545] = 2544; tag[2545] = atomtag;
+car[2544] = u('p'); cdr[2544] = 2543; tag[2544] = atomtag;
+car[2543] = u('r'); cdr[2543] = 2542; tag[2543] = atomtag;
+car[2542] = u(')'); cdr[2542] = 2541; tag[2542] = atomtag;
+car[2541] = u(']'); cdr[2541] = 2540; tag[2541] = atomtag;
+car[2540] = u(';'); cdr[2540] = 0; tag[2540] = atomtag;
+car[2539] = 2538; cdr[2539] = 0; tag[2539] = 0;
+car[2538] = u('i'); cdr[2538] = 2537; tag[2538] = atomtag;
+car[2537] = u('f'); cdr[2537] = 2536; tag[2537] = atomtag;
+car[2536] = u(' '); cdr[2536] = 2535; tag[2536] = atomtag;
+car[2535] = u('('); cdr[2535] = 2534; tag[2535] = atomtag;
+car[2534] = u('n'); cdr[2534] = 2533; tag[2534] = atomtag;
+car[2533] = u('u'); cdr[2533] = 2532; tag[2533] = atomtag;
+car[2532] = u('m'); cdr[2532] = 2531; tag[2532] = atomtag;
+car[2531] = u('e'); cdr[2531] = 2530; tag[2531] = atomtag;
+car[2530] = u('r'); cdr[2530] = 2529; tag[2530] = atomtag;
+car[2529] = u('i'); cdr[2529] = 2528; tag[2529] = atomtag;
+car[2528] = u('c'); cdr[2528] = 2527; tag[2528] = atomtag;
+car[2527] = u('('); cdr[2527] = 2526; tag[2527] = atomtag;
+car[2526] = u(')'); cdr[2526] = 2525; tag[2526] = atomtag;
+car[2525] = u(' '); cdr[2525] = 2524; tag[2525] = atomtag;
+car[2524] = u('|'); cdr[2524] = 2523; tag[2524] = atomtag;
+car[2523] = u('|'); cdr[2523] = 2522; tag[2523] = atomtag;
 car[2522] = u(' '); cdr[2522] = 2521; tag[2522] = atomtag;
-car[2521] = u('='); cdr[2521] = 2520; tag[2521] = atomtag;
-car[2520] = u(' '); cdr[2520] = 0; tag[2520] = atomtag;
-car[2519] = 2518; cdr[2519] = 2515; tag[2519] = 0;
-car[2518] = 2517; cdr[2518] = 0; tag[2518] = 0;
+car[2521] = u('s'); cdr[2521] = 2520; tag[2521] = atomtag;
+car[2520] = u('y'); cdr[2520] = 2519; tag[2520] = atomtag;
+car[2519] = u('m'); cdr[2519] = 2518; tag[2519] = atomtag;
+car[2518] = u('b'); cdr[2518] = 2517; tag[2518] = atomtag;
 car[2517] = u('o'); cdr[2517] = 2516; tag[2517] = atomtag;
-car[2516] = u('l'); cdr[2516] = 0; tag[2516] = atomtag;
-car[2515] = 333; cdr[2515] = 0; tag[2515] = 0;
-car[2514] = 2513; cdr[2514] = 0; tag[2514] = 0;
-car[2513] = u('p'); cdr[2513] = 2512; tag[2513] = atomtag;
-car[2512] = u('r'); cdr[2512] = 2511; tag[2512] = atomtag;
-car[2511] = u('o'); cdr[2511] = 2510; tag[2511] = atomtag;
-car[2510] = u('l'); cdr[2510] = 2509; tag[2510] = atomtag;
-car[2509] = u('o'); cdr[2509] = 2508; tag[2509] = atomtag;
-car[2508] = u('g'); cdr[2508] = 0; tag[2508] = atomtag;
-car[2507] = 2506; cdr[2507] = 0; tag[2507] = 0;
-car[2506] = u('c'); cdr[2506] = 2505; tag[2506] = atomtag;
-car[2505] = u('a'); cdr[2505] = 2504; tag[2505] = atomtag;
-car[2504] = u('s'); cdr[2504] = 2503; tag[2504] = atomtag;
-car[2503] = u('e'); cdr[2503] = 2502; tag[2503] = atomtag;
-car[2502] = u(' '); cdr[2502] = 2501; tag[2502] = atomtag;
-car[2501] = u('0'); cdr[2501] = 2500; tag[2501] = atomtag;
-car[2500] = u(':'); cdr[2500] = 0; tag[2500] = atomtag;
+car[2516] = u('l'); cdr[2516] = 2515; tag[2516] = atomtag;
+car[2515] = u('i'); cdr[2515] = 2514; tag[2515] = atomtag;
+car[2514] = u('c'); cdr[2514] = 2513; tag[2514] = atomtag;
+car[2513] = u('('); cdr[2513] = 2512; tag[2513] = atomtag;
+car[2512] = u(')'); cdr[2512] = 2511; tag[2512] = atomtag;
+car[2511] = u(')'); cdr[2511] = 2510; tag[2511] = atomtag;
+car[2510] = u(' '); cdr[2510] = 2509; tag[2510] = atomtag;
+car[2509] = u('c'); cdr[2509] = 2508; tag[2509] = atomtag;
+car[2508] = u('a'); cdr[2508] = 2507; tag[2508] = atomtag;
+car[2507] = u('r'); cdr[2507] = 2506; tag[2507] = atomtag;
+car[2506] = u('_'); cdr[2506] = 2505; tag[2506] = atomtag;
+car[2505] = u('e'); cdr[2505] = 2504; tag[2505] = atomtag;
+car[2504] = u('r'); cdr[2504] = 2503; tag[2504] = atomtag;
+car[2503] = u('r'); cdr[2503] = 2502; tag[2503] = atomtag;
+car[2502] = u('('); cdr[2502] = 2501; tag[2502] = atomtag;
+car[2501] = u(')'); cdr[2501] = 2500; tag[2501] = atomtag;
+car[2500] = u(';'); cdr[2500] = 0; tag[2500] = atomtag;
 car[2499] = 2498; cdr[2499] = 0; tag[2499] = 0;
-car[2498] = u('f'); cdr[2498] = 2497; tag[2498] = atomtag;
-car[2497] = u('o'); cdr[2497] = 2496; tag[2497] = atomtag;
-car[2496] = u('r'); cdr[2496] = 2495; tag[2496] = atomtag;
-car[2495] = u(' '); cdr[2495] = 2494; tag[2495] = atomtag;
-car[2494] = u('('); cdr[2494] = 2493; tag[2494] = atomtag;
-car[2493] = u('k'); cdr[2493] = 2492; tag[2493] = atomtag;
-car[2492] = u('='); cdr[2492] = 2491; tag[2492] = atomtag;
-car[2491] = u('0'); cdr[2491] = 2490; tag[2491] = atomtag;
-car[2490] = u(';'); cdr[2490] = 2489; tag[2490] = atomtag;
-car[2489] = u(';'); cdr[2489] = 2488; tag[2489] = atomtag;
-car[2488] = u(')'); cdr[2488] = 2487; tag[2488] = atomtag;
+car[2498] = u('r'); cdr[2498] = 2497; tag[2498] = atomtag;
+car[2497] = u('e'); cdr[2497] = 2496; tag[2497] = atomtag;
+car[2496] = u('f'); cdr[2496] = 2495; tag[2496] = atomtag;
+car[2495] = u('('); cdr[2495] = 2494; tag[2495] = atomtag;
+car[2494] = u('e'); cdr[2494] = 2493; tag[2494] = atomtag;
+car[2493] = u('x'); cdr[2493] = 2492; tag[2493] = atomtag;
+car[2492] = u('p'); cdr[2492] = 2491; tag[2492] = atomtag;
+car[2491] = u('r'); cdr[2491] = 2490; tag[2491] = atomtag;
+car[2490] = u(')'); cdr[2490] = 2489; tag[2490] = atomtag;
+car[2489] = u(' '); cdr[2489] = 2488; tag[2489] = atomtag;
+car[2488] = u('='); cdr[2488] = 2487; tag[2488] = atomtag;
 car[2487] = u(' '); cdr[2487] = 2486; tag[2487] = atomtag;
-car[2486] = u('s'); cdr[2486] = 2485; tag[2486] = atomtag;
-car[2485] = u('w'); cdr[2485] = 2484; tag[2485] = atomtag;
-car[2484] = u('i'); cdr[2484] = 2483; tag[2484] = atomtag;
-car[2483] = u('t'); cdr[2483] = 2482; tag[2483] = atomtag;
-car[2482] = u('c'); cdr[2482] = 2481; tag[2482] = atomtag;
-car[2481] = u('h'); cdr[2481] = 2480; tag[2481] = atomtag;
-car[2480] = u(' '); cdr[2480] = 2479; tag[2480] = atomtag;
-car[2479] = u('('); cdr[2479] = 2478; tag[2479] = atomtag;
-car[2478] = u('k'); cdr[2478] = 2477; tag[2478] = atomtag;
-car[2477] = u(')'); cdr[2477] = 2476; tag[2477] = atomtag;
-car[2476] = u(' '); cdr[2476] = 2475; tag[2476] = atomtag;
-car[2475] = u('{'); cdr[2475] = 0; tag[2475] = atomtag;
-car[2474] = 2473; cdr[2474] = 0; tag[2474] = 0;
-car[2473] = u('s'); cdr[2473] = 2472; tag[2473] = atomtag;
-car[2472] = u('e'); cdr[2472] = 2471; tag[2472] = atomtag;
-car[2471] = u('t'); cdr[2471] = 2470; tag[2471] = atomtag;
-car[2470] = u('u'); cdr[2470] = 2469; tag[2470] = atomtag;
-car[2469] = u('p'); cdr[2469] = 2468; tag[2469] = atomtag;
-car[2468] = u('('); cdr[2468] = 2467; tag[2468] = atomtag;
-car[2467] = u(')'); cdr[2467] = 2466; tag[2467] = atomtag;
-car[2466] = u(';'); cdr[2466] = 0; tag[2466] = atomtag;
-car[2465] = 2464; cdr[2465] = 0; tag[2465] = 0;
-car[2464] = u('i'); cdr[2464] = 2463; tag[2464] = atomtag;
-car[2463] = u('n'); cdr[2463] = 2462; tag[2463] = atomtag;
-car[2462] = u('t'); cdr[2462] = 2461; tag[2462] = atomtag;
-car[2461] = u(' '); cdr[2461] = 2460; tag[2461] = atomtag;
-car[2460] = u('k'); cdr[2460] = 2459; tag[2460] = atomtag;
-car[2459] = u(';'); cdr[2459] = 0; tag[2459] = atomtag;
-car[2458] = 2457; cdr[2458] = 0; tag[2458] = 0;
-car[2457] = u('v'); cdr[2457] = 2456; tag[2457] = atomtag;
-car[2456] = u('o'); cdr[2456] = 2455; tag[2456] = atomtag;
-car[2455] = u('i'); cdr[2455] = 2454; tag[2455] = atomtag;
-car[2454] = u('d'); cdr[2454] = 2453; tag[2454] = atomtag;
-car[2453] = u(' '); cdr[2453] = 2452; tag[2453] = atomtag;
-car[2452] = u('r'); cdr[2452] = 2451; tag[2452] = atomtag;
-car[2451] = u('u'); cdr[2451] = 2450; tag[2451] = atomtag;
-car[2450] = u('n'); cdr[2450] = 2449; tag[2450] = atomtag;
-car[2449] = u('('); cdr[2449] = 2448; tag[2449] = atomtag;
-car[2448] = u('v'); cdr[2448] = 2447; tag[2448] = atomtag;
+car[2486] = u('a'); cdr[2486] = 2485; tag[2486] = atomtag;
+car[2485] = u('t'); cdr[2485] = 2484; tag[2485] = atomtag;
+car[2484] = u('o'); cdr[2484] = 2483; tag[2484] = atomtag;
+car[2483] = u('m'); cdr[2483] = 2482; tag[2483] = atomtag;
+car[2482] = u('i'); cdr[2482] = 2481; tag[2482] = atomtag;
+car[2481] = u('c'); cdr[2481] = 2480; tag[2481] = atomtag;
+car[2480] = u('('); cdr[2480] = 2479; tag[2480] = atomtag;
+car[2479] = u(')'); cdr[2479] = 2478; tag[2479] = atomtag;
+car[2478] = u('?'); cdr[2478] = 2477; tag[2478] = atomtag;
+car[2477] = u(' '); cdr[2477] = 2476; tag[2477] = atomtag;
+car[2476] = u('t'); cdr[2476] = 2475; tag[2476] = atomtag;
+car[2475] = u('r'); cdr[2475] = 2474; tag[2475] = atomtag;
+car[2474] = u('u'); cdr[2474] = 2473; tag[2474] = atomtag;
+car[2473] = u('e'); cdr[2473] = 2472; tag[2473] = atomtag;
+car[2472] = u(':'); cdr[2472] = 2471; tag[2472] = atomtag;
+car[2471] = u(' '); cdr[2471] = 2470; tag[2471] = atomtag;
+car[2470] = u('n'); cdr[2470] = 2469; tag[2470] = atomtag;
+car[2469] = u('i'); cdr[2469] = 2468; tag[2469] = atomtag;
+car[2468] = u('l'); cdr[2468] = 2467; tag[2468] = atomtag;
+car[2467] = u(';'); cdr[2467] = 0; tag[2467] = atomtag;
+car[2466] = 2465; cdr[2466] = 0; tag[2466] = 0;
+car[2465] = u('s'); cdr[2465] = 2464; tag[2465] = atomtag;
+car[2464] = u('e'); cdr[2464] = 2463; tag[2464] = atomtag;
+car[2463] = u('t'); cdr[2463] = 2462; tag[2463] = atomtag;
+car[2462] = u('q'); cdr[2462] = 0; tag[2462] = atomtag;
+car[2461] = 2460; cdr[2461] = 0; tag[2461] = 0;
+car[2460] = u('p'); cdr[2460] = 2459; tag[2460] = atomtag;
+car[2459] = u('r'); cdr[2459] = 2458; tag[2459] = atomtag;
+car[2458] = u('o'); cdr[2458] = 2457; tag[2458] = atomtag;
+car[2457] = u('g'); cdr[2457] = 2456; tag[2457] = atomtag;
+car[2456] = u('n'); cdr[2456] = 0; tag[2456] = atomtag;
+car[2455] = 2454; cdr[2455] = 0; tag[2455] = 0;
+car[2454] = u('l'); cdr[2454] = 2453; tag[2454] = atomtag;
+car[2453] = u('a'); cdr[2453] = 2452; tag[2453] = atomtag;
+car[2452] = u('b'); cdr[2452] = 2451; tag[2452] = atomtag;
+car[2451] = u('e'); cdr[2451] = 2450; tag[2451] = atomtag;
+car[2450] = u('l'); cdr[2450] = 0; tag[2450] = atomtag;
+car[2449] = 2448; cdr[2449] = 0; tag[2449] = 0;
+car[2448] = u('c'); cdr[2448] = 2447; tag[2448] = atomtag;
 car[2447] = u('o'); cdr[2447] = 2446; tag[2447] = atomtag;
-car[2446] = u('i'); cdr[2446] = 2445; tag[2446] = atomtag;
-car[2445] = u('d'); cdr[2445] = 2444; tag[2445] = atomtag;
-car[2444] = u(')'); cdr[2444] = 2443; tag[2444] = atomtag;
-car[2443] = u(' '); cdr[2443] = 2442; tag[2443] = atomtag;
-car[2442] = u('{'); cdr[2442] = 0; tag[2442] = atomtag;
-car[2441] = 2440; cdr[2441] = 0; tag[2441] = 0;
-car[2440] = u('/'); cdr[2440] = 2439; tag[2440] = atomtag;
-car[2439] = u('*'); cdr[2439] = 2438; tag[2439] = atomtag;
-car[2438] = u('*'); cdr[2438] = 2437; tag[2438] = atomtag;
-car[2437] = u('*'); cdr[2437] = 2436; tag[2437] = atomtag;
-car[2436] = u('*'); cdr[2436] = 2435; tag[2436] = atomtag;
-car[2435] = u('*'); cdr[2435] = 2434; tag[2435] = atomtag;
-car[2434] = u('*'); cdr[2434] = 2433; tag[2434] = atomtag;
-car[2433] = u('*'); cdr[2433] = 2432; tag[2433] = atomtag;
-car[2432] = u('*'); cdr[2432] = 2431; tag[2432] = atomtag;
-car[2431] = u(' '); cdr[2431] = 2430; tag[2431] = atomtag;
-car[2430] = u('l'); cdr[2430] = 2429; tag[2430] = atomtag;
-car[2429] = u('i'); cdr[2429] = 2428; tag[2429] = atomtag;
-car[2428] = u('s'); cdr[2428] = 2427; tag[2428] = atomtag;
-car[2427] = u('c'); cdr[2427] = 2426; tag[2427] = atomtag;
-car[2426] = u('m'); cdr[2426] = 2425; tag[2426] = atomtag;
-car[2425] = u('p'); cdr[2425] = 2424; tag[2425] = atomtag;
-car[2424] = u(' '); cdr[2424] = 2423; tag[2424] = atomtag;
-car[2423] = u('o'); cdr[2423] = 2422; tag[2423] = atomtag;
-car[2422] = u('u'); cdr[2422] = 2421; tag[2422] = atomtag;
-car[2421] = u('t'); cdr[2421] = 2420; tag[2421] = atomtag;
+car[2446] = u('n'); cdr[2446] = 2445; tag[2446] = atomtag;
+car[2445] = u('d'); cdr[2445] = 0; tag[2445] = atomtag;
+car[2444] = 2443; cdr[2444] = 0; tag[2444] = 0;
+car[2443] = u('r'); cdr[2443] = 2442; tag[2443] = atomtag;
+car[2442] = u('e'); cdr[2442] = 2441; tag[2442] = atomtag;
+car[2441] = u('f'); cdr[2441] = 2440; tag[2441] = atomtag;
+car[2440] = u('('); cdr[2440] = 2439; tag[2440] = atomtag;
+car[2439] = u('e'); cdr[2439] = 2438; tag[2439] = atomtag;
+car[2438] = u('x'); cdr[2438] = 2437; tag[2438] = atomtag;
+car[2437] = u('p'); cdr[2437] = 2436; tag[2437] = atomtag;
+car[2436] = u('r'); cdr[2436] = 2435; tag[2436] = atomtag;
+car[2435] = u(')'); cdr[2435] = 2434; tag[2435] = atomtag;
+car[2434] = u(' '); cdr[2434] = 2433; tag[2434] = atomtag;
+car[2433] = u('='); cdr[2433] = 2432; tag[2433] = atomtag;
+car[2432] = u(' '); cdr[2432] = 2431; tag[2432] = atomtag;
+car[2431] = u('v'); cdr[2431] = 2430; tag[2431] = atomtag;
+car[2430] = u('a'); cdr[2430] = 2429; tag[2430] = atomtag;
+car[2429] = u('l'); cdr[2429] = 2428; tag[2429] = atomtag;
+car[2428] = u('('); cdr[2428] = 0; tag[2428] = atomtag;
+car[2427] = 2426; cdr[2427] = 0; tag[2427] = 0;
+car[2426] = u('r'); cdr[2426] = 2425; tag[2426] = atomtag;
+car[2425] = u('e'); cdr[2425] = 2424; tag[2425] = atomtag;
+car[2424] = u('f'); cdr[2424] = 2423; tag[2424] = atomtag;
+car[2423] = u('('); cdr[2423] = 2422; tag[2423] = atomtag;
+car[2422] = u('e'); cdr[2422] = 2421; tag[2422] = atomtag;
+car[2421] = u('x'); cdr[2421] = 2420; tag[2421] = atomtag;
 car[2420] = u('p'); cdr[2420] = 2419; tag[2420] = atomtag;
-car[2419] = u('u'); cdr[2419] = 2418; tag[2419] = atomtag;
-car[2418] = u('t'); cdr[2418] = 2417; tag[2418] = atomtag;
+car[2419] = u('r'); cdr[2419] = 2418; tag[2419] = atomtag;
+car[2418] = u(')'); cdr[2418] = 2417; tag[2418] = atomtag;
 car[2417] = u(' '); cdr[2417] = 2416; tag[2417] = atomtag;
-car[2416] = u('f'); cdr[2416] = 2415; tag[2416] = atomtag;
-car[2415] = u('o'); cdr[2415] = 2414; tag[2415] = atomtag;
-car[2414] = u('l'); cdr[2414] = 2413; tag[2414] = atomtag;
-car[2413] = u('l'); cdr[2413] = 2412; tag[2413] = atomtag;
-car[2412] = u('o'); cdr[2412] = 2411; tag[2412] = atomtag;
-car[2411] = u('w'); cdr[2411] = 2410; tag[2411] = atomtag;
-car[2410] = u('s'); cdr[2410] = 2409; tag[2410] = atomtag;
-car[2409] = u(' '); cdr[2409] = 2408; tag[2409] = atomtag;
-car[2408] = u('*'); cdr[2408] = 2407; tag[2408] = atomtag;
-car[2407] = u('*'); cdr[2407] = 2406; tag[2407] = atomtag;
-car[2406] = u('*'); cdr[2406] = 2405; tag[2406] = atomtag;
-car[2405] = u('*'); cdr[2405] = 2404; tag[2405] = atomtag;
-car[2404] = u('*'); cdr[2404] = 2403; tag[2404] = atomtag;
-car[2403] = u('*'); cdr[2403] = 2402; tag[2403] = atomtag;
-car[2402] = u('*'); cdr[2402] = 2401; tag[2402] = atomtag;
-car[2401] = u('*'); cdr[2401] = 2400; tag[2401] = atomtag;
-car[2400] = u('/'); cdr[2400] = 0; tag[2400] = atomtag;
-car[2399] = 2398; cdr[2399] = 0; tag[2399] = 0;
-car[2398] = u('w'); cdr[2398] = 2397; tag[2398] = atomtag;
-car[2397] = u('r'); cdr[2397] = 2396; tag[2397] = atomtag;
-car[2396] = u('i'); cdr[2396] = 2395; tag[2396] = atomtag;
-car[2395] = u('t'); cdr[2395] = 2394; tag[2395] = atomtag;
-car[2394] = u('e'); cdr[2394] = 2393; tag[2394] = atomtag;
-car[2393] = u('c'); cdr[2393] = 2392; tag[2393] = atomtag;
-car[2392] = u('('); cdr[2392] = 2391; tag[2392] = atomtag;
-car[2391] = u('r'); cdr[2391] = 2390; tag[2391] = atomtag;
-car[2390] = u('e'); cdr[2390] = 2389; tag[2390] = atomtag;
-car[2389] = u('f'); cdr[2389] = 2388; tag[2389] = atomtag;
-car[2388] = u('('); cdr[2388] = 2387; tag[2388] = atomtag;
-car[2387] = u('e'); cdr[2387] = 2386; tag[2387] = atomtag;
-car[2386] = u('x'); cdr[2386] = 2385; tag[2386] = atomtag;
-car[2385] = u('p'); cdr[2385] = 2384; tag[2385] = atomtag;
-car[2384] = u('r'); cdr[2384] = 2383; tag[2384] = atomtag;
-car[2383] = u(')'); cdr[2383] = 2382; tag[2383] = atomtag;
-car[2382] = u(')'); cdr[2382] = 2381; tag[2382] = atomtag;
-car[2381] = u(';'); cdr[2381] = 0; tag[2381] = atomtag;
-car[2380] = 2379; cdr[2380] = 0; tag[2380] = 0;
-car[2379] = u('*'); cdr[2379] = 2378; tag[2379] = atomtag;
-car[2378] = u('w'); cdr[2378] = 2377; tag[2378] = atomtag;
-car[2377] = u('r'); cdr[2377] = 2376; tag[2377] = atomtag;
-car[2376] = u('i'); cdr[2376] = 2375; tag[2376] = atomtag;
-car[2375] = u('t'); cdr[2375] = 2374; tag[2375] = atomtag;
-car[2374] = u('e'); cdr[2374] = 2373; tag[2374] = atomtag;
-car[2373] = u('c'); cdr[2373] = 0; tag[2373] = atomtag;
-car[2372] = 2371; cdr[2372] = 0; tag[2372] = 0;
-car[2371] = u('c'); cdr[2371] = 2370; tag[2371] = atomtag;
-car[2370] = u('d'); cdr[2370] = 2369; tag[2370] = atomtag;
-car[2369] = u('r'); cdr[2369] = 2368; tag[2369] = atomtag;
-car[2368] = u('['); cdr[2368] = 2367; tag[2368] = atomtag;
-car[2367] = u('r'); cdr[2367] = 2366; tag[2367] = atomtag;
-car[2366] = u('e'); cdr[2366] = 2365; tag[2366] = atomtag;
-car[2365] = u('f'); cdr[2365] = 2364; tag[2365] = atomtag;
-car[2364] = u('('); cdr[2364] = 2363; tag[2364] = atomtag;
-car[2363] = u('e'); cdr[2363] = 2362; tag[2363] = atomtag;
-car[2362] = u('x'); cdr[2362] = 2361; tag[2362] = atomtag;
-car[2361] = u('p'); cdr[2361] = 2360; tag[2361] = atomtag;
-car[2360] = u('r'); cdr[2360] = 2359; tag[2360] = atomtag;
-car[2359] = u(')'); cdr[2359] = 2358; tag[2359] = atomtag;
-car[2358] = u(']'); cdr[2358] = 2357; tag[2358] = atomtag;
+car[2416] = u('='); cdr[2416] = 2415; tag[2416] = atomtag;
+car[2415] = u(' '); cdr[2415] = 0; tag[2415] = atomtag;
+car[2414] = 2413; cdr[2414] = 0; tag[2414] = 0;
+car[2413] = u('r'); cdr[2413] = 2412; tag[2413] = atomtag;
+car[2412] = u('e'); cdr[2412] = 2411; tag[2412] = atomtag;
+car[2411] = u('f'); cdr[2411] = 2410; tag[2411] = atomtag;
+car[2410] = u('('); cdr[2410] = 2409; tag[2410] = atomtag;
+car[2409] = u('e'); cdr[2409] = 2408; tag[2409] = atomtag;
+car[2408] = u('x'); cdr[2408] = 2407; tag[2408] = atomtag;
+car[2407] = u('p'); cdr[2407] = 2406; tag[2407] = atomtag;
+car[2406] = u('r'); cdr[2406] = 2405; tag[2406] = atomtag;
+car[2405] = u(')'); cdr[2405] = 2404; tag[2405] = atomtag;
+car[2404] = u(' '); cdr[2404] = 2403; tag[2404] = atomtag;
+car[2403] = u('='); cdr[2403] = 2402; tag[2403] = atomtag;
+car[2402] = u(' '); cdr[2402] = 2401; tag[2402] = atomtag;
+car[2401] = u('l'); cdr[2401] = 2400; tag[2401] = atomtag;
+car[2400] = u('i'); cdr[2400] = 2399; tag[2400] = atomtag;
+car[2399] = u('m'); cdr[2399] = 2398; tag[2399] = atomtag;
+car[2398] = u('i'); cdr[2398] = 2397; tag[2398] = atomtag;
+car[2397] = u('t'); cdr[2397] = 2396; tag[2397] = atomtag;
+car[2396] = u(';'); cdr[2396] = 0; tag[2396] = atomtag;
+car[2395] = 2394; cdr[2395] = 0; tag[2395] = 0;
+car[2394] = u('*'); cdr[2394] = 2393; tag[2394] = atomtag;
+car[2393] = u('l'); cdr[2393] = 2392; tag[2393] = atomtag;
+car[2392] = u('i'); cdr[2392] = 2391; tag[2392] = atomtag;
+car[2391] = u('m'); cdr[2391] = 2390; tag[2391] = atomtag;
+car[2390] = u('i'); cdr[2390] = 2389; tag[2390] = atomtag;
+car[2389] = u('t'); cdr[2389] = 0; tag[2389] = atomtag;
+car[2388] = 2387; cdr[2388] = 0; tag[2388] = 0;
+car[2387] = u('r'); cdr[2387] = 2386; tag[2387] = atomtag;
+car[2386] = u('e'); cdr[2386] = 2385; tag[2386] = atomtag;
+car[2385] = u('f'); cdr[2385] = 2384; tag[2385] = atomtag;
+car[2384] = u('('); cdr[2384] = 2383; tag[2384] = atomtag;
+car[2383] = u('e'); cdr[2383] = 2382; tag[2383] = atomtag;
+car[2382] = u('x'); cdr[2382] = 2381; tag[2382] = atomtag;
+car[2381] = u('p'); cdr[2381] = 2380; tag[2381] = atomtag;
+car[2380] = u('r'); cdr[2380] = 2379; tag[2380] = atomtag;
+car[2379] = u(')'); cdr[2379] = 2378; tag[2379] = atomtag;
+car[2378] = u(' '); cdr[2378] = 2377; tag[2378] = atomtag;
+car[2377] = u('='); cdr[2377] = 2376; tag[2377] = atomtag;
+car[2376] = u(' '); cdr[2376] = 2375; tag[2376] = atomtag;
+car[2375] = u('0'); cdr[2375] = 2374; tag[2375] = atomtag;
+car[2374] = u(';'); cdr[2374] = 0; tag[2374] = atomtag;
+car[2373] = 2372; cdr[2373] = 0; tag[2373] = 0;
+car[2372] = u('*'); cdr[2372] = 2371; tag[2372] = atomtag;
+car[2371] = u('p'); cdr[2371] = 2370; tag[2371] = atomtag;
+car[2370] = u('o'); cdr[2370] = 2369; tag[2370] = atomtag;
+car[2369] = u('o'); cdr[2369] = 2368; tag[2369] = atomtag;
+car[2368] = u('l'); cdr[2368] = 0; tag[2368] = atomtag;
+car[2367] = 2366; cdr[2367] = 0; tag[2367] = 0;
+car[2366] = u('r'); cdr[2366] = 2365; tag[2366] = atomtag;
+car[2365] = u('e'); cdr[2365] = 2364; tag[2365] = atomtag;
+car[2364] = u('f'); cdr[2364] = 2363; tag[2364] = atomtag;
+car[2363] = u('('); cdr[2363] = 2362; tag[2363] = atomtag;
+car[2362] = u('e'); cdr[2362] = 2361; tag[2362] = atomtag;
+car[2361] = u('x'); cdr[2361] = 2360; tag[2361] = atomtag;
+car[2360] = u('p'); cdr[2360] = 2359; tag[2360] = atomtag;
+car[2359] = u('r'); cdr[2359] = 2358; tag[2359] = atomtag;
+car[2358] = u(')'); cdr[2358] = 2357; tag[2358] = atomtag;
 car[2357] = u(' '); cdr[2357] = 2356; tag[2357] = atomtag;
 car[2356] = u('='); cdr[2356] = 2355; tag[2356] = atomtag;
 car[2355] = u(' '); cdr[2355] = 2354; tag[2355] = atomtag;
-car[2354] = u('r'); cdr[2354] = 2353; tag[2354] = atomtag;
-car[2353] = u('e'); cdr[2353] = 2352; tag[2353] = atomtag;
-car[2352] = u('f'); cdr[2352] = 2351; tag[2352] = atomtag;
-car[2351] = u('('); cdr[2351] = 2350; tag[2351] = atomtag;
-car[2350] = u('e'); cdr[2350] = 2349; tag[2350] = atomtag;
-car[2349] = u('x'); cdr[2349] = 2348; tag[2349] = atomtag;
-car[2348] = u('p'); cdr[2348] = 2347; tag[2348] = atomtag;
-car[2347] = u('r'); cdr[2347] = 2346; tag[2347] = atomtag;
-car[2346] = u('2'); cdr[2346] = 2345; tag[2346] = atomtag;
-car[2345] = u(')'); cdr[2345] = 2344; tag[2345] = atomtag;
-car[2344] = u(';'); cdr[2344] = 0; tag[2344] = atomtag;
-car[2343] = 2342; cdr[2343] = 0; tag[2343] = 0;
-car[2342] = u('*'); cdr[2342] = 2341; tag[2342] = atomtag;
-car[2341] = u('r'); cdr[2341] = 2340; tag[2341] = atomtag;
-car[2340] = u('p'); cdr[2340] = 2339; tag[2340] = atomtag;
-car[2339] = u('l'); cdr[2339] = 2338; tag[2339] = atomtag;
-car[2338] = u('a'); cdr[2338] = 2337; tag[2338] = atomtag;
-car[2337] = u('c'); cdr[2337] = 2336; tag[2337] = atomtag;
-car[2336] = u('d'); cdr[2336] = 0; tag[2336] = atomtag;
-car[2335] = 2334; cdr[2335] = 0; tag[2335] = 0;
-car[2334] = u('c'); cdr[2334] = 2333; tag[2334] = atomtag;
-car[2333] = u('a'); cdr[2333] = 2332; tag[2333] = atomtag;
-car[2332] = u('r'); cdr[2332] = 2331; tag[2332] = atomtag;
-car[2331] = u('['); cdr[2331] = 2330; tag[2331] = atomtag;
+car[2354] = u('t'); cdr[2354] = 2353; tag[2354] = atomtag;
+car[2353] = u('r'); cdr[2353] = 2352; tag[2353] = atomtag;
+car[2352] = u('u'); cdr[2352] = 2351; tag[2352] = atomtag;
+car[2351] = u('e'); cdr[2351] = 2350; tag[2351] = atomtag;
+car[2350] = u(';'); cdr[2350] = 0; tag[2350] = atomtag;
+car[2349] = 135; cdr[2349] = 2348; tag[2349] = 0;
+car[2348] = 1223; cdr[2348] = 0; tag[2348] = 0;
+car[2347] = 2346; cdr[2347] = 0; tag[2347] = 0;
+car[2346] = u('a'); cdr[2346] = 2345; tag[2346] = atomtag;
+car[2345] = u('r'); cdr[2345] = 2344; tag[2345] = atomtag;
+car[2344] = u('i'); cdr[2344] = 2343; tag[2344] = atomtag;
+car[2343] = u('t'); cdr[2343] = 2342; tag[2343] = atomtag;
+car[2342] = u('h'); cdr[2342] = 2341; tag[2342] = atomtag;
+car[2341] = u('c'); cdr[2341] = 2340; tag[2341] = atomtag;
+car[2340] = u('o'); cdr[2340] = 2339; tag[2340] = atomtag;
+car[2339] = u('m'); cdr[2339] = 0; tag[2339] = atomtag;
+car[2338] = 2337; cdr[2338] = 0; tag[2338] = 0;
+car[2337] = u('r'); cdr[2337] = 2336; tag[2337] = atomtag;
+car[2336] = u('e'); cdr[2336] = 2335; tag[2336] = atomtag;
+car[2335] = u('f'); cdr[2335] = 2334; tag[2335] = atomtag;
+car[2334] = u('('); cdr[2334] = 2333; tag[2334] = atomtag;
+car[2333] = u('e'); cdr[2333] = 2332; tag[2333] = atomtag;
+car[2332] = u('x'); cdr[2332] = 2331; tag[2332] = atomtag;
+car[2331] = u('p'); cdr[2331] = 2330; tag[2331] = atomtag;
 car[2330] = u('r'); cdr[2330] = 2329; tag[2330] = atomtag;
-car[2329] = u('e'); cdr[2329] = 2328; tag[2329] = atomtag;
-car[2328] = u('f'); cdr[2328] = 2327; tag[2328] = atomtag;
-car[2327] = u('('); cdr[2327] = 2326; tag[2327] = atomtag;
-car[2326] = u('e'); cdr[2326] = 2325; tag[2326] = atomtag;
-car[2325] = u('x'); cdr[2325] = 2324; tag[2325] = atomtag;
-car[2324] = u('p'); cdr[2324] = 2323; tag[2324] = atomtag;
-car[2323] = u('r'); cdr[2323] = 2322; tag[2323] = atomtag;
-car[2322] = u(')'); cdr[2322] = 2321; tag[2322] = atomtag;
-car[2321] = u(']'); cdr[2321] = 2320; tag[2321] = atomtag;
-car[2320] = u(' '); cdr[2320] = 2319; tag[2320] = atomtag;
-car[2319] = u('='); cdr[2319] = 2318; tag[2319] = atomtag;
-car[2318] = u(' '); cdr[2318] = 2317; tag[2318] = atomtag;
-car[2317] = u('r'); cdr[2317] = 2316; tag[2317] = atomtag;
-car[2316] = u('e'); cdr[2316] = 2315; tag[2316] = atomtag;
-car[2315] = u('f'); cdr[2315] = 2314; tag[2315] = atomtag;
-car[2314] = u('('); cdr[2314] = 2313; tag[2314] = atomtag;
-car[2313] = u('e'); cdr[2313] = 2312; tag[2313] = atomtag;
-car[2312] = u('x'); cdr[2312] = 2311; tag[2312] = atomtag;
-car[2311] = u('p'); cdr[2311] = 2310; tag[2311] = atomtag;
-car[2310] = u('r'); cdr[2310] = 2309; tag[2310] = atomtag;
-car[2309] = u('2'); cdr[2309] = 2308; tag[2309] = atomtag;
-car[2308] = u(')'); cdr[2308] = 2307; tag[2308] = atomtag;
-car[2307] = u(';'); cdr[2307] = 0; tag[2307] = atomtag;
-car[2306] = 2305; cdr[2306] = 0; tag[2306] = 0;
-car[2305] = u('*'); cdr[2305] = 2304; tag[2305] = atomtag;
+car[2329] = u(')'); cdr[2329] = 2328; tag[2329] = atomtag;
+car[2328] = u(' '); cdr[2328] = 2327; tag[2328] = atomtag;
+car[2327] = u('='); cdr[2327] = 2326; tag[2327] = atomtag;
+car[2326] = u(' '); cdr[2326] = 2325; tag[2326] = atomtag;
+car[2325] = u('a'); cdr[2325] = 2324; tag[2325] = atomtag;
+car[2324] = u('r'); cdr[2324] = 2323; tag[2324] = atomtag;
+car[2323] = u('i'); cdr[2323] = 2322; tag[2323] = atomtag;
+car[2322] = u('t'); cdr[2322] = 2321; tag[2322] = atomtag;
+car[2321] = u('h'); cdr[2321] = 2320; tag[2321] = atomtag;
+car[2320] = u('('); cdr[2320] = 2319; tag[2320] = atomtag;
+car[2319] = '\''; cdr[2319] = 0; tag[2319] = atomtag;
+car[2318] = 2317; cdr[2318] = 0; tag[2318] = 0;
+car[2317] = '\''; cdr[2317] = 2316; tag[2317] = atomtag;
+car[2316] = u(')'); cdr[2316] = 2315; tag[2316] = atomtag;
+car[2315] = u(';'); cdr[2315] = 0; tag[2315] = atomtag;
+car[2314] = 135; cdr[2314] = 2313; tag[2314] = 0;
+car[2313] = 2312; cdr[2313] = 0; tag[2313] = 0;
+car[2312] = 2311; cdr[2312] = 0; tag[2312] = 0;
+car[2311] = u('o'); cdr[2311] = 2310; tag[2311] = atomtag;
+car[2310] = u('p'); cdr[2310] = 0; tag[2310] = atomtag;
+car[2309] = 2308; cdr[2309] = 0; tag[2309] = 0;
+car[2308] = u('t'); cdr[2308] = 2307; tag[2308] = atomtag;
+car[2307] = u('w'); cdr[2307] = 2306; tag[2307] = atomtag;
+car[2306] = u('o'); cdr[2306] = 2305; tag[2306] = atomtag;
+car[2305] = u('a'); cdr[2305] = 2304; tag[2305] = atomtag;
 car[2304] = u('r'); cdr[2304] = 2303; tag[2304] = atomtag;
-car[2303] = u('p'); cdr[2303] = 2302; tag[2303] = atomtag;
-car[2302] = u('l'); cdr[2302] = 2301; tag[2302] = atomtag;
-car[2301] = u('a'); cdr[2301] = 2300; tag[2301] = atomtag;
-car[2300] = u('c'); cdr[2300] = 2299; tag[2300] = atomtag;
-car[2299] = u('a'); cdr[2299] = 0; tag[2299] = atomtag;
-car[2298] = 2297; cdr[2298] = 0; tag[2298] = 0;
-car[2297] = u('r'); cdr[2297] = 2296; tag[2297] = atomtag;
+car[2303] = u('g'); cdr[2303] = 2302; tag[2303] = atomtag;
+car[2302] = u('s'); cdr[2302] = 0; tag[2302] = atomtag;
+car[2301] = 2300; cdr[2301] = 0; tag[2301] = 0;
+car[2300] = u('r'); cdr[2300] = 2299; tag[2300] = atomtag;
+car[2299] = u('e'); cdr[2299] = 2298; tag[2299] = atomtag;
+car[2298] = u('f'); cdr[2298] = 2297; tag[2298] = atomtag;
+car[2297] = u('('); cdr[2297] = 2296; tag[2297] = atomtag;
 car[2296] = u('e'); cdr[2296] = 2295; tag[2296] = atomtag;
-car[2295] = u('f'); cdr[2295] = 2294; tag[2295] = atomtag;
-car[2294] = u('('); cdr[2294] = 2293; tag[2294] = atomtag;
-car[2293] = u('e'); cdr[2293] = 2292; tag[2293] = atomtag;
-car[2292] = u('x'); cdr[2292] = 2291; tag[2292] = atomtag;
-car[2291] = u('p'); cdr[2291] = 2290; tag[2291] = atomtag;
-car[2290] = u('r'); cdr[2290] = 2289; tag[2290] = atomtag;
-car[2289] = u(')'); cdr[2289] = 2288; tag[2289] = atomtag;
+car[2295] = u('x'); cdr[2295] = 2294; tag[2295] = atomtag;
+car[2294] = u('p'); cdr[2294] = 2293; tag[2294] = atomtag;
+car[2293] = u('r'); cdr[2293] = 2292; tag[2293] = atomtag;
+car[2292] = u('2'); cdr[2292] = 2291; tag[2292] = atomtag;
+car[2291] = u(')'); cdr[2291] = 2290; tag[2291] = atomtag;
+car[2290] = u(' '); cdr[2290] = 2289; tag[2290] = atomtag;
+car[2289] = u('='); cdr[2289] = 2288; tag[2289] = atomtag;
 car[2288] = u(' '); cdr[2288] = 2287; tag[2288] = atomtag;
-car[2287] = u('='); cdr[2287] = 2286; tag[2287] = atomtag;
-car[2286] = u(' '); cdr[2286] = 2285; tag[2286] = atomtag;
-car[2285] = u('r'); cdr[2285] = 2284; tag[2285] = atomtag;
-car[2284] = u('e'); cdr[2284] = 2283; tag[2284] = atomtag;
-car[2283] = u('a'); cdr[2283] = 2282; tag[2283] = atomtag;
-car[2282] = u('d'); cdr[2282] = 2281; tag[2282] = atomtag;
-car[2281] = u('c'); cdr[2281] = 2280; tag[2281] = atomtag;
-car[2280] = u('('); cdr[2280] = 2279; tag[2280] = atomtag;
-car[2279] = u(')'); cdr[2279] = 2278; tag[2279] = atomtag;
-car[2278] = u(';'); cdr[2278] = 0; tag[2278] = atomtag;
-car[2277] = 2276; cdr[2277] = 0; tag[2277] = 0;
-car[2276] = u('*'); cdr[2276] = 2275; tag[2276] = atomtag;
-car[2275] = u('r'); cdr[2275] = 2274; tag[2275] = atomtag;
-car[2274] = u('e'); cdr[2274] = 2273; tag[2274] = atomtag;
-car[2273] = u('a'); cdr[2273] = 2272; tag[2273] = atomtag;
-car[2272] = u('d'); cdr[2272] = 2271; tag[2272] = atomtag;
-car[2271] = u('c'); cdr[2271] = 0; tag[2271] = atomtag;
-car[2270] = 1739; cdr[2270] = 2269; tag[2270] = 0;
-car[2269] = 1727; cdr[2269] = 2268; tag[2269] = 0;
-car[2268] = 1715; cdr[2268] = 0; tag[2268] = 0;
-car[2267] = 2266; cdr[2267] = 0; tag[2267] = 0;
-car[2266] = u('r'); cdr[2266] = 2265; tag[2266] = atomtag;
-car[2265] = u('e'); cdr[2265] = 2264; tag[2265] = atomtag;
-car[2264] = u('f'); cdr[2264] = 2263; tag[2264] = atomtag;
-car[2263] = u('('); cdr[2263] = 2262; tag[2263] = atomtag;
-car[2262] = u('e'); cdr[2262] = 2261; tag[2262] = atomtag;
-car[2261] = u('x'); cdr[2261] = 2260; tag[2261] = atomtag;
-car[2260] = u('p'); cdr[2260] = 2259; tag[2260] = atomtag;
-car[2259] = u('r'); cdr[2259] = 2258; tag[2259] = atomtag;
-car[2258] = u(')'); cdr[2258] = 2257; tag[2258] = atomtag;
-car[2257] = u('+'); cdr[2257] = 2256; tag[2257] = atomtag;
-car[2256] = u('+'); cdr[2256] = 2255; tag[2256] = atomtag;
-car[2255] = u(';'); cdr[2255] = 0; tag[2255] = atomtag;
-car[2254] = 2253; cdr[2254] = 0; tag[2254] = 0;
-car[2253] = u('*'); cdr[2253] = 2252; tag[2253] = atomtag;
-car[2252] = u('n'); cdr[2252] = 2251; tag[2252] = atomtag;
-car[2251] = u('e'); cdr[2251] = 2250; tag[2251] = atomtag;
-car[2250] = u('x'); cdr[2250] = 2249; tag[2250] = atomtag;
-car[2249] = u('t'); cdr[2249] = 0; tag[2249] = atomtag;
-car[2248] = 2247; cdr[2248] = 0; tag[2248] = 0;
-car[2247] = u('l'); cdr[2247] = 2246; tag[2247] = atomtag;
-car[2246] = u('o'); cdr[2246] = 2245; tag[2246] = atomtag;
-car[2245] = u('a'); cdr[2245] = 2244; tag[2245] = atomtag;
-car[2244] = u('d'); cdr[2244] = 2243; tag[2244] = atomtag;
-car[2243] = u('('); cdr[2243] = 2242; tag[2243] = atomtag;
-car[2242] = u('r'); cdr[2242] = 2241; tag[2242] = atomtag;
-car[2241] = u('e'); cdr[2241] = 2240; tag[2241] = atomtag;
-car[2240] = u('f'); cdr[2240] = 2239; tag[2240] = atomtag;
-car[2239] = u('('); cdr[2239] = 2238; tag[2239] = atomtag;
-car[2238] = u('e'); cdr[2238] = 2237; tag[2238] = atomtag;
-car[2237] = u('x'); cdr[2237] = 2236; tag[2237] = atomtag;
-car[2236] = u('p'); cdr[2236] = 2235; tag[2236] = atomtag;
-car[2235] = u('r'); cdr[2235] = 2234; tag[2235] = atomtag;
-car[2234] = u(')'); cdr[2234] = 2233; tag[2234] = atomtag;
-car[2233] = u(')'); cdr[2233] = 2232; tag[2233] = atomtag;
-car[2232] = u(';'); cdr[2232] = 0; tag[2232] = atomtag;
-car[2231] = 2230; cdr[2231] = 0; tag[2231] = 0;
-car[2230] = u('*'); cdr[2230] = 2229; tag[2230] = atomtag;
-car[2229] = u('l'); cdr[2229] = 2228; tag[2229] = atomtag;
-car[2228] = u('o'); cdr[2228] = 2227; tag[2228] = atomtag;
-car[2227] = u('a'); cdr[2227] = 2226; tag[2227] = atomtag;
-car[2226] = u('d'); cdr[2226] = 0; tag[2226] = atomtag;
-car[2225] = 2224; cdr[2225] = 0; tag[2225] = 0;
-car[2224] = u('d'); cdr[2224] = 2223; tag[2224] = atomtag;
-car[2223] = u('u'); cdr[2223] = 2222; tag[2223] = atomtag;
-car[2222] = u('m'); cdr[2222] = 2221; tag[2222] = atomtag;
-car[2221] = u('p'); cdr[2221] = 2220; tag[2221] = atomtag;
-car[2220] = u('('); cdr[2220] = 2219; tag[2220] = atomtag;
-car[2219] = u('r'); cdr[2219] = 2218; tag[2219] = atomtag;
-car[2218] = u('e'); cdr[2218] = 2217; tag[2218] = atomtag;
-car[2217] = u('f'); cdr[2217] = 2216; tag[2217] = atomtag;
-car[2216] = u('('); cdr[2216] = 2215; tag[2216] = atomtag;
-car[2215] = u('e'); cdr[2215] = 2214; tag[2215] = atomtag;
-car[2214] = u('x'); cdr[2214] = 2213; tag[2214] = atomtag;
-car[2213] = u('p'); cdr[2213] = 2212; tag[2213] = atomtag;
-car[2212] = u('r'); cdr[2212] = 2211; tag[2212] = atomtag;
-car[2211] = u(')'); cdr[2211] = 2210; tag[2211] = atomtag;
-car[2210] = u(')'); cdr[2210] = 2209; tag[2210] = atomtag;
-car[2209] = u(';'); cdr[2209] = 0; tag[2209] = atomtag;
-car[2208] = 2207; cdr[2208] = 0; tag[2208] = 0;
-car[2207] = u('*'); cdr[2207] = 2206; tag[2207] = atomtag;
-car[2206] = u('d'); cdr[2206] = 2205; tag[2206] = atomtag;
-car[2205] = u('u'); cdr[2205] = 2204; tag[2205] = atomtag;
-car[2204] = u('m'); cdr[2204] = 2203; tag[2204] = atomtag;
-car[2203] = u('p'); cdr[2203] = 0; tag[2203] = atomtag;
-car[2202] = 2201; cdr[2202] = 0; tag[2202] = 0;
-car[2201] = u('*'); cdr[2201] = 2200; tag[2201] = atomtag;
-car[2200] = u('c'); cdr[2200] = 2199; tag[2200] = atomtag;
-car[2199] = u('d'); cdr[2199] = 2198; tag[2199] = atomtag;
-car[2198] = u('r'); cdr[2198] = 0; tag[2198] = atomtag;
-car[2197] = 2196; cdr[2197] = 0; tag[2197] = 0;
-car[2196] = u('*'); cdr[2196] = 2195; tag[2196] = atomtag;
-car[2195] = u('c'); cdr[2195] = 2194; tag[2195] = atomtag;
+car[2287] = u('p'); cdr[2287] = 2286; tag[2287] = atomtag;
+car[2286] = u('o'); cdr[2286] = 2285; tag[2286] = atomtag;
+car[2285] = u('p'); cdr[2285] = 2284; tag[2285] = atomtag;
+car[2284] = u('('); cdr[2284] = 2283; tag[2284] = atomtag;
+car[2283] = u(')'); cdr[2283] = 2282; tag[2283] = atomtag;
+car[2282] = u(';'); cdr[2282] = 0; tag[2282] = atomtag;
+car[2281] = 2280; cdr[2281] = 0; tag[2281] = 0;
+car[2280] = u('r'); cdr[2280] = 2279; tag[2280] = atomtag;
+car[2279] = u('e'); cdr[2279] = 2278; tag[2279] = atomtag;
+car[2278] = u('f'); cdr[2278] = 2277; tag[2278] = atomtag;
+car[2277] = u('('); cdr[2277] = 2276; tag[2277] = atomtag;
+car[2276] = u('e'); cdr[2276] = 2275; tag[2276] = atomtag;
+car[2275] = u('x'); cdr[2275] = 2274; tag[2275] = atomtag;
+car[2274] = u('p'); cdr[2274] = 2273; tag[2274] = atomtag;
+car[2273] = u('r'); cdr[2273] = 2272; tag[2273] = atomtag;
+car[2272] = u('2'); cdr[2272] = 2271; tag[2272] = atomtag;
+car[2271] = u(')'); cdr[2271] = 2270; tag[2271] = atomtag;
+car[2270] = u(' '); cdr[2270] = 2269; tag[2270] = atomtag;
+car[2269] = u('='); cdr[2269] = 2268; tag[2269] = atomtag;
+car[2268] = u(' '); cdr[2268] = 2267; tag[2268] = atomtag;
+car[2267] = u('p'); cdr[2267] = 2266; tag[2267] = atomtag;
+car[2266] = u('o'); cdr[2266] = 2265; tag[2266] = atomtag;
+car[2265] = u('p'); cdr[2265] = 2264; tag[2265] = atomtag;
+car[2264] = u('a'); cdr[2264] = 2263; tag[2264] = atomtag;
+car[2263] = u('r'); cdr[2263] = 2262; tag[2263] = atomtag;
+car[2262] = u('g'); cdr[2262] = 2261; tag[2262] = atomtag;
+car[2261] = u('('); cdr[2261] = 2260; tag[2261] = atomtag;
+car[2260] = u(')'); cdr[2260] = 2259; tag[2260] = atomtag;
+car[2259] = u(';'); cdr[2259] = 0; tag[2259] = atomtag;
+car[2258] = 2257; cdr[2258] = 0; tag[2258] = 0;
+car[2257] = u('p'); cdr[2257] = 2256; tag[2257] = atomtag;
+car[2256] = u('u'); cdr[2256] = 2255; tag[2256] = atomtag;
+car[2255] = u('s'); cdr[2255] = 2254; tag[2255] = atomtag;
+car[2254] = u('h'); cdr[2254] = 2253; tag[2254] = atomtag;
+car[2253] = u('('); cdr[2253] = 2252; tag[2253] = atomtag;
+car[2252] = u(')'); cdr[2252] = 2251; tag[2252] = atomtag;
+car[2251] = u(';'); cdr[2251] = 0; tag[2251] = atomtag;
+car[2250] = 135; cdr[2250] = 0; tag[2250] = 0;
+car[2249] = 2248; cdr[2249] = 0; tag[2249] = 0;
+car[2248] = u('s'); cdr[2248] = 2247; tag[2248] = atomtag;
+car[2247] = u('e'); cdr[2247] = 2246; tag[2247] = atomtag;
+car[2246] = u('t'); cdr[2246] = 2245; tag[2246] = atomtag;
+car[2245] = u('t'); cdr[2245] = 2244; tag[2245] = atomtag;
+car[2244] = u('a'); cdr[2244] = 2243; tag[2244] = atomtag;
+car[2243] = u('g'); cdr[2243] = 0; tag[2243] = atomtag;
+car[2242] = 2241; cdr[2242] = 0; tag[2242] = 0;
+car[2241] = u('t'); cdr[2241] = 2240; tag[2241] = atomtag;
+car[2240] = u('a'); cdr[2240] = 2239; tag[2240] = atomtag;
+car[2239] = u('g'); cdr[2239] = 2238; tag[2239] = atomtag;
+car[2238] = u('['); cdr[2238] = 2237; tag[2238] = atomtag;
+car[2237] = u('r'); cdr[2237] = 2236; tag[2237] = atomtag;
+car[2236] = u('e'); cdr[2236] = 2235; tag[2236] = atomtag;
+car[2235] = u('f'); cdr[2235] = 2234; tag[2235] = atomtag;
+car[2234] = u('('); cdr[2234] = 2233; tag[2234] = atomtag;
+car[2233] = u('e'); cdr[2233] = 2232; tag[2233] = atomtag;
+car[2232] = u('x'); cdr[2232] = 2231; tag[2232] = atomtag;
+car[2231] = u('p'); cdr[2231] = 2230; tag[2231] = atomtag;
+car[2230] = u('r'); cdr[2230] = 2229; tag[2230] = atomtag;
+car[2229] = u(')'); cdr[2229] = 2228; tag[2229] = atomtag;
+car[2228] = u(']'); cdr[2228] = 0; tag[2228] = atomtag;
+car[2227] = 2226; cdr[2227] = 0; tag[2227] = 0;
+car[2226] = u(' '); cdr[2226] = 2225; tag[2226] = atomtag;
+car[2225] = u('&'); cdr[2225] = 2224; tag[2225] = atomtag;
+car[2224] = u('='); cdr[2224] = 2223; tag[2224] = atomtag;
+car[2223] = u(' '); cdr[2223] = 2222; tag[2223] = atomtag;
+car[2222] = u('~'); cdr[2222] = 0; tag[2222] = atomtag;
+car[2221] = 2220; cdr[2221] = 0; tag[2221] = 0;
+car[2220] = u(' '); cdr[2220] = 2219; tag[2220] = atomtag;
+car[2219] = u('|'); cdr[2219] = 2218; tag[2219] = atomtag;
+car[2218] = u('='); cdr[2218] = 2217; tag[2218] = atomtag;
+car[2217] = u(' '); cdr[2217] = 0; tag[2217] = atomtag;
+car[2216] = 2215; cdr[2216] = 0; tag[2216] = 0;
+car[2215] = u(';'); cdr[2215] = 0; tag[2215] = atomtag;
+car[2214] = 2213; cdr[2214] = 2202; tag[2214] = 0;
+car[2213] = 2212; cdr[2213] = 2203; tag[2213] = 0;
+car[2212] = 2211; cdr[2212] = 0; tag[2212] = 0;
+car[2211] = u('*'); cdr[2211] = 2210; tag[2211] = atomtag;
+car[2210] = u('s'); cdr[2210] = 2209; tag[2210] = atomtag;
+car[2209] = u('e'); cdr[2209] = 2208; tag[2209] = atomtag;
+car[2208] = u('t'); cdr[2208] = 2207; tag[2208] = atomtag;
+car[2207] = u('a'); cdr[2207] = 2206; tag[2207] = atomtag;
+car[2206] = u('t'); cdr[2206] = 2205; tag[2206] = atomtag;
+car[2205] = u('o'); cdr[2205] = 2204; tag[2205] = atomtag;
+car[2204] = u('m'); cdr[2204] = 0; tag[2204] = atomtag;
+car[2203] = 2113; cdr[2203] = 0; tag[2203] = 0;
+car[2202] = 2201; cdr[2202] = 2190; tag[2202] = 0;
+car[2201] = 2200; cdr[2201] = 2191; tag[2201] = 0;
+car[2200] = 2199; cdr[2200] = 0; tag[2200] = 0;
+car[2199] = u('*'); cdr[2199] = 2198; tag[2199] = atomtag;
+car[2198] = u('s'); cdr[2198] = 2197; tag[2198] = atomtag;
+car[2197] = u('e'); cdr[2197] = 2196; tag[2197] = atomtag;
+car[2196] = u('t'); cdr[2196] = 2195; tag[2196] = atomtag;
+car[2195] = u('m'); cdr[2195] = 2194; tag[2195] = atomtag;
 car[2194] = u('a'); cdr[2194] = 2193; tag[2194] = atomtag;
-car[2193] = u('r'); cdr[2193] = 0; tag[2193] = atomtag;
-car[2192] = 1648; cdr[2192] = 2191; tag[2192] = 0;
-car[2191] = 1630; cdr[2191] = 2190; tag[2191] = 0;
-car[2190] = 1612; cdr[2190] = 0; tag[2190] = 0;
-car[2189] = 2188; cdr[2189] = 0; tag[2189] = 0;
-car[2188] = u('h'); cdr[2188] = 2187; tag[2188] = atomtag;
-car[2187] = u('a'); cdr[2187] = 2186; tag[2187] = atomtag;
-car[2186] = u('l'); cdr[2186] = 2185; tag[2186] = atomtag;
-car[2185] = u('t'); cdr[2185] = 2184; tag[2185] = atomtag;
-car[2184] = u('('); cdr[2184] = 2183; tag[2184] = atomtag;
-car[2183] = u('a'); cdr[2183] = 2182; tag[2183] = atomtag;
-car[2182] = u('t'); cdr[2182] = 2181; tag[2182] = atomtag;
-car[2181] = u('o'); cdr[2181] = 2180; tag[2181] = atomtag;
-car[2180] = u('m'); cdr[2180] = 2179; tag[2180] = atomtag;
-car[2179] = u('n'); cdr[2179] = 2178; tag[2179] = atomtag;
-car[2178] = u('a'); cdr[2178] = 2177; tag[2178] = atomtag;
-car[2177] = u('m'); cdr[2177] = 2176; tag[2177] = atomtag;
-car[2176] = u('e'); cdr[2176] = 2175; tag[2176] = atomtag;
-car[2175] = u('('); cdr[2175] = 2174; tag[2175] = atomtag;
-car[2174] = u('r'); cdr[2174] = 2173; tag[2174] = atomtag;
-car[2173] = u('e'); cdr[2173] = 2172; tag[2173] = atomtag;
-car[2172] = u('f'); cdr[2172] = 2171; tag[2172] = atomtag;
-car[2171] = u('('); cdr[2171] = 2170; tag[2171] = atomtag;
-car[2170] = u('e'); cdr[2170] = 2169; tag[2170] = atomtag;
-car[2169] = u('x'); cdr[2169] = 2168; tag[2169] = atomtag;
-car[2168] = u('p'); cdr[2168] = 2167; tag[2168] = atomtag;
+car[2193] = u('r'); cdr[2193] = 2192; tag[2193] = atomtag;
+car[2192] = u('k'); cdr[2192] = 0; tag[2192] = atomtag;
+car[2191] = 2095; cdr[2191] = 0; tag[2191] = 0;
+car[2190] = 2189; cdr[2190] = 0; tag[2190] = 0;
+car[2189] = 2188; cdr[2189] = 2179; tag[2189] = 0;
+car[2188] = 2187; cdr[2188] = 0; tag[2188] = 0;
+car[2187] = u('*'); cdr[2187] = 2186; tag[2187] = atomtag;
+car[2186] = u('s'); cdr[2186] = 2185; tag[2186] = atomtag;
+car[2185] = u('e'); cdr[2185] = 2184; tag[2185] = atomtag;
+car[2184] = u('t'); cdr[2184] = 2183; tag[2184] = atomtag;
+car[2183] = u('t'); cdr[2183] = 2182; tag[2183] = atomtag;
+car[2182] = u('r'); cdr[2182] = 2181; tag[2182] = atomtag;
+car[2181] = u('a'); cdr[2181] = 2180; tag[2181] = atomtag;
+car[2180] = u('v'); cdr[2180] = 0; tag[2180] = atomtag;
+car[2179] = 2077; cdr[2179] = 0; tag[2179] = 0;
+car[2178] = 135; cdr[2178] = 0; tag[2178] = 0;
+car[2177] = 2176; cdr[2177] = 0; tag[2177] = 0;
+car[2176] = u('c'); cdr[2176] = 2175; tag[2176] = atomtag;
+car[2175] = u('h'); cdr[2175] = 2174; tag[2175] = atomtag;
+car[2174] = u('e'); cdr[2174] = 2173; tag[2174] = atomtag;
+car[2173] = u('c'); cdr[2173] = 2172; tag[2173] = atomtag;
+car[2172] = u('k'); cdr[2172] = 2171; tag[2172] = atomtag;
+car[2171] = u('t'); cdr[2171] = 2170; tag[2171] = atomtag;
+car[2170] = u('a'); cdr[2170] = 2169; tag[2170] = atomtag;
+car[2169] = u('g'); cdr[2169] = 0; tag[2169] = atomtag;
+car[2168] = 2167; cdr[2168] = 0; tag[2168] = 0;
 car[2167] = u('r'); cdr[2167] = 2166; tag[2167] = atomtag;
-car[2166] = u(')'); cdr[2166] = 2165; tag[2166] = atomtag;
-car[2165] = u(')'); cdr[2165] = 2164; tag[2165] = atomtag;
-car[2164] = u(','); cdr[2164] = 2163; tag[2164] = atomtag;
-car[2163] = u(' '); cdr[2163] = 0; tag[2163] = atomtag;
-car[2162] = 2161; cdr[2162] = 0; tag[2162] = 0;
-car[2161] = u('*'); cdr[2161] = 2160; tag[2161] = atomtag;
-car[2160] = u('h'); cdr[2160] = 2159; tag[2160] = atomtag;
-car[2159] = u('a'); cdr[2159] = 2158; tag[2159] = atomtag;
-car[2158] = u('l'); cdr[2158] = 2157; tag[2158] = atomtag;
-car[2157] = u('t'); cdr[2157] = 0; tag[2157] = atomtag;
-car[2156] = 2155; cdr[2156] = 0; tag[2156] = 0;
-car[2155] = u('r'); cdr[2155] = 2154; tag[2155] = atomtag;
-car[2154] = u('e'); cdr[2154] = 2153; tag[2154] = atomtag;
-car[2153] = u('f'); cdr[2153] = 2152; tag[2153] = atomtag;
-car[2152] = u('('); cdr[2152] = 2151; tag[2152] = atomtag;
-car[2151] = u('e'); cdr[2151] = 2150; tag[2151] = atomtag;
-car[2150] = u('x'); cdr[2150] = 2149; tag[2150] = atomtag;
-car[2149] = u('p'); cdr[2149] = 2148; tag[2149] = atomtag;
-car[2148] = u('r'); cdr[2148] = 2147; tag[2148] = atomtag;
-car[2147] = u(')'); cdr[2147] = 2146; tag[2147] = atomtag;
-car[2146] = u(' '); cdr[2146] = 2145; tag[2146] = atomtag;
-car[2145] = u('='); cdr[2145] = 2144; tag[2145] = atomtag;
-car[2144] = u(' '); cdr[2144] = 2143; tag[2144] = atomtag;
+car[2166] = u('e'); cdr[2166] = 2165; tag[2166] = atomtag;
+car[2165] = u('f'); cdr[2165] = 2164; tag[2165] = atomtag;
+car[2164] = u('('); cdr[2164] = 2163; tag[2164] = atomtag;
+car[2163] = u('e'); cdr[2163] = 2162; tag[2163] = atomtag;
+car[2162] = u('x'); cdr[2162] = 2161; tag[2162] = atomtag;
+car[2161] = u('p'); cdr[2161] = 2160; tag[2161] = atomtag;
+car[2160] = u('r'); cdr[2160] = 2159; tag[2160] = atomtag;
+car[2159] = u(')'); cdr[2159] = 2158; tag[2159] = atomtag;
+car[2158] = u(' '); cdr[2158] = 2157; tag[2158] = atomtag;
+car[2157] = u('='); cdr[2157] = 2156; tag[2157] = atomtag;
+car[2156] = u(' '); cdr[2156] = 2155; tag[2156] = atomtag;
+car[2155] = u('('); cdr[2155] = 2154; tag[2155] = atomtag;
+car[2154] = u('t'); cdr[2154] = 2153; tag[2154] = atomtag;
+car[2153] = u('a'); cdr[2153] = 2152; tag[2153] = atomtag;
+car[2152] = u('g'); cdr[2152] = 2151; tag[2152] = atomtag;
+car[2151] = u('['); cdr[2151] = 2150; tag[2151] = atomtag;
+car[2150] = u('r'); cdr[2150] = 2149; tag[2150] = atomtag;
+car[2149] = u('e'); cdr[2149] = 2148; tag[2149] = atomtag;
+car[2148] = u('f'); cdr[2148] = 2147; tag[2148] = atomtag;
+car[2147] = u('('); cdr[2147] = 2146; tag[2147] = atomtag;
+car[2146] = u('e'); cdr[2146] = 2145; tag[2146] = atomtag;
+car[2145] = u('x'); cdr[2145] = 2144; tag[2145] = atomtag;
+car[2144] = u('p'); cdr[2144] = 2143; tag[2144] = atomtag;
 car[2143] = u('r'); cdr[2143] = 2142; tag[2143] = atomtag;
-car[2142] = u('e'); cdr[2142] = 2141; tag[2142] = atomtag;
-car[2141] = u('f'); cdr[2141] = 2140; tag[2141] = atomtag;
-car[2140] = u('('); cdr[2140] = 2139; tag[2140] = atomtag;
-car[2139] = u('e'); cdr[2139] = 2138; tag[2139] = atomtag;
-car[2138] = u('x'); cdr[2138] = 2137; tag[2138] = atomtag;
-car[2137] = u('p'); cdr[2137] = 2136; tag[2137] = atomtag;
-car[2136] = u('r'); cdr[2136] = 2135; tag[2136] = atomtag;
-car[2135] = u(')'); cdr[2135] = 2134; tag[2135] = atomtag;
+car[2142] = u(')'); cdr[2142] = 2141; tag[2142] = atomtag;
+car[2141] = u(']'); cdr[2141] = 2140; tag[2141] = atomtag;
+car[2140] = u(' '); cdr[2140] = 2139; tag[2140] = atomtag;
+car[2139] = u('&'); cdr[2139] = 2138; tag[2139] = atomtag;
+car[2138] = u(' '); cdr[2138] = 0; tag[2138] = atomtag;
+car[2137] = 2136; cdr[2137] = 0; tag[2137] = 0;
+car[2136] = u(')'); cdr[2136] = 2135; tag[2136] = atomtag;
+car[2135] = u('?'); cdr[2135] = 2134; tag[2135] = atomtag;
 car[2134] = u(' '); cdr[2134] = 2133; tag[2134] = atomtag;
-car[2133] = u('='); cdr[2133] = 2132; tag[2133] = atomtag;
-car[2132] = u('='); cdr[2132] = 2131; tag[2132] = atomtag;
-car[2131] = u(' '); cdr[2131] = 2130; tag[2131] = atomtag;
-car[2130] = u('r'); cdr[2130] = 2129; tag[2130] = atomtag;
-car[2129] = u('e'); cdr[2129] = 2128; tag[2129] = atomtag;
-car[2128] = u('f'); cdr[2128] = 2127; tag[2128] = atomtag;
-car[2127] = u('('); cdr[2127] = 2126; tag[2127] = atomtag;
-car[2126] = u('e'); cdr[2126] = 2125; tag[2126] = atomtag;
-car[2125] = u('x'); cdr[2125] = 2124; tag[2125] = atomtag;
-car[2124] = u('p'); cdr[2124] = 2123; tag[2124] = atomtag;
-car[2123] = u('r'); cdr[2123] = 2122; tag[2123] = atomtag;
-car[2122] = u('2'); cdr[2122] = 2121; tag[2122] = atomtag;
-car[2121] = u(')'); cdr[2121] = 2120; tag[2121] = atomtag;
-car[2120] = u('?'); cdr[2120] = 2119; tag[2120] = atomtag;
-car[2119] = u(' '); cdr[2119] = 0; tag[2119] = atomtag;
-car[2118] = 2117; cdr[2118] = 0; tag[2118] = 0;
-car[2117] = u('t'); cdr[2117] = 2116; tag[2117] = atomtag;
-car[2116] = u('r'); cdr[2116] = 2115; tag[2116] = atomtag;
-car[2115] = u('u'); cdr[2115] = 2114; tag[2115] = atomtag;
-car[2114] = u('e'); cdr[2114] = 2113; tag[2114] = atomtag;
-car[2113] = u(':'); cdr[2113] = 2112; tag[2113] = atomtag;
-car[2112] = u(' '); cdr[2112] = 2111; tag[2112] = atomtag;
-car[2111] = u('n'); cdr[2111] = 2110; tag[2111] = atomtag;
-car[2110] = u('i'); cdr[2110] = 2109; tag[2110] = atomtag;
-car[2109] = u('l'); cdr[2109] = 2108; tag[2109] = atomtag;
-car[2108] = u(';'); cdr[2108] = 0; tag[2108] = atomtag;
-car[2107] = 2106; cdr[2107] = 0; tag[2107] = 0;
-car[2106] = u('r'); cdr[2106] = 2105; tag[2106] = atomtag;
-car[2105] = u('e'); cdr[2105] = 2104; tag[2105] = atomtag;
-car[2104] = u('f'); cdr[2104] = 2103; tag[2104] = atomtag;
-car[2103] = u('('); cdr[2103] = 2102; tag[2103] = atomtag;
-car[2102] = u('e'); cdr[2102] = 2101; tag[2102] = atomtag;
-car[2101] = u('x'); cdr[2101] = 2100; tag[2101] = atomtag;
-car[2100] = u('p'); cdr[2100] = 2099; tag[2100] = atomtag;
+car[2133] = u('t'); cdr[2133] = 2132; tag[2133] = atomtag;
+car[2132] = u('r'); cdr[2132] = 2131; tag[2132] = atomtag;
+car[2131] = u('u'); cdr[2131] = 2130; tag[2131] = atomtag;
+car[2130] = u('e'); cdr[2130] = 2129; tag[2130] = atomtag;
+car[2129] = u(':'); cdr[2129] = 2128; tag[2129] = atomtag;
+car[2128] = u(' '); cdr[2128] = 2127; tag[2128] = atomtag;
+car[2127] = u('n'); cdr[2127] = 2126; tag[2127] = atomtag;
+car[2126] = u('i'); cdr[2126] = 2125; tag[2126] = atomtag;
+car[2125] = u('l'); cdr[2125] = 2124; tag[2125] = atomtag;
+car[2124] = u(';'); cdr[2124] = 0; tag[2124] = atomtag;
+car[2123] = 2122; cdr[2123] = 2105; tag[2123] = 0;
+car[2122] = 2121; cdr[2122] = 2114; tag[2122] = 0;
+car[2121] = 2120; cdr[2121] = 0; tag[2121] = 0;
+car[2120] = u('*'); cdr[2120] = 2119; tag[2120] = atomtag;
+car[2119] = u('a'); cdr[2119] = 2118; tag[2119] = atomtag;
+car[2118] = u('t'); cdr[2118] = 2117; tag[2118] = atomtag;
+car[2117] = u('o'); cdr[2117] = 2116; tag[2117] = atomtag;
+car[2116] = u('m'); cdr[2116] = 2115; tag[2116] = atomtag;
+car[2115] = u('p'); cdr[2115] = 0; tag[2115] = atomtag;
+car[2114] = 2113; cdr[2114] = 0; tag[2114] = 0;
+car[2113] = 2112; cdr[2113] = 0; tag[2113] = 0;
+car[2112] = u('a'); cdr[2112] = 2111; tag[2112] = atomtag;
+car[2111] = u('t'); cdr[2111] = 2110; tag[2111] = atomtag;
+car[2110] = u('o'); cdr[2110] = 2109; tag[2110] = atomtag;
+car[2109] = u('m'); cdr[2109] = 2108; tag[2109] = atomtag;
+car[2108] = u('t'); cdr[2108] = 2107; tag[2108] = atomtag;
+car[2107] = u('a'); cdr[2107] = 2106; tag[2107] = atomtag;
+car[2106] = u('g'); cdr[2106] = 0; tag[2106] = atomtag;
+car[2105] = 2104; cdr[2105] = 2087; tag[2105] = 0;
+car[2104] = 2103; cdr[2104] = 2096; tag[2104] = 0;
+car[2103] = 2102; cdr[2103] = 0; tag[2103] = 0;
+car[2102] = u('*'); cdr[2102] = 2101; tag[2102] = atomtag;
+car[2101] = u('m'); cdr[2101] = 2100; tag[2101] = atomtag;
+car[2100] = u('a'); cdr[2100] = 2099; tag[2100] = atomtag;
 car[2099] = u('r'); cdr[2099] = 2098; tag[2099] = atomtag;
-car[2098] = u(')'); cdr[2098] = 2097; tag[2098] = atomtag;
-car[2097] = u(' '); cdr[2097] = 2096; tag[2097] = atomtag;
-car[2096] = u('='); cdr[2096] = 2095; tag[2096] = atomtag;
-car[2095] = u(' '); cdr[2095] = 2094; tag[2095] = atomtag;
-car[2094] = u('c'); cdr[2094] = 2093; tag[2094] = atomtag;
-car[2093] = u('o'); cdr[2093] = 2092; tag[2093] = atomtag;
-car[2092] = u('n'); cdr[2092] = 2091; tag[2092] = atomtag;
-car[2091] = u('s'); cdr[2091] = 2090; tag[2091] = atomtag;
-car[2090] = u('3'); cdr[2090] = 2089; tag[2090] = atomtag;
-car[2089] = u('('); cdr[2089] = 2088; tag[2089] = atomtag;
-car[2088] = u('r'); cdr[2088] = 2087; tag[2088] = atomtag;
-car[2087] = u('e'); cdr[2087] = 2086; tag[2087] = atomtag;
-car[2086] = u('f'); cdr[2086] = 2085; tag[2086] = atomtag;
-car[2085] = u('('); cdr[2085] = 2084; tag[2085] = atomtag;
-car[2084] = u('e'); cdr[2084] = 2083; tag[2084] = atomtag;
-car[2083] = u('x'); cdr[2083] = 2082; tag[2083] = atomtag;
-car[2082] = u('p'); cdr[2082] = 2081; tag[2082] = atomtag;
-car[2081] = u('r'); cdr[2081] = 2080; tag[2081] = atomtag;
-car[2080] = u(')'); cdr[2080] = 2079; tag[2080] = atomtag;
-car[2079] = u(','); cdr[2079] = 2078; tag[2079] = atomtag;
-car[2078] = u(' '); cdr[2078] = 0; tag[2078] = atomtag;
+car[2098] = u('k'); cdr[2098] = 2097; tag[2098] = atomtag;
+car[2097] = u('p'); cdr[2097] = 0; tag[2097] = atomtag;
+car[2096] = 2095; cdr[2096] = 0; tag[2096] = 0;
+car[2095] = 2094; cdr[2095] = 0; tag[2095] = 0;
+car[2094] = u('m'); cdr[2094] = 2093; tag[2094] = atomtag;
+car[2093] = u('a'); cdr[2093] = 2092; tag[2093] = atomtag;
+car[2092] = u('r'); cdr[2092] = 2091; tag[2092] = atomtag;
+car[2091] = u('k'); cdr[2091] = 2090; tag[2091] = atomtag;
+car[2090] = u('t'); cdr[2090] = 2089; tag[2090] = atomtag;
+car[2089] = u('a'); cdr[2089] = 2088; tag[2089] = atomtag;
+car[2088] = u('g'); cdr[2088] = 0; tag[2088] = atomtag;
+car[2087] = 2086; cdr[2087] = 0; tag[2087] = 0;
+car[2086] = 2085; cdr[2086] = 2078; tag[2086] = 0;
+car[2085] = 2084; cdr[2085] = 0; tag[2085] = 0;
+car[2084] = u('*'); cdr[2084] = 2083; tag[2084] = atomtag;
+car[2083] = u('t'); cdr[2083] = 2082; tag[2083] = atomtag;
+car[2082] = u('r'); cdr[2082] = 2081; tag[2082] = atomtag;
+car[2081] = u('a'); cdr[2081] = 2080; tag[2081] = atomtag;
+car[2080] = u('v'); cdr[2080] = 2079; tag[2080] = atomtag;
+car[2079] = u('p'); cdr[2079] = 0; tag[2079] = atomtag;
+car[2078] = 2077; cdr[2078] = 0; tag[2078] = 0;
 car[2077] = 2076; cdr[2077] = 0; tag[2077] = 0;
-car[2076] = u('r'); cdr[2076] = 2075; tag[2076] = atomtag;
-car[2075] = u('e'); cdr[2075] = 2074; tag[2075] = atomtag;
-car[2074] = u('f'); cdr[2074] = 2073; tag[2074] = atomtag;
-car[2073] = u('('); cdr[2073] = 2072; tag[2073] = atomtag;
-car[2072] = u('e'); cdr[2072] = 2071; tag[2072] = atomtag;
-car[2071] = u('x'); cdr[2071] = 2070; tag[2071] = atomtag;
-car[2070] = u('p'); cdr[2070] = 2069; tag[2070] = atomtag;
-car[2069] = u('r'); cdr[2069] = 2068; tag[2069] = atomtag;
-car[2068] = u('2'); cdr[2068] = 2067; tag[2068] = atomtag;
-car[2067] = u(')'); cdr[2067] = 2066; tag[2067] = atomtag;
-car[2066] = u(','); cdr[2066] = 2065; tag[2066] = atomtag;
-car[2065] = u(' '); cdr[2065] = 2064; tag[2065] = atomtag;
-car[2064] = u('0'); cdr[2064] = 2063; tag[2064] = atomtag;
-car[2063] = u(')'); cdr[2063] = 2062; tag[2063] = atomtag;
-car[2062] = u(';'); cdr[2062] = 0; tag[2062] = atomtag;
+car[2076] = u('t'); cdr[2076] = 2075; tag[2076] = atomtag;
+car[2075] = u('r'); cdr[2075] = 2074; tag[2075] = atomtag;
+car[2074] = u('a'); cdr[2074] = 2073; tag[2074] = atomtag;
+car[2073] = u('v'); cdr[2073] = 2072; tag[2073] = atomtag;
+car[2072] = u('t'); cdr[2072] = 2071; tag[2072] = atomtag;
+car[2071] = u('a'); cdr[2071] = 2070; tag[2071] = atomtag;
+car[2070] = u('g'); cdr[2070] = 0; tag[2070] = atomtag;
+car[2069] = 135; cdr[2069] = 0; tag[2069] = 0;
+car[2068] = 2067; cdr[2068] = 0; tag[2068] = 0;
+car[2067] = u('l'); cdr[2067] = 2066; tag[2067] = atomtag;
+car[2066] = u('a'); cdr[2066] = 2065; tag[2066] = atomtag;
+car[2065] = u('b'); cdr[2065] = 2064; tag[2065] = atomtag;
+car[2064] = u('c'); cdr[2064] = 2063; tag[2064] = atomtag;
+car[2063] = u('o'); cdr[2063] = 2062; tag[2063] = atomtag;
+car[2062] = u('m'); cdr[2062] = 0; tag[2062] = atomtag;
 car[2061] = 2060; cdr[2061] = 0; tag[2061] = 0;
-car[2060] = u('r'); cdr[2060] = 2059; tag[2060] = atomtag;
-car[2059] = u('e'); cdr[2059] = 2058; tag[2059] = atomtag;
-car[2058] = u('f'); cdr[2058] = 2057; tag[2058] = atomtag;
-car[2057] = u('('); cdr[2057] = 2056; tag[2057] = atomtag;
-car[2056] = u('e'); cdr[2056] = 2055; tag[2056] = atomtag;
-car[2055] = u('x'); cdr[2055] = 2054; tag[2055] = atomtag;
-car[2054] = u('p'); cdr[2054] = 2053; tag[2054] = atomtag;
-car[2053] = u('r'); cdr[2053] = 2052; tag[2053] = atomtag;
-car[2052] = u(')'); cdr[2052] = 2051; tag[2052] = atomtag;
-car[2051] = u(' '); cdr[2051] = 2050; tag[2051] = atomtag;
-car[2050] = u('='); cdr[2050] = 2049; tag[2050] = atomtag;
-car[2049] = u(' '); cdr[2049] = 2048; tag[2049] = atomtag;
-car[2048] = u('c'); cdr[2048] = 2047; tag[2048] = atomtag;
-car[2047] = u('d'); cdr[2047] = 2046; tag[2047] = atomtag;
-car[2046] = u('r'); cdr[2046] = 2045; tag[2046] = atomtag;
-car[2045] = u('['); cdr[2045] = 2044; tag[2045] = atomtag;
-car[2044] = u('r'); cdr[2044] = 2043; tag[2044] = atomtag;
-car[2043] = u('e'); cdr[2043] = 2042; tag[2043] = atomtag;
-car[2042] = u('f'); cdr[2042] = 2041; tag[2042] = atomtag;
-car[2041] = u('('); cdr[2041] = 2040; tag[2041] = atomtag;
-car[2040] = u('e'); cdr[2040] = 2039; tag[2040] = atomtag;
-car[2039] = u('x'); cdr[2039] = 2038; tag[2039] = atomtag;
-car[2038] = u('p'); cdr[2038] = 2037; tag[2038] = atomtag;
-car[2037] = u('r'); cdr[2037] = 2036; tag[2037] = atomtag;
-car[2036] = u(')'); cdr[2036] = 2035; tag[2036] = atomtag;
-car[2035] = u(']'); cdr[2035] = 2034; tag[2035] = atomtag;
-car[2034] = u(';'); cdr[2034] = 0; tag[2034] = atomtag;
-car[2033] = 2032; cdr[2033] = 0; tag[2033] = 0;
-car[2032] = u('i'); cdr[2032] = 2031; tag[2032] = atomtag;
-car[2031] = u('f'); cdr[2031] = 2030; tag[2031] = atomtag;
-car[2030] = u(' '); cdr[2030] = 2029; tag[2030] = atomtag;
-car[2029] = u('('); cdr[2029] = 2028; tag[2029] = atomtag;
-car[2028] = u('s'); cdr[2028] = 2027; tag[2028] = atomtag;
-car[2027] = u('y'); cdr[2027] = 2026; tag[2027] = atomtag;
-car[2026] = u('m'); cdr[2026] = 2025; tag[2026] = atomtag;
-car[2025] = u('b'); cdr[2025] = 2024; tag[2025] = atomtag;
-car[2024] = u('o'); cdr[2024] = 2023; tag[2024] = atomtag;
-car[2023] = u('l'); cdr[2023] = 2022; tag[2023] = atomtag;
-car[2022] = u('i'); cdr[2022] = 2021; tag[2022] = atomtag;
-car[2021] = u('c'); cdr[2021] = 2020; tag[2021] = atomtag;
-car[2020] = u('('); cdr[2020] = 2019; tag[2020] = atomtag;
-car[2019] = u(')'); cdr[2019] = 2018; tag[2019] = atomtag;
-car[2018] = u(')'); cdr[2018] = 2017; tag[2018] = atomtag;
-car[2017] = u(' '); cdr[2017] = 2016; tag[2017] = atomtag;
-car[2016] = u('c'); cdr[2016] = 2015; tag[2016] = atomtag;
-car[2015] = u('d'); cdr[2015] = 2014; tag[2015] = atomtag;
-car[2014] = u('r'); cdr[2014] = 2013; tag[2014] = atomtag;
-car[2013] = u('_'); cdr[2013] = 2012; tag[2013] = atomtag;
-car[2012] = u('e'); cdr[2012] = 2011; tag[2012] = atomtag;
-car[2011] = u('r'); cdr[2011] = 2010; tag[2011] = atomtag;
-car[2010] = u('r'); cdr[2010] = 2009; tag[2010] = atomtag;
-car[2009] = u('('); cdr[2009] = 2008; tag[2009] = atomtag;
-car[2008] = u(')'); cdr[2008] = 2007; tag[2008] = atomtag;
-car[2007] = u(';'); cdr[2007] = 0; tag[2007] = atomtag;
-car[2006] = 2005; cdr[2006] = 0; tag[2006] = 0;
-car[2005] = u('r'); cdr[2005] = 2004; tag[2005] = atomtag;
-car[2004] = u('e'); cdr[2004] = 2003; tag[2004] = atomtag;
-car[2003] = u('f'); cdr[2003] = 2002; tag[2003] = atomtag;
-car[2002] = u('('); cdr[2002] = 2001; tag[2002] = atomtag;
-car[2001] = u('e'); cdr[2001] = 2000; tag[2001] = atomtag;
-car[2000] = u('x'); cdr[2000] = 1999; tag[2000] = atomtag;
-car[1999] = u('p'); cdr[1999] = 1998; tag[1999] = atomtag;
-car[1998] = u('r'); cdr[1998] = 1997; tag[1998] = atomtag;
-car[1997] = u(')'); cdr[1997] = 1996; tag[1997] = atomtag;
-car[1996] = u(' '); cdr[1996] = 1995; tag[1996] = atomtag;
-car[1995] = u('='); cdr[1995] = 1994; tag[1995] = atomtag;
-car[1994] = u(' '); cdr[1994] = 1993; tag[1994] = atomtag;
-car[1993] = u('c'); cdr[1993] = 1992; tag[1993] = atomtag;
-car[1992] = u('a'); cdr[1992] = 1991; tag[1992] = atomtag;
-car[1991] = u('r'); cdr[1991] = 1990; tag[1991] = atomtag;
-car[1990] = u('['); cdr[1990] = 1989; tag[1990] = atomtag;
+car[2060] = u('p'); cdr[2060] = 2059; tag[2060] = atomtag;
+car[2059] = u('o'); cdr[2059] = 2058; tag[2059] = atomtag;
+car[2058] = u('p'); cdr[2058] = 2057; tag[2058] = atomtag;
+car[2057] = u('v'); cdr[2057] = 2056; tag[2057] = atomtag;
+car[2056] = u('a'); cdr[2056] = 2055; tag[2056] = atomtag;
+car[2055] = u('l'); cdr[2055] = 2054; tag[2055] = atomtag;
+car[2054] = u('('); cdr[2054] = 0; tag[2054] = atomtag;
+car[2053] = 135; cdr[2053] = 0; tag[2053] = 0;
+car[2052] = 2051; cdr[2052] = 0; tag[2052] = 0;
+car[2051] = u('u'); cdr[2051] = 2050; tag[2051] = atomtag;
+car[2050] = u('n'); cdr[2050] = 2049; tag[2050] = atomtag;
+car[2049] = u('d'); cdr[2049] = 2048; tag[2049] = atomtag;
+car[2048] = u('o'); cdr[2048] = 0; tag[2048] = atomtag;
+car[2047] = 2046; cdr[2047] = 0; tag[2047] = 0;
+car[2046] = u('p'); cdr[2046] = 2045; tag[2046] = atomtag;
+car[2045] = u('u'); cdr[2045] = 2044; tag[2045] = atomtag;
+car[2044] = u('s'); cdr[2044] = 2043; tag[2044] = atomtag;
+car[2043] = u('h'); cdr[2043] = 2042; tag[2043] = atomtag;
+car[2042] = u('v'); cdr[2042] = 2041; tag[2042] = atomtag;
+car[2041] = u('a'); cdr[2041] = 2040; tag[2041] = atomtag;
+car[2040] = u('l'); cdr[2040] = 2039; tag[2040] = atomtag;
+car[2039] = u('('); cdr[2039] = 0; tag[2039] = atomtag;
+car[2038] = 2037; cdr[2038] = 0; tag[2038] = 0;
+car[2037] = u('l'); cdr[2037] = 2036; tag[2037] = atomtag;
+car[2036] = u('a'); cdr[2036] = 2035; tag[2036] = atomtag;
+car[2035] = u('b'); cdr[2035] = 2034; tag[2035] = atomtag;
+car[2034] = u('e'); cdr[2034] = 2033; tag[2034] = atomtag;
+car[2033] = u('l'); cdr[2033] = 2032; tag[2033] = atomtag;
+car[2032] = u(':'); cdr[2032] = 2031; tag[2032] = atomtag;
+car[2031] = u(' '); cdr[2031] = 2030; tag[2031] = atomtag;
+car[2030] = u('e'); cdr[2030] = 2029; tag[2030] = atomtag;
+car[2029] = u('x'); cdr[2029] = 2028; tag[2029] = atomtag;
+car[2028] = u('p'); cdr[2028] = 2027; tag[2028] = atomtag;
+car[2027] = u('e'); cdr[2027] = 2026; tag[2027] = atomtag;
+car[2026] = u('c'); cdr[2026] = 2025; tag[2026] = atomtag;
+car[2025] = u('t'); cdr[2025] = 2024; tag[2025] = atomtag;
+car[2024] = u('e'); cdr[2024] = 2023; tag[2024] = atomtag;
+car[2023] = u('d'); cdr[2023] = 2022; tag[2023] = atomtag;
+car[2022] = u(' '); cdr[2022] = 2021; tag[2022] = atomtag;
+car[2021] = u('v'); cdr[2021] = 2020; tag[2021] = atomtag;
+car[2020] = u('a'); cdr[2020] = 2019; tag[2020] = atomtag;
+car[2019] = u('r'); cdr[2019] = 2018; tag[2019] = atomtag;
+car[2018] = u('i'); cdr[2018] = 2017; tag[2018] = atomtag;
+car[2017] = u('a'); cdr[2017] = 2016; tag[2017] = atomtag;
+car[2016] = u('b'); cdr[2016] = 2015; tag[2016] = atomtag;
+car[2015] = u('l'); cdr[2015] = 2014; tag[2015] = atomtag;
+car[2014] = u('e'); cdr[2014] = 0; tag[2014] = atomtag;
+car[2013] = 135; cdr[2013] = 0; tag[2013] = 0;
+car[2012] = 135; cdr[2012] = 0; tag[2012] = 0;
+car[2011] = 2010; cdr[2011] = 0; tag[2011] = 0;
+car[2010] = u('k'); cdr[2010] = 2009; tag[2010] = atomtag;
+car[2009] = u(' '); cdr[2009] = 2008; tag[2009] = atomtag;
+car[2008] = u('='); cdr[2008] = 2007; tag[2008] = atomtag;
+car[2007] = u(' '); cdr[2007] = 2006; tag[2007] = atomtag;
+car[2006] = u('a'); cdr[2006] = 2005; tag[2006] = atomtag;
+car[2005] = u('p'); cdr[2005] = 2004; tag[2005] = atomtag;
+car[2004] = u('p'); cdr[2004] = 2003; tag[2004] = atomtag;
+car[2003] = u('l'); cdr[2003] = 2002; tag[2003] = atomtag;
+car[2002] = u('y'); cdr[2002] = 2001; tag[2002] = atomtag;
+car[2001] = u('('); cdr[2001] = 0; tag[2001] = atomtag;
+car[2000] = 1999; cdr[2000] = 0; tag[2000] = 0;
+car[1999] = u(')'); cdr[1999] = 1998; tag[1999] = atomtag;
+car[1998] = u(';'); cdr[1998] = 1997; tag[1998] = atomtag;
+car[1997] = u(' '); cdr[1997] = 1996; tag[1997] = atomtag;
+car[1996] = u('b'); cdr[1996] = 1995; tag[1996] = atomtag;
+car[1995] = u('r'); cdr[1995] = 1994; tag[1995] = atomtag;
+car[1994] = u('e'); cdr[1994] = 1993; tag[1994] = atomtag;
+car[1993] = u('a'); cdr[1993] = 1992; tag[1993] = atomtag;
+car[1992] = u('k'); cdr[1992] = 1991; tag[1992] = atomtag;
+car[1991] = u(';'); cdr[1991] = 0; tag[1991] = atomtag;
+car[1990] = 1989; cdr[1990] = 0; tag[1990] = 0;
 car[1989] = u('r'); cdr[1989] = 1988; tag[1989] = atomtag;
 car[1988] = u('e'); cdr[1988] = 1987; tag[1988] = atomtag;
-car[1987] = u('f'); cdr[1987] = 1986; tag[1987] = atomtag;
-car[1986] = u('('); cdr[1986] = 1985; tag[1986] = atomtag;
-car[1985] = u('e'); cdr[1985] = 1984; tag[1985] = atomtag;
-car[1984] = u('x'); cdr[1984] = 1983; tag[1984] = atomtag;
-car[1983] = u('p'); cdr[1983] = 1982; tag[1983] = atomtag;
-car[1982] = u('r'); cdr[1982] = 1981; tag[1982] = atomtag;
-car[1981] = u(')'); cdr[1981] = 1980; tag[1981] = atomtag;
-car[1980] = u(']'); cdr[1980] = 1979; tag[1980] = atomtag;
-car[1979] = u(';'); cdr[1979] = 0; tag[1979] = atomtag;
-car[1978] = 1977; cdr[1978] = 0; tag[1978] = 0;
-car[1977] = u('i'); cdr[1977] = 1976; tag[1977] = atomtag;
-car[1976] = u('f'); cdr[1976] = 1975; tag[1976] = atomtag;
-car[1975] = u(' '); cdr[1975] = 1974; tag[1975] = atomtag;
-car[1974] = u('('); cdr[1974] = 1973; tag[1974] = atomtag;
-car[1973] = u('s'); cdr[1973] = 1972; tag[1973] = atomtag;
-car[1972] = u('y'); cdr[1972] = 1971; tag[1972] = atomtag;
-car[1971] = u('m'); cdr[1971] = 1970; tag[1971] = atomtag;
+car[1987] = u('t'); cdr[1987] = 0; tag[1987] = atomtag;
+car[1986] = 1985; cdr[1986] = 0; tag[1986] = 0;
+car[1985] = u('k'); cdr[1985] = 1984; tag[1985] = atomtag;
+car[1984] = u(' '); cdr[1984] = 1983; tag[1984] = atomtag;
+car[1983] = u('='); cdr[1983] = 1982; tag[1983] = atomtag;
+car[1982] = u(' '); cdr[1982] = 1981; tag[1982] = atomtag;
+car[1981] = u('a'); cdr[1981] = 1980; tag[1981] = atomtag;
+car[1980] = u('p'); cdr[1980] = 1979; tag[1980] = atomtag;
+car[1979] = u('p'); cdr[1979] = 1978; tag[1979] = atomtag;
+car[1978] = u('l'); cdr[1978] = 1977; tag[1978] = atomtag;
+car[1977] = u('y'); cdr[1977] = 1976; tag[1977] = atomtag;
+car[1976] = u('('); cdr[1976] = 1975; tag[1976] = atomtag;
+car[1975] = u('-'); cdr[1975] = 1974; tag[1975] = atomtag;
+car[1974] = u('1'); cdr[1974] = 1973; tag[1974] = atomtag;
+car[1973] = u(')'); cdr[1973] = 1972; tag[1973] = atomtag;
+car[1972] = u(';'); cdr[1972] = 1971; tag[1972] = atomtag;
+car[1971] = u(' '); cdr[1971] = 1970; tag[1971] = atomtag;
 car[1970] = u('b'); cdr[1970] = 1969; tag[1970] = atomtag;
-car[1969] = u('o'); cdr[1969] = 1968; tag[1969] = atomtag;
-car[1968] = u('l'); cdr[1968] = 1967; tag[1968] = atomtag;
-car[1967] = u('i'); cdr[1967] = 1966; tag[1967] = atomtag;
-car[1966] = u('c'); cdr[1966] = 1965; tag[1966] = atomtag;
-car[1965] = u('('); cdr[1965] = 1964; tag[1965] = atomtag;
-car[1964] = u(')'); cdr[1964] = 1963; tag[1964] = atomtag;
-car[1963] = u(')'); cdr[1963] = 1962; tag[1963] = atomtag;
-car[1962] = u(' '); cdr[1962] = 1961; tag[1962] = atomtag;
-car[1961] = u('c'); cdr[1961] = 1960; tag[1961] = atomtag;
-car[1960] = u('a'); cdr[1960] = 1959; tag[1960] = atomtag;
-car[1959] = u('r'); cdr[1959] = 1958; tag[1959] = atomtag;
-car[1958] = u('_'); cdr[1958] = 1957; tag[1958] = atomtag;
+car[1969] = u('r'); cdr[1969] = 1968; tag[1969] = atomtag;
+car[1968] = u('e'); cdr[1968] = 1967; tag[1968] = atomtag;
+car[1967] = u('a'); cdr[1967] = 1966; tag[1967] = atomtag;
+car[1966] = u('k'); cdr[1966] = 1965; tag[1966] = atomtag;
+car[1965] = u(';'); cdr[1965] = 0; tag[1965] = atomtag;
+car[1964] = 1963; cdr[1964] = 0; tag[1964] = 0;
+car[1963] = u('t'); cdr[1963] = 1962; tag[1963] = atomtag;
+car[1962] = u('o'); cdr[1962] = 1961; tag[1962] = atomtag;
+car[1961] = u('f'); cdr[1961] = 1960; tag[1961] = atomtag;
+car[1960] = u('r'); cdr[1960] = 1959; tag[1960] = atomtag;
+car[1959] = u('a'); cdr[1959] = 1958; tag[1959] = atomtag;
+car[1958] = u('m'); cdr[1958] = 1957; tag[1958] = atomtag;
 car[1957] = u('e'); cdr[1957] = 1956; tag[1957] = atomtag;
-car[1956] = u('r'); cdr[1956] = 1955; tag[1956] = atomtag;
-car[1955] = u('r'); cdr[1955] = 1954; tag[1955] = atomtag;
-car[1954] = u('('); cdr[1954] = 1953; tag[1954] = atomtag;
-car[1953] = u(')'); cdr[1953] = 1952; tag[1953] = atomtag;
-car[1952] = u(';'); cdr[1952] = 0; tag[1952] = atomtag;
-car[1951] = 1950; cdr[1951] = 0; tag[1951] = 0;
-car[1950] = u('r'); cdr[1950] = 1949; tag[1950] = atomtag;
-car[1949] = u('e'); cdr[1949] = 1948; tag[1949] = atomtag;
+car[1956] = u('('); cdr[1956] = 1955; tag[1956] = atomtag;
+car[1955] = u(')'); cdr[1955] = 1954; tag[1955] = atomtag;
+car[1954] = u(';'); cdr[1954] = 0; tag[1954] = atomtag;
+car[1953] = 412; cdr[1953] = 0; tag[1953] = 0;
+car[1952] = 1951; cdr[1952] = 0; tag[1952] = 0;
+car[1951] = u('n'); cdr[1951] = 1950; tag[1951] = atomtag;
+car[1950] = u('e'); cdr[1950] = 1949; tag[1950] = atomtag;
+car[1949] = u('w'); cdr[1949] = 1948; tag[1949] = atomtag;
 car[1948] = u('f'); cdr[1948] = 1947; tag[1948] = atomtag;
-car[1947] = u('('); cdr[1947] = 1946; tag[1947] = atomtag;
-car[1946] = u('e'); cdr[1946] = 1945; tag[1946] = atomtag;
-car[1945] = u('x'); cdr[1945] = 1944; tag[1945] = atomtag;
-car[1944] = u('p'); cdr[1944] = 1943; tag[1944] = atomtag;
-car[1943] = u('r'); cdr[1943] = 1942; tag[1943] = atomtag;
+car[1947] = u('r'); cdr[1947] = 1946; tag[1947] = atomtag;
+car[1946] = u('a'); cdr[1946] = 1945; tag[1946] = atomtag;
+car[1945] = u('m'); cdr[1945] = 1944; tag[1945] = atomtag;
+car[1944] = u('e'); cdr[1944] = 1943; tag[1944] = atomtag;
+car[1943] = u('('); cdr[1943] = 1942; tag[1943] = atomtag;
 car[1942] = u(')'); cdr[1942] = 1941; tag[1942] = atomtag;
-car[1941] = u(' '); cdr[1941] = 1940; tag[1941] = atomtag;
-car[1940] = u('='); cdr[1940] = 1939; tag[1940] = atomtag;
-car[1939] = u(' '); cdr[1939] = 1938; tag[1939] = atomtag;
-car[1938] = u('a'); cdr[1938] = 1937; tag[1938] = atomtag;
-car[1937] = u('t'); cdr[1937] = 1936; tag[1937] = atomtag;
-car[1936] = u('o'); cdr[1936] = 1935; tag[1936] = atomtag;
-car[1935] = u('m'); cdr[1935] = 1934; tag[1935] = atomtag;
-car[1934] = u('i'); cdr[1934] = 1933; tag[1934] = atomtag;
-car[1933] = u('c'); cdr[1933] = 1932; tag[1933] = atomtag;
+car[1941] = u(';'); cdr[1941] = 0; tag[1941] = atomtag;
+car[1940] = 135; cdr[1940] = 1939; tag[1940] = 0;
+car[1939] = 1223; cdr[1939] = 0; tag[1939] = 0;
+car[1938] = 1937; cdr[1938] = 0; tag[1938] = 0;
+car[1937] = u('e'); cdr[1937] = 1936; tag[1937] = atomtag;
+car[1936] = u('n'); cdr[1936] = 1935; tag[1936] = atomtag;
+car[1935] = u('t'); cdr[1935] = 1934; tag[1935] = atomtag;
+car[1934] = u('e'); cdr[1934] = 1933; tag[1934] = atomtag;
+car[1933] = u('r'); cdr[1933] = 1932; tag[1933] = atomtag;
 car[1932] = u('('); cdr[1932] = 1931; tag[1932] = atomtag;
 car[1931] = u(')'); cdr[1931] = 1930; tag[1931] = atomtag;
-car[1930] = u('?'); cdr[1930] = 1929; tag[1930] = atomtag;
+car[1930] = u(';'); cdr[1930] = 1929; tag[1930] = atomtag;
 car[1929] = u(' '); cdr[1929] = 1928; tag[1929] = atomtag;
-car[1928] = u('t'); cdr[1928] = 1927; tag[1928] = atomtag;
-car[1927] = u('r'); cdr[1927] = 1926; tag[1927] = atomtag;
-car[1926] = u('u'); cdr[1926] = 1925; tag[1926] = atomtag;
-car[1925] = u('e'); cdr[1925] = 1924; tag[1925] = atomtag;
-car[1924] = u(':'); cdr[1924] = 1923; tag[1924] = atomtag;
-car[1923] = u(' '); cdr[1923] = 1922; tag[1923] = atomtag;
-car[1922] = u('n'); cdr[1922] = 1921; tag[1922] = atomtag;
-car[1921] = u('i'); cdr[1921] = 1920; tag[1921] = atomtag;
-car[1920] = u('l'); cdr[1920] = 1919; tag[1920] = atomtag;
-car[1919] = u(';'); cdr[1919] = 0; tag[1919] = atomtag;
-car[1918] = 1917; cdr[1918] = 0; tag[1918] = 0;
-car[1917] = u('s'); cdr[1917] = 1916; tag[1917] = atomtag;
-car[1916] = u('e'); cdr[1916] = 1915; tag[1916] = atomtag;
-car[1915] = u('t'); cdr[1915] = 1914; tag[1915] = atomtag;
-car[1914] = u('q'); cdr[1914] = 0; tag[1914] = atomtag;
-car[1913] = 1912; cdr[1913] = 0; tag[1913] = 0;
-car[1912] = u('p'); cdr[1912] = 1911; tag[1912] = atomtag;
+car[1928] = u('f'); cdr[1928] = 1927; tag[1928] = atomtag;
+car[1927] = u('c'); cdr[1927] = 1926; tag[1927] = atomtag;
+car[1926] = u('a'); cdr[1926] = 1925; tag[1926] = atomtag;
+car[1925] = u('l'); cdr[1925] = 1924; tag[1925] = atomtag;
+car[1924] = u('l'); cdr[1924] = 1923; tag[1924] = atomtag;
+car[1923] = u('('); cdr[1923] = 1922; tag[1923] = atomtag;
+car[1922] = u('a'); cdr[1922] = 1921; tag[1922] = atomtag;
+car[1921] = u('s'); cdr[1921] = 1920; tag[1921] = atomtag;
+car[1920] = u('p'); cdr[1920] = 1919; tag[1920] = atomtag;
+car[1919] = u(' '); cdr[1919] = 1918; tag[1919] = atomtag;
+car[1918] = u('-'); cdr[1918] = 1917; tag[1918] = atomtag;
+car[1917] = u(' '); cdr[1917] = 0; tag[1917] = atomtag;
+car[1916] = 1915; cdr[1916] = 0; tag[1916] = 0;
+car[1915] = u('e'); cdr[1915] = 1914; tag[1915] = atomtag;
+car[1914] = u('n'); cdr[1914] = 1913; tag[1914] = atomtag;
+car[1913] = u('t'); cdr[1913] = 1912; tag[1913] = atomtag;
+car[1912] = u('e'); cdr[1912] = 1911; tag[1912] = atomtag;
 car[1911] = u('r'); cdr[1911] = 1910; tag[1911] = atomtag;
-car[1910] = u('o'); cdr[1910] = 1909; tag[1910] = atomtag;
-car[1909] = u('g'); cdr[1909] = 1908; tag[1909] = atomtag;
-car[1908] = u('n'); cdr[1908] = 0; tag[1908] = atomtag;
-car[1907] = 1906; cdr[1907] = 0; tag[1907] = 0;
-car[1906] = u('l'); cdr[1906] = 1905; tag[1906] = atomtag;
-car[1905] = u('a'); cdr[1905] = 1904; tag[1905] = atomtag;
-car[1904] = u('m'); cdr[1904] = 1903; tag[1904] = atomtag;
-car[1903] = u('b'); cdr[1903] = 1902; tag[1903] = atomtag;
-car[1902] = u('d'); cdr[1902] = 1901; tag[1902] = atomtag;
-car[1901] = u('a'); cdr[1901] = 0; tag[1901] = atomtag;
-car[1900] = 1899; cdr[1900] = 0; tag[1900] = 0;
-car[1899] = u('l'); cdr[1899] = 1898; tag[1899] = atomtag;
-car[1898] = u('a'); cdr[1898] = 1897; tag[1898] = atomtag;
-car[1897] = u('b'); cdr[1897] = 1896; tag[1897] = atomtag;
-car[1896] = u('e'); cdr[1896] = 1895; tag[1896] = atomtag;
-car[1895] = u('l'); cdr[1895] = 0; tag[1895] = atomtag;
-car[1894] = 1893; cdr[1894] = 0; tag[1894] = 0;
-car[1893] = u('c'); cdr[1893] = 1892; tag[1893] = atomtag;
-car[1892] = u('o'); cdr[1892] = 1891; tag[1892] = atomtag;
-car[1891] = u('n'); cdr[1891] = 1890; tag[1891] = atomtag;
-car[1890] = u('d'); cdr[1890] = 0; tag[1890] = atomtag;
-car[1889] = 1888; cdr[1889] = 0; tag[1889] = 0;
-car[1888] = u('r'); cdr[1888] = 1887; tag[1888] = atomtag;
-car[1887] = u('e'); cdr[1887] = 1886; tag[1887] = atomtag;
-car[1886] = u('f'); cdr[1886] = 1885; tag[1886] = atomtag;
-car[1885] = u('('); cdr[1885] = 1884; tag[1885] = atomtag;
-car[1884] = u('e'); cdr[1884] = 1883; tag[1884] = atomtag;
-car[1883] = u('x'); cdr[1883] = 1882; tag[1883] = atomtag;
-car[1882] = u('p'); cdr[1882] = 1881; tag[1882] = atomtag;
-car[1881] = u('r'); cdr[1881] = 1880; tag[1881] = atomtag;
-car[1880] = u(')'); cdr[1880] = 1879; tag[1880] = atomtag;
-car[1879] = u(' '); cdr[1879] = 1878; tag[1879] = atomtag;
-car[1878] = u('='); cdr[1878] = 1877; tag[1878] = atomtag;
-car[1877] = u(' '); cdr[1877] = 1876; tag[1877] = atomtag;
-car[1876] = u('v'); cdr[1876] = 1875; tag[1876] = atomtag;
-car[1875] = u('a'); cdr[1875] = 1874; tag[1875] = atomtag;
-car[1874] = u('l'); cdr[1874] = 1873; tag[1874] = atomtag;
-car[1873] = u('('); cdr[1873] = 0; tag[1873] = atomtag;
-car[1872] = 1871; cdr[1872] = 0; tag[1872] = 0;
-car[1871] = u('r'); cdr[1871] = 1870; tag[1871] = atomtag;
-car[1870] = u('e'); cdr[1870] = 1869; tag[1870] = atomtag;
-car[1869] = u('f'); cdr[1869] = 1868; tag[1869] = atomtag;
-car[1868] = u('('); cdr[1868] = 1867; tag[1868] = atomtag;
-car[1867] = u('e'); cdr[1867] = 1866; tag[1867] = atomtag;
-car[1866] = u('x'); cdr[1866] = 1865; tag[1866] = atomtag;
-car[1865] = u('p'); cdr[1865] = 1864; tag[1865] = atomtag;
-car[1864] = u('r'); cdr[1864] = 1863; tag[1864] = atomtag;
-car[1863] = u(')'); cdr[1863] = 1862; tag[1863] = atomtag;
-car[1862] = u(' '); cdr[1862] = 1861; tag[1862] = atomtag;
-car[1861] = u('='); cdr[1861] = 1860; tag[1861] = atomtag;
-car[1860] = u(' '); cdr[1860] = 0; tag[1860] = atomtag;
+car[1910] = u('('); cdr[1910] = 1909; tag[1910] = atomtag;
+car[1909] = u(')'); cdr[1909] = 1908; tag[1909] = atomtag;
+car[1908] = u(';'); cdr[1908] = 1907; tag[1908] = atomtag;
+car[1907] = u(' '); cdr[1907] = 1906; tag[1907] = atomtag;
+car[1906] = u('f'); cdr[1906] = 0; tag[1906] = atomtag;
+car[1905] = 1904; cdr[1905] = 0; tag[1905] = 0;
+car[1904] = u('('); cdr[1904] = 1903; tag[1904] = atomtag;
+car[1903] = u('a'); cdr[1903] = 1902; tag[1903] = atomtag;
+car[1902] = u('s'); cdr[1902] = 1901; tag[1902] = atomtag;
+car[1901] = u('p'); cdr[1901] = 1900; tag[1901] = atomtag;
+car[1900] = u(' '); cdr[1900] = 1899; tag[1900] = atomtag;
+car[1899] = u('-'); cdr[1899] = 1898; tag[1899] = atomtag;
+car[1898] = u(' '); cdr[1898] = 0; tag[1898] = atomtag;
+car[1897] = 1896; cdr[1897] = 0; tag[1897] = 0;
+car[1896] = u(')'); cdr[1896] = 1895; tag[1896] = atomtag;
+car[1895] = u(';'); cdr[1895] = 1894; tag[1895] = atomtag;
+car[1894] = u(' '); cdr[1894] = 1893; tag[1894] = atomtag;
+car[1893] = u('l'); cdr[1893] = 1892; tag[1893] = atomtag;
+car[1892] = u('e'); cdr[1892] = 1891; tag[1892] = atomtag;
+car[1891] = u('a'); cdr[1891] = 1890; tag[1891] = atomtag;
+car[1890] = u('v'); cdr[1890] = 1889; tag[1890] = atomtag;
+car[1889] = u('e'); cdr[1889] = 1888; tag[1889] = atomtag;
+car[1888] = u('('); cdr[1888] = 1887; tag[1888] = atomtag;
+car[1887] = u(')'); cdr[1887] = 1886; tag[1887] = atomtag;
+car[1886] = u(';'); cdr[1886] = 0; tag[1886] = atomtag;
+car[1885] = 1884; cdr[1885] = 0; tag[1885] = 0;
+car[1884] = u('f'); cdr[1884] = 1883; tag[1884] = atomtag;
+car[1883] = u('c'); cdr[1883] = 1882; tag[1883] = atomtag;
+car[1882] = u('a'); cdr[1882] = 1881; tag[1882] = atomtag;
+car[1881] = u('l'); cdr[1881] = 1880; tag[1881] = atomtag;
+car[1880] = u('l'); cdr[1880] = 1879; tag[1880] = atomtag;
+car[1879] = u('('); cdr[1879] = 1878; tag[1879] = atomtag;
+car[1878] = u('a'); cdr[1878] = 1877; tag[1878] = atomtag;
+car[1877] = u(','); cdr[1877] = 1876; tag[1877] = atomtag;
+car[1876] = u(' '); cdr[1876] = 0; tag[1876] = atomtag;
+car[1875] = 1874; cdr[1875] = 0; tag[1875] = 0;
+car[1874] = u('('); cdr[1874] = 1873; tag[1874] = atomtag;
+car[1873] = u('a'); cdr[1873] = 1872; tag[1873] = atomtag;
+car[1872] = u(','); cdr[1872] = 1871; tag[1872] = atomtag;
+car[1871] = u(' '); cdr[1871] = 0; tag[1871] = atomtag;
+car[1870] = 1869; cdr[1870] = 0; tag[1870] = 0;
+car[1869] = u(')'); cdr[1869] = 1868; tag[1869] = atomtag;
+car[1868] = u(';'); cdr[1868] = 1867; tag[1868] = atomtag;
+car[1867] = u(' '); cdr[1867] = 1866; tag[1867] = atomtag;
+car[1866] = u('r'); cdr[1866] = 1865; tag[1866] = atomtag;
+car[1865] = u('e'); cdr[1865] = 1864; tag[1865] = atomtag;
+car[1864] = u('t'); cdr[1864] = 1863; tag[1864] = atomtag;
+car[1863] = u('u'); cdr[1863] = 1862; tag[1863] = atomtag;
+car[1862] = u('r'); cdr[1862] = 1861; tag[1862] = atomtag;
+car[1861] = u('n'); cdr[1861] = 1860; tag[1861] = atomtag;
+car[1860] = u(';'); cdr[1860] = 0; tag[1860] = atomtag;
 car[1859] = 1858; cdr[1859] = 0; tag[1859] = 0;
-car[1858] = u('*'); cdr[1858] = 1857; tag[1858] = atomtag;
-car[1857] = u('l'); cdr[1857] = 1856; tag[1857] = atomtag;
+car[1858] = u('t'); cdr[1858] = 1857; tag[1858] = atomtag;
+car[1857] = u('a'); cdr[1857] = 1856; tag[1857] = atomtag;
 car[1856] = u('i'); cdr[1856] = 1855; tag[1856] = atomtag;
-car[1855] = u('m'); cdr[1855] = 1854; tag[1855] = atomtag;
-car[1854] = u('i'); cdr[1854] = 1853; tag[1854] = atomtag;
-car[1853] = u('t'); cdr[1853] = 0; tag[1853] = atomtag;
-car[1852] = 1851; cdr[1852] = 0; tag[1852] = 0;
-car[1851] = u('r'); cdr[1851] = 1850; tag[1851] = atomtag;
-car[1850] = u('e'); cdr[1850] = 1849; tag[1850] = atomtag;
-car[1849] = u('f'); cdr[1849] = 1848; tag[1849] = atomtag;
-car[1848] = u('('); cdr[1848] = 1847; tag[1848] = atomtag;
-car[1847] = u('e'); cdr[1847] = 1846; tag[1847] = atomtag;
-car[1846] = u('x'); cdr[1846] = 1845; tag[1846] = atomtag;
-car[1845] = u('p'); cdr[1845] = 1844; tag[1845] = atomtag;
-car[1844] = u('r'); cdr[1844] = 1843; tag[1844] = atomtag;
-car[1843] = u(')'); cdr[1843] = 1842; tag[1843] = atomtag;
-car[1842] = u(' '); cdr[1842] = 1841; tag[1842] = atomtag;
-car[1841] = u('='); cdr[1841] = 1840; tag[1841] = atomtag;
-car[1840] = u(' '); cdr[1840] = 1839; tag[1840] = atomtag;
-car[1839] = u('0'); cdr[1839] = 1838; tag[1839] = atomtag;
-car[1838] = u(';'); cdr[1838] = 0; tag[1838] = atomtag;
+car[1855] = u('l'); cdr[1855] = 1854; tag[1855] = atomtag;
+car[1854] = u('a'); cdr[1854] = 1853; tag[1854] = atomtag;
+car[1853] = u('r'); cdr[1853] = 1852; tag[1853] = atomtag;
+car[1852] = u('g'); cdr[1852] = 1851; tag[1852] = atomtag;
+car[1851] = u('s'); cdr[1851] = 1850; tag[1851] = atomtag;
+car[1850] = u('('); cdr[1850] = 0; tag[1850] = atomtag;
+car[1849] = 1848; cdr[1849] = 0; tag[1849] = 0;
+car[1848] = u('a'); cdr[1848] = 1847; tag[1848] = atomtag;
+car[1847] = u('r'); cdr[1847] = 1846; tag[1847] = atomtag;
+car[1846] = u('g'); cdr[1846] = 1845; tag[1846] = atomtag;
+car[1845] = u('s'); cdr[1845] = 1844; tag[1845] = atomtag;
+car[1844] = u('('); cdr[1844] = 0; tag[1844] = atomtag;
+car[1843] = 1842; cdr[1843] = 0; tag[1843] = 0;
+car[1842] = u('a'); cdr[1842] = 1841; tag[1842] = atomtag;
+car[1841] = u('s'); cdr[1841] = 1840; tag[1841] = atomtag;
+car[1840] = u('p'); cdr[1840] = 1839; tag[1840] = atomtag;
+car[1839] = u('['); cdr[1839] = 1838; tag[1839] = atomtag;
+car[1838] = u('-'); cdr[1838] = 0; tag[1838] = atomtag;
 car[1837] = 1836; cdr[1837] = 0; tag[1837] = 0;
-car[1836] = u('*'); cdr[1836] = 1835; tag[1836] = atomtag;
-car[1835] = u('p'); cdr[1835] = 1834; tag[1835] = atomtag;
-car[1834] = u('o'); cdr[1834] = 1833; tag[1834] = atomtag;
-car[1833] = u('o'); cdr[1833] = 1832; tag[1833] = atomtag;
-car[1832] = u('l'); cdr[1832] = 0; tag[1832] = atomtag;
-car[1831] = 1830; cdr[1831] = 0; tag[1831] = 0;
-car[1830] = u('r'); cdr[1830] = 1829; tag[1830] = atomtag;
-car[1829] = u('e'); cdr[1829] = 1828; tag[1829] = atomtag;
-car[1828] = u('f'); cdr[1828] = 1827; tag[1828] = atomtag;
-car[1827] = u('('); cdr[1827] = 1826; tag[1827] = atomtag;
-car[1826] = u('e'); cdr[1826] = 1825; tag[1826] = atomtag;
-car[1825] = u('x'); cdr[1825] = 1824; tag[1825] = atomtag;
-car[1824] = u('p'); cdr[1824] = 1823; tag[1824] = atomtag;
-car[1823] = u('r'); cdr[1823] = 1822; tag[1823] = atomtag;
-car[1822] = u(')'); cdr[1822] = 1821; tag[1822] = atomtag;
-car[1821] = u(' '); cdr[1821] = 1820; tag[1821] = atomtag;
-car[1820] = u('='); cdr[1820] = 1819; tag[1820] = atomtag;
-car[1819] = u(' '); cdr[1819] = 1818; tag[1819] = atomtag;
-car[1818] = u('t'); cdr[1818] = 1817; tag[1818] = atomtag;
-car[1817] = u('r'); cdr[1817] = 1816; tag[1817] = atomtag;
-car[1816] = u('u'); cdr[1816] = 1815; tag[1816] = atomtag;
-car[1815] = u('e'); cdr[1815] = 1814; tag[1815] = atomtag;
-car[1814] = u(';'); cdr[1814] = 0; tag[1814] = atomtag;
-car[1813] = 135; cdr[1813] = 1812; tag[1813] = 0;
-car[1812] = 1200; cdr[1812] = 0; tag[1812] = 0;
-car[1811] = 1810; cdr[1811] = 0; tag[1811] = 0;
-car[1810] = u('t'); cdr[1810] = 1809; tag[1810] = atomtag;
-car[1809] = u('w'); cdr[1809] = 1808; tag[1809] = atomtag;
-car[1808] = u('o'); cdr[1808] = 1807; tag[1808] = atomtag;
-car[1807] = u('a'); cdr[1807] = 1806; tag[1807] = atomtag;
-car[1806] = u('r'); cdr[1806] = 1805; tag[1806] = atomtag;
-car[1805] = u('g'); cdr[1805] = 1804; tag[1805] = atomtag;
-car[1804] = u('s'); cdr[1804] = 0; tag[1804] = atomtag;
-car[1803] = 1802; cdr[1803] = 0; tag[1803] = 0;
-car[1802] = u('r'); cdr[1802] = 1801; tag[1802] = atomtag;
-car[1801] = u('e'); cdr[1801] = 1800; tag[1801] = atomtag;
-car[1800] = u('f'); cdr[1800] = 1799; tag[1800] = atomtag;
-car[1799] = u('('); cdr[1799] = 1798; tag[1799] = atomtag;
-car[1798] = u('e'); cdr[1798] = 1797; tag[1798] = atomtag;
-car[1797] = u('x'); cdr[1797] = 1796; tag[1797] = atomtag;
-car[1796] = u('p'); cdr[1796] = 1795; tag[1796] = atomtag;
-car[1795] = u('r'); cdr[1795] = 1794; tag[1795] = atomtag;
-car[1794] = u('2'); cdr[1794] = 1793; tag[1794] = atomtag;
-car[1793] = u(')'); cdr[1793] = 1792; tag[1793] = atomtag;
-car[1792] = u(' '); cdr[1792] = 1791; tag[1792] = atomtag;
-car[1791] = u('='); cdr[1791] = 1790; tag[1791] = atomtag;
-car[1790] = u(' '); cdr[1790] = 1789; tag[1790] = atomtag;
-car[1789] = u('p'); cdr[1789] = 1788; tag[1789] = atomtag;
-car[1788] = u('o'); cdr[1788] = 1787; tag[1788] = atomtag;
-car[1787] = u('p'); cdr[1787] = 1786; tag[1787] = atomtag;
-car[1786] = u('('); cdr[1786] = 1785; tag[1786] = atomtag;
-car[1785] = u(')'); cdr[1785] = 1784; tag[1785] = atomtag;
-car[1784] = u(';'); cdr[1784] = 0; tag[1784] = atomtag;
-car[1783] = 1782; cdr[1783] = 0; tag[1783] = 0;
-car[1782] = u('p'); cdr[1782] = 1781; tag[1782] = atomtag;
-car[1781] = u('u'); cdr[1781] = 1780; tag[1781] = atomtag;
-car[1780] = u('s'); cdr[1780] = 1779; tag[1780] = atomtag;
-car[1779] = u('h'); cdr[1779] = 1778; tag[1779] = atomtag;
-car[1778] = u('('); cdr[1778] = 1777; tag[1778] = atomtag;
-car[1777] = u(')'); cdr[1777] = 1776; tag[1777] = atomtag;
-car[1776] = u(';'); cdr[1776] = 0; tag[1776] = atomtag;
-car[1775] = 135; cdr[1775] = 0; tag[1775] = 0;
-car[1774] = 1773; cdr[1774] = 0; tag[1774] = 0;
-car[1773] = u('s'); cdr[1773] = 1772; tag[1773] = atomtag;
-car[1772] = u('e'); cdr[1772] = 1771; tag[1772] = atomtag;
-car[1771] = u('t'); cdr[1771] = 1770; tag[1771] = atomtag;
-car[1770] = u('t'); cdr[1770] = 1769; tag[1770] = atomtag;
-car[1769] = u('a'); cdr[1769] = 1768; tag[1769] = atomtag;
-car[1768] = u('g'); cdr[1768] = 0; tag[1768] = atomtag;
-car[1767] = 1766; cdr[1767] = 0; tag[1767] = 0;
-car[1766] = u('t'); cdr[1766] = 1765; tag[1766] = atomtag;
-car[1765] = u('a'); cdr[1765] = 1764; tag[1765] = atomtag;
-car[1764] = u('g'); cdr[1764] = 1763; tag[1764] = atomtag;
-car[1763] = u('['); cdr[1763] = 1762; tag[1763] = atomtag;
-car[1762] = u('r'); cdr[1762] = 1761; tag[1762] = atomtag;
-car[1761] = u('e'); cdr[1761] = 1760; tag[1761] = atomtag;
-car[1760] = u('f'); cdr[1760] = 1759; tag[1760] = atomtag;
-car[1759] = u('('); cdr[1759] = 1758; tag[1759] = atomtag;
-car[1758] = u('e'); cdr[1758] = 1757; tag[1758] = atomtag;
-car[1757] = u('x'); cdr[1757] = 1756; tag[1757] = atomtag;
-car[1756] = u('p'); cdr[1756] = 1755; tag[1756] = atomtag;
+car[1836] = u(']'); cdr[1836] = 1835; tag[1836] = atomtag;
+car[1835] = u(' '); cdr[1835] = 1834; tag[1835] = atomtag;
+car[1834] = u('='); cdr[1834] = 1833; tag[1834] = atomtag;
+car[1833] = u(' '); cdr[1833] = 1832; tag[1833] = atomtag;
+car[1832] = u('r'); cdr[1832] = 1831; tag[1832] = atomtag;
+car[1831] = u('e'); cdr[1831] = 1830; tag[1831] = atomtag;
+car[1830] = u('f'); cdr[1830] = 1829; tag[1830] = atomtag;
+car[1829] = u('('); cdr[1829] = 1828; tag[1829] = atomtag;
+car[1828] = u('e'); cdr[1828] = 1827; tag[1828] = atomtag;
+car[1827] = u('x'); cdr[1827] = 1826; tag[1827] = atomtag;
+car[1826] = u('p'); cdr[1826] = 1825; tag[1826] = atomtag;
+car[1825] = u('r'); cdr[1825] = 1824; tag[1825] = atomtag;
+car[1824] = u(')'); cdr[1824] = 1823; tag[1824] = atomtag;
+car[1823] = u(';'); cdr[1823] = 0; tag[1823] = atomtag;
+car[1822] = 412; cdr[1822] = 1821; tag[1822] = 0;
+car[1821] = 689; cdr[1821] = 0; tag[1821] = 0;
+car[1820] = 135; cdr[1820] = 1819; tag[1820] = 0;
+car[1819] = 1223; cdr[1819] = 0; tag[1819] = 0;
+car[1818] = 1817; cdr[1818] = 0; tag[1818] = 0;
+car[1817] = u('k'); cdr[1817] = 1816; tag[1817] = atomtag;
+car[1816] = u('n'); cdr[1816] = 1815; tag[1816] = atomtag;
+car[1815] = u('o'); cdr[1815] = 1814; tag[1815] = atomtag;
+car[1814] = u('w'); cdr[1814] = 1813; tag[1814] = atomtag;
+car[1813] = u('n'); cdr[1813] = 1812; tag[1813] = atomtag;
+car[1812] = u('p'); cdr[1812] = 0; tag[1812] = atomtag;
+car[1811] = 135; cdr[1811] = 0; tag[1811] = 0;
+car[1810] = 1809; cdr[1810] = 0; tag[1810] = 0;
+car[1809] = u('i'); cdr[1809] = 1808; tag[1809] = atomtag;
+car[1808] = u('n'); cdr[1808] = 1807; tag[1808] = atomtag;
+car[1807] = u('l'); cdr[1807] = 1806; tag[1807] = atomtag;
+car[1806] = u('i'); cdr[1806] = 1805; tag[1806] = atomtag;
+car[1805] = u('n'); cdr[1805] = 1804; tag[1805] = atomtag;
+car[1804] = u('e'); cdr[1804] = 0; tag[1804] = atomtag;
+car[1803] = 135; cdr[1803] = 0; tag[1803] = 0;
+car[1802] = 1801; cdr[1802] = 0; tag[1802] = 0;
+car[1801] = u('s'); cdr[1801] = 1800; tag[1801] = atomtag;
+car[1800] = u('u'); cdr[1800] = 1799; tag[1800] = atomtag;
+car[1799] = u('b'); cdr[1799] = 1798; tag[1799] = atomtag;
+car[1798] = u('s'); cdr[1798] = 1797; tag[1798] = atomtag;
+car[1797] = u('t'); cdr[1797] = 0; tag[1797] = atomtag;
+car[1796] = 153; cdr[1796] = 0; tag[1796] = 0;
+car[1795] = 135; cdr[1795] = 1794; tag[1795] = 0;
+car[1794] = 409; cdr[1794] = 0; tag[1794] = 0;
+car[1793] = 1792; cdr[1793] = 0; tag[1793] = 0;
+car[1792] = u('i'); cdr[1792] = 1791; tag[1792] = atomtag;
+car[1791] = u('n'); cdr[1791] = 1790; tag[1791] = atomtag;
+car[1790] = u('l'); cdr[1790] = 1789; tag[1790] = atomtag;
+car[1789] = u('i'); cdr[1789] = 1788; tag[1789] = atomtag;
+car[1788] = u('n'); cdr[1788] = 1787; tag[1788] = atomtag;
+car[1787] = u('e'); cdr[1787] = 1786; tag[1787] = atomtag;
+car[1786] = u('p'); cdr[1786] = 0; tag[1786] = atomtag;
+car[1785] = 412; cdr[1785] = 0; tag[1785] = 0;
+car[1784] = 1783; cdr[1784] = 0; tag[1784] = 0;
+car[1783] = u('i'); cdr[1783] = 1782; tag[1783] = atomtag;
+car[1782] = u('n'); cdr[1782] = 1781; tag[1782] = atomtag;
+car[1781] = u('l'); cdr[1781] = 1780; tag[1781] = atomtag;
+car[1780] = u('i'); cdr[1780] = 1779; tag[1780] = atomtag;
+car[1779] = u('n'); cdr[1779] = 1778; tag[1779] = atomtag;
+car[1778] = u('e'); cdr[1778] = 1777; tag[1778] = atomtag;
+car[1777] = u('s'); cdr[1777] = 0; tag[1777] = atomtag;
+car[1776] = 135; cdr[1776] = 0; tag[1776] = 0;
+car[1775] = 1774; cdr[1775] = 0; tag[1775] = 0;
+car[1774] = u('g'); cdr[1774] = 1773; tag[1774] = atomtag;
+car[1773] = u('o'); cdr[1773] = 1772; tag[1773] = atomtag;
+car[1772] = u('t'); cdr[1772] = 1771; tag[1772] = atomtag;
+car[1771] = u('o'); cdr[1771] = 1770; tag[1771] = atomtag;
+car[1770] = u(' '); cdr[1770] = 1769; tag[1770] = atomtag;
+car[1769] = u('s'); cdr[1769] = 1768; tag[1769] = atomtag;
+car[1768] = u('e'); cdr[1768] = 1767; tag[1768] = atomtag;
+car[1767] = u('l'); cdr[1767] = 1766; tag[1767] = atomtag;
+car[1766] = u('f'); cdr[1766] = 1765; tag[1766] = atomtag;
+car[1765] = u(';'); cdr[1765] = 0; tag[1765] = atomtag;
+car[1764] = 1763; cdr[1764] = 0; tag[1764] = 0;
+car[1763] = u(')'); cdr[1763] = 1762; tag[1763] = atomtag;
+car[1762] = u(' '); cdr[1762] = 1761; tag[1762] = atomtag;
+car[1761] = u('='); cdr[1761] = 1760; tag[1761] = atomtag;
+car[1760] = u(' '); cdr[1760] = 1759; tag[1760] = atomtag;
+car[1759] = u('p'); cdr[1759] = 1758; tag[1759] = atomtag;
+car[1758] = u('o'); cdr[1758] = 1757; tag[1758] = atomtag;
+car[1757] = u('p'); cdr[1757] = 1756; tag[1757] = atomtag;
+car[1756] = u('a'); cdr[1756] = 1755; tag[1756] = atomtag;
 car[1755] = u('r'); cdr[1755] = 1754; tag[1755] = atomtag;
-car[1754] = u(')'); cdr[1754] = 1753; tag[1754] = atomtag;
-car[1753] = u(']'); cdr[1753] = 0; tag[1753] = atomtag;
-car[1752] = 1751; cdr[1752] = 0; tag[1752] = 0;
-car[1751] = u(' '); cdr[1751] = 1750; tag[1751] = atomtag;
-car[1750] = u('&'); cdr[1750] = 1749; tag[1750] = atomtag;
-car[1749] = u('='); cdr[1749] = 1748; tag[1749] = atomtag;
-car[1748] = u(' '); cdr[1748] = 1747; tag[1748] = atomtag;
-car[1747] = u('~'); cdr[1747] = 0; tag[1747] = atomtag;
-car[1746] = 1745; cdr[1746] = 0; tag[1746] = 0;
-car[1745] = u(' '); cdr[1745] = 1744; tag[1745] = atomtag;
-car[1744] = u('|'); cdr[1744] = 1743; tag[1744] = atomtag;
-car[1743] = u('='); cdr[1743] = 1742; tag[1743] = atomtag;
-car[1742] = u(' '); cdr[1742] = 0; tag[1742] = atomtag;
-car[1741] = 1740; cdr[1741] = 1729; tag[1741] = 0;
-car[1740] = 1739; cdr[1740] = 1730; tag[1740] = 0;
-car[1739] = 1738; cdr[1739] = 0; tag[1739] = 0;
-car[1738] = u('*'); cdr[1738] = 1737; tag[1738] = atomtag;
-car[1737] = u('s'); cdr[1737] = 1736; tag[1737] = atomtag;
-car[1736] = u('e'); cdr[1736] = 1735; tag[1736] = atomtag;
-car[1735] = u('t'); cdr[1735] = 1734; tag[1735] = atomtag;
-car[1734] = u('a'); cdr[1734] = 1733; tag[1734] = atomtag;
-car[1733] = u('t'); cdr[1733] = 1732; tag[1733] = atomtag;
-car[1732] = u('o'); cdr[1732] = 1731; tag[1732] = atomtag;
-car[1731] = u('m'); cdr[1731] = 0; tag[1731] = atomtag;
-car[1730] = 1640; cdr[1730] = 0; tag[1730] = 0;
-car[1729] = 1728; cdr[1729] = 1717; tag[1729] = 0;
-car[1728] = 1727; cdr[1728] = 1718; tag[1728] = 0;
+car[1754] = u('g'); cdr[1754] = 1753; tag[1754] = atomtag;
+car[1753] = u('('); cdr[1753] = 1752; tag[1753] = atomtag;
+car[1752] = u(')'); cdr[1752] = 1751; tag[1752] = atomtag;
+car[1751] = u(';'); cdr[1751] = 0; tag[1751] = atomtag;
+car[1750] = 909; cdr[1750] = 0; tag[1750] = 0;
+car[1749] = 1748; cdr[1749] = 0; tag[1749] = 0;
+car[1748] = u('a'); cdr[1748] = 1747; tag[1748] = atomtag;
+car[1747] = u('s'); cdr[1747] = 1746; tag[1747] = atomtag;
+car[1746] = u('s'); cdr[1746] = 1745; tag[1746] = atomtag;
+car[1745] = u('i'); cdr[1745] = 1744; tag[1745] = atomtag;
+car[1744] = u('g'); cdr[1744] = 1743; tag[1744] = atomtag;
+car[1743] = u('n'); cdr[1743] = 0; tag[1743] = atomtag;
+car[1742] = 1741; cdr[1742] = 0; tag[1742] = 0;
+car[1741] = u('p'); cdr[1741] = 1740; tag[1741] = atomtag;
+car[1740] = u('u'); cdr[1740] = 1739; tag[1740] = atomtag;
+car[1739] = u('s'); cdr[1739] = 1738; tag[1739] = atomtag;
+car[1738] = u('h'); cdr[1738] = 1737; tag[1738] = atomtag;
+car[1737] = u('a'); cdr[1737] = 1736; tag[1737] = atomtag;
+car[1736] = u('r'); cdr[1736] = 1735; tag[1736] = atomtag;
+car[1735] = u('g'); cdr[1735] = 1734; tag[1735] = atomtag;
+car[1734] = u('('); cdr[1734] = 1733; tag[1734] = atomtag;
+car[1733] = u(')'); cdr[1733] = 1732; tag[1733] = atomtag;
+car[1732] = u(';'); cdr[1732] = 0; tag[1732] = atomtag;
+car[1731] = 412; cdr[1731] = 0; tag[1731] = 0;
+car[1730] = 135; cdr[1730] = 0; tag[1730] = 0;
+car[1729] = 135; cdr[1729] = 1728; tag[1729] = 0;
+car[1728] = 1223; cdr[1728] = 0; tag[1728] = 0;
 car[1727] = 1726; cdr[1727] = 0; tag[1727] = 0;
-car[1726] = u('*'); cdr[1726] = 1725; tag[1726] = atomtag;
-car[1725] = u('s'); cdr[1725] = 1724; tag[1725] = atomtag;
-car[1724] = u('e'); cdr[1724] = 1723; tag[1724] = atomtag;
-car[1723] = u('t'); cdr[1723] = 1722; tag[1723] = atomtag;
-car[1722] = u('m'); cdr[1722] = 1721; tag[1722] = atomtag;
-car[1721] = u('a'); cdr[1721] = 1720; tag[1721] = atomtag;
-car[1720] = u('r'); cdr[1720] = 1719; tag[1720] = atomtag;
-car[1719] = u('k'); cdr[1719] = 0; tag[1719] = atomtag;
-car[1718] = 1622; cdr[1718] = 0; tag[1718] = 0;
-car[1717] = 1716; cdr[1717] = 0; tag[1717] = 0;
-car[1716] = 1715; cdr[1716] = 1706; tag[1716] = 0;
-car[1715] = 1714; cdr[1715] = 0; tag[1715] = 0;
-car[1714] = u('*'); cdr[1714] = 1713; tag[1714] = atomtag;
-car[1713] = u('s'); cdr[1713] = 1712; tag[1713] = atomtag;
-car[1712] = u('e'); cdr[1712] = 1711; tag[1712] = atomtag;
-car[1711] = u('t'); cdr[1711] = 1710; tag[1711] = atomtag;
-car[1710] = u('t'); cdr[1710] = 1709; tag[1710] = atomtag;
-car[1709] = u('r'); cdr[1709] = 1708; tag[1709] = atomtag;
+car[1726] = u('s'); cdr[1726] = 1725; tag[1726] = atomtag;
+car[1725] = u('e'); cdr[1725] = 1724; tag[1725] = atomtag;
+car[1724] = u('l'); cdr[1724] = 1723; tag[1724] = atomtag;
+car[1723] = u('f'); cdr[1723] = 1722; tag[1723] = atomtag;
+car[1722] = u('o'); cdr[1722] = 1721; tag[1722] = atomtag;
+car[1721] = u('k'); cdr[1721] = 0; tag[1721] = atomtag;
+car[1720] = 135; cdr[1720] = 0; tag[1720] = 0;
+car[1719] = 1718; cdr[1719] = 0; tag[1719] = 0;
+car[1718] = u('f'); cdr[1718] = 1717; tag[1718] = atomtag;
+car[1717] = u('u'); cdr[1717] = 1716; tag[1717] = atomtag;
+car[1716] = u('n'); cdr[1716] = 1715; tag[1716] = atomtag;
+car[1715] = u('a'); cdr[1715] = 1714; tag[1715] = atomtag;
+car[1714] = u('p'); cdr[1714] = 1713; tag[1714] = atomtag;
+car[1713] = u('p'); cdr[1713] = 0; tag[1713] = atomtag;
+car[1712] = 1711; cdr[1712] = 0; tag[1712] = 0;
+car[1711] = u('f'); cdr[1711] = 1710; tag[1711] = atomtag;
+car[1710] = u('u'); cdr[1710] = 1709; tag[1710] = atomtag;
+car[1709] = u('n'); cdr[1709] = 1708; tag[1709] = atomtag;
 car[1708] = u('a'); cdr[1708] = 1707; tag[1708] = atomtag;
-car[1707] = u('v'); cdr[1707] = 0; tag[1707] = atomtag;
-car[1706] = 1604; cdr[1706] = 0; tag[1706] = 0;
-car[1705] = 135; cdr[1705] = 0; tag[1705] = 0;
-car[1704] = 1703; cdr[1704] = 0; tag[1704] = 0;
-car[1703] = u('c'); cdr[1703] = 1702; tag[1703] = atomtag;
-car[1702] = u('h'); cdr[1702] = 1701; tag[1702] = atomtag;
-car[1701] = u('e'); cdr[1701] = 1700; tag[1701] = atomtag;
-car[1700] = u('c'); cdr[1700] = 1699; tag[1700] = atomtag;
-car[1699] = u('k'); cdr[1699] = 1698; tag[1699] = atomtag;
-car[1698] = u('t'); cdr[1698] = 1697; tag[1698] = atomtag;
-car[1697] = u('a'); cdr[1697] = 1696; tag[1697] = atomtag;
-car[1696] = u('g'); cdr[1696] = 0; tag[1696] = atomtag;
-car[1695] = 1694; cdr[1695] = 0; tag[1695] = 0;
-car[1694] = u('r'); cdr[1694] = 1693; tag[1694] = atomtag;
-car[1693] = u('e'); cdr[1693] = 1692; tag[1693] = atomtag;
-car[1692] = u('f'); cdr[1692] = 1691; tag[1692] = atomtag;
-car[1691] = u('('); cdr[1691] = 1690; tag[1691] = atomtag;
-car[1690] = u('e'); cdr[1690] = 1689; tag[1690] = atomtag;
-car[1689] = u('x'); cdr[1689] = 1688; tag[1689] = atomtag;
-car[1688] = u('p'); cdr[1688] = 1687; tag[1688] = atomtag;
-car[1687] = u('r'); cdr[1687] = 1686; tag[1687] = atomtag;
-car[1686] = u(')'); cdr[1686] = 1685; tag[1686] = atomtag;
-car[1685] = u(' '); cdr[1685] = 1684; tag[1685] = atomtag;
-car[1684] = u('='); cdr[1684] = 1683; tag[1684] = atomtag;
-car[1683] = u(' '); cdr[1683] = 1682; tag[1683] = atomtag;
-car[1682] = u('('); cdr[1682] = 1681; tag[1682] = atomtag;
-car[1681] = u('t'); cdr[1681] = 1680; tag[1681] = atomtag;
-car[1680] = u('a'); cdr[1680] = 1679; tag[1680] = atomtag;
-car[1679] = u('g'); cdr[1679] = 1678; tag[1679] = atomtag;
-car[1678] = u('['); cdr[1678] = 1677; tag[1678] = atomtag;
-car[1677] = u('r'); cdr[1677] = 1676; tag[1677] = atomtag;
-car[1676] = u('e'); cdr[1676] = 1675; tag[1676] = atomtag;
-car[1675] = u('f'); cdr[1675] = 1674; tag[1675] = atomtag;
-car[1674] = u('('); cdr[1674] = 1673; tag[1674] = atomtag;
-car[1673] = u('e'); cdr[1673] = 1672; tag[1673] = atomtag;
-car[1672] = u('x'); cdr[1672] = 1671; tag[1672] = atomtag;
-car[1671] = u('p'); cdr[1671] = 1670; tag[1671] = atomtag;
-car[1670] = u('r'); cdr[1670] = 1669; tag[1670] = atomtag;
-car[1669] = u(')'); cdr[1669] = 1668; tag[1669] = atomtag;
-car[1668] = u(']'); cdr[1668] = 1667; tag[1668] = atomtag;
-car[1667] = u(' '); cdr[1667] = 1666; tag[1667] = atomtag;
-car[1666] = u('&'); cdr[1666] = 1665; tag[1666] = atomtag;
-car[1665] = u(' '); cdr[1665] = 0; tag[1665] = atomtag;
-car[1664] = 1663; cdr[1664] = 0; tag[1664] = 0;
+car[1707] = u('p'); cdr[1707] = 1706; tag[1707] = atomtag;
+car[1706] = u('p'); cdr[1706] = 1705; tag[1706] = atomtag;
+car[1705] = u('-'); cdr[1705] = 1704; tag[1705] = atomtag;
+car[1704] = u('s'); cdr[1704] = 1703; tag[1704] = atomtag;
+car[1703] = u('w'); cdr[1703] = 0; tag[1703] = atomtag;
+car[1702] = 1701; cdr[1702] = 0; tag[1702] = 0;
+car[1701] = u('f'); cdr[1701] = 1700; tag[1701] = atomtag;
+car[1700] = u('u'); cdr[1700] = 1699; tag[1700] = atomtag;
+car[1699] = u('n'); cdr[1699] = 1698; tag[1699] = atomtag;
+car[1698] = u('a'); cdr[1698] = 1697; tag[1698] = atomtag;
+car[1697] = u('p'); cdr[1697] = 1696; tag[1697] = atomtag;
+car[1696] = u('p'); cdr[1696] = 1695; tag[1696] = atomtag;
+car[1695] = u('-'); cdr[1695] = 1694; tag[1695] = atomtag;
+car[1694] = u('f'); cdr[1694] = 0; tag[1694] = atomtag;
+car[1693] = 1692; cdr[1693] = 0; tag[1693] = 0;
+car[1692] = u('s'); cdr[1692] = 1691; tag[1692] = atomtag;
+car[1691] = u('e'); cdr[1691] = 1690; tag[1691] = atomtag;
+car[1690] = u('l'); cdr[1690] = 1689; tag[1690] = atomtag;
+car[1689] = u('f'); cdr[1689] = 1688; tag[1689] = atomtag;
+car[1688] = u('c'); cdr[1688] = 1687; tag[1688] = atomtag;
+car[1687] = u('o'); cdr[1687] = 1686; tag[1687] = atomtag;
+car[1686] = u('m'); cdr[1686] = 0; tag[1686] = atomtag;
+car[1685] = 1684; cdr[1685] = 0; tag[1685] = 0;
+car[1684] = u('s'); cdr[1684] = 1683; tag[1684] = atomtag;
+car[1683] = u('e'); cdr[1683] = 1682; tag[1683] = atomtag;
+car[1682] = u('l'); cdr[1682] = 1681; tag[1682] = atomtag;
+car[1681] = u('f'); cdr[1681] = 1680; tag[1681] = atomtag;
+car[1680] = u('c'); cdr[1680] = 1679; tag[1680] = atomtag;
+car[1679] = u('a'); cdr[1679] = 1678; tag[1679] = atomtag;
+car[1678] = u('l'); cdr[1678] = 1677; tag[1678] = atomtag;
+car[1677] = u('l'); cdr[1677] = 1676; tag[1677] = atomtag;
+car[1676] = u('p'); cdr[1676] = 0; tag[1676] = atomtag;
+car[1675] = 135; cdr[1675] = 1674; tag[1675] = 0;
+car[1674] = 1223; cdr[1674] = 0; tag[1674] = 0;
+car[1673] = 1672; cdr[1673] = 0; tag[1673] = 0;
+car[1672] = u('k'); cdr[1672] = 1671; tag[1672] = atomtag;
+car[1671] = u(' '); cdr[1671] = 1670; tag[1671] = atomtag;
+car[1670] = u('='); cdr[1670] = 1669; tag[1670] = atomtag;
+car[1669] = u(' '); cdr[1669] = 1668; tag[1669] = atomtag;
+car[1668] = u('r'); cdr[1668] = 1667; tag[1668] = atomtag;
+car[1667] = u('e'); cdr[1667] = 1666; tag[1667] = atomtag;
+car[1666] = u('t'); cdr[1666] = 1665; tag[1666] = atomtag;
+car[1665] = u('n'); cdr[1665] = 1664; tag[1665] = atomtag;
+car[1664] = u('('); cdr[1664] = 1663; tag[1664] = atomtag;
 car[1663] = u(')'); cdr[1663] = 1662; tag[1663] = atomtag;
-car[1662] = u('?'); cdr[1662] = 1661; tag[1662] = atomtag;
+car[1662] = u(';'); cdr[1662] = 1661; tag[1662] = atomtag;
 car[1661] = u(' '); cdr[1661] = 1660; tag[1661] = atomtag;
-car[1660] = u('t'); cdr[1660] = 1659; tag[1660] = atomtag;
+car[1660] = u('b'); cdr[1660] = 1659; tag[1660] = atomtag;
 car[1659] = u('r'); cdr[1659] = 1658; tag[1659] = atomtag;
-car[1658] = u('u'); cdr[1658] = 1657; tag[1658] = atomtag;
-car[1657] = u('e'); cdr[1657] = 1656; tag[1657] = atomtag;
-car[1656] = u(':'); cdr[1656] = 1655; tag[1656] = atomtag;
-car[1655] = u(' '); cdr[1655] = 1654; tag[1655] = atomtag;
-car[1654] = u('n'); cdr[1654] = 1653; tag[1654] = atomtag;
-car[1653] = u('i'); cdr[1653] = 1652; tag[1653] = atomtag;
-car[1652] = u('l'); cdr[1652] = 1651; tag[1652] = atomtag;
-car[1651] = u(';'); cdr[1651] = 0; tag[1651] = atomtag;
-car[1650] = 1649; cdr[1650] = 1632; tag[1650] = 0;
-car[1649] = 1648; cdr[1649] = 1641; tag[1649] = 0;
-car[1648] = 1647; cdr[1648] = 0; tag[1648] = 0;
-car[1647] = u('*'); cdr[1647] = 1646; tag[1647] = atomtag;
-car[1646] = u('a'); cdr[1646] = 1645; tag[1646] = atomtag;
-car[1645] = u('t'); cdr[1645] = 1644; tag[1645] = atomtag;
-car[1644] = u('o'); cdr[1644] = 1643; tag[1644] = atomtag;
-car[1643] = u('m'); cdr[1643] = 1642; tag[1643] = atomtag;
-car[1642] = u('p'); cdr[1642] = 0; tag[1642] = atomtag;
-car[1641] = 1640; cdr[1641] = 0; tag[1641] = 0;
-car[1640] = 1639; cdr[1640] = 0; tag[1640] = 0;
-car[1639] = u('a'); cdr[1639] = 1638; tag[1639] = atomtag;
-car[1638] = u('t'); cdr[1638] = 1637; tag[1638] = atomtag;
-car[1637] = u('o'); cdr[1637] = 1636; tag[1637] = atomtag;
-car[1636] = u('m'); cdr[1636] = 1635; tag[1636] = atomtag;
-car[1635] = u('t'); cdr[1635] = 1634; tag[1635] = atomtag;
-car[1634] = u('a'); cdr[1634] = 1633; tag[1634] = atomtag;
-car[1633] = u('g'); cdr[1633] = 0; tag[1633] = atomtag;
-car[1632] = 1631; cdr[1632] = 1614; tag[1632] = 0;
-car[1631] = 1630; cdr[1631] = 1623; tag[1631] = 0;
-car[1630] = 1629; cdr[1630] = 0; tag[1630] = 0;
-car[1629] = u('*'); cdr[1629] = 1628; tag[1629] = atomtag;
-car[1628] = u('m'); cdr[1628] = 1627; tag[1628] = atomtag;
-car[1627] = u('a'); cdr[1627] = 1626; tag[1627] = atomtag;
-car[1626] = u('r'); cdr[1626] = 1625; tag[1626] = atomtag;
-car[1625] = u('k'); cdr[1625] = 1624; tag[1625] = atomtag;
-car[1624] = u('p'); cdr[1624] = 0; tag[1624] = atomtag;
-car[1623] = 1622; cdr[1623] = 0; tag[1623] = 0;
-car[1622] = 1621; cdr[1622] = 0; tag[1622] = 0;
-car[1621] = u('m'); cdr[1621] = 1620; tag[1621] = atomtag;
-car[1620] = u('a'); cdr[1620] = 1619; tag[1620] = atomtag;
-car[1619] = u('r'); cdr[1619] = 1618; tag[1619] = atomtag;
-car[1618] = u('k'); cdr[1618] = 1617; tag[1618] = atomtag;
-car[1617] = u('t'); cdr[1617] = 1616; tag[1617] = atomtag;
-car[1616] = u('a'); cdr[1616] = 1615; tag[1616] = atomtag;
-car[1615] = u('g'); cdr[1615] = 0; tag[1615] = atomtag;
-car[1614] = 1613; cdr[1614] = 0; tag[1614] = 0;
-car[1613] = 1612; cdr[1613] = 1605; tag[1613] = 0;
-car[1612] = 1611; cdr[1612] = 0; tag[1612] = 0;
-car[1611] = u('*'); cdr[1611] = 1610; tag[1611] = atomtag;
-car[1610] = u('t'); cdr[1610] = 1609; tag[1610] = atomtag;
-car[1609] = u('r'); cdr[1609] = 1608; tag[1609] = atomtag;
-car[1608] = u('a'); cdr[1608] = 1607; tag[1608] = atomtag;
-car[1607] = u('v'); cdr[1607] = 1606; tag[1607] = atomtag;
-car[1606] = u('p'); cdr[1606] = 0; tag[1606] = atomtag;
-car[1605] = 1604; cdr[1605] = 0; tag[1605] = 0;
-car[1604] = 1603; cdr[1604] = 0; tag[1604] = 0;
-car[1603] = u('t'); cdr[1603] = 1602; tag[1603] = atomtag;
-car[1602] = u('r'); cdr[1602] = 1601; tag[1602] = atomtag;
-car[1601] = u('a'); cdr[1601] = 1600; tag[1601] = atomtag;
-car[1600] = u('v'); cdr[1600] = 1599; tag[1600] = atomtag;
-car[1599] = u('t'); cdr[1599] = 1598; tag[1599] = atomtag;
-car[1598] = u('a'); cdr[1598] = 1597; tag[1598] = atomtag;
-car[1597] = u('g'); cdr[1597] = 0; tag[1597] = atomtag;
-car[1596] = 135; cdr[1596] = 0; tag[1596] = 0;
-car[1595] = 1594; cdr[1595] = 0; tag[1595] = 0;
-car[1594] = u('l'); cdr[1594] = 1593; tag[1594] = atomtag;
-car[1593] = u('a'); cdr[1593] = 1592; tag[1593] = atomtag;
-car[1592] = u('b'); cdr[1592] = 1591; tag[1592] = atomtag;
-car[1591] = u('c'); cdr[1591] = 1590; tag[1591] = atomtag;
-car[1590] = u('o'); cdr[1590] = 1589; tag[1590] = atomtag;
-car[1589] = u('m'); cdr[1589] = 0; tag[1589] = atomtag;
-car[1588] = 1587; cdr[1588] = 0; tag[1588] = 0;
-car[1587] = u('p'); cdr[1587] = 1586; tag[1587] = atomtag;
-car[1586] = u('o'); cdr[1586] = 1585; tag[1586] = atomtag;
-car[1585] = u('p'); cdr[1585] = 1584; tag[1585] = atomtag;
-car[1584] = u('('); cdr[1584] = 1583; tag[1584] = atomtag;
-car[1583] = u(')'); cdr[1583] = 1582; tag[1583] = atomtag;
-car[1582] = u(';'); cdr[1582] = 0; tag[1582] = atomtag;
-car[1581] = 1580; cdr[1581] = 0; tag[1581] = 0;
-car[1580] = u('r'); cdr[1580] = 1579; tag[1580] = atomtag;
-car[1579] = u('e'); cdr[1579] = 1578; tag[1579] = atomtag;
-car[1578] = u('f'); cdr[1578] = 1577; tag[1578] = atomtag;
-car[1577] = u('('); cdr[1577] = 1576; tag[1577] = atomtag;
-car[1576] = u('e'); cdr[1576] = 1575; tag[1576] = atomtag;
-car[1575] = u('x'); cdr[1575] = 1574; tag[1575] = atomtag;
-car[1574] = u('p'); cdr[1574] = 1573; tag[1574] = atomtag;
-car[1573] = u('r'); cdr[1573] = 1572; tag[1573] = atomtag;
-car[1572] = u(')'); cdr[1572] = 1571; tag[1572] = atomtag;
-car[1571] = u(' '); cdr[1571] = 1570; tag[1571] = atomtag;
-car[1570] = u('='); cdr[1570] = 1569; tag[1570] = atomtag;
-car[1569] = u(' '); cdr[1569] = 1568; tag[1569] = atomtag;
-car[1568] = u('c'); cdr[1568] = 1567; tag[1568] = atomtag;
-car[1567] = u('o'); cdr[1567] = 1566; tag[1567] = atomtag;
-car[1566] = u('n'); cdr[1566] = 1565; tag[1566] = atomtag;
-car[1565] = u('s'); cdr[1565] = 1564; tag[1565] = atomtag;
-car[1564] = u('3'); cdr[1564] = 1563; tag[1564] = atomtag;
-car[1563] = u('('); cdr[1563] = 0; tag[1563] = atomtag;
-car[1562] = 1561; cdr[1562] = 0; tag[1562] = 0;
-car[1561] = u(','); cdr[1561] = 1560; tag[1561] = atomtag;
-car[1560] = u(' '); cdr[1560] = 1559; tag[1560] = atomtag;
-car[1559] = u('v'); cdr[1559] = 1558; tag[1559] = atomtag;
-car[1558] = u('a'); cdr[1558] = 1557; tag[1558] = atomtag;
-car[1557] = u('l'); cdr[1557] = 1556; tag[1557] = atomtag;
-car[1556] = u('('); cdr[1556] = 0; tag[1556] = atomtag;
-car[1555] = 1554; cdr[1555] = 0; tag[1555] = 0;
-car[1554] = u(')'); cdr[1554] = 1553; tag[1554] = atomtag;
-car[1553] = u(','); cdr[1553] = 1552; tag[1553] = atomtag;
-car[1552] = u(' '); cdr[1552] = 1551; tag[1552] = atomtag;
-car[1551] = u('0'); cdr[1551] = 1550; tag[1551] = atomtag;
-car[1550] = u(')'); cdr[1550] = 1549; tag[1550] = atomtag;
-car[1549] = u(';'); cdr[1549] = 0; tag[1549] = atomtag;
-car[1548] = 1547; cdr[1548] = 0; tag[1548] = 0;
-car[1547] = u('l'); cdr[1547] = 1546; tag[1547] = atomtag;
-car[1546] = u('a'); cdr[1546] = 1545; tag[1546] = atomtag;
-car[1545] = u('b'); cdr[1545] = 1544; tag[1545] = atomtag;
-car[1544] = u('c'); cdr[1544] = 1543; tag[1544] = atomtag;
-car[1543] = u('o'); cdr[1543] = 1542; tag[1543] = atomtag;
-car[1542] = u('m'); cdr[1542] = 1541; tag[1542] = atomtag;
-car[1541] = u('-'); cdr[1541] = 1540; tag[1541] = atomtag;
-car[1540] = u('t'); cdr[1540] = 1539; tag[1540] = atomtag;
-car[1539] = u('m'); cdr[1539] = 1538; tag[1539] = atomtag;
-car[1538] = u('p'); cdr[1538] = 0; tag[1538] = atomtag;
+car[1658] = u('e'); cdr[1658] = 1657; tag[1658] = atomtag;
+car[1657] = u('a'); cdr[1657] = 1656; tag[1657] = atomtag;
+car[1656] = u('k'); cdr[1656] = 1655; tag[1656] = atomtag;
+car[1655] = u(';'); cdr[1655] = 0; tag[1655] = atomtag;
+car[1654] = 1653; cdr[1654] = 0; tag[1654] = 0;
+car[1653] = u('u'); cdr[1653] = 1652; tag[1653] = atomtag;
+car[1652] = u('n'); cdr[1652] = 1651; tag[1652] = atomtag;
+car[1651] = u('b'); cdr[1651] = 1650; tag[1651] = atomtag;
+car[1650] = u('i'); cdr[1650] = 1649; tag[1650] = atomtag;
+car[1649] = u('n'); cdr[1649] = 1648; tag[1649] = atomtag;
+car[1648] = u('d'); cdr[1648] = 1647; tag[1648] = atomtag;
+car[1647] = u('('); cdr[1647] = 1646; tag[1647] = atomtag;
+car[1646] = u(')'); cdr[1646] = 1645; tag[1646] = atomtag;
+car[1645] = u(';'); cdr[1645] = 0; tag[1645] = atomtag;
+car[1644] = 1643; cdr[1644] = 0; tag[1644] = 0;
+car[1643] = u('b'); cdr[1643] = 1642; tag[1643] = atomtag;
+car[1642] = u('i'); cdr[1642] = 1641; tag[1642] = atomtag;
+car[1641] = u('n'); cdr[1641] = 1640; tag[1641] = atomtag;
+car[1640] = u('d'); cdr[1640] = 1639; tag[1640] = atomtag;
+car[1639] = u('('); cdr[1639] = 0; tag[1639] = atomtag;
+car[1638] = 1637; cdr[1638] = 0; tag[1638] = 0;
+car[1637] = u('l'); cdr[1637] = 1636; tag[1637] = atomtag;
+car[1636] = u('a'); cdr[1636] = 1635; tag[1636] = atomtag;
+car[1635] = u('b'); cdr[1635] = 1634; tag[1635] = atomtag;
+car[1634] = u('e'); cdr[1634] = 1633; tag[1634] = atomtag;
+car[1633] = u('l'); cdr[1633] = 1632; tag[1633] = atomtag;
+car[1632] = u('('); cdr[1632] = 0; tag[1632] = atomtag;
+car[1631] = 1630; cdr[1631] = 0; tag[1631] = 0;
+car[1630] = u('g'); cdr[1630] = 1629; tag[1630] = atomtag;
+car[1629] = u('o'); cdr[1629] = 1628; tag[1629] = atomtag;
+car[1628] = u('t'); cdr[1628] = 1627; tag[1628] = atomtag;
+car[1627] = u('o'); cdr[1627] = 1626; tag[1627] = atomtag;
+car[1626] = u('('); cdr[1626] = 0; tag[1626] = atomtag;
+car[1625] = 1624; cdr[1625] = 0; tag[1625] = 0;
+car[1624] = u('s'); cdr[1624] = 1623; tag[1624] = atomtag;
+car[1623] = u('e'); cdr[1623] = 1622; tag[1623] = atomtag;
+car[1622] = u('l'); cdr[1622] = 1621; tag[1622] = atomtag;
+car[1621] = u('f'); cdr[1621] = 1620; tag[1621] = atomtag;
+car[1620] = u('l'); cdr[1620] = 1619; tag[1620] = atomtag;
+car[1619] = u('b'); cdr[1619] = 1618; tag[1619] = atomtag;
+car[1618] = u('l'); cdr[1618] = 0; tag[1618] = atomtag;
+car[1617] = 1616; cdr[1617] = 0; tag[1617] = 0;
+car[1616] = u('s'); cdr[1616] = 1615; tag[1616] = atomtag;
+car[1615] = u('k'); cdr[1615] = 1614; tag[1615] = atomtag;
+car[1614] = u('i'); cdr[1614] = 1613; tag[1614] = atomtag;
+car[1613] = u('p'); cdr[1613] = 0; tag[1613] = atomtag;
+car[1612] = 135; cdr[1612] = 1611; tag[1612] = 0;
+car[1611] = 1532; cdr[1611] = 0; tag[1611] = 0;
+car[1610] = 1609; cdr[1610] = 0; tag[1610] = 0;
+car[1609] = u('f'); cdr[1609] = 1608; tag[1609] = atomtag;
+car[1608] = u('u'); cdr[1608] = 1607; tag[1608] = atomtag;
+car[1607] = u('n'); cdr[1607] = 1606; tag[1607] = atomtag;
+car[1606] = u('c'); cdr[1606] = 1605; tag[1606] = atomtag;
+car[1605] = u('o'); cdr[1605] = 1604; tag[1605] = atomtag;
+car[1604] = u('m'); cdr[1604] = 1603; tag[1604] = atomtag;
+car[1603] = u('-'); cdr[1603] = 1602; tag[1603] = atomtag;
+car[1602] = u('s'); cdr[1602] = 1601; tag[1602] = atomtag;
+car[1601] = u('w'); cdr[1601] = 0; tag[1601] = atomtag;
+car[1600] = 135; cdr[1600] = 1599; tag[1600] = 0;
+car[1599] = 1532; cdr[1599] = 0; tag[1599] = 0;
+car[1598] = 1597; cdr[1598] = 0; tag[1598] = 0;
+car[1597] = u('a'); cdr[1597] = 1596; tag[1597] = atomtag;
+car[1596] = u('s'); cdr[1596] = 1595; tag[1596] = atomtag;
+car[1595] = u('p'); cdr[1595] = 1594; tag[1595] = atomtag;
+car[1594] = u(' '); cdr[1594] = 1593; tag[1594] = atomtag;
+car[1593] = u('='); cdr[1593] = 1592; tag[1593] = atomtag;
+car[1592] = u(' '); cdr[1592] = 1591; tag[1592] = atomtag;
+car[1591] = u('a'); cdr[1591] = 1590; tag[1591] = atomtag;
+car[1590] = u(';'); cdr[1590] = 0; tag[1590] = atomtag;
+car[1589] = 1588; cdr[1589] = 0; tag[1589] = 0;
+car[1588] = u('s'); cdr[1588] = 1587; tag[1588] = atomtag;
+car[1587] = u('e'); cdr[1587] = 1586; tag[1587] = atomtag;
+car[1586] = u('l'); cdr[1586] = 1585; tag[1586] = atomtag;
+car[1585] = u('f'); cdr[1585] = 1584; tag[1585] = atomtag;
+car[1584] = u(':'); cdr[1584] = 0; tag[1584] = atomtag;
+car[1583] = 1582; cdr[1583] = 0; tag[1583] = 0;
+car[1582] = u('h'); cdr[1582] = 1581; tag[1582] = atomtag;
+car[1581] = u('e'); cdr[1581] = 1580; tag[1581] = atomtag;
+car[1580] = u('a'); cdr[1580] = 1579; tag[1580] = atomtag;
+car[1579] = u('d'); cdr[1579] = 0; tag[1579] = atomtag;
+car[1578] = 1577; cdr[1578] = 0; tag[1578] = 0;
+car[1577] = u('v'); cdr[1577] = 1576; tag[1577] = atomtag;
+car[1576] = u('o'); cdr[1576] = 1575; tag[1576] = atomtag;
+car[1575] = u('i'); cdr[1575] = 1574; tag[1575] = atomtag;
+car[1574] = u('d'); cdr[1574] = 1573; tag[1574] = atomtag;
+car[1573] = u(' '); cdr[1573] = 1572; tag[1573] = atomtag;
+car[1572] = u('f'); cdr[1572] = 0; tag[1572] = atomtag;
+car[1571] = 1570; cdr[1571] = 0; tag[1571] = 0;
+car[1570] = u('('); cdr[1570] = 1569; tag[1570] = atomtag;
+car[1569] = u('c'); cdr[1569] = 1568; tag[1569] = atomtag;
+car[1568] = u('e'); cdr[1568] = 1567; tag[1568] = atomtag;
+car[1567] = u('l'); cdr[1567] = 1566; tag[1567] = atomtag;
+car[1566] = u('l'); cdr[1566] = 1565; tag[1566] = atomtag;
+car[1565] = u(' '); cdr[1565] = 1564; tag[1565] = atomtag;
+car[1564] = u('*'); cdr[1564] = 1563; tag[1564] = atomtag;
+car[1563] = u('a'); cdr[1563] = 1562; tag[1563] = atomtag;
+car[1562] = u(','); cdr[1562] = 1561; tag[1562] = atomtag;
+car[1561] = u(' '); cdr[1561] = 1560; tag[1561] = atomtag;
+car[1560] = u('i'); cdr[1560] = 1559; tag[1560] = atomtag;
+car[1559] = u('n'); cdr[1559] = 1558; tag[1559] = atomtag;
+car[1558] = u('t'); cdr[1558] = 1557; tag[1558] = atomtag;
+car[1557] = u(' '); cdr[1557] = 1556; tag[1557] = atomtag;
+car[1556] = u('n'); cdr[1556] = 1555; tag[1556] = atomtag;
+car[1555] = u(')'); cdr[1555] = 1554; tag[1555] = atomtag;
+car[1554] = u(' '); cdr[1554] = 1553; tag[1554] = atomtag;
+car[1553] = u('{'); cdr[1553] = 0; tag[1553] = atomtag;
+car[1552] = 1551; cdr[1552] = 0; tag[1552] = 0;
+car[1551] = u('s'); cdr[1551] = 1550; tag[1551] = atomtag;
+car[1550] = u('e'); cdr[1550] = 1549; tag[1550] = atomtag;
+car[1549] = u('l'); cdr[1549] = 1548; tag[1549] = atomtag;
+car[1548] = u('f'); cdr[1548] = 1547; tag[1548] = atomtag;
+car[1547] = u('j'); cdr[1547] = 1546; tag[1547] = atomtag;
+car[1546] = u('m'); cdr[1546] = 1545; tag[1546] = atomtag;
+car[1545] = u('p'); cdr[1545] = 0; tag[1545] = atomtag;
+car[1544] = 1543; cdr[1544] = 0; tag[1544] = 0;
+car[1543] = u('s'); cdr[1543] = 1542; tag[1543] = atomtag;
+car[1542] = u('e'); cdr[1542] = 1541; tag[1542] = atomtag;
+car[1541] = u('l'); cdr[1541] = 1540; tag[1541] = atomtag;
+car[1540] = u('f'); cdr[1540] = 0; tag[1540] = atomtag;
+car[1539] = 135; cdr[1539] = 1538; tag[1539] = 0;
+car[1538] = 1537; cdr[1538] = 1533; tag[1538] = 0;
 car[1537] = 1536; cdr[1537] = 0; tag[1537] = 0;
-car[1536] = u('l'); cdr[1536] = 1535; tag[1536] = atomtag;
-car[1535] = u('a'); cdr[1535] = 1534; tag[1535] = atomtag;
-car[1534] = u('b'); cdr[1534] = 1533; tag[1534] = atomtag;
-car[1533] = u('e'); cdr[1533] = 1532; tag[1533] = atomtag;
-car[1532] = u('l'); cdr[1532] = 1531; tag[1532] = atomtag;
-car[1531] = u(':'); cdr[1531] = 1530; tag[1531] = atomtag;
-car[1530] = u(' '); cdr[1530] = 1529; tag[1530] = atomtag;
-car[1529] = u('e'); cdr[1529] = 1528; tag[1529] = atomtag;
-car[1528] = u('x'); cdr[1528] = 1527; tag[1528] = atomtag;
-car[1527] = u('p'); cdr[1527] = 1526; tag[1527] = atomtag;
-car[1526] = u('e'); cdr[1526] = 1525; tag[1526] = atomtag;
-car[1525] = u('c'); cdr[1525] = 1524; tag[1525] = atomtag;
-car[1524] = u('t'); cdr[1524] = 1523; tag[1524] = atomtag;
-car[1523] = u('e'); cdr[1523] = 1522; tag[1523] = atomtag;
-car[1522] = u('d'); cdr[1522] = 1521; tag[1522] = atomtag;
-car[1521] = u(' '); cdr[1521] = 1520; tag[1521] = atomtag;
-car[1520] = u('v'); cdr[1520] = 1519; tag[1520] = atomtag;
-car[1519] = u('a'); cdr[1519] = 1518; tag[1519] = atomtag;
-car[1518] = u('r'); cdr[1518] = 1517; tag[1518] = atomtag;
-car[1517] = u('i'); cdr[1517] = 1516; tag[1517] = atomtag;
-car[1516] = u('a'); cdr[1516] = 1515; tag[1516] = atomtag;
-car[1515] = u('b'); cdr[1515] = 1514; tag[1515] = atomtag;
-car[1514] = u('l'); cdr[1514] = 1513; tag[1514] = atomtag;
-car[1513] = u('e'); cdr[1513] = 0; tag[1513] = atomtag;
-car[1512] = 135; cdr[1512] = 0; tag[1512] = 0;
-car[1511] = 135; cdr[1511] = 0; tag[1511] = 0;
-car[1510] = 1509; cdr[1510] = 0; tag[1510] = 0;
-car[1509] = u('f'); cdr[1509] = 1508; tag[1509] = atomtag;
-car[1508] = u('u'); cdr[1508] = 1507; tag[1508] = atomtag;
-car[1507] = u('n'); cdr[1507] = 1506; tag[1507] = atomtag;
-car[1506] = u('a'); cdr[1506] = 1505; tag[1506] = atomtag;
-car[1505] = u('p'); cdr[1505] = 1504; tag[1505] = atomtag;
-car[1504] = u('p'); cdr[1504] = 0; tag[1504] = atomtag;
-car[1503] = 1502; cdr[1503] = 0; tag[1503] = 0;
-car[1502] = u('k'); cdr[1502] = 1501; tag[1502] = atomtag;
-car[1501] = u(' '); cdr[1501] = 1500; tag[1501] = atomtag;
-car[1500] = u('='); cdr[1500] = 1499; tag[1500] = atomtag;
-car[1499] = u(' '); cdr[1499] = 1498; tag[1499] = atomtag;
-car[1498] = u('a'); cdr[1498] = 1497; tag[1498] = atomtag;
-car[1497] = u('p'); cdr[1497] = 1496; tag[1497] = atomtag;
-car[1496] = u('p'); cdr[1496] = 1495; tag[1496] = atomtag;
-car[1495] = u('l'); cdr[1495] = 1494; tag[1495] = atomtag;
-car[1494] = u('y'); cdr[1494] = 1493; tag[1494] = atomtag;
-car[1493] = u('('); cdr[1493] = 0; tag[1493] = atomtag;
-car[1492] = 1491; cdr[1492] = 0; tag[1492] = 0;
-car[1491] = u(')'); cdr[1491] = 1490; tag[1491] = atomtag;
-car[1490] = u(';'); cdr[1490] = 1489; tag[1490] = atomtag;
-car[1489] = u(' '); cdr[1489] = 1488; tag[1489] = atomtag;
-car[1488] = u('b'); cdr[1488] = 1487; tag[1488] = atomtag;
-car[1487] = u('r'); cdr[1487] = 1486; tag[1487] = atomtag;
-car[1486] = u('e'); cdr[1486] = 1485; tag[1486] = atomtag;
-car[1485] = u('a'); cdr[1485] = 1484; tag[1485] = atomtag;
-car[1484] = u('k'); cdr[1484] = 1483; tag[1484] = atomtag;
-car[1483] = u(';'); cdr[1483] = 0; tag[1483] = atomtag;
+car[1536] = u('f'); cdr[1536] = 1535; tag[1536] = atomtag;
+car[1535] = u('u'); cdr[1535] = 1534; tag[1535] = atomtag;
+car[1534] = u('n'); cdr[1534] = 0; tag[1534] = atomtag;
+car[1533] = 1532; cdr[1533] = 0; tag[1533] = 0;
+car[1532] = 1531; cdr[1532] = 0; tag[1532] = 0;
+car[1531] = u('n'); cdr[1531] = 1530; tag[1531] = atomtag;
+car[1530] = u('a'); cdr[1530] = 1529; tag[1530] = atomtag;
+car[1529] = u('m'); cdr[1529] = 1528; tag[1529] = atomtag;
+car[1528] = u('e'); cdr[1528] = 0; tag[1528] = atomtag;
+car[1527] = 1526; cdr[1527] = 0; tag[1527] = 0;
+car[1526] = u('u'); cdr[1526] = 1525; tag[1526] = atomtag;
+car[1525] = u('n'); cdr[1525] = 1524; tag[1525] = atomtag;
+car[1524] = u('b'); cdr[1524] = 1523; tag[1524] = atomtag;
+car[1523] = u('i'); cdr[1523] = 1522; tag[1523] = atomtag;
+car[1522] = u('n'); cdr[1522] = 1521; tag[1522] = atomtag;
+car[1521] = u('d'); cdr[1521] = 1520; tag[1521] = atomtag;
+car[1520] = u('c'); cdr[1520] = 1519; tag[1520] = atomtag;
+car[1519] = u('o'); cdr[1519] = 1518; tag[1519] = atomtag;
+car[1518] = u('m'); cdr[1518] = 0; tag[1518] = atomtag;
+car[1517] = 1516; cdr[1517] = 0; tag[1517] = 0;
+car[1516] = u('u'); cdr[1516] = 1515; tag[1516] = atomtag;
+car[1515] = u('n'); cdr[1515] = 1514; tag[1515] = atomtag;
+car[1514] = u('b'); cdr[1514] = 1513; tag[1514] = atomtag;
+car[1513] = u('i'); cdr[1513] = 1512; tag[1513] = atomtag;
+car[1512] = u('n'); cdr[1512] = 1511; tag[1512] = atomtag;
+car[1511] = u('d'); cdr[1511] = 1510; tag[1511] = atomtag;
+car[1510] = u('a'); cdr[1510] = 1509; tag[1510] = atomtag;
+car[1509] = u('r'); cdr[1509] = 1508; tag[1509] = atomtag;
+car[1508] = u('g'); cdr[1508] = 1507; tag[1508] = atomtag;
+car[1507] = u('('); cdr[1507] = 0; tag[1507] = atomtag;
+car[1506] = 909; cdr[1506] = 1505; tag[1506] = 0;
+car[1505] = 689; cdr[1505] = 0; tag[1505] = 0;
+car[1504] = 1503; cdr[1504] = 0; tag[1504] = 0;
+car[1503] = u('u'); cdr[1503] = 1502; tag[1503] = atomtag;
+car[1502] = u('n'); cdr[1502] = 1501; tag[1502] = atomtag;
+car[1501] = u('b'); cdr[1501] = 1500; tag[1501] = atomtag;
+car[1500] = u('i'); cdr[1500] = 1499; tag[1500] = atomtag;
+car[1499] = u('n'); cdr[1499] = 1498; tag[1499] = atomtag;
+car[1498] = u('d'); cdr[1498] = 1497; tag[1498] = atomtag;
+car[1497] = u('a'); cdr[1497] = 1496; tag[1497] = atomtag;
+car[1496] = u('r'); cdr[1496] = 1495; tag[1496] = atomtag;
+car[1495] = u('g'); cdr[1495] = 1494; tag[1495] = atomtag;
+car[1494] = u('('); cdr[1494] = 1493; tag[1494] = atomtag;
+car[1493] = u('0'); cdr[1493] = 1492; tag[1493] = atomtag;
+car[1492] = u(','); cdr[1492] = 1491; tag[1492] = atomtag;
+car[1491] = u(' '); cdr[1491] = 0; tag[1491] = atomtag;
+car[1490] = 1489; cdr[1490] = 0; tag[1490] = 0;
+car[1489] = u('b'); cdr[1489] = 1488; tag[1489] = atomtag;
+car[1488] = u('i'); cdr[1488] = 1487; tag[1488] = atomtag;
+car[1487] = u('n'); cdr[1487] = 1486; tag[1487] = atomtag;
+car[1486] = u('d'); cdr[1486] = 1485; tag[1486] = atomtag;
+car[1485] = u('c'); cdr[1485] = 1484; tag[1485] = atomtag;
+car[1484] = u('o'); cdr[1484] = 1483; tag[1484] = atomtag;
+car[1483] = u('m'); cdr[1483] = 0; tag[1483] = atomtag;
 car[1482] = 1481; cdr[1482] = 0; tag[1482] = 0;
-car[1481] = u('r'); cdr[1481] = 1480; tag[1481] = atomtag;
-car[1480] = u('e'); cdr[1480] = 1479; tag[1480] = atomtag;
-car[1479] = u('t'); cdr[1479] = 0; tag[1479] = atomtag;
-car[1478] = 1477; cdr[1478] = 0; tag[1478] = 0;
-car[1477] = u('k'); cdr[1477] = 1476; tag[1477] = atomtag;
-car[1476] = u(' '); cdr[1476] = 1475; tag[1476] = atomtag;
-car[1475] = u('='); cdr[1475] = 1474; tag[1475] = atomtag;
-car[1474] = u(' '); cdr[1474] = 1473; tag[1474] = atomtag;
-car[1473] = u('a'); cdr[1473] = 1472; tag[1473] = atomtag;
-car[1472] = u('p'); cdr[1472] = 1471; tag[1472] = atomtag;
-car[1471] = u('p'); cdr[1471] = 1470; tag[1471] = atomtag;
-car[1470] = u('l'); cdr[1470] = 1469; tag[1470] = atomtag;
-car[1469] = u('y'); cdr[1469] = 1468; tag[1469] = atomtag;
-car[1468] = u('('); cdr[1468] = 1467; tag[1468] = atomtag;
-car[1467] = u('-'); cdr[1467] = 1466; tag[1467] = atomtag;
-car[1466] = u('1'); cdr[1466] = 1465; tag[1466] = atomtag;
-car[1465] = u(')'); cdr[1465] = 1464; tag[1465] = atomtag;
-car[1464] = u(';'); cdr[1464] = 1463; tag[1464] = atomtag;
-car[1463] = u(' '); cdr[1463] = 1462; tag[1463] = atomtag;
-car[1462] = u('b'); cdr[1462] = 1461; tag[1462] = atomtag;
-car[1461] = u('r'); cdr[1461] = 1460; tag[1461] = atomtag;
-car[1460] = u('e'); cdr[1460] = 1459; tag[1460] = atomtag;
-car[1459] = u('a'); cdr[1459] = 1458; tag[1459] = atomtag;
-car[1458] = u('k'); cdr[1458] = 1457; tag[1458] = atomtag;
-car[1457] = u(';'); cdr[1457] = 0; tag[1457] = atomtag;
-car[1456] = 1455; cdr[1456] = 0; tag[1456] = 0;
-car[1455] = u('t'); cdr[1455] = 1454; tag[1455] = atomtag;
-car[1454] = u('o'); cdr[1454] = 1453; tag[1454] = atomtag;
-car[1453] = u('f'); cdr[1453] = 1452; tag[1453] = atomtag;
-car[1452] = u('r'); cdr[1452] = 1451; tag[1452] = atomtag;
-car[1451] = u('a'); cdr[1451] = 1450; tag[1451] = atomtag;
-car[1450] = u('m'); cdr[1450] = 1449; tag[1450] = atomtag;
-car[1449] = u('e'); cdr[1449] = 1448; tag[1449] = atomtag;
-car[1448] = u('('); cdr[1448] = 1447; tag[1448] = atomtag;
-car[1447] = u(')'); cdr[1447] = 1446; tag[1447] = atomtag;
-car[1446] = u(';'); cdr[1446] = 0; tag[1446] = atomtag;
-car[1445] = 333; cdr[1445] = 0; tag[1445] = 0;
-car[1444] = 1443; cdr[1444] = 0; tag[1444] = 0;
-car[1443] = u('n'); cdr[1443] = 1442; tag[1443] = atomtag;
-car[1442] = u('e'); cdr[1442] = 1441; tag[1442] = atomtag;
-car[1441] = u('w'); cdr[1441] = 1440; tag[1441] = atomtag;
-car[1440] = u('f'); cdr[1440] = 1439; tag[1440] = atomtag;
-car[1439] = u('r'); cdr[1439] = 1438; tag[1439] = atomtag;
-car[1438] = u('a'); cdr[1438] = 1437; tag[1438] = atomtag;
-car[1437] = u('m'); cdr[1437] = 1436; tag[1437] = atomtag;
-car[1436] = u('e'); cdr[1436] = 1435; tag[1436] = atomtag;
-car[1435] = u('('); cdr[1435] = 1434; tag[1435] = atomtag;
-car[1434] = u(')'); cdr[1434] = 1433; tag[1434] = atomtag;
-car[1433] = u(';'); cdr[1433] = 0; tag[1433] = atomtag;
-car[1432] = 135; cdr[1432] = 1431; tag[1432] = 0;
-car[1431] = 1200; cdr[1431] = 0; tag[1431] = 0;
-car[1430] = 1429; cdr[1430] = 0; tag[1430] = 0;
-car[1429] = u('f'); cdr[1429] = 1428; tag[1429] = atomtag;
-car[1428] = u('u'); cdr[1428] = 1427; tag[1428] = atomtag;
+car[1481] = u('b'); cdr[1481] = 1480; tag[1481] = atomtag;
+car[1480] = u('i'); cdr[1480] = 1479; tag[1480] = atomtag;
+car[1479] = u('n'); cdr[1479] = 1478; tag[1479] = atomtag;
+car[1478] = u('d'); cdr[1478] = 1477; tag[1478] = atomtag;
+car[1477] = u('a'); cdr[1477] = 1476; tag[1477] = atomtag;
+car[1476] = u('r'); cdr[1476] = 1475; tag[1476] = atomtag;
+car[1475] = u('g'); cdr[1475] = 1474; tag[1475] = atomtag;
+car[1474] = u('('); cdr[1474] = 0; tag[1474] = atomtag;
+car[1473] = 1472; cdr[1473] = 0; tag[1473] = 0;
+car[1472] = u(','); cdr[1472] = 1471; tag[1472] = atomtag;
+car[1471] = u(' '); cdr[1471] = 0; tag[1471] = atomtag;
+car[1470] = 909; cdr[1470] = 1469; tag[1470] = 0;
+car[1469] = 689; cdr[1469] = 0; tag[1469] = 0;
+car[1468] = 1467; cdr[1468] = 0; tag[1468] = 0;
+car[1467] = u('a'); cdr[1467] = 1466; tag[1467] = atomtag;
+car[1466] = u('r'); cdr[1466] = 1465; tag[1466] = atomtag;
+car[1465] = u('g'); cdr[1465] = 1464; tag[1465] = atomtag;
+car[1464] = u('n'); cdr[1464] = 1463; tag[1464] = atomtag;
+car[1463] = u('('); cdr[1463] = 1462; tag[1463] = atomtag;
+car[1462] = u('n'); cdr[1462] = 1461; tag[1462] = atomtag;
+car[1461] = u(','); cdr[1461] = 1460; tag[1461] = atomtag;
+car[1460] = u(' '); cdr[1460] = 0; tag[1460] = atomtag;
+car[1459] = 1458; cdr[1459] = 0; tag[1459] = 0;
+car[1458] = u('b'); cdr[1458] = 1457; tag[1458] = atomtag;
+car[1457] = u('i'); cdr[1457] = 1456; tag[1457] = atomtag;
+car[1456] = u('n'); cdr[1456] = 1455; tag[1456] = atomtag;
+car[1455] = u('d'); cdr[1455] = 1454; tag[1455] = atomtag;
+car[1454] = u('a'); cdr[1454] = 1453; tag[1454] = atomtag;
+car[1453] = u('r'); cdr[1453] = 1452; tag[1453] = atomtag;
+car[1452] = u('g'); cdr[1452] = 1451; tag[1452] = atomtag;
+car[1451] = u('('); cdr[1451] = 1450; tag[1451] = atomtag;
+car[1450] = u('0'); cdr[1450] = 1449; tag[1450] = atomtag;
+car[1449] = u(','); cdr[1449] = 1448; tag[1449] = atomtag;
+car[1448] = u(' '); cdr[1448] = 0; tag[1448] = atomtag;
+car[1447] = 1446; cdr[1447] = 0; tag[1447] = 0;
+car[1446] = u('r'); cdr[1446] = 1445; tag[1446] = atomtag;
+car[1445] = u('e'); cdr[1445] = 1444; tag[1445] = atomtag;
+car[1444] = u('s'); cdr[1444] = 1443; tag[1444] = atomtag;
+car[1443] = u('t'); cdr[1443] = 1442; tag[1443] = atomtag;
+car[1442] = u('a'); cdr[1442] = 1441; tag[1442] = atomtag;
+car[1441] = u('r'); cdr[1441] = 1440; tag[1441] = atomtag;
+car[1440] = u('g'); cdr[1440] = 1439; tag[1440] = atomtag;
+car[1439] = u('s'); cdr[1439] = 1438; tag[1439] = atomtag;
+car[1438] = u('('); cdr[1438] = 1437; tag[1438] = atomtag;
+car[1437] = u('a'); cdr[1437] = 1436; tag[1437] = atomtag;
+car[1436] = u(','); cdr[1436] = 1435; tag[1436] = atomtag;
+car[1435] = u(' '); cdr[1435] = 1434; tag[1435] = atomtag;
+car[1434] = u('n'); cdr[1434] = 1433; tag[1434] = atomtag;
+car[1433] = u(')'); cdr[1433] = 1432; tag[1433] = atomtag;
+car[1432] = u(';'); cdr[1432] = 0; tag[1432] = atomtag;
+car[1431] = 1430; cdr[1431] = 0; tag[1431] = 0;
+car[1430] = u('a'); cdr[1430] = 1429; tag[1430] = atomtag;
+car[1429] = u('r'); cdr[1429] = 1428; tag[1429] = atomtag;
+car[1428] = u('g'); cdr[1428] = 1427; tag[1428] = atomtag;
 car[1427] = u('n'); cdr[1427] = 1426; tag[1427] = atomtag;
-car[1426] = u('c'); cdr[1426] = 1425; tag[1426] = atomtag;
-car[1425] = u('o'); cdr[1425] = 1424; tag[1425] = atomtag;
-car[1424] = u('m'); cdr[1424] = 0; tag[1424] = atomtag;
-car[1423] = 1422; cdr[1423] = 0; tag[1423] = 0;
-car[1422] = u('r'); cdr[1422] = 1421; tag[1422] = atomtag;
-car[1421] = u('e'); cdr[1421] = 1420; tag[1421] = atomtag;
-car[1420] = u('f'); cdr[1420] = 1419; tag[1420] = atomtag;
-car[1419] = u('('); cdr[1419] = 1418; tag[1419] = atomtag;
-car[1418] = u('e'); cdr[1418] = 1417; tag[1418] = atomtag;
-car[1417] = u('x'); cdr[1417] = 1416; tag[1417] = atomtag;
-car[1416] = u('p'); cdr[1416] = 1415; tag[1416] = atomtag;
-car[1415] = u('r'); cdr[1415] = 1414; tag[1415] = atomtag;
-car[1414] = u(')'); cdr[1414] = 1413; tag[1414] = atomtag;
-car[1413] = u(' '); cdr[1413] = 1412; tag[1413] = atomtag;
-car[1412] = u('='); cdr[1412] = 1411; tag[1412] = atomtag;
-car[1411] = u(' '); cdr[1411] = 1410; tag[1411] = atomtag;
-car[1410] = u('m'); cdr[1410] = 1409; tag[1410] = atomtag;
-car[1409] = u('k'); cdr[1409] = 1408; tag[1409] = atomtag;
-car[1408] = u('f'); cdr[1408] = 1407; tag[1408] = atomtag;
-car[1407] = u('u'); cdr[1407] = 1406; tag[1407] = atomtag;
-car[1406] = u('n'); cdr[1406] = 1405; tag[1406] = atomtag;
-car[1405] = u('('); cdr[1405] = 0; tag[1405] = atomtag;
-car[1404] = 1403; cdr[1404] = 0; tag[1404] = 0;
-car[1403] = u('k'); cdr[1403] = 1402; tag[1403] = atomtag;
+car[1426] = u('('); cdr[1426] = 1425; tag[1426] = atomtag;
+car[1425] = u('n'); cdr[1425] = 1424; tag[1425] = atomtag;
+car[1424] = u(','); cdr[1424] = 1423; tag[1424] = atomtag;
+car[1423] = u(' '); cdr[1423] = 1422; tag[1423] = atomtag;
+car[1422] = u('0'); cdr[1422] = 1421; tag[1422] = atomtag;
+car[1421] = u(')'); cdr[1421] = 1420; tag[1421] = atomtag;
+car[1420] = u(';'); cdr[1420] = 0; tag[1420] = atomtag;
+car[1419] = 1418; cdr[1419] = 0; tag[1419] = 0;
+car[1418] = u('s'); cdr[1418] = 1417; tag[1418] = atomtag;
+car[1417] = u('e'); cdr[1417] = 1416; tag[1417] = atomtag;
+car[1416] = u('t'); cdr[1416] = 1415; tag[1416] = atomtag;
+car[1415] = u('q'); cdr[1415] = 1414; tag[1415] = atomtag;
+car[1414] = u('c'); cdr[1414] = 1413; tag[1414] = atomtag;
+car[1413] = u('o'); cdr[1413] = 1412; tag[1413] = atomtag;
+car[1412] = u('m'); cdr[1412] = 0; tag[1412] = atomtag;
+car[1411] = 1410; cdr[1411] = 0; tag[1411] = 0;
+car[1410] = u('v'); cdr[1410] = 1409; tag[1410] = atomtag;
+car[1409] = u('a'); cdr[1409] = 1408; tag[1409] = atomtag;
+car[1408] = u('l'); cdr[1408] = 1407; tag[1408] = atomtag;
+car[1407] = u('('); cdr[1407] = 0; tag[1407] = atomtag;
+car[1406] = 1405; cdr[1406] = 0; tag[1406] = 0;
+car[1405] = u(')'); cdr[1405] = 1404; tag[1405] = atomtag;
+car[1404] = u(' '); cdr[1404] = 1403; tag[1404] = atomtag;
+car[1403] = u('='); cdr[1403] = 1402; tag[1403] = atomtag;
 car[1402] = u(' '); cdr[1402] = 1401; tag[1402] = atomtag;
-car[1401] = u('='); cdr[1401] = 1400; tag[1401] = atomtag;
-car[1400] = u(' '); cdr[1400] = 1399; tag[1400] = atomtag;
-car[1399] = u('r'); cdr[1399] = 1398; tag[1399] = atomtag;
-car[1398] = u('e'); cdr[1398] = 1397; tag[1398] = atomtag;
-car[1397] = u('t'); cdr[1397] = 1396; tag[1397] = atomtag;
-car[1396] = u('n'); cdr[1396] = 1395; tag[1396] = atomtag;
-car[1395] = u('('); cdr[1395] = 1394; tag[1395] = atomtag;
-car[1394] = u(')'); cdr[1394] = 1393; tag[1394] = atomtag;
-car[1393] = u(';'); cdr[1393] = 1392; tag[1393] = atomtag;
-car[1392] = u(' '); cdr[1392] = 1391; tag[1392] = atomtag;
-car[1391] = u('b'); cdr[1391] = 1390; tag[1391] = atomtag;
-car[1390] = u('r'); cdr[1390] = 1389; tag[1390] = atomtag;
-car[1389] = u('e'); cdr[1389] = 1388; tag[1389] = atomtag;
-car[1388] = u('a'); cdr[1388] = 1387; tag[1388] = atomtag;
-car[1387] = u('k'); cdr[1387] = 1386; tag[1387] = atomtag;
-car[1386] = u(';'); cdr[1386] = 0; tag[1386] = atomtag;
-car[1385] = 1384; cdr[1385] = 0; tag[1385] = 0;
-car[1384] = u('u'); cdr[1384] = 1383; tag[1384] = atomtag;
-car[1383] = u('n'); cdr[1383] = 1382; tag[1383] = atomtag;
-car[1382] = u('b'); cdr[1382] = 1381; tag[1382] = atomtag;
-car[1381] = u('i'); cdr[1381] = 1380; tag[1381] = atomtag;
-car[1380] = u('n'); cdr[1380] = 1379; tag[1380] = atomtag;
-car[1379] = u('d'); cdr[1379] = 1378; tag[1379] = atomtag;
-car[1378] = u('('); cdr[1378] = 1377; tag[1378] = atomtag;
-car[1377] = u(')'); cdr[1377] = 1376; tag[1377] = atomtag;
-car[1376] = u(';'); cdr[1376] = 0; tag[1376] = atomtag;
+car[1401] = u('r'); cdr[1401] = 1400; tag[1401] = atomtag;
+car[1400] = u('e'); cdr[1400] = 1399; tag[1400] = atomtag;
+car[1399] = u('f'); cdr[1399] = 1398; tag[1399] = atomtag;
+car[1398] = u('('); cdr[1398] = 1397; tag[1398] = atomtag;
+car[1397] = u('e'); cdr[1397] = 1396; tag[1397] = atomtag;
+car[1396] = u('x'); cdr[1396] = 1395; tag[1396] = atomtag;
+car[1395] = u('p'); cdr[1395] = 1394; tag[1395] = atomtag;
+car[1394] = u('r'); cdr[1394] = 1393; tag[1394] = atomtag;
+car[1393] = u(')'); cdr[1393] = 1392; tag[1393] = atomtag;
+car[1392] = u(';'); cdr[1392] = 0; tag[1392] = atomtag;
+car[1391] = 1390; cdr[1391] = 0; tag[1391] = 0;
+car[1390] = u('f'); cdr[1390] = 1389; tag[1390] = atomtag;
+car[1389] = u('u'); cdr[1389] = 1388; tag[1389] = atomtag;
+car[1388] = u('n'); cdr[1388] = 1387; tag[1388] = atomtag;
+car[1387] = u('c'); cdr[1387] = 1386; tag[1387] = atomtag;
+car[1386] = u('o'); cdr[1386] = 1385; tag[1386] = atomtag;
+car[1385] = u('m'); cdr[1385] = 0; tag[1385] = atomtag;
+car[1384] = 1383; cdr[1384] = 0; tag[1384] = 0;
+car[1383] = u('s'); cdr[1383] = 1382; tag[1383] = atomtag;
+car[1382] = u('e'); cdr[1382] = 1381; tag[1382] = atomtag;
+car[1381] = u('l'); cdr[1381] = 1380; tag[1381] = atomtag;
+car[1380] = u('f'); cdr[1380] = 1379; tag[1380] = atomtag;
+car[1379] = u('n'); cdr[1379] = 1378; tag[1379] = atomtag;
+car[1378] = u('a'); cdr[1378] = 1377; tag[1378] = atomtag;
+car[1377] = u('m'); cdr[1377] = 1376; tag[1377] = atomtag;
+car[1376] = u('e'); cdr[1376] = 0; tag[1376] = atomtag;
 car[1375] = 1374; cdr[1375] = 0; tag[1375] = 0;
-car[1374] = u('b'); cdr[1374] = 1373; tag[1374] = atomtag;
-car[1373] = u('i'); cdr[1373] = 1372; tag[1373] = atomtag;
-car[1372] = u('n'); cdr[1372] = 1371; tag[1372] = atomtag;
-car[1371] = u('d'); cdr[1371] = 1370; tag[1371] = atomtag;
-car[1370] = u('('); cdr[1370] = 0; tag[1370] = atomtag;
-car[1369] = 1368; cdr[1369] = 0; tag[1369] = 0;
-car[1368] = u('l'); cdr[1368] = 1367; tag[1368] = atomtag;
-car[1367] = u('a'); cdr[1367] = 1366; tag[1367] = atomtag;
-car[1366] = u('b'); cdr[1366] = 1365; tag[1366] = atomtag;
+car[1374] = u('l'); cdr[1374] = 1373; tag[1374] = atomtag;
+car[1373] = u('a'); cdr[1373] = 1372; tag[1373] = atomtag;
+car[1372] = u('m'); cdr[1372] = 1371; tag[1372] = atomtag;
+car[1371] = u('b'); cdr[1371] = 1370; tag[1371] = atomtag;
+car[1370] = u('d'); cdr[1370] = 1369; tag[1370] = atomtag;
+car[1369] = u('a'); cdr[1369] = 1368; tag[1369] = atomtag;
+car[1368] = u('p'); cdr[1368] = 0; tag[1368] = atomtag;
+car[1367] = 1366; cdr[1367] = 0; tag[1367] = 0;
+car[1366] = u('r'); cdr[1366] = 1365; tag[1366] = atomtag;
 car[1365] = u('e'); cdr[1365] = 1364; tag[1365] = atomtag;
-car[1364] = u('l'); cdr[1364] = 1363; tag[1364] = atomtag;
-car[1363] = u('('); cdr[1363] = 0; tag[1363] = atomtag;
-car[1362] = 1361; cdr[1362] = 0; tag[1362] = 0;
-car[1361] = u('g'); cdr[1361] = 1360; tag[1361] = atomtag;
-car[1360] = u('o'); cdr[1360] = 1359; tag[1360] = atomtag;
-car[1359] = u('t'); cdr[1359] = 1358; tag[1359] = atomtag;
-car[1358] = u('o'); cdr[1358] = 1357; tag[1358] = atomtag;
-car[1357] = u('('); cdr[1357] = 0; tag[1357] = atomtag;
-car[1356] = 1355; cdr[1356] = 0; tag[1356] = 0;
-car[1355] = u(')'); cdr[1355] = 1354; tag[1355] = atomtag;
-car[1354] = u(';'); cdr[1354] = 0; tag[1354] = atomtag;
-car[1353] = 1352; cdr[1353] = 0; tag[1353] = 0;
+car[1364] = u('f'); cdr[1364] = 1363; tag[1364] = atomtag;
+car[1363] = u('('); cdr[1363] = 1362; tag[1363] = atomtag;
+car[1362] = u('e'); cdr[1362] = 1361; tag[1362] = atomtag;
+car[1361] = u('x'); cdr[1361] = 1360; tag[1361] = atomtag;
+car[1360] = u('p'); cdr[1360] = 1359; tag[1360] = atomtag;
+car[1359] = u('r'); cdr[1359] = 1358; tag[1359] = atomtag;
+car[1358] = u(')'); cdr[1358] = 1357; tag[1358] = atomtag;
+car[1357] = u(' '); cdr[1357] = 1356; tag[1357] = atomtag;
+car[1356] = u('='); cdr[1356] = 1355; tag[1356] = atomtag;
+car[1355] = u(' '); cdr[1355] = 1354; tag[1355] = atomtag;
+car[1354] = u('m'); cdr[1354] = 1353; tag[1354] = atomtag;
+car[1353] = u('k'); cdr[1353] = 1352; tag[1353] = atomtag;
 car[1352] = u('f'); cdr[1352] = 1351; tag[1352] = atomtag;
 car[1351] = u('u'); cdr[1351] = 1350; tag[1351] = atomtag;
-car[1350] = u('n'); cdr[1350] = 0; tag[1350] = atomtag;
-car[1349] = 1348; cdr[1349] = 0; tag[1349] = 0;
-car[1348] = u('s'); cdr[1348] = 1347; tag[1348] = atomtag;
-car[1347] = u('k'); cdr[1347] = 1346; tag[1347] = atomtag;
-car[1346] = u('i'); cdr[1346] = 1345; tag[1346] = atomtag;
-car[1345] = u('p'); cdr[1345] = 0; tag[1345] = atomtag;
-car[1344] = 135; cdr[1344] = 0; tag[1344] = 0;
-car[1343] = 1342; cdr[1343] = 0; tag[1343] = 0;
-car[1342] = u('s'); cdr[1342] = 1341; tag[1342] = atomtag;
-car[1341] = u('e'); cdr[1341] = 1340; tag[1341] = atomtag;
-car[1340] = u('t'); cdr[1340] = 1339; tag[1340] = atomtag;
-car[1339] = u('q'); cdr[1339] = 1338; tag[1339] = atomtag;
-car[1338] = u('c'); cdr[1338] = 1337; tag[1338] = atomtag;
-car[1337] = u('o'); cdr[1337] = 1336; tag[1337] = atomtag;
-car[1336] = u('m'); cdr[1336] = 0; tag[1336] = atomtag;
-car[1335] = 1334; cdr[1335] = 0; tag[1335] = 0;
-car[1334] = u('v'); cdr[1334] = 1333; tag[1334] = atomtag;
-car[1333] = u('a'); cdr[1333] = 1332; tag[1333] = atomtag;
-car[1332] = u('l'); cdr[1332] = 1331; tag[1332] = atomtag;
-car[1331] = u('('); cdr[1331] = 0; tag[1331] = atomtag;
-car[1330] = 1329; cdr[1330] = 0; tag[1330] = 0;
-car[1329] = u(')'); cdr[1329] = 1328; tag[1329] = atomtag;
-car[1328] = u(' '); cdr[1328] = 1327; tag[1328] = atomtag;
-car[1327] = u('='); cdr[1327] = 1326; tag[1327] = atomtag;
-car[1326] = u(' '); cdr[1326] = 1325; tag[1326] = atomtag;
-car[1325] = u('r'); cdr[1325] = 1324; tag[1325] = atomtag;
-car[1324] = u('e'); cdr[1324] = 1323; tag[1324] = atomtag;
-car[1323] = u('f'); cdr[1323] = 1322; tag[1323] = atomtag;
-car[1322] = u('('); cdr[1322] = 1321; tag[1322] = atomtag;
-car[1321] = u('e'); cdr[1321] = 1320; tag[1321] = atomtag;
-car[1320] = u('x'); cdr[1320] = 1319; tag[1320] = atomtag;
-car[1319] = u('p'); cdr[1319] = 1318; tag[1319] = atomtag;
-car[1318] = u('r'); cdr[1318] = 1317; tag[1318] = atomtag;
-car[1317] = u(')'); cdr[1317] = 1316; tag[1317] = atomtag;
-car[1316] = u(';'); cdr[1316] = 0; tag[1316] = atomtag;
-car[1315] = 1314; cdr[1315] = 0; tag[1315] = 0;
-car[1314] = u('s'); cdr[1314] = 1313; tag[1314] = atomtag;
-car[1313] = u('e'); cdr[1313] = 1312; tag[1313] = atomtag;
-car[1312] = u('t'); cdr[1312] = 1311; tag[1312] = atomtag;
-car[1311] = u('q'); cdr[1311] = 1310; tag[1311] = atomtag;
-car[1310] = u(':'); cdr[1310] = 1309; tag[1310] = atomtag;
-car[1309] = u(' '); cdr[1309] = 1308; tag[1309] = atomtag;
-car[1308] = u('e'); cdr[1308] = 1307; tag[1308] = atomtag;
-car[1307] = u('x'); cdr[1307] = 1306; tag[1307] = atomtag;
-car[1306] = u('p'); cdr[1306] = 1305; tag[1306] = atomtag;
-car[1305] = u('e'); cdr[1305] = 1304; tag[1305] = atomtag;
-car[1304] = u('c'); cdr[1304] = 1303; tag[1304] = atomtag;
-car[1303] = u('t'); cdr[1303] = 1302; tag[1303] = atomtag;
-car[1302] = u('e'); cdr[1302] = 1301; tag[1302] = atomtag;
-car[1301] = u('d'); cdr[1301] = 1300; tag[1301] = atomtag;
-car[1300] = u(' '); cdr[1300] = 1299; tag[1300] = atomtag;
-car[1299] = u('v'); cdr[1299] = 1298; tag[1299] = atomtag;
-car[1298] = u('a'); cdr[1298] = 1297; tag[1298] = atomtag;
-car[1297] = u('r'); cdr[1297] = 1296; tag[1297] = atomtag;
-car[1296] = u('i'); cdr[1296] = 1295; tag[1296] = atomtag;
-car[1295] = u('a'); cdr[1295] = 1294; tag[1295] = atomtag;
-car[1294] = u('b'); cdr[1294] = 1293; tag[1294] = atomtag;
-car[1293] = u('l'); cdr[1293] = 1292; tag[1293] = atomtag;
-car[1292] = u('e'); cdr[1292] = 0; tag[1292] = atomtag;
-car[1291] = 135; cdr[1291] = 0; tag[1291] = 0;
-car[1290] = 1289; cdr[1290] = 0; tag[1290] = 0;
-car[1289] = u('v'); cdr[1289] = 1288; tag[1289] = atomtag;
-car[1288] = u('a'); cdr[1288] = 1287; tag[1288] = atomtag;
-car[1287] = u('r'); cdr[1287] = 1286; tag[1287] = atomtag;
-car[1286] = u('s'); cdr[1286] = 1285; tag[1286] = atomtag;
-car[1285] = u('y'); cdr[1285] = 1284; tag[1285] = atomtag;
-car[1284] = u('m'); cdr[1284] = 1283; tag[1284] = atomtag;
-car[1283] = u('p'); cdr[1283] = 0; tag[1283] = atomtag;
-car[1282] = 135; cdr[1282] = 0; tag[1282] = 0;
-car[1281] = 1280; cdr[1281] = 0; tag[1281] = 0;
-car[1280] = u('}'); cdr[1280] = 0; tag[1280] = atomtag;
-car[1279] = 1278; cdr[1279] = 0; tag[1279] = 0;
-car[1278] = u('c'); cdr[1278] = 1277; tag[1278] = atomtag;
-car[1277] = u('o'); cdr[1277] = 1276; tag[1277] = atomtag;
-car[1276] = u('n'); cdr[1276] = 1275; tag[1276] = atomtag;
-car[1275] = u('d'); cdr[1275] = 1274; tag[1275] = atomtag;
-car[1274] = u('c'); cdr[1274] = 1273; tag[1274] = atomtag;
-car[1273] = u('o'); cdr[1273] = 1272; tag[1273] = atomtag;
-car[1272] = u('m'); cdr[1272] = 0; tag[1272] = atomtag;
-car[1271] = 1270; cdr[1271] = 0; tag[1271] = 0;
-car[1270] = u('}'); cdr[1270] = 1269; tag[1270] = atomtag;
-car[1269] = u(' '); cdr[1269] = 1268; tag[1269] = atomtag;
-car[1268] = u('e'); cdr[1268] = 1267; tag[1268] = atomtag;
-car[1267] = u('l'); cdr[1267] = 1266; tag[1267] = atomtag;
-car[1266] = u('s'); cdr[1266] = 1265; tag[1266] = atomtag;
-car[1265] = u('e'); cdr[1265] = 1264; tag[1265] = atomtag;
-car[1264] = u(' '); cdr[1264] = 1263; tag[1264] = atomtag;
-car[1263] = u('{'); cdr[1263] = 0; tag[1263] = atomtag;
-car[1262] = 1261; cdr[1262] = 0; tag[1262] = 0;
-car[1261] = u('i'); cdr[1261] = 1260; tag[1261] = atomtag;
-car[1260] = u('f'); cdr[1260] = 1259; tag[1260] = atomtag;
-car[1259] = u(' '); cdr[1259] = 1258; tag[1259] = atomtag;
-car[1258] = u('('); cdr[1258] = 1257; tag[1258] = atomtag;
-car[1257] = u('r'); cdr[1257] = 1256; tag[1257] = atomtag;
+car[1350] = u('n'); cdr[1350] = 1349; tag[1350] = atomtag;
+car[1349] = u('('); cdr[1349] = 0; tag[1349] = atomtag;
+car[1348] = 1347; cdr[1348] = 0; tag[1348] = 0;
+car[1347] = u('f'); cdr[1347] = 1346; tag[1347] = atomtag;
+car[1346] = u('u'); cdr[1346] = 1345; tag[1346] = atomtag;
+car[1345] = u('n'); cdr[1345] = 1344; tag[1345] = atomtag;
+car[1344] = u('d'); cdr[1344] = 1343; tag[1344] = atomtag;
+car[1343] = u('e'); cdr[1343] = 1342; tag[1343] = atomtag;
+car[1342] = u('f'); cdr[1342] = 0; tag[1342] = atomtag;
+car[1341] = 1340; cdr[1341] = 0; tag[1341] = 0;
+car[1340] = u(')'); cdr[1340] = 1339; tag[1340] = atomtag;
+car[1339] = u(';'); cdr[1339] = 0; tag[1339] = atomtag;
+car[1338] = 1337; cdr[1338] = 0; tag[1338] = 0;
+car[1337] = u('s'); cdr[1337] = 1336; tag[1337] = atomtag;
+car[1336] = u('e'); cdr[1336] = 1335; tag[1336] = atomtag;
+car[1335] = u('t'); cdr[1335] = 1334; tag[1335] = atomtag;
+car[1334] = u('q'); cdr[1334] = 1333; tag[1334] = atomtag;
+car[1333] = u(':'); cdr[1333] = 1332; tag[1333] = atomtag;
+car[1332] = u(' '); cdr[1332] = 1331; tag[1332] = atomtag;
+car[1331] = u('e'); cdr[1331] = 1330; tag[1331] = atomtag;
+car[1330] = u('x'); cdr[1330] = 1329; tag[1330] = atomtag;
+car[1329] = u('p'); cdr[1329] = 1328; tag[1329] = atomtag;
+car[1328] = u('e'); cdr[1328] = 1327; tag[1328] = atomtag;
+car[1327] = u('c'); cdr[1327] = 1326; tag[1327] = atomtag;
+car[1326] = u('t'); cdr[1326] = 1325; tag[1326] = atomtag;
+car[1325] = u('e'); cdr[1325] = 1324; tag[1325] = atomtag;
+car[1324] = u('d'); cdr[1324] = 1323; tag[1324] = atomtag;
+car[1323] = u(' '); cdr[1323] = 1322; tag[1323] = atomtag;
+car[1322] = u('v'); cdr[1322] = 1321; tag[1322] = atomtag;
+car[1321] = u('a'); cdr[1321] = 1320; tag[1321] = atomtag;
+car[1320] = u('r'); cdr[1320] = 1319; tag[1320] = atomtag;
+car[1319] = u('i'); cdr[1319] = 1318; tag[1319] = atomtag;
+car[1318] = u('a'); cdr[1318] = 1317; tag[1318] = atomtag;
+car[1317] = u('b'); cdr[1317] = 1316; tag[1317] = atomtag;
+car[1316] = u('l'); cdr[1316] = 1315; tag[1316] = atomtag;
+car[1315] = u('e'); cdr[1315] = 0; tag[1315] = atomtag;
+car[1314] = 135; cdr[1314] = 0; tag[1314] = 0;
+car[1313] = 1312; cdr[1313] = 0; tag[1313] = 0;
+car[1312] = u('v'); cdr[1312] = 1311; tag[1312] = atomtag;
+car[1311] = u('a'); cdr[1311] = 1310; tag[1311] = atomtag;
+car[1310] = u('r'); cdr[1310] = 1309; tag[1310] = atomtag;
+car[1309] = u('s'); cdr[1309] = 1308; tag[1309] = atomtag;
+car[1308] = u('y'); cdr[1308] = 1307; tag[1308] = atomtag;
+car[1307] = u('m'); cdr[1307] = 1306; tag[1307] = atomtag;
+car[1306] = u('p'); cdr[1306] = 0; tag[1306] = atomtag;
+car[1305] = 135; cdr[1305] = 0; tag[1305] = 0;
+car[1304] = 1303; cdr[1304] = 0; tag[1304] = 0;
+car[1303] = u('}'); cdr[1303] = 0; tag[1303] = atomtag;
+car[1302] = 1301; cdr[1302] = 0; tag[1302] = 0;
+car[1301] = u('c'); cdr[1301] = 1300; tag[1301] = atomtag;
+car[1300] = u('o'); cdr[1300] = 1299; tag[1300] = atomtag;
+car[1299] = u('n'); cdr[1299] = 1298; tag[1299] = atomtag;
+car[1298] = u('d'); cdr[1298] = 1297; tag[1298] = atomtag;
+car[1297] = u('c'); cdr[1297] = 1296; tag[1297] = atomtag;
+car[1296] = u('o'); cdr[1296] = 1295; tag[1296] = atomtag;
+car[1295] = u('m'); cdr[1295] = 0; tag[1295] = atomtag;
+car[1294] = 1293; cdr[1294] = 0; tag[1294] = 0;
+car[1293] = u('}'); cdr[1293] = 1292; tag[1293] = atomtag;
+car[1292] = u(' '); cdr[1292] = 1291; tag[1292] = atomtag;
+car[1291] = u('e'); cdr[1291] = 1290; tag[1291] = atomtag;
+car[1290] = u('l'); cdr[1290] = 1289; tag[1290] = atomtag;
+car[1289] = u('s'); cdr[1289] = 1288; tag[1289] = atomtag;
+car[1288] = u('e'); cdr[1288] = 1287; tag[1288] = atomtag;
+car[1287] = u(' '); cdr[1287] = 1286; tag[1287] = atomtag;
+car[1286] = u('{'); cdr[1286] = 0; tag[1286] = atomtag;
+car[1285] = 1284; cdr[1285] = 0; tag[1285] = 0;
+car[1284] = u('i'); cdr[1284] = 1283; tag[1284] = atomtag;
+car[1283] = u('f'); cdr[1283] = 1282; tag[1283] = atomtag;
+car[1282] = u(' '); cdr[1282] = 1281; tag[1282] = atomtag;
+car[1281] = u('('); cdr[1281] = 1280; tag[1281] = atomtag;
+car[1280] = u('r'); cdr[1280] = 1279; tag[1280] = atomtag;
+car[1279] = u('e'); cdr[1279] = 1278; tag[1279] = atomtag;
+car[1278] = u('f'); cdr[1278] = 1277; tag[1278] = atomtag;
+car[1277] = u('('); cdr[1277] = 1276; tag[1277] = atomtag;
+car[1276] = u('e'); cdr[1276] = 1275; tag[1276] = atomtag;
+car[1275] = u('x'); cdr[1275] = 1274; tag[1275] = atomtag;
+car[1274] = u('p'); cdr[1274] = 1273; tag[1274] = atomtag;
+car[1273] = u('r'); cdr[1273] = 1272; tag[1273] = atomtag;
+car[1272] = u(')'); cdr[1272] = 1271; tag[1272] = atomtag;
+car[1271] = u(' '); cdr[1271] = 1270; tag[1271] = atomtag;
+car[1270] = u('!'); cdr[1270] = 1269; tag[1270] = atomtag;
+car[1269] = u('='); cdr[1269] = 1268; tag[1269] = atomtag;
+car[1268] = u(' '); cdr[1268] = 1267; tag[1268] = atomtag;
+car[1267] = u('n'); cdr[1267] = 1266; tag[1267] = atomtag;
+car[1266] = u('i'); cdr[1266] = 1265; tag[1266] = atomtag;
+car[1265] = u('l'); cdr[1265] = 1264; tag[1265] = atomtag;
+car[1264] = u(')'); cdr[1264] = 1263; tag[1264] = atomtag;
+car[1263] = u(' '); cdr[1263] = 1262; tag[1263] = atomtag;
+car[1262] = u('{'); cdr[1262] = 0; tag[1262] = atomtag;
+car[1261] = 1260; cdr[1261] = 0; tag[1261] = 0;
+car[1260] = u('r'); cdr[1260] = 1259; tag[1260] = atomtag;
+car[1259] = u('e'); cdr[1259] = 1258; tag[1259] = atomtag;
+car[1258] = u('f'); cdr[1258] = 1257; tag[1258] = atomtag;
+car[1257] = u('('); cdr[1257] = 1256; tag[1257] = atomtag;
 car[1256] = u('e'); cdr[1256] = 1255; tag[1256] = atomtag;
-car[1255] = u('f'); cdr[1255] = 1254; tag[1255] = atomtag;
-car[1254] = u('('); cdr[1254] = 1253; tag[1254] = atomtag;
-car[1253] = u('e'); cdr[1253] = 1252; tag[1253] = atomtag;
-car[1252] = u('x'); cdr[1252] = 1251; tag[1252] = atomtag;
-car[1251] = u('p'); cdr[1251] = 1250; tag[1251] = atomtag;
-car[1250] = u('r'); cdr[1250] = 1249; tag[1250] = atomtag;
-car[1249] = u(')'); cdr[1249] = 1248; tag[1249] = atomtag;
-car[1248] = u(' '); cdr[1248] = 1247; tag[1248] = atomtag;
-car[1247] = u('!'); cdr[1247] = 1246; tag[1247] = atomtag;
-car[1246] = u('='); cdr[1246] = 1245; tag[1246] = atomtag;
-car[1245] = u(' '); cdr[1245] = 1244; tag[1245] = atomtag;
-car[1244] = u('n'); cdr[1244] = 1243; tag[1244] = atomtag;
-car[1243] = u('i'); cdr[1243] = 1242; tag[1243] = atomtag;
-car[1242] = u('l'); cdr[1242] = 1241; tag[1242] = atomtag;
-car[1241] = u(')'); cdr[1241] = 1240; tag[1241] = atomtag;
-car[1240] = u(' '); cdr[1240] = 1239; tag[1240] = atomtag;
-car[1239] = u('{'); cdr[1239] = 0; tag[1239] = atomtag;
-car[1238] = 1237; cdr[1238] = 0; tag[1238] = 0;
-car[1237] = u('r'); cdr[1237] = 1236; tag[1237] = atomtag;
-car[1236] = u('e'); cdr[1236] = 1235; tag[1236] = atomtag;
-car[1235] = u('f'); cdr[1235] = 1234; tag[1235] = atomtag;
-car[1234] = u('('); cdr[1234] = 1233; tag[1234] = atomtag;
-car[1233] = u('e'); cdr[1233] = 1232; tag[1233] = atomtag;
-car[1232] = u('x'); cdr[1232] = 1231; tag[1232] = atomtag;
-car[1231] = u('p'); cdr[1231] = 1230; tag[1231] = atomtag;
-car[1230] = u('r'); cdr[1230] = 1229; tag[1230] = atomtag;
-car[1229] = u(')'); cdr[1229] = 1228; tag[1229] = atomtag;
-car[1228] = u(' '); cdr[1228] = 1227; tag[1228] = atomtag;
-car[1227] = u('='); cdr[1227] = 1226; tag[1227] = atomtag;
-car[1226] = u(' '); cdr[1226] = 1225; tag[1226] = atomtag;
-car[1225] = u('n'); cdr[1225] = 1224; tag[1225] = atomtag;
-car[1224] = u('i'); cdr[1224] = 1223; tag[1224] = atomtag;
-car[1223] = u('l'); cdr[1223] = 1222; tag[1223] = atomtag;
-car[1222] = u(';'); cdr[1222] = 0; tag[1222] = atomtag;
-car[1221] = 135; cdr[1221] = 1220; tag[1221] = 0;
-car[1220] = 1200; cdr[1220] = 0; tag[1220] = 0;
-car[1219] = 1218; cdr[1219] = 0; tag[1219] = 0;
-car[1218] = u('b'); cdr[1218] = 1217; tag[1218] = atomtag;
-car[1217] = u('l'); cdr[1217] = 1216; tag[1217] = atomtag;
-car[1216] = u('o'); cdr[1216] = 1215; tag[1216] = atomtag;
-car[1215] = u('c'); cdr[1215] = 1214; tag[1215] = atomtag;
-car[1214] = u('k'); cdr[1214] = 1213; tag[1214] = atomtag;
-car[1213] = u('c'); cdr[1213] = 1212; tag[1213] = atomtag;
-car[1212] = u('o'); cdr[1212] = 1211; tag[1212] = atomtag;
-car[1211] = u('m'); cdr[1211] = 0; tag[1211] = atomtag;
-car[1210] = 1209; cdr[1210] = 0; tag[1210] = 0;
-car[1209] = u('e'); cdr[1209] = 1208; tag[1209] = atomtag;
-car[1208] = u('x'); cdr[1208] = 1207; tag[1208] = atomtag;
-car[1207] = u('p'); cdr[1207] = 1206; tag[1207] = atomtag;
-car[1206] = u('r'); cdr[1206] = 1205; tag[1206] = atomtag;
-car[1205] = u('c'); cdr[1205] = 1204; tag[1205] = atomtag;
-car[1204] = u('o'); cdr[1204] = 1203; tag[1204] = atomtag;
-car[1203] = u('m'); cdr[1203] = 0; tag[1203] = atomtag;
-car[1202] = 135; cdr[1202] = 1201; tag[1202] = 0;
+car[1255] = u('x'); cdr[1255] = 1254; tag[1255] = atomtag;
+car[1254] = u('p'); cdr[1254] = 1253; tag[1254] = atomtag;
+car[1253] = u('r'); cdr[1253] = 1252; tag[1253] = atomtag;
+car[1252] = u(')'); cdr[1252] = 1251; tag[1252] = atomtag;
+car[1251] = u(' '); cdr[1251] = 1250; tag[1251] = atomtag;
+car[1250] = u('='); cdr[1250] = 1249; tag[1250] = atomtag;
+car[1249] = u(' '); cdr[1249] = 1248; tag[1249] = atomtag;
+car[1248] = u('n'); cdr[1248] = 1247; tag[1248] = atomtag;
+car[1247] = u('i'); cdr[1247] = 1246; tag[1247] = atomtag;
+car[1246] = u('l'); cdr[1246] = 1245; tag[1246] = atomtag;
+car[1245] = u(';'); cdr[1245] = 0; tag[1245] = atomtag;
+car[1244] = 135; cdr[1244] = 1243; tag[1244] = 0;
+car[1243] = 1223; cdr[1243] = 0; tag[1243] = 0;
+car[1242] = 1241; cdr[1242] = 0; tag[1242] = 0;
+car[1241] = u('b'); cdr[1241] = 1240; tag[1241] = atomtag;
+car[1240] = u('l'); cdr[1240] = 1239; tag[1240] = atomtag;
+car[1239] = u('o'); cdr[1239] = 1238; tag[1239] = atomtag;
+car[1238] = u('c'); cdr[1238] = 1237; tag[1238] = atomtag;
+car[1237] = u('k'); cdr[1237] = 1236; tag[1237] = atomtag;
+car[1236] = u('c'); cdr[1236] = 1235; tag[1236] = atomtag;
+car[1235] = u('o'); cdr[1235] = 1234; tag[1235] = atomtag;
+car[1234] = u('m'); cdr[1234] = 0; tag[1234] = atomtag;
+car[1233] = 1232; cdr[1233] = 0; tag[1233] = 0;
+car[1232] = u('e'); cdr[1232] = 1231; tag[1232] = atomtag;
+car[1231] = u('x'); cdr[1231] = 1230; tag[1231] = atomtag;
+car[1230] = u('p'); cdr[1230] = 1229; tag[1230] = atomtag;
+car[1229] = u('r'); cdr[1229] = 1228; tag[1229] = atomtag;
+car[1228] = u('c'); cdr[1228] = 1227; tag[1228] = atomtag;
+car[1227] = u('o'); cdr[1227] = 1226; tag[1227] = atomtag;
+car[1226] = u('m'); cdr[1226] = 0; tag[1226] = atomtag;
+car[1225] = 135; cdr[1225] = 1224; tag[1225] = 0;
+car[1224] = 1223; cdr[1224] = 0; tag[1224] = 0;
+car[1223] = 1222; cdr[1223] = 0; tag[1223] = 0;
+car[1222] = u('t'); cdr[1222] = 1221; tag[1222] = atomtag;
+car[1221] = u('a'); cdr[1221] = 0; tag[1221] = atomtag;
+car[1220] = 1219; cdr[1220] = 0; tag[1220] = 0;
+car[1219] = u('c'); cdr[1219] = 1218; tag[1219] = atomtag;
+car[1218] = u('o'); cdr[1218] = 1217; tag[1218] = atomtag;
+car[1217] = u('n'); cdr[1217] = 1216; tag[1217] = atomtag;
+car[1216] = u('s'); cdr[1216] = 1215; tag[1216] = atomtag;
+car[1215] = u('t'); cdr[1215] = 1214; tag[1215] = atomtag;
+car[1214] = u('a'); cdr[1214] = 1213; tag[1214] = atomtag;
+car[1213] = u('n'); cdr[1213] = 1212; tag[1213] = atomtag;
+car[1212] = u('t'); cdr[1212] = 0; tag[1212] = atomtag;
+car[1211] = 1210; cdr[1211] = 0; tag[1211] = 0;
+car[1210] = u('n'); cdr[1210] = 1209; tag[1210] = atomtag;
+car[1209] = u('o'); cdr[1209] = 0; tag[1209] = atomtag;
+car[1208] = 135; cdr[1208] = 0; tag[1208] = 0;
+car[1207] = 1206; cdr[1207] = 0; tag[1207] = 0;
+car[1206] = u('p'); cdr[1206] = 1205; tag[1206] = atomtag;
+car[1205] = u('u'); cdr[1205] = 1204; tag[1205] = atomtag;
+car[1204] = u('r'); cdr[1204] = 1203; tag[1204] = atomtag;
+car[1203] = u('e'); cdr[1203] = 1202; tag[1203] = atomtag;
+car[1202] = u('p'); cdr[1202] = 0; tag[1202] = atomtag;
 car[1201] = 1200; cdr[1201] = 0; tag[1201] = 0;
-car[1200] = 1199; cdr[1200] = 0; tag[1200] = 0;
-car[1199] = u('t'); cdr[1199] = 1198; tag[1199] = atomtag;
-car[1198] = u('a'); cdr[1198] = 0; tag[1198] = atomtag;
-car[1197] = 1196; cdr[1197] = 0; tag[1197] = 0;
-car[1196] = u('e'); cdr[1196] = 1195; tag[1196] = atomtag;
-car[1195] = u('m'); cdr[1195] = 1194; tag[1195] = atomtag;
-car[1194] = u('i'); cdr[1194] = 1193; tag[1194] = atomtag;
-car[1193] = u('t'); cdr[1193] = 0; tag[1193] = atomtag;
-car[1192] = 135; cdr[1192] = 0; tag[1192] = 0;
-car[1191] = 1190; cdr[1191] = 0; tag[1191] = 0;
-car[1190] = u('a'); cdr[1190] = 1189; tag[1190] = atomtag;
-car[1189] = u('d'); cdr[1189] = 1188; tag[1189] = atomtag;
-car[1188] = u('d'); cdr[1188] = 1187; tag[1188] = atomtag;
-car[1187] = u('-'); cdr[1187] = 1186; tag[1187] = atomtag;
-car[1186] = u('o'); cdr[1186] = 1185; tag[1186] = atomtag;
-car[1185] = u('b'); cdr[1185] = 1184; tag[1185] = atomtag;
-car[1184] = u('j'); cdr[1184] = 1183; tag[1184] = atomtag;
-car[1183] = u('e'); cdr[1183] = 1182; tag[1183] = atomtag;
-car[1182] = u('c'); cdr[1182] = 1181; tag[1182] = atomtag;
-car[1181] = u('t'); cdr[1181] = 0; tag[1181] = atomtag;
-car[1180] = 135; cdr[1180] = 0; tag[1180] = 0;
-car[1179] = 1178; cdr[1179] = 0; tag[1179] = 0;
-car[1178] = u('m'); cdr[1178] = 1177; tag[1178] = atomtag;
-car[1177] = u('a'); cdr[1177] = 1176; tag[1177] = atomtag;
-car[1176] = u('k'); cdr[1176] = 1175; tag[1176] = atomtag;
-car[1175] = u('e'); cdr[1175] = 1174; tag[1175] = atomtag;
-car[1174] = u('-'); cdr[1174] = 1173; tag[1174] = atomtag;
-car[1173] = u('o'); cdr[1173] = 1172; tag[1173] = atomtag;
-car[1172] = u('b'); cdr[1172] = 1171; tag[1172] = atomtag;
-car[1171] = u('j'); cdr[1171] = 1170; tag[1171] = atomtag;
-car[1170] = u('e'); cdr[1170] = 1169; tag[1170] = atomtag;
-car[1169] = u('c'); cdr[1169] = 1168; tag[1169] = atomtag;
-car[1168] = u('t'); cdr[1168] = 0; tag[1168] = atomtag;
-car[1167] = 135; cdr[1167] = 0; tag[1167] = 0;
-car[1166] = 1165; cdr[1166] = 0; tag[1166] = 0;
-car[1165] = u('a'); cdr[1165] = 1164; tag[1165] = atomtag;
-car[1164] = u('d'); cdr[1164] = 1163; tag[1164] = atomtag;
-car[1163] = u('d'); cdr[1163] = 1162; tag[1163] = atomtag;
-car[1162] = u('-'); cdr[1162] = 1161; tag[1162] = atomtag;
-car[1161] = u('a'); cdr[1161] = 1160; tag[1161] = atomtag;
-car[1160] = u('t'); cdr[1160] = 1159; tag[1160] = atomtag;
-car[1159] = u('o'); cdr[1159] = 1158; tag[1159] = atomtag;
-car[1158] = u('m'); cdr[1158] = 0; tag[1158] = atomtag;
-car[1157] = 135; cdr[1157] = 0; tag[1157] = 0;
-car[1156] = 135; cdr[1156] = 0; tag[1156] = 0;
-car[1155] = 1154; cdr[1155] = 0; tag[1155] = 0;
-car[1154] = u('m'); cdr[1154] = 1153; tag[1154] = atomtag;
-car[1153] = u('a'); cdr[1153] = 1152; tag[1153] = atomtag;
-car[1152] = u('k'); cdr[1152] = 1151; tag[1152] = atomtag;
-car[1151] = u('e'); cdr[1151] = 1150; tag[1151] = atomtag;
-car[1150] = u('-'); cdr[1150] = 1149; tag[1150] = atomtag;
-car[1149] = u('a'); cdr[1149] = 1148; tag[1149] = atomtag;
-car[1148] = u('t'); cdr[1148] = 1147; tag[1148] = atomtag;
-car[1147] = u('o'); cdr[1147] = 1146; tag[1147] = atomtag;
-car[1146] = u('m'); cdr[1146] = 0; tag[1146] = atomtag;
-car[1145] = 135; cdr[1145] = 1144; tag[1145] = 0;
-car[1144] = 802; cdr[1144] = 0; tag[1144] = 0;
-car[1143] = 135; cdr[1143] = 0; tag[1143] = 0;
-car[1142] = 1141; cdr[1142] = 0; tag[1142] = 0;
-car[1141] = u('m'); cdr[1141] = 1140; tag[1141] = atomtag;
-car[1140] = u('a'); cdr[1140] = 1139; tag[1140] = atomtag;
-car[1139] = u('k'); cdr[1139] = 1138; tag[1139] = atomtag;
-car[1138] = u('e'); cdr[1138] = 1137; tag[1138] = atomtag;
-car[1137] = u('-'); cdr[1137] = 1136; tag[1137] = atomtag;
-car[1136] = u('c'); cdr[1136] = 1135; tag[1136] = atomtag;
-car[1135] = u('e'); cdr[1135] = 1134; tag[1135] = atomtag;
-car[1134] = u('l'); cdr[1134] = 1133; tag[1134] = atomtag;
-car[1133] = u('l'); cdr[1133] = 0; tag[1133] = atomtag;
-car[1132] = 333; cdr[1132] = 1131; tag[1132] = 0;
-car[1131] = 828; cdr[1131] = 1130; tag[1131] = 0;
-car[1130] = 1129; cdr[1130] = 0; tag[1130] = 0;
-car[1129] = 1128; cdr[1129] = 0; tag[1129] = 0;
-car[1128] = u('t'); cdr[1128] = 1127; tag[1128] = atomtag;
-car[1127] = u('g'); cdr[1127] = 0; tag[1127] = atomtag;
-car[1126] = 1125; cdr[1126] = 0; tag[1126] = 0;
-car[1125] = u('m'); cdr[1125] = 1124; tag[1125] = atomtag;
-car[1124] = u('a'); cdr[1124] = 1123; tag[1124] = atomtag;
-car[1123] = u('k'); cdr[1123] = 1122; tag[1123] = atomtag;
-car[1122] = u('e'); cdr[1122] = 1121; tag[1122] = atomtag;
-car[1121] = u('-'); cdr[1121] = 1120; tag[1121] = atomtag;
-car[1120] = u('l'); cdr[1120] = 1119; tag[1120] = atomtag;
-car[1119] = u('a'); cdr[1119] = 1118; tag[1119] = atomtag;
-car[1118] = u('b'); cdr[1118] = 1117; tag[1118] = atomtag;
-car[1117] = u('e'); cdr[1117] = 1116; tag[1117] = atomtag;
-car[1116] = u('l'); cdr[1116] = 0; tag[1116] = atomtag;
-car[1115] = 1114; cdr[1115] = 0; tag[1115] = 0;
-car[1114] = u('l'); cdr[1114] = 1113; tag[1114] = atomtag;
-car[1113] = u('b'); cdr[1113] = 1112; tag[1113] = atomtag;
-car[1112] = u('l'); cdr[1112] = 0; tag[1112] = atomtag;
-car[1111] = 773; cdr[1111] = 0; tag[1111] = 0;
-car[1110] = 1109; cdr[1110] = 0; tag[1110] = 0;
-car[1109] = u('o'); cdr[1109] = 1108; tag[1109] = atomtag;
-car[1108] = u('b'); cdr[1108] = 1107; tag[1108] = atomtag;
-car[1107] = u('l'); cdr[1107] = 1106; tag[1107] = atomtag;
-car[1106] = u('i'); cdr[1106] = 1105; tag[1106] = atomtag;
-car[1105] = u('s'); cdr[1105] = 1104; tag[1105] = atomtag;
-car[1104] = u('t'); cdr[1104] = 0; tag[1104] = atomtag;
-car[1103] = 1102; cdr[1103] = 0; tag[1103] = 0;
-car[1102] = u('s'); cdr[1102] = 1101; tag[1102] = atomtag;
-car[1101] = u('y'); cdr[1101] = 1100; tag[1101] = atomtag;
-car[1100] = u('m'); cdr[1100] = 1099; tag[1100] = atomtag;
-car[1099] = u('l'); cdr[1099] = 1098; tag[1099] = atomtag;
-car[1098] = u('i'); cdr[1098] = 1097; tag[1098] = atomtag;
-car[1097] = u('s'); cdr[1097] = 0; tag[1097] = atomtag;
-car[1096] = 1; cdr[1096] = 1095; tag[1096] = 0;
-car[1095] = 770; cdr[1095] = 0; tag[1095] = 0;
-car[1094] = 1093; cdr[1094] = 0; tag[1094] = 0;
-car[1093] = u('c'); cdr[1093] = 1092; tag[1093] = atomtag;
-car[1092] = u('e'); cdr[1092] = 1091; tag[1092] = atomtag;
-car[1091] = u('l'); cdr[1091] = 1090; tag[1091] = atomtag;
-car[1090] = u('l'); cdr[1090] = 1089; tag[1090] = atomtag;
-car[1089] = u('s'); cdr[1089] = 0; tag[1089] = atomtag;
-car[1088] = 1087; cdr[1088] = 0; tag[1088] = 0;
-car[1087] = u('n'); cdr[1087] = 1086; tag[1087] = atomtag;
-car[1086] = u('u'); cdr[1086] = 1085; tag[1086] = atomtag;
-car[1085] = u('m'); cdr[1085] = 1084; tag[1085] = atomtag;
-car[1084] = u('b'); cdr[1084] = 1083; tag[1084] = atomtag;
-car[1083] = u('e'); cdr[1083] = 1082; tag[1083] = atomtag;
-car[1082] = u('r'); cdr[1082] = 0; tag[1082] = atomtag;
-car[1081] = 1080; cdr[1081] = 0; tag[1081] = 0;
-car[1080] = u('i'); cdr[1080] = 1079; tag[1080] = atomtag;
-car[1079] = u('n'); cdr[1079] = 1078; tag[1079] = atomtag;
-car[1078] = u('c'); cdr[1078] = 1077; tag[1078] = atomtag;
-car[1077] = u('r'); cdr[1077] = 0; tag[1077] = atomtag;
-car[1076] = 1075; cdr[1076] = 0; tag[1076] = 0;
-car[1075] = u('i'); cdr[1075] = 1074; tag[1075] = atomtag;
-car[1074] = u('n'); cdr[1074] = 1073; tag[1074] = atomtag;
-car[1073] = u('c'); cdr[1073] = 1072; tag[1073] = atomtag;
-car[1072] = u('r'); cdr[1072] = 1071; tag[1072] = atomtag;
-car[1071] = u('-'); cdr[1071] = 1070; tag[1071] = atomtag;
-car[1070] = u('t'); cdr[1070] = 1069; tag[1070] = atomtag;
-car[1069] = u('m'); cdr[1069] = 1068; tag[1069] = atomtag;
-car[1068] = u('p'); cdr[1068] = 0; tag[1068] = atomtag;
-car[1067] = 135; cdr[1067] = 1066; tag[1067] = 0;
-car[1066] = 521; cdr[1066] = 1065; tag[1066] = 0;
-car[1065] = 153; cdr[1065] = 0; tag[1065] = 0;
-car[1064] = 135; cdr[1064] = 0; tag[1064] = 0;
-car[1063] = 1062; cdr[1063] = 0; tag[1063] = 0;
-car[1062] = u('s'); cdr[1062] = 1061; tag[1062] = atomtag;
-car[1061] = u('u'); cdr[1061] = 1060; tag[1061] = atomtag;
-car[1060] = u('c'); cdr[1060] = 1059; tag[1060] = atomtag;
-car[1059] = u('c'); cdr[1059] = 0; tag[1059] = atomtag;
-car[1058] = 1057; cdr[1058] = 1055; tag[1058] = 0;
-car[1057] = 773; cdr[1057] = 1056; tag[1057] = 0;
-car[1056] = 770; cdr[1056] = 0; tag[1056] = 0;
-car[1055] = 1054; cdr[1055] = 1052; tag[1055] = 0;
-car[1054] = 770; cdr[1054] = 1053; tag[1054] = 0;
-car[1053] = 767; cdr[1053] = 0; tag[1053] = 0;
-car[1052] = 1051; cdr[1052] = 1049; tag[1052] = 0;
-car[1051] = 767; cdr[1051] = 1050; tag[1051] = 0;
-car[1050] = 764; cdr[1050] = 0; tag[1050] = 0;
-car[1049] = 1048; cdr[1049] = 1046; tag[1049] = 0;
-car[1048] = 764; cdr[1048] = 1047; tag[1048] = 0;
-car[1047] = 761; cdr[1047] = 0; tag[1047] = 0;
-car[1046] = 1045; cdr[1046] = 1043; tag[1046] = 0;
-car[1045] = 761; cdr[1045] = 1044; tag[1045] = 0;
-car[1044] = 758; cdr[1044] = 0; tag[1044] = 0;
-car[1043] = 1042; cdr[1043] = 1040; tag[1043] = 0;
-car[1042] = 758; cdr[1042] = 1041; tag[1042] = 0;
-car[1041] = 755; cdr[1041] = 0; tag[1041] = 0;
-car[1040] = 1039; cdr[1040] = 1037; tag[1040] = 0;
-car[1039] = 755; cdr[1039] = 1038; tag[1039] = 0;
-car[1038] = 752; cdr[1038] = 0; tag[1038] = 0;
-car[1037] = 1036; cdr[1037] = 1034; tag[1037] = 0;
-car[1036] = 752; cdr[1036] = 1035; tag[1036] = 0;
-car[1035] = 749; cdr[1035] = 0; tag[1035] = 0;
-car[1034] = 1033; cdr[1034] = 1031; tag[1034] = 0;
-car[1033] = 749; cdr[1033] = 1032; tag[1033] = 0;
-car[1032] = 746; cdr[1032] = 0; tag[1032] = 0;
-car[1031] = 1030; cdr[1031] = 0; tag[1031] = 0;
-car[1030] = 746; cdr[1030] = 1029; tag[1030] = 0;
-car[1029] = 773; cdr[1029] = 0; tag[1029] = 0;
-car[1028] = 135; cdr[1028] = 0; tag[1028] = 0;
-car[1027] = 1026; cdr[1027] = 0; tag[1027] = 0;
-car[1026] = u('a'); cdr[1026] = 1025; tag[1026] = atomtag;
-car[1025] = u('d'); cdr[1025] = 1024; tag[1025] = atomtag;
-car[1024] = u('d'); cdr[1024] = 1023; tag[1024] = atomtag;
-car[1023] = u('r'); cdr[1023] = 0; tag[1023] = atomtag;
-car[1022] = 746; cdr[1022] = 1021; tag[1022] = 0;
-car[1021] = 746; cdr[1021] = 0; tag[1021] = 0;
-car[1020] = 1019; cdr[1020] = 0; tag[1020] = 0;
-car[1019] = u('t'); cdr[1019] = 1018; tag[1019] = atomtag;
-car[1018] = u('-'); cdr[1018] = 1017; tag[1018] = atomtag;
-car[1017] = u('a'); cdr[1017] = 1016; tag[1017] = atomtag;
-car[1016] = u('d'); cdr[1016] = 1015; tag[1016] = atomtag;
-car[1015] = u('d'); cdr[1015] = 1014; tag[1015] = atomtag;
-car[1014] = u('r'); cdr[1014] = 0; tag[1014] = atomtag;
-car[1013] = 770; cdr[1013] = 0; tag[1013] = 0;
-car[1012] = 1011; cdr[1012] = 0; tag[1012] = 0;
-car[1011] = u('n'); cdr[1011] = 1010; tag[1011] = atomtag;
-car[1010] = u('i'); cdr[1010] = 1009; tag[1010] = atomtag;
-car[1009] = u('l'); cdr[1009] = 1008; tag[1009] = atomtag;
-car[1008] = u('-'); cdr[1008] = 1007; tag[1008] = atomtag;
-car[1007] = u('a'); cdr[1007] = 1006; tag[1007] = atomtag;
-car[1006] = u('d'); cdr[1006] = 1005; tag[1006] = atomtag;
-car[1005] = u('d'); cdr[1005] = 1004; tag[1005] = atomtag;
-car[1004] = u('r'); cdr[1004] = 0; tag[1004] = atomtag;
-car[1003] = 773; cdr[1003] = 0; tag[1003] = 0;
-car[1002] = 1001; cdr[1002] = 0; tag[1002] = 0;
-car[1001] = u('l'); cdr[1001] = 1000; tag[1001] = atomtag;
-car[1000] = u('i'); cdr[1000] = 999; tag[1000] = atomtag;
-car[999] = u('m'); cdr[999] = 998; tag[999] = atomtag;
-car[998] = u('i'); cdr[998] = 997; tag[998] = atomtag;
-car[997] = u('t'); cdr[997] = 0; tag[997] = atomtag;
-car[996] = 755; cdr[996] = 995; tag[996] = 0;
-car[995] = 758; cdr[995] = 994; tag[995] = 0;
-car[994] = 758; cdr[994] = 993; tag[994] = 0;
-car[993] = 764; cdr[993] = 992; tag[993] = 0;
-car[992] = 758; cdr[992] = 0; tag[992] = 0;
-car[991] = 990; cdr[991] = 0; tag[991] = 0;
-car[990] = u('r'); cdr[990] = 989; tag[990] = atomtag;
-car[989] = u('e'); cdr[989] = 988; tag[989] = atomtag;
-car[988] = u('a'); cdr[988] = 987; tag[988] = atomtag;
-car[987] = u('d'); cdr[987] = 0; tag[987] = atomtag;
+car[1200] = u('l'); cdr[1200] = 1199; tag[1200] = atomtag;
+car[1199] = u('a'); cdr[1199] = 1198; tag[1199] = atomtag;
+car[1198] = u('m'); cdr[1198] = 1197; tag[1198] = atomtag;
+car[1197] = u('b'); cdr[1197] = 1196; tag[1197] = atomtag;
+car[1196] = u('d'); cdr[1196] = 1195; tag[1196] = atomtag;
+car[1195] = u('a'); cdr[1195] = 0; tag[1195] = atomtag;
+car[1194] = 1193; cdr[1194] = 0; tag[1194] = 0;
+car[1193] = u('q'); cdr[1193] = 1192; tag[1193] = atomtag;
+car[1192] = u('u'); cdr[1192] = 1191; tag[1192] = atomtag;
+car[1191] = u('o'); cdr[1191] = 1190; tag[1191] = atomtag;
+car[1190] = u('t'); cdr[1190] = 1189; tag[1190] = atomtag;
+car[1189] = u('e'); cdr[1189] = 0; tag[1189] = atomtag;
+car[1188] = 135; cdr[1188] = 0; tag[1188] = 0;
+car[1187] = 1186; cdr[1187] = 0; tag[1187] = 0;
+car[1186] = u('l'); cdr[1186] = 1185; tag[1186] = atomtag;
+car[1185] = u('e'); cdr[1185] = 1184; tag[1185] = atomtag;
+car[1184] = u('n'); cdr[1184] = 1183; tag[1184] = atomtag;
+car[1183] = u('g'); cdr[1183] = 1182; tag[1183] = atomtag;
+car[1182] = u('t'); cdr[1182] = 1181; tag[1182] = atomtag;
+car[1181] = u('h'); cdr[1181] = 0; tag[1181] = atomtag;
+car[1180] = 135; cdr[1180] = 1179; tag[1180] = 0;
+car[1179] = 639; cdr[1179] = 0; tag[1179] = 0;
+car[1178] = 135; cdr[1178] = 0; tag[1178] = 0;
+car[1177] = 1176; cdr[1177] = 0; tag[1177] = 0;
+car[1176] = u('f'); cdr[1176] = 1175; tag[1176] = atomtag;
+car[1175] = u('l'); cdr[1175] = 1174; tag[1175] = atomtag;
+car[1174] = u('u'); cdr[1174] = 1173; tag[1174] = atomtag;
+car[1173] = u('s'); cdr[1173] = 1172; tag[1173] = atomtag;
+car[1172] = u('h'); cdr[1172] = 0; tag[1172] = atomtag;
+car[1171] = 135; cdr[1171] = 0; tag[1171] = 0;
+car[1170] = 1169; cdr[1170] = 0; tag[1170] = 0;
+car[1169] = u('e'); cdr[1169] = 1168; tag[1169] = atomtag;
+car[1168] = u('m'); cdr[1168] = 1167; tag[1168] = atomtag;
+car[1167] = u('i'); cdr[1167] = 1166; tag[1167] = atomtag;
+car[1166] = u('t'); cdr[1166] = 0; tag[1166] = atomtag;
+car[1165] = 1164; cdr[1165] = 0; tag[1165] = 0;
+car[1164] = u('e'); cdr[1164] = 1163; tag[1164] = atomtag;
+car[1163] = u('m'); cdr[1163] = 1162; tag[1163] = atomtag;
+car[1162] = u('i'); cdr[1162] = 1161; tag[1162] = atomtag;
+car[1161] = u('t'); cdr[1161] = 1160; tag[1161] = atomtag;
+car[1160] = u('-'); cdr[1160] = 1159; tag[1160] = atomtag;
+car[1159] = u('l'); cdr[1159] = 1158; tag[1159] = atomtag;
+car[1158] = u('i'); cdr[1158] = 1157; tag[1158] = atomtag;
+car[1157] = u('n'); cdr[1157] = 1156; tag[1157] = atomtag;
+car[1156] = u('e'); cdr[1156] = 0; tag[1156] = atomtag;
+car[1155] = 135; cdr[1155] = 0; tag[1155] = 0;
+car[1154] = 135; cdr[1154] = 0; tag[1154] = 0;
+car[1153] = 1152; cdr[1153] = 0; tag[1153] = 0;
+car[1152] = u('a'); cdr[1152] = 1151; tag[1152] = atomtag;
+car[1151] = u('d'); cdr[1151] = 1150; tag[1151] = atomtag;
+car[1150] = u('d'); cdr[1150] = 1149; tag[1150] = atomtag;
+car[1149] = u('-'); cdr[1149] = 1148; tag[1149] = atomtag;
+car[1148] = u('o'); cdr[1148] = 1147; tag[1148] = atomtag;
+car[1147] = u('b'); cdr[1147] = 1146; tag[1147] = atomtag;
+car[1146] = u('j'); cdr[1146] = 1145; tag[1146] = atomtag;
+car[1145] = u('e'); cdr[1145] = 1144; tag[1145] = atomtag;
+car[1144] = u('c'); cdr[1144] = 1143; tag[1144] = atomtag;
+car[1143] = u('t'); cdr[1143] = 0; tag[1143] = atomtag;
+car[1142] = 135; cdr[1142] = 0; tag[1142] = 0;
+car[1141] = 1140; cdr[1141] = 0; tag[1141] = 0;
+car[1140] = u('m'); cdr[1140] = 1139; tag[1140] = atomtag;
+car[1139] = u('a'); cdr[1139] = 1138; tag[1139] = atomtag;
+car[1138] = u('k'); cdr[1138] = 1137; tag[1138] = atomtag;
+car[1137] = u('e'); cdr[1137] = 1136; tag[1137] = atomtag;
+car[1136] = u('-'); cdr[1136] = 1135; tag[1136] = atomtag;
+car[1135] = u('o'); cdr[1135] = 1134; tag[1135] = atomtag;
+car[1134] = u('b'); cdr[1134] = 1133; tag[1134] = atomtag;
+car[1133] = u('j'); cdr[1133] = 1132; tag[1133] = atomtag;
+car[1132] = u('e'); cdr[1132] = 1131; tag[1132] = atomtag;
+car[1131] = u('c'); cdr[1131] = 1130; tag[1131] = atomtag;
+car[1130] = u('t'); cdr[1130] = 0; tag[1130] = atomtag;
+car[1129] = 135; cdr[1129] = 0; tag[1129] = 0;
+car[1128] = 1127; cdr[1128] = 0; tag[1128] = 0;
+car[1127] = u('a'); cdr[1127] = 1126; tag[1127] = atomtag;
+car[1126] = u('d'); cdr[1126] = 1125; tag[1126] = atomtag;
+car[1125] = u('d'); cdr[1125] = 1124; tag[1125] = atomtag;
+car[1124] = u('-'); cdr[1124] = 1123; tag[1124] = atomtag;
+car[1123] = u('n'); cdr[1123] = 1122; tag[1123] = atomtag;
+car[1122] = u('u'); cdr[1122] = 1121; tag[1122] = atomtag;
+car[1121] = u('m'); cdr[1121] = 1120; tag[1121] = atomtag;
+car[1120] = u('b'); cdr[1120] = 1119; tag[1120] = atomtag;
+car[1119] = u('e'); cdr[1119] = 1118; tag[1119] = atomtag;
+car[1118] = u('r'); cdr[1118] = 0; tag[1118] = atomtag;
+car[1117] = 1116; cdr[1117] = 0; tag[1117] = 0;
+car[1116] = u('n'); cdr[1116] = 1115; tag[1116] = atomtag;
+car[1115] = u('u'); cdr[1115] = 1114; tag[1115] = atomtag;
+car[1114] = u('m'); cdr[1114] = 0; tag[1114] = atomtag;
+car[1113] = 135; cdr[1113] = 0; tag[1113] = 0;
+car[1112] = 1111; cdr[1112] = 0; tag[1112] = 0;
+car[1111] = u('n'); cdr[1111] = 1110; tag[1111] = atomtag;
+car[1110] = u('u'); cdr[1110] = 1109; tag[1110] = atomtag;
+car[1109] = u('m'); cdr[1109] = 1108; tag[1109] = atomtag;
+car[1108] = u('e'); cdr[1108] = 1107; tag[1108] = atomtag;
+car[1107] = u('r'); cdr[1107] = 1106; tag[1107] = atomtag;
+car[1106] = u('a'); cdr[1106] = 1105; tag[1106] = atomtag;
+car[1105] = u('l'); cdr[1105] = 1104; tag[1105] = atomtag;
+car[1104] = u('p'); cdr[1104] = 0; tag[1104] = atomtag;
+car[1103] = 135; cdr[1103] = 0; tag[1103] = 0;
+car[1102] = 135; cdr[1102] = 0; tag[1102] = 0;
+car[1101] = 1100; cdr[1101] = 0; tag[1101] = 0;
+car[1100] = u('d'); cdr[1100] = 1099; tag[1100] = atomtag;
+car[1099] = u('i'); cdr[1099] = 1098; tag[1099] = atomtag;
+car[1098] = u('g'); cdr[1098] = 1097; tag[1098] = atomtag;
+car[1097] = u('i'); cdr[1097] = 1096; tag[1097] = atomtag;
+car[1096] = u('t'); cdr[1096] = 1095; tag[1096] = atomtag;
+car[1095] = u('p'); cdr[1095] = 0; tag[1095] = atomtag;
+car[1094] = 135; cdr[1094] = 0; tag[1094] = 0;
+car[1093] = 1092; cdr[1093] = 0; tag[1093] = 0;
+car[1092] = u('a'); cdr[1092] = 1091; tag[1092] = atomtag;
+car[1091] = u('d'); cdr[1091] = 1090; tag[1091] = atomtag;
+car[1090] = u('d'); cdr[1090] = 1089; tag[1090] = atomtag;
+car[1089] = u('-'); cdr[1089] = 1088; tag[1089] = atomtag;
+car[1088] = u('a'); cdr[1088] = 1087; tag[1088] = atomtag;
+car[1087] = u('t'); cdr[1087] = 1086; tag[1087] = atomtag;
+car[1086] = u('o'); cdr[1086] = 1085; tag[1086] = atomtag;
+car[1085] = u('m'); cdr[1085] = 0; tag[1085] = atomtag;
+car[1084] = 135; cdr[1084] = 0; tag[1084] = 0;
+car[1083] = 135; cdr[1083] = 0; tag[1083] = 0;
+car[1082] = 1081; cdr[1082] = 0; tag[1082] = 0;
+car[1081] = u('m'); cdr[1081] = 1080; tag[1081] = atomtag;
+car[1080] = u('a'); cdr[1080] = 1079; tag[1080] = atomtag;
+car[1079] = u('k'); cdr[1079] = 1078; tag[1079] = atomtag;
+car[1078] = u('e'); cdr[1078] = 1077; tag[1078] = atomtag;
+car[1077] = u('-'); cdr[1077] = 1076; tag[1077] = atomtag;
+car[1076] = u('a'); cdr[1076] = 1075; tag[1076] = atomtag;
+car[1075] = u('t'); cdr[1075] = 1074; tag[1075] = atomtag;
+car[1074] = u('o'); cdr[1074] = 1073; tag[1074] = atomtag;
+car[1073] = u('m'); cdr[1073] = 0; tag[1073] = atomtag;
+car[1072] = 135; cdr[1072] = 1071; tag[1072] = 0;
+car[1071] = 909; cdr[1071] = 0; tag[1071] = 0;
+car[1070] = 135; cdr[1070] = 0; tag[1070] = 0;
+car[1069] = 1068; cdr[1069] = 0; tag[1069] = 0;
+car[1068] = u('m'); cdr[1068] = 1067; tag[1068] = atomtag;
+car[1067] = u('a'); cdr[1067] = 1066; tag[1067] = atomtag;
+car[1066] = u('k'); cdr[1066] = 1065; tag[1066] = atomtag;
+car[1065] = u('e'); cdr[1065] = 1064; tag[1065] = atomtag;
+car[1064] = u('-'); cdr[1064] = 1063; tag[1064] = atomtag;
+car[1063] = u('c'); cdr[1063] = 1062; tag[1063] = atomtag;
+car[1062] = u('e'); cdr[1062] = 1061; tag[1062] = atomtag;
+car[1061] = u('l'); cdr[1061] = 1060; tag[1061] = atomtag;
+car[1060] = u('l'); cdr[1060] = 0; tag[1060] = atomtag;
+car[1059] = 412; cdr[1059] = 1058; tag[1059] = 0;
+car[1058] = 935; cdr[1058] = 1057; tag[1058] = 0;
+car[1057] = 1056; cdr[1057] = 0; tag[1057] = 0;
+car[1056] = 1055; cdr[1056] = 0; tag[1056] = 0;
+car[1055] = u('t'); cdr[1055] = 1054; tag[1055] = atomtag;
+car[1054] = u('g'); cdr[1054] = 0; tag[1054] = atomtag;
+car[1053] = 1052; cdr[1053] = 0; tag[1053] = 0;
+car[1052] = u('m'); cdr[1052] = 1051; tag[1052] = atomtag;
+car[1051] = u('a'); cdr[1051] = 1050; tag[1051] = atomtag;
+car[1050] = u('k'); cdr[1050] = 1049; tag[1050] = atomtag;
+car[1049] = u('e'); cdr[1049] = 1048; tag[1049] = atomtag;
+car[1048] = u('-'); cdr[1048] = 1047; tag[1048] = atomtag;
+car[1047] = u('l'); cdr[1047] = 1046; tag[1047] = atomtag;
+car[1046] = u('a'); cdr[1046] = 1045; tag[1046] = atomtag;
+car[1045] = u('b'); cdr[1045] = 1044; tag[1045] = atomtag;
+car[1044] = u('e'); cdr[1044] = 1043; tag[1044] = atomtag;
+car[1043] = u('l'); cdr[1043] = 0; tag[1043] = atomtag;
+car[1042] = 1041; cdr[1042] = 0; tag[1042] = 0;
+car[1041] = u('p'); cdr[1041] = 1040; tag[1041] = atomtag;
+car[1040] = u('a'); cdr[1040] = 1039; tag[1040] = atomtag;
+car[1039] = u('r'); cdr[1039] = 1038; tag[1039] = atomtag;
+car[1038] = u('a'); cdr[1038] = 1037; tag[1038] = atomtag;
+car[1037] = u('m'); cdr[1037] = 1036; tag[1037] = atomtag;
+car[1036] = u('s'); cdr[1036] = 0; tag[1036] = atomtag;
+car[1035] = 1034; cdr[1035] = 0; tag[1035] = 0;
+car[1034] = u('k'); cdr[1034] = 1033; tag[1034] = atomtag;
+car[1033] = u('n'); cdr[1033] = 1032; tag[1033] = atomtag;
+car[1032] = u('o'); cdr[1032] = 1031; tag[1032] = atomtag;
+car[1031] = u('w'); cdr[1031] = 1030; tag[1031] = atomtag;
+car[1030] = u('n'); cdr[1030] = 0; tag[1030] = atomtag;
+car[1029] = 1028; cdr[1029] = 0; tag[1029] = 0;
+car[1028] = u('o'); cdr[1028] = 1027; tag[1028] = atomtag;
+car[1027] = u('u'); cdr[1027] = 1026; tag[1027] = atomtag;
+car[1026] = u('t'); cdr[1026] = 0; tag[1026] = atomtag;
+car[1025] = 1024; cdr[1025] = 0; tag[1025] = 0;
+car[1024] = u('f'); cdr[1024] = 1023; tag[1024] = atomtag;
+car[1023] = u('u'); cdr[1023] = 1022; tag[1023] = atomtag;
+car[1022] = u('n'); cdr[1022] = 1021; tag[1022] = atomtag;
+car[1021] = u('m'); cdr[1021] = 1020; tag[1021] = atomtag;
+car[1020] = u('o'); cdr[1020] = 1019; tag[1020] = atomtag;
+car[1019] = u('d'); cdr[1019] = 1018; tag[1019] = atomtag;
+car[1018] = u('e'); cdr[1018] = 0; tag[1018] = atomtag;
+car[1017] = 1016; cdr[1017] = 0; tag[1017] = 0;
+car[1016] = u('l'); cdr[1016] = 1015; tag[1016] = atomtag;
+car[1015] = u('b'); cdr[1015] = 1014; tag[1015] = atomtag;
+car[1014] = u('l'); cdr[1014] = 0; tag[1014] = atomtag;
+car[1013] = 1012; cdr[1013] = 0; tag[1013] = 0;
+car[1012] = u('o'); cdr[1012] = 1011; tag[1012] = atomtag;
+car[1011] = u('b'); cdr[1011] = 1010; tag[1011] = atomtag;
+car[1010] = u('l'); cdr[1010] = 1009; tag[1010] = atomtag;
+car[1009] = u('i'); cdr[1009] = 1008; tag[1009] = atomtag;
+car[1008] = u('s'); cdr[1008] = 1007; tag[1008] = atomtag;
+car[1007] = u('t'); cdr[1007] = 0; tag[1007] = atomtag;
+car[1006] = 1005; cdr[1006] = 0; tag[1006] = 0;
+car[1005] = u('n'); cdr[1005] = 1004; tag[1005] = atomtag;
+car[1004] = u('u'); cdr[1004] = 1003; tag[1004] = atomtag;
+car[1003] = u('m'); cdr[1003] = 1002; tag[1003] = atomtag;
+car[1002] = u('l'); cdr[1002] = 1001; tag[1002] = atomtag;
+car[1001] = u('i'); cdr[1001] = 1000; tag[1001] = atomtag;
+car[1000] = u('s'); cdr[1000] = 0; tag[1000] = atomtag;
+car[999] = 998; cdr[999] = 0; tag[999] = 0;
+car[998] = u('s'); cdr[998] = 997; tag[998] = atomtag;
+car[997] = u('y'); cdr[997] = 996; tag[997] = atomtag;
+car[996] = u('m'); cdr[996] = 995; tag[996] = atomtag;
+car[995] = u('l'); cdr[995] = 994; tag[995] = atomtag;
+car[994] = u('i'); cdr[994] = 993; tag[994] = atomtag;
+car[993] = u('s'); cdr[993] = 0; tag[993] = atomtag;
+car[992] = 991; cdr[992] = 0; tag[992] = 0;
+car[991] = u('c'); cdr[991] = 990; tag[991] = atomtag;
+car[990] = u('e'); cdr[990] = 989; tag[990] = atomtag;
+car[989] = u('l'); cdr[989] = 988; tag[989] = atomtag;
+car[988] = u('l'); cdr[988] = 987; tag[988] = atomtag;
+car[987] = u('s'); cdr[987] = 0; tag[987] = atomtag;
 car[986] = 985; cdr[986] = 0; tag[986] = 0;
-car[985] = u('f'); cdr[985] = 984; tag[985] = atomtag;
-car[984] = u('u'); cdr[984] = 983; tag[984] = atomtag;
-car[983] = u('n'); cdr[983] = 982; tag[983] = atomtag;
-car[982] = u('n'); cdr[982] = 981; tag[982] = atomtag;
-car[981] = u('y'); cdr[981] = 980; tag[981] = atomtag;
-car[980] = u(' '); cdr[980] = 979; tag[980] = atomtag;
-car[979] = u('c'); cdr[979] = 978; tag[979] = atomtag;
-car[978] = u('h'); cdr[978] = 977; tag[978] = atomtag;
+car[985] = u('a'); cdr[985] = 984; tag[985] = atomtag;
+car[984] = u('d'); cdr[984] = 983; tag[984] = atomtag;
+car[983] = u('d'); cdr[983] = 982; tag[983] = atomtag;
+car[982] = u('r'); cdr[982] = 0; tag[982] = atomtag;
+car[981] = 99; cdr[981] = 0; tag[981] = numtag;
+car[980] = 979; cdr[980] = 0; tag[980] = 0;
+car[979] = u('t'); cdr[979] = 978; tag[979] = atomtag;
+car[978] = u('-'); cdr[978] = 977; tag[978] = atomtag;
 car[977] = u('a'); cdr[977] = 976; tag[977] = atomtag;
-car[976] = u('r'); cdr[976] = 975; tag[976] = atomtag;
-car[975] = u('a'); cdr[975] = 974; tag[975] = atomtag;
-car[974] = u('c'); cdr[974] = 973; tag[974] = atomtag;
-car[973] = u('t'); cdr[973] = 972; tag[973] = atomtag;
-car[972] = u('e'); cdr[972] = 971; tag[972] = atomtag;
-car[971] = u('r'); cdr[971] = 0; tag[971] = atomtag;
-car[970] = 969; cdr[970] = 0; tag[970] = 0;
-car[969] = u(';'); cdr[969] = 0; tag[969] = atomtag;
-car[968] = 967; cdr[968] = 0; tag[968] = 0;
-car[967] = '\''; cdr[967] = 0; tag[967] = atomtag;
-car[966] = 521; cdr[966] = 0; tag[966] = 0;
-car[965] = 964; cdr[965] = 0; tag[965] = 0;
-car[964] = u('*'); cdr[964] = 963; tag[964] = atomtag;
-car[963] = u('r'); cdr[963] = 962; tag[963] = atomtag;
-car[962] = u('e'); cdr[962] = 961; tag[962] = atomtag;
-car[961] = u('a'); cdr[961] = 960; tag[961] = atomtag;
-car[960] = u('d'); cdr[960] = 959; tag[960] = atomtag;
-car[959] = u('-'); cdr[959] = 958; tag[959] = atomtag;
-car[958] = u('t'); cdr[958] = 957; tag[958] = atomtag;
-car[957] = u('m'); cdr[957] = 956; tag[957] = atomtag;
-car[956] = u('p'); cdr[956] = 0; tag[956] = atomtag;
-car[955] = 954; cdr[955] = 0; tag[955] = 0;
-car[954] = u('r'); cdr[954] = 953; tag[954] = atomtag;
-car[953] = u('d'); cdr[953] = 952; tag[953] = atomtag;
-car[952] = u('-'); cdr[952] = 951; tag[952] = atomtag;
-car[951] = u('o'); cdr[951] = 950; tag[951] = atomtag;
-car[950] = u('b'); cdr[950] = 949; tag[950] = atomtag;
-car[949] = u('j'); cdr[949] = 0; tag[949] = atomtag;
+car[976] = u('d'); cdr[976] = 975; tag[976] = atomtag;
+car[975] = u('d'); cdr[975] = 974; tag[975] = atomtag;
+car[974] = u('r'); cdr[974] = 0; tag[974] = atomtag;
+car[973] = 972; cdr[973] = 0; tag[973] = 0;
+car[972] = u('n'); cdr[972] = 971; tag[972] = atomtag;
+car[971] = u('i'); cdr[971] = 970; tag[971] = atomtag;
+car[970] = u('l'); cdr[970] = 969; tag[970] = atomtag;
+car[969] = u('-'); cdr[969] = 968; tag[969] = atomtag;
+car[968] = u('a'); cdr[968] = 967; tag[968] = atomtag;
+car[967] = u('d'); cdr[967] = 966; tag[967] = atomtag;
+car[966] = u('d'); cdr[966] = 965; tag[966] = atomtag;
+car[965] = u('r'); cdr[965] = 0; tag[965] = atomtag;
+car[964] = 0; cdr[964] = 0; tag[964] = numtag;
+car[963] = 962; cdr[963] = 0; tag[963] = 0;
+car[962] = u('r'); cdr[962] = 961; tag[962] = atomtag;
+car[961] = u('e'); cdr[961] = 960; tag[961] = atomtag;
+car[960] = u('a'); cdr[960] = 959; tag[960] = atomtag;
+car[959] = u('d'); cdr[959] = 0; tag[959] = atomtag;
+car[958] = 957; cdr[958] = 0; tag[958] = 0;
+car[957] = u('s'); cdr[957] = 956; tag[957] = atomtag;
+car[956] = u('y'); cdr[956] = 955; tag[956] = atomtag;
+car[955] = u('m'); cdr[955] = 954; tag[955] = atomtag;
+car[954] = u('b'); cdr[954] = 953; tag[954] = atomtag;
+car[953] = u('o'); cdr[953] = 952; tag[953] = atomtag;
+car[952] = u('l'); cdr[952] = 951; tag[952] = atomtag;
+car[951] = u('i'); cdr[951] = 950; tag[951] = atomtag;
+car[950] = u('c'); cdr[950] = 0; tag[950] = atomtag;
+car[949] = 600; cdr[949] = 0; tag[949] = 0;
 car[948] = 947; cdr[948] = 0; tag[948] = 0;
-car[947] = u('u'); cdr[947] = 946; tag[947] = atomtag;
-car[946] = u('n'); cdr[946] = 945; tag[946] = atomtag;
-car[945] = u('t'); cdr[945] = 944; tag[945] = atomtag;
-car[944] = u('e'); cdr[944] = 943; tag[944] = atomtag;
-car[943] = u('r'); cdr[943] = 942; tag[943] = atomtag;
-car[942] = u('m'); cdr[942] = 941; tag[942] = atomtag;
-car[941] = u('i'); cdr[941] = 940; tag[941] = atomtag;
-car[940] = u('n'); cdr[940] = 939; tag[940] = atomtag;
-car[939] = u('a'); cdr[939] = 938; tag[939] = atomtag;
-car[938] = u('t'); cdr[938] = 937; tag[938] = atomtag;
-car[937] = u('e'); cdr[937] = 936; tag[937] = atomtag;
-car[936] = u('d'); cdr[936] = 935; tag[936] = atomtag;
-car[935] = u(' '); cdr[935] = 934; tag[935] = atomtag;
-car[934] = u('l'); cdr[934] = 933; tag[934] = atomtag;
-car[933] = u('i'); cdr[933] = 932; tag[933] = atomtag;
-car[932] = u('s'); cdr[932] = 931; tag[932] = atomtag;
-car[931] = u('t'); cdr[931] = 0; tag[931] = atomtag;
-car[930] = 521; cdr[930] = 929; tag[930] = 0;
-car[929] = 333; cdr[929] = 0; tag[929] = 0;
+car[947] = u('*'); cdr[947] = 946; tag[947] = atomtag;
+car[946] = u('s'); cdr[946] = 945; tag[946] = atomtag;
+car[945] = u('y'); cdr[945] = 944; tag[945] = atomtag;
+car[944] = u('m'); cdr[944] = 943; tag[944] = atomtag;
+car[943] = u('b'); cdr[943] = 942; tag[943] = atomtag;
+car[942] = u('o'); cdr[942] = 941; tag[942] = atomtag;
+car[941] = u('l'); cdr[941] = 940; tag[941] = atomtag;
+car[940] = u('s'); cdr[940] = 0; tag[940] = atomtag;
+car[939] = 412; cdr[939] = 938; tag[939] = 0;
+car[938] = 409; cdr[938] = 937; tag[938] = 0;
+car[937] = 600; cdr[937] = 936; tag[937] = 0;
+car[936] = 935; cdr[936] = 933; tag[936] = 0;
+car[935] = 934; cdr[935] = 0; tag[935] = 0;
+car[934] = u('d'); cdr[934] = 0; tag[934] = atomtag;
+car[933] = 932; cdr[933] = 930; tag[933] = 0;
+car[932] = 931; cdr[932] = 0; tag[932] = 0;
+car[931] = u('e'); cdr[931] = 0; tag[931] = atomtag;
+car[930] = 760; cdr[930] = 929; tag[930] = 0;
+car[929] = 928; cdr[929] = 926; tag[929] = 0;
 car[928] = 927; cdr[928] = 0; tag[928] = 0;
-car[927] = u('r'); cdr[927] = 926; tag[927] = atomtag;
-car[926] = u('d'); cdr[926] = 925; tag[926] = atomtag;
-car[925] = u('-'); cdr[925] = 924; tag[925] = atomtag;
-car[924] = u('l'); cdr[924] = 923; tag[924] = atomtag;
-car[923] = u('i'); cdr[923] = 922; tag[923] = atomtag;
-car[922] = u('s'); cdr[922] = 921; tag[922] = atomtag;
-car[921] = u('t'); cdr[921] = 0; tag[921] = atomtag;
-car[920] = 919; cdr[920] = 0; tag[920] = 0;
-car[919] = '\\'; cdr[919] = 0; tag[919] = atomtag;
+car[927] = u('g'); cdr[927] = 0; tag[927] = atomtag;
+car[926] = 925; cdr[926] = 923; tag[926] = 0;
+car[925] = 924; cdr[925] = 0; tag[925] = 0;
+car[924] = u('h'); cdr[924] = 0; tag[924] = atomtag;
+car[923] = 689; cdr[923] = 922; tag[923] = 0;
+car[922] = 921; cdr[922] = 919; tag[922] = 0;
+car[921] = 920; cdr[921] = 0; tag[921] = 0;
+car[920] = u('j'); cdr[920] = 0; tag[920] = atomtag;
+car[919] = 918; cdr[919] = 916; tag[919] = 0;
 car[918] = 917; cdr[918] = 0; tag[918] = 0;
-car[917] = u('q'); cdr[917] = 916; tag[917] = atomtag;
-car[916] = u('u'); cdr[916] = 915; tag[916] = atomtag;
-car[915] = u('o'); cdr[915] = 914; tag[915] = atomtag;
-car[914] = u('t'); cdr[914] = 913; tag[914] = atomtag;
-car[913] = u('e'); cdr[913] = 0; tag[913] = atomtag;
+car[917] = u('k'); cdr[917] = 0; tag[917] = atomtag;
+car[916] = 691; cdr[916] = 915; tag[916] = 0;
+car[915] = 756; cdr[915] = 914; tag[915] = 0;
+car[914] = 639; cdr[914] = 913; tag[914] = 0;
+car[913] = 912; cdr[913] = 910; tag[913] = 0;
 car[912] = 911; cdr[912] = 0; tag[912] = 0;
-car[911] = u('"'); cdr[911] = 0; tag[911] = atomtag;
-car[910] = 909; cdr[910] = 0; tag[910] = 0;
-car[909] = u('u'); cdr[909] = 908; tag[909] = atomtag;
-car[908] = u('n'); cdr[908] = 907; tag[908] = atomtag;
-car[907] = u('t'); cdr[907] = 906; tag[907] = atomtag;
-car[906] = u('e'); cdr[906] = 905; tag[906] = atomtag;
-car[905] = u('r'); cdr[905] = 904; tag[905] = atomtag;
-car[904] = u('m'); cdr[904] = 903; tag[904] = atomtag;
-car[903] = u('i'); cdr[903] = 902; tag[903] = atomtag;
-car[902] = u('n'); cdr[902] = 901; tag[902] = atomtag;
-car[901] = u('a'); cdr[901] = 900; tag[901] = atomtag;
-car[900] = u('t'); cdr[900] = 899; tag[900] = atomtag;
-car[899] = u('e'); cdr[899] = 898; tag[899] = atomtag;
-car[898] = u('d'); cdr[898] = 897; tag[898] = atomtag;
-car[897] = u(' '); cdr[897] = 896; tag[897] = atomtag;
-car[896] = u('s'); cdr[896] = 895; tag[896] = atomtag;
-car[895] = u('t'); cdr[895] = 894; tag[895] = atomtag;
-car[894] = u('r'); cdr[894] = 893; tag[894] = atomtag;
-car[893] = u('i'); cdr[893] = 892; tag[893] = atomtag;
-car[892] = u('n'); cdr[892] = 891; tag[892] = atomtag;
-car[891] = u('g'); cdr[891] = 0; tag[891] = atomtag;
-car[890] = 521; cdr[890] = 889; tag[890] = 0;
-car[889] = 333; cdr[889] = 0; tag[889] = 0;
-car[888] = 887; cdr[888] = 0; tag[888] = 0;
-car[887] = u('r'); cdr[887] = 886; tag[887] = atomtag;
-car[886] = u('d'); cdr[886] = 885; tag[886] = atomtag;
-car[885] = u('-'); cdr[885] = 884; tag[885] = atomtag;
-car[884] = u('p'); cdr[884] = 883; tag[884] = atomtag;
-car[883] = u('s'); cdr[883] = 882; tag[883] = atomtag;
-car[882] = u('t'); cdr[882] = 881; tag[882] = atomtag;
-car[881] = u('r'); cdr[881] = 0; tag[881] = atomtag;
-car[880] = 574; cdr[880] = 879; tag[880] = 0;
-car[879] = 572; cdr[879] = 878; tag[879] = 0;
-car[878] = 570; cdr[878] = 0; tag[878] = 0;
-car[877] = 521; cdr[877] = 876; tag[877] = 0;
-car[876] = 333; cdr[876] = 0; tag[876] = 0;
-car[875] = 874; cdr[875] = 0; tag[875] = 0;
-car[874] = u('r'); cdr[874] = 873; tag[874] = atomtag;
-car[873] = u('d'); cdr[873] = 872; tag[873] = atomtag;
-car[872] = u('-'); cdr[872] = 871; tag[872] = atomtag;
-car[871] = u('a'); cdr[871] = 870; tag[871] = atomtag;
-car[870] = u('t'); cdr[870] = 869; tag[870] = atomtag;
-car[869] = u('o'); cdr[869] = 868; tag[869] = atomtag;
-car[868] = u('m'); cdr[868] = 0; tag[868] = atomtag;
-car[867] = 521; cdr[867] = 0; tag[867] = 0;
-car[866] = 865; cdr[866] = 0; tag[866] = 0;
-car[865] = u('r'); cdr[865] = 864; tag[865] = atomtag;
-car[864] = u('d'); cdr[864] = 863; tag[864] = atomtag;
-car[863] = u('-'); cdr[863] = 862; tag[863] = atomtag;
-car[862] = u('c'); cdr[862] = 861; tag[862] = atomtag;
-car[861] = u('o'); cdr[861] = 860; tag[861] = atomtag;
-car[860] = u('m'); cdr[860] = 859; tag[860] = atomtag;
-car[859] = u('m'); cdr[859] = 0; tag[859] = atomtag;
-car[858] = 521; cdr[858] = 0; tag[858] = 0;
-car[857] = 856; cdr[857] = 0; tag[857] = 0;
-car[856] = u('s'); cdr[856] = 855; tag[856] = atomtag;
-car[855] = u('k'); cdr[855] = 854; tag[855] = atomtag;
-car[854] = u('i'); cdr[854] = 853; tag[854] = atomtag;
-car[853] = u('p'); cdr[853] = 852; tag[853] = atomtag;
-car[852] = u('c'); cdr[852] = 0; tag[852] = atomtag;
-car[851] = 850; cdr[851] = 0; tag[851] = 0;
-car[850] = u('s'); cdr[850] = 849; tag[850] = atomtag;
-car[849] = u('y'); cdr[849] = 848; tag[849] = atomtag;
-car[848] = u('m'); cdr[848] = 847; tag[848] = atomtag;
-car[847] = u('b'); cdr[847] = 846; tag[847] = atomtag;
-car[846] = u('o'); cdr[846] = 845; tag[846] = atomtag;
-car[845] = u('l'); cdr[845] = 844; tag[845] = atomtag;
-car[844] = u('i'); cdr[844] = 843; tag[844] = atomtag;
-car[843] = u('c'); cdr[843] = 0; tag[843] = atomtag;
-car[842] = 521; cdr[842] = 0; tag[842] = 0;
-car[841] = 840; cdr[841] = 0; tag[841] = 0;
-car[840] = u('*'); cdr[840] = 839; tag[840] = atomtag;
-car[839] = u('s'); cdr[839] = 838; tag[839] = atomtag;
-car[838] = u('y'); cdr[838] = 837; tag[838] = atomtag;
-car[837] = u('m'); cdr[837] = 836; tag[837] = atomtag;
-car[836] = u('b'); cdr[836] = 835; tag[836] = atomtag;
-car[835] = u('o'); cdr[835] = 834; tag[835] = atomtag;
-car[834] = u('l'); cdr[834] = 833; tag[834] = atomtag;
-car[833] = u('s'); cdr[833] = 0; tag[833] = atomtag;
-car[832] = 333; cdr[832] = 831; tag[832] = 0;
-car[831] = 330; cdr[831] = 830; tag[831] = 0;
-car[830] = 521; cdr[830] = 829; tag[830] = 0;
-car[829] = 828; cdr[829] = 826; tag[829] = 0;
-car[828] = 827; cdr[828] = 0; tag[828] = 0;
-car[827] = u('d'); cdr[827] = 0; tag[827] = atomtag;
-car[826] = 825; cdr[826] = 823; tag[826] = 0;
-car[825] = 824; cdr[825] = 0; tag[825] = 0;
-car[824] = u('e'); cdr[824] = 0; tag[824] = atomtag;
-car[823] = 643; cdr[823] = 822; tag[823] = 0;
-car[822] = 821; cdr[822] = 819; tag[822] = 0;
-car[821] = 820; cdr[821] = 0; tag[821] = 0;
-car[820] = u('g'); cdr[820] = 0; tag[820] = atomtag;
-car[819] = 818; cdr[819] = 816; tag[819] = 0;
-car[818] = 817; cdr[818] = 0; tag[818] = 0;
-car[817] = u('h'); cdr[817] = 0; tag[817] = atomtag;
-car[816] = 572; cdr[816] = 815; tag[816] = 0;
-car[815] = 814; cdr[815] = 812; tag[815] = 0;
+car[911] = u('o'); cdr[911] = 0; tag[911] = atomtag;
+car[910] = 909; cdr[910] = 907; tag[910] = 0;
+car[909] = 908; cdr[909] = 0; tag[909] = 0;
+car[908] = u('p'); cdr[908] = 0; tag[908] = atomtag;
+car[907] = 906; cdr[907] = 904; tag[907] = 0;
+car[906] = 905; cdr[906] = 0; tag[906] = 0;
+car[905] = u('q'); cdr[905] = 0; tag[905] = atomtag;
+car[904] = 543; cdr[904] = 903; tag[904] = 0;
+car[903] = 902; cdr[903] = 900; tag[903] = 0;
+car[902] = 901; cdr[902] = 0; tag[902] = 0;
+car[901] = u('s'); cdr[901] = 0; tag[901] = atomtag;
+car[900] = 1; cdr[900] = 899; tag[900] = 0;
+car[899] = 898; cdr[899] = 896; tag[899] = 0;
+car[898] = 897; cdr[898] = 0; tag[898] = 0;
+car[897] = u('u'); cdr[897] = 0; tag[897] = atomtag;
+car[896] = 762; cdr[896] = 895; tag[896] = 0;
+car[895] = 894; cdr[895] = 892; tag[895] = 0;
+car[894] = 893; cdr[894] = 0; tag[894] = 0;
+car[893] = u('w'); cdr[893] = 0; tag[893] = atomtag;
+car[892] = 135; cdr[892] = 891; tag[892] = 0;
+car[891] = 153; cdr[891] = 890; tag[891] = 0;
+car[890] = 889; cdr[890] = 887; tag[890] = 0;
+car[889] = 888; cdr[889] = 0; tag[889] = 0;
+car[888] = u('z'); cdr[888] = 0; tag[888] = atomtag;
+car[887] = 886; cdr[887] = 884; tag[887] = 0;
+car[886] = 885; cdr[886] = 0; tag[886] = 0;
+car[885] = u('*'); cdr[885] = 0; tag[885] = atomtag;
+car[884] = 883; cdr[884] = 881; tag[884] = 0;
+car[883] = 882; cdr[883] = 0; tag[883] = 0;
+car[882] = u('-'); cdr[882] = 0; tag[882] = atomtag;
+car[881] = 644; cdr[881] = 880; tag[881] = 0;
+car[880] = 647; cdr[880] = 879; tag[880] = 0;
+car[879] = 650; cdr[879] = 878; tag[879] = 0;
+car[878] = 653; cdr[878] = 877; tag[878] = 0;
+car[877] = 656; cdr[877] = 876; tag[877] = 0;
+car[876] = 659; cdr[876] = 875; tag[876] = 0;
+car[875] = 662; cdr[875] = 874; tag[875] = 0;
+car[874] = 665; cdr[874] = 873; tag[874] = 0;
+car[873] = 668; cdr[873] = 872; tag[873] = 0;
+car[872] = 670; cdr[872] = 0; tag[872] = 0;
+car[871] = 870; cdr[871] = 0; tag[871] = 0;
+car[870] = u('*'); cdr[870] = 869; tag[870] = atomtag;
+car[869] = u('d'); cdr[869] = 868; tag[869] = atomtag;
+car[868] = u('i'); cdr[868] = 867; tag[868] = atomtag;
+car[867] = u('g'); cdr[867] = 866; tag[867] = atomtag;
+car[866] = u('i'); cdr[866] = 865; tag[866] = atomtag;
+car[865] = u('t'); cdr[865] = 864; tag[865] = atomtag;
+car[864] = u('s'); cdr[864] = 0; tag[864] = atomtag;
+car[863] = 644; cdr[863] = 862; tag[863] = 0;
+car[862] = 647; cdr[862] = 861; tag[862] = 0;
+car[861] = 650; cdr[861] = 860; tag[861] = 0;
+car[860] = 653; cdr[860] = 859; tag[860] = 0;
+car[859] = 656; cdr[859] = 858; tag[859] = 0;
+car[858] = 659; cdr[858] = 857; tag[858] = 0;
+car[857] = 662; cdr[857] = 856; tag[857] = 0;
+car[856] = 665; cdr[856] = 855; tag[856] = 0;
+car[855] = 668; cdr[855] = 854; tag[855] = 0;
+car[854] = 670; cdr[854] = 0; tag[854] = 0;
+car[853] = 852; cdr[853] = 0; tag[853] = 0;
+car[852] = u('e'); cdr[852] = 851; tag[852] = atomtag;
+car[851] = u('x'); cdr[851] = 850; tag[851] = atomtag;
+car[850] = u('p'); cdr[850] = 849; tag[850] = atomtag;
+car[849] = u('l'); cdr[849] = 848; tag[849] = atomtag;
+car[848] = u('o'); cdr[848] = 847; tag[848] = atomtag;
+car[847] = u('d'); cdr[847] = 846; tag[847] = atomtag;
+car[846] = u('e'); cdr[846] = 0; tag[846] = atomtag;
+car[845] = 844; cdr[845] = 0; tag[845] = 0;
+car[844] = u('e'); cdr[844] = 843; tag[844] = atomtag;
+car[843] = u('x'); cdr[843] = 842; tag[843] = atomtag;
+car[842] = u('p'); cdr[842] = 841; tag[842] = atomtag;
+car[841] = u('l'); cdr[841] = 840; tag[841] = atomtag;
+car[840] = u('o'); cdr[840] = 839; tag[840] = atomtag;
+car[839] = u('d'); cdr[839] = 838; tag[839] = atomtag;
+car[838] = u('e'); cdr[838] = 837; tag[838] = atomtag;
+car[837] = u(':'); cdr[837] = 836; tag[837] = atomtag;
+car[836] = u(' '); cdr[836] = 835; tag[836] = atomtag;
+car[835] = u('e'); cdr[835] = 834; tag[835] = atomtag;
+car[834] = u('x'); cdr[834] = 833; tag[834] = atomtag;
+car[833] = u('p'); cdr[833] = 832; tag[833] = atomtag;
+car[832] = u('e'); cdr[832] = 831; tag[832] = atomtag;
+car[831] = u('c'); cdr[831] = 830; tag[831] = atomtag;
+car[830] = u('t'); cdr[830] = 829; tag[830] = atomtag;
+car[829] = u('e'); cdr[829] = 828; tag[829] = atomtag;
+car[828] = u('d'); cdr[828] = 827; tag[828] = atomtag;
+car[827] = u(' '); cdr[827] = 826; tag[827] = atomtag;
+car[826] = u('a'); cdr[826] = 825; tag[826] = atomtag;
+car[825] = u('t'); cdr[825] = 824; tag[825] = atomtag;
+car[824] = u('o'); cdr[824] = 823; tag[824] = atomtag;
+car[823] = u('m'); cdr[823] = 0; tag[823] = atomtag;
+car[822] = 639; cdr[822] = 821; tag[822] = 0;
+car[821] = 412; cdr[821] = 0; tag[821] = 0;
+car[820] = 819; cdr[820] = 0; tag[820] = 0;
+car[819] = u('e'); cdr[819] = 818; tag[819] = atomtag;
+car[818] = u('x'); cdr[818] = 817; tag[818] = atomtag;
+car[817] = u('p'); cdr[817] = 816; tag[817] = atomtag;
+car[816] = u('l'); cdr[816] = 0; tag[816] = atomtag;
+car[815] = 135; cdr[815] = 0; tag[815] = 0;
 car[814] = 813; cdr[814] = 0; tag[814] = 0;
-car[813] = u('j'); cdr[813] = 0; tag[813] = atomtag;
-car[812] = 811; cdr[812] = 809; tag[812] = 0;
-car[811] = 810; cdr[811] = 0; tag[811] = 0;
-car[810] = u('k'); cdr[810] = 0; tag[810] = atomtag;
-car[809] = 574; cdr[809] = 808; tag[809] = 0;
-car[808] = 639; cdr[808] = 807; tag[808] = 0;
-car[807] = 570; cdr[807] = 806; tag[807] = 0;
-car[806] = 805; cdr[806] = 803; tag[806] = 0;
-car[805] = 804; cdr[805] = 0; tag[805] = 0;
-car[804] = u('o'); cdr[804] = 0; tag[804] = atomtag;
-car[803] = 802; cdr[803] = 800; tag[803] = 0;
-car[802] = 801; cdr[802] = 0; tag[802] = 0;
-car[801] = u('p'); cdr[801] = 0; tag[801] = atomtag;
-car[800] = 799; cdr[800] = 797; tag[800] = 0;
-car[799] = 798; cdr[799] = 0; tag[799] = 0;
-car[798] = u('q'); cdr[798] = 0; tag[798] = atomtag;
-car[797] = 464; cdr[797] = 796; tag[797] = 0;
-car[796] = 795; cdr[796] = 793; tag[796] = 0;
-car[795] = 794; cdr[795] = 0; tag[795] = 0;
-car[794] = u('s'); cdr[794] = 0; tag[794] = atomtag;
-car[793] = 1; cdr[793] = 792; tag[793] = 0;
-car[792] = 791; cdr[792] = 789; tag[792] = 0;
-car[791] = 790; cdr[791] = 0; tag[791] = 0;
-car[790] = u('u'); cdr[790] = 0; tag[790] = atomtag;
-car[789] = 645; cdr[789] = 788; tag[789] = 0;
-car[788] = 787; cdr[788] = 785; tag[788] = 0;
+car[813] = u('m'); cdr[813] = 812; tag[813] = atomtag;
+car[812] = u('k'); cdr[812] = 811; tag[812] = atomtag;
+car[811] = u('a'); cdr[811] = 810; tag[811] = atomtag;
+car[810] = u('t'); cdr[810] = 809; tag[810] = atomtag;
+car[809] = u('o'); cdr[809] = 808; tag[809] = atomtag;
+car[808] = u('m'); cdr[808] = 0; tag[808] = atomtag;
+car[807] = 639; cdr[807] = 0; tag[807] = 0;
+car[806] = 805; cdr[806] = 0; tag[806] = 0;
+car[805] = u('i'); cdr[805] = 804; tag[805] = atomtag;
+car[804] = u('m'); cdr[804] = 803; tag[804] = atomtag;
+car[803] = u('p'); cdr[803] = 802; tag[803] = atomtag;
+car[802] = u('l'); cdr[802] = 801; tag[802] = atomtag;
+car[801] = u('o'); cdr[801] = 800; tag[801] = atomtag;
+car[800] = u('d'); cdr[800] = 799; tag[800] = atomtag;
+car[799] = u('e'); cdr[799] = 0; tag[799] = atomtag;
+car[798] = 135; cdr[798] = 0; tag[798] = 0;
+car[797] = 796; cdr[797] = 0; tag[797] = 0;
+car[796] = u('m'); cdr[796] = 795; tag[796] = atomtag;
+car[795] = u('a'); cdr[795] = 794; tag[795] = atomtag;
+car[794] = u('k'); cdr[794] = 793; tag[794] = atomtag;
+car[793] = u('e'); cdr[793] = 792; tag[793] = atomtag;
+car[792] = u('s'); cdr[792] = 791; tag[792] = atomtag;
+car[791] = u('y'); cdr[791] = 790; tag[791] = atomtag;
+car[790] = u('m'); cdr[790] = 0; tag[790] = atomtag;
+car[789] = 639; cdr[789] = 788; tag[789] = 0;
+car[788] = 412; cdr[788] = 0; tag[788] = 0;
 car[787] = 786; cdr[787] = 0; tag[787] = 0;
-car[786] = u('w'); cdr[786] = 0; tag[786] = atomtag;
-car[785] = 135; cdr[785] = 784; tag[785] = 0;
-car[784] = 153; cdr[784] = 783; tag[784] = 0;
-car[783] = 782; cdr[783] = 780; tag[783] = 0;
-car[782] = 781; cdr[782] = 0; tag[782] = 0;
-car[781] = u('z'); cdr[781] = 0; tag[781] = atomtag;
-car[780] = 779; cdr[780] = 777; tag[780] = 0;
-car[779] = 778; cdr[779] = 0; tag[779] = 0;
-car[778] = u('*'); cdr[778] = 0; tag[778] = atomtag;
-car[777] = 776; cdr[777] = 774; tag[777] = 0;
-car[776] = 775; cdr[776] = 0; tag[776] = 0;
-car[775] = u('-'); cdr[775] = 0; tag[775] = atomtag;
-car[774] = 773; cdr[774] = 771; tag[774] = 0;
-car[773] = 772; cdr[773] = 0; tag[773] = 0;
-car[772] = u('0'); cdr[772] = 0; tag[772] = atomtag;
-car[771] = 770; cdr[771] = 768; tag[771] = 0;
-car[770] = 769; cdr[770] = 0; tag[770] = 0;
-car[769] = u('1'); cdr[769] = 0; tag[769] = atomtag;
-car[768] = 767; cdr[768] = 765; tag[768] = 0;
-car[767] = 766; cdr[767] = 0; tag[767] = 0;
-car[766] = u('2'); cdr[766] = 0; tag[766] = atomtag;
-car[765] = 764; cdr[765] = 762; tag[765] = 0;
-car[764] = 763; cdr[764] = 0; tag[764] = 0;
-car[763] = u('3'); cdr[763] = 0; tag[763] = atomtag;
-car[762] = 761; cdr[762] = 759; tag[762] = 0;
-car[761] = 760; cdr[761] = 0; tag[761] = 0;
-car[760] = u('4'); cdr[760] = 0; tag[760] = atomtag;
-car[759] = 758; cdr[759] = 756; tag[759] = 0;
-car[758] = 757; cdr[758] = 0; tag[758] = 0;
-car[757] = u('5'); cdr[757] = 0; tag[757] = atomtag;
-car[756] = 755; cdr[756] = 753; tag[756] = 0;
-car[755] = 754; cdr[755] = 0; tag[755] = 0;
-car[754] = u('6'); cdr[754] = 0; tag[754] = atomtag;
-car[753] = 752; cdr[753] = 750; tag[753] = 0;
-car[752] = 751; cdr[752] = 0; tag[752] = 0;
-car[751] = u('7'); cdr[751] = 0; tag[751] = atomtag;
-car[750] = 749; cdr[750] = 747; tag[750] = 0;
-car[749] = 748; cdr[749] = 0; tag[749] = 0;
-car[748] = u('8'); cdr[748] = 0; tag[748] = atomtag;
+car[786] = u('i'); cdr[786] = 785; tag[786] = atomtag;
+car[785] = u('m'); cdr[785] = 784; tag[785] = atomtag;
+car[784] = u('p'); cdr[784] = 783; tag[784] = atomtag;
+car[783] = u('l'); cdr[783] = 0; tag[783] = atomtag;
+car[782] = 639; cdr[782] = 0; tag[782] = 0;
+car[781] = 780; cdr[781] = 0; tag[781] = 0;
+car[780] = u('r'); cdr[780] = 779; tag[780] = atomtag;
+car[779] = u('e'); cdr[779] = 778; tag[779] = atomtag;
+car[778] = u('a'); cdr[778] = 777; tag[778] = atomtag;
+car[777] = u('d'); cdr[777] = 776; tag[777] = atomtag;
+car[776] = u('c'); cdr[776] = 0; tag[776] = atomtag;
+car[775] = 774; cdr[775] = 0; tag[775] = 0;
+car[774] = u('p'); cdr[774] = 773; tag[774] = atomtag;
+car[773] = u('e'); cdr[773] = 772; tag[773] = atomtag;
+car[772] = u('e'); cdr[772] = 771; tag[772] = atomtag;
+car[771] = u('k'); cdr[771] = 770; tag[771] = atomtag;
+car[770] = u('c'); cdr[770] = 0; tag[770] = atomtag;
+car[769] = 768; cdr[769] = 0; tag[769] = 0;
+car[768] = u('i'); cdr[768] = 767; tag[768] = atomtag;
+car[767] = u('n'); cdr[767] = 766; tag[767] = atomtag;
+car[766] = u('t'); cdr[766] = 765; tag[766] = atomtag;
+car[765] = u('e'); cdr[765] = 764; tag[765] = atomtag;
+car[764] = u('r'); cdr[764] = 763; tag[764] = atomtag;
+car[763] = u('n'); cdr[763] = 0; tag[763] = atomtag;
+car[762] = 761; cdr[762] = 0; tag[762] = 0;
+car[761] = u('v'); cdr[761] = 0; tag[761] = atomtag;
+car[760] = 759; cdr[760] = 0; tag[760] = 0;
+car[759] = u('f'); cdr[759] = 0; tag[759] = atomtag;
+car[758] = 135; cdr[758] = 757; tag[758] = 0;
+car[757] = 756; cdr[757] = 754; tag[757] = 0;
+car[756] = 755; cdr[756] = 0; tag[756] = 0;
+car[755] = u('m'); cdr[755] = 0; tag[755] = atomtag;
+car[754] = 412; cdr[754] = 0; tag[754] = 0;
+car[753] = 752; cdr[753] = 0; tag[753] = 0;
+car[752] = u('f'); cdr[752] = 751; tag[752] = atomtag;
+car[751] = u('i'); cdr[751] = 750; tag[751] = atomtag;
+car[750] = u('n'); cdr[750] = 749; tag[750] = atomtag;
+car[749] = u('d'); cdr[749] = 0; tag[749] = atomtag;
+car[748] = 135; cdr[748] = 0; tag[748] = 0;
 car[747] = 746; cdr[747] = 0; tag[747] = 0;
-car[746] = 745; cdr[746] = 0; tag[746] = 0;
-car[745] = u('9'); cdr[745] = 0; tag[745] = atomtag;
-car[744] = 743; cdr[744] = 0; tag[744] = 0;
-car[743] = u('e'); cdr[743] = 742; tag[743] = atomtag;
-car[742] = u('x'); cdr[742] = 741; tag[742] = atomtag;
-car[741] = u('p'); cdr[741] = 740; tag[741] = atomtag;
-car[740] = u('l'); cdr[740] = 739; tag[740] = atomtag;
-car[739] = u('o'); cdr[739] = 738; tag[739] = atomtag;
-car[738] = u('d'); cdr[738] = 737; tag[738] = atomtag;
-car[737] = u('e'); cdr[737] = 0; tag[737] = atomtag;
-car[736] = 735; cdr[736] = 0; tag[736] = 0;
-car[735] = u('e'); cdr[735] = 734; tag[735] = atomtag;
-car[734] = u('x'); cdr[734] = 733; tag[734] = atomtag;
-car[733] = u('p'); cdr[733] = 732; tag[733] = atomtag;
-car[732] = u('l'); cdr[732] = 731; tag[732] = atomtag;
-car[731] = u('o'); cdr[731] = 730; tag[731] = atomtag;
-car[730] = u('d'); cdr[730] = 729; tag[730] = atomtag;
-car[729] = u('e'); cdr[729] = 728; tag[729] = atomtag;
-car[728] = u(':'); cdr[728] = 727; tag[728] = atomtag;
-car[727] = u(' '); cdr[727] = 726; tag[727] = atomtag;
-car[726] = u('e'); cdr[726] = 725; tag[726] = atomtag;
-car[725] = u('x'); cdr[725] = 724; tag[725] = atomtag;
-car[724] = u('p'); cdr[724] = 723; tag[724] = atomtag;
+car[746] = u('f'); cdr[746] = 745; tag[746] = atomtag;
+car[745] = u('i'); cdr[745] = 744; tag[745] = atomtag;
+car[744] = u('r'); cdr[744] = 743; tag[744] = atomtag;
+car[743] = u('s'); cdr[743] = 742; tag[743] = atomtag;
+car[742] = u('t'); cdr[742] = 0; tag[742] = atomtag;
+car[741] = 135; cdr[741] = 0; tag[741] = 0;
+car[740] = 739; cdr[740] = 0; tag[740] = 0;
+car[739] = u('m'); cdr[739] = 738; tag[739] = atomtag;
+car[738] = u('k'); cdr[738] = 737; tag[738] = atomtag;
+car[737] = u('n'); cdr[737] = 736; tag[737] = atomtag;
+car[736] = u('a'); cdr[736] = 735; tag[736] = atomtag;
+car[735] = u('m'); cdr[735] = 734; tag[735] = atomtag;
+car[734] = u('e'); cdr[734] = 0; tag[734] = atomtag;
+car[733] = 600; cdr[733] = 732; tag[733] = 0;
+car[732] = 412; cdr[732] = 0; tag[732] = 0;
+car[731] = 730; cdr[731] = 0; tag[731] = 0;
+car[730] = u('s'); cdr[730] = 729; tag[730] = atomtag;
+car[729] = u('a'); cdr[729] = 728; tag[729] = atomtag;
+car[728] = u('m'); cdr[728] = 727; tag[728] = atomtag;
+car[727] = u('e'); cdr[727] = 726; tag[727] = atomtag;
+car[726] = u('n'); cdr[726] = 725; tag[726] = atomtag;
+car[725] = u('a'); cdr[725] = 724; tag[725] = atomtag;
+car[724] = u('m'); cdr[724] = 723; tag[724] = atomtag;
 car[723] = u('e'); cdr[723] = 722; tag[723] = atomtag;
-car[722] = u('c'); cdr[722] = 721; tag[722] = atomtag;
-car[721] = u('t'); cdr[721] = 720; tag[721] = atomtag;
-car[720] = u('e'); cdr[720] = 719; tag[720] = atomtag;
-car[719] = u('d'); cdr[719] = 718; tag[719] = atomtag;
-car[718] = u(' '); cdr[718] = 717; tag[718] = atomtag;
-car[717] = u('a'); cdr[717] = 716; tag[717] = atomtag;
-car[716] = u('t'); cdr[716] = 715; tag[716] = atomtag;
-car[715] = u('o'); cdr[715] = 714; tag[715] = atomtag;
-car[714] = u('m'); cdr[714] = 0; tag[714] = atomtag;
-car[713] = 570; cdr[713] = 712; tag[713] = 0;
-car[712] = 333; cdr[712] = 0; tag[712] = 0;
-car[711] = 710; cdr[711] = 0; tag[711] = 0;
-car[710] = u('e'); cdr[710] = 709; tag[710] = atomtag;
-car[709] = u('x'); cdr[709] = 708; tag[709] = atomtag;
-car[708] = u('p'); cdr[708] = 707; tag[708] = atomtag;
-car[707] = u('l'); cdr[707] = 0; tag[707] = atomtag;
-car[706] = 135; cdr[706] = 0; tag[706] = 0;
-car[705] = 704; cdr[705] = 0; tag[705] = 0;
-car[704] = u('m'); cdr[704] = 703; tag[704] = atomtag;
-car[703] = u('k'); cdr[703] = 702; tag[703] = atomtag;
-car[702] = u('a'); cdr[702] = 701; tag[702] = atomtag;
-car[701] = u('t'); cdr[701] = 700; tag[701] = atomtag;
-car[700] = u('o'); cdr[700] = 699; tag[700] = atomtag;
-car[699] = u('m'); cdr[699] = 0; tag[699] = atomtag;
-car[698] = 570; cdr[698] = 0; tag[698] = 0;
-car[697] = 696; cdr[697] = 0; tag[697] = 0;
-car[696] = u('i'); cdr[696] = 695; tag[696] = atomtag;
-car[695] = u('m'); cdr[695] = 694; tag[695] = atomtag;
-car[694] = u('p'); cdr[694] = 693; tag[694] = atomtag;
-car[693] = u('l'); cdr[693] = 692; tag[693] = atomtag;
-car[692] = u('o'); cdr[692] = 691; tag[692] = atomtag;
-car[691] = u('d'); cdr[691] = 690; tag[691] = atomtag;
-car[690] = u('e'); cdr[690] = 0; tag[690] = atomtag;
-car[689] = 135; cdr[689] = 0; tag[689] = 0;
-car[688] = 687; cdr[688] = 0; tag[688] = 0;
-car[687] = u('m'); cdr[687] = 686; tag[687] = atomtag;
-car[686] = u('a'); cdr[686] = 685; tag[686] = atomtag;
-car[685] = u('k'); cdr[685] = 684; tag[685] = atomtag;
-car[684] = u('e'); cdr[684] = 683; tag[684] = atomtag;
-car[683] = u('s'); cdr[683] = 682; tag[683] = atomtag;
-car[682] = u('y'); cdr[682] = 681; tag[682] = atomtag;
-car[681] = u('m'); cdr[681] = 0; tag[681] = atomtag;
-car[680] = 570; cdr[680] = 679; tag[680] = 0;
-car[679] = 333; cdr[679] = 0; tag[679] = 0;
-car[678] = 677; cdr[678] = 0; tag[678] = 0;
-car[677] = u('i'); cdr[677] = 676; tag[677] = atomtag;
-car[676] = u('m'); cdr[676] = 675; tag[676] = atomtag;
-car[675] = u('p'); cdr[675] = 674; tag[675] = atomtag;
-car[674] = u('l'); cdr[674] = 0; tag[674] = atomtag;
-car[673] = 570; cdr[673] = 0; tag[673] = 0;
-car[672] = 671; cdr[672] = 0; tag[672] = 0;
-car[671] = u('r'); cdr[671] = 670; tag[671] = atomtag;
-car[670] = u('e'); cdr[670] = 669; tag[670] = atomtag;
-car[669] = u('a'); cdr[669] = 668; tag[669] = atomtag;
-car[668] = u('d'); cdr[668] = 667; tag[668] = atomtag;
-car[667] = u('c'); cdr[667] = 0; tag[667] = atomtag;
-car[666] = 665; cdr[666] = 0; tag[666] = 0;
-car[665] = u('p'); cdr[665] = 664; tag[665] = atomtag;
-car[664] = u('e'); cdr[664] = 663; tag[664] = atomtag;
-car[663] = u('e'); cdr[663] = 662; tag[663] = atomtag;
-car[662] = u('k'); cdr[662] = 661; tag[662] = atomtag;
-car[661] = u('c'); cdr[661] = 0; tag[661] = atomtag;
-car[660] = 659; cdr[660] = 0; tag[660] = 0;
-car[659] = u('*'); cdr[659] = 658; tag[659] = atomtag;
-car[658] = u('p'); cdr[658] = 657; tag[658] = atomtag;
-car[657] = u('e'); cdr[657] = 656; tag[657] = atomtag;
-car[656] = u('e'); cdr[656] = 655; tag[656] = atomtag;
-car[655] = u('k'); cdr[655] = 654; tag[655] = atomtag;
-car[654] = u('e'); cdr[654] = 653; tag[654] = atomtag;
-car[653] = u('d'); cdr[653] = 0; tag[653] = atomtag;
-car[652] = 651; cdr[652] = 0; tag[652] = 0;
-car[651] = u('i'); cdr[651] = 650; tag[651] = atomtag;
-car[650] = u('n'); cdr[650] = 649; tag[650] = atomtag;
-car[649] = u('t'); cdr[649] = 648; tag[649] = atomtag;
-car[648] = u('e'); cdr[648] = 647; tag[648] = atomtag;
-car[647] = u('r'); cdr[647] = 646; tag[647] = atomtag;
-car[646] = u('n'); cdr[646] = 0; tag[646] = atomtag;
-car[645] = 644; cdr[645] = 0; tag[645] = 0;
-car[644] = u('v'); cdr[644] = 0; tag[644] = atomtag;
-car[643] = 642; cdr[643] = 0; tag[643] = 0;
-car[642] = u('f'); cdr[642] = 0; tag[642] = atomtag;
-car[641] = 135; cdr[641] = 640; tag[641] = 0;
-car[640] = 639; cdr[640] = 637; tag[640] = 0;
+car[722] = u('p'); cdr[722] = 0; tag[722] = atomtag;
+car[721] = 135; cdr[721] = 720; tag[721] = 0;
+car[720] = 153; cdr[720] = 0; tag[720] = 0;
+car[719] = 718; cdr[719] = 0; tag[719] = 0;
+car[718] = u('p'); cdr[718] = 717; tag[718] = atomtag;
+car[717] = u('r'); cdr[717] = 716; tag[717] = atomtag;
+car[716] = u('i'); cdr[716] = 715; tag[716] = atomtag;
+car[715] = u('n'); cdr[715] = 714; tag[715] = atomtag;
+car[714] = u('t'); cdr[714] = 0; tag[714] = atomtag;
+car[713] = 135; cdr[713] = 0; tag[713] = 0;
+car[712] = 711; cdr[712] = 0; tag[712] = 0;
+car[711] = u('p'); cdr[711] = 710; tag[711] = atomtag;
+car[710] = u('r'); cdr[710] = 709; tag[710] = atomtag;
+car[709] = u('i'); cdr[709] = 708; tag[709] = atomtag;
+car[708] = u('n'); cdr[708] = 707; tag[708] = atomtag;
+car[707] = u('1'); cdr[707] = 0; tag[707] = atomtag;
+car[706] = 705; cdr[706] = 0; tag[706] = 0;
+car[705] = u('>'); cdr[705] = 0; tag[705] = atomtag;
+car[704] = 703; cdr[704] = 0; tag[704] = 0;
+car[703] = u('<'); cdr[703] = 0; tag[703] = atomtag;
+car[702] = 701; cdr[702] = 0; tag[702] = 0;
+car[701] = u('<'); cdr[701] = 700; tag[701] = atomtag;
+car[700] = u('f'); cdr[700] = 699; tag[700] = atomtag;
+car[699] = u('u'); cdr[699] = 698; tag[699] = atomtag;
+car[698] = u('n'); cdr[698] = 697; tag[698] = atomtag;
+car[697] = u('c'); cdr[697] = 696; tag[697] = atomtag;
+car[696] = u('t'); cdr[696] = 695; tag[696] = atomtag;
+car[695] = u('i'); cdr[695] = 694; tag[695] = atomtag;
+car[694] = u('o'); cdr[694] = 693; tag[694] = atomtag;
+car[693] = u('n'); cdr[693] = 692; tag[693] = atomtag;
+car[692] = u('>'); cdr[692] = 0; tag[692] = atomtag;
+car[691] = 690; cdr[691] = 0; tag[691] = 0;
+car[690] = u('l'); cdr[690] = 0; tag[690] = atomtag;
+car[689] = 688; cdr[689] = 0; tag[689] = 0;
+car[688] = u('i'); cdr[688] = 0; tag[688] = atomtag;
+car[687] = 135; cdr[687] = 0; tag[687] = 0;
+car[686] = 685; cdr[686] = 0; tag[686] = 0;
+car[685] = u(' '); cdr[685] = 0; tag[685] = atomtag;
+car[684] = 683; cdr[684] = 0; tag[684] = 0;
+car[683] = u('p'); cdr[683] = 682; tag[683] = atomtag;
+car[682] = u('r'); cdr[682] = 0; tag[682] = atomtag;
+car[681] = 680; cdr[681] = 0; tag[681] = 0;
+car[680] = u('.'); cdr[680] = 679; tag[680] = atomtag;
+car[679] = u(' '); cdr[679] = 0; tag[679] = atomtag;
+car[678] = 135; cdr[678] = 0; tag[678] = 0;
+car[677] = 676; cdr[677] = 0; tag[677] = 0;
+car[676] = u('p'); cdr[676] = 675; tag[676] = atomtag;
+car[675] = u('r'); cdr[675] = 674; tag[675] = atomtag;
+car[674] = u('-'); cdr[674] = 673; tag[674] = atomtag;
+car[673] = u('m'); cdr[673] = 672; tag[673] = atomtag;
+car[672] = u('e'); cdr[672] = 671; tag[672] = atomtag;
+car[671] = u('m'); cdr[671] = 0; tag[671] = atomtag;
+car[670] = 669; cdr[670] = 0; tag[670] = 0;
+car[669] = u('9'); cdr[669] = 0; tag[669] = atomtag;
+car[668] = 667; cdr[668] = 0; tag[668] = 0;
+car[667] = u('8'); cdr[667] = 0; tag[667] = atomtag;
+car[666] = 9; cdr[666] = 0; tag[666] = numtag;
+car[665] = 664; cdr[665] = 0; tag[665] = 0;
+car[664] = u('7'); cdr[664] = 0; tag[664] = atomtag;
+car[663] = 8; cdr[663] = 0; tag[663] = numtag;
+car[662] = 661; cdr[662] = 0; tag[662] = 0;
+car[661] = u('6'); cdr[661] = 0; tag[661] = atomtag;
+car[660] = 7; cdr[660] = 0; tag[660] = numtag;
+car[659] = 658; cdr[659] = 0; tag[659] = 0;
+car[658] = u('5'); cdr[658] = 0; tag[658] = atomtag;
+car[657] = 6; cdr[657] = 0; tag[657] = numtag;
+car[656] = 655; cdr[656] = 0; tag[656] = 0;
+car[655] = u('4'); cdr[655] = 0; tag[655] = atomtag;
+car[654] = 5; cdr[654] = 0; tag[654] = numtag;
+car[653] = 652; cdr[653] = 0; tag[653] = 0;
+car[652] = u('3'); cdr[652] = 0; tag[652] = atomtag;
+car[651] = 4; cdr[651] = 0; tag[651] = numtag;
+car[650] = 649; cdr[650] = 0; tag[650] = 0;
+car[649] = u('2'); cdr[649] = 0; tag[649] = atomtag;
+car[648] = 3; cdr[648] = 0; tag[648] = numtag;
+car[647] = 646; cdr[647] = 0; tag[647] = 0;
+car[646] = u('1'); cdr[646] = 0; tag[646] = atomtag;
+car[645] = 2; cdr[645] = 0; tag[645] = numtag;
+car[644] = 643; cdr[644] = 0; tag[644] = 0;
+car[643] = u('0'); cdr[643] = 0; tag[643] = atomtag;
+car[642] = 1; cdr[642] = 0; tag[642] = numtag;
+car[641] = 10; cdr[641] = 0; tag[641] = numtag;
+car[640] = 639; cdr[640] = 0; tag[640] = 0;
 car[639] = 638; cdr[639] = 0; tag[639] = 0;
-car[638] = u('m'); cdr[638] = 0; tag[638] = atomtag;
-car[637] = 333; cdr[637] = 0; tag[637] = 0;
-car[636] = 635; cdr[636] = 0; tag[636] = 0;
-car[635] = u('f'); cdr[635] = 634; tag[635] = atomtag;
-car[634] = u('i'); cdr[634] = 633; tag[634] = atomtag;
+car[638] = u('n'); cdr[638] = 0; tag[638] = atomtag;
+car[637] = 636; cdr[637] = 0; tag[637] = 0;
+car[636] = u('p'); cdr[636] = 635; tag[636] = atomtag;
+car[635] = u('r'); cdr[635] = 634; tag[635] = atomtag;
+car[634] = u('-'); cdr[634] = 633; tag[634] = atomtag;
 car[633] = u('n'); cdr[633] = 632; tag[633] = atomtag;
-car[632] = u('d'); cdr[632] = 0; tag[632] = atomtag;
-car[631] = 135; cdr[631] = 0; tag[631] = 0;
-car[630] = 629; cdr[630] = 0; tag[630] = 0;
-car[629] = u('f'); cdr[629] = 628; tag[629] = atomtag;
-car[628] = u('i'); cdr[628] = 627; tag[628] = atomtag;
+car[632] = u('u'); cdr[632] = 631; tag[632] = atomtag;
+car[631] = u('m'); cdr[631] = 0; tag[631] = atomtag;
+car[630] = 135; cdr[630] = 0; tag[630] = 0;
+car[629] = 628; cdr[629] = 0; tag[629] = 0;
+car[628] = u('p'); cdr[628] = 627; tag[628] = atomtag;
 car[627] = u('r'); cdr[627] = 626; tag[627] = atomtag;
-car[626] = u('s'); cdr[626] = 625; tag[626] = atomtag;
-car[625] = u('t'); cdr[625] = 0; tag[625] = atomtag;
-car[624] = 135; cdr[624] = 0; tag[624] = 0;
-car[623] = 622; cdr[623] = 0; tag[623] = 0;
-car[622] = u('m'); cdr[622] = 621; tag[622] = atomtag;
-car[621] = u('k'); cdr[621] = 620; tag[621] = atomtag;
-car[620] = u('n'); cdr[620] = 619; tag[620] = atomtag;
-car[619] = u('a'); cdr[619] = 618; tag[619] = atomtag;
-car[618] = u('m'); cdr[618] = 617; tag[618] = atomtag;
-car[617] = u('e'); cdr[617] = 0; tag[617] = atomtag;
-car[616] = 521; cdr[616] = 615; tag[616] = 0;
-car[615] = 333; cdr[615] = 0; tag[615] = 0;
-car[614] = 613; cdr[614] = 0; tag[614] = 0;
-car[613] = u('s'); cdr[613] = 612; tag[613] = atomtag;
-car[612] = u('a'); cdr[612] = 611; tag[612] = atomtag;
-car[611] = u('m'); cdr[611] = 610; tag[611] = atomtag;
-car[610] = u('e'); cdr[610] = 609; tag[610] = atomtag;
-car[609] = u('n'); cdr[609] = 608; tag[609] = atomtag;
-car[608] = u('a'); cdr[608] = 607; tag[608] = atomtag;
-car[607] = u('m'); cdr[607] = 606; tag[607] = atomtag;
-car[606] = u('e'); cdr[606] = 605; tag[606] = atomtag;
-car[605] = u('p'); cdr[605] = 0; tag[605] = atomtag;
-car[604] = 135; cdr[604] = 603; tag[604] = 0;
-car[603] = 153; cdr[603] = 0; tag[603] = 0;
-car[602] = 601; cdr[602] = 0; tag[602] = 0;
-car[601] = u('p'); cdr[601] = 600; tag[601] = atomtag;
-car[600] = u('r'); cdr[600] = 599; tag[600] = atomtag;
-car[599] = u('i'); cdr[599] = 598; tag[599] = atomtag;
-car[598] = u('n'); cdr[598] = 597; tag[598] = atomtag;
-car[597] = u('t'); cdr[597] = 0; tag[597] = atomtag;
-car[596] = 135; cdr[596] = 0; tag[596] = 0;
-car[595] = 594; cdr[595] = 0; tag[595] = 0;
-car[594] = u('p'); cdr[594] = 593; tag[594] = atomtag;
-car[593] = u('r'); cdr[593] = 592; tag[593] = atomtag;
-car[592] = u('i'); cdr[592] = 591; tag[592] = atomtag;
-car[591] = u('n'); cdr[591] = 590; tag[591] = atomtag;
-car[590] = u('1'); cdr[590] = 0; tag[590] = atomtag;
-car[589] = 588; cdr[589] = 0; tag[589] = 0;
-car[588] = u('>'); cdr[588] = 0; tag[588] = atomtag;
-car[587] = 586; cdr[587] = 0; tag[587] = 0;
-car[586] = u('<'); cdr[586] = 0; tag[586] = atomtag;
+car[626] = u('-'); cdr[626] = 625; tag[626] = atomtag;
+car[625] = u('a'); cdr[625] = 624; tag[625] = atomtag;
+car[624] = u('t'); cdr[624] = 623; tag[624] = atomtag;
+car[623] = u('o'); cdr[623] = 622; tag[623] = atomtag;
+car[622] = u('m'); cdr[622] = 0; tag[622] = atomtag;
+car[621] = 135; cdr[621] = 0; tag[621] = 0;
+car[620] = 619; cdr[620] = 0; tag[620] = 0;
+car[619] = u('p'); cdr[619] = 618; tag[619] = atomtag;
+car[618] = u('r'); cdr[618] = 617; tag[618] = atomtag;
+car[617] = u('c'); cdr[617] = 0; tag[617] = atomtag;
+car[616] = 135; cdr[616] = 0; tag[616] = 0;
+car[615] = 614; cdr[615] = 0; tag[615] = 0;
+car[614] = u('t'); cdr[614] = 613; tag[614] = atomtag;
+car[613] = u('e'); cdr[613] = 612; tag[613] = atomtag;
+car[612] = u('r'); cdr[612] = 611; tag[612] = atomtag;
+car[611] = u('p'); cdr[611] = 610; tag[611] = atomtag;
+car[610] = u('r'); cdr[610] = 609; tag[610] = atomtag;
+car[609] = u('i'); cdr[609] = 0; tag[609] = atomtag;
+car[608] = 607; cdr[608] = 0; tag[608] = 0;
+car[607] = u('w'); cdr[607] = 606; tag[607] = atomtag;
+car[606] = u('r'); cdr[606] = 605; tag[606] = atomtag;
+car[605] = u('i'); cdr[605] = 604; tag[605] = atomtag;
+car[604] = u('t'); cdr[604] = 603; tag[604] = atomtag;
+car[603] = u('e'); cdr[603] = 602; tag[603] = atomtag;
+car[602] = u('c'); cdr[602] = 0; tag[602] = atomtag;
+car[601] = 600; cdr[601] = 0; tag[601] = 0;
+car[600] = 599; cdr[600] = 0; tag[600] = 0;
+car[599] = u('c'); cdr[599] = 0; tag[599] = atomtag;
+car[598] = 597; cdr[598] = 0; tag[598] = 0;
+car[597] = u('r'); cdr[597] = 596; tag[597] = atomtag;
+car[596] = u('r'); cdr[596] = 595; tag[596] = atomtag;
+car[595] = u('e'); cdr[595] = 594; tag[595] = atomtag;
+car[594] = u('d'); cdr[594] = 593; tag[594] = atomtag;
+car[593] = u('u'); cdr[593] = 592; tag[593] = atomtag;
+car[592] = u('c'); cdr[592] = 591; tag[592] = atomtag;
+car[591] = u('e'); cdr[591] = 0; tag[591] = atomtag;
+car[590] = 412; cdr[590] = 589; tag[590] = 0;
+car[589] = 543; cdr[589] = 0; tag[589] = 0;
+car[588] = 536; cdr[588] = 587; tag[588] = 0;
+car[587] = 555; cdr[587] = 586; tag[587] = 0;
+car[586] = 532; cdr[586] = 0; tag[586] = 0;
 car[585] = 584; cdr[585] = 0; tag[585] = 0;
-car[584] = u('<'); cdr[584] = 583; tag[584] = atomtag;
-car[583] = u('f'); cdr[583] = 582; tag[583] = atomtag;
-car[582] = u('u'); cdr[582] = 581; tag[582] = atomtag;
-car[581] = u('n'); cdr[581] = 580; tag[581] = atomtag;
+car[584] = u('r'); cdr[584] = 583; tag[584] = atomtag;
+car[583] = u('e'); cdr[583] = 582; tag[583] = atomtag;
+car[582] = u('d'); cdr[582] = 581; tag[582] = atomtag;
+car[581] = u('u'); cdr[581] = 580; tag[581] = atomtag;
 car[580] = u('c'); cdr[580] = 579; tag[580] = atomtag;
-car[579] = u('t'); cdr[579] = 578; tag[579] = atomtag;
-car[578] = u('i'); cdr[578] = 577; tag[578] = atomtag;
-car[577] = u('o'); cdr[577] = 576; tag[577] = atomtag;
-car[576] = u('n'); cdr[576] = 575; tag[576] = atomtag;
-car[575] = u('>'); cdr[575] = 0; tag[575] = atomtag;
-car[574] = 573; cdr[574] = 0; tag[574] = 0;
-car[573] = u('l'); cdr[573] = 0; tag[573] = atomtag;
-car[572] = 571; cdr[572] = 0; tag[572] = 0;
-car[571] = u('i'); cdr[571] = 0; tag[571] = atomtag;
-car[570] = 569; cdr[570] = 0; tag[570] = 0;
-car[569] = u('n'); cdr[569] = 0; tag[569] = atomtag;
-car[568] = 135; cdr[568] = 0; tag[568] = 0;
-car[567] = 566; cdr[567] = 0; tag[567] = 0;
-car[566] = u(' '); cdr[566] = 0; tag[566] = atomtag;
-car[565] = 564; cdr[565] = 0; tag[565] = 0;
-car[564] = u('p'); cdr[564] = 563; tag[564] = atomtag;
-car[563] = u('r'); cdr[563] = 0; tag[563] = atomtag;
-car[562] = 561; cdr[562] = 0; tag[562] = 0;
-car[561] = u('.'); cdr[561] = 560; tag[561] = atomtag;
-car[560] = u(' '); cdr[560] = 0; tag[560] = atomtag;
-car[559] = 135; cdr[559] = 0; tag[559] = 0;
-car[558] = 557; cdr[558] = 0; tag[558] = 0;
-car[557] = u('p'); cdr[557] = 556; tag[557] = atomtag;
-car[556] = u('r'); cdr[556] = 555; tag[556] = atomtag;
-car[555] = u('-'); cdr[555] = 554; tag[555] = atomtag;
-car[554] = u('m'); cdr[554] = 553; tag[554] = atomtag;
-car[553] = u('e'); cdr[553] = 552; tag[553] = atomtag;
-car[552] = u('m'); cdr[552] = 0; tag[552] = atomtag;
-car[551] = 135; cdr[551] = 0; tag[551] = 0;
-car[550] = 549; cdr[550] = 0; tag[550] = 0;
+car[579] = u('e'); cdr[579] = 0; tag[579] = atomtag;
+car[578] = 412; cdr[578] = 577; tag[578] = 0;
+car[577] = 543; cdr[577] = 0; tag[577] = 0;
+car[576] = 575; cdr[576] = 0; tag[576] = 0;
+car[575] = u('r'); cdr[575] = 574; tag[575] = atomtag;
+car[574] = u('e'); cdr[574] = 573; tag[574] = atomtag;
+car[573] = u('d'); cdr[573] = 0; tag[573] = atomtag;
+car[572] = 536; cdr[572] = 571; tag[572] = 0;
+car[571] = 555; cdr[571] = 570; tag[571] = 0;
+car[570] = 532; cdr[570] = 0; tag[570] = 0;
+car[569] = 568; cdr[569] = 0; tag[569] = 0;
+car[568] = u('m'); cdr[568] = 567; tag[568] = atomtag;
+car[567] = u('a'); cdr[567] = 566; tag[567] = atomtag;
+car[566] = u('p'); cdr[566] = 565; tag[566] = atomtag;
+car[565] = u('c'); cdr[565] = 564; tag[565] = atomtag;
+car[564] = u('a'); cdr[564] = 563; tag[564] = atomtag;
+car[563] = u('r'); cdr[563] = 562; tag[563] = atomtag;
+car[562] = u('2'); cdr[562] = 0; tag[562] = atomtag;
+car[561] = 412; cdr[561] = 560; tag[561] = 0;
+car[560] = 409; cdr[560] = 559; tag[560] = 0;
+car[559] = 543; cdr[559] = 0; tag[559] = 0;
+car[558] = 536; cdr[558] = 557; tag[558] = 0;
+car[557] = 532; cdr[557] = 556; tag[557] = 0;
+car[556] = 555; cdr[556] = 0; tag[556] = 0;
+car[555] = 554; cdr[555] = 0; tag[555] = 0;
+car[554] = u('*'); cdr[554] = 553; tag[554] = atomtag;
+car[553] = u('b'); cdr[553] = 0; tag[553] = atomtag;
+car[552] = 551; cdr[552] = 0; tag[552] = 0;
+car[551] = u('m'); cdr[551] = 550; tag[551] = atomtag;
+car[550] = u('a'); cdr[550] = 549; tag[550] = atomtag;
 car[549] = u('p'); cdr[549] = 548; tag[549] = atomtag;
-car[548] = u('r'); cdr[548] = 547; tag[548] = atomtag;
-car[547] = u('-'); cdr[547] = 546; tag[547] = atomtag;
-car[546] = u('a'); cdr[546] = 545; tag[546] = atomtag;
-car[545] = u('t'); cdr[545] = 544; tag[545] = atomtag;
-car[544] = u('o'); cdr[544] = 543; tag[544] = atomtag;
-car[543] = u('m'); cdr[543] = 0; tag[543] = atomtag;
-car[542] = 135; cdr[542] = 0; tag[542] = 0;
+car[548] = u('c'); cdr[548] = 547; tag[548] = atomtag;
+car[547] = u('a'); cdr[547] = 546; tag[547] = atomtag;
+car[546] = u('r'); cdr[546] = 0; tag[546] = atomtag;
+car[545] = 412; cdr[545] = 544; tag[545] = 0;
+car[544] = 543; cdr[544] = 0; tag[544] = 0;
+car[543] = 542; cdr[543] = 0; tag[543] = 0;
+car[542] = u('r'); cdr[542] = 0; tag[542] = atomtag;
 car[541] = 540; cdr[541] = 0; tag[541] = 0;
-car[540] = u('p'); cdr[540] = 539; tag[540] = atomtag;
-car[539] = u('r'); cdr[539] = 538; tag[539] = atomtag;
-car[538] = u('c'); cdr[538] = 0; tag[538] = atomtag;
-car[537] = 135; cdr[537] = 0; tag[537] = 0;
+car[540] = u('m'); cdr[540] = 539; tag[540] = atomtag;
+car[539] = u('a'); cdr[539] = 538; tag[539] = atomtag;
+car[538] = u('p'); cdr[538] = 0; tag[538] = atomtag;
+car[537] = 536; cdr[537] = 533; tag[537] = 0;
 car[536] = 535; cdr[536] = 0; tag[536] = 0;
-car[535] = u('t'); cdr[535] = 534; tag[535] = atomtag;
-car[534] = u('e'); cdr[534] = 533; tag[534] = atomtag;
-car[533] = u('r'); cdr[533] = 532; tag[533] = atomtag;
-car[532] = u('p'); cdr[532] = 531; tag[532] = atomtag;
-car[531] = u('r'); cdr[531] = 530; tag[531] = atomtag;
-car[530] = u('i'); cdr[530] = 0; tag[530] = atomtag;
+car[535] = u('*'); cdr[535] = 534; tag[535] = atomtag;
+car[534] = u('f'); cdr[534] = 0; tag[534] = atomtag;
+car[533] = 532; cdr[533] = 0; tag[533] = 0;
+car[532] = 531; cdr[532] = 0; tag[532] = 0;
+car[531] = u('*'); cdr[531] = 530; tag[531] = atomtag;
+car[530] = u('a'); cdr[530] = 0; tag[530] = atomtag;
 car[529] = 528; cdr[529] = 0; tag[529] = 0;
-car[528] = u('w'); cdr[528] = 527; tag[528] = atomtag;
-car[527] = u('r'); cdr[527] = 526; tag[527] = atomtag;
-car[526] = u('i'); cdr[526] = 525; tag[526] = atomtag;
-car[525] = u('t'); cdr[525] = 524; tag[525] = atomtag;
-car[524] = u('e'); cdr[524] = 523; tag[524] = atomtag;
-car[523] = u('c'); cdr[523] = 0; tag[523] = atomtag;
-car[522] = 521; cdr[522] = 0; tag[522] = 0;
+car[528] = u('a'); cdr[528] = 527; tag[528] = atomtag;
+car[527] = u('s'); cdr[527] = 526; tag[527] = atomtag;
+car[526] = u('s'); cdr[526] = 525; tag[526] = atomtag;
+car[525] = u('o'); cdr[525] = 524; tag[525] = atomtag;
+car[524] = u('c'); cdr[524] = 0; tag[524] = atomtag;
+car[523] = 135; cdr[523] = 522; tag[523] = 0;
+car[522] = 412; cdr[522] = 0; tag[522] = 0;
 car[521] = 520; cdr[521] = 0; tag[521] = 0;
-car[520] = u('c'); cdr[520] = 0; tag[520] = atomtag;
-car[519] = 518; cdr[519] = 0; tag[519] = 0;
-car[518] = u('r'); cdr[518] = 517; tag[518] = atomtag;
-car[517] = u('r'); cdr[517] = 516; tag[517] = atomtag;
+car[520] = u('m'); cdr[520] = 519; tag[520] = atomtag;
+car[519] = u('e'); cdr[519] = 518; tag[519] = atomtag;
+car[518] = u('m'); cdr[518] = 517; tag[518] = atomtag;
+car[517] = u('b'); cdr[517] = 516; tag[517] = atomtag;
 car[516] = u('e'); cdr[516] = 515; tag[516] = atomtag;
-car[515] = u('d'); cdr[515] = 514; tag[515] = atomtag;
-car[514] = u('u'); cdr[514] = 513; tag[514] = atomtag;
-car[513] = u('c'); cdr[513] = 512; tag[513] = atomtag;
-car[512] = u('e'); cdr[512] = 0; tag[512] = atomtag;
-car[511] = 333; cdr[511] = 510; tag[511] = 0;
-car[510] = 464; cdr[510] = 0; tag[510] = 0;
-car[509] = 457; cdr[509] = 508; tag[509] = 0;
-car[508] = 476; cdr[508] = 507; tag[508] = 0;
-car[507] = 453; cdr[507] = 0; tag[507] = 0;
-car[506] = 505; cdr[506] = 0; tag[506] = 0;
-car[505] = u('r'); cdr[505] = 504; tag[505] = atomtag;
-car[504] = u('e'); cdr[504] = 503; tag[504] = atomtag;
-car[503] = u('d'); cdr[503] = 502; tag[503] = atomtag;
-car[502] = u('u'); cdr[502] = 501; tag[502] = atomtag;
-car[501] = u('c'); cdr[501] = 500; tag[501] = atomtag;
-car[500] = u('e'); cdr[500] = 0; tag[500] = atomtag;
-car[499] = 333; cdr[499] = 498; tag[499] = 0;
-car[498] = 464; cdr[498] = 0; tag[498] = 0;
-car[497] = 496; cdr[497] = 0; tag[497] = 0;
-car[496] = u('r'); cdr[496] = 495; tag[496] = atomtag;
-car[495] = u('e'); cdr[495] = 494; tag[495] = atomtag;
-car[494] = u('d'); cdr[494] = 0; tag[494] = atomtag;
-car[493] = 457; cdr[493] = 492; tag[493] = 0;
-car[492] = 476; cdr[492] = 491; tag[492] = 0;
-car[491] = 453; cdr[491] = 0; tag[491] = 0;
-car[490] = 489; cdr[490] = 0; tag[490] = 0;
-car[489] = u('m'); cdr[489] = 488; tag[489] = atomtag;
+car[515] = u('r'); cdr[515] = 0; tag[515] = atomtag;
+car[514] = 135; cdr[514] = 513; tag[514] = 0;
+car[513] = 412; cdr[513] = 0; tag[513] = 0;
+car[512] = 511; cdr[512] = 0; tag[512] = 0;
+car[511] = u('e'); cdr[511] = 510; tag[511] = atomtag;
+car[510] = u('q'); cdr[510] = 509; tag[510] = atomtag;
+car[509] = u('u'); cdr[509] = 508; tag[509] = atomtag;
+car[508] = u('a'); cdr[508] = 507; tag[508] = atomtag;
+car[507] = u('l'); cdr[507] = 0; tag[507] = atomtag;
+car[506] = 412; cdr[506] = 505; tag[506] = 0;
+car[505] = 409; cdr[505] = 0; tag[505] = 0;
+car[504] = 503; cdr[504] = 0; tag[504] = 0;
+car[503] = u('n'); cdr[503] = 502; tag[503] = atomtag;
+car[502] = u('c'); cdr[502] = 501; tag[502] = atomtag;
+car[501] = u('o'); cdr[501] = 500; tag[501] = atomtag;
+car[500] = u('n'); cdr[500] = 499; tag[500] = atomtag;
+car[499] = u('c'); cdr[499] = 0; tag[499] = atomtag;
+car[498] = 412; cdr[498] = 497; tag[498] = 0;
+car[497] = 409; cdr[497] = 0; tag[497] = 0;
+car[496] = 495; cdr[496] = 0; tag[496] = 0;
+car[495] = u('l'); cdr[495] = 494; tag[495] = atomtag;
+car[494] = u('o'); cdr[494] = 493; tag[494] = atomtag;
+car[493] = u('o'); cdr[493] = 492; tag[493] = atomtag;
+car[492] = u('p'); cdr[492] = 0; tag[492] = atomtag;
+car[491] = 412; cdr[491] = 490; tag[491] = 0;
+car[490] = 409; cdr[490] = 0; tag[490] = 0;
+car[489] = 488; cdr[489] = 0; tag[489] = 0;
 car[488] = u('a'); cdr[488] = 487; tag[488] = atomtag;
 car[487] = u('p'); cdr[487] = 486; tag[487] = atomtag;
-car[486] = u('c'); cdr[486] = 485; tag[486] = atomtag;
-car[485] = u('a'); cdr[485] = 484; tag[485] = atomtag;
-car[484] = u('r'); cdr[484] = 483; tag[484] = atomtag;
-car[483] = u('2'); cdr[483] = 0; tag[483] = atomtag;
-car[482] = 333; cdr[482] = 481; tag[482] = 0;
-car[481] = 330; cdr[481] = 480; tag[481] = 0;
-car[480] = 464; cdr[480] = 0; tag[480] = 0;
-car[479] = 457; cdr[479] = 478; tag[479] = 0;
-car[478] = 453; cdr[478] = 477; tag[478] = 0;
-car[477] = 476; cdr[477] = 0; tag[477] = 0;
-car[476] = 475; cdr[476] = 0; tag[476] = 0;
-car[475] = u('*'); cdr[475] = 474; tag[475] = atomtag;
-car[474] = u('b'); cdr[474] = 0; tag[474] = atomtag;
-car[473] = 472; cdr[473] = 0; tag[473] = 0;
-car[472] = u('m'); cdr[472] = 471; tag[472] = atomtag;
-car[471] = u('a'); cdr[471] = 470; tag[471] = atomtag;
-car[470] = u('p'); cdr[470] = 469; tag[470] = atomtag;
-car[469] = u('c'); cdr[469] = 468; tag[469] = atomtag;
-car[468] = u('a'); cdr[468] = 467; tag[468] = atomtag;
-car[467] = u('r'); cdr[467] = 0; tag[467] = atomtag;
-car[466] = 333; cdr[466] = 465; tag[466] = 0;
-car[465] = 464; cdr[465] = 0; tag[465] = 0;
-car[464] = 463; cdr[464] = 0; tag[464] = 0;
-car[463] = u('r'); cdr[463] = 0; tag[463] = atomtag;
-car[462] = 461; cdr[462] = 0; tag[462] = 0;
-car[461] = u('m'); cdr[461] = 460; tag[461] = atomtag;
-car[460] = u('a'); cdr[460] = 459; tag[460] = atomtag;
-car[459] = u('p'); cdr[459] = 0; tag[459] = atomtag;
-car[458] = 457; cdr[458] = 454; tag[458] = 0;
-car[457] = 456; cdr[457] = 0; tag[457] = 0;
-car[456] = u('*'); cdr[456] = 455; tag[456] = atomtag;
-car[455] = u('f'); cdr[455] = 0; tag[455] = atomtag;
-car[454] = 453; cdr[454] = 0; tag[454] = 0;
-car[453] = 452; cdr[453] = 0; tag[453] = 0;
-car[452] = u('*'); cdr[452] = 451; tag[452] = atomtag;
-car[451] = u('a'); cdr[451] = 0; tag[451] = atomtag;
-car[450] = 449; cdr[450] = 0; tag[450] = 0;
-car[449] = u('a'); cdr[449] = 448; tag[449] = atomtag;
-car[448] = u('s'); cdr[448] = 447; tag[448] = atomtag;
-car[447] = u('s'); cdr[447] = 446; tag[447] = atomtag;
-car[446] = u('o'); cdr[446] = 445; tag[446] = atomtag;
-car[445] = u('c'); cdr[445] = 0; tag[445] = atomtag;
-car[444] = 135; cdr[444] = 443; tag[444] = 0;
-car[443] = 333; cdr[443] = 0; tag[443] = 0;
-car[442] = 441; cdr[442] = 0; tag[442] = 0;
-car[441] = u('m'); cdr[441] = 440; tag[441] = atomtag;
-car[440] = u('e'); cdr[440] = 439; tag[440] = atomtag;
-car[439] = u('m'); cdr[439] = 438; tag[439] = atomtag;
-car[438] = u('b'); cdr[438] = 437; tag[438] = atomtag;
-car[437] = u('e'); cdr[437] = 436; tag[437] = atomtag;
-car[436] = u('r'); cdr[436] = 0; tag[436] = atomtag;
-car[435] = 135; cdr[435] = 434; tag[435] = 0;
-car[434] = 333; cdr[434] = 0; tag[434] = 0;
-car[433] = 432; cdr[433] = 0; tag[433] = 0;
-car[432] = u('e'); cdr[432] = 431; tag[432] = atomtag;
-car[431] = u('q'); cdr[431] = 430; tag[431] = atomtag;
-car[430] = u('u'); cdr[430] = 429; tag[430] = atomtag;
-car[429] = u('a'); cdr[429] = 428; tag[429] = atomtag;
-car[428] = u('l'); cdr[428] = 0; tag[428] = atomtag;
-car[427] = 333; cdr[427] = 426; tag[427] = 0;
-car[426] = 330; cdr[426] = 0; tag[426] = 0;
-car[425] = 424; cdr[425] = 0; tag[425] = 0;
-car[424] = u('n'); cdr[424] = 423; tag[424] = atomtag;
-car[423] = u('c'); cdr[423] = 422; tag[423] = atomtag;
-car[422] = u('o'); cdr[422] = 421; tag[422] = atomtag;
-car[421] = u('n'); cdr[421] = 420; tag[421] = atomtag;
-car[420] = u('c'); cdr[420] = 0; tag[420] = atomtag;
-car[419] = 333; cdr[419] = 418; tag[419] = 0;
-car[418] = 330; cdr[418] = 0; tag[418] = 0;
-car[417] = 416; cdr[417] = 0; tag[417] = 0;
-car[416] = u('l'); cdr[416] = 415; tag[416] = atomtag;
-car[415] = u('o'); cdr[415] = 414; tag[415] = atomtag;
-car[414] = u('o'); cdr[414] = 413; tag[414] = atomtag;
-car[413] = u('p'); cdr[413] = 0; tag[413] = atomtag;
-car[412] = 333; cdr[412] = 411; tag[412] = 0;
-car[411] = 330; cdr[411] = 0; tag[411] = 0;
+car[486] = u('p'); cdr[486] = 485; tag[486] = atomtag;
+car[485] = u('e'); cdr[485] = 484; tag[485] = atomtag;
+car[484] = u('n'); cdr[484] = 483; tag[484] = atomtag;
+car[483] = u('d'); cdr[483] = 0; tag[483] = atomtag;
+car[482] = 412; cdr[482] = 481; tag[482] = 0;
+car[481] = 409; cdr[481] = 0; tag[481] = 0;
+car[480] = 479; cdr[480] = 0; tag[480] = 0;
+car[479] = u('n'); cdr[479] = 478; tag[479] = atomtag;
+car[478] = u('r'); cdr[478] = 477; tag[478] = atomtag;
+car[477] = u('e'); cdr[477] = 476; tag[477] = atomtag;
+car[476] = u('v'); cdr[476] = 475; tag[476] = atomtag;
+car[475] = u('e'); cdr[475] = 474; tag[475] = atomtag;
+car[474] = u('r'); cdr[474] = 473; tag[474] = atomtag;
+car[473] = u('s'); cdr[473] = 472; tag[473] = atomtag;
+car[472] = u('e'); cdr[472] = 0; tag[472] = atomtag;
+car[471] = 470; cdr[471] = 0; tag[471] = 0;
+car[470] = u('n'); cdr[470] = 469; tag[470] = atomtag;
+car[469] = u('r'); cdr[469] = 468; tag[469] = atomtag;
+car[468] = u('e'); cdr[468] = 467; tag[468] = atomtag;
+car[467] = u('v'); cdr[467] = 466; tag[467] = atomtag;
+car[466] = u('e'); cdr[466] = 465; tag[466] = atomtag;
+car[465] = u('r'); cdr[465] = 464; tag[465] = atomtag;
+car[464] = u('s'); cdr[464] = 463; tag[464] = atomtag;
+car[463] = u('e'); cdr[463] = 462; tag[463] = atomtag;
+car[462] = u(':'); cdr[462] = 461; tag[462] = atomtag;
+car[461] = u(' '); cdr[461] = 460; tag[461] = atomtag;
+car[460] = u('e'); cdr[460] = 459; tag[460] = atomtag;
+car[459] = u('x'); cdr[459] = 458; tag[459] = atomtag;
+car[458] = u('p'); cdr[458] = 457; tag[458] = atomtag;
+car[457] = u('e'); cdr[457] = 456; tag[457] = atomtag;
+car[456] = u('c'); cdr[456] = 455; tag[456] = atomtag;
+car[455] = u('t'); cdr[455] = 454; tag[455] = atomtag;
+car[454] = u('e'); cdr[454] = 453; tag[454] = atomtag;
+car[453] = u('d'); cdr[453] = 452; tag[453] = atomtag;
+car[452] = u(' '); cdr[452] = 451; tag[452] = atomtag;
+car[451] = u('l'); cdr[451] = 450; tag[451] = atomtag;
+car[450] = u('i'); cdr[450] = 449; tag[450] = atomtag;
+car[449] = u('s'); cdr[449] = 448; tag[449] = atomtag;
+car[448] = u('t'); cdr[448] = 0; tag[448] = atomtag;
+car[447] = 446; cdr[447] = 0; tag[447] = 0;
+car[446] = u('*'); cdr[446] = 445; tag[446] = atomtag;
+car[445] = u('n'); cdr[445] = 444; tag[445] = atomtag;
+car[444] = u('r'); cdr[444] = 443; tag[444] = atomtag;
+car[443] = u('t'); cdr[443] = 442; tag[443] = atomtag;
+car[442] = u('m'); cdr[442] = 441; tag[442] = atomtag;
+car[441] = u('p'); cdr[441] = 0; tag[441] = atomtag;
+car[440] = 412; cdr[440] = 439; tag[440] = 0;
+car[439] = 409; cdr[439] = 0; tag[439] = 0;
+car[438] = 437; cdr[438] = 0; tag[438] = 0;
+car[437] = u('n'); cdr[437] = 436; tag[437] = atomtag;
+car[436] = u('r'); cdr[436] = 435; tag[436] = atomtag;
+car[435] = u('e'); cdr[435] = 434; tag[435] = atomtag;
+car[434] = u('c'); cdr[434] = 433; tag[434] = atomtag;
+car[433] = u('o'); cdr[433] = 432; tag[433] = atomtag;
+car[432] = u('n'); cdr[432] = 431; tag[432] = atomtag;
+car[431] = u('c'); cdr[431] = 0; tag[431] = atomtag;
+car[430] = 412; cdr[430] = 0; tag[430] = 0;
+car[429] = 428; cdr[429] = 0; tag[429] = 0;
+car[428] = u('r'); cdr[428] = 427; tag[428] = atomtag;
+car[427] = u('e'); cdr[427] = 426; tag[427] = atomtag;
+car[426] = u('v'); cdr[426] = 425; tag[426] = atomtag;
+car[425] = u('e'); cdr[425] = 424; tag[425] = atomtag;
+car[424] = u('r'); cdr[424] = 423; tag[424] = atomtag;
+car[423] = u('s'); cdr[423] = 422; tag[423] = atomtag;
+car[422] = u('e'); cdr[422] = 0; tag[422] = atomtag;
+car[421] = 412; cdr[421] = 0; tag[421] = 0;
+car[420] = 419; cdr[420] = 0; tag[420] = 0;
+car[419] = u('r'); cdr[419] = 418; tag[419] = atomtag;
+car[418] = u('e'); cdr[418] = 417; tag[418] = atomtag;
+car[417] = u('c'); cdr[417] = 416; tag[417] = atomtag;
+car[416] = u('o'); cdr[416] = 415; tag[416] = atomtag;
+car[415] = u('n'); cdr[415] = 414; tag[415] = atomtag;
+car[414] = u('c'); cdr[414] = 0; tag[414] = atomtag;
+car[413] = 412; cdr[413] = 410; tag[413] = 0;
+car[412] = 411; cdr[412] = 0; tag[412] = 0;
+car[411] = u('a'); cdr[411] = 0; tag[411] = atomtag;
 car[410] = 409; cdr[410] = 0; tag[410] = 0;
-car[409] = u('a'); cdr[409] = 408; tag[409] = atomtag;
-car[408] = u('p'); cdr[408] = 407; tag[408] = atomtag;
-car[407] = u('p'); cdr[407] = 406; tag[407] = atomtag;
-car[406] = u('e'); cdr[406] = 405; tag[406] = atomtag;
-car[405] = u('n'); cdr[405] = 404; tag[405] = atomtag;
-car[404] = u('d'); cdr[404] = 0; tag[404] = atomtag;
-car[403] = 333; cdr[403] = 402; tag[403] = 0;
-car[402] = 330; cdr[402] = 0; tag[402] = 0;
-car[401] = 400; cdr[401] = 0; tag[401] = 0;
-car[400] = u('n'); cdr[400] = 399; tag[400] = atomtag;
+car[409] = 408; cdr[409] = 0; tag[409] = 0;
+car[408] = u('b'); cdr[408] = 0; tag[408] = atomtag;
+car[407] = 406; cdr[407] = 0; tag[407] = 0;
+car[406] = u('r'); cdr[406] = 405; tag[406] = atomtag;
+car[405] = u('p'); cdr[405] = 404; tag[405] = atomtag;
+car[404] = u('l'); cdr[404] = 403; tag[404] = atomtag;
+car[403] = u('a'); cdr[403] = 402; tag[403] = atomtag;
+car[402] = u('c'); cdr[402] = 401; tag[402] = atomtag;
+car[401] = u('d'); cdr[401] = 0; tag[401] = atomtag;
+car[400] = 399; cdr[400] = 0; tag[400] = 0;
 car[399] = u('r'); cdr[399] = 398; tag[399] = atomtag;
-car[398] = u('e'); cdr[398] = 397; tag[398] = atomtag;
-car[397] = u('v'); cdr[397] = 396; tag[397] = atomtag;
-car[396] = u('e'); cdr[396] = 395; tag[396] = atomtag;
-car[395] = u('r'); cdr[395] = 394; tag[395] = atomtag;
-car[394] = u('s'); cdr[394] = 393; tag[394] = atomtag;
-car[393] = u('e'); cdr[393] = 0; tag[393] = atomtag;
-car[392] = 391; cdr[392] = 0; tag[392] = 0;
-car[391] = u('n'); cdr[391] = 390; tag[391] = atomtag;
-car[390] = u('r'); cdr[390] = 389; tag[390] = atomtag;
-car[389] = u('e'); cdr[389] = 388; tag[389] = atomtag;
-car[388] = u('v'); cdr[388] = 387; tag[388] = atomtag;
-car[387] = u('e'); cdr[387] = 386; tag[387] = atomtag;
-car[386] = u('r'); cdr[386] = 385; tag[386] = atomtag;
-car[385] = u('s'); cdr[385] = 384; tag[385] = atomtag;
-car[384] = u('e'); cdr[384] = 383; tag[384] = atomtag;
-car[383] = u(':'); cdr[383] = 382; tag[383] = atomtag;
-car[382] = u(' '); cdr[382] = 381; tag[382] = atomtag;
-car[381] = u('e'); cdr[381] = 380; tag[381] = atomtag;
-car[380] = u('x'); cdr[380] = 379; tag[380] = atomtag;
-car[379] = u('p'); cdr[379] = 378; tag[379] = atomtag;
-car[378] = u('e'); cdr[378] = 377; tag[378] = atomtag;
-car[377] = u('c'); cdr[377] = 376; tag[377] = atomtag;
-car[376] = u('t'); cdr[376] = 375; tag[376] = atomtag;
-car[375] = u('e'); cdr[375] = 374; tag[375] = atomtag;
-car[374] = u('d'); cdr[374] = 373; tag[374] = atomtag;
-car[373] = u(' '); cdr[373] = 372; tag[373] = atomtag;
-car[372] = u('l'); cdr[372] = 371; tag[372] = atomtag;
-car[371] = u('i'); cdr[371] = 370; tag[371] = atomtag;
-car[370] = u('s'); cdr[370] = 369; tag[370] = atomtag;
-car[369] = u('t'); cdr[369] = 0; tag[369] = atomtag;
-car[368] = 367; cdr[368] = 0; tag[368] = 0;
-car[367] = u('*'); cdr[367] = 366; tag[367] = atomtag;
-car[366] = u('n'); cdr[366] = 365; tag[366] = atomtag;
-car[365] = u('r'); cdr[365] = 364; tag[365] = atomtag;
-car[364] = u('t'); cdr[364] = 363; tag[364] = atomtag;
-car[363] = u('m'); cdr[363] = 362; tag[363] = atomtag;
-car[362] = u('p'); cdr[362] = 0; tag[362] = atomtag;
-car[361] = 333; cdr[361] = 360; tag[361] = 0;
-car[360] = 330; cdr[360] = 0; tag[360] = 0;
-car[359] = 358; cdr[359] = 0; tag[359] = 0;
-car[358] = u('n'); cdr[358] = 357; tag[358] = atomtag;
-car[357] = u('r'); cdr[357] = 356; tag[357] = atomtag;
-car[356] = u('e'); cdr[356] = 355; tag[356] = atomtag;
-car[355] = u('c'); cdr[355] = 354; tag[355] = atomtag;
-car[354] = u('o'); cdr[354] = 353; tag[354] = atomtag;
-car[353] = u('n'); cdr[353] = 352; tag[353] = atomtag;
-car[352] = u('c'); cdr[352] = 0; tag[352] = atomtag;
-car[351] = 333; cdr[351] = 0; tag[351] = 0;
-car[350] = 349; cdr[350] = 0; tag[350] = 0;
-car[349] = u('r'); cdr[349] = 348; tag[349] = atomtag;
-car[348] = u('e'); cdr[348] = 347; tag[348] = atomtag;
-car[347] = u('v'); cdr[347] = 346; tag[347] = atomtag;
-car[346] = u('e'); cdr[346] = 345; tag[346] = atomtag;
-car[345] = u('r'); cdr[345] = 344; tag[345] = atomtag;
-car[344] = u('s'); cdr[344] = 343; tag[344] = atomtag;
-car[343] = u('e'); cdr[343] = 0; tag[343] = atomtag;
-car[342] = 333; cdr[342] = 0; tag[342] = 0;
+car[398] = u('p'); cdr[398] = 397; tag[398] = atomtag;
+car[397] = u('l'); cdr[397] = 396; tag[397] = atomtag;
+car[396] = u('a'); cdr[396] = 395; tag[396] = atomtag;
+car[395] = u('c'); cdr[395] = 394; tag[395] = atomtag;
+car[394] = u('d'); cdr[394] = 393; tag[394] = atomtag;
+car[393] = u(':'); cdr[393] = 392; tag[393] = atomtag;
+car[392] = u(' '); cdr[392] = 391; tag[392] = atomtag;
+car[391] = u('e'); cdr[391] = 390; tag[391] = atomtag;
+car[390] = u('x'); cdr[390] = 389; tag[390] = atomtag;
+car[389] = u('p'); cdr[389] = 388; tag[389] = atomtag;
+car[388] = u('e'); cdr[388] = 387; tag[388] = atomtag;
+car[387] = u('c'); cdr[387] = 386; tag[387] = atomtag;
+car[386] = u('t'); cdr[386] = 385; tag[386] = atomtag;
+car[385] = u('e'); cdr[385] = 384; tag[385] = atomtag;
+car[384] = u('d'); cdr[384] = 383; tag[384] = atomtag;
+car[383] = u(' '); cdr[383] = 382; tag[383] = atomtag;
+car[382] = u('c'); cdr[382] = 381; tag[382] = atomtag;
+car[381] = u('o'); cdr[381] = 380; tag[381] = atomtag;
+car[380] = u('n'); cdr[380] = 379; tag[380] = atomtag;
+car[379] = u('s'); cdr[379] = 0; tag[379] = atomtag;
+car[378] = 135; cdr[378] = 377; tag[378] = 0;
+car[377] = 153; cdr[377] = 0; tag[377] = 0;
+car[376] = 375; cdr[376] = 0; tag[376] = 0;
+car[375] = u('r'); cdr[375] = 374; tag[375] = atomtag;
+car[374] = u('p'); cdr[374] = 373; tag[374] = atomtag;
+car[373] = u('l'); cdr[373] = 372; tag[373] = atomtag;
+car[372] = u('a'); cdr[372] = 371; tag[372] = atomtag;
+car[371] = u('c'); cdr[371] = 370; tag[371] = atomtag;
+car[370] = u('a'); cdr[370] = 0; tag[370] = atomtag;
+car[369] = 368; cdr[369] = 0; tag[369] = 0;
+car[368] = u('r'); cdr[368] = 367; tag[368] = atomtag;
+car[367] = u('p'); cdr[367] = 366; tag[367] = atomtag;
+car[366] = u('l'); cdr[366] = 365; tag[366] = atomtag;
+car[365] = u('a'); cdr[365] = 364; tag[365] = atomtag;
+car[364] = u('c'); cdr[364] = 363; tag[364] = atomtag;
+car[363] = u('a'); cdr[363] = 362; tag[363] = atomtag;
+car[362] = u(':'); cdr[362] = 361; tag[362] = atomtag;
+car[361] = u(' '); cdr[361] = 360; tag[361] = atomtag;
+car[360] = u('e'); cdr[360] = 359; tag[360] = atomtag;
+car[359] = u('x'); cdr[359] = 358; tag[359] = atomtag;
+car[358] = u('p'); cdr[358] = 357; tag[358] = atomtag;
+car[357] = u('e'); cdr[357] = 356; tag[357] = atomtag;
+car[356] = u('c'); cdr[356] = 355; tag[356] = atomtag;
+car[355] = u('t'); cdr[355] = 354; tag[355] = atomtag;
+car[354] = u('e'); cdr[354] = 353; tag[354] = atomtag;
+car[353] = u('d'); cdr[353] = 352; tag[353] = atomtag;
+car[352] = u(' '); cdr[352] = 351; tag[352] = atomtag;
+car[351] = u('c'); cdr[351] = 350; tag[351] = atomtag;
+car[350] = u('o'); cdr[350] = 349; tag[350] = atomtag;
+car[349] = u('n'); cdr[349] = 348; tag[349] = atomtag;
+car[348] = u('s'); cdr[348] = 0; tag[348] = atomtag;
+car[347] = 135; cdr[347] = 346; tag[347] = 0;
+car[346] = 153; cdr[346] = 0; tag[346] = 0;
+car[345] = 344; cdr[345] = 0; tag[345] = 0;
+car[344] = u('n'); cdr[344] = 343; tag[344] = atomtag;
+car[343] = u('o'); cdr[343] = 342; tag[343] = atomtag;
+car[342] = u('t'); cdr[342] = 0; tag[342] = atomtag;
 car[341] = 340; cdr[341] = 0; tag[341] = 0;
-car[340] = u('r'); cdr[340] = 339; tag[340] = atomtag;
-car[339] = u('e'); cdr[339] = 338; tag[339] = atomtag;
-car[338] = u('c'); cdr[338] = 337; tag[338] = atomtag;
-car[337] = u('o'); cdr[337] = 336; tag[337] = atomtag;
-car[336] = u('n'); cdr[336] = 335; tag[336] = atomtag;
-car[335] = u('c'); cdr[335] = 0; tag[335] = atomtag;
-car[334] = 333; cdr[334] = 331; tag[334] = 0;
-car[333] = 332; cdr[333] = 0; tag[333] = 0;
-car[332] = u('a'); cdr[332] = 0; tag[332] = atomtag;
-car[331] = 330; cdr[331] = 0; tag[331] = 0;
+car[340] = u('n'); cdr[340] = 339; tag[340] = atomtag;
+car[339] = u('u'); cdr[339] = 338; tag[339] = atomtag;
+car[338] = u('l'); cdr[338] = 337; tag[338] = atomtag;
+car[337] = u('l'); cdr[337] = 0; tag[337] = atomtag;
+car[336] = 135; cdr[336] = 0; tag[336] = 0;
+car[335] = 334; cdr[335] = 0; tag[335] = 0;
+car[334] = u('l'); cdr[334] = 333; tag[334] = atomtag;
+car[333] = u('i'); cdr[333] = 332; tag[333] = atomtag;
+car[332] = u('s'); cdr[332] = 331; tag[332] = atomtag;
+car[331] = u('t'); cdr[331] = 0; tag[331] = atomtag;
 car[330] = 329; cdr[330] = 0; tag[330] = 0;
-car[329] = u('b'); cdr[329] = 0; tag[329] = atomtag;
-car[328] = 327; cdr[328] = 0; tag[328] = 0;
-car[327] = u('r'); cdr[327] = 326; tag[327] = atomtag;
-car[326] = u('p'); cdr[326] = 325; tag[326] = atomtag;
-car[325] = u('l'); cdr[325] = 324; tag[325] = atomtag;
-car[324] = u('a'); cdr[324] = 323; tag[324] = atomtag;
-car[323] = u('c'); cdr[323] = 322; tag[323] = atomtag;
-car[322] = u('d'); cdr[322] = 0; tag[322] = atomtag;
-car[321] = 320; cdr[321] = 0; tag[321] = 0;
-car[320] = u('r'); cdr[320] = 319; tag[320] = atomtag;
-car[319] = u('p'); cdr[319] = 318; tag[319] = atomtag;
-car[318] = u('l'); cdr[318] = 317; tag[318] = atomtag;
-car[317] = u('a'); cdr[317] = 316; tag[317] = atomtag;
-car[316] = u('c'); cdr[316] = 315; tag[316] = atomtag;
-car[315] = u('d'); cdr[315] = 314; tag[315] = atomtag;
-car[314] = u(':'); cdr[314] = 313; tag[314] = atomtag;
-car[313] = u(' '); cdr[313] = 312; tag[313] = atomtag;
-car[312] = u('e'); cdr[312] = 311; tag[312] = atomtag;
-car[311] = u('x'); cdr[311] = 310; tag[311] = atomtag;
-car[310] = u('p'); cdr[310] = 309; tag[310] = atomtag;
-car[309] = u('e'); cdr[309] = 308; tag[309] = atomtag;
+car[329] = u('c'); cdr[329] = 328; tag[329] = atomtag;
+car[328] = u('d'); cdr[328] = 327; tag[328] = atomtag;
+car[327] = u('d'); cdr[327] = 326; tag[327] = atomtag;
+car[326] = u('d'); cdr[326] = 325; tag[326] = atomtag;
+car[325] = u('r'); cdr[325] = 0; tag[325] = atomtag;
+car[324] = 135; cdr[324] = 0; tag[324] = 0;
+car[323] = 322; cdr[323] = 0; tag[323] = 0;
+car[322] = u('c'); cdr[322] = 321; tag[322] = atomtag;
+car[321] = u('d'); cdr[321] = 320; tag[321] = atomtag;
+car[320] = u('d'); cdr[320] = 319; tag[320] = atomtag;
+car[319] = u('a'); cdr[319] = 318; tag[319] = atomtag;
+car[318] = u('r'); cdr[318] = 0; tag[318] = atomtag;
+car[317] = 135; cdr[317] = 0; tag[317] = 0;
+car[316] = 315; cdr[316] = 0; tag[316] = 0;
+car[315] = u('c'); cdr[315] = 314; tag[315] = atomtag;
+car[314] = u('d'); cdr[314] = 313; tag[314] = atomtag;
+car[313] = u('a'); cdr[313] = 312; tag[313] = atomtag;
+car[312] = u('d'); cdr[312] = 311; tag[312] = atomtag;
+car[311] = u('r'); cdr[311] = 0; tag[311] = atomtag;
+car[310] = 135; cdr[310] = 0; tag[310] = 0;
+car[309] = 308; cdr[309] = 0; tag[309] = 0;
 car[308] = u('c'); cdr[308] = 307; tag[308] = atomtag;
-car[307] = u('t'); cdr[307] = 306; tag[307] = atomtag;
-car[306] = u('e'); cdr[306] = 305; tag[306] = atomtag;
-car[305] = u('d'); cdr[305] = 304; tag[305] = atomtag;
-car[304] = u(' '); cdr[304] = 303; tag[304] = atomtag;
-car[303] = u('c'); cdr[303] = 302; tag[303] = atomtag;
-car[302] = u('o'); cdr[302] = 301; tag[302] = atomtag;
-car[301] = u('n'); cdr[301] = 300; tag[301] = atomtag;
-car[300] = u('s'); cdr[300] = 0; tag[300] = atomtag;
-car[299] = 135; cdr[299] = 298; tag[299] = 0;
-car[298] = 153; cdr[298] = 0; tag[298] = 0;
-car[297] = 296; cdr[297] = 0; tag[297] = 0;
-car[296] = u('r'); cdr[296] = 295; tag[296] = atomtag;
-car[295] = u('p'); cdr[295] = 294; tag[295] = atomtag;
-car[294] = u('l'); cdr[294] = 293; tag[294] = atomtag;
+car[307] = u('d'); cdr[307] = 306; tag[307] = atomtag;
+car[306] = u('a'); cdr[306] = 305; tag[306] = atomtag;
+car[305] = u('a'); cdr[305] = 304; tag[305] = atomtag;
+car[304] = u('r'); cdr[304] = 0; tag[304] = atomtag;
+car[303] = 135; cdr[303] = 0; tag[303] = 0;
+car[302] = 301; cdr[302] = 0; tag[302] = 0;
+car[301] = u('c'); cdr[301] = 300; tag[301] = atomtag;
+car[300] = u('a'); cdr[300] = 299; tag[300] = atomtag;
+car[299] = u('d'); cdr[299] = 298; tag[299] = atomtag;
+car[298] = u('d'); cdr[298] = 297; tag[298] = atomtag;
+car[297] = u('r'); cdr[297] = 0; tag[297] = atomtag;
+car[296] = 135; cdr[296] = 0; tag[296] = 0;
+car[295] = 294; cdr[295] = 0; tag[295] = 0;
+car[294] = u('c'); cdr[294] = 293; tag[294] = atomtag;
 car[293] = u('a'); cdr[293] = 292; tag[293] = atomtag;
-car[292] = u('c'); cdr[292] = 291; tag[292] = atomtag;
-car[291] = u('a'); cdr[291] = 0; tag[291] = atomtag;
-car[290] = 289; cdr[290] = 0; tag[290] = 0;
-car[289] = u('r'); cdr[289] = 288; tag[289] = atomtag;
-car[288] = u('p'); cdr[288] = 287; tag[288] = atomtag;
-car[287] = u('l'); cdr[287] = 286; tag[287] = atomtag;
+car[292] = u('d'); cdr[292] = 291; tag[292] = atomtag;
+car[291] = u('a'); cdr[291] = 290; tag[291] = atomtag;
+car[290] = u('r'); cdr[290] = 0; tag[290] = atomtag;
+car[289] = 135; cdr[289] = 0; tag[289] = 0;
+car[288] = 287; cdr[288] = 0; tag[288] = 0;
+car[287] = u('c'); cdr[287] = 286; tag[287] = atomtag;
 car[286] = u('a'); cdr[286] = 285; tag[286] = atomtag;
-car[285] = u('c'); cdr[285] = 284; tag[285] = atomtag;
-car[284] = u('a'); cdr[284] = 283; tag[284] = atomtag;
-car[283] = u(':'); cdr[283] = 282; tag[283] = atomtag;
-car[282] = u(' '); cdr[282] = 281; tag[282] = atomtag;
-car[281] = u('e'); cdr[281] = 280; tag[281] = atomtag;
-car[280] = u('x'); cdr[280] = 279; tag[280] = atomtag;
-car[279] = u('p'); cdr[279] = 278; tag[279] = atomtag;
-car[278] = u('e'); cdr[278] = 277; tag[278] = atomtag;
-car[277] = u('c'); cdr[277] = 276; tag[277] = atomtag;
-car[276] = u('t'); cdr[276] = 275; tag[276] = atomtag;
-car[275] = u('e'); cdr[275] = 274; tag[275] = atomtag;
-car[274] = u('d'); cdr[274] = 273; tag[274] = atomtag;
-car[273] = u(' '); cdr[273] = 272; tag[273] = atomtag;
-car[272] = u('c'); cdr[272] = 271; tag[272] = atomtag;
-car[271] = u('o'); cdr[271] = 270; tag[271] = atomtag;
-car[270] = u('n'); cdr[270] = 269; tag[270] = atomtag;
-car[269] = u('s'); cdr[269] = 0; tag[269] = atomtag;
-car[268] = 135; cdr[268] = 267; tag[268] = 0;
-car[267] = 153; cdr[267] = 0; tag[267] = 0;
-car[266] = 265; cdr[266] = 0; tag[266] = 0;
-car[265] = u('n'); cdr[265] = 264; tag[265] = atomtag;
-car[264] = u('o'); cdr[264] = 263; tag[264] = atomtag;
-car[263] = u('t'); cdr[263] = 0; tag[263] = atomtag;
+car[285] = u('a'); cdr[285] = 284; tag[285] = atomtag;
+car[284] = u('d'); cdr[284] = 283; tag[284] = atomtag;
+car[283] = u('r'); cdr[283] = 0; tag[283] = atomtag;
+car[282] = 135; cdr[282] = 0; tag[282] = 0;
+car[281] = 280; cdr[281] = 0; tag[281] = 0;
+car[280] = u('c'); cdr[280] = 279; tag[280] = atomtag;
+car[279] = u('a'); cdr[279] = 278; tag[279] = atomtag;
+car[278] = u('a'); cdr[278] = 277; tag[278] = atomtag;
+car[277] = u('a'); cdr[277] = 276; tag[277] = atomtag;
+car[276] = u('r'); cdr[276] = 0; tag[276] = atomtag;
+car[275] = 135; cdr[275] = 0; tag[275] = 0;
+car[274] = 273; cdr[274] = 0; tag[274] = 0;
+car[273] = u('c'); cdr[273] = 272; tag[273] = atomtag;
+car[272] = u('d'); cdr[272] = 271; tag[272] = atomtag;
+car[271] = u('d'); cdr[271] = 270; tag[271] = atomtag;
+car[270] = u('r'); cdr[270] = 0; tag[270] = atomtag;
+car[269] = 135; cdr[269] = 0; tag[269] = 0;
+car[268] = 267; cdr[268] = 0; tag[268] = 0;
+car[267] = u('c'); cdr[267] = 266; tag[267] = atomtag;
+car[266] = u('d'); cdr[266] = 265; tag[266] = atomtag;
+car[265] = u('a'); cdr[265] = 264; tag[265] = atomtag;
+car[264] = u('r'); cdr[264] = 0; tag[264] = atomtag;
+car[263] = 135; cdr[263] = 0; tag[263] = 0;
 car[262] = 261; cdr[262] = 0; tag[262] = 0;
-car[261] = u('n'); cdr[261] = 260; tag[261] = atomtag;
-car[260] = u('u'); cdr[260] = 259; tag[260] = atomtag;
-car[259] = u('l'); cdr[259] = 258; tag[259] = atomtag;
-car[258] = u('l'); cdr[258] = 0; tag[258] = atomtag;
+car[261] = u('c'); cdr[261] = 260; tag[261] = atomtag;
+car[260] = u('a'); cdr[260] = 259; tag[260] = atomtag;
+car[259] = u('d'); cdr[259] = 258; tag[259] = atomtag;
+car[258] = u('r'); cdr[258] = 0; tag[258] = atomtag;
 car[257] = 135; cdr[257] = 0; tag[257] = 0;
 car[256] = 255; cdr[256] = 0; tag[256] = 0;
-car[255] = u('l'); cdr[255] = 254; tag[255] = atomtag;
-car[254] = u('i'); cdr[254] = 253; tag[254] = atomtag;
-car[253] = u('s'); cdr[253] = 252; tag[253] = atomtag;
-car[252] = u('t'); cdr[252] = 0; tag[252] = atomtag;
-car[251] = 250; cdr[251] = 0; tag[251] = 0;
-car[250] = u('c'); cdr[250] = 249; tag[250] = atomtag;
-car[249] = u('d'); cdr[249] = 248; tag[249] = atomtag;
-car[248] = u('d'); cdr[248] = 247; tag[248] = atomtag;
-car[247] = u('d'); cdr[247] = 246; tag[247] = atomtag;
-car[246] = u('r'); cdr[246] = 0; tag[246] = atomtag;
-car[245] = 135; cdr[245] = 0; tag[245] = 0;
-car[244] = 243; cdr[244] = 0; tag[244] = 0;
-car[243] = u('c'); cdr[243] = 242; tag[243] = atomtag;
-car[242] = u('d'); cdr[242] = 241; tag[242] = atomtag;
-car[241] = u('d'); cdr[241] = 240; tag[241] = atomtag;
-car[240] = u('a'); cdr[240] = 239; tag[240] = atomtag;
-car[239] = u('r'); cdr[239] = 0; tag[239] = atomtag;
-car[238] = 135; cdr[238] = 0; tag[238] = 0;
-car[237] = 236; cdr[237] = 0; tag[237] = 0;
-car[236] = u('c'); cdr[236] = 235; tag[236] = atomtag;
-car[235] = u('d'); cdr[235] = 234; tag[235] = atomtag;
-car[234] = u('a'); cdr[234] = 233; tag[234] = atomtag;
-car[233] = u('d'); cdr[233] = 232; tag[233] = atomtag;
-car[232] = u('r'); cdr[232] = 0; tag[232] = atomtag;
-car[231] = 135; cdr[231] = 0; tag[231] = 0;
-car[230] = 229; cdr[230] = 0; tag[230] = 0;
-car[229] = u('c'); cdr[229] = 228; tag[229] = atomtag;
-car[228] = u('d'); cdr[228] = 227; tag[228] = atomtag;
+car[255] = u('c'); cdr[255] = 254; tag[255] = atomtag;
+car[254] = u('a'); cdr[254] = 253; tag[254] = atomtag;
+car[253] = u('a'); cdr[253] = 252; tag[253] = atomtag;
+car[252] = u('r'); cdr[252] = 0; tag[252] = atomtag;
+car[251] = 135; cdr[251] = 0; tag[251] = 0;
+car[250] = 249; cdr[250] = 0; tag[250] = 0;
+car[249] = u('g'); cdr[249] = 248; tag[249] = atomtag;
+car[248] = u('r'); cdr[248] = 247; tag[248] = atomtag;
+car[247] = u('e'); cdr[247] = 246; tag[247] = atomtag;
+car[246] = u('a'); cdr[246] = 245; tag[246] = atomtag;
+car[245] = u('t'); cdr[245] = 244; tag[245] = atomtag;
+car[244] = u('e'); cdr[244] = 243; tag[244] = atomtag;
+car[243] = u('r'); cdr[243] = 242; tag[243] = atomtag;
+car[242] = u('p'); cdr[242] = 0; tag[242] = atomtag;
+car[241] = 135; cdr[241] = 240; tag[241] = 0;
+car[240] = 153; cdr[240] = 0; tag[240] = 0;
+car[239] = 238; cdr[239] = 0; tag[239] = 0;
+car[238] = u('l'); cdr[238] = 237; tag[238] = atomtag;
+car[237] = u('e'); cdr[237] = 236; tag[237] = atomtag;
+car[236] = u('s'); cdr[236] = 235; tag[236] = atomtag;
+car[235] = u('s'); cdr[235] = 234; tag[235] = atomtag;
+car[234] = u('p'); cdr[234] = 0; tag[234] = atomtag;
+car[233] = 135; cdr[233] = 232; tag[233] = 0;
+car[232] = 153; cdr[232] = 0; tag[232] = 0;
+car[231] = 230; cdr[231] = 0; tag[231] = 0;
+car[230] = u('r'); cdr[230] = 229; tag[230] = atomtag;
+car[229] = u('e'); cdr[229] = 228; tag[229] = atomtag;
+car[228] = u('m'); cdr[228] = 227; tag[228] = atomtag;
 car[227] = u('a'); cdr[227] = 226; tag[227] = atomtag;
-car[226] = u('a'); cdr[226] = 225; tag[226] = atomtag;
-car[225] = u('r'); cdr[225] = 0; tag[225] = atomtag;
-car[224] = 135; cdr[224] = 0; tag[224] = 0;
-car[223] = 222; cdr[223] = 0; tag[223] = 0;
-car[222] = u('c'); cdr[222] = 221; tag[222] = atomtag;
-car[221] = u('a'); cdr[221] = 220; tag[221] = atomtag;
-car[220] = u('d'); cdr[220] = 219; tag[220] = atomtag;
-car[219] = u('d'); cdr[219] = 218; tag[219] = atomtag;
-car[218] = u('r'); cdr[218] = 0; tag[218] = atomtag;
-car[217] = 135; cdr[217] = 0; tag[217] = 0;
-car[216] = 215; cdr[216] = 0; tag[216] = 0;
-car[215] = u('c'); cdr[215] = 214; tag[215] = atomtag;
-car[214] = u('a'); cdr[214] = 213; tag[214] = atomtag;
-car[213] = u('d'); cdr[213] = 212; tag[213] = atomtag;
-car[212] = u('a'); cdr[212] = 211; tag[212] = atomtag;
-car[211] = u('r'); cdr[211] = 0; tag[211] = atomtag;
-car[210] = 135; cdr[210] = 0; tag[210] = 0;
-car[209] = 208; cdr[209] = 0; tag[209] = 0;
-car[208] = u('c'); cdr[208] = 207; tag[208] = atomtag;
-car[207] = u('a'); cdr[207] = 206; tag[207] = atomtag;
-car[206] = u('a'); cdr[206] = 205; tag[206] = atomtag;
-car[205] = u('d'); cdr[205] = 204; tag[205] = atomtag;
-car[204] = u('r'); cdr[204] = 0; tag[204] = atomtag;
-car[203] = 135; cdr[203] = 0; tag[203] = 0;
-car[202] = 201; cdr[202] = 0; tag[202] = 0;
-car[201] = u('c'); cdr[201] = 200; tag[201] = atomtag;
-car[200] = u('a'); cdr[200] = 199; tag[200] = atomtag;
-car[199] = u('a'); cdr[199] = 198; tag[199] = atomtag;
-car[198] = u('a'); cdr[198] = 197; tag[198] = atomtag;
-car[197] = u('r'); cdr[197] = 0; tag[197] = atomtag;
-car[196] = 135; cdr[196] = 0; tag[196] = 0;
-car[195] = 194; cdr[195] = 0; tag[195] = 0;
-car[194] = u('c'); cdr[194] = 193; tag[194] = atomtag;
-car[193] = u('d'); cdr[193] = 192; tag[193] = atomtag;
-car[192] = u('d'); cdr[192] = 191; tag[192] = atomtag;
-car[191] = u('r'); cdr[191] = 0; tag[191] = atomtag;
-car[190] = 135; cdr[190] = 0; tag[190] = 0;
-car[189] = 188; cdr[189] = 0; tag[189] = 0;
-car[188] = u('c'); cdr[188] = 187; tag[188] = atomtag;
-car[187] = u('d'); cdr[187] = 186; tag[187] = atomtag;
-car[186] = u('a'); cdr[186] = 185; tag[186] = atomtag;
-car[185] = u('r'); cdr[185] = 0; tag[185] = atomtag;
-car[184] = 135; cdr[184] = 0; tag[184] = 0;
-car[183] = 182; cdr[183] = 0; tag[183] = 0;
-car[182] = u('c'); cdr[182] = 181; tag[182] = atomtag;
-car[181] = u('a'); cdr[181] = 180; tag[181] = atomtag;
-car[180] = u('d'); cdr[180] = 179; tag[180] = atomtag;
-car[179] = u('r'); cdr[179] = 0; tag[179] = atomtag;
-car[178] = 135; cdr[178] = 0; tag[178] = 0;
-car[177] = 176; cdr[177] = 0; tag[177] = 0;
-car[176] = u('c'); cdr[176] = 175; tag[176] = atomtag;
-car[175] = u('a'); cdr[175] = 174; tag[175] = atomtag;
-car[174] = u('a'); cdr[174] = 173; tag[174] = atomtag;
-car[173] = u('r'); cdr[173] = 0; tag[173] = atomtag;
+car[226] = u('i'); cdr[226] = 225; tag[226] = atomtag;
+car[225] = u('n'); cdr[225] = 224; tag[225] = atomtag;
+car[224] = u('d'); cdr[224] = 223; tag[224] = atomtag;
+car[223] = u('e'); cdr[223] = 222; tag[223] = atomtag;
+car[222] = u('r'); cdr[222] = 0; tag[222] = atomtag;
+car[221] = 135; cdr[221] = 220; tag[221] = 0;
+car[220] = 153; cdr[220] = 0; tag[220] = 0;
+car[219] = 218; cdr[219] = 0; tag[219] = 0;
+car[218] = u('q'); cdr[218] = 217; tag[218] = atomtag;
+car[217] = u('u'); cdr[217] = 216; tag[217] = atomtag;
+car[216] = u('o'); cdr[216] = 215; tag[216] = atomtag;
+car[215] = u('t'); cdr[215] = 214; tag[215] = atomtag;
+car[214] = u('i'); cdr[214] = 213; tag[214] = atomtag;
+car[213] = u('e'); cdr[213] = 212; tag[213] = atomtag;
+car[212] = u('n'); cdr[212] = 211; tag[212] = atomtag;
+car[211] = u('t'); cdr[211] = 0; tag[211] = atomtag;
+car[210] = 135; cdr[210] = 209; tag[210] = 0;
+car[209] = 153; cdr[209] = 0; tag[209] = 0;
+car[208] = 207; cdr[208] = 0; tag[208] = 0;
+car[207] = u('t'); cdr[207] = 206; tag[207] = atomtag;
+car[206] = u('i'); cdr[206] = 205; tag[206] = atomtag;
+car[205] = u('m'); cdr[205] = 204; tag[205] = atomtag;
+car[204] = u('e'); cdr[204] = 203; tag[204] = atomtag;
+car[203] = u('s'); cdr[203] = 0; tag[203] = atomtag;
+car[202] = 135; cdr[202] = 201; tag[202] = 0;
+car[201] = 153; cdr[201] = 0; tag[201] = 0;
+car[200] = 199; cdr[200] = 0; tag[200] = 0;
+car[199] = u('d'); cdr[199] = 198; tag[199] = atomtag;
+car[198] = u('i'); cdr[198] = 197; tag[198] = atomtag;
+car[197] = u('f'); cdr[197] = 196; tag[197] = atomtag;
+car[196] = u('f'); cdr[196] = 195; tag[196] = atomtag;
+car[195] = u('e'); cdr[195] = 194; tag[195] = atomtag;
+car[194] = u('r'); cdr[194] = 193; tag[194] = atomtag;
+car[193] = u('e'); cdr[193] = 192; tag[193] = atomtag;
+car[192] = u('n'); cdr[192] = 191; tag[192] = atomtag;
+car[191] = u('c'); cdr[191] = 190; tag[191] = atomtag;
+car[190] = u('e'); cdr[190] = 0; tag[190] = atomtag;
+car[189] = 135; cdr[189] = 188; tag[189] = 0;
+car[188] = 153; cdr[188] = 0; tag[188] = 0;
+car[187] = 186; cdr[187] = 0; tag[187] = 0;
+car[186] = u('p'); cdr[186] = 185; tag[186] = atomtag;
+car[185] = u('l'); cdr[185] = 184; tag[185] = atomtag;
+car[184] = u('u'); cdr[184] = 183; tag[184] = atomtag;
+car[183] = u('s'); cdr[183] = 0; tag[183] = atomtag;
+car[182] = 135; cdr[182] = 181; tag[182] = 0;
+car[181] = 153; cdr[181] = 0; tag[181] = 0;
+car[180] = 179; cdr[180] = 0; tag[180] = 0;
+car[179] = u('n'); cdr[179] = 178; tag[179] = atomtag;
+car[178] = u('u'); cdr[178] = 177; tag[178] = atomtag;
+car[177] = u('m'); cdr[177] = 176; tag[177] = atomtag;
+car[176] = u('b'); cdr[176] = 175; tag[176] = atomtag;
+car[175] = u('e'); cdr[175] = 174; tag[175] = atomtag;
+car[174] = u('r'); cdr[174] = 173; tag[174] = atomtag;
+car[173] = u('p'); cdr[173] = 0; tag[173] = atomtag;
 car[172] = 135; cdr[172] = 0; tag[172] = 0;
 car[171] = 170; cdr[171] = 0; tag[171] = 0;
 car[170] = u('h'); cdr[170] = 169; tag[170] = atomtag;
@@ -8697,3099 +13512,4276 @@ car[101] = u('i'); cdr[101] = 100; tag[101] = atomtag;
 car[100] = u('s'); cdr[100] = 0; tag[100] = atomtag;
 }
 /******** pool dump follows ********
-3265 - 136 3264
-3264 - 142 3263
-3263 - 147 3262
-3262 - 155 3261
-3261 - 162 3260
-3260 - 166 3259
-3259 - 172 3258
-3258 - 178 3257
-3257 - 184 3256
-3256 - 190 3255
-3255 - 196 3254
-3254 - 203 3253
-3253 - 210 3252
-3252 - 217 3251
-3251 - 224 3250
-3250 - 231 3249
-3249 - 238 3248
-3248 - 245 3247
-3247 - 257 3246
-3246 - 268 3245
-3245 - 299 3244
-3244 - 334 3243
-3243 - 342 3242
-3242 - 351 3241
-3241 - 361 3240
-3240 - 403 3239
-3239 - 412 3238
-3238 - 419 3237
-3237 - 427 3236
-3236 - 435 3235
-3235 - 444 3234
-3234 - 458 3233
-3233 - 466 3232
-3232 - 479 3231
-3231 - 482 3230
-3230 - 493 3229
-3229 - 499 3228
-3228 - 509 3227
-3227 - 511 3226
-3226 - 522 3225
-3225 - 537 3224
-3224 - 542 3223
-3223 - 551 3222
-3222 - 559 3221
-3221 - 568 3220
-3220 - 596 3219
-3219 - 604 3218
-3218 - 616 3217
-3217 - 624 3216
-3216 - 631 3215
-3215 - 641 3214
-3214 - 673 3213
-3213 - 680 3212
-3212 - 689 3211
-3211 - 698 3210
-3210 - 706 3209
-3209 - 713 3208
-3208 - 832 3207
-3207 - 842 3206
-3206 - 858 3205
-3205 - 867 3204
-3204 - 877 3203
-3203 - 880 3202
-3202 - 890 3201
-3201 - 930 3200
-3200 - 966 3199
-3199 - 996 3198
-3198 - 1003 3197
-3197 - 1013 3196
-3196 - 1022 3195
-3195 - 1028 3194
-3194 - 1058 3193
-3193 - 1064 3192
-3192 - 1067 3191
-3191 - 1096 3190
-3190 - 1111 3189
-3189 - 1132 3188
-3188 - 1143 3187
-3187 - 1145 3186
-3186 - 1156 3185
-3185 - 1157 3184
-3184 - 1167 3183
-3183 - 1180 3182
-3182 - 1192 3181
-3181 - 1202 3180
-3180 - 1221 3179
-3179 - 1282 3178
-3178 - 1291 3177
-3177 - 1344 3176
-3176 - 1432 3175
-3175 - 1445 3174
-3174 - 1511 3173
-3173 - 1512 3172
-3172 - 1596 3171
-3171 - 1650 3170
-3170 - 1705 3169
-3169 - 1741 3168
-3168 - 1775 3167
-3167 - 1813 3166
-3166 - 2192 3165
-3165 - 2270 3164
-3164 - 2519 3163
-3163 - 2547 3162
-3162 - 2573 3161
-3161 - 2597 3160
-3160 - 2639 3159
-3159 - 2699 3158
-3158 - 2747 0
-3157 - 3156 3152
-3156 - 3155 3153
-3155 - 3154 0
-3154 a ] 0
-3153 - 2578 0
-3152 - 3151 3146
-3151 - 3150 3148
+4442 - 136 4441
+4441 - 142 4440
+4440 - 147 4439
+4439 - 155 4438
+4438 - 162 4437
+4437 - 166 4436
+4436 - 172 4435
+4435 - 182 4434
+4434 - 189 4433
+4433 - 202 4432
+4432 - 210 4431
+4431 - 221 4430
+4430 - 233 4429
+4429 - 241 4428
+4428 - 251 4427
+4427 - 257 4426
+4426 - 263 4425
+4425 - 269 4424
+4424 - 275 4423
+4423 - 282 4422
+4422 - 289 4421
+4421 - 296 4420
+4420 - 303 4419
+4419 - 310 4418
+4418 - 317 4417
+4417 - 324 4416
+4416 - 336 4415
+4415 - 347 4414
+4414 - 378 4413
+4413 - 413 4412
+4412 - 421 4411
+4411 - 430 4410
+4410 - 440 4409
+4409 - 482 4408
+4408 - 491 4407
+4407 - 498 4406
+4406 - 506 4405
+4405 - 514 4404
+4404 - 523 4403
+4403 - 537 4402
+4402 - 545 4401
+4401 - 558 4400
+4400 - 561 4399
+4399 - 572 4398
+4398 - 578 4397
+4397 - 588 4396
+4396 - 590 4395
+4395 - 601 4394
+4394 - 616 4393
+4393 - 621 4392
+4392 - 630 4391
+4391 - 640 4390
+4390 - 641 4389
+4389 - 642 4388
+4388 - 645 4387
+4387 - 648 4386
+4386 - 651 4385
+4385 - 654 4384
+4384 - 657 4383
+4383 - 660 4382
+4382 - 663 4381
+4381 - 666 4380
+4380 - 678 4379
+4379 - 687 4378
+4378 - 713 4377
+4377 - 721 4376
+4376 - 733 4375
+4375 - 741 4374
+4374 - 748 4373
+4373 - 758 4372
+4372 - 782 4371
+4371 - 789 4370
+4370 - 798 4369
+4369 - 807 4368
+4368 - 815 4367
+4367 - 822 4366
+4366 - 863 4365
+4365 - 939 4364
+4364 - 949 4363
+4363 - 964 4362
+4362 - 981 4361
+4361 - 1059 4360
+4360 - 1070 4359
+4359 - 1072 4358
+4358 - 1083 4357
+4357 - 1084 4356
+4356 - 1094 4355
+4355 - 1102 4354
+4354 - 1103 4353
+4353 - 1113 4352
+4352 - 1129 4351
+4351 - 1142 4350
+4350 - 1154 4349
+4349 - 1155 4348
+4348 - 1171 4347
+4347 - 1178 4346
+4346 - 1180 4345
+4345 - 1188 4344
+4344 - 1208 4343
+4343 - 1225 4342
+4342 - 1244 4341
+4341 - 1305 4340
+4340 - 1314 4339
+4339 - 1470 4338
+4338 - 1506 4337
+4337 - 1539 4336
+4336 - 1600 4335
+4335 - 1612 4334
+4334 - 1675 4333
+4333 - 1720 4332
+4332 - 1729 4331
+4331 - 1730 4330
+4330 - 1731 4329
+4329 - 1750 4328
+4328 - 1776 4327
+4327 - 1785 4326
+4326 - 1795 4325
+4325 - 1796 4324
+4324 - 1803 4323
+4323 - 1811 4322
+4322 - 1820 4321
+4321 - 1822 4320
+4320 - 1940 4319
+4319 - 1953 4318
+4318 - 2012 4317
+4317 - 2013 4316
+4316 - 2053 4315
+4315 - 2069 4314
+4314 - 2123 4313
+4313 - 2178 4312
+4312 - 2214 4311
+4311 - 2250 4310
+4310 - 2314 4309
+4309 - 2349 4308
+4308 - 2813 4307
+4307 - 2891 4306
+4306 - 3195 4305
+4305 - 3223 4304
+4304 - 3253 4303
+4303 - 3284 4302
+4302 - 3342 4301
+4301 - 3401 4300
+4300 - 3485 4299
+4299 - 3492 4298
+4298 - 3503 4297
+4297 - 3519 4296
+4296 - 3520 4295
+4295 - 3521 4294
+4294 - 3547 4293
+4293 - 3548 4292
+4292 - 3549 4291
+4291 - 3550 4290
+4290 - 3551 4289
+4289 - 3557 4288
+4288 - 3568 4287
+4287 - 3582 4286
+4286 - 3583 4285
+4285 - 3593 4284
+4284 - 3595 4283
+4283 - 3601 4282
+4282 - 3602 4281
+4281 - 3614 4280
+4280 - 3628 4279
+4279 - 3637 4278
+4278 - 3697 4277
+4277 - 3727 4276
+4276 - 3740 4275
+4275 - 3741 4274
+4274 - 3752 0
+4273 - 4272 4270
+4272 - 3237 4271
+4271 - 3237 0
+4270 - 4269 4267
+4269 - 2770 4268
+4268 - 2770 0
+4267 - 4266 4262
+4266 - 2768 4265
+4265 - 3400 4264
+4264 - 3117 4263
+4263 - 2768 0
+4262 - 4261 4259
+4261 - 2766 4260
+4260 - 2766 0
+4259 - 4258 4252
+4258 - 3230 4257
+4257 - 3242 4256
+4256 - 3235 4255
+4255 - 3230 4254
+4254 - 3228 4253
+4253 - 2318 0
+4252 - 4251 4248
+4251 - 2216 4250
+4250 - 3273 4249
+4249 - 2216 0
+4248 - 4247 4242
+4247 - 4246 4244
+4246 - 4245 0
+4245 a ] 0
+4244 - 3265 4243
+4243 - 1837 0
+4242 - 4241 4238
+4241 - 3699 4240
+4240 - 3699 4239
+4239 - 1473 0
+4238 - 4237 4232
+4237 - 1304 4236
+4236 - 3702 4235
+4235 - 3306 4234
+4234 - 1304 4233
+4233 - 1294 0
+4232 - 4231 4229
+4231 - 921 4230
+4230 - 921 0
+4229 - 4228 4221
+4228 - 918 4227
+4227 - 2011 4226
+4226 - 1986 4225
+4225 - 1818 4224
+4224 - 1673 4223
+4223 - 1035 4222
+4222 - 918 0
+4221 - 4220 4214
+4220 - 912 4219
+4219 - 3194 4218
+4218 - 2312 4217
+4217 - 1029 4216
+4216 - 1013 4215
+4215 - 912 0
+4214 - 4213 4205
+4213 - 898 4212
+4212 - 3600 4211
+4211 - 2052 4210
+4210 - 1654 4209
+4209 - 1527 4208
+4208 - 1517 4207
+4207 - 1504 4206
+4206 - 898 0
+4205 - 4204 4202
+4204 - 889 4203
+4203 - 889 0
+4202 - 4201 4199
+4201 - 883 4200
+4200 - 883 0
+4199 - 4198 4189
+4198 - 762 4197
+4197 - 3693 4196
+4196 - 3462 4195
+4195 - 3341 4194
+4194 - 3134 4193
+4193 - 1578 4192
+4192 - 1411 4191
+4191 - 1313 4190
+4190 - 762 0
+4189 - 4188 4169
+4188 - 760 4187
+4187 - 3717 4186
+4186 - 3627 4185
+4185 - 3580 4184
+4184 - 3567 4183
+4183 - 3175 4182
+4182 - 1885 4181
+4181 - 1719 4180
+4180 - 1712 4179
+4179 - 1702 4178
+4178 - 1610 4177
+4177 - 1537 4176
+4176 - 1391 4175
+4175 - 1348 4174
+4174 - 1177 4173
+4173 - 1025 4172
+4172 - 760 4171
+4171 - 753 4170
+4170 - 747 0
+4169 - 4168 4140
+4168 - 902 4167
+4167 - 3591 4166
+4166 - 3546 4165
+4165 - 3531 4164
+4164 - 3518 4163
+4163 - 3508 4162
+4162 - 3502 4161
+4161 - 3453 4160
+4160 - 3315 4159
+4159 - 3150 4158
+4158 - 2466 4157
+4157 - 2249 4156
+4156 - 1802 4155
+4155 - 1727 4154
+4154 - 1693 4153
+4153 - 1685 4152
+4152 - 1625 4151
+4151 - 1617 4150
+4150 - 1589 4149
+4149 - 1552 4148
+4148 - 1544 4147
+4147 - 1419 4146
+4146 - 1384 4145
+4145 - 1338 4144
+4144 - 999 4143
+4143 - 958 4142
+4142 - 902 4141
+4141 - 731 0
+4140 - 4139 4137
+4139 - 706 4138
+4138 - 706 0
+4137 - 4136 4133
+4136 - 704 4135
+4135 - 704 4134
+4134 - 702 0
+4133 - 4132 4117
+4132 - 689 4131
+4131 - 3613 4130
+4130 - 3295 4129
+4129 - 3252 4128
+4128 - 3141 4127
+4127 - 2607 4126
+4126 - 2539 4125
+4125 - 1810 4124
+4124 - 1793 4123
+4123 - 1784 4122
+4122 - 1285 4121
+4121 - 806 4120
+4120 - 787 4119
+4119 - 769 4118
+4118 - 689 0
+4117 - 4116 4112
+4116 - 686 4115
+4115 - 2227 4114
+4114 - 2221 4113
+4113 - 686 0
+4112 - 4111 4107
+4111 - 4110 4108
+4110 - 4109 0
+4109 a . 0
+4108 - 681 0
+4107 - 4106 4104
+4106 - 670 4105
+4105 - 670 0
+4104 - 4103 4101
+4103 - 668 4102
+4102 - 668 0
+4101 - 4100 4098
+4100 - 665 4099
+4099 - 665 0
+4098 - 4097 4095
+4097 - 662 4096
+4096 - 662 0
+4095 - 4094 4092
+4094 - 659 4093
+4093 - 659 0
+4092 - 4091 4089
+4091 - 656 4090
+4090 - 656 0
+4089 - 4088 4086
+4088 - 653 4087
+4087 - 653 0
+4086 - 4085 4083
+4085 - 650 4084
+4084 - 650 0
+4083 - 4082 4080
+4082 - 647 4081
+4081 - 647 0
+4080 - 4079 4076
+4079 - 644 4078
+4078 - 3696 4077
+4077 - 644 0
+4076 - 4075 4071
+4075 - 894 4074
+4074 - 3075 4073
+4073 - 894 4072
+4072 - 608 0
+4071 - 4070 4056
+4070 - 756 4069
+4069 - 2095 4068
+4068 - 1141 4067
+4067 - 1082 4066
+4066 - 1069 4065
+4065 - 1053 4064
+4064 - 814 4063
+4063 - 797 4062
+4062 - 756 4061
+4061 - 740 4060
+4060 - 569 4059
+4059 - 552 4058
+4058 - 541 4057
+4057 - 521 0
+4056 - 4055 4047
+4055 - 409 4054
+4054 - 3457 4053
+4053 - 1644 4052
+4052 - 1490 4051
+4051 - 1482 4050
+4050 - 1459 4049
+4049 - 1242 4048
+4048 - 409 0
+4047 - 4046 4041
+4046 - 928 4045
+4045 - 1775 4044
+4044 - 1631 4043
+4043 - 928 4042
+4042 - 250 0
+4041 - 4040 4023
+4040 - 691 4039
+4039 - 3776 4038
+4038 - 3750 4037
+4037 - 3470 4036
+4036 - 2869 4035
+4035 - 2455 4034
+4034 - 2068 4033
+4033 - 2038 4032
+4032 - 1638 4031
+4031 - 1375 4030
+4030 - 1201 4029
+4029 - 1187 4028
+4028 - 1017 4027
+4027 - 691 4026
+4026 - 496 4025
+4025 - 335 4024
+4024 - 239 0
+4023 - 4022 3980
+4022 - 543 4021
+4021 - 3475 4020
+4020 - 3357 4019
+4019 - 3303 4018
+4018 - 3210 4017
+4017 - 2974 4016
+4016 - 2947 4015
+4015 - 2919 4014
+4014 - 2888 4013
+4013 - 2764 4012
+4012 - 2730 4011
+4011 - 2681 4010
+4010 - 2651 4009
+4009 - 2635 4008
+4008 - 2567 4007
+4007 - 2499 4006
+4006 - 2444 4005
+4005 - 2427 4004
+4004 - 2414 4003
+4003 - 2388 4002
+4002 - 2367 4001
+4001 - 2338 4000
+4000 - 2301 3999
+3999 - 2281 3998
+3998 - 2168 3997
+3997 - 1990 3996
+3996 - 1447 3995
+3995 - 1367 3994
+3994 - 1261 3993
+3993 - 963 3992
+3992 - 781 3991
+3991 - 598 3990
+3990 - 585 3989
+3989 - 576 3988
+3988 - 543 3987
+3987 - 429 3986
+3986 - 420 3985
+3985 - 407 3984
+3984 - 400 3983
+3983 - 376 3982
+3982 - 369 3981
+3981 - 231 0
+3980 - 3979 3975
+3979 - 906 3978
+3978 - 1194 3977
+3977 - 906 3976
+3976 - 219 0
+3975 - 3974 3966
+3974 - 935 3973
+3973 - 3556 3972
+3972 - 3480 3971
+3971 - 3448 3970
+3970 - 2846 3969
+3969 - 1101 3968
+3968 - 935 3967
+3967 - 200 0
+3966 - 3965 3943
+3965 - 909 3964
+3964 - 3661 3963
+3963 - 3491 3962
+3962 - 3363 3961
+3961 - 3190 3960
+3960 - 2461 3959
+3959 - 2258 3958
+3958 - 2061 3957
+3957 - 2047 3956
+3956 - 1742 3955
+3955 - 1207 3954
+3954 - 1042 3953
+3953 - 909 3952
+3952 - 775 3951
+3951 - 719 3950
+3950 - 712 3949
+3949 - 684 3948
+3948 - 677 3947
+3947 - 637 3946
+3946 - 629 3945
+3945 - 620 3944
+3944 - 187 0
+3943 - 3942 3925
+3942 - 639 3941
+3941 - 3260 3940
+3940 - 1952 3939
+3939 - 1532 3938
+3938 - 1211 3937
+3937 - 1117 3936
+3936 - 1112 3935
+3935 - 1006 3934
+3934 - 973 3933
+3933 - 639 3932
+3932 - 504 3931
+3931 - 480 3930
+3930 - 471 3929
+3929 - 438 3928
+3928 - 345 3927
+3927 - 341 3926
+3926 - 180 0
+3925 - 3924 3919
+3924 - 925 3923
+3923 - 2810 3922
+3922 - 1583 3921
+3921 - 925 3920
+3920 - 171 0
+3919 - 3918 3903
+3918 - 932 3917
+3917 - 3726 3916
+3916 - 3322 3915
+3915 - 3222 3914
+3914 - 1938 3913
+3913 - 1916 3912
+3912 - 1233 3911
+3911 - 1170 3910
+3910 - 1165 3909
+3909 - 932 3908
+3908 - 853 3907
+3907 - 845 3906
+3906 - 820 3905
+3905 - 512 3904
+3904 - 165 0
+3903 - 3902 3900
+3902 - 153 3901
+3901 - 153 0
+3900 - 3899 3870
+3899 - 600 3898
+3898 - 3739 3897
+3897 - 3283 3896
+3896 - 3278 3895
+3895 - 3247 3894
+3894 - 3183 3893
+3893 - 3048 3892
+3892 - 3011 3891
+3891 - 2449 3890
+3890 - 2177 3889
+3889 - 1302 3888
+3888 - 1220 3887
+3887 - 992 3886
+3886 - 600 3885
+3885 - 330 3884
+3884 - 323 3883
+3883 - 316 3882
+3882 - 309 3881
+3881 - 302 3880
+3880 - 295 3879
+3879 - 288 3878
+3878 - 281 3877
+3877 - 274 3876
+3876 - 268 3875
+3875 - 262 3874
+3874 - 256 3873
+3873 - 160 3872
+3872 - 151 3871
+3871 - 146 0
+3870 - 3869 3851
+3869 - 412 3868
+3868 - 3636 3867
+3867 - 2347 3866
+3866 - 2113 3865
+3865 - 1849 3864
+3864 - 1843 3863
+3863 - 1749 3862
+3862 - 1598 3861
+3861 - 1468 3860
+3860 - 1431 3859
+3859 - 1153 3858
+3858 - 1128 3857
+3857 - 1093 3856
+3856 - 986 3855
+3855 - 529 3854
+3854 - 489 3853
+3853 - 412 3852
+3852 - 141 0
+3851 - 3850 3848
+3850 - 135 3849
+3849 - 135 0
+3848 - 3847 3845
+3847 - 129 3846
+3846 - 129 0
+3845 - 3844 3835
+3844 - 123 3843
+3843 - 2137 3842
+3842 - 2000 3841
+3841 - 1897 3840
+3840 - 1870 3839
+3839 - 1764 3838
+3838 - 1406 3837
+3837 - 1341 3836
+3836 - 123 0
+3835 - 3834 3828
+3834 - 117 3833
+3833 - 3652 3832
+3832 - 1905 3831
+3831 - 1875 3830
+3830 - 1571 3829
+3829 - 117 0
+3828 - 3827 3791
+3827 - 886 3826
+3826 - 3769 3825
+3825 - 3758 3824
+3824 - 3438 3823
+3823 - 3056 3822
+3822 - 3019 3821
+3821 - 2982 3820
+3820 - 2953 3819
+3819 - 2926 3818
+3818 - 2898 3817
+3817 - 2875 3816
+3816 - 2852 3815
+3815 - 2829 3814
+3814 - 2823 3813
+3813 - 2818 3812
+3812 - 2776 3811
+3811 - 2395 3810
+3810 - 2373 3809
+3809 - 2212 3808
+3808 - 2200 3807
+3807 - 2188 3806
+3806 - 2121 3805
+3805 - 2103 3804
+3804 - 2085 3803
+3803 - 948 3802
+3802 - 886 3801
+3801 - 871 3800
+3800 - 555 3799
+3799 - 536 3798
+3798 - 532 3797
+3797 - 447 3796
+3796 - 133 3795
+3795 - 127 3794
+3794 - 121 3793
+3793 - 115 3792
+3792 - 107 0
+3791 - 3790 0
+3790 - 1 3789
+3789 - 3270 3788
+3788 - 2692 3787
+3787 - 2309 3786
+3786 - 2242 3785
+3785 - 2077 3784
+3784 - 1964 3783
+3783 - 1859 3782
+3782 - 1223 3781
+3781 - 1056 3780
+3780 - 980 3779
+3779 - 615 3778
+3778 - 208 3777
+3777 - 1 0
+3776 - 3775 0
+3775 a l 3774
+3774 a i 3773
+3773 a s 3772
+3772 a c 3771
+3771 a m 3770
+3770 a p 0
+3769 - 3768 0
+3768 a * 3767
+3767 a f 3766
+3766 a u 3765
+3765 a n 3764
+3764 a c 3763
+3763 a t 3762
+3762 a i 3761
+3761 a o 3760
+3760 a n 3759
+3759 a s 0
+3758 - 3757 0
+3757 a * 3756
+3756 a s 3755
+3755 a t 3754
+3754 a o 3753
+3753 a p 0
+3752 - 135 3751
+3751 - 909 0
+3750 - 3749 0
+3749 a l 3748
+3748 a i 3747
+3747 a s 3746
+3746 a c 3745
+3745 a m 3744
+3744 a p 3743
+3743 a - 3742
+3742 a f 0
+3741 - 935 0
+3740 - 909 0
+3739 - 3738 0
+3738 a c 3737
+3737 a o 3736
+3736 a m 3735
+3735 a p 3734
+3734 a i 3733
+3733 a l 3732
+3732 a e 3731
+3731 a - 3730
+3730 a a 3729
+3729 a l 3728
+3728 a l 0
+3727 - 909 0
+3726 - 3725 0
+3725 a e 3724
+3724 a p 3723
+3723 a i 3722
+3722 a l 3721
+3721 a o 3720
+3720 a g 3719
+3719 a - 3718
+3718 a f 0
+3717 - 3716 0
+3716 a f 3715
+3715 a u 3714
+3714 a n 3713
+3713 a t 3712
+3712 a a 3711
+3711 a b 3710
+3710 a   3709
+3709 a = 3708
+3708 a   3707
+3707 a f 3706
+3706 a t 3705
+3705 a a 3704
+3704 a b 3703
+3703 a ; 0
+3702 - 3701 0
+3701 a } 3700
+3700 a ; 0
+3699 - 3698 0
+3698 a , 0
+3697 - 918 0
+3696 - 3695 0
+3695 a 0 3694
+3694 a , 0
+3693 - 3692 0
+3692 a v 3691
+3691 a o 3690
+3690 a i 3689
+3689 a d 3688
+3688 a   3687
+3687 a ( 3686
+3686 a * 3685
+3685 a f 3684
+3684 a t 3683
+3683 a a 3682
+3682 a b 3681
+3681 a [ 3680
+3680 a ] 3679
+3679 a ) 3678
+3678 a ( 3677
+3677 a c 3676
+3676 a e 3675
+3675 a l 3674
+3674 a l 3673
+3673 a   3672
+3672 a * 3671
+3671 a , 3670
+3670 a   3669
+3669 a i 3668
+3668 a n 3667
+3667 a t 3666
+3666 a ) 3665
+3665 a   3664
+3664 a = 3663
+3663 a   3662
+3662 a { 0
+3661 - 3660 0
+3660 a p 3659
+3659 a r 3658
+3658 a o 3657
+3657 a l 3656
+3656 a o 3655
+3655 a g 3654
+3654 a - 3653
+3653 a f 0
+3652 - 3651 0
+3651 a ( 3650
+3650 a c 3649
+3649 a e 3648
+3648 a l 3647
+3647 a l 3646
+3646 a   3645
+3645 a * 3644
+3644 a , 3643
+3643 a   3642
+3642 a i 3641
+3641 a n 3640
+3640 a t 3639
+3639 a ) 3638
+3638 a ; 0
+3637 - 918 0
+3636 - 3635 0
+3635 a a 3634
+3634 a n 3633
+3633 a a 3632
+3632 a l 3631
+3631 a y 3630
+3630 a z 3629
+3629 a e 0
+3628 - 909 0
+3627 - 3626 0
+3626 a f 3625
+3625 a i 3624
+3624 a n 3623
+3623 a d 3622
+3622 a - 3621
+3621 a i 3620
+3620 a n 3619
+3619 a l 3618
+3618 a i 3617
+3617 a n 3616
+3616 a e 3615
+3615 a s 0
+3614 - 909 0
+3613 - 3612 0
+3612 a i 3611
+3611 a n 3610
+3610 a l 3609
+3609 a i 3608
+3608 a n 3607
+3607 a a 3606
+3606 a b 3605
+3605 a l 3604
+3604 a e 3603
+3603 a p 0
+3602 - 909 0
+3601 - 760 0
+3600 - 3599 0
+3599 a u 3598
+3598 a s 3597
+3597 a e 3596
+3596 a s 0
+3595 - 412 3594
+3594 - 639 0
+3593 - 762 3592
+3592 - 135 0
+3591 - 3590 0
+3590 a s 3589
+3589 a i 3588
+3588 a m 3587
+3587 a p 3586
+3586 a l 3585
+3585 a e 3584
+3584 a p 0
+3583 - 412 0
+3582 - 135 3581
+3581 - 762 0
+3580 - 3579 0
+3579 a f 3578
+3578 a i 3577
+3577 a n 3576
+3576 a d 3575
+3575 a - 3574
+3574 a s 3573
+3573 a e 3572
+3572 a l 3571
+3571 a f 3570
+3570 a o 3569
+3569 a k 0
+3568 - 691 0
+3567 - 3566 0
+3566 a f 3565
+3565 a i 3564
+3564 a n 3563
+3563 a d 3562
+3562 a - 3561
+3561 a d 3560
+3560 a e 3559
+3559 a f 3558
+3558 a s 0
+3557 - 909 0
+3556 - 3555 0
+3555 a d 3554
+3554 a e 3553
+3553 a f 3552
+3552 a p 0
+3551 - 135 0
+3550 - 135 0
+3549 - 409 0
+3548 - 600 0
+3547 - 135 0
+3546 - 3545 0
+3545 a s 3544
+3544 a c 3543
+3543 a a 3542
+3542 a n 3541
+3541 a - 3540
+3540 a r 3539
+3539 a e 3538
+3538 a f 3537
+3537 a s 3536
+3536 a - 3535
+3535 a l 3534
+3534 a i 3533
+3533 a s 3532
+3532 a t 0
+3531 - 3530 0
+3530 a s 3529
+3529 a c 3528
+3528 a a 3527
+3527 a n 3526
+3526 a - 3525
+3525 a r 3524
+3524 a e 3523
+3523 a f 3522
+3522 a s 0
+3521 - 135 0
+3520 - 409 0
+3519 - 135 0
+3518 - 3517 0
+3517 a s 3516
+3516 a c 3515
+3515 a a 3514
+3514 a n 3513
+3513 a - 3512
+3512 a l 3511
+3511 a i 3510
+3510 a s 3509
+3509 a t 0
+3508 - 3507 0
+3507 a s 3506
+3506 a c 3505
+3505 a a 3504
+3504 a n 0
+3503 - 135 0
+3502 - 3501 0
+3501 a s 3500
+3500 a c 3499
+3499 a a 3498
+3498 a n 3497
+3497 a - 3496
+3496 a v 3495
+3495 a a 3494
+3494 a r 3493
+3493 a s 0
+3492 - 135 0
+3491 - 3490 0
+3490 a p 3489
+3489 a r 3488
+3488 a i 3487
+3487 a m 3486
+3486 a s 0
+3485 - 141 3484
+3484 - 146 3483
+3483 - 151 3482
+3482 - 160 3481
+3481 - 165 0
+3480 - 3479 0
+3479 a d 3478
+3478 a e 3477
+3477 a f 3476
+3476 a s 0
+3475 - 3474 0
+3474 a r 3473
+3473 a e 3472
+3472 a f 3471
+3471 a s 0
+3470 - 3469 0
+3469 a l 3468
+3468 a a 3467
+3467 a b 3466
+3466 a f 3465
+3465 a u 3464
+3464 a n 3463
+3463 a s 0
+3462 - 3461 0
+3461 a v 3460
+3460 a a 3459
+3459 a r 3458
+3458 a s 0
+3457 - 3456 0
+3456 a b 3455
+3455 a a 3454
+3454 a d 0
+3453 - 3452 0
+3452 a s 3451
+3451 a e 3450
+3450 a e 3449
+3449 a n 0
+3448 - 3447 0
+3447 a d 3446
+3446 a u 3445
+3445 a m 3444
+3444 a p 3443
+3443 a - 3442
+3442 a p 3441
+3441 a o 3440
+3440 a o 3439
+3439 a l 0
+3438 - 3437 0
+3437 a * 3436
+3436 a * 3435
+3435 a * 3434
+3434 a * 3433
+3433 a * 3432
+3432 a * 3431
+3431 a * 3430
+3430 a * 3429
+3429 a * 3428
+3428 a * 3427
+3427 a * 3426
+3426 a * 3425
+3425 a * 3424
+3424 a * 3423
+3423 a * 3422
+3422 a * 3421
+3421 a * 3420
+3420 a * 3419
+3419 a * 3418
+3418 a * 3417
+3417 a * 3416
+3416 a * 3415
+3415 a * 3414
+3414 a * 3413
+3413 a * 3412
+3412 a * 3411
+3411 a * 3410
+3410 a * 3409
+3409 a * 3408
+3408 a * 3407
+3407 a * 3406
+3406 a * 3405
+3405 a * 3404
+3404 a * 3403
+3403 a * 3402
+3402 a / 0
+3401 - 135 0
+3400 - 3399 0
+3399 a / 3398
+3398 a * 3397
+3397 a * 3396
+3396 a * 3395
+3395 a * 3394
+3394 a * 3393
+3393 a * 3392
+3392 a * 3391
+3391 a * 3390
+3390 a   3389
+3389 a p 3388
+3388 a o 3387
+3387 a o 3386
+3386 a l 3385
+3385 a   3384
+3384 a d 3383
+3383 a u 3382
+3382 a m 3381
+3381 a p 3380
+3380 a   3379
+3379 a f 3378
+3378 a o 3377
+3377 a l 3376
+3376 a l 3375
+3375 a o 3374
+3374 a w 3373
+3373 a s 3372
+3372 a   3371
+3371 a * 3370
+3370 a * 3369
+3369 a * 3368
+3368 a * 3367
+3367 a * 3366
+3366 a * 3365
+3365 a * 3364
+3364 a * 0
+3363 - 3362 0
+3362 a p 3361
+3361 a o 3360
+3360 a o 3359
+3359 a l 3358
+3358 a ( 0
+3357 - 3356 0
+3356 a r 3355
+3355 a e 3354
+3354 a f 3353
+3353 a ( 3352
+3352 a s 3351
+3351 a y 3350
+3350 a m 3349
+3349 a l 3348
+3348 a i 3347
+3347 a s 3346
+3346 a ) 3345
+3345 a   3344
+3344 a = 3343
+3343 a   0
+3342 - 135 0
+3341 - 3340 0
+3340 a v 3339
+3339 a o 3338
+3338 a i 3337
+3337 a d 3336
+3336 a   3335
+3335 a s 3334
+3334 a e 3333
+3333 a t 3332
+3332 a u 3331
+3331 a p 3330
+3330 a ( 3329
+3329 a v 3328
+3328 a o 3327
+3327 a i 3326
+3326 a d 3325
+3325 a ) 3324
+3324 a   3323
+3323 a { 0
+3322 - 3321 0
+3321 a e 3320
+3320 a p 3319
+3319 a i 3318
+3318 a l 3317
+3317 a o 3316
+3316 a g 0
+3315 - 3314 0
+3314 a s 3313
+3313 a e 3312
+3312 a t 3311
+3311 a u 3310
+3310 a p 3309
+3309 a c 3308
+3308 a o 3307
+3307 a m 0
+3306 - 3305 0
+3305 a } 3304
+3304 a } 0
+3303 - 3302 0
+3302 a r 3301
+3301 a e 3300
+3300 a t 3299
+3299 a u 3298
+3298 a r 3297
+3297 a n 3296
+3296 a ; 0
+3295 - 3294 0
+3294 a i 3293
+3293 a n 3292
+3292 a i 3291
+3291 a t 3290
+3290 a - 3289
+3289 a c 3288
+3288 a e 3287
+3287 a l 3286
+3286 a l 3285
+3285 a s 0
+3284 - 639 0
+3283 - 3282 0
+3282 a c 3281
+3281 a a 3280
+3280 a r 3279
+3279 a [ 0
+3278 - 3277 0
+3277 a c 3276
+3276 a d 3275
+3275 a r 3274
+3274 a [ 0
+3273 - 3272 0
+3272 a ; 3271
+3271 a   0
+3270 - 3269 0
+3269 a t 3268
+3268 a a 3267
+3267 a g 3266
+3266 a [ 0
+3265 - 3264 0
+3264 a ] 3263
+3263 a   3262
+3262 a = 3261
+3261 a   0
+3260 - 3259 0
+3259 a n 3258
+3258 a u 3257
+3257 a m 3256
+3256 a t 3255
+3255 a a 3254
+3254 a g 0
+3253 - 639 0
+3252 - 3251 0
+3251 a i 3250
+3250 a n 3249
+3249 a i 3248
+3248 a t 0
+3247 - 3246 0
+3246 a c 3245
+3245 a h 3244
+3244 a a 3243
+3243 a r 0
+3242 - 3241 0
+3241 a ' 3240
+3240 a \ 3239
+3239 a \ 3238
+3238 a ' 0
+3237 - 3236 0
+3236 a \ 0
+3235 - 3234 0
+3234 a ' 3233
+3233 a \ 3232
+3232 a ' 3231
+3231 a ' 0
+3230 - 3229 0
+3229 a ' 0
+3228 - 3227 0
+3227 a ' 3226
+3226 a \ 3225
+3225 a n 3224
+3224 a ' 0
+3223 - 600 0
+3222 - 3221 0
+3221 a e 3220
+3220 a m 3219
+3219 a i 3218
+3218 a t 3217
+3217 a - 3216
+3216 a o 3215
+3215 a b 3214
+3214 a l 3213
+3213 a i 3212
+3212 a s 3211
+3211 a t 0
+3210 - 3209 0
+3209 a r 3208
+3208 a e 3207
+3207 a f 3206
+3206 a ( 3205
+3205 a o 3204
+3204 a b 3203
+3203 a l 3202
+3202 a i 3201
+3201 a s 3200
+3200 a t 3199
+3199 a ) 3198
+3198 a   3197
+3197 a = 3196
+3196 a   0
+3195 - 3194 3191
+3194 - 3193 0
+3193 a o 3192
+3192 a l 0
+3191 - 412 0
+3190 - 3189 0
+3189 a p 3188
+3188 a r 3187
+3187 a o 3186
+3186 a l 3185
+3185 a o 3184
+3184 a g 0
+3183 - 3182 0
+3182 a c 3181
+3181 a a 3180
+3180 a s 3179
+3179 a e 3178
+3178 a   3177
+3177 a 0 3176
+3176 a : 0
+3175 - 3174 0
+3174 a f 3173
+3173 a o 3172
+3172 a r 3171
+3171 a   3170
+3170 a ( 3169
+3169 a k 3168
+3168 a = 3167
+3167 a 0 3166
+3166 a ; 3165
+3165 a ; 3164
+3164 a ) 3163
+3163 a   3162
+3162 a s 3161
+3161 a w 3160
+3160 a i 3159
+3159 a t 3158
+3158 a c 3157
+3157 a h 3156
+3156 a   3155
+3155 a ( 3154
+3154 a k 3153
+3153 a ) 3152
+3152 a   3151
+3151 a { 0
 3150 - 3149 0
-3149 a / 0
-3148 - 2698 3147
-3147 - 2441 0
-3146 - 3145 3141
-3145 - 3144 3142
-3144 - 3143 0
-3143 a , 0
-3142 - 1562 0
-3141 - 3140 3136
-3140 - 1281 3139
-3139 - 2619 3138
-3138 - 1281 3137
-3137 - 1271 0
-3136 - 3135 3132
-3135 - 970 3134
-3134 - 2586 3133
-3133 - 970 0
-3132 - 3131 3126
-3131 - 968 3130
-3130 - 2562 3129
-3129 - 2557 3128
-3128 - 2552 3127
-3127 - 968 0
-3126 - 3125 3123
-3125 - 920 3124
-3124 - 920 0
-3123 - 3122 3120
-3122 - 912 3121
-3121 - 912 0
-3120 - 3119 3115
-3119 - 828 3118
-3118 - 2746 3117
-3117 - 2225 3116
-3116 - 828 0
-3115 - 3114 3111
-3114 - 821 3113
-3113 - 1362 3112
-3112 - 821 0
-3111 - 3110 3108
-3110 - 814 3109
-3109 - 814 0
-3108 - 3107 3102
-3107 - 811 3106
-3106 - 1503 3105
-3105 - 1478 3104
-3104 - 1404 3103
-3103 - 811 0
-3102 - 3101 3097
-3101 - 805 3100
-3100 - 2518 3099
-3099 - 1110 3098
-3098 - 805 0
-3097 - 3096 3093
-3096 - 799 3095
-3095 - 918 3094
-3094 - 799 0
-3093 - 3092 3087
-3092 - 791 3091
-3091 - 1385 3090
-3090 - 948 3089
-3089 - 910 3088
-3088 - 791 0
-3087 - 3086 3084
-3086 - 782 3085
-3085 - 782 0
-3084 - 3083 3081
-3083 - 776 3082
-3082 - 776 0
-3081 - 3080 3078
-3080 - 773 3079
-3079 - 773 0
-3078 - 3077 3075
-3077 - 770 3076
-3076 - 770 0
-3075 - 3074 3072
-3074 - 767 3073
-3073 - 767 0
-3072 - 3071 3069
-3071 - 764 3070
-3070 - 764 0
-3069 - 3068 3066
-3068 - 761 3067
-3067 - 761 0
-3066 - 3065 3063
-3065 - 758 3064
-3064 - 758 0
-3063 - 3062 3060
-3062 - 755 3061
-3061 - 755 0
-3060 - 3059 3057
-3059 - 752 3058
-3058 - 752 0
-3057 - 3056 3054
-3056 - 749 3055
-3055 - 749 0
-3054 - 3053 3051
-3053 - 746 3052
-3052 - 746 0
-3051 - 3050 3044
-3050 - 645 3049
-3049 - 2638 3048
-3048 - 2458 3047
-3047 - 1335 3046
-3046 - 1290 3045
-3045 - 645 0
-3044 - 3043 3034
-3043 - 643 3042
-3042 - 2499 3041
-3041 - 1510 3040
-3040 - 1430 3039
-3039 - 1353 3038
-3038 - 986 3037
-3037 - 643 3036
-3036 - 636 3035
-3035 - 630 0
-3034 - 3033 3020
-3033 - 795 3032
-3032 - 2474 3031
-3031 - 1918 3030
-3030 - 1774 3029
-3029 - 1349 3028
-3028 - 1343 3027
-3027 - 1315 3026
-3026 - 1103 3025
-3025 - 1063 3024
-3024 - 857 3023
-3023 - 851 3022
-3022 - 795 3021
-3021 - 614 0
-3020 - 3019 3017
-3019 - 589 3018
-3018 - 589 0
-3017 - 3016 3013
-3016 - 587 3015
-3015 - 587 3014
-3014 - 585 0
-3013 - 3012 2999
-3012 - 572 3011
-3011 - 2608 3010
-3010 - 2572 3009
-3009 - 2465 3008
-3008 - 2033 3007
-3007 - 1978 3006
-3006 - 1262 3005
-3005 - 1081 3004
-3004 - 1076 3003
-3003 - 697 3002
-3002 - 678 3001
-3001 - 652 3000
-3000 - 572 0
-2999 - 2998 2994
-2998 - 567 2997
-2997 - 1752 2996
-2996 - 1746 2995
-2995 - 567 0
-2994 - 2993 2989
-2993 - 2992 2990
-2992 - 2991 0
-2991 a . 0
-2990 - 562 0
-2989 - 2988 2975
-2988 - 802 2987
-2987 - 2514 2986
-2986 - 1913 2985
-2985 - 1783 2984
-2984 - 1588 2983
-2983 - 802 2982
-2982 - 666 2981
-2981 - 602 2980
-2980 - 595 2979
-2979 - 565 2978
-2978 - 558 2977
-2977 - 550 2976
-2976 - 541 0
-2975 - 2974 2970
-2974 - 787 2973
-2973 - 2399 2972
-2972 - 787 2971
-2971 - 529 0
-2970 - 2969 2955
-2969 - 639 2968
-2968 - 1622 2967
-2967 - 1179 2966
-2966 - 1155 2965
-2965 - 1142 2964
-2964 - 1126 2963
-2963 - 705 2962
-2962 - 688 2961
-2961 - 639 2960
-2960 - 623 2959
-2959 - 490 2958
-2958 - 473 2957
-2957 - 462 2956
-2956 - 442 0
-2955 - 2954 2950
-2954 - 330 2953
-2953 - 1375 2952
-2952 - 1219 2951
-2951 - 330 0
-2950 - 2949 2910
-2949 - 464 2948
-2948 - 2654 2947
-2947 - 2616 2946
-2946 - 2534 2945
-2945 - 2298 2944
-2944 - 2267 2943
-2943 - 2156 2942
-2942 - 2107 2941
-2941 - 2077 2940
-2940 - 2061 2939
-2939 - 2006 2938
-2938 - 1951 2937
-2937 - 1889 2936
-2936 - 1872 2935
-2935 - 1852 2934
-2934 - 1831 2933
-2933 - 1803 2932
-2932 - 1695 2931
-2931 - 1581 2930
-2930 - 1482 2929
-2929 - 1423 2928
-2928 - 1238 2927
-2927 - 991 2926
-2926 - 955 2925
-2925 - 928 2924
-2924 - 888 2923
-2923 - 875 2922
-2922 - 866 2921
-2921 - 672 2920
-2920 - 519 2919
-2919 - 506 2918
-2918 - 497 2917
-2917 - 464 2916
-2916 - 350 2915
-2915 - 341 2914
-2914 - 328 2913
-2913 - 321 2912
-2912 - 297 2911
-2911 - 290 0
-2910 - 2909 2898
-2909 - 570 2908
-2908 - 1444 2907
-2907 - 1088 2906
-2906 - 1012 2905
-2905 - 570 2904
-2904 - 425 2903
-2903 - 401 2902
-2902 - 392 2901
-2901 - 359 2900
-2900 - 266 2899
-2899 - 262 0
-2898 - 2897 2883
-2897 - 574 2896
-2896 - 2760 2895
-2895 - 2248 2894
-2894 - 1907 2893
-2893 - 1900 2892
-2892 - 1595 2891
-2891 - 1548 2890
-2890 - 1537 2889
-2889 - 1369 2888
-2888 - 1115 2887
-2887 - 1002 2886
-2886 - 574 2885
-2885 - 417 2884
-2884 - 256 0
-2883 - 2882 2878
-2882 - 818 2881
-2881 - 2189 2880
-2880 - 818 2879
-2879 - 171 0
-2878 - 2877 2866
-2877 - 825 2876
-2876 - 2661 2875
-2875 - 2546 2874
-2874 - 1210 2873
-2873 - 1197 2872
-2872 - 825 2871
-2871 - 744 2870
-2870 - 736 2869
-2869 - 711 2868
-2868 - 433 2867
-2867 - 165 0
-2866 - 2865 2863
-2865 - 153 2864
-2864 - 153 0
-2863 - 2862 2835
-2862 - 521 2861
-2861 - 2596 2860
-2860 - 2591 2859
-2859 - 2567 2858
-2858 - 2507 2857
-2857 - 2372 2856
-2856 - 2335 2855
-2855 - 1894 2854
-2854 - 1704 2853
-2853 - 1279 2852
-2852 - 1094 2851
-2851 - 521 2850
-2850 - 251 2849
-2849 - 244 2848
-2848 - 237 2847
-2847 - 230 2846
-2846 - 223 2845
-2845 - 216 2844
-2844 - 209 2843
-2843 - 202 2842
-2842 - 195 2841
-2841 - 189 2840
-2840 - 183 2839
-2839 - 177 2838
-2838 - 160 2837
-2837 - 151 2836
-2836 - 146 0
-2835 - 2834 2825
-2834 - 333 2833
-2833 - 1640 2832
-2832 - 1191 2831
-2831 - 1166 2830
-2830 - 1027 2829
-2829 - 450 2828
-2828 - 410 2827
-2827 - 333 2826
-2826 - 141 0
-2825 - 2824 2822
-2824 - 135 2823
-2823 - 135 0
-2822 - 2821 2819
-2821 - 129 2820
-2820 - 129 0
-2819 - 2818 2811
-2818 - 123 2817
-2817 - 1664 2816
-2816 - 1555 2815
-2815 - 1492 2814
-2814 - 1356 2813
-2813 - 1330 2812
-2812 - 123 0
-2811 - 2810 2808
-2810 - 117 2809
-2809 - 117 0
-2808 - 2807 2773
-2807 - 779 2806
-2806 - 2753 2805
-2805 - 2736 2804
-2804 - 2380 2803
-2803 - 2343 2802
-2802 - 2306 2801
-2801 - 2277 2800
-2800 - 2254 2799
-2799 - 2231 2798
-2798 - 2208 2797
-2797 - 2202 2796
-2796 - 2197 2795
-2795 - 2162 2794
-2794 - 1859 2793
-2793 - 1837 2792
-2792 - 1739 2791
-2791 - 1727 2790
-2790 - 1715 2789
-2789 - 1648 2788
-2788 - 1630 2787
-2787 - 1612 2786
-2786 - 965 2785
-2785 - 841 2784
-2784 - 779 2783
-2783 - 660 2782
-2782 - 476 2781
-2781 - 457 2780
-2780 - 453 2779
-2779 - 368 2778
-2778 - 133 2777
-2777 - 127 2776
-2776 - 121 2775
-2775 - 115 2774
-2774 - 107 0
-2773 - 2772 0
-2772 - 1 2771
-2771 - 2583 2770
-2770 - 2118 2769
-2769 - 1811 2768
-2768 - 1767 2767
-2767 - 1604 2766
-2766 - 1456 2765
-2765 - 1200 2764
-2764 - 1129 2763
-2763 - 1020 2762
-2762 - 536 2761
-2761 - 1 0
-2760 - 2759 0
-2759 a l 2758
-2758 a i 2757
-2757 a s 2756
-2756 a c 2755
-2755 a m 2754
-2754 a p 0
-2753 - 2752 0
-2752 a * 2751
-2751 a s 2750
-2750 a t 2749
-2749 a o 2748
-2748 a p 0
-2747 - 135 0
-2746 - 2745 0
-2745 a d 2744
-2744 a u 2743
-2743 a m 2742
-2742 a p 2741
-2741 a - 2740
-2740 a p 2739
-2739 a o 2738
-2738 a o 2737
-2737 a l 0
-2736 - 2735 0
-2735 a * 2734
-2734 a * 2733
-2733 a * 2732
-2732 a * 2731
-2731 a * 2730
-2730 a * 2729
-2729 a * 2728
-2728 a * 2727
-2727 a * 2726
-2726 a * 2725
-2725 a * 2724
-2724 a * 2723
-2723 a * 2722
-2722 a * 2721
-2721 a * 2720
-2720 a * 2719
-2719 a * 2718
-2718 a * 2717
-2717 a * 2716
-2716 a * 2715
-2715 a * 2714
-2714 a * 2713
-2713 a * 2712
-2712 a * 2711
-2711 a * 2710
-2710 a * 2709
-2709 a * 2708
-2708 a * 2707
-2707 a * 2706
-2706 a * 2705
-2705 a * 2704
-2704 a * 2703
-2703 a * 2702
-2702 a * 2701
-2701 a * 2700
-2700 a / 0
-2699 - 135 0
-2698 - 2697 0
-2697 a / 2696
-2696 a * 2695
-2695 a * 2694
-2694 a * 2693
-2693 a * 2692
-2692 a * 2691
-2691 a * 2690
-2690 a * 2689
-2689 a * 2688
-2688 a   2687
-2687 a p 2686
-2686 a o 2685
-2685 a o 2684
-2684 a l 2683
-2683 a   2682
-2682 a d 2681
-2681 a u 2680
-2680 a m 2679
-2679 a p 2678
-2678 a   2677
-2677 a f 2676
-2676 a o 2675
-2675 a l 2674
-2674 a l 2673
-2673 a o 2672
-2672 a w 2671
-2671 a s 2670
-2670 a   2669
-2669 a * 2668
-2668 a * 2667
-2667 a * 2666
-2666 a * 2665
-2665 a * 2664
-2664 a * 2663
-2663 a * 2662
-2662 a * 0
-2661 - 2660 0
-2660 a e 2659
-2659 a p 2658
-2658 a i 2657
-2657 a l 2656
-2656 a o 2655
-2655 a g 0
-2654 - 2653 0
-2653 a r 2652
-2652 a e 2651
-2651 a f 2650
-2650 a ( 2649
-2649 a s 2648
-2648 a y 2647
-2647 a m 2646
-2646 a l 2645
-2645 a i 2644
-2644 a s 2643
-2643 a ) 2642
-2642 a   2641
-2641 a = 2640
-2640 a   0
-2639 - 135 0
-2638 - 2637 0
-2637 a v 2636
-2636 a o 2635
-2635 a i 2634
-2634 a d 2633
-2633 a   2632
-2632 a s 2631
-2631 a e 2630
-2630 a t 2629
-2629 a u 2628
+3149 a s 3148
+3148 a e 3147
+3147 a t 3146
+3146 a u 3145
+3145 a p 3144
+3144 a ( 3143
+3143 a ) 3142
+3142 a ; 0
+3141 - 3140 0
+3140 a i 3139
+3139 a n 3138
+3138 a t 3137
+3137 a   3136
+3136 a k 3135
+3135 a ; 0
+3134 - 3133 0
+3133 a v 3132
+3132 a o 3131
+3131 a i 3130
+3130 a d 3129
+3129 a   3128
+3128 a r 3127
+3127 a u 3126
+3126 a n 3125
+3125 a ( 3124
+3124 a v 3123
+3123 a o 3122
+3122 a i 3121
+3121 a d 3120
+3120 a ) 3119
+3119 a   3118
+3118 a { 0
+3117 - 3116 0
+3116 a / 3115
+3115 a * 3114
+3114 a * 3113
+3113 a * 3112
+3112 a * 3111
+3111 a * 3110
+3110 a * 3109
+3109 a * 3108
+3108 a * 3107
+3107 a   3106
+3106 a l 3105
+3105 a i 3104
+3104 a s 3103
+3103 a c 3102
+3102 a m 3101
+3101 a p 3100
+3100 a   3099
+3099 a o 3098
+3098 a u 3097
+3097 a t 3096
+3096 a p 3095
+3095 a u 3094
+3094 a t 3093
+3093 a   3092
+3092 a f 3091
+3091 a o 3090
+3090 a l 3089
+3089 a l 3088
+3088 a o 3087
+3087 a w 3086
+3086 a s 3085
+3085 a   3084
+3084 a * 3083
+3083 a * 3082
+3082 a * 3081
+3081 a * 3080
+3080 a * 3079
+3079 a * 3078
+3078 a * 3077
+3077 a * 3076
+3076 a / 0
+3075 - 3074 0
+3074 a w 3073
+3073 a r 3072
+3072 a i 3071
+3071 a t 3070
+3070 a e 3069
+3069 a c 3068
+3068 a ( 3067
+3067 a r 3066
+3066 a e 3065
+3065 a f 3064
+3064 a ( 3063
+3063 a e 3062
+3062 a x 3061
+3061 a p 3060
+3060 a r 3059
+3059 a ) 3058
+3058 a ) 3057
+3057 a ; 0
+3056 - 3055 0
+3055 a * 3054
+3054 a w 3053
+3053 a r 3052
+3052 a i 3051
+3051 a t 3050
+3050 a e 3049
+3049 a c 0
+3048 - 3047 0
+3047 a c 3046
+3046 a d 3045
+3045 a r 3044
+3044 a [ 3043
+3043 a r 3042
+3042 a e 3041
+3041 a f 3040
+3040 a ( 3039
+3039 a e 3038
+3038 a x 3037
+3037 a p 3036
+3036 a r 3035
+3035 a ) 3034
+3034 a ] 3033
+3033 a   3032
+3032 a = 3031
+3031 a   3030
+3030 a r 3029
+3029 a e 3028
+3028 a f 3027
+3027 a ( 3026
+3026 a e 3025
+3025 a x 3024
+3024 a p 3023
+3023 a r 3022
+3022 a 2 3021
+3021 a ) 3020
+3020 a ; 0
+3019 - 3018 0
+3018 a * 3017
+3017 a r 3016
+3016 a p 3015
+3015 a l 3014
+3014 a a 3013
+3013 a c 3012
+3012 a d 0
+3011 - 3010 0
+3010 a c 3009
+3009 a a 3008
+3008 a r 3007
+3007 a [ 3006
+3006 a r 3005
+3005 a e 3004
+3004 a f 3003
+3003 a ( 3002
+3002 a e 3001
+3001 a x 3000
+3000 a p 2999
+2999 a r 2998
+2998 a ) 2997
+2997 a ] 2996
+2996 a   2995
+2995 a = 2994
+2994 a   2993
+2993 a r 2992
+2992 a e 2991
+2991 a f 2990
+2990 a ( 2989
+2989 a e 2988
+2988 a x 2987
+2987 a p 2986
+2986 a r 2985
+2985 a 2 2984
+2984 a ) 2983
+2983 a ; 0
+2982 - 2981 0
+2981 a * 2980
+2980 a r 2979
+2979 a p 2978
+2978 a l 2977
+2977 a a 2976
+2976 a c 2975
+2975 a a 0
+2974 - 2973 0
+2973 a r 2972
+2972 a e 2971
+2971 a f 2970
+2970 a ( 2969
+2969 a e 2968
+2968 a x 2967
+2967 a p 2966
+2966 a r 2965
+2965 a ) 2964
+2964 a   2963
+2963 a = 2962
+2962 a   2961
+2961 a r 2960
+2960 a d 2959
+2959 a o 2958
+2958 a b 2957
+2957 a j 2956
+2956 a ( 2955
+2955 a ) 2954
+2954 a ; 0
+2953 - 2952 0
+2952 a * 2951
+2951 a r 2950
+2950 a e 2949
+2949 a a 2948
+2948 a d 0
+2947 - 2946 0
+2946 a r 2945
+2945 a e 2944
+2944 a f 2943
+2943 a ( 2942
+2942 a e 2941
+2941 a x 2940
+2940 a p 2939
+2939 a r 2938
+2938 a ) 2937
+2937 a   2936
+2936 a = 2935
+2935 a   2934
+2934 a p 2933
+2933 a e 2932
+2932 a e 2931
+2931 a k 2930
+2930 a c 2929
+2929 a ( 2928
+2928 a ) 2927
+2927 a ; 0
+2926 - 2925 0
+2925 a * 2924
+2924 a p 2923
+2923 a e 2922
+2922 a e 2921
+2921 a k 2920
+2920 a c 0
+2919 - 2918 0
+2918 a r 2917
+2917 a e 2916
+2916 a f 2915
+2915 a ( 2914
+2914 a e 2913
+2913 a x 2912
+2912 a p 2911
+2911 a r 2910
+2910 a ) 2909
+2909 a   2908
+2908 a = 2907
+2907 a   2906
+2906 a r 2905
+2905 a e 2904
+2904 a a 2903
+2903 a d 2902
+2902 a c 2901
+2901 a ( 2900
+2900 a ) 2899
+2899 a ; 0
+2898 - 2897 0
+2897 a * 2896
+2896 a r 2895
+2895 a e 2894
+2894 a a 2893
+2893 a d 2892
+2892 a c 0
+2891 - 2212 2890
+2890 - 2200 2889
+2889 - 2188 0
+2888 - 2887 0
+2887 a r 2886
+2886 a e 2885
+2885 a f 2884
+2884 a ( 2883
+2883 a e 2882
+2882 a x 2881
+2881 a p 2880
+2880 a r 2879
+2879 a ) 2878
+2878 a + 2877
+2877 a + 2876
+2876 a ; 0
+2875 - 2874 0
+2874 a * 2873
+2873 a n 2872
+2872 a e 2871
+2871 a x 2870
+2870 a t 0
+2869 - 2868 0
+2868 a l 2867
+2867 a o 2866
+2866 a a 2865
+2865 a d 2864
+2864 a ( 2863
+2863 a r 2862
+2862 a e 2861
+2861 a f 2860
+2860 a ( 2859
+2859 a e 2858
+2858 a x 2857
+2857 a p 2856
+2856 a r 2855
+2855 a ) 2854
+2854 a ) 2853
+2853 a ; 0
+2852 - 2851 0
+2851 a * 2850
+2850 a l 2849
+2849 a o 2848
+2848 a a 2847
+2847 a d 0
+2846 - 2845 0
+2845 a d 2844
+2844 a u 2843
+2843 a m 2842
+2842 a p 2841
+2841 a ( 2840
+2840 a r 2839
+2839 a e 2838
+2838 a f 2837
+2837 a ( 2836
+2836 a e 2835
+2835 a x 2834
+2834 a p 2833
+2833 a r 2832
+2832 a ) 2831
+2831 a ) 2830
+2830 a ; 0
+2829 - 2828 0
+2828 a * 2827
+2827 a d 2826
+2826 a u 2825
+2825 a m 2824
+2824 a p 0
+2823 - 2822 0
+2822 a * 2821
+2821 a c 2820
+2820 a d 2819
+2819 a r 0
+2818 - 2817 0
+2817 a * 2816
+2816 a c 2815
+2815 a a 2814
+2814 a r 0
+2813 - 2121 2812
+2812 - 2103 2811
+2811 - 2085 0
+2810 - 2809 0
+2809 a h 2808
+2808 a a 2807
+2807 a l 2806
+2806 a t 2805
+2805 a ( 2804
+2804 a a 2803
+2803 a t 2802
+2802 a o 2801
+2801 a m 2800
+2800 a n 2799
+2799 a a 2798
+2798 a m 2797
+2797 a e 2796
+2796 a ( 2795
+2795 a r 2794
+2794 a e 2793
+2793 a f 2792
+2792 a ( 2791
+2791 a e 2790
+2790 a x 2789
+2789 a p 2788
+2788 a r 2787
+2787 a ) 2786
+2786 a ) 2785
+2785 a , 2784
+2784 a   2783
+2783 a l 2782
+2782 a i 2781
+2781 a m 2780
+2780 a i 2779
+2779 a t 2778
+2778 a ) 2777
+2777 a ; 0
+2776 - 2775 0
+2775 a * 2774
+2774 a h 2773
+2773 a a 2772
+2772 a l 2771
+2771 a t 0
+2770 - 2769 0
+2769 a % 0
+2768 - 2767 0
+2767 a / 0
+2766 - 2765 0
+2765 a + 0
+2764 - 2763 0
+2763 a r 2762
+2762 a e 2761
+2761 a f 2760
+2760 a ( 2759
+2759 a e 2758
+2758 a x 2757
+2757 a p 2756
+2756 a r 2755
+2755 a ) 2754
+2754 a   2753
+2753 a = 2752
+2752 a   2751
+2751 a n 2750
+2750 a u 2749
+2749 a m 2748
+2748 a e 2747
+2747 a r 2746
+2746 a i 2745
+2745 a c 2744
+2744 a ( 2743
+2743 a ) 2742
+2742 a ? 2741
+2741 a   2740
+2740 a t 2739
+2739 a r 2738
+2738 a u 2737
+2737 a e 2736
+2736 a : 2735
+2735 a   2734
+2734 a n 2733
+2733 a i 2732
+2732 a l 2731
+2731 a ; 0
+2730 - 2729 0
+2729 a r 2728
+2728 a e 2727
+2727 a f 2726
+2726 a ( 2725
+2725 a e 2724
+2724 a x 2723
+2723 a p 2722
+2722 a r 2721
+2721 a ) 2720
+2720 a   2719
+2719 a = 2718
+2718 a   2717
+2717 a r 2716
+2716 a e 2715
+2715 a f 2714
+2714 a ( 2713
+2713 a e 2712
+2712 a x 2711
+2711 a p 2710
+2710 a r 2709
+2709 a ) 2708
+2708 a   2707
+2707 a = 2706
+2706 a = 2705
+2705 a   2704
+2704 a r 2703
+2703 a e 2702
+2702 a f 2701
+2701 a ( 2700
+2700 a e 2699
+2699 a x 2698
+2698 a p 2697
+2697 a r 2696
+2696 a 2 2695
+2695 a ) 2694
+2694 a ? 2693
+2693 a   0
+2692 - 2691 0
+2691 a t 2690
+2690 a r 2689
+2689 a u 2688
+2688 a e 2687
+2687 a : 2686
+2686 a   2685
+2685 a n 2684
+2684 a i 2683
+2683 a l 2682
+2682 a ; 0
+2681 - 2680 0
+2680 a r 2679
+2679 a e 2678
+2678 a f 2677
+2677 a ( 2676
+2676 a e 2675
+2675 a x 2674
+2674 a p 2673
+2673 a r 2672
+2672 a ) 2671
+2671 a   2670
+2670 a = 2669
+2669 a   2668
+2668 a c 2667
+2667 a o 2666
+2666 a n 2665
+2665 a s 2664
+2664 a 3 2663
+2663 a ( 2662
+2662 a r 2661
+2661 a e 2660
+2660 a f 2659
+2659 a ( 2658
+2658 a e 2657
+2657 a x 2656
+2656 a p 2655
+2655 a r 2654
+2654 a ) 2653
+2653 a , 2652
+2652 a   0
+2651 - 2650 0
+2650 a r 2649
+2649 a e 2648
+2648 a f 2647
+2647 a ( 2646
+2646 a e 2645
+2645 a x 2644
+2644 a p 2643
+2643 a r 2642
+2642 a 2 2641
+2641 a ) 2640
+2640 a , 2639
+2639 a   2638
+2638 a 0 2637
+2637 a ) 2636
+2636 a ; 0
+2635 - 2634 0
+2634 a r 2633
+2633 a e 2632
+2632 a f 2631
+2631 a ( 2630
+2630 a e 2629
+2629 a x 2628
 2628 a p 2627
-2627 a ( 2626
-2626 a v 2625
-2625 a o 2624
-2624 a i 2623
-2623 a d 2622
-2622 a ) 2621
-2621 a   2620
-2620 a { 0
-2619 - 2618 0
-2618 a } 2617
-2617 a } 0
-2616 - 2615 0
-2615 a r 2614
+2627 a r 2626
+2626 a ) 2625
+2625 a   2624
+2624 a = 2623
+2623 a   2622
+2622 a c 2621
+2621 a d 2620
+2620 a r 2619
+2619 a [ 2618
+2618 a r 2617
+2617 a e 2616
+2616 a f 2615
+2615 a ( 2614
 2614 a e 2613
-2613 a t 2612
-2612 a u 2611
+2613 a x 2612
+2612 a p 2611
 2611 a r 2610
-2610 a n 2609
-2609 a ; 0
-2608 - 2607 0
-2607 a i 2606
-2606 a n 2605
-2605 a i 2604
-2604 a t 2603
-2603 a - 2602
-2602 a c 2601
-2601 a e 2600
-2600 a l 2599
-2599 a l 2598
-2598 a s 0
-2597 - 570 0
-2596 - 2595 0
-2595 a c 2594
-2594 a a 2593
-2593 a r 2592
-2592 a [ 0
-2591 - 2590 0
-2590 a c 2589
-2589 a d 2588
-2588 a r 2587
-2587 a [ 0
-2586 - 2585 0
-2585 a ; 2584
-2584 a   0
-2583 - 2582 0
-2582 a t 2581
-2581 a a 2580
-2580 a g 2579
-2579 a [ 0
-2578 - 2577 0
-2577 a ] 2576
-2576 a   2575
-2575 a = 2574
-2574 a   0
-2573 - 570 0
-2572 - 2571 0
-2571 a i 2570
-2570 a n 2569
-2569 a i 2568
-2568 a t 0
+2610 a ) 2609
+2609 a ] 2608
+2608 a ; 0
+2607 - 2606 0
+2606 a i 2605
+2605 a f 2604
+2604 a   2603
+2603 a ( 2602
+2602 a n 2601
+2601 a u 2600
+2600 a m 2599
+2599 a e 2598
+2598 a r 2597
+2597 a i 2596
+2596 a c 2595
+2595 a ( 2594
+2594 a ) 2593
+2593 a   2592
+2592 a | 2591
+2591 a | 2590
+2590 a   2589
+2589 a s 2588
+2588 a y 2587
+2587 a m 2586
+2586 a b 2585
+2585 a o 2584
+2584 a l 2583
+2583 a i 2582
+2582 a c 2581
+2581 a ( 2580
+2580 a ) 2579
+2579 a ) 2578
+2578 a   2577
+2577 a c 2576
+2576 a d 2575
+2575 a r 2574
+2574 a _ 2573
+2573 a e 2572
+2572 a r 2571
+2571 a r 2570
+2570 a ( 2569
+2569 a ) 2568
+2568 a ; 0
 2567 - 2566 0
-2566 a c 2565
-2565 a h 2564
-2564 a a 2563
-2563 a r 0
-2562 - 2561 0
-2561 a ' 2560
-2560 a \ 2559
-2559 a \ 2558
-2558 a ' 0
-2557 - 2556 0
-2556 a ' 2555
-2555 a \ 2554
-2554 a ' 2553
-2553 a ' 0
-2552 - 2551 0
-2551 a ' 2550
-2550 a \ 2549
-2549 a n 2548
-2548 a ' 0
-2547 - 521 0
-2546 - 2545 0
-2545 a e 2544
-2544 a m 2543
-2543 a i 2542
-2542 a t 2541
-2541 a - 2540
-2540 a o 2539
-2539 a b 2538
-2538 a l 2537
-2537 a i 2536
-2536 a s 2535
-2535 a t 0
-2534 - 2533 0
-2533 a r 2532
-2532 a e 2531
-2531 a f 2530
-2530 a ( 2529
-2529 a o 2528
-2528 a b 2527
-2527 a l 2526
-2526 a i 2525
-2525 a s 2524
-2524 a t 2523
-2523 a ) 2522
+2566 a r 2565
+2565 a e 2564
+2564 a f 2563
+2563 a ( 2562
+2562 a e 2561
+2561 a x 2560
+2560 a p 2559
+2559 a r 2558
+2558 a ) 2557
+2557 a   2556
+2556 a = 2555
+2555 a   2554
+2554 a c 2553
+2553 a a 2552
+2552 a r 2551
+2551 a [ 2550
+2550 a r 2549
+2549 a e 2548
+2548 a f 2547
+2547 a ( 2546
+2546 a e 2545
+2545 a x 2544
+2544 a p 2543
+2543 a r 2542
+2542 a ) 2541
+2541 a ] 2540
+2540 a ; 0
+2539 - 2538 0
+2538 a i 2537
+2537 a f 2536
+2536 a   2535
+2535 a ( 2534
+2534 a n 2533
+2533 a u 2532
+2532 a m 2531
+2531 a e 2530
+2530 a r 2529
+2529 a i 2528
+2528 a c 2527
+2527 a ( 2526
+2526 a ) 2525
+2525 a   2524
+2524 a | 2523
+2523 a | 2522
 2522 a   2521
-2521 a = 2520
-2520 a   0
-2519 - 2518 2515
-2518 - 2517 0
+2521 a s 2520
+2520 a y 2519
+2519 a m 2518
+2518 a b 2517
 2517 a o 2516
-2516 a l 0
-2515 - 333 0
-2514 - 2513 0
-2513 a p 2512
-2512 a r 2511
-2511 a o 2510
-2510 a l 2509
-2509 a o 2508
-2508 a g 0
-2507 - 2506 0
-2506 a c 2505
-2505 a a 2504
-2504 a s 2503
-2503 a e 2502
-2502 a   2501
-2501 a 0 2500
-2500 a : 0
+2516 a l 2515
+2515 a i 2514
+2514 a c 2513
+2513 a ( 2512
+2512 a ) 2511
+2511 a ) 2510
+2510 a   2509
+2509 a c 2508
+2508 a a 2507
+2507 a r 2506
+2506 a _ 2505
+2505 a e 2504
+2504 a r 2503
+2503 a r 2502
+2502 a ( 2501
+2501 a ) 2500
+2500 a ; 0
 2499 - 2498 0
-2498 a f 2497
-2497 a o 2496
-2496 a r 2495
-2495 a   2494
-2494 a ( 2493
-2493 a k 2492
-2492 a = 2491
-2491 a 0 2490
-2490 a ; 2489
-2489 a ; 2488
-2488 a ) 2487
+2498 a r 2497
+2497 a e 2496
+2496 a f 2495
+2495 a ( 2494
+2494 a e 2493
+2493 a x 2492
+2492 a p 2491
+2491 a r 2490
+2490 a ) 2489
+2489 a   2488
+2488 a = 2487
 2487 a   2486
-2486 a s 2485
-2485 a w 2484
-2484 a i 2483
-2483 a t 2482
-2482 a c 2481
-2481 a h 2480
-2480 a   2479
-2479 a ( 2478
-2478 a k 2477
-2477 a ) 2476
-2476 a   2475
-2475 a { 0
-2474 - 2473 0
-2473 a s 2472
-2472 a e 2471
-2471 a t 2470
-2470 a u 2469
-2469 a p 2468
-2468 a ( 2467
-2467 a ) 2466
-2466 a ; 0
-2465 - 2464 0
-2464 a i 2463
-2463 a n 2462
-2462 a t 2461
-2461 a   2460
-2460 a k 2459
-2459 a ; 0
-2458 - 2457 0
-2457 a v 2456
-2456 a o 2455
-2455 a i 2454
-2454 a d 2453
-2453 a   2452
-2452 a r 2451
-2451 a u 2450
-2450 a n 2449
-2449 a ( 2448
-2448 a v 2447
+2486 a a 2485
+2485 a t 2484
+2484 a o 2483
+2483 a m 2482
+2482 a i 2481
+2481 a c 2480
+2480 a ( 2479
+2479 a ) 2478
+2478 a ? 2477
+2477 a   2476
+2476 a t 2475
+2475 a r 2474
+2474 a u 2473
+2473 a e 2472
+2472 a : 2471
+2471 a   2470
+2470 a n 2469
+2469 a i 2468
+2468 a l 2467
+2467 a ; 0
+2466 - 2465 0
+2465 a s 2464
+2464 a e 2463
+2463 a t 2462
+2462 a q 0
+2461 - 2460 0
+2460 a p 2459
+2459 a r 2458
+2458 a o 2457
+2457 a g 2456
+2456 a n 0
+2455 - 2454 0
+2454 a l 2453
+2453 a a 2452
+2452 a b 2451
+2451 a e 2450
+2450 a l 0
+2449 - 2448 0
+2448 a c 2447
 2447 a o 2446
-2446 a i 2445
-2445 a d 2444
-2444 a ) 2443
-2443 a   2442
-2442 a { 0
-2441 - 2440 0
-2440 a / 2439
-2439 a * 2438
-2438 a * 2437
-2437 a * 2436
-2436 a * 2435
-2435 a * 2434
-2434 a * 2433
-2433 a * 2432
-2432 a * 2431
-2431 a   2430
-2430 a l 2429
-2429 a i 2428
-2428 a s 2427
-2427 a c 2426
-2426 a m 2425
-2425 a p 2424
-2424 a   2423
-2423 a o 2422
-2422 a u 2421
-2421 a t 2420
+2446 a n 2445
+2445 a d 0
+2444 - 2443 0
+2443 a r 2442
+2442 a e 2441
+2441 a f 2440
+2440 a ( 2439
+2439 a e 2438
+2438 a x 2437
+2437 a p 2436
+2436 a r 2435
+2435 a ) 2434
+2434 a   2433
+2433 a = 2432
+2432 a   2431
+2431 a v 2430
+2430 a a 2429
+2429 a l 2428
+2428 a ( 0
+2427 - 2426 0
+2426 a r 2425
+2425 a e 2424
+2424 a f 2423
+2423 a ( 2422
+2422 a e 2421
+2421 a x 2420
 2420 a p 2419
-2419 a u 2418
-2418 a t 2417
+2419 a r 2418
+2418 a ) 2417
 2417 a   2416
-2416 a f 2415
-2415 a o 2414
-2414 a l 2413
-2413 a l 2412
-2412 a o 2411
-2411 a w 2410
-2410 a s 2409
-2409 a   2408
-2408 a * 2407
-2407 a * 2406
-2406 a * 2405
-2405 a * 2404
-2404 a * 2403
-2403 a * 2402
-2402 a * 2401
-2401 a * 2400
-2400 a / 0
-2399 - 2398 0
-2398 a w 2397
-2397 a r 2396
-2396 a i 2395
-2395 a t 2394
-2394 a e 2393
-2393 a c 2392
-2392 a ( 2391
-2391 a r 2390
-2390 a e 2389
-2389 a f 2388
-2388 a ( 2387
-2387 a e 2386
-2386 a x 2385
-2385 a p 2384
-2384 a r 2383
-2383 a ) 2382
-2382 a ) 2381
-2381 a ; 0
-2380 - 2379 0
-2379 a * 2378
-2378 a w 2377
-2377 a r 2376
-2376 a i 2375
-2375 a t 2374
-2374 a e 2373
-2373 a c 0
-2372 - 2371 0
-2371 a c 2370
-2370 a d 2369
-2369 a r 2368
-2368 a [ 2367
-2367 a r 2366
-2366 a e 2365
-2365 a f 2364
-2364 a ( 2363
-2363 a e 2362
-2362 a x 2361
-2361 a p 2360
-2360 a r 2359
-2359 a ) 2358
-2358 a ] 2357
+2416 a = 2415
+2415 a   0
+2414 - 2413 0
+2413 a r 2412
+2412 a e 2411
+2411 a f 2410
+2410 a ( 2409
+2409 a e 2408
+2408 a x 2407
+2407 a p 2406
+2406 a r 2405
+2405 a ) 2404
+2404 a   2403
+2403 a = 2402
+2402 a   2401
+2401 a l 2400
+2400 a i 2399
+2399 a m 2398
+2398 a i 2397
+2397 a t 2396
+2396 a ; 0
+2395 - 2394 0
+2394 a * 2393
+2393 a l 2392
+2392 a i 2391
+2391 a m 2390
+2390 a i 2389
+2389 a t 0
+2388 - 2387 0
+2387 a r 2386
+2386 a e 2385
+2385 a f 2384
+2384 a ( 2383
+2383 a e 2382
+2382 a x 2381
+2381 a p 2380
+2380 a r 2379
+2379 a ) 2378
+2378 a   2377
+2377 a = 2376
+2376 a   2375
+2375 a 0 2374
+2374 a ; 0
+2373 - 2372 0
+2372 a * 2371
+2371 a p 2370
+2370 a o 2369
+2369 a o 2368
+2368 a l 0
+2367 - 2366 0
+2366 a r 2365
+2365 a e 2364
+2364 a f 2363
+2363 a ( 2362
+2362 a e 2361
+2361 a x 2360
+2360 a p 2359
+2359 a r 2358
+2358 a ) 2357
 2357 a   2356
 2356 a = 2355
 2355 a   2354
-2354 a r 2353
-2353 a e 2352
-2352 a f 2351
-2351 a ( 2350
-2350 a e 2349
-2349 a x 2348
-2348 a p 2347
-2347 a r 2346
-2346 a 2 2345
-2345 a ) 2344
-2344 a ; 0
-2343 - 2342 0
-2342 a * 2341
-2341 a r 2340
-2340 a p 2339
-2339 a l 2338
-2338 a a 2337
-2337 a c 2336
-2336 a d 0
-2335 - 2334 0
-2334 a c 2333
-2333 a a 2332
-2332 a r 2331
-2331 a [ 2330
+2354 a t 2353
+2353 a r 2352
+2352 a u 2351
+2351 a e 2350
+2350 a ; 0
+2349 - 135 2348
+2348 - 1223 0
+2347 - 2346 0
+2346 a a 2345
+2345 a r 2344
+2344 a i 2343
+2343 a t 2342
+2342 a h 2341
+2341 a c 2340
+2340 a o 2339
+2339 a m 0
+2338 - 2337 0
+2337 a r 2336
+2336 a e 2335
+2335 a f 2334
+2334 a ( 2333
+2333 a e 2332
+2332 a x 2331
+2331 a p 2330
 2330 a r 2329
-2329 a e 2328
-2328 a f 2327
-2327 a ( 2326
-2326 a e 2325
-2325 a x 2324
-2324 a p 2323
-2323 a r 2322
-2322 a ) 2321
-2321 a ] 2320
-2320 a   2319
-2319 a = 2318
-2318 a   2317
-2317 a r 2316
-2316 a e 2315
-2315 a f 2314
-2314 a ( 2313
-2313 a e 2312
-2312 a x 2311
-2311 a p 2310
-2310 a r 2309
-2309 a 2 2308
-2308 a ) 2307
-2307 a ; 0
-2306 - 2305 0
-2305 a * 2304
+2329 a ) 2328
+2328 a   2327
+2327 a = 2326
+2326 a   2325
+2325 a a 2324
+2324 a r 2323
+2323 a i 2322
+2322 a t 2321
+2321 a h 2320
+2320 a ( 2319
+2319 a ' 0
+2318 - 2317 0
+2317 a ' 2316
+2316 a ) 2315
+2315 a ; 0
+2314 - 135 2313
+2313 - 2312 0
+2312 - 2311 0
+2311 a o 2310
+2310 a p 0
+2309 - 2308 0
+2308 a t 2307
+2307 a w 2306
+2306 a o 2305
+2305 a a 2304
 2304 a r 2303
-2303 a p 2302
-2302 a l 2301
-2301 a a 2300
-2300 a c 2299
-2299 a a 0
-2298 - 2297 0
-2297 a r 2296
+2303 a g 2302
+2302 a s 0
+2301 - 2300 0
+2300 a r 2299
+2299 a e 2298
+2298 a f 2297
+2297 a ( 2296
 2296 a e 2295
-2295 a f 2294
-2294 a ( 2293
-2293 a e 2292
-2292 a x 2291
-2291 a p 2290
-2290 a r 2289
-2289 a ) 2288
+2295 a x 2294
+2294 a p 2293
+2293 a r 2292
+2292 a 2 2291
+2291 a ) 2290
+2290 a   2289
+2289 a = 2288
 2288 a   2287
-2287 a = 2286
-2286 a   2285
-2285 a r 2284
-2284 a e 2283
-2283 a a 2282
-2282 a d 2281
-2281 a c 2280
-2280 a ( 2279
-2279 a ) 2278
-2278 a ; 0
-2277 - 2276 0
-2276 a * 2275
-2275 a r 2274
-2274 a e 2273
-2273 a a 2272
-2272 a d 2271
-2271 a c 0
-2270 - 1739 2269
-2269 - 1727 2268
-2268 - 1715 0
-2267 - 2266 0
-2266 a r 2265
-2265 a e 2264
-2264 a f 2263
-2263 a ( 2262
-2262 a e 2261
-2261 a x 2260
-2260 a p 2259
-2259 a r 2258
-2258 a ) 2257
-2257 a + 2256
-2256 a + 2255
-2255 a ; 0
-2254 - 2253 0
-2253 a * 2252
-2252 a n 2251
-2251 a e 2250
-2250 a x 2249
-2249 a t 0
-2248 - 2247 0
-2247 a l 2246
-2246 a o 2245
-2245 a a 2244
-2244 a d 2243
-2243 a ( 2242
-2242 a r 2241
-2241 a e 2240
-2240 a f 2239
-2239 a ( 2238
-2238 a e 2237
-2237 a x 2236
-2236 a p 2235
-2235 a r 2234
-2234 a ) 2233
-2233 a ) 2232
-2232 a ; 0
-2231 - 2230 0
-2230 a * 2229
-2229 a l 2228
-2228 a o 2227
-2227 a a 2226
-2226 a d 0
-2225 - 2224 0
-2224 a d 2223
-2223 a u 2222
-2222 a m 2221
-2221 a p 2220
-2220 a ( 2219
-2219 a r 2218
-2218 a e 2217
-2217 a f 2216
-2216 a ( 2215
-2215 a e 2214
-2214 a x 2213
-2213 a p 2212
-2212 a r 2211
-2211 a ) 2210
-2210 a ) 2209
-2209 a ; 0
-2208 - 2207 0
-2207 a * 2206
-2206 a d 2205
-2205 a u 2204
-2204 a m 2203
-2203 a p 0
-2202 - 2201 0
-2201 a * 2200
-2200 a c 2199
-2199 a d 2198
-2198 a r 0
-2197 - 2196 0
-2196 a * 2195
-2195 a c 2194
+2287 a p 2286
+2286 a o 2285
+2285 a p 2284
+2284 a ( 2283
+2283 a ) 2282
+2282 a ; 0
+2281 - 2280 0
+2280 a r 2279
+2279 a e 2278
+2278 a f 2277
+2277 a ( 2276
+2276 a e 2275
+2275 a x 2274
+2274 a p 2273
+2273 a r 2272
+2272 a 2 2271
+2271 a ) 2270
+2270 a   2269
+2269 a = 2268
+2268 a   2267
+2267 a p 2266
+2266 a o 2265
+2265 a p 2264
+2264 a a 2263
+2263 a r 2262
+2262 a g 2261
+2261 a ( 2260
+2260 a ) 2259
+2259 a ; 0
+2258 - 2257 0
+2257 a p 2256
+2256 a u 2255
+2255 a s 2254
+2254 a h 2253
+2253 a ( 2252
+2252 a ) 2251
+2251 a ; 0
+2250 - 135 0
+2249 - 2248 0
+2248 a s 2247
+2247 a e 2246
+2246 a t 2245
+2245 a t 2244
+2244 a a 2243
+2243 a g 0
+2242 - 2241 0
+2241 a t 2240
+2240 a a 2239
+2239 a g 2238
+2238 a [ 2237
+2237 a r 2236
+2236 a e 2235
+2235 a f 2234
+2234 a ( 2233
+2233 a e 2232
+2232 a x 2231
+2231 a p 2230
+2230 a r 2229
+2229 a ) 2228
+2228 a ] 0
+2227 - 2226 0
+2226 a   2225
+2225 a & 2224
+2224 a = 2223
+2223 a   2222
+2222 a ~ 0
+2221 - 2220 0
+2220 a   2219
+2219 a | 2218
+2218 a = 2217
+2217 a   0
+2216 - 2215 0
+2215 a ; 0
+2214 - 2213 2202
+2213 - 2212 2203
+2212 - 2211 0
+2211 a * 2210
+2210 a s 2209
+2209 a e 2208
+2208 a t 2207
+2207 a a 2206
+2206 a t 2205
+2205 a o 2204
+2204 a m 0
+2203 - 2113 0
+2202 - 2201 2190
+2201 - 2200 2191
+2200 - 2199 0
+2199 a * 2198
+2198 a s 2197
+2197 a e 2196
+2196 a t 2195
+2195 a m 2194
 2194 a a 2193
-2193 a r 0
-2192 - 1648 2191
-2191 - 1630 2190
-2190 - 1612 0
-2189 - 2188 0
-2188 a h 2187
-2187 a a 2186
-2186 a l 2185
-2185 a t 2184
-2184 a ( 2183
-2183 a a 2182
-2182 a t 2181
-2181 a o 2180
-2180 a m 2179
-2179 a n 2178
-2178 a a 2177
-2177 a m 2176
-2176 a e 2175
-2175 a ( 2174
-2174 a r 2173
-2173 a e 2172
-2172 a f 2171
-2171 a ( 2170
-2170 a e 2169
-2169 a x 2168
-2168 a p 2167
+2193 a r 2192
+2192 a k 0
+2191 - 2095 0
+2190 - 2189 0
+2189 - 2188 2179
+2188 - 2187 0
+2187 a * 2186
+2186 a s 2185
+2185 a e 2184
+2184 a t 2183
+2183 a t 2182
+2182 a r 2181
+2181 a a 2180
+2180 a v 0
+2179 - 2077 0
+2178 - 135 0
+2177 - 2176 0
+2176 a c 2175
+2175 a h 2174
+2174 a e 2173
+2173 a c 2172
+2172 a k 2171
+2171 a t 2170
+2170 a a 2169
+2169 a g 0
+2168 - 2167 0
 2167 a r 2166
-2166 a ) 2165
-2165 a ) 2164
-2164 a , 2163
-2163 a   0
-2162 - 2161 0
-2161 a * 2160
-2160 a h 2159
-2159 a a 2158
-2158 a l 2157
-2157 a t 0
-2156 - 2155 0
-2155 a r 2154
-2154 a e 2153
-2153 a f 2152
-2152 a ( 2151
-2151 a e 2150
-2150 a x 2149
-2149 a p 2148
-2148 a r 2147
-2147 a ) 2146
-2146 a   2145
-2145 a = 2144
-2144 a   2143
+2166 a e 2165
+2165 a f 2164
+2164 a ( 2163
+2163 a e 2162
+2162 a x 2161
+2161 a p 2160
+2160 a r 2159
+2159 a ) 2158
+2158 a   2157
+2157 a = 2156
+2156 a   2155
+2155 a ( 2154
+2154 a t 2153
+2153 a a 2152
+2152 a g 2151
+2151 a [ 2150
+2150 a r 2149
+2149 a e 2148
+2148 a f 2147
+2147 a ( 2146
+2146 a e 2145
+2145 a x 2144
+2144 a p 2143
 2143 a r 2142
-2142 a e 2141
-2141 a f 2140
-2140 a ( 2139
-2139 a e 2138
-2138 a x 2137
-2137 a p 2136
-2136 a r 2135
-2135 a ) 2134
+2142 a ) 2141
+2141 a ] 2140
+2140 a   2139
+2139 a & 2138
+2138 a   0
+2137 - 2136 0
+2136 a ) 2135
+2135 a ? 2134
 2134 a   2133
-2133 a = 2132
-2132 a = 2131
-2131 a   2130
-2130 a r 2129
-2129 a e 2128
-2128 a f 2127
-2127 a ( 2126
-2126 a e 2125
-2125 a x 2124
-2124 a p 2123
-2123 a r 2122
-2122 a 2 2121
-2121 a ) 2120
-2120 a ? 2119
-2119 a   0
-2118 - 2117 0
-2117 a t 2116
-2116 a r 2115
-2115 a u 2114
-2114 a e 2113
-2113 a : 2112
-2112 a   2111
-2111 a n 2110
-2110 a i 2109
-2109 a l 2108
-2108 a ; 0
-2107 - 2106 0
-2106 a r 2105
-2105 a e 2104
-2104 a f 2103
-2103 a ( 2102
-2102 a e 2101
-2101 a x 2100
-2100 a p 2099
+2133 a t 2132
+2132 a r 2131
+2131 a u 2130
+2130 a e 2129
+2129 a : 2128
+2128 a   2127
+2127 a n 2126
+2126 a i 2125
+2125 a l 2124
+2124 a ; 0
+2123 - 2122 2105
+2122 - 2121 2114
+2121 - 2120 0
+2120 a * 2119
+2119 a a 2118
+2118 a t 2117
+2117 a o 2116
+2116 a m 2115
+2115 a p 0
+2114 - 2113 0
+2113 - 2112 0
+2112 a a 2111
+2111 a t 2110
+2110 a o 2109
+2109 a m 2108
+2108 a t 2107
+2107 a a 2106
+2106 a g 0
+2105 - 2104 2087
+2104 - 2103 2096
+2103 - 2102 0
+2102 a * 2101
+2101 a m 2100
+2100 a a 2099
 2099 a r 2098
-2098 a ) 2097
-2097 a   2096
-2096 a = 2095
-2095 a   2094
-2094 a c 2093
-2093 a o 2092
-2092 a n 2091
-2091 a s 2090
-2090 a 3 2089
-2089 a ( 2088
-2088 a r 2087
-2087 a e 2086
-2086 a f 2085
-2085 a ( 2084
-2084 a e 2083
-2083 a x 2082
-2082 a p 2081
-2081 a r 2080
-2080 a ) 2079
-2079 a , 2078
-2078 a   0
+2098 a k 2097
+2097 a p 0
+2096 - 2095 0
+2095 - 2094 0
+2094 a m 2093
+2093 a a 2092
+2092 a r 2091
+2091 a k 2090
+2090 a t 2089
+2089 a a 2088
+2088 a g 0
+2087 - 2086 0
+2086 - 2085 2078
+2085 - 2084 0
+2084 a * 2083
+2083 a t 2082
+2082 a r 2081
+2081 a a 2080
+2080 a v 2079
+2079 a p 0
+2078 - 2077 0
 2077 - 2076 0
-2076 a r 2075
-2075 a e 2074
-2074 a f 2073
-2073 a ( 2072
-2072 a e 2071
-2071 a x 2070
-2070 a p 2069
-2069 a r 2068
-2068 a 2 2067
-2067 a ) 2066
-2066 a , 2065
-2065 a   2064
-2064 a 0 2063
-2063 a ) 2062
-2062 a ; 0
+2076 a t 2075
+2075 a r 2074
+2074 a a 2073
+2073 a v 2072
+2072 a t 2071
+2071 a a 2070
+2070 a g 0
+2069 - 135 0
+2068 - 2067 0
+2067 a l 2066
+2066 a a 2065
+2065 a b 2064
+2064 a c 2063
+2063 a o 2062
+2062 a m 0
 2061 - 2060 0
-2060 a r 2059
-2059 a e 2058
-2058 a f 2057
-2057 a ( 2056
-2056 a e 2055
-2055 a x 2054
-2054 a p 2053
-2053 a r 2052
-2052 a ) 2051
-2051 a   2050
-2050 a = 2049
-2049 a   2048
-2048 a c 2047
-2047 a d 2046
-2046 a r 2045
-2045 a [ 2044
-2044 a r 2043
-2043 a e 2042
-2042 a f 2041
-2041 a ( 2040
-2040 a e 2039
-2039 a x 2038
-2038 a p 2037
-2037 a r 2036
-2036 a ) 2035
-2035 a ] 2034
-2034 a ; 0
-2033 - 2032 0
-2032 a i 2031
-2031 a f 2030
-2030 a   2029
-2029 a ( 2028
-2028 a s 2027
-2027 a y 2026
-2026 a m 2025
-2025 a b 2024
-2024 a o 2023
-2023 a l 2022
-2022 a i 2021
-2021 a c 2020
-2020 a ( 2019
-2019 a ) 2018
-2018 a ) 2017
-2017 a   2016
-2016 a c 2015
-2015 a d 2014
-2014 a r 2013
-2013 a _ 2012
-2012 a e 2011
-2011 a r 2010
-2010 a r 2009
-2009 a ( 2008
-2008 a ) 2007
-2007 a ; 0
-2006 - 2005 0
-2005 a r 2004
-2004 a e 2003
-2003 a f 2002
-2002 a ( 2001
-2001 a e 2000
-2000 a x 1999
-1999 a p 1998
-1998 a r 1997
-1997 a ) 1996
-1996 a   1995
-1995 a = 1994
-1994 a   1993
-1993 a c 1992
-1992 a a 1991
-1991 a r 1990
-1990 a [ 1989
+2060 a p 2059
+2059 a o 2058
+2058 a p 2057
+2057 a v 2056
+2056 a a 2055
+2055 a l 2054
+2054 a ( 0
+2053 - 135 0
+2052 - 2051 0
+2051 a u 2050
+2050 a n 2049
+2049 a d 2048
+2048 a o 0
+2047 - 2046 0
+2046 a p 2045
+2045 a u 2044
+2044 a s 2043
+2043 a h 2042
+2042 a v 2041
+2041 a a 2040
+2040 a l 2039
+2039 a ( 0
+2038 - 2037 0
+2037 a l 2036
+2036 a a 2035
+2035 a b 2034
+2034 a e 2033
+2033 a l 2032
+2032 a : 2031
+2031 a   2030
+2030 a e 2029
+2029 a x 2028
+2028 a p 2027
+2027 a e 2026
+2026 a c 2025
+2025 a t 2024
+2024 a e 2023
+2023 a d 2022
+2022 a   2021
+2021 a v 2020
+2020 a a 2019
+2019 a r 2018
+2018 a i 2017
+2017 a a 2016
+2016 a b 2015
+2015 a l 2014
+2014 a e 0
+2013 - 135 0
+2012 - 135 0
+2011 - 2010 0
+2010 a k 2009
+2009 a   2008
+2008 a = 2007
+2007 a   2006
+2006 a a 2005
+2005 a p 2004
+2004 a p 2003
+2003 a l 2002
+2002 a y 2001
+2001 a ( 0
+2000 - 1999 0
+1999 a ) 1998
+1998 a ; 1997
+1997 a   1996
+1996 a b 1995
+1995 a r 1994
+1994 a e 1993
+1993 a a 1992
+1992 a k 1991
+1991 a ; 0
+1990 - 1989 0
 1989 a r 1988
 1988 a e 1987
-1987 a f 1986
-1986 a ( 1985
-1985 a e 1984
-1984 a x 1983
-1983 a p 1982
-1982 a r 1981
-1981 a ) 1980
-1980 a ] 1979
-1979 a ; 0
-1978 - 1977 0
-1977 a i 1976
-1976 a f 1975
-1975 a   1974
-1974 a ( 1973
-1973 a s 1972
-1972 a y 1971
-1971 a m 1970
+1987 a t 0
+1986 - 1985 0
+1985 a k 1984
+1984 a   1983
+1983 a = 1982
+1982 a   1981
+1981 a a 1980
+1980 a p 1979
+1979 a p 1978
+1978 a l 1977
+1977 a y 1976
+1976 a ( 1975
+1975 a - 1974
+1974 a 1 1973
+1973 a ) 1972
+1972 a ; 1971
+1971 a   1970
 1970 a b 1969
-1969 a o 1968
-1968 a l 1967
-1967 a i 1966
-1966 a c 1965
-1965 a ( 1964
-1964 a ) 1963
-1963 a ) 1962
-1962 a   1961
-1961 a c 1960
-1960 a a 1959
-1959 a r 1958
-1958 a _ 1957
+1969 a r 1968
+1968 a e 1967
+1967 a a 1966
+1966 a k 1965
+1965 a ; 0
+1964 - 1963 0
+1963 a t 1962
+1962 a o 1961
+1961 a f 1960
+1960 a r 1959
+1959 a a 1958
+1958 a m 1957
 1957 a e 1956
-1956 a r 1955
-1955 a r 1954
-1954 a ( 1953
-1953 a ) 1952
-1952 a ; 0
-1951 - 1950 0
-1950 a r 1949
-1949 a e 1948
+1956 a ( 1955
+1955 a ) 1954
+1954 a ; 0
+1953 - 412 0
+1952 - 1951 0
+1951 a n 1950
+1950 a e 1949
+1949 a w 1948
 1948 a f 1947
-1947 a ( 1946
-1946 a e 1945
-1945 a x 1944
-1944 a p 1943
-1943 a r 1942
+1947 a r 1946
+1946 a a 1945
+1945 a m 1944
+1944 a e 1943
+1943 a ( 1942
 1942 a ) 1941
-1941 a   1940
-1940 a = 1939
-1939 a   1938
-1938 a a 1937
-1937 a t 1936
-1936 a o 1935
-1935 a m 1934
-1934 a i 1933
-1933 a c 1932
+1941 a ; 0
+1940 - 135 1939
+1939 - 1223 0
+1938 - 1937 0
+1937 a e 1936
+1936 a n 1935
+1935 a t 1934
+1934 a e 1933
+1933 a r 1932
 1932 a ( 1931
 1931 a ) 1930
-1930 a ? 1929
+1930 a ; 1929
 1929 a   1928
-1928 a t 1927
-1927 a r 1926
-1926 a u 1925
-1925 a e 1924
-1924 a : 1923
-1923 a   1922
-1922 a n 1921
-1921 a i 1920
-1920 a l 1919
-1919 a ; 0
-1918 - 1917 0
-1917 a s 1916
-1916 a e 1915
-1915 a t 1914
-1914 a q 0
-1913 - 1912 0
-1912 a p 1911
+1928 a f 1927
+1927 a c 1926
+1926 a a 1925
+1925 a l 1924
+1924 a l 1923
+1923 a ( 1922
+1922 a a 1921
+1921 a s 1920
+1920 a p 1919
+1919 a   1918
+1918 a - 1917
+1917 a   0
+1916 - 1915 0
+1915 a e 1914
+1914 a n 1913
+1913 a t 1912
+1912 a e 1911
 1911 a r 1910
-1910 a o 1909
-1909 a g 1908
-1908 a n 0
-1907 - 1906 0
-1906 a l 1905
-1905 a a 1904
-1904 a m 1903
-1903 a b 1902
-1902 a d 1901
-1901 a a 0
-1900 - 1899 0
-1899 a l 1898
-1898 a a 1897
-1897 a b 1896
-1896 a e 1895
-1895 a l 0
-1894 - 1893 0
-1893 a c 1892
-1892 a o 1891
-1891 a n 1890
-1890 a d 0
-1889 - 1888 0
-1888 a r 1887
-1887 a e 1886
-1886 a f 1885
-1885 a ( 1884
-1884 a e 1883
-1883 a x 1882
-1882 a p 1881
-1881 a r 1880
-1880 a ) 1879
-1879 a   1878
-1878 a = 1877
-1877 a   1876
-1876 a v 1875
-1875 a a 1874
-1874 a l 1873
-1873 a ( 0
-1872 - 1871 0
-1871 a r 1870
-1870 a e 1869
-1869 a f 1868
-1868 a ( 1867
-1867 a e 1866
-1866 a x 1865
-1865 a p 1864
-1864 a r 1863
-1863 a ) 1862
-1862 a   1861
-1861 a = 1860
-1860 a   0
+1910 a ( 1909
+1909 a ) 1908
+1908 a ; 1907
+1907 a   1906
+1906 a f 0
+1905 - 1904 0
+1904 a ( 1903
+1903 a a 1902
+1902 a s 1901
+1901 a p 1900
+1900 a   1899
+1899 a - 1898
+1898 a   0
+1897 - 1896 0
+1896 a ) 1895
+1895 a ; 1894
+1894 a   1893
+1893 a l 1892
+1892 a e 1891
+1891 a a 1890
+1890 a v 1889
+1889 a e 1888
+1888 a ( 1887
+1887 a ) 1886
+1886 a ; 0
+1885 - 1884 0
+1884 a f 1883
+1883 a c 1882
+1882 a a 1881
+1881 a l 1880
+1880 a l 1879
+1879 a ( 1878
+1878 a a 1877
+1877 a , 1876
+1876 a   0
+1875 - 1874 0
+1874 a ( 1873
+1873 a a 1872
+1872 a , 1871
+1871 a   0
+1870 - 1869 0
+1869 a ) 1868
+1868 a ; 1867
+1867 a   1866
+1866 a r 1865
+1865 a e 1864
+1864 a t 1863
+1863 a u 1862
+1862 a r 1861
+1861 a n 1860
+1860 a ; 0
 1859 - 1858 0
-1858 a * 1857
-1857 a l 1856
+1858 a t 1857
+1857 a a 1856
 1856 a i 1855
-1855 a m 1854
-1854 a i 1853
-1853 a t 0
-1852 - 1851 0
-1851 a r 1850
-1850 a e 1849
-1849 a f 1848
-1848 a ( 1847
-1847 a e 1846
-1846 a x 1845
-1845 a p 1844
-1844 a r 1843
-1843 a ) 1842
-1842 a   1841
-1841 a = 1840
-1840 a   1839
-1839 a 0 1838
-1838 a ; 0
+1855 a l 1854
+1854 a a 1853
+1853 a r 1852
+1852 a g 1851
+1851 a s 1850
+1850 a ( 0
+1849 - 1848 0
+1848 a a 1847
+1847 a r 1846
+1846 a g 1845
+1845 a s 1844
+1844 a ( 0
+1843 - 1842 0
+1842 a a 1841
+1841 a s 1840
+1840 a p 1839
+1839 a [ 1838
+1838 a - 0
 1837 - 1836 0
-1836 a * 1835
-1835 a p 1834
-1834 a o 1833
-1833 a o 1832
-1832 a l 0
-1831 - 1830 0
-1830 a r 1829
-1829 a e 1828
-1828 a f 1827
-1827 a ( 1826
-1826 a e 1825
-1825 a x 1824
-1824 a p 1823
-1823 a r 1822
-1822 a ) 1821
-1821 a   1820
-1820 a = 1819
-1819 a   1818
-1818 a t 1817
-1817 a r 1816
-1816 a u 1815
-1815 a e 1814
-1814 a ; 0
-1813 - 135 1812
-1812 - 1200 0
-1811 - 1810 0
-1810 a t 1809
-1809 a w 1808
-1808 a o 1807
-1807 a a 1806
-1806 a r 1805
-1805 a g 1804
-1804 a s 0
-1803 - 1802 0
-1802 a r 1801
-1801 a e 1800
-1800 a f 1799
-1799 a ( 1798
-1798 a e 1797
-1797 a x 1796
-1796 a p 1795
-1795 a r 1794
-1794 a 2 1793
-1793 a ) 1792
-1792 a   1791
-1791 a = 1790
-1790 a   1789
-1789 a p 1788
-1788 a o 1787
-1787 a p 1786
-1786 a ( 1785
-1785 a ) 1784
-1784 a ; 0
-1783 - 1782 0
-1782 a p 1781
-1781 a u 1780
-1780 a s 1779
-1779 a h 1778
-1778 a ( 1777
-1777 a ) 1776
-1776 a ; 0
-1775 - 135 0
-1774 - 1773 0
-1773 a s 1772
-1772 a e 1771
-1771 a t 1770
-1770 a t 1769
-1769 a a 1768
-1768 a g 0
-1767 - 1766 0
-1766 a t 1765
-1765 a a 1764
-1764 a g 1763
-1763 a [ 1762
-1762 a r 1761
-1761 a e 1760
-1760 a f 1759
-1759 a ( 1758
-1758 a e 1757
-1757 a x 1756
-1756 a p 1755
+1836 a ] 1835
+1835 a   1834
+1834 a = 1833
+1833 a   1832
+1832 a r 1831
+1831 a e 1830
+1830 a f 1829
+1829 a ( 1828
+1828 a e 1827
+1827 a x 1826
+1826 a p 1825
+1825 a r 1824
+1824 a ) 1823
+1823 a ; 0
+1822 - 412 1821
+1821 - 689 0
+1820 - 135 1819
+1819 - 1223 0
+1818 - 1817 0
+1817 a k 1816
+1816 a n 1815
+1815 a o 1814
+1814 a w 1813
+1813 a n 1812
+1812 a p 0
+1811 - 135 0
+1810 - 1809 0
+1809 a i 1808
+1808 a n 1807
+1807 a l 1806
+1806 a i 1805
+1805 a n 1804
+1804 a e 0
+1803 - 135 0
+1802 - 1801 0
+1801 a s 1800
+1800 a u 1799
+1799 a b 1798
+1798 a s 1797
+1797 a t 0
+1796 - 153 0
+1795 - 135 1794
+1794 - 409 0
+1793 - 1792 0
+1792 a i 1791
+1791 a n 1790
+1790 a l 1789
+1789 a i 1788
+1788 a n 1787
+1787 a e 1786
+1786 a p 0
+1785 - 412 0
+1784 - 1783 0
+1783 a i 1782
+1782 a n 1781
+1781 a l 1780
+1780 a i 1779
+1779 a n 1778
+1778 a e 1777
+1777 a s 0
+1776 - 135 0
+1775 - 1774 0
+1774 a g 1773
+1773 a o 1772
+1772 a t 1771
+1771 a o 1770
+1770 a   1769
+1769 a s 1768
+1768 a e 1767
+1767 a l 1766
+1766 a f 1765
+1765 a ; 0
+1764 - 1763 0
+1763 a ) 1762
+1762 a   1761
+1761 a = 1760
+1760 a   1759
+1759 a p 1758
+1758 a o 1757
+1757 a p 1756
+1756 a a 1755
 1755 a r 1754
-1754 a ) 1753
-1753 a ] 0
-1752 - 1751 0
-1751 a   1750
-1750 a & 1749
-1749 a = 1748
-1748 a   1747
-1747 a ~ 0
-1746 - 1745 0
-1745 a   1744
-1744 a | 1743
-1743 a = 1742
-1742 a   0
-1741 - 1740 1729
-1740 - 1739 1730
-1739 - 1738 0
-1738 a * 1737
-1737 a s 1736
-1736 a e 1735
-1735 a t 1734
-1734 a a 1733
-1733 a t 1732
-1732 a o 1731
-1731 a m 0
-1730 - 1640 0
-1729 - 1728 1717
-1728 - 1727 1718
+1754 a g 1753
+1753 a ( 1752
+1752 a ) 1751
+1751 a ; 0
+1750 - 909 0
+1749 - 1748 0
+1748 a a 1747
+1747 a s 1746
+1746 a s 1745
+1745 a i 1744
+1744 a g 1743
+1743 a n 0
+1742 - 1741 0
+1741 a p 1740
+1740 a u 1739
+1739 a s 1738
+1738 a h 1737
+1737 a a 1736
+1736 a r 1735
+1735 a g 1734
+1734 a ( 1733
+1733 a ) 1732
+1732 a ; 0
+1731 - 412 0
+1730 - 135 0
+1729 - 135 1728
+1728 - 1223 0
 1727 - 1726 0
-1726 a * 1725
-1725 a s 1724
-1724 a e 1723
-1723 a t 1722
-1722 a m 1721
-1721 a a 1720
-1720 a r 1719
-1719 a k 0
-1718 - 1622 0
-1717 - 1716 0
-1716 - 1715 1706
-1715 - 1714 0
-1714 a * 1713
-1713 a s 1712
-1712 a e 1711
-1711 a t 1710
-1710 a t 1709
-1709 a r 1708
+1726 a s 1725
+1725 a e 1724
+1724 a l 1723
+1723 a f 1722
+1722 a o 1721
+1721 a k 0
+1720 - 135 0
+1719 - 1718 0
+1718 a f 1717
+1717 a u 1716
+1716 a n 1715
+1715 a a 1714
+1714 a p 1713
+1713 a p 0
+1712 - 1711 0
+1711 a f 1710
+1710 a u 1709
+1709 a n 1708
 1708 a a 1707
-1707 a v 0
-1706 - 1604 0
-1705 - 135 0
-1704 - 1703 0
-1703 a c 1702
-1702 a h 1701
-1701 a e 1700
-1700 a c 1699
-1699 a k 1698
-1698 a t 1697
-1697 a a 1696
-1696 a g 0
-1695 - 1694 0
-1694 a r 1693
-1693 a e 1692
-1692 a f 1691
-1691 a ( 1690
-1690 a e 1689
-1689 a x 1688
-1688 a p 1687
-1687 a r 1686
-1686 a ) 1685
-1685 a   1684
-1684 a = 1683
-1683 a   1682
-1682 a ( 1681
-1681 a t 1680
-1680 a a 1679
-1679 a g 1678
-1678 a [ 1677
-1677 a r 1676
-1676 a e 1675
-1675 a f 1674
-1674 a ( 1673
-1673 a e 1672
-1672 a x 1671
-1671 a p 1670
-1670 a r 1669
-1669 a ) 1668
-1668 a ] 1667
-1667 a   1666
-1666 a & 1665
-1665 a   0
-1664 - 1663 0
+1707 a p 1706
+1706 a p 1705
+1705 a - 1704
+1704 a s 1703
+1703 a w 0
+1702 - 1701 0
+1701 a f 1700
+1700 a u 1699
+1699 a n 1698
+1698 a a 1697
+1697 a p 1696
+1696 a p 1695
+1695 a - 1694
+1694 a f 0
+1693 - 1692 0
+1692 a s 1691
+1691 a e 1690
+1690 a l 1689
+1689 a f 1688
+1688 a c 1687
+1687 a o 1686
+1686 a m 0
+1685 - 1684 0
+1684 a s 1683
+1683 a e 1682
+1682 a l 1681
+1681 a f 1680
+1680 a c 1679
+1679 a a 1678
+1678 a l 1677
+1677 a l 1676
+1676 a p 0
+1675 - 135 1674
+1674 - 1223 0
+1673 - 1672 0
+1672 a k 1671
+1671 a   1670
+1670 a = 1669
+1669 a   1668
+1668 a r 1667
+1667 a e 1666
+1666 a t 1665
+1665 a n 1664
+1664 a ( 1663
 1663 a ) 1662
-1662 a ? 1661
+1662 a ; 1661
 1661 a   1660
-1660 a t 1659
+1660 a b 1659
 1659 a r 1658
-1658 a u 1657
-1657 a e 1656
-1656 a : 1655
-1655 a   1654
-1654 a n 1653
-1653 a i 1652
-1652 a l 1651
-1651 a ; 0
-1650 - 1649 1632
-1649 - 1648 1641
-1648 - 1647 0
-1647 a * 1646
-1646 a a 1645
-1645 a t 1644
-1644 a o 1643
-1643 a m 1642
-1642 a p 0
-1641 - 1640 0
-1640 - 1639 0
-1639 a a 1638
-1638 a t 1637
-1637 a o 1636
-1636 a m 1635
-1635 a t 1634
-1634 a a 1633
-1633 a g 0
-1632 - 1631 1614
-1631 - 1630 1623
-1630 - 1629 0
-1629 a * 1628
-1628 a m 1627
-1627 a a 1626
-1626 a r 1625
-1625 a k 1624
-1624 a p 0
-1623 - 1622 0
-1622 - 1621 0
-1621 a m 1620
-1620 a a 1619
-1619 a r 1618
-1618 a k 1617
-1617 a t 1616
-1616 a a 1615
-1615 a g 0
-1614 - 1613 0
-1613 - 1612 1605
-1612 - 1611 0
-1611 a * 1610
-1610 a t 1609
-1609 a r 1608
-1608 a a 1607
-1607 a v 1606
-1606 a p 0
-1605 - 1604 0
-1604 - 1603 0
-1603 a t 1602
-1602 a r 1601
-1601 a a 1600
-1600 a v 1599
-1599 a t 1598
-1598 a a 1597
-1597 a g 0
-1596 - 135 0
-1595 - 1594 0
-1594 a l 1593
-1593 a a 1592
-1592 a b 1591
-1591 a c 1590
-1590 a o 1589
-1589 a m 0
-1588 - 1587 0
-1587 a p 1586
-1586 a o 1585
-1585 a p 1584
-1584 a ( 1583
-1583 a ) 1582
-1582 a ; 0
-1581 - 1580 0
-1580 a r 1579
-1579 a e 1578
-1578 a f 1577
-1577 a ( 1576
-1576 a e 1575
-1575 a x 1574
-1574 a p 1573
-1573 a r 1572
-1572 a ) 1571
-1571 a   1570
-1570 a = 1569
-1569 a   1568
-1568 a c 1567
-1567 a o 1566
-1566 a n 1565
-1565 a s 1564
-1564 a 3 1563
-1563 a ( 0
-1562 - 1561 0
-1561 a , 1560
-1560 a   1559
-1559 a v 1558
-1558 a a 1557
-1557 a l 1556
-1556 a ( 0
-1555 - 1554 0
-1554 a ) 1553
-1553 a , 1552
-1552 a   1551
-1551 a 0 1550
-1550 a ) 1549
-1549 a ; 0
-1548 - 1547 0
-1547 a l 1546
-1546 a a 1545
-1545 a b 1544
-1544 a c 1543
-1543 a o 1542
-1542 a m 1541
-1541 a - 1540
-1540 a t 1539
-1539 a m 1538
-1538 a p 0
+1658 a e 1657
+1657 a a 1656
+1656 a k 1655
+1655 a ; 0
+1654 - 1653 0
+1653 a u 1652
+1652 a n 1651
+1651 a b 1650
+1650 a i 1649
+1649 a n 1648
+1648 a d 1647
+1647 a ( 1646
+1646 a ) 1645
+1645 a ; 0
+1644 - 1643 0
+1643 a b 1642
+1642 a i 1641
+1641 a n 1640
+1640 a d 1639
+1639 a ( 0
+1638 - 1637 0
+1637 a l 1636
+1636 a a 1635
+1635 a b 1634
+1634 a e 1633
+1633 a l 1632
+1632 a ( 0
+1631 - 1630 0
+1630 a g 1629
+1629 a o 1628
+1628 a t 1627
+1627 a o 1626
+1626 a ( 0
+1625 - 1624 0
+1624 a s 1623
+1623 a e 1622
+1622 a l 1621
+1621 a f 1620
+1620 a l 1619
+1619 a b 1618
+1618 a l 0
+1617 - 1616 0
+1616 a s 1615
+1615 a k 1614
+1614 a i 1613
+1613 a p 0
+1612 - 135 1611
+1611 - 1532 0
+1610 - 1609 0
+1609 a f 1608
+1608 a u 1607
+1607 a n 1606
+1606 a c 1605
+1605 a o 1604
+1604 a m 1603
+1603 a - 1602
+1602 a s 1601
+1601 a w 0
+1600 - 135 1599
+1599 - 1532 0
+1598 - 1597 0
+1597 a a 1596
+1596 a s 1595
+1595 a p 1594
+1594 a   1593
+1593 a = 1592
+1592 a   1591
+1591 a a 1590
+1590 a ; 0
+1589 - 1588 0
+1588 a s 1587
+1587 a e 1586
+1586 a l 1585
+1585 a f 1584
+1584 a : 0
+1583 - 1582 0
+1582 a h 1581
+1581 a e 1580
+1580 a a 1579
+1579 a d 0
+1578 - 1577 0
+1577 a v 1576
+1576 a o 1575
+1575 a i 1574
+1574 a d 1573
+1573 a   1572
+1572 a f 0
+1571 - 1570 0
+1570 a ( 1569
+1569 a c 1568
+1568 a e 1567
+1567 a l 1566
+1566 a l 1565
+1565 a   1564
+1564 a * 1563
+1563 a a 1562
+1562 a , 1561
+1561 a   1560
+1560 a i 1559
+1559 a n 1558
+1558 a t 1557
+1557 a   1556
+1556 a n 1555
+1555 a ) 1554
+1554 a   1553
+1553 a { 0
+1552 - 1551 0
+1551 a s 1550
+1550 a e 1549
+1549 a l 1548
+1548 a f 1547
+1547 a j 1546
+1546 a m 1545
+1545 a p 0
+1544 - 1543 0
+1543 a s 1542
+1542 a e 1541
+1541 a l 1540
+1540 a f 0
+1539 - 135 1538
+1538 - 1537 1533
 1537 - 1536 0
-1536 a l 1535
-1535 a a 1534
-1534 a b 1533
-1533 a e 1532
-1532 a l 1531
-1531 a : 1530
-1530 a   1529
-1529 a e 1528
-1528 a x 1527
-1527 a p 1526
-1526 a e 1525
-1525 a c 1524
-1524 a t 1523
-1523 a e 1522
-1522 a d 1521
-1521 a   1520
-1520 a v 1519
-1519 a a 1518
-1518 a r 1517
-1517 a i 1516
-1516 a a 1515
-1515 a b 1514
-1514 a l 1513
-1513 a e 0
-1512 - 135 0
-1511 - 135 0
-1510 - 1509 0
-1509 a f 1508
-1508 a u 1507
-1507 a n 1506
-1506 a a 1505
-1505 a p 1504
-1504 a p 0
-1503 - 1502 0
-1502 a k 1501
-1501 a   1500
-1500 a = 1499
-1499 a   1498
-1498 a a 1497
-1497 a p 1496
-1496 a p 1495
-1495 a l 1494
-1494 a y 1493
-1493 a ( 0
-1492 - 1491 0
-1491 a ) 1490
-1490 a ; 1489
-1489 a   1488
-1488 a b 1487
-1487 a r 1486
-1486 a e 1485
-1485 a a 1484
-1484 a k 1483
-1483 a ; 0
+1536 a f 1535
+1535 a u 1534
+1534 a n 0
+1533 - 1532 0
+1532 - 1531 0
+1531 a n 1530
+1530 a a 1529
+1529 a m 1528
+1528 a e 0
+1527 - 1526 0
+1526 a u 1525
+1525 a n 1524
+1524 a b 1523
+1523 a i 1522
+1522 a n 1521
+1521 a d 1520
+1520 a c 1519
+1519 a o 1518
+1518 a m 0
+1517 - 1516 0
+1516 a u 1515
+1515 a n 1514
+1514 a b 1513
+1513 a i 1512
+1512 a n 1511
+1511 a d 1510
+1510 a a 1509
+1509 a r 1508
+1508 a g 1507
+1507 a ( 0
+1506 - 909 1505
+1505 - 689 0
+1504 - 1503 0
+1503 a u 1502
+1502 a n 1501
+1501 a b 1500
+1500 a i 1499
+1499 a n 1498
+1498 a d 1497
+1497 a a 1496
+1496 a r 1495
+1495 a g 1494
+1494 a ( 1493
+1493 a 0 1492
+1492 a , 1491
+1491 a   0
+1490 - 1489 0
+1489 a b 1488
+1488 a i 1487
+1487 a n 1486
+1486 a d 1485
+1485 a c 1484
+1484 a o 1483
+1483 a m 0
 1482 - 1481 0
-1481 a r 1480
-1480 a e 1479
-1479 a t 0
-1478 - 1477 0
-1477 a k 1476
-1476 a   1475
-1475 a = 1474
-1474 a   1473
-1473 a a 1472
-1472 a p 1471
-1471 a p 1470
-1470 a l 1469
-1469 a y 1468
-1468 a ( 1467
-1467 a - 1466
-1466 a 1 1465
-1465 a ) 1464
-1464 a ; 1463
-1463 a   1462
-1462 a b 1461
-1461 a r 1460
-1460 a e 1459
-1459 a a 1458
-1458 a k 1457
-1457 a ; 0
-1456 - 1455 0
-1455 a t 1454
-1454 a o 1453
-1453 a f 1452
-1452 a r 1451
-1451 a a 1450
-1450 a m 1449
-1449 a e 1448
-1448 a ( 1447
-1447 a ) 1446
-1446 a ; 0
-1445 - 333 0
-1444 - 1443 0
-1443 a n 1442
-1442 a e 1441
-1441 a w 1440
-1440 a f 1439
-1439 a r 1438
-1438 a a 1437
-1437 a m 1436
-1436 a e 1435
-1435 a ( 1434
-1434 a ) 1433
-1433 a ; 0
-1432 - 135 1431
-1431 - 1200 0
-1430 - 1429 0
-1429 a f 1428
-1428 a u 1427
+1481 a b 1480
+1480 a i 1479
+1479 a n 1478
+1478 a d 1477
+1477 a a 1476
+1476 a r 1475
+1475 a g 1474
+1474 a ( 0
+1473 - 1472 0
+1472 a , 1471
+1471 a   0
+1470 - 909 1469
+1469 - 689 0
+1468 - 1467 0
+1467 a a 1466
+1466 a r 1465
+1465 a g 1464
+1464 a n 1463
+1463 a ( 1462
+1462 a n 1461
+1461 a , 1460
+1460 a   0
+1459 - 1458 0
+1458 a b 1457
+1457 a i 1456
+1456 a n 1455
+1455 a d 1454
+1454 a a 1453
+1453 a r 1452
+1452 a g 1451
+1451 a ( 1450
+1450 a 0 1449
+1449 a , 1448
+1448 a   0
+1447 - 1446 0
+1446 a r 1445
+1445 a e 1444
+1444 a s 1443
+1443 a t 1442
+1442 a a 1441
+1441 a r 1440
+1440 a g 1439
+1439 a s 1438
+1438 a ( 1437
+1437 a a 1436
+1436 a , 1435
+1435 a   1434
+1434 a n 1433
+1433 a ) 1432
+1432 a ; 0
+1431 - 1430 0
+1430 a a 1429
+1429 a r 1428
+1428 a g 1427
 1427 a n 1426
-1426 a c 1425
-1425 a o 1424
-1424 a m 0
-1423 - 1422 0
-1422 a r 1421
-1421 a e 1420
-1420 a f 1419
-1419 a ( 1418
-1418 a e 1417
-1417 a x 1416
-1416 a p 1415
-1415 a r 1414
-1414 a ) 1413
-1413 a   1412
-1412 a = 1411
-1411 a   1410
-1410 a m 1409
-1409 a k 1408
-1408 a f 1407
-1407 a u 1406
-1406 a n 1405
-1405 a ( 0
-1404 - 1403 0
-1403 a k 1402
+1426 a ( 1425
+1425 a n 1424
+1424 a , 1423
+1423 a   1422
+1422 a 0 1421
+1421 a ) 1420
+1420 a ; 0
+1419 - 1418 0
+1418 a s 1417
+1417 a e 1416
+1416 a t 1415
+1415 a q 1414
+1414 a c 1413
+1413 a o 1412
+1412 a m 0
+1411 - 1410 0
+1410 a v 1409
+1409 a a 1408
+1408 a l 1407
+1407 a ( 0
+1406 - 1405 0
+1405 a ) 1404
+1404 a   1403
+1403 a = 1402
 1402 a   1401
-1401 a = 1400
-1400 a   1399
-1399 a r 1398
-1398 a e 1397
-1397 a t 1396
-1396 a n 1395
-1395 a ( 1394
-1394 a ) 1393
-1393 a ; 1392
-1392 a   1391
-1391 a b 1390
-1390 a r 1389
-1389 a e 1388
-1388 a a 1387
-1387 a k 1386
-1386 a ; 0
-1385 - 1384 0
-1384 a u 1383
-1383 a n 1382
-1382 a b 1381
-1381 a i 1380
-1380 a n 1379
-1379 a d 1378
-1378 a ( 1377
-1377 a ) 1376
-1376 a ; 0
+1401 a r 1400
+1400 a e 1399
+1399 a f 1398
+1398 a ( 1397
+1397 a e 1396
+1396 a x 1395
+1395 a p 1394
+1394 a r 1393
+1393 a ) 1392
+1392 a ; 0
+1391 - 1390 0
+1390 a f 1389
+1389 a u 1388
+1388 a n 1387
+1387 a c 1386
+1386 a o 1385
+1385 a m 0
+1384 - 1383 0
+1383 a s 1382
+1382 a e 1381
+1381 a l 1380
+1380 a f 1379
+1379 a n 1378
+1378 a a 1377
+1377 a m 1376
+1376 a e 0
 1375 - 1374 0
-1374 a b 1373
-1373 a i 1372
-1372 a n 1371
-1371 a d 1370
-1370 a ( 0
-1369 - 1368 0
-1368 a l 1367
-1367 a a 1366
-1366 a b 1365
+1374 a l 1373
+1373 a a 1372
+1372 a m 1371
+1371 a b 1370
+1370 a d 1369
+1369 a a 1368
+1368 a p 0
+1367 - 1366 0
+1366 a r 1365
 1365 a e 1364
-1364 a l 1363
-1363 a ( 0
-1362 - 1361 0
-1361 a g 1360
-1360 a o 1359
-1359 a t 1358
-1358 a o 1357
-1357 a ( 0
-1356 - 1355 0
-1355 a ) 1354
-1354 a ; 0
-1353 - 1352 0
+1364 a f 1363
+1363 a ( 1362
+1362 a e 1361
+1361 a x 1360
+1360 a p 1359
+1359 a r 1358
+1358 a ) 1357
+1357 a   1356
+1356 a = 1355
+1355 a   1354
+1354 a m 1353
+1353 a k 1352
 1352 a f 1351
 1351 a u 1350
-1350 a n 0
-1349 - 1348 0
-1348 a s 1347
-1347 a k 1346
-1346 a i 1345
-1345 a p 0
-1344 - 135 0
-1343 - 1342 0
-1342 a s 1341
-1341 a e 1340
-1340 a t 1339
-1339 a q 1338
-1338 a c 1337
-1337 a o 1336
-1336 a m 0
-1335 - 1334 0
-1334 a v 1333
-1333 a a 1332
-1332 a l 1331
-1331 a ( 0
-1330 - 1329 0
-1329 a ) 1328
-1328 a   1327
-1327 a = 1326
-1326 a   1325
-1325 a r 1324
-1324 a e 1323
-1323 a f 1322
-1322 a ( 1321
-1321 a e 1320
-1320 a x 1319
-1319 a p 1318
-1318 a r 1317
-1317 a ) 1316
-1316 a ; 0
-1315 - 1314 0
-1314 a s 1313
-1313 a e 1312
-1312 a t 1311
-1311 a q 1310
-1310 a : 1309
-1309 a   1308
-1308 a e 1307
-1307 a x 1306
-1306 a p 1305
-1305 a e 1304
-1304 a c 1303
-1303 a t 1302
-1302 a e 1301
-1301 a d 1300
-1300 a   1299
-1299 a v 1298
-1298 a a 1297
-1297 a r 1296
-1296 a i 1295
-1295 a a 1294
-1294 a b 1293
-1293 a l 1292
-1292 a e 0
-1291 - 135 0
-1290 - 1289 0
-1289 a v 1288
-1288 a a 1287
-1287 a r 1286
-1286 a s 1285
-1285 a y 1284
-1284 a m 1283
-1283 a p 0
-1282 - 135 0
-1281 - 1280 0
-1280 a } 0
-1279 - 1278 0
-1278 a c 1277
-1277 a o 1276
-1276 a n 1275
-1275 a d 1274
-1274 a c 1273
-1273 a o 1272
-1272 a m 0
-1271 - 1270 0
-1270 a } 1269
-1269 a   1268
-1268 a e 1267
-1267 a l 1266
-1266 a s 1265
-1265 a e 1264
-1264 a   1263
-1263 a { 0
-1262 - 1261 0
-1261 a i 1260
-1260 a f 1259
-1259 a   1258
-1258 a ( 1257
-1257 a r 1256
+1350 a n 1349
+1349 a ( 0
+1348 - 1347 0
+1347 a f 1346
+1346 a u 1345
+1345 a n 1344
+1344 a d 1343
+1343 a e 1342
+1342 a f 0
+1341 - 1340 0
+1340 a ) 1339
+1339 a ; 0
+1338 - 1337 0
+1337 a s 1336
+1336 a e 1335
+1335 a t 1334
+1334 a q 1333
+1333 a : 1332
+1332 a   1331
+1331 a e 1330
+1330 a x 1329
+1329 a p 1328
+1328 a e 1327
+1327 a c 1326
+1326 a t 1325
+1325 a e 1324
+1324 a d 1323
+1323 a   1322
+1322 a v 1321
+1321 a a 1320
+1320 a r 1319
+1319 a i 1318
+1318 a a 1317
+1317 a b 1316
+1316 a l 1315
+1315 a e 0
+1314 - 135 0
+1313 - 1312 0
+1312 a v 1311
+1311 a a 1310
+1310 a r 1309
+1309 a s 1308
+1308 a y 1307
+1307 a m 1306
+1306 a p 0
+1305 - 135 0
+1304 - 1303 0
+1303 a } 0
+1302 - 1301 0
+1301 a c 1300
+1300 a o 1299
+1299 a n 1298
+1298 a d 1297
+1297 a c 1296
+1296 a o 1295
+1295 a m 0
+1294 - 1293 0
+1293 a } 1292
+1292 a   1291
+1291 a e 1290
+1290 a l 1289
+1289 a s 1288
+1288 a e 1287
+1287 a   1286
+1286 a { 0
+1285 - 1284 0
+1284 a i 1283
+1283 a f 1282
+1282 a   1281
+1281 a ( 1280
+1280 a r 1279
+1279 a e 1278
+1278 a f 1277
+1277 a ( 1276
+1276 a e 1275
+1275 a x 1274
+1274 a p 1273
+1273 a r 1272
+1272 a ) 1271
+1271 a   1270
+1270 a ! 1269
+1269 a = 1268
+1268 a   1267
+1267 a n 1266
+1266 a i 1265
+1265 a l 1264
+1264 a ) 1263
+1263 a   1262
+1262 a { 0
+1261 - 1260 0
+1260 a r 1259
+1259 a e 1258
+1258 a f 1257
+1257 a ( 1256
 1256 a e 1255
-1255 a f 1254
-1254 a ( 1253
-1253 a e 1252
-1252 a x 1251
-1251 a p 1250
-1250 a r 1249
-1249 a ) 1248
-1248 a   1247
-1247 a ! 1246
-1246 a = 1245
-1245 a   1244
-1244 a n 1243
-1243 a i 1242
-1242 a l 1241
-1241 a ) 1240
-1240 a   1239
-1239 a { 0
-1238 - 1237 0
-1237 a r 1236
-1236 a e 1235
-1235 a f 1234
-1234 a ( 1233
-1233 a e 1232
-1232 a x 1231
-1231 a p 1230
-1230 a r 1229
-1229 a ) 1228
-1228 a   1227
-1227 a = 1226
-1226 a   1225
-1225 a n 1224
-1224 a i 1223
-1223 a l 1222
-1222 a ; 0
-1221 - 135 1220
-1220 - 1200 0
-1219 - 1218 0
-1218 a b 1217
-1217 a l 1216
-1216 a o 1215
-1215 a c 1214
-1214 a k 1213
-1213 a c 1212
-1212 a o 1211
-1211 a m 0
-1210 - 1209 0
-1209 a e 1208
-1208 a x 1207
-1207 a p 1206
-1206 a r 1205
-1205 a c 1204
-1204 a o 1203
-1203 a m 0
-1202 - 135 1201
+1255 a x 1254
+1254 a p 1253
+1253 a r 1252
+1252 a ) 1251
+1251 a   1250
+1250 a = 1249
+1249 a   1248
+1248 a n 1247
+1247 a i 1246
+1246 a l 1245
+1245 a ; 0
+1244 - 135 1243
+1243 - 1223 0
+1242 - 1241 0
+1241 a b 1240
+1240 a l 1239
+1239 a o 1238
+1238 a c 1237
+1237 a k 1236
+1236 a c 1235
+1235 a o 1234
+1234 a m 0
+1233 - 1232 0
+1232 a e 1231
+1231 a x 1230
+1230 a p 1229
+1229 a r 1228
+1228 a c 1227
+1227 a o 1226
+1226 a m 0
+1225 - 135 1224
+1224 - 1223 0
+1223 - 1222 0
+1222 a t 1221
+1221 a a 0
+1220 - 1219 0
+1219 a c 1218
+1218 a o 1217
+1217 a n 1216
+1216 a s 1215
+1215 a t 1214
+1214 a a 1213
+1213 a n 1212
+1212 a t 0
+1211 - 1210 0
+1210 a n 1209
+1209 a o 0
+1208 - 135 0
+1207 - 1206 0
+1206 a p 1205
+1205 a u 1204
+1204 a r 1203
+1203 a e 1202
+1202 a p 0
 1201 - 1200 0
-1200 - 1199 0
-1199 a t 1198
-1198 a a 0
-1197 - 1196 0
-1196 a e 1195
-1195 a m 1194
-1194 a i 1193
-1193 a t 0
-1192 - 135 0
-1191 - 1190 0
-1190 a a 1189
-1189 a d 1188
-1188 a d 1187
-1187 a - 1186
-1186 a o 1185
-1185 a b 1184
-1184 a j 1183
-1183 a e 1182
-1182 a c 1181
-1181 a t 0
-1180 - 135 0
-1179 - 1178 0
-1178 a m 1177
-1177 a a 1176
-1176 a k 1175
-1175 a e 1174
-1174 a - 1173
-1173 a o 1172
-1172 a b 1171
-1171 a j 1170
-1170 a e 1169
-1169 a c 1168
-1168 a t 0
-1167 - 135 0
-1166 - 1165 0
-1165 a a 1164
-1164 a d 1163
-1163 a d 1162
-1162 a - 1161
-1161 a a 1160
-1160 a t 1159
-1159 a o 1158
-1158 a m 0
-1157 - 135 0
-1156 - 135 0
-1155 - 1154 0
-1154 a m 1153
-1153 a a 1152
-1152 a k 1151
-1151 a e 1150
-1150 a - 1149
-1149 a a 1148
-1148 a t 1147
-1147 a o 1146
-1146 a m 0
-1145 - 135 1144
-1144 - 802 0
-1143 - 135 0
-1142 - 1141 0
-1141 a m 1140
-1140 a a 1139
-1139 a k 1138
-1138 a e 1137
-1137 a - 1136
-1136 a c 1135
-1135 a e 1134
-1134 a l 1133
-1133 a l 0
-1132 - 333 1131
-1131 - 828 1130
-1130 - 1129 0
-1129 - 1128 0
-1128 a t 1127
-1127 a g 0
-1126 - 1125 0
-1125 a m 1124
-1124 a a 1123
-1123 a k 1122
-1122 a e 1121
-1121 a - 1120
-1120 a l 1119
-1119 a a 1118
-1118 a b 1117
-1117 a e 1116
-1116 a l 0
-1115 - 1114 0
-1114 a l 1113
-1113 a b 1112
-1112 a l 0
-1111 - 773 0
-1110 - 1109 0
-1109 a o 1108
-1108 a b 1107
-1107 a l 1106
-1106 a i 1105
-1105 a s 1104
-1104 a t 0
-1103 - 1102 0
-1102 a s 1101
-1101 a y 1100
-1100 a m 1099
-1099 a l 1098
-1098 a i 1097
-1097 a s 0
-1096 - 1 1095
-1095 - 770 0
-1094 - 1093 0
-1093 a c 1092
-1092 a e 1091
-1091 a l 1090
-1090 a l 1089
-1089 a s 0
-1088 - 1087 0
-1087 a n 1086
-1086 a u 1085
-1085 a m 1084
-1084 a b 1083
-1083 a e 1082
-1082 a r 0
-1081 - 1080 0
-1080 a i 1079
-1079 a n 1078
-1078 a c 1077
-1077 a r 0
-1076 - 1075 0
-1075 a i 1074
-1074 a n 1073
-1073 a c 1072
-1072 a r 1071
-1071 a - 1070
-1070 a t 1069
-1069 a m 1068
-1068 a p 0
-1067 - 135 1066
-1066 - 521 1065
-1065 - 153 0
-1064 - 135 0
-1063 - 1062 0
-1062 a s 1061
-1061 a u 1060
-1060 a c 1059
-1059 a c 0
-1058 - 1057 1055
-1057 - 773 1056
-1056 - 770 0
-1055 - 1054 1052
-1054 - 770 1053
-1053 - 767 0
-1052 - 1051 1049
-1051 - 767 1050
-1050 - 764 0
-1049 - 1048 1046
-1048 - 764 1047
-1047 - 761 0
-1046 - 1045 1043
-1045 - 761 1044
-1044 - 758 0
-1043 - 1042 1040
-1042 - 758 1041
-1041 - 755 0
-1040 - 1039 1037
-1039 - 755 1038
-1038 - 752 0
-1037 - 1036 1034
-1036 - 752 1035
-1035 - 749 0
-1034 - 1033 1031
-1033 - 749 1032
-1032 - 746 0
-1031 - 1030 0
-1030 - 746 1029
-1029 - 773 0
-1028 - 135 0
-1027 - 1026 0
-1026 a a 1025
-1025 a d 1024
-1024 a d 1023
-1023 a r 0
-1022 - 746 1021
-1021 - 746 0
-1020 - 1019 0
-1019 a t 1018
-1018 a - 1017
-1017 a a 1016
-1016 a d 1015
-1015 a d 1014
-1014 a r 0
-1013 - 770 0
-1012 - 1011 0
-1011 a n 1010
-1010 a i 1009
-1009 a l 1008
-1008 a - 1007
-1007 a a 1006
-1006 a d 1005
-1005 a d 1004
-1004 a r 0
-1003 - 773 0
-1002 - 1001 0
-1001 a l 1000
-1000 a i 999
-999 a m 998
-998 a i 997
-997 a t 0
-996 - 755 995
-995 - 758 994
-994 - 758 993
-993 - 764 992
-992 - 758 0
-991 - 990 0
-990 a r 989
-989 a e 988
-988 a a 987
-987 a d 0
+1200 a l 1199
+1199 a a 1198
+1198 a m 1197
+1197 a b 1196
+1196 a d 1195
+1195 a a 0
+1194 - 1193 0
+1193 a q 1192
+1192 a u 1191
+1191 a o 1190
+1190 a t 1189
+1189 a e 0
+1188 - 135 0
+1187 - 1186 0
+1186 a l 1185
+1185 a e 1184
+1184 a n 1183
+1183 a g 1182
+1182 a t 1181
+1181 a h 0
+1180 - 135 1179
+1179 - 639 0
+1178 - 135 0
+1177 - 1176 0
+1176 a f 1175
+1175 a l 1174
+1174 a u 1173
+1173 a s 1172
+1172 a h 0
+1171 - 135 0
+1170 - 1169 0
+1169 a e 1168
+1168 a m 1167
+1167 a i 1166
+1166 a t 0
+1165 - 1164 0
+1164 a e 1163
+1163 a m 1162
+1162 a i 1161
+1161 a t 1160
+1160 a - 1159
+1159 a l 1158
+1158 a i 1157
+1157 a n 1156
+1156 a e 0
+1155 - 135 0
+1154 - 135 0
+1153 - 1152 0
+1152 a a 1151
+1151 a d 1150
+1150 a d 1149
+1149 a - 1148
+1148 a o 1147
+1147 a b 1146
+1146 a j 1145
+1145 a e 1144
+1144 a c 1143
+1143 a t 0
+1142 - 135 0
+1141 - 1140 0
+1140 a m 1139
+1139 a a 1138
+1138 a k 1137
+1137 a e 1136
+1136 a - 1135
+1135 a o 1134
+1134 a b 1133
+1133 a j 1132
+1132 a e 1131
+1131 a c 1130
+1130 a t 0
+1129 - 135 0
+1128 - 1127 0
+1127 a a 1126
+1126 a d 1125
+1125 a d 1124
+1124 a - 1123
+1123 a n 1122
+1122 a u 1121
+1121 a m 1120
+1120 a b 1119
+1119 a e 1118
+1118 a r 0
+1117 - 1116 0
+1116 a n 1115
+1115 a u 1114
+1114 a m 0
+1113 - 135 0
+1112 - 1111 0
+1111 a n 1110
+1110 a u 1109
+1109 a m 1108
+1108 a e 1107
+1107 a r 1106
+1106 a a 1105
+1105 a l 1104
+1104 a p 0
+1103 - 135 0
+1102 - 135 0
+1101 - 1100 0
+1100 a d 1099
+1099 a i 1098
+1098 a g 1097
+1097 a i 1096
+1096 a t 1095
+1095 a p 0
+1094 - 135 0
+1093 - 1092 0
+1092 a a 1091
+1091 a d 1090
+1090 a d 1089
+1089 a - 1088
+1088 a a 1087
+1087 a t 1086
+1086 a o 1085
+1085 a m 0
+1084 - 135 0
+1083 - 135 0
+1082 - 1081 0
+1081 a m 1080
+1080 a a 1079
+1079 a k 1078
+1078 a e 1077
+1077 a - 1076
+1076 a a 1075
+1075 a t 1074
+1074 a o 1073
+1073 a m 0
+1072 - 135 1071
+1071 - 909 0
+1070 - 135 0
+1069 - 1068 0
+1068 a m 1067
+1067 a a 1066
+1066 a k 1065
+1065 a e 1064
+1064 a - 1063
+1063 a c 1062
+1062 a e 1061
+1061 a l 1060
+1060 a l 0
+1059 - 412 1058
+1058 - 935 1057
+1057 - 1056 0
+1056 - 1055 0
+1055 a t 1054
+1054 a g 0
+1053 - 1052 0
+1052 a m 1051
+1051 a a 1050
+1050 a k 1049
+1049 a e 1048
+1048 a - 1047
+1047 a l 1046
+1046 a a 1045
+1045 a b 1044
+1044 a e 1043
+1043 a l 0
+1042 - 1041 0
+1041 a p 1040
+1040 a a 1039
+1039 a r 1038
+1038 a a 1037
+1037 a m 1036
+1036 a s 0
+1035 - 1034 0
+1034 a k 1033
+1033 a n 1032
+1032 a o 1031
+1031 a w 1030
+1030 a n 0
+1029 - 1028 0
+1028 a o 1027
+1027 a u 1026
+1026 a t 0
+1025 - 1024 0
+1024 a f 1023
+1023 a u 1022
+1022 a n 1021
+1021 a m 1020
+1020 a o 1019
+1019 a d 1018
+1018 a e 0
+1017 - 1016 0
+1016 a l 1015
+1015 a b 1014
+1014 a l 0
+1013 - 1012 0
+1012 a o 1011
+1011 a b 1010
+1010 a l 1009
+1009 a i 1008
+1008 a s 1007
+1007 a t 0
+1006 - 1005 0
+1005 a n 1004
+1004 a u 1003
+1003 a m 1002
+1002 a l 1001
+1001 a i 1000
+1000 a s 0
+999 - 998 0
+998 a s 997
+997 a y 996
+996 a m 995
+995 a l 994
+994 a i 993
+993 a s 0
+992 - 991 0
+991 a c 990
+990 a e 989
+989 a l 988
+988 a l 987
+987 a s 0
 986 - 985 0
-985 a f 984
-984 a u 983
-983 a n 982
-982 a n 981
-981 a y 980
-980 a   979
-979 a c 978
-978 a h 977
+985 a a 984
+984 a d 983
+983 a d 982
+982 a r 0
+981 n 99 0
+980 - 979 0
+979 a t 978
+978 a - 977
 977 a a 976
-976 a r 975
-975 a a 974
-974 a c 973
-973 a t 972
-972 a e 971
-971 a r 0
-970 - 969 0
-969 a ; 0
-968 - 967 0
-967 a ' 0
-966 - 521 0
-965 - 964 0
-964 a * 963
-963 a r 962
-962 a e 961
-961 a a 960
-960 a d 959
-959 a - 958
-958 a t 957
-957 a m 956
-956 a p 0
-955 - 954 0
-954 a r 953
-953 a d 952
-952 a - 951
-951 a o 950
-950 a b 949
-949 a j 0
+976 a d 975
+975 a d 974
+974 a r 0
+973 - 972 0
+972 a n 971
+971 a i 970
+970 a l 969
+969 a - 968
+968 a a 967
+967 a d 966
+966 a d 965
+965 a r 0
+964 n 0 0
+963 - 962 0
+962 a r 961
+961 a e 960
+960 a a 959
+959 a d 0
+958 - 957 0
+957 a s 956
+956 a y 955
+955 a m 954
+954 a b 953
+953 a o 952
+952 a l 951
+951 a i 950
+950 a c 0
+949 - 600 0
 948 - 947 0
-947 a u 946
-946 a n 945
-945 a t 944
-944 a e 943
-943 a r 942
-942 a m 941
-941 a i 940
-940 a n 939
-939 a a 938
-938 a t 937
-937 a e 936
-936 a d 935
-935 a   934
-934 a l 933
-933 a i 932
-932 a s 931
-931 a t 0
-930 - 521 929
-929 - 333 0
+947 a * 946
+946 a s 945
+945 a y 944
+944 a m 943
+943 a b 942
+942 a o 941
+941 a l 940
+940 a s 0
+939 - 412 938
+938 - 409 937
+937 - 600 936
+936 - 935 933
+935 - 934 0
+934 a d 0
+933 - 932 930
+932 - 931 0
+931 a e 0
+930 - 760 929
+929 - 928 926
 928 - 927 0
-927 a r 926
-926 a d 925
-925 a - 924
-924 a l 923
-923 a i 922
-922 a s 921
-921 a t 0
-920 - 919 0
-919 a \ 0
+927 a g 0
+926 - 925 923
+925 - 924 0
+924 a h 0
+923 - 689 922
+922 - 921 919
+921 - 920 0
+920 a j 0
+919 - 918 916
 918 - 917 0
-917 a q 916
-916 a u 915
-915 a o 914
-914 a t 913
-913 a e 0
+917 a k 0
+916 - 691 915
+915 - 756 914
+914 - 639 913
+913 - 912 910
 912 - 911 0
-911 a " 0
-910 - 909 0
-909 a u 908
-908 a n 907
-907 a t 906
-906 a e 905
-905 a r 904
-904 a m 903
-903 a i 902
-902 a n 901
-901 a a 900
-900 a t 899
-899 a e 898
-898 a d 897
-897 a   896
-896 a s 895
-895 a t 894
-894 a r 893
-893 a i 892
-892 a n 891
-891 a g 0
-890 - 521 889
-889 - 333 0
-888 - 887 0
-887 a r 886
-886 a d 885
-885 a - 884
-884 a p 883
-883 a s 882
-882 a t 881
-881 a r 0
-880 - 574 879
-879 - 572 878
-878 - 570 0
-877 - 521 876
-876 - 333 0
-875 - 874 0
-874 a r 873
-873 a d 872
-872 a - 871
-871 a a 870
-870 a t 869
-869 a o 868
-868 a m 0
-867 - 521 0
-866 - 865 0
-865 a r 864
-864 a d 863
-863 a - 862
-862 a c 861
-861 a o 860
-860 a m 859
-859 a m 0
-858 - 521 0
-857 - 856 0
-856 a s 855
-855 a k 854
-854 a i 853
-853 a p 852
-852 a c 0
-851 - 850 0
-850 a s 849
-849 a y 848
-848 a m 847
-847 a b 846
-846 a o 845
-845 a l 844
-844 a i 843
-843 a c 0
-842 - 521 0
-841 - 840 0
-840 a * 839
-839 a s 838
-838 a y 837
-837 a m 836
-836 a b 835
-835 a o 834
-834 a l 833
-833 a s 0
-832 - 333 831
-831 - 330 830
-830 - 521 829
-829 - 828 826
-828 - 827 0
-827 a d 0
-826 - 825 823
-825 - 824 0
-824 a e 0
-823 - 643 822
-822 - 821 819
-821 - 820 0
-820 a g 0
-819 - 818 816
-818 - 817 0
-817 a h 0
-816 - 572 815
-815 - 814 812
+911 a o 0
+910 - 909 907
+909 - 908 0
+908 a p 0
+907 - 906 904
+906 - 905 0
+905 a q 0
+904 - 543 903
+903 - 902 900
+902 - 901 0
+901 a s 0
+900 - 1 899
+899 - 898 896
+898 - 897 0
+897 a u 0
+896 - 762 895
+895 - 894 892
+894 - 893 0
+893 a w 0
+892 - 135 891
+891 - 153 890
+890 - 889 887
+889 - 888 0
+888 a z 0
+887 - 886 884
+886 - 885 0
+885 a * 0
+884 - 883 881
+883 - 882 0
+882 a - 0
+881 - 644 880
+880 - 647 879
+879 - 650 878
+878 - 653 877
+877 - 656 876
+876 - 659 875
+875 - 662 874
+874 - 665 873
+873 - 668 872
+872 - 670 0
+871 - 870 0
+870 a * 869
+869 a d 868
+868 a i 867
+867 a g 866
+866 a i 865
+865 a t 864
+864 a s 0
+863 - 644 862
+862 - 647 861
+861 - 650 860
+860 - 653 859
+859 - 656 858
+858 - 659 857
+857 - 662 856
+856 - 665 855
+855 - 668 854
+854 - 670 0
+853 - 852 0
+852 a e 851
+851 a x 850
+850 a p 849
+849 a l 848
+848 a o 847
+847 a d 846
+846 a e 0
+845 - 844 0
+844 a e 843
+843 a x 842
+842 a p 841
+841 a l 840
+840 a o 839
+839 a d 838
+838 a e 837
+837 a : 836
+836 a   835
+835 a e 834
+834 a x 833
+833 a p 832
+832 a e 831
+831 a c 830
+830 a t 829
+829 a e 828
+828 a d 827
+827 a   826
+826 a a 825
+825 a t 824
+824 a o 823
+823 a m 0
+822 - 639 821
+821 - 412 0
+820 - 819 0
+819 a e 818
+818 a x 817
+817 a p 816
+816 a l 0
+815 - 135 0
 814 - 813 0
-813 a j 0
-812 - 811 809
-811 - 810 0
-810 a k 0
-809 - 574 808
-808 - 639 807
-807 - 570 806
-806 - 805 803
-805 - 804 0
-804 a o 0
-803 - 802 800
-802 - 801 0
-801 a p 0
-800 - 799 797
-799 - 798 0
-798 a q 0
-797 - 464 796
-796 - 795 793
-795 - 794 0
-794 a s 0
-793 - 1 792
-792 - 791 789
-791 - 790 0
-790 a u 0
-789 - 645 788
-788 - 787 785
+813 a m 812
+812 a k 811
+811 a a 810
+810 a t 809
+809 a o 808
+808 a m 0
+807 - 639 0
+806 - 805 0
+805 a i 804
+804 a m 803
+803 a p 802
+802 a l 801
+801 a o 800
+800 a d 799
+799 a e 0
+798 - 135 0
+797 - 796 0
+796 a m 795
+795 a a 794
+794 a k 793
+793 a e 792
+792 a s 791
+791 a y 790
+790 a m 0
+789 - 639 788
+788 - 412 0
 787 - 786 0
-786 a w 0
-785 - 135 784
-784 - 153 783
-783 - 782 780
-782 - 781 0
-781 a z 0
-780 - 779 777
-779 - 778 0
-778 a * 0
-777 - 776 774
-776 - 775 0
-775 a - 0
-774 - 773 771
-773 - 772 0
-772 a 0 0
-771 - 770 768
-770 - 769 0
-769 a 1 0
-768 - 767 765
-767 - 766 0
-766 a 2 0
-765 - 764 762
-764 - 763 0
-763 a 3 0
-762 - 761 759
-761 - 760 0
-760 a 4 0
-759 - 758 756
-758 - 757 0
-757 a 5 0
-756 - 755 753
-755 - 754 0
-754 a 6 0
-753 - 752 750
-752 - 751 0
-751 a 7 0
-750 - 749 747
-749 - 748 0
-748 a 8 0
+786 a i 785
+785 a m 784
+784 a p 783
+783 a l 0
+782 - 639 0
+781 - 780 0
+780 a r 779
+779 a e 778
+778 a a 777
+777 a d 776
+776 a c 0
+775 - 774 0
+774 a p 773
+773 a e 772
+772 a e 771
+771 a k 770
+770 a c 0
+769 - 768 0
+768 a i 767
+767 a n 766
+766 a t 765
+765 a e 764
+764 a r 763
+763 a n 0
+762 - 761 0
+761 a v 0
+760 - 759 0
+759 a f 0
+758 - 135 757
+757 - 756 754
+756 - 755 0
+755 a m 0
+754 - 412 0
+753 - 752 0
+752 a f 751
+751 a i 750
+750 a n 749
+749 a d 0
+748 - 135 0
 747 - 746 0
-746 - 745 0
-745 a 9 0
-744 - 743 0
-743 a e 742
-742 a x 741
-741 a p 740
-740 a l 739
-739 a o 738
-738 a d 737
-737 a e 0
-736 - 735 0
-735 a e 734
-734 a x 733
-733 a p 732
-732 a l 731
-731 a o 730
-730 a d 729
-729 a e 728
-728 a : 727
-727 a   726
-726 a e 725
-725 a x 724
-724 a p 723
+746 a f 745
+745 a i 744
+744 a r 743
+743 a s 742
+742 a t 0
+741 - 135 0
+740 - 739 0
+739 a m 738
+738 a k 737
+737 a n 736
+736 a a 735
+735 a m 734
+734 a e 0
+733 - 600 732
+732 - 412 0
+731 - 730 0
+730 a s 729
+729 a a 728
+728 a m 727
+727 a e 726
+726 a n 725
+725 a a 724
+724 a m 723
 723 a e 722
-722 a c 721
-721 a t 720
-720 a e 719
-719 a d 718
-718 a   717
-717 a a 716
-716 a t 715
-715 a o 714
-714 a m 0
-713 - 570 712
-712 - 333 0
-711 - 710 0
-710 a e 709
-709 a x 708
-708 a p 707
-707 a l 0
-706 - 135 0
-705 - 704 0
-704 a m 703
-703 a k 702
-702 a a 701
-701 a t 700
-700 a o 699
-699 a m 0
-698 - 570 0
-697 - 696 0
-696 a i 695
-695 a m 694
-694 a p 693
-693 a l 692
-692 a o 691
-691 a d 690
-690 a e 0
-689 - 135 0
-688 - 687 0
-687 a m 686
-686 a a 685
-685 a k 684
-684 a e 683
-683 a s 682
-682 a y 681
-681 a m 0
-680 - 570 679
-679 - 333 0
-678 - 677 0
-677 a i 676
-676 a m 675
-675 a p 674
-674 a l 0
-673 - 570 0
-672 - 671 0
-671 a r 670
-670 a e 669
-669 a a 668
-668 a d 667
-667 a c 0
-666 - 665 0
-665 a p 664
-664 a e 663
-663 a e 662
-662 a k 661
-661 a c 0
-660 - 659 0
-659 a * 658
-658 a p 657
-657 a e 656
-656 a e 655
-655 a k 654
-654 a e 653
-653 a d 0
-652 - 651 0
-651 a i 650
-650 a n 649
-649 a t 648
-648 a e 647
-647 a r 646
-646 a n 0
-645 - 644 0
-644 a v 0
-643 - 642 0
-642 a f 0
-641 - 135 640
-640 - 639 637
+722 a p 0
+721 - 135 720
+720 - 153 0
+719 - 718 0
+718 a p 717
+717 a r 716
+716 a i 715
+715 a n 714
+714 a t 0
+713 - 135 0
+712 - 711 0
+711 a p 710
+710 a r 709
+709 a i 708
+708 a n 707
+707 a 1 0
+706 - 705 0
+705 a > 0
+704 - 703 0
+703 a < 0
+702 - 701 0
+701 a < 700
+700 a f 699
+699 a u 698
+698 a n 697
+697 a c 696
+696 a t 695
+695 a i 694
+694 a o 693
+693 a n 692
+692 a > 0
+691 - 690 0
+690 a l 0
+689 - 688 0
+688 a i 0
+687 - 135 0
+686 - 685 0
+685 a   0
+684 - 683 0
+683 a p 682
+682 a r 0
+681 - 680 0
+680 a . 679
+679 a   0
+678 - 135 0
+677 - 676 0
+676 a p 675
+675 a r 674
+674 a - 673
+673 a m 672
+672 a e 671
+671 a m 0
+670 - 669 0
+669 a 9 0
+668 - 667 0
+667 a 8 0
+666 n 9 0
+665 - 664 0
+664 a 7 0
+663 n 8 0
+662 - 661 0
+661 a 6 0
+660 n 7 0
+659 - 658 0
+658 a 5 0
+657 n 6 0
+656 - 655 0
+655 a 4 0
+654 n 5 0
+653 - 652 0
+652 a 3 0
+651 n 4 0
+650 - 649 0
+649 a 2 0
+648 n 3 0
+647 - 646 0
+646 a 1 0
+645 n 2 0
+644 - 643 0
+643 a 0 0
+642 n 1 0
+641 n 10 0
+640 - 639 0
 639 - 638 0
-638 a m 0
-637 - 333 0
-636 - 635 0
-635 a f 634
-634 a i 633
+638 a n 0
+637 - 636 0
+636 a p 635
+635 a r 634
+634 a - 633
 633 a n 632
-632 a d 0
-631 - 135 0
-630 - 629 0
-629 a f 628
-628 a i 627
+632 a u 631
+631 a m 0
+630 - 135 0
+629 - 628 0
+628 a p 627
 627 a r 626
-626 a s 625
-625 a t 0
-624 - 135 0
-623 - 622 0
-622 a m 621
-621 a k 620
-620 a n 619
-619 a a 618
-618 a m 617
-617 a e 0
-616 - 521 615
-615 - 333 0
-614 - 613 0
-613 a s 612
-612 a a 611
-611 a m 610
-610 a e 609
-609 a n 608
-608 a a 607
-607 a m 606
-606 a e 605
-605 a p 0
-604 - 135 603
-603 - 153 0
-602 - 601 0
-601 a p 600
-600 a r 599
-599 a i 598
-598 a n 597
-597 a t 0
-596 - 135 0
-595 - 594 0
-594 a p 593
-593 a r 592
-592 a i 591
-591 a n 590
-590 a 1 0
-589 - 588 0
-588 a > 0
-587 - 586 0
-586 a < 0
+626 a - 625
+625 a a 624
+624 a t 623
+623 a o 622
+622 a m 0
+621 - 135 0
+620 - 619 0
+619 a p 618
+618 a r 617
+617 a c 0
+616 - 135 0
+615 - 614 0
+614 a t 613
+613 a e 612
+612 a r 611
+611 a p 610
+610 a r 609
+609 a i 0
+608 - 607 0
+607 a w 606
+606 a r 605
+605 a i 604
+604 a t 603
+603 a e 602
+602 a c 0
+601 - 600 0
+600 - 599 0
+599 a c 0
+598 - 597 0
+597 a r 596
+596 a r 595
+595 a e 594
+594 a d 593
+593 a u 592
+592 a c 591
+591 a e 0
+590 - 412 589
+589 - 543 0
+588 - 536 587
+587 - 555 586
+586 - 532 0
 585 - 584 0
-584 a < 583
-583 a f 582
-582 a u 581
-581 a n 580
+584 a r 583
+583 a e 582
+582 a d 581
+581 a u 580
 580 a c 579
-579 a t 578
-578 a i 577
-577 a o 576
-576 a n 575
-575 a > 0
-574 - 573 0
-573 a l 0
-572 - 571 0
-571 a i 0
-570 - 569 0
-569 a n 0
-568 - 135 0
-567 - 566 0
-566 a   0
-565 - 564 0
-564 a p 563
-563 a r 0
-562 - 561 0
-561 a . 560
-560 a   0
-559 - 135 0
-558 - 557 0
-557 a p 556
-556 a r 555
-555 a - 554
-554 a m 553
-553 a e 552
-552 a m 0
-551 - 135 0
-550 - 549 0
+579 a e 0
+578 - 412 577
+577 - 543 0
+576 - 575 0
+575 a r 574
+574 a e 573
+573 a d 0
+572 - 536 571
+571 - 555 570
+570 - 532 0
+569 - 568 0
+568 a m 567
+567 a a 566
+566 a p 565
+565 a c 564
+564 a a 563
+563 a r 562
+562 a 2 0
+561 - 412 560
+560 - 409 559
+559 - 543 0
+558 - 536 557
+557 - 532 556
+556 - 555 0
+555 - 554 0
+554 a * 553
+553 a b 0
+552 - 551 0
+551 a m 550
+550 a a 549
 549 a p 548
-548 a r 547
-547 a - 546
-546 a a 545
-545 a t 544
-544 a o 543
-543 a m 0
-542 - 135 0
+548 a c 547
+547 a a 546
+546 a r 0
+545 - 412 544
+544 - 543 0
+543 - 542 0
+542 a r 0
 541 - 540 0
-540 a p 539
-539 a r 538
-538 a c 0
-537 - 135 0
+540 a m 539
+539 a a 538
+538 a p 0
+537 - 536 533
 536 - 535 0
-535 a t 534
-534 a e 533
-533 a r 532
-532 a p 531
-531 a r 530
-530 a i 0
+535 a * 534
+534 a f 0
+533 - 532 0
+532 - 531 0
+531 a * 530
+530 a a 0
 529 - 528 0
-528 a w 527
-527 a r 526
-526 a i 525
-525 a t 524
-524 a e 523
-523 a c 0
-522 - 521 0
+528 a a 527
+527 a s 526
+526 a s 525
+525 a o 524
+524 a c 0
+523 - 135 522
+522 - 412 0
 521 - 520 0
-520 a c 0
-519 - 518 0
-518 a r 517
-517 a r 516
+520 a m 519
+519 a e 518
+518 a m 517
+517 a b 516
 516 a e 515
-515 a d 514
-514 a u 513
-513 a c 512
-512 a e 0
-511 - 333 510
-510 - 464 0
-509 - 457 508
-508 - 476 507
-507 - 453 0
-506 - 505 0
-505 a r 504
-504 a e 503
-503 a d 502
-502 a u 501
-501 a c 500
-500 a e 0
-499 - 333 498
-498 - 464 0
-497 - 496 0
-496 a r 495
-495 a e 494
-494 a d 0
-493 - 457 492
-492 - 476 491
-491 - 453 0
-490 - 489 0
-489 a m 488
+515 a r 0
+514 - 135 513
+513 - 412 0
+512 - 511 0
+511 a e 510
+510 a q 509
+509 a u 508
+508 a a 507
+507 a l 0
+506 - 412 505
+505 - 409 0
+504 - 503 0
+503 a n 502
+502 a c 501
+501 a o 500
+500 a n 499
+499 a c 0
+498 - 412 497
+497 - 409 0
+496 - 495 0
+495 a l 494
+494 a o 493
+493 a o 492
+492 a p 0
+491 - 412 490
+490 - 409 0
+489 - 488 0
 488 a a 487
 487 a p 486
-486 a c 485
-485 a a 484
-484 a r 483
-483 a 2 0
-482 - 333 481
-481 - 330 480
-480 - 464 0
-479 - 457 478
-478 - 453 477
-477 - 476 0
-476 - 475 0
-475 a * 474
-474 a b 0
-473 - 472 0
-472 a m 471
-471 a a 470
-470 a p 469
-469 a c 468
-468 a a 467
-467 a r 0
-466 - 333 465
-465 - 464 0
-464 - 463 0
-463 a r 0
-462 - 461 0
-461 a m 460
-460 a a 459
-459 a p 0
-458 - 457 454
-457 - 456 0
-456 a * 455
-455 a f 0
-454 - 453 0
-453 - 452 0
-452 a * 451
-451 a a 0
-450 - 449 0
-449 a a 448
-448 a s 447
-447 a s 446
-446 a o 445
-445 a c 0
-444 - 135 443
-443 - 333 0
-442 - 441 0
-441 a m 440
-440 a e 439
-439 a m 438
-438 a b 437
-437 a e 436
-436 a r 0
-435 - 135 434
-434 - 333 0
-433 - 432 0
-432 a e 431
-431 a q 430
-430 a u 429
-429 a a 428
-428 a l 0
-427 - 333 426
-426 - 330 0
-425 - 424 0
-424 a n 423
-423 a c 422
-422 a o 421
-421 a n 420
-420 a c 0
-419 - 333 418
-418 - 330 0
-417 - 416 0
-416 a l 415
-415 a o 414
-414 a o 413
-413 a p 0
-412 - 333 411
-411 - 330 0
+486 a p 485
+485 a e 484
+484 a n 483
+483 a d 0
+482 - 412 481
+481 - 409 0
+480 - 479 0
+479 a n 478
+478 a r 477
+477 a e 476
+476 a v 475
+475 a e 474
+474 a r 473
+473 a s 472
+472 a e 0
+471 - 470 0
+470 a n 469
+469 a r 468
+468 a e 467
+467 a v 466
+466 a e 465
+465 a r 464
+464 a s 463
+463 a e 462
+462 a : 461
+461 a   460
+460 a e 459
+459 a x 458
+458 a p 457
+457 a e 456
+456 a c 455
+455 a t 454
+454 a e 453
+453 a d 452
+452 a   451
+451 a l 450
+450 a i 449
+449 a s 448
+448 a t 0
+447 - 446 0
+446 a * 445
+445 a n 444
+444 a r 443
+443 a t 442
+442 a m 441
+441 a p 0
+440 - 412 439
+439 - 409 0
+438 - 437 0
+437 a n 436
+436 a r 435
+435 a e 434
+434 a c 433
+433 a o 432
+432 a n 431
+431 a c 0
+430 - 412 0
+429 - 428 0
+428 a r 427
+427 a e 426
+426 a v 425
+425 a e 424
+424 a r 423
+423 a s 422
+422 a e 0
+421 - 412 0
+420 - 419 0
+419 a r 418
+418 a e 417
+417 a c 416
+416 a o 415
+415 a n 414
+414 a c 0
+413 - 412 410
+412 - 411 0
+411 a a 0
 410 - 409 0
-409 a a 408
-408 a p 407
-407 a p 406
-406 a e 405
-405 a n 404
-404 a d 0
-403 - 333 402
-402 - 330 0
-401 - 400 0
-400 a n 399
+409 - 408 0
+408 a b 0
+407 - 406 0
+406 a r 405
+405 a p 404
+404 a l 403
+403 a a 402
+402 a c 401
+401 a d 0
+400 - 399 0
 399 a r 398
-398 a e 397
-397 a v 396
-396 a e 395
-395 a r 394
-394 a s 393
-393 a e 0
-392 - 391 0
-391 a n 390
-390 a r 389
-389 a e 388
-388 a v 387
-387 a e 386
-386 a r 385
-385 a s 384
-384 a e 383
-383 a : 382
-382 a   381
-381 a e 380
-380 a x 379
-379 a p 378
-378 a e 377
-377 a c 376
-376 a t 375
-375 a e 374
-374 a d 373
-373 a   372
-372 a l 371
-371 a i 370
-370 a s 369
-369 a t 0
-368 - 367 0
-367 a * 366
-366 a n 365
-365 a r 364
-364 a t 363
-363 a m 362
-362 a p 0
-361 - 333 360
-360 - 330 0
-359 - 358 0
-358 a n 357
-357 a r 356
-356 a e 355
-355 a c 354
-354 a o 353
-353 a n 352
-352 a c 0
-351 - 333 0
-350 - 349 0
-349 a r 348
-348 a e 347
-347 a v 346
-346 a e 345
-345 a r 344
-344 a s 343
-343 a e 0
-342 - 333 0
+398 a p 397
+397 a l 396
+396 a a 395
+395 a c 394
+394 a d 393
+393 a : 392
+392 a   391
+391 a e 390
+390 a x 389
+389 a p 388
+388 a e 387
+387 a c 386
+386 a t 385
+385 a e 384
+384 a d 383
+383 a   382
+382 a c 381
+381 a o 380
+380 a n 379
+379 a s 0
+378 - 135 377
+377 - 153 0
+376 - 375 0
+375 a r 374
+374 a p 373
+373 a l 372
+372 a a 371
+371 a c 370
+370 a a 0
+369 - 368 0
+368 a r 367
+367 a p 366
+366 a l 365
+365 a a 364
+364 a c 363
+363 a a 362
+362 a : 361
+361 a   360
+360 a e 359
+359 a x 358
+358 a p 357
+357 a e 356
+356 a c 355
+355 a t 354
+354 a e 353
+353 a d 352
+352 a   351
+351 a c 350
+350 a o 349
+349 a n 348
+348 a s 0
+347 - 135 346
+346 - 153 0
+345 - 344 0
+344 a n 343
+343 a o 342
+342 a t 0
 341 - 340 0
-340 a r 339
-339 a e 338
-338 a c 337
-337 a o 336
-336 a n 335
-335 a c 0
-334 - 333 331
-333 - 332 0
-332 a a 0
-331 - 330 0
+340 a n 339
+339 a u 338
+338 a l 337
+337 a l 0
+336 - 135 0
+335 - 334 0
+334 a l 333
+333 a i 332
+332 a s 331
+331 a t 0
 330 - 329 0
-329 a b 0
-328 - 327 0
-327 a r 326
-326 a p 325
-325 a l 324
-324 a a 323
-323 a c 322
-322 a d 0
-321 - 320 0
-320 a r 319
-319 a p 318
-318 a l 317
-317 a a 316
-316 a c 315
-315 a d 314
-314 a : 313
-313 a   312
-312 a e 311
-311 a x 310
-310 a p 309
-309 a e 308
+329 a c 328
+328 a d 327
+327 a d 326
+326 a d 325
+325 a r 0
+324 - 135 0
+323 - 322 0
+322 a c 321
+321 a d 320
+320 a d 319
+319 a a 318
+318 a r 0
+317 - 135 0
+316 - 315 0
+315 a c 314
+314 a d 313
+313 a a 312
+312 a d 311
+311 a r 0
+310 - 135 0
+309 - 308 0
 308 a c 307
-307 a t 306
-306 a e 305
-305 a d 304
-304 a   303
-303 a c 302
-302 a o 301
-301 a n 300
-300 a s 0
-299 - 135 298
-298 - 153 0
-297 - 296 0
-296 a r 295
-295 a p 294
-294 a l 293
+307 a d 306
+306 a a 305
+305 a a 304
+304 a r 0
+303 - 135 0
+302 - 301 0
+301 a c 300
+300 a a 299
+299 a d 298
+298 a d 297
+297 a r 0
+296 - 135 0
+295 - 294 0
+294 a c 293
 293 a a 292
-292 a c 291
-291 a a 0
-290 - 289 0
-289 a r 288
-288 a p 287
-287 a l 286
+292 a d 291
+291 a a 290
+290 a r 0
+289 - 135 0
+288 - 287 0
+287 a c 286
 286 a a 285
-285 a c 284
-284 a a 283
-283 a : 282
-282 a   281
-281 a e 280
-280 a x 279
-279 a p 278
-278 a e 277
-277 a c 276
-276 a t 275
-275 a e 274
-274 a d 273
-273 a   272
-272 a c 271
-271 a o 270
-270 a n 269
-269 a s 0
-268 - 135 267
-267 - 153 0
-266 - 265 0
-265 a n 264
-264 a o 263
-263 a t 0
+285 a a 284
+284 a d 283
+283 a r 0
+282 - 135 0
+281 - 280 0
+280 a c 279
+279 a a 278
+278 a a 277
+277 a a 276
+276 a r 0
+275 - 135 0
+274 - 273 0
+273 a c 272
+272 a d 271
+271 a d 270
+270 a r 0
+269 - 135 0
+268 - 267 0
+267 a c 266
+266 a d 265
+265 a a 264
+264 a r 0
+263 - 135 0
 262 - 261 0
-261 a n 260
-260 a u 259
-259 a l 258
-258 a l 0
+261 a c 260
+260 a a 259
+259 a d 258
+258 a r 0
 257 - 135 0
 256 - 255 0
-255 a l 254
-254 a i 253
-253 a s 252
-252 a t 0
-251 - 250 0
-250 a c 249
-249 a d 248
-248 a d 247
-247 a d 246
-246 a r 0
-245 - 135 0
-244 - 243 0
-243 a c 242
-242 a d 241
-241 a d 240
-240 a a 239
-239 a r 0
-238 - 135 0
-237 - 236 0
-236 a c 235
-235 a d 234
-234 a a 233
-233 a d 232
-232 a r 0
-231 - 135 0
-230 - 229 0
-229 a c 228
-228 a d 227
+255 a c 254
+254 a a 253
+253 a a 252
+252 a r 0
+251 - 135 0
+250 - 249 0
+249 a g 248
+248 a r 247
+247 a e 246
+246 a a 245
+245 a t 244
+244 a e 243
+243 a r 242
+242 a p 0
+241 - 135 240
+240 - 153 0
+239 - 238 0
+238 a l 237
+237 a e 236
+236 a s 235
+235 a s 234
+234 a p 0
+233 - 135 232
+232 - 153 0
+231 - 230 0
+230 a r 229
+229 a e 228
+228 a m 227
 227 a a 226
-226 a a 225
-225 a r 0
-224 - 135 0
-223 - 222 0
-222 a c 221
-221 a a 220
-220 a d 219
-219 a d 218
-218 a r 0
-217 - 135 0
-216 - 215 0
-215 a c 214
-214 a a 213
-213 a d 212
-212 a a 211
-211 a r 0
-210 - 135 0
-209 - 208 0
-208 a c 207
-207 a a 206
-206 a a 205
-205 a d 204
-204 a r 0
-203 - 135 0
-202 - 201 0
-201 a c 200
-200 a a 199
-199 a a 198
-198 a a 197
-197 a r 0
-196 - 135 0
-195 - 194 0
-194 a c 193
-193 a d 192
-192 a d 191
-191 a r 0
-190 - 135 0
-189 - 188 0
-188 a c 187
-187 a d 186
-186 a a 185
-185 a r 0
-184 - 135 0
-183 - 182 0
-182 a c 181
-181 a a 180
-180 a d 179
-179 a r 0
-178 - 135 0
-177 - 176 0
-176 a c 175
-175 a a 174
-174 a a 173
-173 a r 0
+226 a i 225
+225 a n 224
+224 a d 223
+223 a e 222
+222 a r 0
+221 - 135 220
+220 - 153 0
+219 - 218 0
+218 a q 217
+217 a u 216
+216 a o 215
+215 a t 214
+214 a i 213
+213 a e 212
+212 a n 211
+211 a t 0
+210 - 135 209
+209 - 153 0
+208 - 207 0
+207 a t 206
+206 a i 205
+205 a m 204
+204 a e 203
+203 a s 0
+202 - 135 201
+201 - 153 0
+200 - 199 0
+199 a d 198
+198 a i 197
+197 a f 196
+196 a f 195
+195 a e 194
+194 a r 193
+193 a e 192
+192 a n 191
+191 a c 190
+190 a e 0
+189 - 135 188
+188 - 153 0
+187 - 186 0
+186 a p 185
+185 a l 184
+184 a u 183
+183 a s 0
+182 - 135 181
+181 - 153 0
+180 - 179 0
+179 a n 178
+178 a u 177
+177 a m 176
+176 a b 175
+175 a e 174
+174 a r 173
+173 a p 0
 172 - 135 0
 171 - 170 0
 170 a h 169
@@ -4,13 +4,26 @@
  * In the public domain
  */
 
- #define MAGIC	"KL21"
+ #define MAGIC	"KL"
+ #define IMGVER	26
 
  #include <stdlib.h>
  #include <stdio.h>
  #include <string.h>
  #include <ctype.h>
  #include <setjmp.h>
+ #ifdef __SUBC__
+  #define clock_t	int
+  #define clock()	0
+  #define USECS(t)	0
+ #else
+  #include <time.h>
+  #define USECS(t)	((long) ((double) (t) * 1e6 / CLOCKS_PER_SEC))
+ #endif
+ #ifdef MAPIMG
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+ #endif
  
  #ifdef __TURBOC__
   #include <io.h>
@@ -49,14 +62,57 @@
  
  #define NNODES	8192
  
+ /*
+  * Define SHALLOW for shallow binding: each symbol holds its current
+  * value and function calls save and restore the outer values, like
+  * the LISCMP runtime. Variable access is then constant-time, but
+  * variables are dynamically scoped and closures do not capture them.
+  */
+ 
+ /* #define SHALLOW */
+ 
+ /*
+  * Define MAPIMG on hosts with mmap() to map the sections of a
+  * page-aligned image copy-on-write instead of reading them. The
+  * heap is then allocated at startup. The checksum of a mapped
+  * image is not verified, because that would read in every page;
+  * define CHECKIMG as well to verify it anyway.
+  */
+ 
+ /* #define MAPIMG */
+ 
  #define SYMLEN	64
  #define BUFLEN	128
  #define PRDEPTH	128
  #define NLOAD	2
+ /*
+  * The symbol index and the evaluator stacks may be made smaller
+  * for small targets, e.g. cc -DNHASH=1024 -DNSTACK=1024.
+  */
+ 
+ #ifndef NHASH
+  #define NHASH	(NNODES/2)
+ #endif
+ #ifndef NSTACK
+  #define NSTACK	4096
+ #endif
+ #ifndef NMSTACK
+  #define NMSTACK	4096
+ #endif
+ #ifndef NBIND
+  #define NBIND	NSTACK
+ #endif
  
  #define	ATOM	0x01
- #define	MARK	0x02
- #define SWAP	0x04
+ #define SWAP	0x02
+ #define OPSHIFT	2	/* bits 2..7 of a symbol node hold its opcode */
+ #define NUMBER	0x04	/* ATOM node holding a fixnum in its car */
+ 
+ #define MAXNUM	32767
+ #define MINNUM	(-MAXNUM-1)
+ 
+ #define MBITS	16
+ #define MMASK	0xffffU
  
  #define NIL	(NNODES+5)
  #define EOT	(NNODES+4)
@@ -65,16 +121,34 @@
  #define UNDEF	(NNODES+1)
  #define SPCL	NNODES
  
+ #ifdef MAPIMG
+ byte	*Tag;
+ 
+ cell	*Car,
+     *Cdr;
+ #else
  byte	Tag[NNODES];
  
  cell	Car[NNODES],
      Cdr[NNODES];
+ #endif
  
- int	Freelist;
+ unsigned short	Marks[NNODES/MBITS];
+ 
+ int	Freelist, Sweep, Live;
  
  int	Acc, Env;
  
- int	Stack, Mstack;
+ int	Tasks, Depth;
+ 
+ #ifdef SHALLOW
+  cell	Bsym[NBIND], Bval[NBIND];
+  int	Bp;
+ #endif
+ 
+ cell	Stack[NSTACK];
+ byte	Mstack[NMSTACK];
+ int	Sp, Msp;
  
  int	Tmp, Tmpcar, Tmpcdr;
  
@@ -85,7 +159,8 @@
  int	Output, Outp;
  char	Outbuf[BUFLEN];
  
- int	Symbols;
+ int	Symbols, Nsyms;
+ cell	Symhash[NHASH];
  int	Id;
  
  jmp_buf		Restart;
@@ -96,11 +171,31 @@
  
  int	Verbose_GC;
  
+ /*
+  * GC statistics. Pauses are in microseconds; Hist[k] counts the
+  * pauses of 2^k to 2^(k+1)-1 microseconds, the last bucket all
+  * longer ones. Counting starts after the image is loaded. The
+  * summary and histogram are printed on exit only when verbose
+  * GC was turned on with (gc t).
+  */
+ 
+ #define NHIST	15
+ 
+ long	Ngc, Nalloc, Nfreed, Pauses, Maxpause;
+ int	Peak;
+ long	Hist[NHIST];
+ 
  int	S_apply, S_if, S_ifnot, S_lambda, S_lamstar, S_macro, S_prog,
      S_quote, S_qquote, S_unquote, S_splice, S_setq;
- int	S_t, S_cons, S_car, S_cdr, S_atom, S_eq, S_gensym, S_it,
-     S_suspend, S_gc, S_eofp, S_load, S_setcar, S_setcdr, S_read,
-     S_prin, S_prin1, S_print, S_error;
+ int	S_t, S_it;
+ 
+ enum { ONONE = 0,
+        OQUOTE, OIF, OPROG, OIFNOT, OLAMBDA, OLAMSTAR, OAPPLY, OMACRO,
+        OSETQ,	/* special forms end here */
+        OCAR, OCDR, OEQ, OATOM, OCONS, OSETCAR, OSETCDR, OGENSYM, OEOFP,
+        OREAD, OPRIN, OPRIN1, OPRINT, OLOAD, OERROR, OGC, OGCSTATS,
+        OSUSPEND, OSPAWN, OYIELD,
+        OPLUS, OMINUS, OTIMES, ODIV, OMOD, OLESS, OEQUAL };
  
  int car(int x) { return Car[x]; }
  int cdr(int x) { return Cdr[x]; }
@@ -108,12 +203,22 @@
  void setcar(int x, int v) { Car[x] = v; }
  void setcdr(int x, int v) { Cdr[x] = v; }
  
+ /* A symbol is a node whose car is a name, an ATOM node that is no number */
+ 
+ int namep(int n) {
+     return n < SPCL && (Tag[n] & (ATOM|NUMBER)) == ATOM;
+ }
+ 
  int atomp(int n) {
-     return n >= SPCL || (car(n) < SPCL && (Tag[car(n)] & ATOM));
+     return n >= SPCL || (Tag[n] & ATOM) || namep(car(n));
  }
  
  int symbolp(int n) {
-     return n < SPCL && car(n) < SPCL && (Tag[car(n)] & ATOM);
+     return n < SPCL && 0 == (Tag[n] & ATOM) && namep(car(n));
+ }
+ 
+ int numberp(int n) {
+     return n < SPCL && (Tag[n] & (ATOM|NUMBER)) == (ATOM|NUMBER);
  }
  
  int caar(int x) { return Car[Car[x]]; }
@@ -163,14 +268,17 @@
  char *ntoa(int n) {
      static char	buf[20];
      char		*q, *p;
+     int		neg;
  
+     neg = n < 0;
      p = q = &buf[sizeof(buf)-1];
      *p = 0;
      while (n || p == q) {
          p--;
-         *p = n % 10 + '0';
+         *p = (neg? -(n % 10): n % 10) + '0';
          n = n / 10;
      }
+     if (neg) *--p = '-';
      return p;
  }
  
@@ -200,6 +308,17 @@
      exit(1);
  }
  
+ /* Mark bits live in a bitmap, MBITS nodes per word */
+ 
+ int marked(int n) {
+     return Marks[n / MBITS] & (1 << (n % MBITS));
+ }
+ 
+ void setmark(int n) {
+     Marks[n / MBITS] |= 1 << (n % MBITS);
+     Live++;
+ }
+ 
  /* Deutsch/Schorr/Waite graph marker */
  
  void mark(int n) {
@@ -207,7 +326,7 @@
  
      p = NIL;
      for (;;) {
-         if (n >= SPCL || Tag[n] & MARK) {
+         if (n >= SPCL || marked(n)) {
              if (NIL == p) break;
              if (Tag[p] & SWAP) {
                  x = cdr(p);
@@ -228,12 +347,12 @@
              setcdr(n, p);
              p = n;
              n = x;
-             Tag[p] |= MARK;
+             setmark(p);
          }
          else {
              x = car(n);
              setcar(n, p);
-             Tag[n] |= MARK;
+             setmark(n);
              p = n;
              n = x;
              Tag[p] |= SWAP;
@@ -241,29 +360,99 @@
      }
  }
  
+ #ifdef __GNUC__
+  #define ctz(x)	__builtin_ctz(x)
+  #define popcount(x)	__builtin_popcount(x)
+ #else
+  int ctz(unsigned x) {
+      int	n;
+ 
+      for (n = 0; 0 == (x & 1); n++)
+          x >>= 1;
+      return n;
+  }
+ 
+  int popcount(unsigned x) {
+      int	n;
+ 
+      for (n = 0; x; n++)
+          x &= x-1;
+      return n;
+  }
+ #endif
+ 
+ /*
+  * Lazy sweeper: collect the unmarked nodes of the next word of
+  * the bitmap that has any. Called by cons3() whenever the free
+  * list runs dry, so the sweep is spread across allocation.
+  */
+ 
+ void sweep(void) {
+     unsigned	w;
+     int	n;
+ 
+     while (NIL == Freelist && Sweep < NNODES) {
+         w = ~Marks[Sweep / MBITS] & MMASK;
+         while (w) {
+             n = Sweep + ctz(w);
+             setcdr(n, Freelist);
+             Freelist = n;
+             w &= w-1;
+         }
+         Sweep += MBITS;
+     }
+ }
+ 
+ void gcstat(clock_t t, int k) {
+     long	us;
+ 
+     us = USECS(clock() - t);
+     Ngc++;
+     Nfreed += k;
+     Pauses += us;
+     if (us > Maxpause) Maxpause = us;
+     if (Live > Peak) Peak = Live;
+     for (k = 0; us > 1 && k < NHIST-1; k++)
+         us >>= 1;
+     Hist[k]++;
+ }
+ 
+ /* Forget the collections made while the image was set up */
+ 
+ void gcreset(void) {
+     int	k;
+ 
+     Ngc = Nalloc = Nfreed = Pauses = Maxpause = 0;
+     Peak = 0;
+     for (k=0; k<NHIST; k++)
+         Hist[k] = 0;
+ }
+ 
  int gc(int v) {
      int	i, k;
+     clock_t	t;
  
-     k = 0;
+     t = clock();
+     for (i=0; i<NNODES/MBITS; i++)
+         Marks[i] = 0;
+     Live = 0;
      mark(Acc);
      mark(Env);
      mark(Symbols);
-     mark(Stack);
-     mark(Mstack);
+     for (i=0; i<Sp; i++)
+         mark(Stack[i]);
      mark(Tmpcar);
      mark(Tmpcdr);
      mark(Tmp);
+     mark(Tasks);
+ #ifdef SHALLOW
+     for (i=0; i<Bp; i++)
+         mark(Bval[i]);
+ #endif
      Freelist = NIL;
-     for (i=0; i<NNODES; i++) {
-         if (0 == (Tag[i] & MARK)) {
-             setcdr(i, Freelist);
-             Freelist = i;
-             k++;
-         }
-         else {
-             Tag[i] &= ~MARK;
-         }
-     }
+     Sweep = 0;
+     k = NNODES - Live;
+     gcstat(t, k);
      if (v || Verbose_GC) {
          prnum(k);
          pr(" nodes reclaimed");
@@ -275,15 +464,18 @@
  int cons3(int a, int d, int t) {
      int	n;
  
+     if (NIL == Freelist) sweep();
      if (NIL == Freelist) {
          Tmpcdr = d;
          if (0 == t) Tmpcar = a;
          gc(0);
+         sweep();
          Tmpcar = Tmpcdr = NIL;
          if (NIL == Freelist) error("out of nodes", UNDEF);
      }
      n = Freelist;
      Freelist = cdr(Freelist);
+     Nalloc++;
      setcar(n, a);
      setcdr(n, d);
      Tag[n] = t;
@@ -292,6 +484,11 @@
  
  int cons(int a, int d) { return cons3(a, d, 0); }
  
+ int mknum(long v) {
+     if (v < MINNUM || v > MAXNUM) error("overflow", UNDEF);
+     return cons3((int) v, NIL, ATOM|NUMBER);
+ }
+ 
  int nrev(int n) {
      int	m, h;
  
@@ -305,29 +502,25 @@
      return m;
  }
  
- void save(int n) { Stack = cons(n, Stack); }
+ void save(int n) {
+     if (Sp >= NSTACK) error("stack overflow", UNDEF);
+     Stack[Sp++] = n;
+ }
  
  int unsave(int k) {
-     int	n;
- 
-     while (k) {
-         if (NIL == Stack) fatal("stack empty");
-         n = car(Stack);
-         Stack = cdr(Stack);
-         k--;
-     }
-     return n;
+     if (Sp < k) fatal("stack empty");
+     Sp -= k;
+     return Stack[Sp];
  }
  
- void msave(int n) { Mstack = cons3(n, Mstack, ATOM); }
+ void msave(int n) {
+     if (Msp >= NMSTACK) error("mstack overflow", UNDEF);
+     Mstack[Msp++] = n;
+ }
  
  int munsave(void) {
-     int	n;
- 
-     if (NIL == Mstack) fatal("mstack empty");
-     n = car(Mstack);
-     Mstack = cdr(Mstack);
-     return n;
+     if (Msp < 1) fatal("mstack empty");
+     return Mstack[--Msp];
  }
  
  int strsym(char *s) {
@@ -363,23 +556,63 @@
      return b;
  }
  
- int findsym(char *s) {
-     int	p;
+ /*
+  * Symbol index, open addressing with linear probing. Each symbol
+  * takes at least four nodes, so the default table never gets more
+  * than half full; a smaller one is checked. NHASH must be a power
+  * of two.
+  */
+ 
+ int hash(char *s) {
+     unsigned	h;
  
-     p = Symbols;
-     while (p != NIL) {
-         if (strcmp(s, symstr(car(p))) == 0)
-             return car(p);
-         p = cdr(p);
+     for (h = 0; *s; s++)
+         h = h * 31 + (byte) *s;
+     return h & (NHASH-1);
+ }
+ 
+ int samename(char *s, int n) {
+     for (n = car(n); n != NIL; n = cdr(n)) {
+         if (s[0] != (char) (car(n) >> 8)) return 0;
+         if (s[1] != (char) car(n)) return 0;
+         if (0 == s[1]) return 1;
+         s += 2;
      }
-     return NIL;
+     return 0 == *s;
+ }
+ 
+ /* Slot holding the symbol named s, or free slot where it goes */
+ 
+ int slot(char *s) {
+     int	h;
+ 
+     for (h = hash(s); Symhash[h] != NIL; h = (h+1) & (NHASH-1))
+         if (samename(s, Symhash[h]))
+             break;
+     return h;
+ }
+ 
+ void addhash(char *s, int n) {
+     if (++Nsyms >= NHASH) fatal("symbol table full");
+     Symhash[slot(s)] = n;
+ }
+ 
+ void rehash(void) {
+     int	i, p;
+ 
+     Nsyms = 0;
+     for (i=0; i<NHASH; i++)
+         Symhash[i] = NIL;
+     for (p = Symbols; p != NIL; p = cdr(p))
+         addhash(symstr(car(p)), car(p));
  }
  
  int addsym(char *s, int v) {
-     int	n;
+     int	h, n;
  
-     n = findsym(s);
-     if (n != NIL) return n;
+     h = slot(s);
+     if (Symhash[h] != NIL) return Symhash[h];
+     if (Nsyms+1 >= NHASH) error("symbol table full", UNDEF);
      n = strsym(s);
      save(n);
      if (SPCL == v)
@@ -387,6 +620,8 @@
      else
          setcdr(n, cons(v, NIL));
      Symbols = cons(n, Symbols);
+     Symhash[h] = n;
+     Nsyms++;
      unsave(1);
      return n;
  }
@@ -423,7 +658,7 @@
  
      badpair = "bad pair";
      Parens++;
-     lst = cons(NIL, NIL);
+     lst = NIL;
      save(lst);
      a = NIL;
      count = 0;
@@ -442,31 +677,52 @@
              return lst;
          }
          if (RPAREN == n) break;
-         if (NIL == a) 
-             a = lst;
+         n = cons(n, NIL);
+         if (NIL == a)
+             Stack[Sp-1] = lst = n;
          else
-             a = cdr(a);
-         setcar(a, n);
-         setcdr(a, cons(NIL, NIL));
+             setcdr(a, n);
+         a = n;
          count++;
      }
      Parens--;
-     if (a != NIL) setcdr(a, NIL);
      unsave(1);
-     return count? lst: NIL;
+     return lst;
  }
  
  int symbolic(int c) {
-     return isalpha(c) || isdigit(c) || '-' == c || '/' == c;
+     return isalpha(c) || isdigit(c) || '-' == c || '/' == c ||
+         '+' == c || '*' == c || '<' == c || '=' == c;
+ }
+ 
+ int numeric(char *s) {
+     if ('-' == *s) s++;
+     if (0 == *s) return 0;
+     while (isdigit(*s)) s++;
+     return 0 == *s;
+ }
+ 
+ int strnum(char *s) {
+     long	v;
+     int	neg;
+ 
+     neg = '-' == *s;
+     if (neg) s++;
+     for (v = 0; *s && v <= MAXNUM+1L; s++)
+         v = v * 10 + *s - '0';
+     return mknum(neg? -v: v);
  }
  
  int rdsym(int c) {
      char	s[SYMLEN+1];
-     int	i;
+     int	i, esc;
  
-     i = 0;
+     i = esc = 0;
      while (symbolic(c)) {
-         if ('/' == c) c = rdchci();
+         if ('/' == c) {
+             c = rdchci();
+             esc = 1;
+         }
          if (SYMLEN == i)
              error("long symbol", UNDEF);
          else if (i < SYMLEN) {
@@ -478,6 +734,7 @@
      s[i] = 0;
      Rejected = c;
      if (!strcmp(s, "nil")) return NIL;
+     if (!esc && numeric(s)) return strnum(s);
      return addsym(s, UNDEF);
  }
  
@@ -570,6 +827,9 @@
      else if (EOT == n) {
          pr("*eot*");
      }
+     else if (numberp(n)) {
+         prnum(car(n));
+     }
      else if (n >= SPCL || Tag[n] & ATOM) {
          pr("*unprintable*");
      }
@@ -585,7 +845,7 @@
          while (n != NIL) {
              print2(car(n), d+1);
              n = cdr(n);
-             if (symbolp(n)) {
+             if (n != NIL && atomp(n)) {
                  pr(" . ");
                  print2(n, d+1);
                  n = NIL;
@@ -603,6 +863,12 @@
      flush();
  }
  
+ #ifdef SHALLOW
+ 
+ int lookup(int x) { return cdr(x); }
+ 
+ #else
+ 
  int lookup(int x) {
      int	a ,e;
  
@@ -615,16 +881,18 @@
      return cdr(x);
  }
  
+ #endif
+ 
+ int opcode(int n) {
+     if (n >= SPCL || Tag[n] & ATOM) return ONONE;
+     return (Tag[n] >> OPSHIFT) & 0x3f;
+ }
+ 
  int specialp(int n) {
-     return	n == S_quote ||
-         n == S_if ||
-         n == S_prog ||
-         n == S_ifnot ||
-         n == S_lambda ||
-         n == S_lamstar ||
-         n == S_apply ||
-         n == S_setq ||
-         n == S_macro;
+     int	op;
+ 
+     op = opcode(n);
+     return op != ONONE && op <= OSETQ;
  }
  
  void check(int x, int k0, int kn) {
@@ -675,136 +943,617 @@
          error("write error", UNDEF);
  }
  
- void suspend(char *s) {
-     int	fd, k;
+ /*
+  * Image layout: a header of HDRLEN bytes, then the cars, cdrs,
+  * and tags of the live nodes at the offsets given in the header.
+  * Header fields are big-endian:
+  *
+  *  0  "KL"        magic
+  *  3  IMGVER      format version
+  *  5  NNODES      heap size of the writer
+  *  7  live        number of nodes in the image
+  *  9  Symbols     root of the symbol list
+  * 11  Id          gensym counter
+  * 13  cell size   in bytes
+  * 14  offsets     of the car, cdr, and tag sections, 4 bytes each
+  * 26  checksum    Fletcher-16 of the header and the sections
+  *
+  * Sections are aligned to Align bytes, the page size when MAPIMG
+  * is defined, so that they can be mapped directly.
+  */
+ 
+ #define HDRLEN	28
+ 
+ unsigned	Sum1, Sum2;
+ int	Align;
+ 
+ void csum(void *b, long k) {
+     byte	*p;
+ 
+     for (p = b; k--; p++) {
+         Sum1 = (Sum1 + *p) % 255;
+         Sum2 = (Sum2 + Sum1) % 255;
+     }
+ }
+ 
+ void putn(byte *b, long v, int k) {
+     while (k--) {
+         b[k] = (byte) v;
+         v >>= 8;
+     }
+ }
+ 
+ long getn(byte *b, int k) {
+     long	v;
+ 
+     for (v = 0; k--; b++)
+         v = (v << 8) | *b;
+     return v;
+ }
+ 
+ long align(long n) {
+     return (n + Align-1) / Align * Align;
+ }
+ 
+ /* A negative fd only adds the data to the checksum. */
+ 
+ void emit(int fd, void *b, int k) {
+     if (fd < 0)
+         csum(b, k);
+     else
+         dowrite(fd, b, k);
+ }
+ 
+ void pad(int fd, long from, long to) {
      byte	buf[BUFLEN];
+     int	k;
+ 
+     memset(buf, 0, BUFLEN);
+     while (from < to) {
+         k = to - from > BUFLEN? BUFLEN: to - from;
+         dowrite(fd, buf, k);
+         from += k;
+     }
+ }
+ 
+ /*
+  * Images contain only the nodes reachable from Symbols, slid down
+  * to the bottom of the heap in their original order. The new
+  * address of a marked node is the number of marked nodes below it,
+  * counted with Base[] and the bitmap.
+  */
+ 
+ cell	Base[NNODES/MBITS];
+ 
+ int reloc(int n) {
+     unsigned	m;
+ 
+     if (n >= SPCL) return n;
+     m = Marks[n / MBITS] & ((1U << (n % MBITS)) - 1);
+     return Base[n / MBITS] + popcount(m);
+ }
+ 
+ void dumpcells(int fd, int cdrs) {
+     cell	buf[BUFLEN];
+     int	i, k;
+ 
+     k = 0;
+     for (i=0; i<NNODES; i++) {
+         if (!marked(i)) continue;
+         if (cdrs)
+             buf[k++] = reloc(cdr(i));
+         else
+             buf[k++] = Tag[i] & ATOM? car(i): reloc(car(i));
+         if (BUFLEN == k) {
+             emit(fd, buf, k * sizeof(cell));
+             k = 0;
+         }
+     }
+     emit(fd, buf, k * sizeof(cell));
+ }
+ 
+ void dumptags(int fd) {
+     byte	buf[BUFLEN];
+     int	i, k;
+ 
+     k = 0;
+     for (i=0; i<NNODES; i++) {
+         if (!marked(i)) continue;
+         buf[k++] = Tag[i];
+         if (BUFLEN == k) {
+             emit(fd, buf, k);
+             k = 0;
+         }
+     }
+     emit(fd, buf, k);
+ }
+ 
+ void suspend(char *s) {
+     int	fd, i, n;
+     long	car0, cdr0, tag0, len;
+     byte	hdr[HDRLEN];
  
      fd = creat(s, 0644);
      BINARY;
      if (fd < 0) error("suspend", strsym(s));
-     memcpy(buf, MAGIC, strlen(MAGIC)+1);
-     k = strlen(MAGIC)+1;
-     buf[k] = (byte) (NNODES >> 8);
-     buf[k+1] = (byte) NNODES;
-     buf[k+2] = (byte) (Freelist >> 8);
-     buf[k+3] = (byte) Freelist;
-     buf[k+4] = (byte) (Symbols >> 8);
-     buf[k+5] = (byte) Symbols;
-     buf[k+6] = (byte) (Id >> 8);
-     buf[k+7] = (byte) Id;
-     dowrite(fd, buf, k+8);
-     dowrite(fd, Car, NNODES * sizeof(cell));
-     dowrite(fd, Cdr, NNODES * sizeof(cell));
-     dowrite(fd, Tag, NNODES);
+     for (i=0; i<NNODES/MBITS; i++)
+         Marks[i] = 0;
+     Live = 0;
+     mark(Symbols);
+     n = 0;
+     for (i=0; i<NNODES/MBITS; i++) {
+         Base[i] = n;
+         n += popcount(Marks[i]);
+     }
+     len = (long) n * sizeof(cell);
+     car0 = align(HDRLEN);
+     cdr0 = align(car0 + len);
+     tag0 = align(cdr0 + len);
+     memset(hdr, 0, HDRLEN);
+     memcpy(hdr, MAGIC, strlen(MAGIC));
+     putn(hdr+3, IMGVER, 2);
+     putn(hdr+5, NNODES, 2);
+     putn(hdr+7, n, 2);
+     putn(hdr+9, reloc(Symbols), 2);
+     putn(hdr+11, Id, 2);
+     hdr[13] = sizeof(cell);
+     putn(hdr+14, car0, 4);
+     putn(hdr+18, cdr0, 4);
+     putn(hdr+22, tag0, 4);
+     Sum1 = Sum2 = 0;
+     csum(hdr, HDRLEN-2);
+     dumpcells(-1, 0);
+     dumpcells(-1, 1);
+     dumptags(-1);
+     putn(hdr+26, Sum2 << 8 | Sum1, 2);
+     dowrite(fd, hdr, HDRLEN);
+     pad(fd, HDRLEN, car0);
+     dumpcells(fd, 0);
+     pad(fd, car0 + len, cdr0);
+     dumpcells(fd, 1);
+     pad(fd, cdr0 + len, tag0);
+     dumptags(fd);
      close(fd);
+     gc(0);
  }
  
- void doread(int fd, void *b, int k) {
+ void doread(int fd, void *b, long k) {
      if (read(fd, b, k) != k)
-         error("read error", UNDEF);
+         error("bad image", UNDEF);
  }
  
- void fasload(char *s) {
-     int	fd, k, n;
+ /* Read k bytes at offset off, skipping forward from *pos. */
+ 
+ void readat(int fd, long *pos, long off, void *b, long k) {
      byte	buf[BUFLEN];
+     long	n;
+ 
+     while (*pos < off) {
+         n = off - *pos > BUFLEN? BUFLEN: off - *pos;
+         doread(fd, buf, n);
+         *pos += n;
+     }
+     doread(fd, b, k);
+     *pos += k;
+ }
+ 
+ #ifdef MAPIMG
+ 
+ void *heap(long k) {
+     void	*p;
+ 
+     p = mmap(NULL, k, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS,
+         -1, 0);
+     if (MAP_FAILED == p) {
+         pr("out of memory");
+         nl();
+         exit(1);
+     }
+     return p;
+ }
+ 
+ /*
+  * Map the sections over the bottom of the heap. Pages are private,
+  * so the image file is never written; they are read in on first
+  * touch. Returns 0 if the image is not aligned for this host.
+  */
+ 
+ int mapimg(int fd, long car0, long cdr0, long tag0, int live) {
+     struct stat	st;
+     long	len;
+ 
+     len = (long) live * sizeof(cell);
+     if (car0 % Align || cdr0 % Align || tag0 % Align) return 0;
+     if (fstat(fd, &st) < 0 || st.st_size != tag0 + live)
+         error("bad image", UNDEF);
+     if (0 == live) return 1;
+     if (mmap(Car, len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED,
+             fd, car0) == MAP_FAILED ||
+         mmap(Cdr, len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED,
+             fd, cdr0) == MAP_FAILED ||
+         mmap(Tag, live, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED,
+             fd, tag0) == MAP_FAILED)
+     {
+         error("mmap failed", UNDEF);
+     }
+     return 1;
+ }
+ 
+ #endif
+ 
+ void	initsyms(void);
+ 
+ void fasload(char *s) {
+     int	fd, i, live, mapped;
+     long	car0, cdr0, tag0, len, pos;
+     byte	hdr[HDRLEN], c;
      char	*badimg;
  
      badimg = "bad image";
      fd = open(s, O_RDONLY, 0777);
      BINARY;
      if (fd < 0) return;
-     k = strlen(MAGIC)+1;
-     doread(fd, buf, k+8);
-     n = (buf[k] << 8) | buf[k+1];
-     Freelist = (buf[k+2] << 8) | buf[k+3];
-     Symbols = (buf[k+4] << 8) | buf[k+5];
-     Id = (buf[k+6] << 8) | buf[k+7];
-     if (n != NNODES || memcmp(buf, MAGIC, k) != 0)
+     if (read(fd, hdr, HDRLEN) != HDRLEN)
+         error(badimg, UNDEF);
+     live = getn(hdr+7, 2);
+     len = (long) live * sizeof(cell);
+     car0 = getn(hdr+14, 4);
+     cdr0 = getn(hdr+18, 4);
+     tag0 = getn(hdr+22, 4);
+     if (memcmp(hdr, MAGIC, strlen(MAGIC)+1) != 0 ||
+         getn(hdr+3, 2) != IMGVER ||
+         getn(hdr+5, 2) != NNODES ||
+         hdr[13] != sizeof(cell) ||
+         live > NNODES ||
+         car0 < HDRLEN ||
+         cdr0 < car0 + len ||
+         tag0 < cdr0 + len)
+     {
          error(badimg, UNDEF);
-     doread(fd, Car, NNODES * sizeof(cell));
-     doread(fd, Cdr, NNODES * sizeof(cell));
-     doread(fd, Tag, NNODES);
-     if (read(fd, buf, 1) != 0)
+     }
+     Symbols = getn(hdr+9, 2);
+     Id = getn(hdr+11, 2);
+     if (Symbols >= live && Symbols != NIL)
          error(badimg, UNDEF);
+     mapped = 0;
+ #ifdef MAPIMG
+     mapped = mapimg(fd, car0, cdr0, tag0, live);
+ #endif
+     if (!mapped) {
+         pos = HDRLEN;
+         readat(fd, &pos, car0, Car, len);
+         readat(fd, &pos, cdr0, Cdr, len);
+         readat(fd, &pos, tag0, Tag, live);
+         if (read(fd, &c, 1) != 0)
+             error(badimg, UNDEF);
+     }
      close(fd);
+ #ifndef CHECKIMG
+     if (!mapped)
+ #endif
+     {
+         Sum1 = Sum2 = 0;
+         csum(hdr, HDRLEN-2);
+         csum(Car, len);
+         csum(Cdr, len);
+         csum(Tag, live);
+         if (getn(hdr+26, 2) != (Sum2 << 8 | Sum1))
+             error(badimg, UNDEF);
+     }
+     Freelist = NIL;
+     for (i = NNODES-1; i >= live; i--) {
+         setcdr(i, Freelist);
+         Freelist = i;
+     }
+     Sweep = NNODES;
+     rehash();
+     initsyms();
+ }
+ 
+ int sat(long v) {
+     return v > MAXNUM? MAXNUM: (int) v;
+ }
+ 
+ long avg(long v) {
+     return Ngc? v / Ngc: 0;
+ }
+ 
+ /*
+  * (gc-stats) returns (collections reclaimed-per-gc peak-live
+  * allocated-per-gc total-pause-ms max-pause-us); counts that do
+  * not fit in a fixnum are reported as MAXNUM.
+  */
+ 
+ int gcstats(void) {
+     long	v[6];
+     int	i, m, n;
+ 
+     v[0] = Ngc;
+     v[1] = avg(Nfreed);
+     v[2] = Peak;
+     v[3] = avg(Nalloc);
+     v[4] = Pauses / 1000;
+     v[5] = Maxpause;
+     n = NIL;
+     for (i=5; i>=0; i--) {
+         save(n);
+         m = mknum(sat(v[i]));
+         n = unsave(1);
+         n = cons(m, n);
+     }
+     return n;
+ }
+ 
+ void gcreport(void) {
+     int	k;
+ 
+     prnum(sat(Ngc));
+     pr(" collections, peak live ");
+     prnum(Peak);
+     pr(", ");
+     prnum(sat(Pauses / 1000));
+     pr(" ms");
+     nl();
+     for (k=0; k<NHIST; k++) {
+         if (0 == Hist[k]) continue;
+         pr(k < NHIST-1? "  < ": " >= ");
+         prnum(sat(1L << (k < NHIST-1? k+1: k)));
+         pr("us ");
+         prnum(sat(Hist[k]));
+         nl();
+     }
+ }
+ 
+ int eqp(int a, int b) {
+     return a == b ||
+         (numberp(a) && numberp(b) && car(a) == car(b));
+ }
+ 
+ int arith(int x) {
+     long	a, b;
+     int	op;
+ 
+     check(x, 3, 3);
+     if (!numberp(cadr(x)) || !numberp(caddr(x))) type(x);
+     a = car(cadr(x));
+     b = car(caddr(x));
+     op = opcode(car(x));
+     if ((ODIV == op || OMOD == op) && 0 == b)
+         error("divide by zero", x);
+     switch (op) {
+     case OPLUS:
+         return mknum(a + b);
+     case OMINUS:
+         return mknum(a - b);
+     case OTIMES:
+         return mknum(a * b);
+     case ODIV:
+         return mknum(a / b);
+     case OMOD:
+         return mknum(a % b);
+     case OLESS:
+         return a < b? S_t: NIL;
+     default:
+         return a == b? S_t: NIL;
+     }
+ }
+ 
+ enum { MHALT = 0, MEXPR, MLIST, MBETA, MRETN, MAPPL, MPRED, MNOTP,
+        MSETQ, MPROG, MTASK };
+ 
+ /*
+  * Coroutines. A task is suspended by moving its part of the
+  * machine stacks, everything above the base of the outermost
+  * eval(), to the heap as a list
+  *
+  *  (acc env stack mstack)		with SHALLOW: (... bsyms bvals)
+  *
+  * where acc is the value to resume with. Tasks holds the suspended
+  * tasks in round-robin order. (yield) switches only in the
+  * outermost eval(), because inner ones have C frames of their own.
+  * A task that returns drops to MTASK, which resumes the next one.
+  * An error at the REPL discards all tasks.
+  */
+ 
+ int seglist(cell *v, int from, int to) {
+     int	n;
+ 
+     n = NIL;
+     while (to > from)
+         n = cons(v[--to], n);
+     return n;
+ }
+ 
+ int mseglist(int from, int to) {
+     int	n, m;
+ 
+     n = NIL;
+     while (to > from) {
+         save(n);
+         m = mknum(Mstack[--to]);
+         n = cons(m, unsave(1));
+     }
+     return n;
+ }
+ 
+ #ifdef SHALLOW
+ 
+ /*
+  * Exchange the saved values on the binding stack with the current
+  * values of their symbols. Walking down restores the outer values
+  * and leaves those of the task in Bval; walking up reinstalls them.
+  */
+ 
+ void swapbind(int up) {
+     int	i, n, v;
+ 
+     for (i = up? 0: Bp-1; i >= 0 && i < Bp; i += up? 1: -1) {
+         if (NIL == Bsym[i]) continue;
+         n = cdr(Bsym[i]);
+         v = car(n);
+         setcar(n, Bval[i]);
+         Bval[i] = v;
+     }
+ }
+ 
+ #endif
+ 
+ int detach(int acc) {
+     int	n;
+ 
+     n = seglist(Stack, 0, Sp);
+     Sp = 0;
+     save(n);
+     save(mseglist(1, Msp));
+     Msp = 1;
+ #ifdef SHALLOW
+     swapbind(0);
+     save(seglist(Bsym, 0, Bp));
+     save(seglist(Bval, 0, Bp));
+     Bp = 0;
+ #endif
+     n = NIL;
+     while (Sp > 0)
+         n = cons(unsave(1), n);
+     n = cons(Env, n);
+     return cons(acc, n);
+ }
+ 
+ int attach(int t) {
+     int	acc, p;
+ 
+     acc = car(t);
+     t = cdr(t);
+     Env = car(t);
+     t = cdr(t);
+     for (p = car(t); p != NIL; p = cdr(p))
+         save(car(p));
+     t = cdr(t);
+     for (p = car(t); p != NIL; p = cdr(p))
+         msave(car(car(p)));
+ #ifdef SHALLOW
+     t = cdr(t);
+     for (p = car(t), t = cadr(t); p != NIL; p = cdr(p), t = cdr(t)) {
+         Bsym[Bp] = car(p);
+         Bval[Bp++] = car(t);
+     }
+     swapbind(1);
+ #endif
+     return acc;
+ }
+ 
+ void enqueue(int t) {
+     int	p;
+ 
+     t = cons(t, NIL);
+     if (NIL == Tasks) {
+         Tasks = t;
+         return;
+     }
+     for (p = Tasks; cdr(p) != NIL; p = cdr(p))
+         ;
+     setcdr(p, t);
+ }
+ 
+ int resume(void) {
+     int	t;
+ 
+     t = car(Tasks);
+     Tasks = cdr(Tasks);
+     return attach(t);
+ }
+ 
+ int spawn(int f) {
+     int	n, m;
+ 
+     n = NIL;
+ #ifdef SHALLOW
+     n = cons(NIL, cons(NIL, NIL));
+ #endif
+     save(n);
+     m = mknum(MBETA);
+     save(cons(m, NIL));
+     m = mknum(MTASK);
+     n = cons(m, unsave(1));
+     n = cons(n, unsave(1));
+     n = cons(NIL, n);
+     n = cons(NIL, n);
+     save(n);
+     n = cons(f, NIL);
+     n = cons(n, unsave(1));
+     enqueue(n);
+     return S_t;
+ }
+ 
+ int yield(void) {
+     if (NIL == Tasks || Depth > 1) return NIL;
+     enqueue(detach(S_t));
+     return resume();
  }
  
  int builtin(int x) {
      char	*s;
  
-     if (S_car == car(x)) {
+     switch (opcode(car(x))) {
+     case OCAR:
          check(x, 2, 2);
          if (atomp(cadr(x))) type(x);
          return caadr(x);
-     }
-     else if (S_cdr == car(x)) {
+     case OCDR:
          check(x, 2, 2);
          if (atomp(cadr(x))) type(x);
          return cdadr(x);
-     }
-     else if (S_eq == car(x)) {
+     case OEQ:
          check(x, 3, 3);
-         return cadr(x) == caddr(x)? S_t: NIL;
-     }
-     else if (S_atom == car(x)) {
+         return eqp(cadr(x), caddr(x))? S_t: NIL;
+     case OATOM:
          check(x, 2, 2);
          return atomp(cadr(x))? S_t: NIL;
-     }
-     else if (S_cons == car(x)) {
+     case OCONS:
          check(x, 3, 3);
          return cons(cadr(x), caddr(x));
-     }
-     else if (S_setcar == car(x)) {
+     case OSETCAR:
          check(x, 3, 3);
          if (atomp(cadr(x))) type(x);
          setcar(cadr(x), caddr(x));
          return cadr(x);
-     }
-     else if (S_setcdr == car(x)) {
+     case OSETCDR:
          check(x, 3, 3);
          if (atomp(cadr(x))) type(x);
          setcdr(cadr(x), caddr(x));
          return cadr(x);
-     }
-     else if (S_gensym == car(x)) {
+     case OGENSYM:
          check(x, 1, 1);
          s = ntoa(++Id);
          s--;
          *s = 'G';
          return addsym(s, UNDEF);
-     }
-     else if (S_eofp == car(x)) {
+     case OEOFP:
          check(x, 2, 2);
          return EOT == cadr(x)? S_t: NIL;
-     }
-     else if (S_read == car(x)) {
+     case OREAD:
          check(x, 1, 1);
          return xread();
-     }
-     else if (S_prin == car(x)) {
+     case OPRIN:
          check(x, 2, 2);
          print(cadr(x));
          pr(" ");
          return cadr(x);
-     }
-     else if (S_prin1 == car(x)) {
+     case OPRIN1:
          check(x, 2, 2);
          print(cadr(x));
          return cadr(x);
-     }
-     else if (S_print == car(x)) {
+     case OPRINT:
          check(x, 2, 2);
          print(cadr(x));
          nl();
          return cadr(x);
-     }
-     else if (S_load == car(x)) {
+     case OLOAD:
          check(x, 2, 2);
          if (!symbolp(cadr(x))) type(x);
          load(symstr(cadr(x)));
          return S_t;
-     }
-     else if (S_error == car(x)) {
+     case OERROR:
          check(x, 2, 3);
          if (!symbolp(cadr(x))) type(x);
          if (NIL == cddr(x))
@@ -812,20 +1561,34 @@
          else
              error(symstr(cadr(x)), caddr(x));
          return UNDEF;
-     }
-     else if (S_gc == car(x)) {
+     case OGC:
          check(x, 1, 2);
          if (cdr(x) != NIL) Verbose_GC = cadr(x) != NIL;
          gc(1);
          return NIL;
-     }
-     else if (S_suspend == car(x)) {
+     case OGCSTATS:
+         check(x, 1, 1);
+         return gcstats();
+     case OPLUS:
+     case OMINUS:
+     case OTIMES:
+     case ODIV:
+     case OMOD:
+     case OLESS:
+     case OEQUAL:
+         return arith(x);
+     case OSUSPEND:
          check(x, 2, 2);
          if (!symbolp(cadr(x))) type(x);
          suspend(symstr(cadr(x)));
          return S_t;
-     }
-     else {
+     case OSPAWN:
+         check(x, 2, 2);
+         return spawn(cadr(x));
+     case OYIELD:
+         check(x, 1, 1);
+         return yield();
+     default:
          syntax(x);
          return UNDEF;
      }
@@ -839,56 +1602,69 @@
          if (!symbolp(car(p))) syntax(x);
  }
  
- enum { MHALT = 0, MEXPR, MLIST, MBETA, MRETN, MAPPL, MPRED, MNOTP,
-        MSETQ, MPROG };
+ /*
+  * With -DTHREADED, eval() jumps from state to state through a table
+  * of label addresses (a GCC extension) instead of going back to the
+  * switch. -DBENCH counts the states visited and reports the rate
+  * on exit.
+  */
+ 
+ #ifdef BENCH
+  long	Steps;
+  #define STEP	Steps++
+ #else
+  #define STEP
+ #endif
+ 
+ #ifdef THREADED
+  #define STATE(s)	case s: L##s:
+  #define NEXT	STEP; if (Error) break; goto *Next[m]
+ #else
+  #define STATE(s)	case s:
+  #define NEXT	STEP; break
+ #endif
  
  int special(int x, int *pm) {
-     if (S_quote == car(x)) {
+     switch (opcode(car(x))) {
+     case OQUOTE:
          check(x, 2, 2);
          *pm = munsave();
          return cadr(x);
-     }
-     else if (S_if == car(x)) {
+     case OIF:
          check(x, 4, 4);
          msave(MPRED);
          *pm = MEXPR;
          save(cddr(x));
          return cadr(x);
-     }
-     else if (S_prog == car(x)) {
+     case OPROG:
          *pm = MEXPR;
          if (NIL == cdr(x)) return NIL;
          if (NIL == cddr(x)) return cadr(x);
          msave(MPROG);
          save(cddr(x));
          return cadr(x);
-     }
-     if (S_ifnot == car(x)) {
+     case OIFNOT:
          check(x, 3, 3);
          msave(MNOTP);
          *pm = MEXPR;
          save(caddr(x));
          return cadr(x);
-     }
-     else if (S_lambda == car(x)) {
+     case OLAMBDA:
          cklam(x);
          *pm = munsave();
          return cons(S_lamstar, cons(Env, cdr(x)));
-     }
-     else if (S_lamstar == car(x)) {
+     case OLAMSTAR:
          check(x, 3, -1);
          *pm = munsave();
          return x;
-     }
-     else if (S_apply == car(x)) {
+     case OAPPLY:
          check(x, 3, 3);
          msave(MAPPL);
          *pm = MEXPR;
          save(caddr(x));
          save(NIL);
          return cadr(x);
-     }
-     else if (S_macro == car(x)) {
+     case OMACRO:
          check(x, 2, 2);
          if (atomp(cadr(x)) || caadr(x) != S_lambda)
              syntax(x);
@@ -897,21 +1673,58 @@
          return cons(S_macro,
              cons(cons(S_lamstar, cons(Env, cdadr(x))),
                   NIL));
-     }
-     else if (S_setq == car(x)) {
+     case OSETQ:
          check(x, 3, 3);
          if (!symbolp(cadr(x))) syntax(x);
          msave(MSETQ);
          *pm = MEXPR;
          save(cadr(x));
          return caddr(x);
-     }
-     else {
+     default:
          syntax(x);
          return UNDEF;
      }
  }
  
+ #ifdef SHALLOW
+ 
+ /*
+  * The binding stack holds (symbol, outer value) pairs.
+  * Each frame starts with a (NIL, NIL) pair.
+  */
+ 
+ void bpush(int v, int a) {
+     if (Bp >= NBIND) error("binding stack overflow", UNDEF);
+     Bsym[Bp] = v;
+     Bval[Bp++] = a;
+ }
+ 
+ void bind(int v, int a) {
+     bpush(v, car(cdr(v)));
+     setcar(cdr(v), a);
+ }
+ 
+ void unbind(void) {
+     while (Bsym[--Bp] != NIL)
+         setcar(cdr(Bsym[Bp]), Bval[Bp]);
+ }
+ 
+ void bindargs(int v, int a) {
+     bpush(NIL, NIL);
+     while (!atomp(v)) {
+         if (NIL == a) error("too few args", Acc);
+         bind(car(v), car(a));
+         v = cdr(v);
+         a = cdr(a);
+     }
+     if (symbolp(v))
+         bind(v, a);
+     else if (a != NIL)
+         error("extra args", Acc);
+ }
+ 
+ #else
+ 
  void bindargs(int v, int a) {
      int	e, n;
  
@@ -920,14 +1733,14 @@
          if (NIL == a) error("too few args", Acc);
          n = cons(car(v), cons(car(a), NIL));
          e = cons(n, e);
-         setcar(Stack, e);
+         Stack[Sp-1] = e;
          v = cdr(v);
          a = cdr(a);
      }
      if (symbolp(v)) {
          n = cons(v, cons(a, NIL));
          e = cons(n, e);
-         setcar(Stack, e);
+         Stack[Sp-1] = e;
      }
      else if (a != NIL) {
          error("extra args", Acc);
@@ -936,25 +1749,40 @@
      unsave(1);
  }
  
+ #endif
+ 
  int funapp(int x) {
      Acc = x;
      if (atomp(car(x)) || caar(x) != S_lamstar)
          syntax(x);
-     if (Mstack != NIL && MRETN == car(Mstack)) {
+     if (Msp > 0 && MRETN == Mstack[Msp-1]) {
+ #ifdef SHALLOW
+         unbind();
+ #else
          Env = cadar(Acc);
+ #endif
          bindargs(caddar(Acc), cdr(Acc));
      }
      else {
+ #ifndef SHALLOW
          save(Env);
          Env = cadar(Acc);
+ #endif
          bindargs(caddar(Acc), cdr(Acc));
          msave(MRETN);
      }
      return cons(S_prog, cdddar(x));
  }
  
+ /*
+  * Expand macros in x. Lambda bodies are expanded along with the
+  * form that creates them, so each macro call is expanded once.
+  * Forms without macro calls are returned as they are; lists get
+  * copied only from the first member that changed.
+  */
+ 
  int expand(int x) {
-     int	n, m, p;
+     int	n, m, p, q;
  
      if (atomp(x)) return x;
      if (S_quote == car(x)) return x;
@@ -967,35 +1795,59 @@
          m = cons(S_apply, m);
          save(m);
          n = eval(m);
-         setcar(Stack, n);
+         Stack[Sp-1] = n;
          n = expand(n);
          unsave(1);
          return n;
      }
      for (p = x; !atomp(p); p = cdr(p))
          ;
-     if (symbolp(p)) return x;
+     if (p != NIL) return x;
      save(x);
-     save(n = NIL);
      for (p = x; p != NIL; p = cdr(p)) {
+         m = expand(car(p));
+         if (m != car(p)) break;
+     }
+     if (NIL == p) {
+         unsave(1);
+         return x;
+     }
+     save(m);
+     save(n = NIL);
+     for (q = x; q != p; q = cdr(q)) {
+         n = cons(car(q), n);
+         Stack[Sp-1] = n;
+     }
+     n = cons(Stack[Sp-2], n);
+     Stack[Sp-1] = n;
+     for (p = cdr(p); p != NIL; p = cdr(p)) {
          m = expand(car(p));
          n = cons(m, n);
-         setcar(Stack, n);
+         Stack[Sp-1] = n;
      }
      n = nrev(unsave(1));
-     unsave(1);
+     unsave(2);
      return n;
  }
  
  int eval(int x) {
      int	n, m;
+ #ifdef THREADED
+     static void	*Next[] = { &&LMHALT, &&LMEXPR, &&LMLIST, &&LMBETA,
+                     &&LMRETN, &&LMAPPL, &&LMPRED, &&LMNOTP,
+                     &&LMSETQ, &&LMPROG, &&LMTASK };
+ #endif
  
+     Depth++;
      Acc = expand(x);
      msave(MHALT);
      m = MEXPR;
+ #ifdef THREADED
+     goto *Next[m];
+ #endif
      for (;0 == Error;) {
          switch (m) {
-         case MEXPR:
+         STATE(MEXPR)
              if (symbolp(Acc)) {
                  n = car(lookup(Acc));
                  if (UNDEF == n)
@@ -1010,30 +1862,33 @@
                  m = MBETA;
              }
              else {
+                 for (n = cdr(Acc); !atomp(n); n = cdr(n))
+                     ;
+                 if (n != NIL) syntax(Acc);
                  save(cdr(Acc));
                  Acc = car(Acc);
                  save(NIL);
                  msave(MLIST);
              }
-             break;
-         case MLIST:
-             if (NIL == cadr(Stack)) {
+             NEXT;
+         STATE(MLIST)
+             if (NIL == Stack[Sp-2]) {
                  Acc = nrev(cons(Acc, unsave(1)));
                  unsave(1);
                  m = MBETA;
              }
              else {
-                 setcar(Stack, cons(Acc, car(Stack)));
-                 Acc = caadr(Stack);
-                 setcar(cdr(Stack), cdadr(Stack));
+                 Stack[Sp-1] = cons(Acc, Stack[Sp-1]);
+                 Acc = car(Stack[Sp-2]);
+                 Stack[Sp-2] = cdr(Stack[Sp-2]);
                  msave(m);
                  m = MEXPR;
              }
-             break;
-         case MAPPL:
-             if (NIL == car(Stack)) {
-                 setcar(Stack, Acc);
-                 Acc = cadr(Stack);
+             NEXT;
+         STATE(MAPPL)
+             if (NIL == Stack[Sp-1]) {
+                 Stack[Sp-1] = Acc;
+                 Acc = Stack[Sp-2];
                  msave(MAPPL);
                  m = MEXPR;
              }
@@ -1043,16 +1898,16 @@
                  Acc = cons(n, Acc);
                  m = MBETA;
              }
-             break;
-         case MPRED:
+             NEXT;
+         STATE(MPRED)
              n = unsave(1);
              if (NIL == Acc)
                  Acc = cadr(n);
              else
                  Acc = car(n);
              m = MEXPR;
-             break;
-         case MNOTP:
+             NEXT;
+         STATE(MNOTP)
              n = unsave(1);
              if (NIL == Acc) {
                  Acc = n;
@@ -1061,8 +1916,8 @@
              else {
                  m = munsave();
              }
-             break;
-         case MBETA:
+             NEXT;
+         STATE(MBETA)
              if (specialp(car(Acc))) {
                  Acc = special(Acc, &m);
              }
@@ -1074,44 +1929,116 @@
                  Acc = funapp(Acc);
                  m = MEXPR;
              }
-             break;
-         case MRETN:
+             NEXT;
+         STATE(MRETN)
+ #ifdef SHALLOW
+             unbind();
+ #else
              Env = unsave(1);
+ #endif
              m = munsave();
-             break;
-         case MSETQ:
+             NEXT;
+         STATE(MSETQ)
              n = unsave(1);
              setcar(lookup(n), Acc);
              Acc = n;
              m = munsave();
-             break;
-         case MPROG:
-             if (NIL == cdar(Stack)) {
+             NEXT;
+         STATE(MPROG)
+             if (NIL == cdr(Stack[Sp-1])) {
                  Acc = car(unsave(1));
                  m = MEXPR;
              }
              else {
-                 Acc = caar(Stack);
-                 setcar(Stack, cdar(Stack));
+                 Acc = car(Stack[Sp-1]);
+                 Stack[Sp-1] = cdr(Stack[Sp-1]);
                  msave(MPROG);
                  m = MEXPR;
              }
-             break;
-         case MHALT:
+             NEXT;
+         STATE(MTASK)
+             if (Tasks != NIL)
+                 Acc = resume();
+             m = munsave();
+             NEXT;
+         STATE(MHALT)
+             Depth--;
              return Acc;
          }
      }
      return NIL;
  }
  
+ int addop(char *s, int v, int op) {
+     int	n;
+ 
+     n = addsym(s, v);
+     Tag[n] |= op << OPSHIFT;
+     return n;
+ }
+ 
+ void initsyms(void) {
+     S_t = addsym("t", SPCL);
+     S_apply = addop("apply", UNDEF, OAPPLY);
+     S_if = addop("if", UNDEF, OIF);
+     S_ifnot = addop("ifnot", UNDEF, OIFNOT);
+     S_lambda = addop("lambda", UNDEF, OLAMBDA);
+     S_lamstar = addop("lambda*", UNDEF, OLAMSTAR);
+     S_macro = addop("macro", UNDEF, OMACRO);
+     S_prog = addop("prog", UNDEF, OPROG);
+     S_quote = addop("quote", UNDEF, OQUOTE);
+     S_qquote = addsym("qquote", UNDEF);
+     S_unquote = addsym("unquote", UNDEF);
+     S_splice = addsym("splice", UNDEF);
+     S_setq = addop("setq", UNDEF, OSETQ);
+     S_it = addsym("it", UNDEF);
+     addop("cons", SPCL, OCONS);
+     addop("car", SPCL, OCAR);
+     addop("cdr", SPCL, OCDR);
+     addop("atom", SPCL, OATOM);
+     addop("eq", SPCL, OEQ);
+     addop("eofp", SPCL, OEOFP);
+     addop("setcar", SPCL, OSETCAR);
+     addop("setcdr", SPCL, OSETCDR);
+     addop("gensym", SPCL, OGENSYM);
+     addop("read", SPCL, OREAD);
+     addop("prin", SPCL, OPRIN);
+     addop("prin1", SPCL, OPRIN1);
+     addop("print", SPCL, OPRINT);
+     addop("error", SPCL, OERROR);
+     addop("load", SPCL, OLOAD);
+     addop("gc", SPCL, OGC);
+     addop("gc-stats", SPCL, OGCSTATS);
+     addop("suspend", SPCL, OSUSPEND);
+     addop("spawn", SPCL, OSPAWN);
+     addop("yield", SPCL, OYIELD);
+     addop("+", SPCL, OPLUS);
+     addop("-", SPCL, OMINUS);
+     addop("*", SPCL, OTIMES);
+     addop("div", SPCL, ODIV);
+     addop("mod", SPCL, OMOD);
+     addop("<", SPCL, OLESS);
+     addop("=", SPCL, OEQUAL);
+ }
+ 
  void init() {
+ #ifdef MAPIMG
+     Align = sysconf(_SC_PAGESIZE);
+     Car = heap(NNODES * sizeof(cell));
+     Cdr = heap(NNODES * sizeof(cell));
+     Tag = heap(NNODES);
+ #else
+     Align = 1;
+ #endif
      Verbose_GC = 0;
      Symbols = NIL;
+     rehash();
      Tmpcar = NIL;
      Tmpcdr = NIL;
      Tmp = NIL;
      Id = 0;
      Freelist = NIL;
+     Sweep = NNODES;
      Input = 0;
      Inbuf = Buffer;
      Inp = Ink = 0;
@@ -1119,58 +2046,59 @@
      Outp = 0;
      Rejected = EOT;
      Parens = 0;
-     Stack = NIL;
-     Mstack = NIL;
+     Sp = Msp = 0;
      Error = 0;
      Env = NIL;
-     S_t = addsym("t", SPCL);
-     S_apply = addsym("apply", UNDEF);
-     S_if = addsym("if", UNDEF);
-     S_ifnot = addsym("ifnot", UNDEF);
-     S_lambda = addsym("lambda", UNDEF);
-     S_lamstar = addsym("lambda*", UNDEF);
-     S_macro = addsym("macro", UNDEF);
-     S_prog = addsym("prog", UNDEF);
-     S_quote = addsym("quote", UNDEF);
-     S_qquote = addsym("qquote", UNDEF);
-     S_unquote = addsym("unquote", UNDEF);
-     S_splice = addsym("splice", UNDEF);
-     S_setq = addsym("setq", UNDEF);
-     S_it = addsym("it", UNDEF);
-     S_cons = addsym("cons", SPCL);
-     S_car = addsym("car", SPCL);
-     S_cdr = addsym("cdr", SPCL);
-     S_atom = addsym("atom", SPCL);
-     S_eq = addsym("eq", SPCL);
-     S_eofp = addsym("eofp", SPCL);
-     S_setcar = addsym("setcar", SPCL);
-     S_setcdr = addsym("setcdr", SPCL);
-     S_gensym = addsym("gensym", SPCL);
-     S_read = addsym("read", SPCL);
-     S_prin = addsym("prin", SPCL);
-     S_prin1 = addsym("prin1", SPCL);
-     S_print = addsym("print", SPCL);
-     S_error = addsym("error", SPCL);
-     S_load = addsym("load", SPCL);
-     S_gc = addsym("gc", SPCL);
-     S_suspend = addsym("suspend", SPCL);
+     Tasks = NIL;
+     Depth = 0;
+ #ifdef SHALLOW
+     Bp = 0;
+ #endif
+     initsyms();
  }
  
  void kbint(int x) { Error = 1; }
  int kbbrk(void) { return Error = 1; }
  
+ #ifdef BENCH
+ 
+ clock_t	Start;
+ 
+ void bench(void) {
+     char	buf[100];
+     double	t;
+ 
+     t = (double) (clock() - Start) / CLOCKS_PER_SEC;
+     sprintf(buf, "%ld states in %.2fs, %.0f states/s", Steps, t,
+         t > 0? Steps / t: 0.0);
+     pr(buf);
+     nl();
+ }
+ 
+ #endif
+ 
  int main(int argc, char **argv) {
+ #ifdef BENCH
+     Start = clock();
+ #endif
      init();
      if (CATCH) exit(1);
      fasload(argc>1? argv[1]: "klisp");
+     gcreset();
      CATCH;
      KBDINT;
      for (;;) {
          Parens = 0;
          Loads = 0;
          Error = 0;
+ #ifdef SHALLOW
+         while (Bp > 0)
+             unbind();
+ #endif
+         if (Depth) Tasks = NIL;
          Acc = Env = NIL;
-         Stack = Mstack = NIL;
+         Sp = Msp = 0;
+         Depth = 0;
          pr("* ");
          flush();
          Acc = xread();
@@ -1181,6 +2109,10 @@
          nl();
      }
      nl();
+     if (Verbose_GC) gcreport();
+ #ifdef BENCH
+     bench();
+ #endif
      return 0;
  }
  
\ No newline at end of file
@@ -0,0 +1,8 @@
+; Runs in a fresh Kilo LISP on the image written by klsave.lisp
+
+; Statistics start over in the loaded image.
+(car (gc-stats))
+
+(fact 7)
+data
+(cdr (car (cdr data)))
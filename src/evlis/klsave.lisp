@@ -0,0 +1,7 @@
+; Saves an image for the fasload test in "make test", see klload.lisp
+; The test then sets the checksum of the image to 0xffff, which
+; Fletcher-16 never produces, and expects the image to be rejected.
+
+(setq fact (lambda (n) (if (eq n 0) 1 (* n (fact (- n 1))))))
+(setq data '(a (b . 7) c))
+(suspend 'testimg)
@@ -0,0 +1,32 @@
+; Tests for Kilo LISP, see "make test"
+; An error discards the rest of the input, so it must come last.
+
+; No collection has been counted yet in a fresh image.
+(car (gc-stats))
+
+(car '(1 2))
+(cdr '(a . 5))
+(+ 1 2)
+
+; Recursion as deep as the heap allows with deep binding must also
+; work with SHALLOW.
+(setq count (lambda (n) (if (eq n 0) 0 (+ 1 (count (- n 1))))))
+(count 1000)
+
+; Yield outside of a task, with no other tasks, does nothing.
+(yield)
+
+; Two tasks take turns with each other and with the REPL.
+(setq worker (lambda (name n)
+  (if (eq n 0)
+      (print name)
+      (prog (prin name) (print n) (yield) (worker name (- n 1))))))
+(spawn (lambda () (worker 'a 2)))
+(spawn (lambda () (worker 'b 2)))
+(yield)
+(yield)
+(yield)
+(yield)
+
+; A form with a non-symbol atom in its tail is not an application.
+(car . 5)
@@ -6,53 +6,42 @@
 ;;; WHERE THERE IS NO PUBLIC DOMAIN, THE
 ;;; CREATIVE COMMONS ZERO (CC0) LICENSE APPLIES
 
-(SETQ LIMIT (QUOTE (6 5 5 3 5)))
+(SETQ NIL-ADDR 0)
+(SETQ T-ADDR 1)
 
-(SETQ NIL-ADDR (QUOTE (0)))
-(SETQ T-ADDR (QUOTE (1)))
+(SETQ ADDR 99)
 
-(SETQ ADDR (QUOTE (9 9)))
+(SETQ CELLS NIL)
 
-(SETQ SUCC
-  (LAMBDA (X)
-    (CADR (ASSOC X (QUOTE ((0 1) (1 2) (2 3)
-                           (3 4) (4 5) (5 6)
-                           (6 7) (7 8) (8 9)
-                           (9 0)))))))
+(SETQ SYMLIS (LIST (LIST T (CONS T T-ADDR))))
 
-(SETQ INCR
-  (LAMBDA (X)
-    (LABEL
-      ((LOOP (LAMBDA (X C Y)
-         (COND ((EQ X NIL)
-                 (COND (C (CONS (QUOTE 1) Y)) (T Y)))
-               (C (SETQ INCR-TMP (SUCC (CAR X)))
-                  (LOOP (CDR X)
-                        (EQ INCR-TMP (QUOTE 0))
-                        (CONS INCR-TMP Y)))
-               (T (LOOP (CDR X)
-                        NIL
-                        (CONS (CAR X) Y)))))))
-      (LOOP (REVERSE X) T NIL))))
+(SETQ NUMLIS NIL)
 
-(SETQ NUMBER MAKESYM)
+(SETQ OBLIST NIL)
 
-(SETQ CELLS NIL)
+(SETQ LBL 0)
 
-(SETQ SYMLIS (LIST (LIST T (QUOTE (T 1)))))
+; IN FUNCTION MODE EACH LAMBDA BECOMES A C FUNCTION AND
+; EMIT COLLECTS THE LINES OF THE CURRENT FUNCTION IN OUT.
+; KNOWN MAPS FUNCTIONS THAT CAN BE CALLED DIRECTLY TO THEIR
+; LABELS, PARAMS HOLDS THE VARIABLES OF THE CURRENT LAMBDA.
 
-(SETQ OBLIST NIL)
+(SETQ FUNMODE NIL)
+
+(SETQ OUT NIL)
 
-(SETQ LBL (QUOTE (0)))
+(SETQ KNOWN NIL)
+
+(SETQ PARAMS NIL)
 
 (SETQ MAKE-LABEL
   (LAMBDA ()
-    (SETQ LBL (INCR LBL))
+    (SETQ LBL (PLUS LBL 1))
     LBL))
 
 (SETQ MAKE-CELL
   (LAMBDA (A D TG)
-    (SETQ ADDR (INCR ADDR))
+    (SETQ ADDR (PLUS ADDR 1))
     (SETQ CELLS (CONS (LIST ADDR TG A D) CELLS))
     ADDR))
 
@@ -94,6 +83,43 @@
                              SYMLIS))
                  A))))))
 
+; NUMERALS ARE COMPILED TO NUMBER CELLS IN THE POOL. THE
+; NUMERAL ITSELF IS KEPT IN THE CAR UNTIL INIT-CELLS EMITS IT.
+
+(SETQ DIGITP
+  (LAMBDA (X)
+    (LABEL ((C (*CAR (*CAR X))))
+      (COND ((EQ C (*CAR (*CAR '0))))
+            ((EQ C (*CAR (*CAR '1))))
+            ((EQ C (*CAR (*CAR '2))))
+            ((EQ C (*CAR (*CAR '3))))
+            ((EQ C (*CAR (*CAR '4))))
+            ((EQ C (*CAR (*CAR '5))))
+            ((EQ C (*CAR (*CAR '6))))
+            ((EQ C (*CAR (*CAR '7))))
+            ((EQ C (*CAR (*CAR '8))))
+            ((EQ C (*CAR (*CAR '9))))))))
+
+(SETQ NUMERALP
+  (LAMBDA (X)
+    (COND ((DIGITP X)
+            (LABEL
+              ((LOOP (LAMBDA (X)
+                 (COND ((EQ X NIL))
+                       ((MEMBER (CAR X) *DIGITS)
+                         (LOOP (CDR X)))))))
+              (LOOP (EXPLODE X)))))))
+
+(SETQ ADD-NUMBER
+  (LAMBDA (X)
+    (LABEL ((V (ASSOC X NUMLIS)))
+      (COND (V (CDR V))
+            (T (SETQ OBLIST (CONS (MAKE-CELL X NIL-ADDR 'NUM)
+                                  OBLIST))
+               (SETQ NUMLIS (CONS (CONS X (CAR OBLIST))
+                                  NUMLIS))
+               (CAR OBLIST))))))
+
 (SETQ MAKE-OBJECT
   (LAMBDA (X)
     (COND ((EQ X NIL) NIL-ADDR)
@@ -112,8 +138,8 @@
                                 OBLIST))
              (CAR OBLIST)))))
 
-(SETQ EMIT
-  (LAMBDA X
+(SETQ EMIT-LINE
+  (LAMBDA (X)
     (LABEL
       ((LOOP (LAMBDA (X)
          (COND ((EQ X NIL)
@@ -122,11 +148,56 @@
                   (LOOP (CDR X)))))))
       (LOOP X))))
 
+(SETQ EMIT
+  (LAMBDA X
+    (COND (FUNMODE (SETQ OUT (CONS X OUT)))
+          (T (EMIT-LINE X)))))
+
+(SETQ FLUSH
+  (LAMBDA ()
+    (LABEL
+      ((LOOP (LAMBDA (X)
+         (COND ((EQ X NIL))
+               (T (EMIT-LINE (CAR X))
+                  (LOOP (CDR X)))))))
+      (LOOP (NREVERSE OUT)))
+    (SETQ OUT NIL)))
+
+(SETQ LENGTH
+  (LAMBDA (X)
+    (LABEL
+      ((LOOP (LAMBDA (X N)
+         (COND ((ATOM X) N)
+               (T (LOOP (CDR X) (PLUS N 1)))))))
+      (LOOP X 0))))
+
+; PURE EXPRESSIONS HAVE NO EFFECTS, SO THEY ARE DROPPED
+; WHEN THEIR VALUES ARE NOT USED. CONSTANT IS T FOR TRUE
+; CONSTANTS, NO FOR FALSE ONES, AND NIL OTHERWISE.
+
+(SETQ PUREP
+  (LAMBDA (X)
+    (COND ((ATOM X))
+          ((EQ 'QUOTE (CAR X)))
+          ((EQ 'LAMBDA (CAR X))))))
+
+(SETQ CONSTANT
+  (LAMBDA (X)
+    (COND ((EQ X NIL) 'NO)
+          ((EQ X T))
+          ((ATOM X) (NUMERALP X))
+          ((EQ 'QUOTE (CAR X))
+            (COND ((EQ NIL (CADR X)) 'NO)
+                  (T)))
+          ((EQ 'LAMBDA (CAR X))))))
+
 (SETQ BLOCKCOM
   (LAMBDA (X TA)
      (COND ((EQ X NIL))
            ((EQ (CDR X) NIL)
              (EXPRCOM (CAR X) TA))
+           ((PUREP (CAR X))
+             (BLOCKCOM (CDR X) TA))
            (T (EXPRCOM (CAR X) NIL)
               (BLOCKCOM (CDR X) TA)))))
 
@@ -134,7 +205,9 @@
   (LAMBDA (X TA)
     (COND ((EQ X NIL)
             (EMIT "REF(EXPR) = NIL;"))
-          ((EQ T (CAAR X))
+          ((EQ 'NO (CONSTANT (CAAR X)))
+            (CONDCOM (CDR X) TA))
+          ((CONSTANT (CAAR X))
             (COND ((EQ NIL (CDAR X))
                     (BLOCKCOM (CAR X) TA))
                   (T (BLOCKCOM (CDAR X) TA))))
@@ -155,29 +228,206 @@
   (LAMBDA (X)
     (COND ((NOT (VARSYMP (CADR X)))
             (HALT "SETQ: EXPECTED VARIABLE")))
-    (EXPRCOM (CADDR X) NIL)
+    (LABEL ((K (ASSOC (CADR X) KNOWN)))
+      (COND (K (EMIT "REF(EXPR) = MKFUN("
+                     (FUNDEF (CADDR X) (CDR K) (CADR X))
+                     ");"))
+            ((LAMBDAP (CADDR X))
+              (FUNCOM (CADDR X) (SELFNAME (CADR X))))
+            (T (EXPRCOM (CADDR X) NIL))))
     (EMIT "VAL("
-          (NUMBER (ADD-ATOM (CADR X)))
+          (ADD-ATOM (CADR X))
           ") = REF(EXPR);")))
 
+(SETQ BINDCOM
+  (LAMBDA ()
+    (COND ((EQ PARAMS NIL)
+            (EMIT "ARGN(N, 0);"))
+          ((ATOM PARAMS)
+            (EMIT "RESTARGS(A, N);")
+            (EMIT "BINDARG(0, " (ADD-ATOM PARAMS) ");"))
+          (T (EMIT "ARGN(N, " (LENGTH PARAMS) ");")
+             (LABEL
+               ((LOOP (LAMBDA (P I)
+                  (COND ((EQ P NIL))
+                        (T (EMIT "BINDARG(" I ", "
+                                 (ADD-ATOM (CAR P)) ");")
+                           (LOOP (CDR P) (PLUS I 1)))))))
+               (LOOP PARAMS 0))))))
+
+(SETQ UNBINDCOM
+  (LAMBDA ()
+    (COND ((EQ PARAMS NIL))
+          ((ATOM PARAMS)
+            (EMIT "UNBINDARG(0, " (ADD-ATOM PARAMS) ");"))
+          (T (LABEL
+               ((LOOP (LAMBDA (P I)
+                  (COND ((EQ P NIL))
+                        (T (LOOP (CDR P) (PLUS I 1))
+                           (EMIT "UNBINDARG(" I ", "
+                                 (ADD-ATOM (CAR P)) ");"))))))
+               (LOOP PARAMS 0))))))
+
+(SETQ FUNDEF
+  (LAMBDA (X FUN NAME)
+    (LABEL ((OUT NIL)
+            (PARAMS (CADR X))
+            (SELF NAME)
+            (SELFJMP NIL))
+      (EMIT "VOID F" FUN "(CELL *A, INT N) {")
+      (BINDCOM)
+      (LABEL ((HEAD OUT))
+        (SETQ OUT NIL)
+        (BLOCKCOM (CDDR X) T)
+        (SETQ OUT (NCONC OUT (COND (SELFJMP (CONS (LIST "SELF:") HEAD))
+                                   (T HEAD)))))
+      (UNBINDCOM)
+      (EMIT "ASP = A;")
+      (EMIT "}")
+      (FLUSH))
+    FUN))
+
 (SETQ FUNCOM
-  (LAMBDA (X)
+  (LAMBDA (X NAME)
+    (COND (FUNMODE
+            (EMIT "REF(EXPR) = MKFUN("
+                  (FUNDEF X (MAKE-LABEL) NAME)
+                  ");"))
+          (T (FUNCOM-SW X NAME)))))
+
+(SETQ FUNCOM-SW
+  (LAMBDA (X NAME)
     (LABEL
       ((SKIP (MAKE-LABEL))
-       (FUN  (MAKE-LABEL)))
-      (EMIT "GOTO(" (NUMBER SKIP) ");")
-      (EMIT "LABEL(" (NUMBER FUN) ");")
-      (EMIT "BIND(" (NUMBER (ADD-OBJECT (CADR X))) ");")
+       (FUN  (MAKE-LABEL))
+       (PARAMS (CADR X))
+       (SELF NAME)
+       (SELFLBL (COND (NAME (MAKE-LABEL)))))
+      (EMIT "GOTO(" SKIP ");")
+      (EMIT "LABEL(" FUN ");")
+      (EMIT "BIND(" (ADD-OBJECT (CADR X)) ");")
+      (COND (SELF (EMIT "LABEL(" SELFLBL ");")))
       (BLOCKCOM (CDDR X) T)
       (EMIT "UNBIND();")
       (EMIT "K = RETN(); BREAK;")
-      (EMIT "LABEL(" (NUMBER SKIP) ");")
-      (EMIT "REF(EXPR) = MKFUN(" (NUMBER FUN) ");"))))
+      (EMIT "LABEL(" SKIP ");")
+      (EMIT "REF(EXPR) = MKFUN(" FUN ");"))))
 ;      (EMIT "REF(EXPR) = CONS3(CONS3(FUNTAG, CONS3("
-;            (NUMBER FUN)
+;            FUN
 ;            ", NIL, ATOMTAG), ATOMTAG), NIL, 0);"))))
 
 (SETQ FUNAPP
+  (LAMBDA (X TA)
+    (COND ((SELFCALLP X TA) (SELFCOM X))
+          (FUNMODE (FUNAPP-F X TA))
+          (T (FUNAPP-SW X TA)))))
+
+; A FUNCTION THAT CALLS ITSELF IN TAIL POSITION WITH THE RIGHT
+; NUMBER OF ARGUMENTS JUST ASSIGNS ITS VARIABLES AND JUMPS BACK
+; TO THE START OF ITS BODY. ITS OLD BINDINGS ARE ALREADY SAVED.
+; SELFJMP RECORDS THE JUMP, SO FUNDEF CAN OMIT UNUSED LABELS.
+
+(SETQ SELF NIL)
+
+(SETQ SELFLBL NIL)
+
+(SETQ SELFJMP NIL)
+
+(SETQ SELFNAME
+  (LAMBDA (X)
+    (COND ((MEMBER X SELFOK) X))))
+
+(SETQ SELFCALLP
+  (LAMBDA (X TA)
+    (COND ((EQ TA NIL) NIL)
+          ((EQ SELF NIL) NIL)
+          ((NOT (EQ SELF (CAR X))) NIL)
+          ((EQ PARAMS NIL) (EQ NIL (CDR X)))
+          ((ATOM PARAMS) NIL)
+          ((EQUAL (LENGTH PARAMS) (LENGTH (CDR X)))))))
+
+(SETQ SELFCOM
+  (LAMBDA (X)
+    (LABEL
+      ((LOOP (LAMBDA (A)
+         (COND ((EQ A NIL))
+               (T (EXPRCOM (CAR A) NIL)
+                  (EMIT "PUSHARG();")
+                  (LOOP (CDR A))))))
+       (ASSIGN (LAMBDA (P)
+         (COND ((EQ P NIL))
+               (T (EMIT "VAL(" (ADD-ATOM (CAR P)) ") = POPARG();")
+                  (ASSIGN (CDR P)))))))
+      (LOOP (REVERSE (CDR X)))
+      (ASSIGN PARAMS)
+      (SETQ SELFJMP T)
+      (COND (FUNMODE (EMIT "GOTO SELF;"))
+            (T (EMIT "GOTO(" SELFLBL ");"))))))
+
+; A CALL TO AN INLINED FUNCTION IS REPLACED BY ITS BODY WITH
+; THE ARGUMENTS IN THE PLACES OF THE VARIABLES. WITH MORE THAN
+; ONE ARGUMENT THIS COULD CHANGE THE ORDER OF EVALUATION, SO
+; ALL ARGUMENTS MUST BE PURE.
+
+(SETQ INLINEP
+  (LAMBDA (X)
+    (LABEL ((F (ASSOC (CAR X) INLINES)))
+      (COND ((EQ F NIL) NIL)
+            ((NOT (EQUAL (LENGTH (CADDR F)) (LENGTH (CDR X)))) NIL)
+            ((ATOM (CDDR X)))
+            ((LABEL
+               ((LOOP (LAMBDA (A)
+                  (COND ((EQ A NIL))
+                        ((PUREP (CAR A))
+                          (LOOP (CDR A)))))))
+               (LOOP (CDR X))))))))
+
+(SETQ SUBST
+  (LAMBDA (X B)
+    (COND ((ATOM X)
+            (LABEL ((V (ASSOC X B)))
+              (COND (V (CDR V))
+                    (T X))))
+          ((EQ 'QUOTE (CAR X)) X)
+          (T (CONS (CAR X)
+                   (MAPCAR (LAMBDA (Y) (SUBST Y B))
+                           (CDR X)))))))
+
+(SETQ INLINE
+  (LAMBDA (X)
+    (LABEL ((F (CDR (ASSOC (CAR X) INLINES))))
+      (SUBST (CADDR F) (MAPCAR2 CONS (CADR F) (CDR X))))))
+
+(SETQ KNOWNP
+  (LAMBDA (X)
+    (LABEL ((B (ASSOC X KNOWN)))
+      (COND (B (CDR B))))))
+
+(SETQ FUNAPP-F
+  (LAMBDA (X TA)
+    (LABEL
+      ((M (LENGTH (CDR X)))
+       (K (COND ((ATOM (CAR X))
+                  (KNOWNP (CAR X)))
+                ((EQ 'LAMBDA (CAAR X))
+                  (FUNDEF (CAR X) (MAKE-LABEL) NIL))))
+       (LOOP (LAMBDA (A I)
+         (COND ((EQ A NIL))
+               (T (EXPRCOM (CAR A) NIL)
+                  (EMIT "ASP[-" I "] = REF(EXPR);")
+                  (LOOP (CDR A) (PLUS I 1)))))))
+      (EMIT "ARGS(" M ");")
+      (LOOP (REVERSE (CDR X)) 1)
+      (COND ((EQ K NIL)
+              (EXPRCOM (CAR X) NIL)))
+      (COND (TA (UNBINDCOM)
+                (EMIT "TAILARGS(" M ");")
+                (COND (K (EMIT "F" K "(A, " M "); RETURN;"))
+                      (T (EMIT "FCALL(A, " M "); RETURN;"))))
+            (K (EMIT "ENTER(); F" K "(ASP - " M ", " M "); LEAVE();"))
+            (T (EMIT "ENTER(); FCALL(ASP - " M ", " M "); LEAVE();"))))))
+
+(SETQ FUNAPP-SW
   (LAMBDA (X TA)
     (EMIT "NEWFRAME();")
     (LABEL
@@ -191,36 +441,33 @@
     (COND (TA (EMIT "K = APPLY(-1); BREAK;"))
           (T (LABEL ((RET (MAKE-LABEL)))
                (EMIT "K = APPLY("
-                     (NUMBER RET)
+                     RET
                      "); BREAK;")
                (EMIT "LABEL("
-                     (NUMBER RET) ");"))))))
+                     RET ");"))))))
 
 (SETQ LABCOM
   (LAMBDA (X)
-    (EMIT "NEWFRAME();")
     (LABEL
       ((LOOP (LAMBDA (X)
          (COND ((EQ X NIL))
                (T (COND ((NOT (VARSYMP (CAAR X)))
                           (HALT "LABEL: EXPECTED VARIABLE")))
-                  (SETQ LABCOM-TMP
-                        (NUMBER (ADD-ATOM (CAAR X))))
-                  (EMIT "REF(EXPR) = CONS3("
-                        LABCOM-TMP ", VAL("
-                        LABCOM-TMP "), 0);")
-                 (EMIT "TOFRAME();")
-                 (EXPRCOM (CADAR X) NIL)
-                 (EMIT "VAL("
-                       (NUMBER (ADD-ATOM (CAAR X)))
-                       ") = REF(EXPR);")
-                 (LOOP (CDR X)))))))
-      (LOOP (CADR X)))
-    (EMIT "REF(EXPR) = NIL;")
-    (EMIT "TOFRAME();")
-    (BLOCKCOM (CDDR X) NIL)
-    (EMIT "UNBIND();")
-    (EMIT "POP();")))
+                  (EMIT "PUSHVAL(" (ADD-ATOM (CAAR X)) ");")
+                  (COND ((LAMBDAP (CADAR X))
+                          (FUNCOM (CADAR X) (SELFNAME (CAAR X))))
+                        (T (EXPRCOM (CADAR X) NIL)))
+                  (EMIT "VAL("
+                        (ADD-ATOM (CAAR X))
+                        ") = REF(EXPR);")
+                  (LOOP (CDR X))))))
+       (UNDO (LAMBDA (X)
+         (COND ((EQ X NIL))
+               (T (UNDO (CDR X))
+                  (EMIT "POPVAL(" (ADD-ATOM (CAAR X)) ");"))))))
+      (LOOP (CADR X))
+      (BLOCKCOM (CDDR X) NIL)
+      (UNDO (CADR X)))))
 
 (SETQ CHECKTAG
   (LAMBDA (X)
@@ -246,9 +493,16 @@
 (SETQ TWOARGS
   (LAMBDA (X)
     (EXPRCOM (CADDR X) NIL)
-    (EMIT "PUSH();")
+    (EMIT (COND (FUNMODE "PUSHARG();")
+                (T "PUSH();")))
     (EXPRCOM (CADR X) NIL)
-    (EMIT "REF(EXPR2) = POP();")))
+    (EMIT (COND (FUNMODE "REF(EXPR2) = POPARG();")
+                (T "REF(EXPR2) = POP();")))))
+
+(SETQ ARITHCOM
+  (LAMBDA (X OP)
+    (TWOARGS X)
+    (EMIT "REF(EXPR) = ARITH('" OP "');")))
 
 (SETQ EXPRCOM
   (LAMBDA (X TA)
@@ -259,22 +513,23 @@
           ((EQ '*POOL X)
             (EMIT "REF(EXPR) = 0;"))
           ((EQ '*LIMIT X)
-            (EMIT "REF(EXPR) = "
-                  (NUMBER LIMIT) ";"))
+            (EMIT "REF(EXPR) = LIMIT;"))
+          ((NUMERALP X)
+            (EMIT "REF(EXPR) = " (ADD-NUMBER X) ";"))
           ((ATOM X)
             (EMIT "REF(EXPR) = VAL("
-                  (NUMBER (ADD-ATOM X)) ");"))
+                  (ADD-ATOM X) ");"))
           ((EQ 'COND (CAR X))
             (CONDCOM (CDR X) TA))
           ((EQ 'LABEL (CAR X))
             (LABCOM X))
           ((EQ 'LAMBDA (CAR X))
-            (FUNCOM X))
+            (FUNCOM X NIL))
           ((EQ 'PROGN (CAR X))
             (BLOCKCOM (CDR X) TA))
           ((EQ 'QUOTE (CAR X))
             (EMIT "REF(EXPR) = "
-                  (NUMBER (ADD-OBJECT (CADR X)))
+                  (ADD-OBJECT (CADR X))
                   ";"))
           ((EQ 'SETQ (CAR X))
             (SETQCOM X))
@@ -283,11 +538,11 @@
             (EMIT "REF(EXPR) = ATOMIC()? TRUE: NIL;"))
           ((EQ 'CAR (CAR X))
             (EXPRCOM (CADR X) NIL)
-            (EMIT "IF (SYMBOLIC()) CAR_ERR();")
+            (EMIT "IF (NUMERIC() || SYMBOLIC()) CAR_ERR();")
             (EMIT "REF(EXPR) = CAR[REF(EXPR)];"))
           ((EQ 'CDR (CAR X))
             (EXPRCOM (CADR X) NIL)
-            (EMIT "IF (SYMBOLIC()) CDR_ERR();")
+            (EMIT "IF (NUMERIC() || SYMBOLIC()) CDR_ERR();")
             (EMIT "REF(EXPR) = CDR[REF(EXPR)];"))
           ((EQ 'CONS (CAR X))
             (TWOARGS X)
@@ -297,10 +552,24 @@
             (TWOARGS X)
             (EMIT "REF(EXPR) = REF(EXPR) == REF(EXPR2)? "
                   "TRUE: NIL;"))
+          ((EQ 'NUMBERP (CAR X))
+            (EXPRCOM (CADR X) NIL)
+            (EMIT "REF(EXPR) = NUMERIC()? TRUE: NIL;"))
+          ((EQ 'PLUS (CAR X))
+            (ARITHCOM X "+"))
+          ((EQ 'DIFFERENCE (CAR X))
+            (ARITHCOM X "-"))
+          ((EQ 'TIMES (CAR X))
+            (ARITHCOM X "*"))
+          ((EQ 'QUOTIENT (CAR X))
+            (ARITHCOM X "/"))
+          ((EQ 'REMAINDER (CAR X))
+            (ARITHCOM X "%"))
+          ((EQ 'LESSP (CAR X))
+            (ARITHCOM X "<"))
           ((EQ '*HALT (CAR X))
             (EXPRCOM (CADR X) NIL)
-            (EMIT "HALT(ATOMNAME(REF(EXPR)), "
-                  (NUMBER LIMIT) ");"))
+            (EMIT "HALT(ATOMNAME(REF(EXPR)), LIMIT);"))
           ((MEMBER (CAR X) '(*ATOMP *MARKP *TRAVP))
             (CHECKTAG X))
           ((EQ '*CAR (CAR X))
@@ -323,6 +592,10 @@
             (SETTAG X))
           ((EQ '*READC (CAR X))
             (EMIT "REF(EXPR) = READC();"))
+          ((EQ '*PEEKC (CAR X))
+            (EMIT "REF(EXPR) = PEEKC();"))
+          ((EQ '*READ (CAR X))
+            (EMIT "REF(EXPR) = RDOBJ();"))
           ((EQ '*RPLACA (CAR X))
             (TWOARGS X)
             (EMIT "CAR[REF(EXPR)] = REF(EXPR2);"))
@@ -334,6 +607,8 @@
             (EMIT "WRITEC(REF(EXPR));"))
           ((NOT (ATOM (CAR X)))
             (FUNAPP X NIL))
+          ((INLINEP X)
+            (EXPRCOM (INLINE X) TA))
           (T (FUNAPP X TA)))))
 
 (SETQ PROLOG
@@ -352,7 +627,7 @@
     (LABEL
       ((LOOP (LAMBDA (OL A)
          (COND ((EQ OL NIL)
-                 (EMIT "REF(OBLIST) = " (NUMBER A) ";"))
+                 (EMIT "REF(OBLIST) = " A ";"))
                (T (LOOP (CDR OL) (MAKE-CELL (CAR OL) A NIL)))))))
       (LOOP OBLIST NIL-ADDR))))
 
@@ -367,12 +642,14 @@
   (LAMBDA ()
     (LABEL
       ((INIT (LAMBDA (N)
-         (LABEL ((X (NUMBER (CAAR N)))
-                 (A (COND ((ATOM (CAR (CDDAR N)))
-                            (CHAR (CAR (CDDAR N))))
-                          (T (NUMBER (CAR (CDDAR N))))))
-                 (D (NUMBER (CADR (CDDAR N))))
-                 (F (COND ((CADAR N) "ATOMTAG") (T "0"))))
+         (LABEL ((X (CAAR N))
+                 (A (COND ((EQ (CADAR N) 'NUM) (CAR (CDDAR N)))
+                          ((NUMBERP (CAR (CDDAR N))) (CAR (CDDAR N)))
+                          (T (CHAR (CAR (CDDAR N))))))
+                 (D (CADR (CDDAR N)))
+                 (F (COND ((EQ (CADAR N) 'NUM) "NUMTAG")
+                          ((CADAR N) "ATOMTAG")
+                          (T "0"))))
            (EMIT "CAR[" X "] = " A "; "
                  "CDR[" X "] = " D "; "
                  "TAG[" X "] = " F ";"))))
@@ -386,23 +663,28 @@
   (LAMBDA ()
     (EMIT "RETURN;")
     (EMIT "}}")
+    (SETUPCOM)))
+
+(SETQ SETUPCOM
+  (LAMBDA ()
     (EMIT)
     (EMIT "VOID SETUP(VOID) {")
 ;    (EMIT "REF(SYMLIS) = "
-;          (NUMBER (MAKE-OBJECT (MAPCAR CAR SYMLIS))) ";"))
+;          (MAKE-OBJECT (MAPCAR CAR SYMLIS)) ";"))
 ;    (LABEL
 ;      ((Y (RREDUCE APPEND NIL (MAPCAR CDR SYMLIS))))
 ;      (EMIT "REF(SYMLIS) = "
-;            (NUMBER (MAKE-OBJECT (MAPCAR CAR Y)))
+;            (MAKE-OBJECT (MAPCAR CAR Y))
 ;            ";"))
     (LABEL
       ((Y (MAPCAR (LAMBDA (X)
                     (CONS (CAR X) (MAPCAR CAR (CDR X))))
                   SYMLIS)))
       (EMIT "REF(SYMLIS) = "
-            (NUMBER (MAKE-OBJECT Y))
+            (MAKE-OBJECT Y)
             ";"))
     (EMIT-OBLIST)
+    (EMIT "POOL(" ADDR ");")
     (INIT-CELLS)
     (EMIT "}")))
 
@@ -410,29 +692,305 @@
   (LAMBDA ()
     (EMIT "/******** POOL DUMP FOLLOWS ********")
     (MAPCAR (LAMBDA (X)
-              (PRIN1 (NUMBER (CAR X)))
+              (PRIN1 (CAR X))
               (PRIN1 " ")
-              (PRIN1 (COND ((CADR X) "A") (T "-")))
+              (PRIN1 (COND ((EQ (CADR X) 'NUM) "N")
+                           ((CADR X) "A")
+                           (T "-")))
               (PRIN1 " ")
-              (PRIN1 (COND ((ATOM (CADDR X))
-                             (CADDR X))
-                           (T (NUMBER (CADDR X)))))
+              (PRIN1 (CADDR X))
               (PRIN1 " ")
-              (PRIN1 (NUMBER (CADDR (CDR X))))
+              (PRIN1 (CADDR (CDR X)))
               (TERPRI))
             CELLS)
     (EMIT "***********************************/")))
 
+;;; PROGRAM ANALYSIS
+
+; A TOP-LEVEL (SETQ F (LAMBDA ...)) IS A DEFINITION WHEN F IS
+; NEITHER ASSIGNED AGAIN NOR BOUND ANYWHERE ELSE. DEFINED
+; FUNCTIONS CAN BE CALLED DIRECTLY IN FUNCTION MODE, AND SMALL
+; ONES ARE INLINED. A FUNCTION BOUND BY LABEL MAY JUMP TO ITSELF
+; IN TAIL POSITION WHEN ITS NAME IS ONLY EVER CALLED, NEVER
+; ASSIGNED, AND NEVER USED AS A LAMBDA VARIABLE.
+
+(SETQ SEEN NIL)
+
+(SETQ BAD NIL)
+
+(SETQ VARS NIL)
+
+(SETQ LABFUNS NIL)
+
+(SETQ REFS NIL)
+
+(SETQ DEFS NIL)
+
+(SETQ INLINES NIL)
+
+(SETQ SELFOK NIL)
+
+(SETQ PRIMS '(ATOM CAR CDR CONS EQ))
+
+(SETQ SCAN-VARS
+  (LAMBDA (X)
+    (COND ((EQ X NIL))
+          ((ATOM X)
+            (SETQ BAD (CONS X BAD))
+            (SETQ VARS (CONS X VARS)))
+          (T (SETQ BAD (CONS (CAR X) BAD))
+             (SETQ VARS (CONS (CAR X) VARS))
+             (SCAN-VARS (CDR X))))))
+
+(SETQ SCAN-LIST
+  (LAMBDA (X)
+    (COND ((ATOM X))
+          (T (SCAN (CAR X))
+             (SCAN-LIST (CDR X))))))
+
+(SETQ SCAN
+  (LAMBDA (X)
+    (COND ((ATOM X))
+          ((EQ 'QUOTE (CAR X)))
+          ((EQ 'SETQ (CAR X))
+            (COND ((MEMBER (CADR X) SEEN)
+                    (SETQ BAD (CONS (CADR X) BAD)))
+                  (T (SETQ SEEN (CONS (CADR X) SEEN))))
+            (SCAN (CADDR X)))
+          ((EQ 'LAMBDA (CAR X))
+            (SCAN-VARS (CADR X))
+            (SCAN-LIST (CDDR X)))
+          ((EQ 'LABEL (CAR X))
+            (LABEL
+              ((LOOP (LAMBDA (B)
+                 (COND ((EQ B NIL))
+                       (T (SETQ BAD (CONS (CAAR B) BAD))
+                          (COND ((LAMBDAP (CADAR B))
+                                  (SETQ LABFUNS
+                                        (CONS (CAAR B) LABFUNS))))
+                          (SCAN (CADAR B))
+                          (LOOP (CDR B)))))))
+              (LOOP (CADR X)))
+            (SCAN-LIST (CDDR X)))
+          (T (SCAN-LIST X)))))
+
+; REMOVE LABEL FUNCTIONS WHOSE NAMES ARE USED AS VALUES
+
+(SETQ SCAN-REFS-LIST
+  (LAMBDA (X)
+    (COND ((ATOM X))
+          (T (SCAN-REFS (CAR X))
+             (SCAN-REFS-LIST (CDR X))))))
+
+(SETQ SCAN-REFS
+  (LAMBDA (X)
+    (COND ((ATOM X)
+            (COND ((MEMBER X LABFUNS)
+                    (SETQ REFS (CONS X REFS)))))
+          ((EQ 'QUOTE (CAR X)))
+          ((EQ 'COND (CAR X))
+            (LABEL
+              ((LOOP (LAMBDA (C)
+                 (COND ((ATOM C))
+                       (T (SCAN-REFS-LIST (CAR C))
+                          (LOOP (CDR C)))))))
+              (LOOP (CDR X))))
+          ((EQ 'LAMBDA (CAR X))
+            (SCAN-REFS-LIST (CDDR X)))
+          ((EQ 'LABEL (CAR X))
+            (LABEL
+              ((LOOP (LAMBDA (B)
+                 (COND ((ATOM B))
+                       (T (SCAN-REFS (CADAR B))
+                          (LOOP (CDR B)))))))
+              (LOOP (CADR X)))
+            (SCAN-REFS-LIST (CDDR X)))
+          ((EQ 'SETQ (CAR X))
+            (SCAN-REFS (CADDR X)))
+          ((ATOM (CAR X))
+            (SCAN-REFS-LIST (CDR X)))
+          (T (SCAN-REFS-LIST X)))))
+
+(SETQ LAMBDAP
+  (LAMBDA (X)
+    (COND ((ATOM X) NIL)
+          ((EQ 'LAMBDA (CAR X))))))
+
+(SETQ DEFP
+  (LAMBDA (X)
+    (COND ((ATOM X) NIL)
+          ((NOT (EQ 'SETQ (CAR X))) NIL)
+          ((NOT (LAMBDAP (CADDR X))) NIL)
+          ((NOT (MEMBER (CADR X) BAD))))))
+
+(SETQ FIND-DEFS
+  (LAMBDA (P)
+    (COND ((EQ P NIL))
+          ((DEFP (CAR P))
+            (SETQ DEFS (CONS (CONS (CADAR P) (CADDR (CAR P)))
+                             DEFS))
+            (FIND-DEFS (CDR P)))
+          (T (FIND-DEFS (CDR P))))))
+
+(SETQ FIND-SELFOK
+  (LAMBDA (L)
+    (COND ((EQ L NIL))
+          ((MEMBER (CAR L) SELFOK)
+            (FIND-SELFOK (CDR L)))
+          ((MEMBER (CAR L) SEEN)
+            (FIND-SELFOK (CDR L)))
+          ((MEMBER (CAR L) VARS)
+            (FIND-SELFOK (CDR L)))
+          ((MEMBER (CAR L) REFS)
+            (FIND-SELFOK (CDR L)))
+          (T (SETQ SELFOK (CONS (CAR L) SELFOK))
+             (FIND-SELFOK (CDR L))))))
+
+; A DEFINED FUNCTION IS INLINED WHEN ITS BODY IS A SINGLE
+; EXPRESSION MADE OF PRIMITIVES, CONSTANTS, AND ITS VARIABLES,
+; AND EACH VARIABLE IS USED EXACTLY ONCE.
+
+(SETQ SIMPLEP
+  (LAMBDA (X V)
+    (COND ((EQ X NIL))
+          ((EQ X T))
+          ((ATOM X) (MEMBER X V))
+          ((EQ 'QUOTE (CAR X)))
+          ((MEMBER (CAR X) PRIMS)
+            (LABEL
+              ((LOOP (LAMBDA (A)
+                 (COND ((EQ A NIL))
+                       ((SIMPLEP (CAR A) V)
+                         (LOOP (CDR A)))))))
+              (LOOP (CDR X)))))))
+
+(SETQ USES
+  (LAMBDA (V X)
+    (COND ((EQ V X) 1)
+          ((ATOM X) 0)
+          ((EQ 'QUOTE (CAR X)) 0)
+          (T (LABEL
+               ((LOOP (LAMBDA (A N)
+                  (COND ((EQ A NIL) N)
+                        (T (LOOP (CDR A)
+                                 (PLUS N (USES V (CAR A)))))))))
+               (LOOP (CDR X) 0))))))
+
+(SETQ INLINABLEP
+  (LAMBDA (F)
+    (LABEL
+      ((V (CADR F))
+       (LOOP (LAMBDA (P)
+         (COND ((EQ P NIL))
+               ((ATOM P) NIL)
+               ((EQUAL 1 (USES (CAR P) (CADDR F)))
+                 (LOOP (CDR P)))))))
+      (COND ((ATOM (CDDR F)) NIL)
+            ((CDDDR F) NIL)
+            ((ATOM V)
+              (COND ((EQ V NIL) (SIMPLEP (CADDR F) V))))
+            ((NOT (SIMPLEP (CADDR F) V)) NIL)
+            ((LOOP V))))))
+
+(SETQ FIND-INLINES
+  (LAMBDA (P)
+    (COND ((EQ P NIL))
+          ((ATOM (CAR P))
+            (FIND-INLINES (CDR P)))
+          ((NOT (EQ 'SETQ (CAAR P)))
+            (FIND-INLINES (CDR P)))
+          ((MEMBER (CADAR P) BAD)
+            (FIND-INLINES (CDR P)))
+          ((LAMBDAP (CADDR (CAR P)))
+            (COND ((INLINABLEP (CADDR (CAR P)))
+                    (SETQ INLINES (CONS (CONS (CADAR P)
+                                              (CADDR (CAR P)))
+                                        INLINES))))
+            (FIND-INLINES (CDR P)))
+          ((ATOM (CADDR (CAR P)))
+            (LABEL ((F (ASSOC (CADDR (CAR P)) INLINES)))
+              (COND (F (SETQ INLINES (CONS (CONS (CADAR P) (CDR F))
+                                           INLINES)))))
+            (FIND-INLINES (CDR P)))
+          (T (FIND-INLINES (CDR P))))))
+
+(SETQ ANALYZE
+  (LAMBDA (P)
+    (SCAN-LIST P)
+    (SCAN-REFS-LIST P)
+    (FIND-DEFS P)
+    (FIND-SELFOK LABFUNS)
+    (SETQ SELFOK (APPEND (MAPCAR CAR DEFS) SELFOK))
+    (FIND-INLINES P)))
+
+(SETQ PROLOG-F
+  (LAMBDA ()
+    (EMIT)
+    (EMIT "/******** LISCMP OUTPUT FOLLOWS ********/")
+    (EMIT)
+    (LABEL
+      ((LOOP (LAMBDA (K)
+         (COND ((EQ K NIL))
+               (T (EMIT "VOID F" (CDAR K) "(CELL *, INT);")
+                  (LOOP (CDR K)))))))
+      (LOOP KNOWN))))
+
+(SETQ EPILOG-F
+  (LAMBDA ()
+    (EMIT)
+    (EMIT "VOID (*FTAB[])(CELL *, INT) = {")
+    (EMIT "0,")
+    (LABEL
+      ((LOOP (LAMBDA (K)
+         (COND ((LESSP LBL K))
+               (T (EMIT "F" K ",")
+                  (LOOP (PLUS K 1)))))))
+      (LOOP 1))
+    (EMIT "};")
+    (EMIT)
+    (EMIT "VOID RUN(VOID) {")
+    (EMIT "FUNTAB = FTAB;")
+    (EMIT "SETUP();")
+    (FLUSH)
+    (EMIT "}")
+    (SETUPCOM)))
+
+; THE WHOLE PROGRAM IS READ AND ANALYZED BEFORE ANY CODE IS
+; EMITTED. IN FUNCTION MODE EACH DEFINED FUNCTION IS GIVEN ITS
+; LABEL IN ADVANCE, SO THAT CALLS TO FUNCTIONS DEFINED LATER
+; CAN BE COMPILED DIRECTLY.
+
+(SETQ COMPILE-ALL
+  (LAMBDA (P)
+    (COND ((EQ P NIL))
+          (T (EXPRCOM (CAR P) NIL)
+             (COMPILE-ALL (CDR P))))))
+
+(SETQ LISCMP-F
+  (LAMBDA (P)
+    (SETQ KNOWN (MAPCAR (LAMBDA (D) (CONS (CAR D) (MAKE-LABEL)))
+                        DEFS))
+    (PROLOG-F)
+    (SETQ FUNMODE T)
+    (COMPILE-ALL P)
+    (SETQ FUNMODE NIL)
+    (EPILOG-F)))
+
 (SETQ LISCMP
   (LAMBDA ()
-    (PROLOG)
     (LABEL
-      ((LOOP (LAMBDA (X)
-         (COND ((EQ (QUOTE *STOP) X))
-               (T (EXPRCOM X NIL)
-                  (LOOP (READ)))))))
-      (LOOP (READ)))
-    (EPILOG)
+      ((LOOP (LAMBDA (X P)
+         (COND ((EQ (QUOTE *STOP) X)
+                 (NREVERSE P))
+               (T (LOOP (READ) (CONS X P))))))
+       (X (READ))
+       (F (EQ '*FUNCTIONS X))
+       (P (LOOP (COND (F (READ)) (T X)) NIL)))
+      (ANALYZE P)
+      (COND (F (LISCMP-F P))
+            (T (PROLOG)
+               (COMPILE-ALL P)
+               (EPILOG))))
     (DUMP-POOL)))
 
 (LISCMP)
@@ -5,59 +5,37 @@
 ;;;
 ;;; Where there is no public domain, the
 ;;; Creative Commons Zero (CC0) license applies
+;;;
+;;; This bootstrap compiler is no longer maintained and has not
+;;; been tested since native numbers were added. Use "make boot"
+;;; to bootstrap LISCMP from boot.c instead.
 
-(define addr '(1 0 0))
-
-(define lbl '(0))
-
-(define nil-addr '(0))
-(define t-addr '(1))
-(define limit '(6 5 5 3 5))
+(define addr 100)
 
-(define succ
-  (lambda (x)
-    (cdr (assv x '((0 . 1) (1 . 2) (2 . 3)
-                   (3 . 4) (4 . 5) (5 . 6)
-                   (6 . 7) (7 . 8) (8 . 9)
-                   (9 . 0))))))
-
-(define incr
-  (lambda (x)
-    (let loop ((x (reverse x)) (c #t) (y '()))
-      (cond ((null? x)
-              (if c (cons 1 y) y))
-            (c
-              (let ((d (succ (car x))))
-                (loop (cdr x) (eqv? d 0) (cons d y))))
-            (else
-              (loop (cdr x) #f (cons (car x) y)))))))
-
-(define number
-  (lambda (n)
-    (if (equal? n '(0))
-        0
-        (let loop ((n n) (m 0))
-          (cond ((null? n) m)
-                (else (loop (cdr n) (+ (* m 10) (car n)))))))))
+(define lbl 0)
 
+(define nil-addr 0)
+(define t-addr 1)
 (define cells '())
 
 ; (define symlis '((t 1)))
 
-(define symlis (list (list 't '(t 1))))
+(define symlis (list (list 't (cons 't t-addr))))
+
+(define numlis '())
 
 (define oblist '())
 
 (define make-label
   (lambda ()
-    (set! lbl (incr lbl))
+    (set! lbl (+ lbl 1))
     lbl))
 
 (define make-cell
   (lambda (a d t)
     (set! cells (cons (list addr t a d) cells))
     (let ((n addr))
-      (set! addr (incr addr))
+      (set! addr (+ addr 1))
       n)))
 
 (define make-atom
@@ -135,6 +113,17 @@
               (set! oblist (cons n oblist))
               n)))))
 
+; Numerals are compiled to number cells in the pool.
+
+(define add-number
+  (lambda (x)
+    (cond ((assv x numlis) => cdr)
+          (else
+            (let ((n (make-cell x nil-addr 'num)))
+              (set! oblist (cons n oblist))
+              (set! numlis (cons (cons x n) numlis))
+              n)))))
+
 (define emit
   (lambda x
     (let loop ((x x))
@@ -177,40 +166,33 @@
 
 (define labcom
   (lambda (x)
-    (emit "newframe();")
     (let loop ((x (cadr x)))
       (cond ((null? x))
             (else (if (not (varsymp (caar x)))
                       (*halt "LABEL: EXPECTED VARIABLE"))
-                  (emit "ref(expr) = cons3("
-                        (number (add-atom (caar x)))
-                        ", val("
-                        (number (add-atom (caar x)))
-                        "), 0);")
-                 (emit "toframe();")
-                 (exprcom (cadar x) #f)
-                 (emit "val(" (number (add-atom (caar x)))
-                       ") = ref(expr);")
-                 (loop (cdr x)))))
-    (emit "ref(expr) = nil;")
-    (emit "toframe();")
+                  (emit "pushval(" (add-atom (caar x)) ");")
+                  (exprcom (cadar x) #f)
+                  (emit "val(" (add-atom (caar x))
+                        ") = ref(expr);")
+                  (loop (cdr x)))))
     (blockcom (cddr x) #f)
-    (emit "unbind();")
-    (emit "pop();")))
+    (for-each (lambda (b)
+                (emit "popval(" (add-atom (car b)) ");"))
+              (reverse (cadr x)))))
 
 (define funcom
   (lambda (x ta)
     (let* ((skip (make-label))
            (fun  (make-label)))
-      (emit "goto(" (number skip) ");")
-      (emit "label(" (number fun) ");")
-      (emit "bind(" (number (add-object (cadr x))) ");")
+      (emit "goto(" skip ");")
+      (emit "label(" fun ");")
+      (emit "bind(" (add-object (cadr x)) ");")
       (blockcom (cddr x) #t)
       (emit "unbind();")
       (emit "k = retn(); break;")
-      (emit "label(" (number skip) ");")
-      (emit "ref(expr) = mkfun(" (number fun) ");"))))
-;      (emit "ref(expr) = cons3(cons3(funtag, cons3(" (number fun)
+      (emit "label(" skip ");")
+      (emit "ref(expr) = mkfun(" fun ");"))))
+;      (emit "ref(expr) = cons3(cons3(funtag, cons3(" fun
 ;            ", nil, atomtag), atomtag), nil, 0);"))))
 
 (define atomcom
@@ -243,8 +225,8 @@
     (if ta
         (emit "k = apply(-1); break;")
         (let ((ret (make-label)))
-          (emit "k = apply(" (number ret) "); break;")
-          (emit "label(" (number ret) ");")))))
+          (emit "k = apply(" ret "); break;")
+          (emit "label(" ret ");")))))
 
 (define checktag
   (lambda (x)
@@ -264,6 +246,11 @@
           (m (not (eq? (caddr x) 'nil))))
       (emit "tag[ref(expr)]" (if m " |= " " &= ~") f ";"))))
 
+(define arithcom
+  (lambda (x op)
+    (twoargs x)
+    (emit "ref(expr) = arith('" op "');")))
+
 (define exprcom
   (lambda (x ta)
     (cond ((eq? 'nil x)
@@ -273,16 +260,15 @@
           ((eq? '*pool x)
             (emit "ref(expr) = 0;"))
           ((eq? '*limit x)
-            (emit "ref(expr) = " (number limit) ";"))
+            (emit "ref(expr) = limit;"))
           ((symbol? x)
-            (emit "ref(expr) = val(" (number (add-atom x)) ");"))
+            (emit "ref(expr) = val(" (add-atom x) ");"))
           ((string? x)
             (emit "ref(expr) = "
-                  (number (add-atom (string->symbol (locase x))))
+                  (add-atom (string->symbol (locase x)))
                           ";"))
           ((integer? x)
-            (emit "ref(expr) = "
-                  (number (add-atom (number->symbol x))) ";"))
+            (emit "ref(expr) = " (add-number x) ";"))
           ((eq? 'cond (car x))
             (condcom (cdr x) ta))
           ((eq? 'label (car x))
@@ -292,31 +278,45 @@
           ((eq? 'progn (car x))
             (blockcom (cdr x) ta))
           ((eq? 'quote (car x))
-            (emit "ref(expr) = " (number (add-object (cadr x))) ";"))
+            (emit "ref(expr) = " (add-object (cadr x)) ";"))
           ((eq? 'setq (car x))
             (if (not (varsymp (cadr x)))
                 (*halt "SETQ: EXPECTED VARIABLE"))
             (exprcom (caddr x) #f)
-            (emit "val(" (number (add-atom (cadr x))) ") = ref(expr);"))
+            (emit "val(" (add-atom (cadr x)) ") = ref(expr);"))
           ((eq? 'atom (car x))
             (atomcom x))
           ((eq? 'car (car x))
             (exprcom (cadr x) #f)
-            (emit "if (symbolic()) car_err();")
+            (emit "if (numeric() || symbolic()) car_err();")
             (emit "ref(expr) = car[ref(expr)];"))
           ((eq? 'cdr (car x))
             (exprcom (cadr x) #f)
-            (emit "if (symbolic()) car_err();")
+            (emit "if (numeric() || symbolic()) cdr_err();")
             (emit "ref(expr) = cdr[ref(expr)];"))
           ((eq? 'cons (car x))
             (twoargs x)
             (emit "ref(expr) = cons3(ref(expr), ref(expr2), 0);"))
           ((eq? 'eq (car x))
             (eqcom x))
+          ((eq? 'numberp (car x))
+            (exprcom (cadr x) #f)
+            (emit "ref(expr) = numeric()? true: nil;"))
+          ((eq? 'plus (car x))
+            (arithcom x "+"))
+          ((eq? 'difference (car x))
+            (arithcom x "-"))
+          ((eq? 'times (car x))
+            (arithcom x "*"))
+          ((eq? 'quotient (car x))
+            (arithcom x "/"))
+          ((eq? 'remainder (car x))
+            (arithcom x "%"))
+          ((eq? 'lessp (car x))
+            (arithcom x "<"))
           ((eq? '*halt (car x))
             (exprcom (cadr x) #f)
-            (emit "halt(atomname(ref(expr)), "
-                  (number limit) ");"))
+            (emit "halt(atomname(ref(expr)), limit);"))
           ((memq (car x) '(*atomp *markp *travp))
             (checktag x))
           ((eq? '*car (car x))
@@ -338,6 +338,10 @@
             (settag x))
           ((eq? '*readc (car x))
             (emit "ref(expr) = readc();"))
+          ((eq? '*peekc (car x))
+            (emit "ref(expr) = peekc();"))
+          ((eq? '*read (car x))
+            (emit "ref(expr) = rdobj();"))
           ((eq? '*rplaca (car x))
             (twoargs x)
             (emit "car[ref(expr)] = ref(expr2);"))
@@ -367,7 +371,7 @@
   (lambda ()
     (let loop ((lp oblist) (lplist nil-addr))
       (cond ((null? lp)
-              (emit "ref(oblist) = " (number lplist) ";"))
+              (emit "ref(oblist) = " lplist ";"))
             (else
               (loop (cdr lp) (make-cell (car lp) lplist #f)))))))
 
@@ -376,12 +380,15 @@
     (let loop ((n cells))
       (cond ((null? n))
             (else
-              (let ((x (number (caar n)))
-                    (a (if (pair? (caddar n))
-                           (number (caddar n))
-                           (char->integer (caddar n))))
-                    (d (number (cadddr (car n))))
-                    (f (if (cadar n) "atomtag" "0")))
+              (let ((x (caar n))
+                    (a (if (char? (caddar n))
+                           (char->integer (caddar n))
+                           (caddar n)))
+                    (d (cadddr (car n)))
+                    (f (case (cadar n)
+                         ((num) "numtag")
+                         ((#f) "0")
+                         (else "atomtag"))))
                 (emit "car[" x "] = " a "; "
                       "cdr[" x "] = " d "; "
                       "tag[" x "] = " f ";")
@@ -394,16 +401,17 @@
     (emit "")
     (emit "void setup(void) {")
 ;    (emit "ref(symlis) = "
-;          (number (make-object (map car symlis))) ";"))
+;          (make-object (map car symlis)) ";"))
 ;    (let ((y (fold-right append '() (map cdr symlis))))
 ;      (emit "ref(symlis) = "
-;            (number (make-object (map car y))) ";"))
+;            (make-object (map car y)) ";"))
     (let ((y (map (lambda (x)
                     (cons (car x) (map car (cdr x))))
                   symlis)))  
       (emit "ref(symlis) = "
-            (number (make-object y)) ";"))
+            (make-object y) ";"))
     (emit-oblist)
+    (emit "pool(" (- addr 1) ");")
     (init-cells)
     (emit "}")))
 
@@ -411,15 +419,16 @@
   (lambda ()
     (emit "/******** POOL DUMP FOLLOWS ********")
     (for-each (lambda (x)
-                (display (number (car x)))
+                (display (car x))
                 (display #\space)
-                (display (if (cadr x) "A" "-"))
+                (display (case (cadr x)
+                           ((num) "N")
+                           ((#f) "-")
+                           (else "A")))
                 (display #\space)
-                (display (if (pair? (caddr x))
-                         (number (caddr x))
-                         (caddr x)))
+                (display (caddr x))
                 (display #\space)
-                (display (number (cadddr x)))
+                (display (cadddr x))
                 (newline))
               cells)
     (emit "***********************************/")))
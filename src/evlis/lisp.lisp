@@ -27,6 +27,15 @@
 (SETQ EQ (LAMBDA (X Y) (EQ X Y)))
 (SETQ HALT (LAMBDA (X) (*HALT X)))
 
+(SETQ NUMBERP (LAMBDA (X) (NUMBERP X)))
+(SETQ PLUS (LAMBDA (X Y) (PLUS X Y)))
+(SETQ DIFFERENCE (LAMBDA (X Y) (DIFFERENCE X Y)))
+(SETQ TIMES (LAMBDA (X Y) (TIMES X Y)))
+(SETQ QUOTIENT (LAMBDA (X Y) (QUOTIENT X Y)))
+(SETQ REMAINDER (LAMBDA (X Y) (REMAINDER X Y)))
+(SETQ LESSP (LAMBDA (X Y) (LESSP X Y)))
+(SETQ GREATERP (LAMBDA (X Y) (LESSP Y X)))
+
 (SETQ CAAR (LAMBDA (X) (CAR (CAR X))))
 (SETQ CADR (LAMBDA (X) (CAR (CDR X))))
 (SETQ CDAR (LAMBDA (X) (CDR (CAR X))))
@@ -99,6 +108,11 @@
 (SETQ EQUAL
   (LAMBDA (A B)
     (COND ((EQ A B))
+          ((NUMBERP A)
+            (COND ((NUMBERP B)
+                    (COND ((LESSP A B) NIL)
+                          ((LESSP B A) NIL)
+                          (T)))))
           ((ATOM A) NIL)
           ((ATOM B) NIL)
           ((EQUAL (CAR A) (CAR B))
@@ -172,6 +186,15 @@
                   (PRC (*CDR X))))))
        (PR-ATOM (LAMBDA (X)
          (PRC (*CAR X))))
+       (PR-NUM (LAMBDA (N)
+         (COND ((LESSP N 10))
+               (T (PR-NUM (QUOTIENT N 10))))
+         (SETQ N (REMAINDER N 10))
+         (*WRITEC (COND ((LESSP N 1) '0) ((LESSP N 2) '1)
+                        ((LESSP N 3) '2) ((LESSP N 4) '3)
+                        ((LESSP N 5) '4) ((LESSP N 6) '5)
+                        ((LESSP N 7) '6) ((LESSP N 8) '7)
+                        ((LESSP N 9) '8) (T '9)))))
        (PR-MEM (LAMBDA (X)
          (COND ((EQ X NIL))
                ((ATOM X)
@@ -187,6 +210,8 @@
                  (*WRITEC (QUOTE N))
                  (*WRITEC (QUOTE I))
                  (*WRITEC (QUOTE L)))
+               ((NUMBERP X)
+                 (PR-NUM X))
                ((EQ (*CAR (*CAR X)) *FUNTAG)
                  (PR-ATOM "<FUNCTION>"))
                ((*ATOMP X)
@@ -256,26 +281,17 @@
                               (CAR *SYMLIS)))
                X)))))
 
-(SETQ *PEEKED NIL)
-
 (SETQ PEEKC
   (LAMBDA ()
-    (COND (*PEEKED)
-          (T (SETQ *PEEKED (*READC))
-             (COND ((EQ *PEEKED NIL) NIL)
-                   (T (SETQ *PEEKED
-                            (INTERN (CONS *PEEKED NIL)))
-                      *PEEKED))))))
+    (LABEL ((C (*PEEKC)))
+      (COND ((EQ C NIL) NIL)
+            (T (INTERN (CONS C NIL)))))))
 
 (SETQ READC
   (LAMBDA ()
-    (COND (*PEEKED
-            (LABEL ((C *PEEKED))
-              (SETQ *PEEKED NIL)
-              C))
-          (T (LABEL ((C (*READC)))
-               (COND ((EQ C NIL) NIL)
-                     (T (INTERN (CONS C NIL)))))))))
+    (LABEL ((C (*READC)))
+      (COND ((EQ C NIL) NIL)
+            (T (INTERN (CONS C NIL)))))))
 
 (SETQ MAKESYM
   (LAMBDA (N)
@@ -304,6 +320,8 @@
       (COND ((ATOM N) (EXPL (*CAR N) NIL))
             (T (HALT "EXPLODE: EXPECTED ATOM"))))))
 
+(SETQ *DIGITS (QUOTE (0 1 2 3 4 5 6 7 8 9)))
+
 (SETQ *SYMBOLS
       (QUOTE (A B C D E F G H I
               J K L M N O P Q R
@@ -314,69 +332,11 @@
   (LAMBDA (C)
     (MEMBER C *SYMBOLS)))
 
+; THE READER IS PART OF THE RUNTIME, SEE RDOBJ() IN LISRUN.C.
+
 (SETQ READ
   (LAMBDA ()
-    (LABEL
-      ((SKIPC (LAMBDA (C)
-         (COND ((EQ " " C)
-                 (READC)
-                 (SKIPC (PEEKC)))
-               ((EQ C *NL)
-                 (READC)
-                 (SKIPC (PEEKC)))
-               (T C))))
-       (RD-COMM (LAMBDA (C)
-         (COND ((EQ C *NL))
-               (T (RD-COMM (READC))))))
-       (RD-ATOM (LAMBDA (C A)
-         (COND ((SYMBOLIC C)
-                 (READC)
-                 (RD-ATOM (PEEKC) (CONS C A)))
-               (T (COND ((EQUAL A (QUOTE (L I N))) NIL)
-                        (T (IMPLODE (NREVERSE A))))))))
-       (RD-PSTR (LAMBDA (C A)
-         (COND ((EQ C NIL)
-                 (HALT "UNTERMINATED STRING"))
-               ((EQ C "\"")
-                 (READC)
-                 (LIST (QUOTE QUOTE) (IMPLODE (NREVERSE A))))
-               ((EQ C "\\")
-                 (READC)
-                 (SETQ C (READC))
-                 (RD-PSTR (PEEKC) (CONS C A)))
-               (T (READC)
-                  (RD-PSTR (PEEKC)
-                           (CONS C A))))))
-       (RD-LIST (LAMBDA (C A)
-         (COND ((EQ C NIL)
-                 (HALT "UNTERMINATED LIST"))
-               ((EQ *RP C)
-                 (READC)
-                 (NREVERSE A))
-               (T (SETQ *READ-TMP (RD-OBJ (SKIPC (PEEKC))))
-                  (RD-LIST (SKIPC (PEEKC))
-                           (CONS *READ-TMP A))))))
-       (RD-OBJ (LAMBDA (C)
-         (COND ((EQ C NIL) NIL)
-               ((SYMBOLIC C)
-                 (RD-ATOM C NIL))
-               ((EQ C *LP)
-                 (READC)
-                 (RD-LIST (SKIPC (PEEKC)) NIL))
-               ((EQ C "'")
-                 (READC)
-                 (LIST (QUOTE QUOTE) (RD-OBJ (SKIPC (PEEKC)))))
-               ((EQ C "\"")
-                 (READC)
-                 (RD-PSTR (PEEKC) NIL))
-               ((EQ C ";")
-                 (RD-COMM (READC))
-                 (RD-OBJ (SKIPC (PEEKC))))
-               ((EQ C *RP)
-                 (READC)
-                 (RD-OBJ (SKIPC (PEEKC))))
-               (T (HALT "FUNNY CHARACTER"))))))
-      (RD-OBJ (SKIPC (PEEKC))))))
+    (*READ)))
 
 ;;; DO NOT PLACE A *STOP HERE, FILE WILL BE CONCATENATED
 
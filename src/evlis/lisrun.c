@@ -9,6 +9,7 @@
  */
 
 #include <stdlib.h>
+#include <limits.h>
 #include <string.h>
 #include <ctype.h>
 #include <unistd.h>
@@ -19,14 +20,21 @@ char	inbuf[256];
 int	inptr = 0,
 	inlim = 0;
 
-int rreadc(void) {
+int rpeekc(void) {
 	if (inptr >= inlim) {
 		inlim = read(infd, inbuf, 256);
-		if (inlim < 1) return 0;
 		inptr = 0;
+		if (inlim < 1) return 0;
 	}
-	inptr++;
-	return toupper(inbuf[inptr-1]);
+	return toupper(inbuf[inptr]);
+}
+
+int rreadc(void) {
+	int	c;
+
+	c = rpeekc();
+	if (inptr < inlim) inptr++;
+	return c;
 }
 
 int	outfd = 1;
@@ -62,9 +70,23 @@ void prnum(int n) {
 		prnum2(n);
 }
 
-#define limit	65535
+/*
+ * Cells are 16 bits wide by default, which limits programs
+ * to 64K cells. Compile with -DCELL32 for 32-bit cells; the
+ * number of cells is then taken from the LISCELLS environment
+ * variable at startup (default 1M). Cell indexes are counted
+ * in ints, so there may be at most INT_MAX cells.
+ */
 
-#define cell	unsigned short
+#ifdef CELL32
+ #define cell	unsigned int
+ #define maxnum	2147483647L
+cell	limit = 1048576;
+#else
+ #define cell	unsigned short
+ #define maxnum	65535L
+ #define limit	65535
+#endif
 
 void print2(cell n);
 
@@ -97,12 +119,19 @@ void halt(char *s, cell n) {
 #define atomtag	1
 #define marktag	2
 #define travtag	4
+#define numtag	8
 
+#ifdef CELL32
+cell	*car,
+	*cdr;
+char	*tag;
+#else
 cell	car[limit],
 	cdr[limit];
 char	tag[limit];
+#endif
 
-cell	low = limit;
+cell	low;
 
 void mark(cell n) {
 	cell	p, x;
@@ -125,7 +154,7 @@ void mark(cell n) {
 				n = x;
 			}
 		}
-		else if (tag[n] & atomtag) {
+		else if (tag[n] & (atomtag|numtag)) {
 			x = cdr[n];
 			cdr[n] = p;
 			p = n;
@@ -148,12 +177,36 @@ int	verbose = 0;
 #define ref(x) car[x]
 #define val(x) cdr[x]
 
+/*
+ * Values saved by BIND and LABEL are kept on ARGSTK, where
+ * the collector can find them, and return labels are kept on
+ * RETSTK. In function mode each lambda is compiled to a C
+ * function that finds its arguments on ARGSTK. It swaps them
+ * with the values of its variables on entry and swaps them
+ * back on exit. DEPTH counts the C calls in progress, so
+ * they are limited like return labels in RETSTK.
+ */
+
+#define nargs	32768
+
+cell	argstk[nargs],
+	*asp = argstk;
+
+cell	retstk[nargs],
+	*rsp = retstk;
+
+int	depth = 0;
+
+void	(**funtab)(cell *, int);
+
 int gc(void) {
 	int	i, k;
+	cell	*p;
 
 	k = 0;
 	ref(frelis) = nil;
 	for (i=0; i<=frelis; i++) mark(i);
+	for (p = argstk; p < asp; p++) mark(*p);
 	for (i=0; i<limit; i++) {
 		if (0 == (tag[i] & marktag)) {
 			cdr[i] = ref(frelis);
@@ -190,6 +243,17 @@ cell cons3(cell a, cell d, cell t) {
 	return n;
 }
 
+/*
+ * A number is a single cell tagged NUMTAG that holds
+ * its value in the car field, so numbers range from
+ * 0 to MAXNUM.
+ */
+
+cell mknum(long n) {
+	if (n < 0 || n > maxnum) halt("NUMBER OUT OF RANGE", limit);
+	return cons3(n, nil, numtag);
+}
+
 cell mkfun(int k) {
 	return cons3(cons3(funtag, cons3(k, nil, atomtag),
 				atomtag),
@@ -266,6 +330,14 @@ cell readc(void) {
 	return cons3(c, nil, atomtag);
 }
 
+cell peekc(void) {
+	int	c;
+
+	c = rpeekc();
+	if (0 == c) return nil;
+	return cons3(c, nil, atomtag);
+}
+
 void writec(cell x) {
 	if (tag[x] & atomtag)
 		rwritec(car[x]);
@@ -280,6 +352,9 @@ void print2(cell n) {
 	else if (n == true) {
 		pr("T");
 	}
+	else if (tag[n] & numtag) {
+		prnum(car[n]);
+	}
 	else if (tag[n] & atomtag) {
 		pr("<");
 		rwritec(car[n]);
@@ -299,7 +374,7 @@ void print2(cell n) {
 	else {
 		rwritec('(');
 		while (n != nil) {
-			if (n <= 1 || tag[n] & atomtag ||
+			if (n <= 1 || tag[n] & (atomtag|numtag) ||
 			    tag[car[n]] & atomtag)
 			{
 				pr(". ");
@@ -320,6 +395,29 @@ void print(cell n) {
 }
 
 void init(void) {
+#ifdef CELL32
+	char		*s, *e;
+	unsigned long	n;
+
+	if ((s = getenv("LISCELLS")) != NULL) {
+		n = strtoul(s, &e, 10);
+		if (e == s || *e || n < 1024 || n > INT_MAX) {
+			pr("BAD LISCELLS VALUE\n");
+			flush();
+			exit(1);
+		}
+		limit = n;
+	}
+	car = malloc(limit*sizeof(cell));
+	cdr = malloc(limit*sizeof(cell));
+	tag = malloc(limit);
+	if (NULL == car || NULL == cdr || NULL == tag) {
+		pr("NOT ENOUGH MEMORY\n");
+		flush();
+		exit(1);
+	}
+#endif
+	low = limit;
 	memset(car, 0, limit*sizeof(cell));
 	memset(cdr, 0, limit*sizeof(cell));
 	memset(tag, 0, limit);
@@ -337,69 +435,266 @@ void init(void) {
 #define label(x) case x:
 #define goto(x) k = x; break
 #define symbolic() (tag[car[ref(expr)]] & atomtag)
-#define atomic() (ref(expr) <= 1 || symbolic())
-#define unbind() restore(car[ref(stack)])
+#define numeric() (tag[ref(expr)] & numtag)
+#define atomic() (ref(expr) <= 1 || numeric() || symbolic())
+#define unbind() restore()
 #define u(c) toupper(c)
 #define car_err() halt("CAR: EXPECTED LIST", ref(expr));
 #define cdr_err() halt("CDR: EXPECTED LIST", ref(expr));
 
+void args(int m) {
+	if (asp + m > argstk + nargs)
+		halt("ARGUMENT STACK OVERFLOW", limit);
+	while (m--) *asp++ = nil;
+}
+
+/*
+ * BIND pops the argument list off the stack and pushes the
+ * old values of the variables in V, followed by V itself.
+ */
+
 void bind(cell v) {
-	cell	a, p, n;
+	cell	a, p;
 
-	a = cdr[car[ref(stack)]];
+	a = car[ref(stack)];
+	ref(stack) = cdr[ref(stack)];
 	if (tag[car[v]] & atomtag) {
-		cdr[car[ref(stack)]] =
-			cons3(nil, cons3(v, cons3(val(v), a, 0), 0), 0);
+		args(1);
+		asp[-1] = val(v);
 		val(v) = a;
 	}
 	else {
-		for (p = a; p != nil; p = cdr[p]) {
-			if (nil == v) break;
-			n = car[p];
-			car[p] = cons3(car[v], val(car[v]), 0);
-			val(car[v]) = n;
-			v = cdr[v];
+		for (p = v; p != nil; p = cdr[p]) {
+			if (nil == a) break;
+			args(1);
+			asp[-1] = val(car[p]);
+			val(car[p]) = car[a];
+			a = cdr[a];
 		}
-		if (p != nil || v != nil)
+		if (p != nil || a != nil)
 			halt("WRONG NUMBER OF ARGUMENTS", limit);
 	}
+	args(1);
+	asp[-1] = v;
 }
 
-int restore(cell p) {
-	int	k;
+void restore(void) {
+	cell	v, p;
+	int	n;
 
-	k = car[p];
-	if (nil == car[cdr[p]]) {
-		p = cdr[cdr[p]];
-		val(car[p]) = car[cdr[p]];
+	v = *--asp;
+	if (tag[car[v]] & atomtag) {
+		val(v) = *--asp;
+		return;
 	}
-	else {
-		for (p = cdr[p]; p != nil; p = cdr[p])
-			val(car[car[p]]) = cdr[car[p]];
+	for (n = 0, p = v; p != nil; p = cdr[p]) n++;
+	asp -= n;
+	for (p = v; p != nil; p = cdr[p])
+		val(car[p]) = *asp++;
+	asp -= n;
+}
+
+cell arith(int op) {
+	long	a, b;
+
+	if (!numeric())
+		halt("EXPECTED NUMBER", ref(expr));
+	if (!(tag[ref(expr2)] & numtag))
+		halt("EXPECTED NUMBER", ref(expr2));
+	a = car[ref(expr)];
+	b = car[ref(expr2)];
+	if (0 == b && ('/' == op || '%' == op))
+		halt("DIVISION BY ZERO", limit);
+	switch (op) {
+	case '+':	if (b > maxnum - a)
+				halt("NUMBER OUT OF RANGE", limit);
+			return mknum(a + b);
+	case '-':	return mknum(a - b);
+	case '*':	if (a != 0 && b > maxnum / a)
+				halt("NUMBER OUT OF RANGE", limit);
+			return mknum(a * b);
+	case '/':	return mknum(a / b);
+	case '%':	return mknum(a % b);
+	default:	return a < b? true: nil;
 	}
-	return k;
 }
 
-int apply(int n) {
-	if (!symbolic() || car[car[ref(expr)]] != funtag)
+int fnlabel(void) {
+	if (numeric() || !symbolic() || car[car[ref(expr)]] != funtag)
 		halt("APPLICATION OF NON-FUNCTION", ref(expr));
+	return car[cdr[car[ref(expr)]]];
+}
+
+int apply(int n) {
+	int	k;
+
+	k = fnlabel();
 	if (n < 0) {
-		car[ref(stack)] = cons3(restore(car[cdr[ref(stack)]]),
-					car[ref(stack)], 0);
-		cdr[ref(stack)] = cdr[cdr[ref(stack)]];
+		restore();
 	}
 	else {
-		car[ref(stack)] = cons3(n, car[ref(stack)], atomtag);
+		if (rsp >= retstk + nargs)
+			halt("RETURN STACK OVERFLOW", limit);
+		*rsp++ = n;
 	}
-	return car[cdr[car[ref(expr)]]];
+	return k;
 }
 
 int retn(void) {
-	int	k;
+	return *--rsp;
+}
 
-	k = car[car[ref(stack)]];
-	ref(stack) = cdr[ref(stack)];
-	return k;
+#define pusharg() (args(1), asp[-1] = ref(expr))
+#define poparg() (*--asp)
+#define pushval(v) (args(1), asp[-1] = val(v))
+#define popval(v) val(v) = *--asp
+#define argn(n, m) \
+	if ((n) != (m)) halt("WRONG NUMBER OF ARGUMENTS", limit)
+#define bindarg(i, v) { cell t = val(v); val(v) = a[i]; a[i] = t; }
+#define unbindarg(i, v) val(v) = a[i]
+#define tailargs(m) \
+	(memmove(a, asp - (m), (m) * sizeof(cell)), asp = a + (m))
+#define fcall(p, m) funtab[fnlabel()](p, m)
+#define enter() \
+	if (++depth >= nargs) halt("RETURN STACK OVERFLOW", limit)
+#define leave() depth--
+
+void restargs(cell *a, int n) {
+	ref(expr) = nil;
+	while (n--)
+		ref(expr) = cons3(a[n], ref(expr), 0);
+	asp = a;
+	args(1);
+	a[0] = ref(expr);
+}
+
+void pool(cell n) {
+	if (n >= limit) halt("POOL DOES NOT FIT INTO MEMORY", limit);
+}
+
+/*
+ * The reader works on characters in INBUF and interns
+ * symbols directly, so reading a known symbol allocates
+ * nothing. The list being read is kept on ARGSTK.
+ */
+
+#define maxtok	1024
+
+cell	token[maxtok];
+cell	qname[] = { 'Q', 'U', 'O', 'T', 'E' };
+
+cell intern(cell *s, int k) {
+	cell	b, p, n, c;
+	int	i;
+
+	c = k? s[0]: 0;
+	for (b = ref(symlis); b != nil; b = cdr[b]) {
+		n = car[car[car[b]]];
+		if (car[n] == c && nil == cdr[n]) break;
+	}
+	if (nil == b) {
+		n = cons3(c, nil, atomtag);
+		n = cons3(n, nil, 0);
+		n = cons3(n, nil, 0);
+		b = ref(symlis) = cons3(n, ref(symlis), 0);
+	}
+	b = car[b];
+	for (p = cdr[b]; p != nil; p = cdr[p]) {
+		n = car[car[p]];
+		for (i = 0; i < k && n != nil && car[n] == s[i]; i++)
+			n = cdr[n];
+		if (i == k && nil == n) return car[p];
+	}
+	n = nil;
+	while (k--) n = cons3(s[k], n, atomtag);
+	n = cons3(n, nil, 0);
+	cdr[b] = cons3(n, cdr[b], 0);
+	return n;
+}
+
+#define issym(c) (isupper(c) || isdigit(c) || '*' == (c) || '-' == (c))
+
+int skipc(void) {
+	int	c;
+
+	for (;;) {
+		c = rpeekc();
+		if (' ' == c || '\n' == c) {
+			rreadc();
+		}
+		else if (';' == c) {
+			while ((c = rreadc()) != 0 && c != '\n')
+				;
+		}
+		else {
+			return c;
+		}
+	}
+}
+
+cell rdobj(void);
+
+cell rdlist(void) {
+	cell	a, n, p;
+	int	c;
+
+	args(1);
+	for (;;) {
+		c = skipc();
+		if (0 == c) halt("UNTERMINATED LIST", limit);
+		if (')' == c) break;
+		n = rdobj();
+		asp[-1] = cons3(n, asp[-1], 0);
+	}
+	rreadc();
+	a = nil;
+	for (n = *--asp; n != nil; n = p) {
+		p = cdr[n];
+		cdr[n] = a;
+		a = n;
+	}
+	return a;
+}
+
+cell rdobj(void) {
+	cell	n, q;
+	int	c, k;
+
+	while (')' == (c = skipc()))
+		rreadc();
+	if (0 == c)
+		return nil;
+	if (issym(c)) {
+		for (k = 0; issym(rpeekc()); k++) {
+			if (k >= maxtok) halt("SYMBOL TOO LONG", limit);
+			token[k] = rreadc();
+		}
+		if (3 == k && 'N' == token[0] && 'I' == token[1] &&
+		    'L' == token[2])
+			return nil;
+		return intern(token, k);
+	}
+	rreadc();
+	if ('(' == c)
+		return rdlist();
+	if ('\'' == c) {
+		q = intern(qname, 5);
+		n = rdobj();
+		return cons3(q, cons3(n, nil, 0), 0);
+	}
+	if ('"' == c) {
+		for (k = 0; (c = rreadc()) != '"'; k++) {
+			if ('\\' == c) c = rreadc();
+			if (0 == c) halt("UNTERMINATED STRING", limit);
+			if (k >= maxtok) halt("STRING TOO LONG", limit);
+			token[k] = c;
+		}
+		n = intern(token, k);
+		q = intern(qname, 5);
+		return cons3(q, cons3(n, nil, 0), 0);
+	}
+	halt("FUNNY CHARACTER", limit);
+	return nil;
 }
 
 void run(void);
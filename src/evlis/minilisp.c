@@ -9,7 +9,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-/* #include <sys/mman.h> */
+#ifdef PARALLEL_GC
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#endif
 
 static __attribute((noreturn)) void error(char *fmt, ...) {
     va_list ap;
@@ -38,6 +43,9 @@ enum {
     // can be found at the forwarding pointer. Only the functions to do garbage collection set and
     // handle the object of this type. Other functions will never see the object of this type.
     TMOVED,
+    // The marker that indicates that a GC thread is moving the object. Only used by the parallel
+    // collector.
+    TBUSY,
     // Const objects. They are statically allocated and will never be managed by GC.
     TTRUE,
     TNIL,
@@ -52,7 +60,11 @@ typedef struct Obj *Primitive(void *root, struct Obj **env, struct Obj **args);
 // The object type
 typedef struct Obj {
     // The first word of the object represents the type of the object. Any code that handles object
-    // needs to check its type first, then access the following union members.
+    // needs to check its type first, then access the following union members. Cons cells have no
+    // header, so the type must be read with type_of(). A pointer to a cell points CELL_OFFSET bytes
+    // below the cell, and its "type" and "size" are the last word of whatever precedes the cell in
+    // memory: another cell, the free gap, or the spare bytes in front of the space. Reading them
+    // is always a bug; the collector asserts that it only does so for objects with a header.
     int type;
 
     // The total size of the object, including "type" field, this field, the contents, and the
@@ -103,24 +115,86 @@ static Obj *Symbols;
 // Memory management
 //======================================================================
 
-// The size of the heap in byte
+// New objects are allocated in a small nursery. When it fills up, a minor GC promotes the live
+// objects in it to the old space, which is a pair of semispaces collected by a major GC only when
+// promotion would not fit.
+//
+// Cons cells have no header. Every space keeps its other objects at the bottom, growing upward,
+// and its cells at the top, growing downward, so an object is a cell if its address is above the
+// objects of its space. A pointer to a cell points CELL_OFFSET bytes below the cell, where the
+// header would be, so that "car" and "cdr" are accessed as for any other object. The "type" and
+// "size" fields of a cell must never be touched; use type_of() instead. Every space is preceded by
+// CELL_OFFSET spare bytes, so that the pointer to a cell at the very bottom of a space still
+// points into allocated memory.
+
+// The size of the nursery in byte
+#define NURSERY_SIZE 16384
+
+// The initial size of the old space in byte. The old space grows and shrinks from here depending
+// on how much data survives each GC, but never beyond MEMORY_MAX or below MEMORY_SIZE.
 #define MEMORY_SIZE 65536
+#define MEMORY_MAX (MEMORY_SIZE * 64)
+
+// The heap is doubled if more than this percentage of it survives a GC, and halved if less than
+// the shrink percentage does. Both can be set with environment variables.
+#define GROW_PERCENT 50
+#define SHRINK_PERCENT 10
+
+// In the debug mode every allocation runs a minor GC, and every FULL_GC_INTERVAL-th one collects
+// the whole heap instead, so that both collectors are exercised.
+#define FULL_GC_INTERVAL 16
 
-// The pointer pointing to the beginning of the current heap
+// The size of a cons cell, and the offset of the cell from the pointer to it
+#define CELL_SIZE (sizeof(Obj *) * 2)
+#define CELL_OFFSET offsetof(Obj, car)
+
+// The current size of the old space in byte
+static size_t memory_size = MEMORY_SIZE;
+
+// The pointer pointing to the beginning of the current old space
 static void *memory;
 
-// The pointer pointing to the beginning of the old heap
+// The pointer pointing to the beginning of the other semispace. It is allocated once along with
+// the current heap and is unused between GCs.
 static void *from_space;
 
-// The number of bytes allocated from the heap
+// The size of the from-space and the number of bytes of objects at its bottom while GC is
+// copying out of it
+static size_t from_size;
+static size_t from_nused;
+
+// The number of bytes used in the old space by objects and by cells
 static size_t mem_nused = 0;
+static size_t mem_ncells = 0;
+
+// The nursery and the number of bytes allocated from it for objects and for cells
+static void *nursery;
+static size_t nursery_nused = 0;
+static size_t nursery_ncells = 0;
+
+// The remembered set: old objects that were made to point to objects in the nursery since the
+// last minor GC. They are roots for the minor GC. An object may appear more than once.
+static Obj **remembered;
+static size_t remembered_len = 0;
+static size_t remembered_cap = 0;
+
+// Heap resizing thresholds in percent
+static int grow_percent = GROW_PERCENT;
+static int shrink_percent = SHRINK_PERCENT;
 
 // Flags to debug GC
 static bool gc_running = false;
 static bool debug_gc = false;
 static bool always_gc = false;
 
+// If true, cells are copied in plain breadth-first order instead of keeping the spines of lists
+// together. Only useful for comparison.
+static bool breadth_first = false;
+
 static void gc(void *root);
+static void minor_gc(void *root);
+static void forced_gc(void *root);
+
 
 // Currently we are using Cheney's copying GC algorithm, with which the available memory is split
 // into two halves and all objects are moved from one half to another every time GC is invoked. That
@@ -129,48 +203,54 @@ static void gc(void *root);
 // runs.
 //
 // In order to deal with that, all access from C to Lisp objects will go through two levels of
-// pointer dereferences. The C local variable is pointing to a pointer on the C stack, and the
-// pointer is pointing to the Lisp object. GC is aware of the pointers in the stack and updates
-// their contents with the objects' new addresses when GC happens.
+// pointer dereferences. The C local variable is pointing to a slot on the shadow stack, and the
+// slot is pointing to the Lisp object. GC is aware of the slots in use and updates their contents
+// with the objects' new addresses when GC happens.
 //
-// The following is a macro to reserve the area in the C stack for the pointers. The contents of
-// this area are considered to be GC root.
+// The shadow stack is a single array of slots. The "root" argument passed around by most functions
+// is the top of the stack in the caller: the slots below it are in use, and the callee may take
+// the ones above it. The following macros reserve slots by bumping the local copy of "root", so
+// they are released simply by returning. The contents of the slots below "root" are considered to
+// be GC root.
 //
 // Be careful not to bypass the two levels of pointer indirections. If you create a direct pointer
 // to an object, it'll cause a subtle bug. Such code would work in most cases but fails with SEGV if
 // GC happens during the execution of the code. Any code that allocates memory may invoke GC.
 
-#define ROOT_END ((void *)-1)
+// The number of slots in the shadow stack
+#define ROOTS_SIZE 65536
 
-#define ADD_ROOT(size)                          \
-    void *root_ADD_ROOT_[size + 2];             \
-    root_ADD_ROOT_[0] = root;                   \
-    for (int i = 1; i <= size; i++)             \
-        root_ADD_ROOT_[i] = NULL;               \
-    root_ADD_ROOT_[size + 1] = ROOT_END;        \
-    root = root_ADD_ROOT_
+static Obj *roots[ROOTS_SIZE];
+
+#define ADD_ROOT(size)                                  \
+    Obj **root_ADD_ROOT_ = root;                        \
+    if (roots + ROOTS_SIZE - size < root_ADD_ROOT_)     \
+        error("Stack overflow");                        \
+    for (int i = 0; i < size; i++)                      \
+        root_ADD_ROOT_[i] = NULL;                       \
+    root = root_ADD_ROOT_ + size
 
 #define DEFINE1(var1)                           \
     ADD_ROOT(1);                                \
-    Obj **var1 = (Obj **)(root_ADD_ROOT_ + 1)
+    Obj **var1 = root_ADD_ROOT_
 
 #define DEFINE2(var1, var2)                     \
     ADD_ROOT(2);                                \
-    Obj **var1 = (Obj **)(root_ADD_ROOT_ + 1);  \
-    Obj **var2 = (Obj **)(root_ADD_ROOT_ + 2)
+    Obj **var1 = root_ADD_ROOT_;                \
+    Obj **var2 = root_ADD_ROOT_ + 1
 
 #define DEFINE3(var1, var2, var3)               \
     ADD_ROOT(3);                                \
-    Obj **var1 = (Obj **)(root_ADD_ROOT_ + 1);  \
-    Obj **var2 = (Obj **)(root_ADD_ROOT_ + 2);  \
-    Obj **var3 = (Obj **)(root_ADD_ROOT_ + 3)
+    Obj **var1 = root_ADD_ROOT_;                \
+    Obj **var2 = root_ADD_ROOT_ + 1;            \
+    Obj **var3 = root_ADD_ROOT_ + 2
 
 #define DEFINE4(var1, var2, var3, var4)         \
     ADD_ROOT(4);                                \
-    Obj **var1 = (Obj **)(root_ADD_ROOT_ + 1);  \
-    Obj **var2 = (Obj **)(root_ADD_ROOT_ + 2);  \
-    Obj **var3 = (Obj **)(root_ADD_ROOT_ + 3);  \
-    Obj **var4 = (Obj **)(root_ADD_ROOT_ + 4)
+    Obj **var1 = root_ADD_ROOT_;                \
+    Obj **var2 = root_ADD_ROOT_ + 1;            \
+    Obj **var3 = root_ADD_ROOT_ + 2;            \
+    Obj **var4 = root_ADD_ROOT_ + 3
 
 // Round up the given value to a multiple of size. Size must be a power of 2. It adds size - 1
 // first, then zero-ing the least significant bits to make the result a multiple of size. I know
@@ -179,6 +259,46 @@ static inline size_t roundup(size_t var, size_t size) {
     return (var + size - 1) & ~(size - 1);
 }
 
+// Returns the address of the cell if obj is a cell. Other objects are at least two words long, so
+// for them this is an address inside the object.
+static inline uint8_t *addr(Obj *obj) {
+    return (uint8_t *)obj + CELL_OFFSET;
+}
+
+static inline bool in_space(Obj *obj, void *space, size_t size) {
+    return (size_t)(addr(obj) - (uint8_t *)space) < size;
+}
+
+static inline bool in_nursery(Obj *obj) {
+    return in_space(obj, nursery, NURSERY_SIZE);
+}
+
+// Returns true if the object is a cons cell.
+static inline bool is_cell(Obj *obj) {
+    if (in_nursery(obj))
+        return (uint8_t *)nursery + nursery_nused <= addr(obj);
+    if (in_space(obj, memory, memory_size))
+        return (uint8_t *)memory + mem_nused <= addr(obj);
+    if (gc_running && in_space(obj, from_space, from_size))
+        return (uint8_t *)from_space + from_nused <= addr(obj);
+    return false;
+}
+
+static inline int type_of(Obj *obj) {
+    return is_cell(obj) ? TCELL : obj->type;
+}
+
+// Allocates a space with CELL_OFFSET spare bytes in front of it.
+static void *alloc_space(size_t size) {
+    uint8_t *p = malloc(CELL_OFFSET + size);
+    return p ? p + CELL_OFFSET : NULL;
+}
+
+static void free_space(void *space) {
+    if (space)
+        free((uint8_t *)space - CELL_OFFSET);
+}
+
 // Allocates memory block. This may start GC if we don't have enough memory.
 static Obj *alloc(void *root, int type, size_t size) {
     // The object must be large enough to contain a pointer for the forwarding pointer. Make it
@@ -193,31 +313,55 @@ static Obj *alloc(void *root, int type, size_t size) {
     // boundary as the pointer.
     size = roundup(size, sizeof(void *));
 
-    // If the debug flag is on, allocate a new memory space to force all the existing objects to
-    // move to new addresses, to invalidate the old addresses. By doing this the GC behavior becomes
-    // more predictable and repeatable. If there's a memory bug that the C variable has a direct
-    // reference to a Lisp object, the pointer will become invalid by this GC call. Dereferencing
-    // that will immediately cause SEGV.
+    // If the debug flag is on, run GC to force all the young objects to move to new addresses, to
+    // invalidate the old addresses. By doing this the GC behavior becomes more predictable and
+    // repeatable. If there's a memory bug that the C variable has a direct reference to a Lisp
+    // object, the pointer will point into the nursery or the from-space, which GC fills with
+    // garbage in this mode. Dereferencing that will quickly fail.
     if (always_gc && !gc_running)
-        gc(root);
+        forced_gc(root);
 
-    // Otherwise, run GC only when the available memory is not large enough.
-    if (!always_gc && MEMORY_SIZE < mem_nused + size)
-        gc(root);
+    // Otherwise, run GC only when the nursery is full.
+    if (!always_gc && NURSERY_SIZE < nursery_nused + nursery_ncells + size)
+        minor_gc(root);
 
     // Terminate the program if we couldn't satisfy the memory request. This can happen if the
-    // requested size was too large or the from-space was filled with too many live objects.
-    if (MEMORY_SIZE < mem_nused + size)
+    // requested size was larger than the nursery.
+    if (NURSERY_SIZE < nursery_nused + nursery_ncells + size)
         error("Memory exhausted");
 
     // Allocate the object.
-    Obj *obj = memory + mem_nused;
+    Obj *obj = nursery + nursery_nused;
     obj->type = type;
     obj->size = size;
-    mem_nused += size;
+    nursery_nused += size;
     return obj;
 }
 
+// Allocates a cons cell from the top of the nursery.
+static Obj *alloc_cell(void *root) {
+    if (always_gc && !gc_running)
+        forced_gc(root);
+    if (!always_gc && NURSERY_SIZE < nursery_nused + nursery_ncells + CELL_SIZE)
+        minor_gc(root);
+    nursery_ncells += CELL_SIZE;
+    return (Obj *)((uint8_t *)nursery + NURSERY_SIZE - nursery_ncells - CELL_OFFSET);
+}
+
+// The write barrier. Must be called after storing val into a field of obj, unless obj was just
+// allocated by the caller.
+static inline void write_barrier(Obj *obj, Obj *val) {
+    if (in_nursery(obj) || !in_nursery(val))
+        return;
+    if (remembered_len == remembered_cap) {
+        remembered_cap = remembered_cap ? remembered_cap * 2 : 256;
+        remembered = realloc(remembered, remembered_cap * sizeof(Obj *));
+        if (!remembered)
+            error("Memory exhausted");
+    }
+    remembered[remembered_len++] = obj;
+}
+
 //======================================================================
 // Garbage collector
 //======================================================================
@@ -227,24 +371,298 @@ static Obj *alloc(void *root, int type, size_t size) {
 // to-space. The objects before "scan1" are the objects that are fully copied. The objects between
 // "scan1" and "scan2" have already been copied, but may contain pointers to the from-space. "scan2"
 // points to the beginning of the free space.
+//
+// Cells are copied to the top of the to-space, and "cscan1" and "cscan2" do the same for them
+// going downward from the end of the to-space.
 static Obj *scan1;
 static Obj *scan2;
+static uint8_t *cscan1;
+static uint8_t *cscan2;
+
+// The part of the to-space that was free when GC started. Only forwarding pointers point there
+// from the from-space, so a cell whose car points there has been moved.
+static uint8_t *gap_start;
+static uint8_t *gap_end;
+
+static inline bool is_forwarding(Obj *car) {
+    return (size_t)(addr(car) - gap_start) < (size_t)(gap_end - gap_start);
+}
+
+// Returns true if the object is a cell to be copied by the current GC.
+static inline bool is_from_cell(Obj *obj) {
+    if (in_nursery(obj))
+        return (uint8_t *)nursery + nursery_nused <= addr(obj);
+    return in_space(obj, from_space, from_size) && (uint8_t *)from_space + from_nused <= addr(obj);
+}
+
+#ifdef PARALLEL_GC
+// With PARALLEL_GC defined, major collections are done by gc_threads threads, set with the
+// MINILISP_GC_THREADS environment variable and defaulting to the number of CPUs. Instead of the
+// scan pointers, each thread copies objects and cells into its own allocation buffers carved out
+// of the to-space, and keeps the copies that still have to be scanned in its own deque. A thread
+// that runs out of work steals from the other threads' deques. Objects are claimed by a CAS on
+// their type field, which holds TBUSY while the winner copies the object and TMOVED once the
+// forwarding pointer is set. Cells are claimed by a CAS on their car, which holds Busy while the
+// winner copies the cell and the forwarding pointer after that.
+
+// The size of the per-thread allocation buffers in byte
+#define LAB_SIZE 4096
+
+// The maximum number of objects stolen at a time
+#define STEAL_MAX 64
+
+// Deque entries with this bit set are cells.
+#define CELL_TAG 1
+
+typedef struct {
+    // The deque of copies to be scanned. The owner pushes and pops at the tail, thieves take from
+    // the head.
+    Obj **items;
+    size_t head;
+    size_t tail;
+    size_t cap;
+    bool lock;
+    // The allocation buffers for objects and for cells
+    uint8_t *lab;
+    uint8_t *lab_end;
+    uint8_t *clab;
+    uint8_t *clab_end;
+} Worker;
+
+static int gc_threads = 1;
+static Worker *workers;
+
+// The worker of the current thread. NULL unless a parallel GC is running.
+static _Thread_local Worker *worker;
+
+// The free part of the to-space, and the lock for carving buffers out of it
+static uint8_t *to_top;
+static uint8_t *cell_top;
+static bool carve_lock;
+
+// The value of the car of a cell being copied
+static Obj *Busy = &(Obj){ TBUSY };
+
+// The number of threads that have no work
+static int idle;
+
+static void lock(Worker *w) {
+    while (__atomic_test_and_set(&w->lock, __ATOMIC_ACQUIRE))
+        ;
+}
+
+static void unlock(Worker *w) {
+    __atomic_clear(&w->lock, __ATOMIC_RELEASE);
+}
+
+static void push(Worker *w, Obj *obj) {
+    lock(w);
+    if (w->tail == w->cap) {
+        if (w->cap && w->head >= w->cap / 2) {
+            // Slide the items down over the stolen ones.
+            memmove(w->items, w->items + w->head, (w->tail - w->head) * sizeof(Obj *));
+            __atomic_store_n(&w->tail, w->tail - w->head, __ATOMIC_RELAXED);
+            __atomic_store_n(&w->head, 0, __ATOMIC_RELAXED);
+        } else {
+            w->cap = w->cap ? w->cap * 2 : 1024;
+            w->items = realloc(w->items, w->cap * sizeof(Obj *));
+            if (!w->items)
+                error("Memory exhausted");
+        }
+    }
+    w->items[w->tail] = obj;
+    __atomic_store_n(&w->tail, w->tail + 1, __ATOMIC_RELAXED);
+    unlock(w);
+}
+
+static Obj *pop(Worker *w) {
+    Obj *obj = NULL;
+    lock(w);
+    if (w->head < w->tail) {
+        __atomic_store_n(&w->tail, w->tail - 1, __ATOMIC_RELAXED);
+        obj = w->items[w->tail];
+    }
+    unlock(w);
+    return obj;
+}
+
+// Takes a buffer of at least size bytes from the free part of the to-space: from the bottom for
+// objects, or from the top for cells. Returns the beginning and sets *end to the end.
+static uint8_t *carve(size_t size, bool cells, uint8_t **end) {
+    while (__atomic_test_and_set(&carve_lock, __ATOMIC_ACQUIRE))
+        ;
+    size_t free = cell_top - to_top;
+    if (free < size)
+        error("Memory exhausted");
+    // Buffers shrink as the to-space fills up, so that the unused ends of the two buffers of every
+    // thread together never take more room than is left, however many threads there are.
+    size_t chunk = free / (2 * gc_threads) & ~(CELL_SIZE - 1);
+    if (chunk > LAB_SIZE)
+        chunk = LAB_SIZE;
+    if (chunk < size)
+        chunk = size;
+    uint8_t *p;
+    if (cells) {
+        cell_top -= chunk;
+        p = cell_top;
+    } else {
+        p = to_top;
+        to_top += chunk;
+    }
+    __atomic_clear(&carve_lock, __ATOMIC_RELEASE);
+    *end = p + chunk;
+    return p;
+}
+
+// Turns the unused end of the object buffer into a dummy object, so that the objects in the
+// to-space can still be walked one by one. The unused part of a cell buffer is left as is; cells
+// are never walked.
+static void release_lab(Worker *w) {
+    if (w->lab < w->lab_end) {
+        Obj *obj = (Obj *)w->lab;
+        obj->type = TINT;
+        obj->size = w->lab_end - w->lab;
+    }
+    w->lab = w->lab_end = NULL;
+}
+
+static Obj *forward_par(Obj *obj) {
+    assert(!is_cell(obj));
+    int type = __atomic_load_n(&obj->type, __ATOMIC_ACQUIRE);
+    for (;;) {
+        if (type == TMOVED)
+            return obj->moved;
+        if (type == TBUSY)
+            type = __atomic_load_n(&obj->type, __ATOMIC_ACQUIRE);
+        else if (__atomic_compare_exchange_n(&obj->type, &type, TBUSY, false, __ATOMIC_ACQUIRE,
+                                             __ATOMIC_ACQUIRE))
+            break;
+    }
+
+    // Sizes are rounded up to the size of the object header, so that any leftover space in an
+    // allocation buffer can hold a dummy object.
+    size_t size = roundup(obj->size, offsetof(Obj, value));
+    if ((size_t)(worker->lab_end - worker->lab) < size) {
+        release_lab(worker);
+        worker->lab = carve(size, false, &worker->lab_end);
+    }
+    Obj *newloc = (Obj *)worker->lab;
+    worker->lab += size;
+    // The header is not copied, as other threads may still be reading the type of the original.
+    memcpy(&newloc->value, &obj->value, obj->size - offsetof(Obj, value));
+    newloc->type = type;
+    newloc->size = size;
+    obj->moved = newloc;
+    __atomic_store_n(&obj->type, TMOVED, __ATOMIC_RELEASE);
+    if (type != TINT && type != TSYMBOL && type != TPRIMITIVE)
+        push(worker, newloc);
+    return newloc;
+}
+
+// Claims a cell for copying. Returns NULL and sets *car to the car of the cell if this thread won,
+// or returns the new address of the cell if another thread has already copied it.
+static Obj *claim_cell(Obj *obj, Obj **car) {
+    Obj *val = __atomic_load_n(&obj->car, __ATOMIC_ACQUIRE);
+    for (;;) {
+        if (val == Busy)
+            val = __atomic_load_n(&obj->car, __ATOMIC_ACQUIRE);
+        else if (is_forwarding(val))
+            return val;
+        else if (__atomic_compare_exchange_n(&obj->car, &val, Busy, false, __ATOMIC_ACQUIRE,
+                                             __ATOMIC_ACQUIRE))
+            break;
+    }
+    *car = val;
+    return NULL;
+}
+
+static Obj *copy_cell_par(Obj *obj, Obj *car) {
+    if ((size_t)(worker->clab_end - worker->clab) < CELL_SIZE)
+        worker->clab = carve(CELL_SIZE, true, &worker->clab_end);
+    Obj *newloc = (Obj *)(worker->clab - CELL_OFFSET);
+    worker->clab += CELL_SIZE;
+    newloc->car = car;
+    newloc->cdr = obj->cdr;
+    __atomic_store_n(&obj->car, newloc, __ATOMIC_RELEASE);
+    return newloc;
+}
+
+static Obj *forward_cell_par(Obj *obj) {
+    Obj *car;
+    Obj *newloc = claim_cell(obj, &car);
+    if (newloc)
+        return newloc;
+    newloc = copy_cell_par(obj, car);
+
+    // Copy the rest of the spine for as long as no other thread has claimed it. A copy is pushed
+    // only once its cdr is final, as another thread may steal and scan it right away.
+    Obj *p = newloc;
+    while (!breadth_first && is_from_cell(p->cdr) && !claim_cell(p->cdr, &car)) {
+        Obj *next = copy_cell_par(p->cdr, car);
+        p->cdr = next;
+        push(worker, (Obj *)((uintptr_t)p | CELL_TAG));
+        p = next;
+    }
+    push(worker, (Obj *)((uintptr_t)p | CELL_TAG));
+    return newloc;
+}
+#endif
+
+// Copies a cell to the to-space and leaves the forwarding pointer in its car.
+static Obj *copy_cell(Obj *obj) {
+    if (cscan2 - CELL_SIZE < (uint8_t *)scan2)
+        error("Memory exhausted");
+    cscan2 -= CELL_SIZE;
+    Obj *newloc = (Obj *)(cscan2 - CELL_OFFSET);
+    newloc->car = obj->car;
+    newloc->cdr = obj->cdr;
+    obj->car = newloc;
+    return newloc;
+}
 
-// Moves one object from the from-space to the to-space. Returns the object's new address. If the
-// object has already been moved, does nothing but just returns the new address.
+// Moves one object from the from-space or the nursery to the to-space. Returns the object's new
+// address. If the object has already been moved, does nothing but just returns the new address.
 static inline Obj *forward(Obj *obj) {
-    // If the object's address is not in the from-space, the object is not managed by GC nor it
-    // has already been moved to the to-space.
-    ptrdiff_t offset = (uint8_t *)obj - (uint8_t *)from_space;
-    if (offset < 0 || MEMORY_SIZE <= offset)
+    // If the object's address is neither in the nursery nor in the from-space, the object is not
+    // managed by GC, is old during a minor GC, or has already been moved to the to-space.
+    bool cell;
+    if (in_nursery(obj))
+        cell = (uint8_t *)nursery + nursery_nused <= addr(obj);
+    else if (in_space(obj, from_space, from_size))
+        cell = (uint8_t *)from_space + from_nused <= addr(obj);
+    else
         return obj;
 
+#ifdef PARALLEL_GC
+    if (worker)
+        return cell ? forward_cell_par(obj) : forward_par(obj);
+#endif
+
+    if (cell) {
+        // A cell has no room for a tombstone. Its car is overwritten with the forwarding pointer
+        // instead, which is recognized by pointing into the part of the to-space that was free.
+        if (is_forwarding(obj->car))
+            return obj->car;
+        Obj *newloc = copy_cell(obj);
+
+        // Copy the rest of the list's spine right after the cell. Cheney's order would interleave
+        // it with everything else at the same distance from the roots, and a later walk down the
+        // list would touch a different cache line for every cell.
+        for (Obj *p = newloc; !breadth_first && is_from_cell(p->cdr) && !is_forwarding(p->cdr->car);
+             p = p->cdr)
+            p->cdr = copy_cell(p->cdr);
+        return newloc;
+    }
+
     // The pointer is pointing to the from-space, but the object there was a tombstone. Follow the
     // forwarding pointer to find the new location of the object.
+    assert(!is_cell(obj));
     if (obj->type == TMOVED)
         return obj->moved;
 
     // Otherwise, the object has not been moved yet. Move it.
+    if (cscan2 < (uint8_t *)scan2 + obj->size)
+        error("Memory exhausted");
     Obj *newloc = scan2;
     memcpy(newloc, obj, obj->size);
     scan2 = (Obj *)((uint8_t *)scan2 + obj->size);
@@ -256,72 +674,310 @@ static inline Obj *forward(Obj *obj) {
     return newloc;
 }
 
-static void *alloc_semispace() {
-    return mmap(NULL, MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+// Forwards the pointers in the given object, which must not be a cell.
+static void scan_object(Obj *obj) {
+    switch (obj->type) {
+    case TINT:
+    case TSYMBOL:
+    case TPRIMITIVE:
+        // Any of the above types does not contain a pointer to a GC-managed object.
+        break;
+    case TFUNCTION:
+    case TMACRO:
+        obj->params = forward(obj->params);
+        obj->body = forward(obj->body);
+        obj->env = forward(obj->env);
+        break;
+    case TENV:
+        obj->vars = forward(obj->vars);
+        obj->up = forward(obj->up);
+        break;
+    default:
+        error("Bug: copy: unknown type %d", obj->type);
+    }
+}
+
+static void scan_cell(Obj *obj) {
+    obj->car = forward(obj->car);
+    obj->cdr = forward(obj->cdr);
 }
 
 // Copies the root objects.
 static void forward_root_objects(void *root) {
     Symbols = forward(Symbols);
-    for (void **frame = root; frame; frame = *(void ***)frame)
-        for (int i = 1; frame[i] != ROOT_END; i++)
-            if (frame[i])
-                frame[i] = forward(frame[i]);
+    for (Obj **p = roots; p < (Obj **)root; p++)
+        if (*p)
+            *p = forward(*p);
+    for (size_t i = 0; i < remembered_len; i++) {
+        if (is_cell(remembered[i]))
+            scan_cell(remembered[i]);
+        else
+            scan_object(remembered[i]);
+    }
+}
+
+#ifdef PARALLEL_GC
+static bool work_available(void) {
+    for (int i = 0; i < gc_threads; i++)
+        if (__atomic_load_n(&workers[i].head, __ATOMIC_RELAXED) <
+            __atomic_load_n(&workers[i].tail, __ATOMIC_RELAXED))
+            return true;
+    return false;
+}
+
+// Moves up to half of the items of another thread's deque to the given one.
+static bool steal(Worker *w) {
+    Obj *buf[STEAL_MAX];
+    for (int i = 0; i < gc_threads; i++) {
+        Worker *v = &workers[(w - workers + 1 + i) % gc_threads];
+        if (v == w)
+            continue;
+        lock(v);
+        size_t n = (v->tail - v->head + 1) / 2;
+        if (STEAL_MAX < n)
+            n = STEAL_MAX;
+        for (size_t j = 0; j < n; j++)
+            buf[j] = v->items[v->head + j];
+        __atomic_store_n(&v->head, v->head + n, __ATOMIC_RELAXED);
+        unlock(v);
+        for (size_t j = 0; j < n; j++)
+            push(w, buf[j]);
+        if (n)
+            return true;
+    }
+    return false;
+}
+
+// The main loop of a GC thread. A thread counted in "idle" has an empty deque, and only the owner
+// pushes to a deque, so all work is done once every thread is idle.
+static void *gc_worker(void *arg) {
+    worker = arg;
+    for (;;) {
+        Obj *obj;
+        while ((obj = pop(worker))) {
+            if ((uintptr_t)obj & CELL_TAG)
+                scan_cell((Obj *)((uintptr_t)obj & ~(uintptr_t)CELL_TAG));
+            else
+                scan_object(obj);
+        }
+        __atomic_fetch_add(&idle, 1, __ATOMIC_ACQ_REL);
+        for (;;) {
+            if (__atomic_load_n(&idle, __ATOMIC_ACQUIRE) == gc_threads) {
+                release_lab(worker);
+                worker->clab = worker->clab_end = NULL;
+                worker = NULL;
+                return NULL;
+            }
+            if (!work_available()) {
+                sched_yield();
+                continue;
+            }
+            __atomic_fetch_sub(&idle, 1, __ATOMIC_ACQ_REL);
+            if (steal(worker))
+                break;
+            __atomic_fetch_add(&idle, 1, __ATOMIC_ACQ_REL);
+        }
+    }
+}
+
+static void copy_live_par(void *root, void *to, void *end) {
+    to_top = to;
+    cell_top = end;
+    idle = 0;
+
+    // Copy the GC root objects on this thread. The copies go to the first deque, from which the
+    // other threads steal.
+    worker = &workers[0];
+    forward_root_objects(root);
+
+    pthread_t threads[gc_threads];
+    for (int i = 1; i < gc_threads; i++)
+        if (pthread_create(&threads[i], NULL, gc_worker, &workers[i]))
+            error("Cannot create GC thread");
+    gc_worker(&workers[0]);
+    for (int i = 1; i < gc_threads; i++)
+        pthread_join(threads[i], NULL);
+    scan1 = scan2 = (Obj *)to_top;
+    cscan1 = cscan2 = cell_top;
+}
+
+static long now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000L + ts.tv_nsec / 1000;
+}
+#endif
+
+// Copies all objects reachable from the root from the nursery and the from-space to the free part
+// of the to-space between the given addresses: other objects upward from "to", and cells downward
+// from "end". Leaves scan1 at the end of the copied objects and cscan1 at the beginning of the
+// copied cells.
+static void copy_live(void *root, void *to, void *end) {
+    gap_start = to;
+    gap_end = end;
+
+#ifdef PARALLEL_GC
+    // Minor collections are too small to be worth the threads.
+    if (gc_threads > 1 && from_size) {
+        copy_live_par(root, to, end);
+        nursery_nused = nursery_ncells = 0;
+        remembered_len = 0;
+        return;
+    }
+#endif
+
+    // Initialize the pointers for GC. Initially they point to the ends of the free space.
+    scan1 = scan2 = to;
+    cscan1 = cscan2 = end;
+
+    // Copy the GC root objects first. This moves the pointers scan2 and cscan2.
+    forward_root_objects(root);
+
+    // Copy the objects referenced by the GC root objects located between scan1 and scan2, and the
+    // cells between cscan2 and cscan1. Once it's finished, all live objects (i.e. objects
+    // reachable from the root) will have been copied to the to-space.
+    while (scan1 < scan2 || cscan2 < cscan1) {
+        while (scan1 < scan2) {
+            scan_object(scan1);
+            scan1 = (Obj *)((uint8_t *)scan1 + scan1->size);
+        }
+        while (cscan2 < cscan1) {
+            cscan1 -= CELL_SIZE;
+            scan_cell((Obj *)(cscan1 - CELL_OFFSET));
+        }
+    }
+    nursery_nused = nursery_ncells = 0;
+    remembered_len = 0;
 }
 
-// Implements Cheney's copying garbage collection algorithm.
+// Sets the use counts of the old space from the scan pointers after copying to it.
+static void set_usage(void) {
+    mem_nused = (size_t)((uint8_t *)scan1 - (uint8_t *)memory);
+    mem_ncells = (size_t)((uint8_t *)memory + memory_size - cscan1);
+}
+
+// Moves the live objects into a new pair of semispaces of the given size. Keeps the current old
+// space and returns false if the memory for the new one cannot be allocated.
+static bool resize(void *root, size_t size) {
+    void *to = alloc_space(size);
+    void *other = alloc_space(size);
+    if (!to || !other) {
+        free_space(to);
+        free_space(other);
+        return false;
+    }
+    free_space(from_space);
+    from_space = memory;
+    from_size = memory_size;
+    from_nused = mem_nused;
+    copy_live(root, to, (uint8_t *)to + size);
+    free_space(from_space);
+    memory = to;
+    from_space = other;
+    from_size = 0;
+    if (debug_gc)
+        fprintf(stderr, "GC: heap resized from %zu to %zu bytes.\n", memory_size, size);
+    memory_size = size;
+    set_usage();
+    return true;
+}
+
+// Implements Cheney's copying garbage collection algorithm for the whole heap.
 // http://en.wikipedia.org/wiki/Cheney%27s_algorithm
 static void gc(void *root) {
     assert(!gc_running);
     gc_running = true;
 
-    // Allocate a new semi-space.
-    from_space = memory;
-    memory = alloc_semispace();
+    // The remembered set is not needed, as all old objects are scanned anyway.
+    remembered_len = 0;
+
+    // The to-space is as large as the from-space. minor_gc() keeps a nursery's worth of room in the
+    // old space, so old and young objects together normally fit even if all of them are live.
+    // Only if they may not fit is the old space grown instead; that copies everything to the new
+    // space. How much the heap grows or shrinks otherwise depends only on what survives.
+    size_t old_nused = mem_nused + mem_ncells + nursery_nused + nursery_ncells;
+    size_t size = memory_size;
+    while (size < old_nused && size < MEMORY_MAX)
+        size *= 2;
+    if (size != memory_size && resize(root, size)) {
+        gc_running = false;
+        return;
+    }
 
-    // Initialize the two pointers for GC. Initially they point to the beginning of the to-space.
-    scan1 = scan2 = memory;
+    // Flip the semispaces. The current old space becomes the from-space, and the objects are
+    // copied to the other one.
+    void *to = from_space;
+    from_space = memory;
+    from_size = memory_size;
+    from_nused = mem_nused;
+    memory = to;
+#ifdef PARALLEL_GC
+    long start = now_us();
+#endif
+    copy_live(root, memory, (uint8_t *)memory + memory_size);
+    set_usage();
+    size_t live = mem_nused + mem_ncells;
+    if (debug_gc)
+        fprintf(stderr, "GC: %zu bytes out of %zu bytes copied.\n", live, old_nused);
+#ifdef PARALLEL_GC
+    if (debug_gc)
+        fprintf(stderr, "GC: %ld us with %d threads.\n", now_us() - start, gc_threads);
+#endif
 
-    // Copy the GC root objects first. This moves the pointer scan2.
-    forward_root_objects(root);
+    // Make stale pointers into the from-space and the nursery fail fast in the debug mode.
+    if (always_gc) {
+        memset(from_space, 0xff, memory_size);
+        memset(nursery, 0xff, NURSERY_SIZE);
+    }
+    from_size = 0;
+
+    // Grow the heap if too much of it survived, so that we don't collect continuously, or give
+    // memory back if little did.
+    if (live * 100 > memory_size * grow_percent && memory_size < MEMORY_MAX)
+        resize(root, memory_size * 2);
+    else if (live * 100 < memory_size * shrink_percent && memory_size > MEMORY_SIZE &&
+             live < memory_size / 4)
+        resize(root, memory_size / 2);
+    gc_running = false;
+}
 
-    // Copy the objects referenced by the GC root objects located between scan1 and scan2. Once it's
-    // finished, all live objects (i.e. objects reachable from the root) will have been copied to
-    // the to-space.
-    while (scan1 < scan2) {
-        switch (scan1->type) {
-        case TINT:
-        case TSYMBOL:
-        case TPRIMITIVE:
-            // Any of the above types does not contain a pointer to a GC-managed object.
-            break;
-        case TCELL:
-            scan1->car = forward(scan1->car);
-            scan1->cdr = forward(scan1->cdr);
-            break;
-        case TFUNCTION:
-        case TMACRO:
-            scan1->params = forward(scan1->params);
-            scan1->body = forward(scan1->body);
-            scan1->env = forward(scan1->env);
-            break;
-        case TENV:
-            scan1->vars = forward(scan1->vars);
-            scan1->up = forward(scan1->up);
-            break;
-        default:
-            error("Bug: copy: unknown type %d", scan1->type);
-        }
-        scan1 = (Obj *)((uint8_t *)scan1 + scan1->size);
+// Promotes the live objects in the nursery to the old space. The roots are the usual ones plus the
+// remembered set, so the cost is proportional to the number of young survivors.
+static void minor_gc(void *root) {
+    // Promotion may need as much room as the nursery has in use. Collect the whole heap instead if
+    // there isn't that much.
+    size_t young = nursery_nused + nursery_ncells;
+    if (memory_size < mem_nused + mem_ncells + young) {
+        gc(root);
+        return;
     }
+    assert(!gc_running);
+    gc_running = true;
 
-    // Finish up GC.
-    munmap(from_space, MEMORY_SIZE);
-    size_t old_nused = mem_nused;
-    mem_nused = (size_t)((uint8_t *)scan1 - (uint8_t *)memory);
+    // Nothing in the old space is moved.
+    size_t old = mem_nused + mem_ncells;
+    from_size = 0;
+    copy_live(root, (uint8_t *)memory + mem_nused, (uint8_t *)memory + memory_size - mem_ncells);
+    set_usage();
     if (debug_gc)
-        fprintf(stderr, "GC: %zu bytes out of %zu bytes copied.\n", mem_nused, old_nused);
+        fprintf(stderr, "GC: %zu bytes out of %zu bytes promoted.\n",
+                mem_nused + mem_ncells - old, young);
+    if (always_gc)
+        memset(nursery, 0xff, NURSERY_SIZE);
     gc_running = false;
+
+    // Collect the whole heap as soon as the next promotion might not fit, while the nursery is
+    // empty, so that the major GC always fits into the to-space.
+    if (memory_size - (mem_nused + mem_ncells) < NURSERY_SIZE)
+        gc(root);
+}
+
+// Runs the collection requested by the debug mode.
+static void forced_gc(void *root) {
+    static int count = 0;
+    minor_gc(root);
+    if (++count % FULL_GC_INTERVAL == 0)
+        gc(root);
 }
 
 //======================================================================
@@ -335,7 +991,7 @@ static Obj *make_int(void *root, int value) {
 }
 
 static Obj *cons(void *root, Obj **car, Obj **cdr) {
-    Obj *cell = alloc(root, TCELL, sizeof(Obj *) * 2);
+    Obj *cell = alloc_cell(root);
     cell->car = *car;
     cell->cdr = *cdr;
     return cell;
@@ -400,6 +1056,7 @@ static Obj *reverse(Obj *p) {
         Obj *head = p;
         p = p->cdr;
         head->cdr = ret;
+        write_barrier(head, ret);
         ret = head;
     }
     return ret;
@@ -435,6 +1092,7 @@ static Obj *read_list(void *root) {
                 error("Closed parenthesis expected after dot");
             Obj *ret = reverse(*head);
             (*head)->cdr = *last;
+            write_barrier(*head, *last);
             return ret;
         }
         *head = cons(root, obj, head);
@@ -513,14 +1171,14 @@ static Obj *read_expr(void *root) {
 
 // Prints the given object.
 static void print(Obj *obj) {
-    switch (obj->type) {
+    switch (type_of(obj)) {
     case TCELL:
         printf("(");
         for (;;) {
             print(obj->car);
             if (obj->cdr == Nil)
                 break;
-            if (obj->cdr->type != TCELL) {
+            if (type_of(obj->cdr) != TCELL) {
                 printf(" . ");
                 print(obj->cdr);
                 break;
@@ -545,14 +1203,14 @@ static void print(Obj *obj) {
     CASE(TNIL, "()");
 #undef CASE
     default:
-        error("Bug: print: Unknown tag type: %d", obj->type);
+        error("Bug: print: Unknown tag type: %d", type_of(obj));
     }
 }
 
 // Returns the length of the given list. -1 if it's not a proper list.
 static int length(Obj *list) {
     int len = 0;
-    for (; list->type == TCELL; list = list->cdr)
+    for (; type_of(list) == TCELL; list = list->cdr)
         len++;
     return list == Nil ? len : -1;
 }
@@ -568,14 +1226,15 @@ static void add_variable(void *root, Obj **env, Obj **sym, Obj **val) {
     *vars = (*env)->vars;
     *tmp = acons(root, sym, val, vars);
     (*env)->vars = *tmp;
+    write_barrier(*env, *tmp);
 }
 
 // Returns a newly created environment frame.
 static Obj *push_env(void *root, Obj **env, Obj **vars, Obj **vals) {
     DEFINE3(map, sym, val);
     *map = Nil;
-    for (; (*vars)->type == TCELL; *vars = (*vars)->cdr, *vals = (*vals)->cdr) {
-        if ((*vals)->type != TCELL)
+    for (; type_of(*vars) == TCELL; *vars = (*vars)->cdr, *vals = (*vals)->cdr) {
+        if (type_of(*vals) != TCELL)
             error("Cannot apply function: number of argument does not match");
         *sym = (*vars)->car;
         *val = (*vals)->car;
@@ -609,7 +1268,7 @@ static Obj *eval_list(void *root, Obj **env, Obj **list) {
 }
 
 static bool is_list(Obj *obj) {
-    return obj == Nil || obj->type == TCELL;
+    return obj == Nil || type_of(obj) == TCELL;
 }
 
 static Obj *apply_func(void *root, Obj **env, Obj **fn, Obj **args) {
@@ -625,9 +1284,9 @@ static Obj *apply_func(void *root, Obj **env, Obj **fn, Obj **args) {
 static Obj *apply(void *root, Obj **env, Obj **fn, Obj **args) {
     if (!is_list(*args))
         error("argument must be a list");
-    if ((*fn)->type == TPRIMITIVE)
+    if (type_of(*fn) == TPRIMITIVE)
         return (*fn)->fn(root, env, args);
-    if ((*fn)->type == TFUNCTION) {
+    if (type_of(*fn) == TFUNCTION) {
         DEFINE1(eargs);
         *eargs = eval_list(root, env, args);
         return apply_func(root, env, fn, eargs);
@@ -649,11 +1308,11 @@ static Obj *find(Obj **env, Obj *sym) {
 
 // Expands the given macro application form.
 static Obj *macroexpand(void *root, Obj **env, Obj **obj) {
-    if ((*obj)->type != TCELL || (*obj)->car->type != TSYMBOL)
+    if (type_of(*obj) != TCELL || type_of((*obj)->car) != TSYMBOL)
         return *obj;
     DEFINE3(bind, macro, args);
     *bind = find(env, (*obj)->car);
-    if (!*bind || (*bind)->cdr->type != TMACRO)
+    if (!*bind || type_of((*bind)->cdr) != TMACRO)
         return *obj;
     *macro = (*bind)->cdr;
     *args = (*obj)->cdr;
@@ -662,7 +1321,7 @@ static Obj *macroexpand(void *root, Obj **env, Obj **obj) {
 
 // Evaluates the S expression.
 static Obj *eval(void *root, Obj **env, Obj **obj) {
-    switch ((*obj)->type) {
+    switch (type_of(*obj)) {
     case TINT:
     case TPRIMITIVE:
     case TFUNCTION:
@@ -686,12 +1345,12 @@ static Obj *eval(void *root, Obj **env, Obj **obj) {
         *fn = (*obj)->car;
         *fn = eval(root, env, fn);
         *args = (*obj)->cdr;
-        if ((*fn)->type != TPRIMITIVE && (*fn)->type != TFUNCTION)
+        if (type_of(*fn) != TPRIMITIVE && type_of(*fn) != TFUNCTION)
             error("The head of a list must be a function");
         return apply(root, env, fn, args);
     }
     default:
-        error("Bug: eval: Unknown tag type: %d", (*obj)->type);
+        error("Bug: eval: Unknown tag type: %d", type_of(*obj));
     }
 }
 
@@ -712,13 +1371,14 @@ static Obj *prim_cons(void *root, Obj **env, Obj **list) {
         error("Malformed cons");
     Obj *cell = eval_list(root, env, list);
     cell->cdr = cell->cdr->car;
+    write_barrier(cell, cell->cdr);
     return cell;
 }
 
 // (car <cell>)
 static Obj *prim_car(void *root, Obj **env, Obj **list) {
     Obj *args = eval_list(root, env, list);
-    if (args->car->type != TCELL || args->cdr != Nil)
+    if (type_of(args->car) != TCELL || args->cdr != Nil)
         error("Malformed car");
     return args->car->car;
 }
@@ -726,14 +1386,14 @@ static Obj *prim_car(void *root, Obj **env, Obj **list) {
 // (cdr <cell>)
 static Obj *prim_cdr(void *root, Obj **env, Obj **list) {
     Obj *args = eval_list(root, env, list);
-    if (args->car->type != TCELL || args->cdr != Nil)
+    if (type_of(args->car) != TCELL || args->cdr != Nil)
         error("Malformed cdr");
     return args->car->cdr;
 }
 
 // (setq <symbol> expr)
 static Obj *prim_setq(void *root, Obj **env, Obj **list) {
-    if (length(*list) != 2 || (*list)->car->type != TSYMBOL)
+    if (length(*list) != 2 || type_of((*list)->car) != TSYMBOL)
         error("Malformed setq");
     DEFINE2(bind, value);
     *bind = find(env, (*list)->car);
@@ -742,6 +1402,7 @@ static Obj *prim_setq(void *root, Obj **env, Obj **list) {
     *value = (*list)->cdr->car;
     *value = eval(root, env, value);
     (*bind)->cdr = *value;
+    write_barrier(*bind, *value);
     return *value;
 }
 
@@ -749,9 +1410,10 @@ static Obj *prim_setq(void *root, Obj **env, Obj **list) {
 static Obj *prim_setcar(void *root, Obj **env, Obj **list) {
     DEFINE1(args);
     *args = eval_list(root, env, list);
-    if (length(*args) != 2 || (*args)->car->type != TCELL)
+    if (length(*args) != 2 || type_of((*args)->car) != TCELL)
         error("Malformed setcar");
     (*args)->car->car = (*args)->cdr->car;
+    write_barrier((*args)->car, (*args)->car->car);
     return (*args)->car;
 }
 
@@ -780,7 +1442,7 @@ static Obj *prim_gensym(void *root, Obj **env, Obj **list) {
 static Obj *prim_plus(void *root, Obj **env, Obj **list) {
     int sum = 0;
     for (Obj *args = eval_list(root, env, list); args != Nil; args = args->cdr) {
-        if (args->car->type != TINT)
+        if (type_of(args->car) != TINT)
             error("+ takes only numbers");
         sum += args->car->value;
     }
@@ -791,7 +1453,7 @@ static Obj *prim_plus(void *root, Obj **env, Obj **list) {
 static Obj *prim_minus(void *root, Obj **env, Obj **list) {
     Obj *args = eval_list(root, env, list);
     for (Obj *p = args; p != Nil; p = p->cdr)
-        if (p->car->type != TINT)
+        if (type_of(p->car) != TINT)
             error("- takes only numbers");
     if (args->cdr == Nil)
         return make_int(root, -args->car->value);
@@ -808,19 +1470,19 @@ static Obj *prim_lt(void *root, Obj **env, Obj **list) {
         error("malformed <");
     Obj *x = args->car;
     Obj *y = args->cdr->car;
-    if (x->type != TINT || y->type != TINT)
+    if (type_of(x) != TINT || type_of(y) != TINT)
         error("< takes only numbers");
     return x->value < y->value ? True : Nil;
 }
 
 static Obj *handle_function(void *root, Obj **env, Obj **list, int type) {
-    if ((*list)->type != TCELL || !is_list((*list)->car) || (*list)->cdr->type != TCELL)
+    if (type_of(*list) != TCELL || !is_list((*list)->car) || type_of((*list)->cdr) != TCELL)
         error("Malformed lambda");
     Obj *p = (*list)->car;
-    for (; p->type == TCELL; p = p->cdr)
-        if (p->car->type != TSYMBOL)
+    for (; type_of(p) == TCELL; p = p->cdr)
+        if (type_of(p->car) != TSYMBOL)
             error("Parameter must be a symbol");
-    if (p != Nil && p->type != TSYMBOL)
+    if (p != Nil && type_of(p) != TSYMBOL)
         error("Parameter must be a symbol");
     DEFINE2(params, body);
     *params = (*list)->car;
@@ -834,7 +1496,7 @@ static Obj *prim_lambda(void *root, Obj **env, Obj **list) {
 }
 
 static Obj *handle_defun(void *root, Obj **env, Obj **list, int type) {
-    if ((*list)->car->type != TSYMBOL || (*list)->cdr->type != TCELL)
+    if (type_of((*list)->car) != TSYMBOL || type_of((*list)->cdr) != TCELL)
         error("Malformed defun");
     DEFINE3(fn, sym, rest);
     *sym = (*list)->car;
@@ -851,7 +1513,7 @@ static Obj *prim_defun(void *root, Obj **env, Obj **list) {
 
 // (define <symbol> expr)
 static Obj *prim_define(void *root, Obj **env, Obj **list) {
-    if (length(*list) != 2 || (*list)->car->type != TSYMBOL)
+    if (length(*list) != 2 || type_of((*list)->car) != TSYMBOL)
         error("Malformed define");
     DEFINE2(sym, value);
     *sym = (*list)->car;
@@ -906,7 +1568,7 @@ static Obj *prim_num_eq(void *root, Obj **env, Obj **list) {
     Obj *values = eval_list(root, env, list);
     Obj *x = values->car;
     Obj *y = values->cdr->car;
-    if (x->type != TINT || y->type != TINT)
+    if (type_of(x) != TINT || type_of(y) != TINT)
         error("= only takes numbers");
     return x->value == y->value ? True : Nil;
 }
@@ -969,13 +1631,36 @@ int main(int argc, char **argv) {
     // Debug flags
     debug_gc = getEnvFlag("MINILISP_DEBUG_GC");
     always_gc = getEnvFlag("MINILISP_ALWAYS_GC");
-
-    // Memory allocation
-    memory = alloc_semispace();
+    breadth_first = getEnvFlag("MINILISP_BREADTH_FIRST");
+
+#ifdef PARALLEL_GC
+    // GC threads
+    gc_threads = getEnvFlag("MINILISP_GC_THREADS") ? atoi(getenv("MINILISP_GC_THREADS"))
+                                                    : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (gc_threads < 1)
+        gc_threads = 1;
+    workers = calloc(gc_threads, sizeof(Worker));
+    if (!workers)
+        error("Memory exhausted");
+#endif
+
+    // Heap resizing thresholds
+    if (getEnvFlag("MINILISP_GROW_PERCENT"))
+        grow_percent = atoi(getenv("MINILISP_GROW_PERCENT"));
+    if (getEnvFlag("MINILISP_SHRINK_PERCENT"))
+        shrink_percent = atoi(getenv("MINILISP_SHRINK_PERCENT"));
+
+    // Memory allocation. Both semispaces of the old space are allocated once here and flipped on
+    // each major GC.
+    memory = alloc_space(MEMORY_SIZE);
+    from_space = alloc_space(MEMORY_SIZE);
+    nursery = alloc_space(NURSERY_SIZE);
+    if (!memory || !from_space || !nursery)
+        error("Memory exhausted");
 
     // Constants and primitives
     Symbols = Nil;
-    void *root = NULL;
+    void *root = roots;
     DEFINE2(env, expr);
     *env = make_env(root, &Nil, &Nil);
     define_constants(root, env);
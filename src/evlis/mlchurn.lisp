@@ -0,0 +1,16 @@
+; Low-survival workload for minilisp, see "make mltest"
+;
+; Builds and drops a short list over and over. Very little of the heap
+; survives a collection, so the heap should never grow.
+
+(defun iota (n l)
+  (if (< n 1)
+      l
+    (iota (- n 1) (cons n l))))
+
+(define i 0)
+(while (< i 20000)
+  (iota 50 ())
+  (setq i (+ i 1)))
+
+i
@@ -0,0 +1,50 @@
+; Collector stress test for minilisp, see "make mlgctest"
+;
+; Exercises every kind of object: lists, integers, symbols, closures,
+; environments and macros, with some structure kept alive throughout.
+
+(defun make (n l)
+  (if (< n 1)
+      l
+    (make (- n 1) (cons n l))))
+
+(defun len (l n)
+  (if (eq l ())
+      n
+    (len (cdr l) (+ n 1))))
+
+(defun adder (n)
+  (lambda (x) (+ x n)))
+
+(defmacro twice (x)
+  (cons 'progn2 (cons x (cons x ()))))
+
+(defun progn2 (a b) b)
+
+(define keep ())
+(define fns ())
+(define i 0)
+
+(while (< i 60)
+  (setq keep (cons (make (+ i 1) ()) keep))
+  (setq fns (cons (adder i) fns))
+  (twice (make 10 ()))
+  (setq i (+ i 1)))
+
+(define total 0)
+(define p keep)
+(while p
+  (setq total (+ total (len (car p) 0)))
+  (setq p (cdr p)))
+total
+
+(define f fns)
+(define sum 0)
+(while f
+  (setq sum ((car f) sum))
+  (setq f (cdr f)))
+sum
+
+(gensym)
+(len keep 0)
+(car (car keep))
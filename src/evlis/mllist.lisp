@@ -0,0 +1,38 @@
+; List traversal benchmark for minilisp, see "make mlbench"
+;
+; Builds 16 long lists one cell at a time in round-robin order, so
+; that consecutive allocations belong to different lists, then walks
+; each list many times.
+
+(define lists ())
+(define p ())
+(define i 0)
+
+(while (< i 16)
+  (setq lists (cons () lists))
+  (setq i (+ i 1)))
+
+(setq i 0)
+(while (< i 10000)
+  (setq p lists)
+  (while p
+    (setcar p (cons i (car p)))
+    (setq p (cdr p)))
+  (setq i (+ i 1)))
+
+(defun walk (l n)
+  (while l
+    (setq n (+ n 1))
+    (setq l (cdr l)))
+  n)
+
+(define total 0)
+(setq i 0)
+(while (< i 10)
+  (setq p lists)
+  (while p
+    (setq total (+ total (walk (car p) 0)))
+    (setq p (cdr p)))
+  (setq i (+ i 1)))
+
+total
@@ -0,0 +1,5 @@
+; UNBOUNDED RECURSION MUST HALT CLEANLY, SEE "MAKE TEST"
+
+(SETQ F (LAMBDA () (F) NIL))
+
+(F)
@@ -148,6 +148,40 @@
                (G (LAMBDA (X) (F (CDR X)))))
          (F '(1 2 3 4 5 6 7))))
 
+(TERPRI)
+(PRINT 'NUMBERS)
+(PRINT '(NUMBERP 12))
+(PRINT (NUMBERP 12))
+(PRINT '(NUMBERP '12))
+(PRINT (NUMBERP '12))
+(PRINT '(ATOM 12))
+(PRINT (ATOM 12))
+(PRINT '(PLUS 65000 535))
+(PRINT (PLUS 65000 535))
+(PRINT '(DIFFERENCE 10 3))
+(PRINT (DIFFERENCE 10 3))
+(PRINT '(TIMES 12 12))
+(PRINT (TIMES 12 12))
+(PRINT '(QUOTIENT 100 7))
+(PRINT (QUOTIENT 100 7))
+(PRINT '(REMAINDER 100 7))
+(PRINT (REMAINDER 100 7))
+(PRINT '(LESSP 1 2))
+(PRINT (LESSP 1 2))
+(PRINT '(LESSP 2 2))
+(PRINT (LESSP 2 2))
+(PRINT '(GREATERP 3 2))
+(PRINT (GREATERP 3 2))
+(PRINT '(EQUAL (PLUS 1 1) 2))
+(PRINT (EQUAL (PLUS 1 1) 2))
+(PRINT '(LIST 0 (CONS 1 2)))
+(PRINT (LIST 0 (CONS 1 2)))
+(PRINT 'FACTORIAL)
+(PRINT (LABEL ((F (LAMBDA (N)
+                    (COND ((LESSP N 2) 1)
+                          (T (TIMES N (F (DIFFERENCE N 1))))))))
+         (F 8)))
+
 (TERPRI)
 (PRINT 'REGRESSION-TESTS)
 
@@ -174,6 +208,33 @@
          (MAPCAR (LAMBDA (X) (LIST X Y))
                  (QUOTE (A B C)))))
 
+(PRINT 'R4)
+(PRINT (LABEL
+         ((LOOP (LAMBDA (N)
+            ; SELF TAIL CALL, MUST RUN IN CONSTANT SPACE
+            (COND ((LESSP N 1) 'DONE)
+                  (T (LOOP (DIFFERENCE N 1)))))))
+         (LOOP 30000)))
+
+(PRINT 'R5)
+(PRINT (LABEL
+         ((SWAP (LAMBDA (X Y N)
+            ; ARGUMENTS ARE EVALUATED BEFORE ANY ARE ASSIGNED
+            (COND ((EQ N NIL) (LIST X Y))
+                  (T (SWAP Y X (CDR N)))))))
+         (SWAP 'A 'B '(1 2 3))))
+
+(PRINT 'R6)
+(PRINT (COND (NIL 'NO)
+             ('X 'DEAD 'YES)
+             (T 'NEVER)))
+(PRINT (CADR '(A B)))
+
+(PRINT 'R7)
+(PRINT '(A B ; COMMENT BEFORE CLOSING PARENTHESIS
+         ))
+(PRINT "A\"B")
+
 (TERPRI)
 'THATS-ALL
 